@@ -0,0 +1,184 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// PerfCounters.cpp
+///----------------------------------------------------------------------------
+
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace ETL::Math::Bench
+{
+    std::string_view GetPerfEventName(PerfEvent event)
+    {
+        switch (event)
+        {
+        case PerfEvent::Cycles:       return "cycles";
+        case PerfEvent::Instructions: return "instructions";
+        case PerfEvent::L1DMisses:    return "l1dMisses";
+        case PerfEvent::LLCMisses:    return "llcMisses";
+        case PerfEvent::BranchMisses: return "branchMisses";
+        default:                      return "unknown";
+        }
+    }
+
+
+#if defined(__linux__)
+
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace
+    {
+        void DescribeEvent(perf_event_attr& attr, PerfEvent event)
+        {
+            switch (event)
+            {
+            case PerfEvent::Cycles:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case PerfEvent::Instructions:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case PerfEvent::L1DMisses:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case PerfEvent::LLCMisses:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case PerfEvent::BranchMisses:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            default:
+                break;
+            }
+        }
+
+        int OpenEvent(PerfEvent event, int groupFd)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            DescribeEvent(attr, event);
+            attr.disabled = groupFd < 0 ? 1 : 0; /// the leader drives the whole group
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0 /*this thread*/, -1 /*any cpu*/, groupFd, 0UL));
+        }
+    }
+
+
+    PerfCounterGroup::PerfCounterGroup()
+    {
+        mFds.fill(-1);
+
+        mLeader = OpenEvent(PerfEvent::Cycles, -1);
+        if (mLeader < 0)
+        {
+            mStatus = std::string("perf_event_open failed: ") + std::strerror(errno);
+            if (errno == EACCES || errno == EPERM)
+                mStatus += " (see /proc/sys/kernel/perf_event_paranoid)";
+            return;
+        }
+        mFds[0] = mLeader;
+
+        for (int event = 1; event < PERF_EVENT_COUNT; ++event)
+            mFds[event] = OpenEvent(PerfEvent(event), mLeader);
+
+        for (int event = 0; event < PERF_EVENT_COUNT; ++event)
+            if (mFds[event] >= 0 && ioctl(mFds[event], PERF_EVENT_IOC_ID, &mIds[event]) != 0)
+            {
+                close(mFds[event]);
+                mFds[event] = -1;
+            }
+
+        mLeader = mFds[0];
+        mStatus = mLeader >= 0 ? "ok" : "perf_event_open: event ids unavailable";
+    }
+
+
+    PerfCounterGroup::~PerfCounterGroup()
+    {
+        for (int fd : mFds)
+            if (fd >= 0)
+                close(fd);
+    }
+
+
+    void PerfCounterGroup::start()
+    {
+        if (mLeader < 0)
+            return;
+
+        ioctl(mLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(mLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+
+    PerfReading PerfCounterGroup::stop()
+    {
+        PerfReading reading;
+        if (mLeader < 0)
+            return reading;
+
+        ioctl(mLeader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        /// PERF_FORMAT_GROUP | ID layout: nr, time_enabled, time_running, { value, id } * nr
+        std::uint64_t buffer[3 + 2 * PERF_EVENT_COUNT] = {};
+        if (read(mLeader, buffer, sizeof(buffer)) < static_cast<ssize_t>(3 * sizeof(std::uint64_t)))
+            return reading;
+
+        const std::uint64_t count = buffer[0];
+        const std::uint64_t enabled = buffer[1];
+        const std::uint64_t running = buffer[2];
+        if (running == 0)
+            return reading; /// never scheduled on the PMU
+
+        const double scale = double(enabled) / double(running);
+        for (std::uint64_t i = 0; i < count && i < PERF_EVENT_COUNT; ++i)
+        {
+            const std::uint64_t value = buffer[3 + 2 * i];
+            const std::uint64_t id = buffer[4 + 2 * i];
+            for (int event = 0; event < PERF_EVENT_COUNT; ++event)
+            {
+                if (mFds[event] >= 0 && mIds[event] == id)
+                {
+                    reading.values[event] = static_cast<std::uint64_t>(double(value) * scale);
+                    reading.available[event] = true;
+                }
+            }
+        }
+        return reading;
+    }
+
+#else
+
+    PerfCounterGroup::PerfCounterGroup()
+        : mStatus("hardware counters are only read on Linux (perf_event_open)")
+    {
+        mFds.fill(-1);
+    }
+
+    PerfCounterGroup::~PerfCounterGroup() = default;
+
+    void PerfCounterGroup::start() {}
+
+    PerfReading PerfCounterGroup::stop() { return {}; }
+
+#endif
+
+} /// namespace ETL::Math::Bench
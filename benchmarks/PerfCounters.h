@@ -0,0 +1,74 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// PerfCounters.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace ETL::Math::Bench
+{
+    /// Hardware events read around each benchmarked op
+    enum class PerfEvent : int
+    {
+        Cycles,
+        Instructions,
+        L1DMisses,      /// L1 data cache read misses
+        LLCMisses,      /// Last level cache misses
+        BranchMisses,
+        Count
+    };
+
+    constexpr int PERF_EVENT_COUNT = static_cast<int>(PerfEvent::Count);
+
+    /// JSON key of an event
+    std::string_view GetPerfEventName(PerfEvent event);
+
+    /// One start/stop reading. Events the kernel or CPU refused are flagged unavailable.
+    /// Values are scaled by enabled / running time when the kernel multiplexed the group.
+    struct PerfReading
+    {
+        std::array<std::uint64_t, PERF_EVENT_COUNT> values{};
+        std::array<bool, PERF_EVENT_COUNT>          available{};
+
+        bool has(PerfEvent event) const { return available[static_cast<int>(event)]; }
+        std::uint64_t get(PerfEvent event) const { return values[static_cast<int>(event)]; }
+    };
+
+    /// <summary>
+    /// Group of user-space hardware counters of the calling thread (Linux perf_event_open).
+    /// Opening never fails hard: when perf events are missing (other OS, VM without PMU,
+    /// perf_event_paranoid too strict, seccomp) the group is simply unavailable and
+    /// getStatus() says why; events the CPU lacks are left out of the group individually.
+    /// </summary>
+    class PerfCounterGroup
+    {
+    public:
+        PerfCounterGroup();
+        ~PerfCounterGroup();
+        PerfCounterGroup(const PerfCounterGroup&) = delete;
+        PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+        /// True when at least the cycle counter opened
+        bool isAvailable() const { return mLeader >= 0; }
+
+        /// "ok" or the reason the counters are unavailable
+        const std::string& getStatus() const { return mStatus; }
+
+        /// Reset and enable the group
+        void start();
+
+        /// Disable the group and read it (all events unavailable when the group is)
+        PerfReading stop();
+
+    private:
+        std::array<int, PERF_EVENT_COUNT>           mFds;
+        std::array<std::uint64_t, PERF_EVENT_COUNT> mIds{}; /// Kernel ids, match group read entries to events
+        int                                         mLeader = -1;
+        std::string                                 mStatus;
+    };
+
+} /// namespace ETL::Math::Bench
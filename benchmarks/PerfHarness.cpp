@@ -0,0 +1,420 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// PerfHarness.cpp
+///
+/// Times the public batch/hot ops and, where the OS allows it, reads hardware
+/// counters around every sample. Results go to stdout as a table and, with
+/// --json, to a JSON file:
+///
+///   MathLib_PerfHarness [--json out.json] [--filter Inverse] [--repetitions 15]
+///                       [--elements 16384] [--no-counters] [--list]
+///----------------------------------------------------------------------------
+#include "PerfCounters.h"
+#include <MathLib/Types/Matrix3x3.h>
+#include <MathLib/Types/Matrix4x4.h>
+#include <MathLib/Types/Quaternion.h>
+#include <MathLib/Types/Vector3.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+    using namespace ETL::Math;
+    using namespace ETL::Math::Bench;
+
+    /// Minimum duration of one sample, the op is repeated until it is reached
+    constexpr double MIN_SAMPLE_SECONDS = 0.002;
+
+    struct Options
+    {
+        std::string jsonPath;
+        std::string filter;
+        int         repetitions = 15;
+        std::size_t elements = 16384;
+        bool        bCounters = true;
+        bool        bList = false;
+    };
+
+    struct Benchmark
+    {
+        std::string           name;
+        std::string           type;
+        std::function<void()> run; /// processes 'elements' elements
+    };
+
+    struct BenchmarkResult
+    {
+        const Benchmark*    benchmark = nullptr;
+        std::size_t         elementsPerSample = 0;
+        std::vector<double> nsPerElement;      /// one entry per repetition
+        PerfReading         counters;          /// summed over all repetitions
+    };
+
+
+    /// Keeps the compiler from dropping or reordering the stores of the op
+    inline void ClobberMemory()
+    {
+#if defined(_MSC_VER)
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Op registry
+
+    /// Inputs and outputs of every op for one scalar type
+    template<typename Type>
+    struct Fixture
+    {
+        std::vector<Matrix4x4<Type>>  mats4, outMats4;
+        std::vector<Matrix3x3<Type>>  mats3, outMats3;
+        std::vector<Vector3<Type>>    points, outPoints;
+        std::vector<Vector4<Type>>    outClip;
+        std::vector<Quaternion<Type>> quats, outQuats;
+        std::unique_ptr<bool[]>       ok;
+
+        explicit Fixture(std::size_t count)
+            : mats4(count), outMats4(count), mats3(count), outMats3(count), points(count), outPoints(count), outClip(count),
+              quats(count), outQuats(count), ok(new bool[count])
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const double a = 0.01 * double(i);
+                mats4[i] = Matrix4x4<Type>::CreateRotation(a, 0.5 * a, 0.25 * a);
+                mats4[i].setTranslation(Type(double(i % 7)), Type(1), Type(-2));
+                mats3[i] = Matrix3x3<Type>::CreateRotation(a);
+                points[i] = Vector3<Type>{ std::sin(a), std::cos(a), 1.0 + a * 1e-3 };
+                quats[i] = Quaternion<Type>{ 0.1, 0.2 * std::sin(a), 0.3, 0.9 };
+            }
+        }
+    };
+
+    template<typename Type>
+    void AddBenchmarks(std::vector<Benchmark>& benchmarks, std::vector<std::shared_ptr<void>>& fixtures, std::size_t count,
+                       const std::string& type)
+    {
+        const auto fixture = std::make_shared<Fixture<Type>>(count);
+        fixtures.push_back(fixture);
+        Fixture<Type>& f = *fixture;
+
+        benchmarks.push_back({ "Matrix4x4 Multiply", type, [&f, count]()
+        {
+            for (std::size_t i = 0; i + 1 < count; ++i)
+                Multiply(f.outMats4[i], f.mats4[i], f.mats4[i + 1]);
+        } });
+
+        benchmarks.push_back({ "Matrix4x4 Multiply batched", type, [&f]()
+        {
+            Multiply<Type>(f.outMats4, f.mats4, f.mats4[0]);
+        } });
+
+        benchmarks.push_back({ "Matrix4x4 TransformPoint", type, [&f, count]()
+        {
+            const Matrix4x4<Type>& mat = f.mats4[3];
+            for (std::size_t i = 0; i < count; ++i)
+                TransformPoint(f.outPoints[i], mat, f.points[i]);
+        } });
+
+        benchmarks.push_back({ "Matrix4x4 TransformPoints batched", type, [&f]()
+        {
+            TransformPoints<Type>(f.outClip, f.mats4[3], f.points);
+        } });
+
+        benchmarks.push_back({ "Matrix4x4 Inverse", type, [&f, count]()
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                Inverse(f.outMats4[i], f.mats4[i]);
+        } });
+
+        benchmarks.push_back({ "Matrix4x4 InverseN", type, [&f, count]()
+        {
+            InverseN<Type>(f.mats4, f.outMats4, std::span<bool>(f.ok.get(), count));
+        } });
+
+        benchmarks.push_back({ "Matrix3x3 Multiply", type, [&f, count]()
+        {
+            for (std::size_t i = 0; i + 1 < count; ++i)
+                Multiply(f.outMats3[i], f.mats3[i], f.mats3[i + 1]);
+        } });
+
+        benchmarks.push_back({ "Matrix3x3 Inverse", type, [&f, count]()
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                Inverse(f.outMats3[i], f.mats3[i]);
+        } });
+
+        benchmarks.push_back({ "Vector3 Normalize", type, [&f, count]()
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                Normalize(f.outPoints[i], f.points[i]);
+        } });
+
+        benchmarks.push_back({ "Quaternion Multiply", type, [&f, count]()
+        {
+            for (std::size_t i = 0; i + 1 < count; ++i)
+                Multiply(f.outQuats[i], f.quats[i], f.quats[i + 1]);
+        } });
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Measurement
+
+    double Seconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double>(duration).count();
+    }
+
+    BenchmarkResult Measure(const Benchmark& benchmark, const Options& options, PerfCounterGroup* counters)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        /// Warm up the caches and pick the number of runs per sample
+        int runs = 1;
+        for (;;)
+        {
+            const Clock::time_point start = Clock::now();
+            for (int run = 0; run < runs; ++run)
+            {
+                benchmark.run();
+                ClobberMemory();
+            }
+            if (Seconds(Clock::now() - start) >= MIN_SAMPLE_SECONDS || runs >= (1 << 20))
+                break;
+            runs *= 2;
+        }
+
+        BenchmarkResult result;
+        result.benchmark = &benchmark;
+        result.elementsPerSample = options.elements * std::size_t(runs);
+        result.counters.available.fill(true);
+
+        for (int repetition = 0; repetition < options.repetitions; ++repetition)
+        {
+            if (counters)
+                counters->start();
+            const Clock::time_point start = Clock::now();
+
+            for (int run = 0; run < runs; ++run)
+            {
+                benchmark.run();
+                ClobberMemory();
+            }
+
+            const Clock::time_point end = Clock::now();
+            const PerfReading reading = counters ? counters->stop() : PerfReading{};
+
+            result.nsPerElement.push_back(Seconds(end - start) * 1e9 / double(result.elementsPerSample));
+            for (int event = 0; event < PERF_EVENT_COUNT; ++event)
+            {
+                result.counters.values[event] += reading.values[event];
+                result.counters.available[event] = result.counters.available[event] && reading.available[event];
+            }
+        }
+        return result;
+    }
+
+    double Median(std::vector<double> values)
+    {
+        if (values.empty())
+            return 0.0;
+
+        std::sort(values.begin(), values.end());
+        const std::size_t mid = values.size() / 2;
+        return (values.size() % 2) ? values[mid] : 0.5 * (values[mid - 1] + values[mid]);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Report
+
+    std::string EscapeJson(const std::string& text)
+    {
+        std::string escaped;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                escaped += '\\';
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    /// Per element value of an event, or JSON null when it was not counted
+    std::string PerElement(const BenchmarkResult& result, PerfEvent event, std::size_t totalElements)
+    {
+        if (!result.counters.has(event))
+            return "null";
+
+        std::ostringstream text;
+        text << double(result.counters.get(event)) / double(totalElements);
+        return text.str();
+    }
+
+    std::string ToJson(const std::vector<BenchmarkResult>& results, const Options& options, const PerfCounterGroup* counters)
+    {
+        std::ostringstream json;
+        json.precision(6);
+
+        json << "{\n  \"version\": 1,\n";
+        json << "  \"elements\": " << options.elements << ",\n";
+        json << "  \"repetitions\": " << options.repetitions << ",\n";
+        json << "  \"counters\": { \"available\": " << (counters && counters->isAvailable() ? "true" : "false")
+             << ", \"status\": \"" << EscapeJson(counters ? counters->getStatus() : "disabled (--no-counters)") << "\" },\n";
+        json << "  \"benchmarks\": [";
+
+        for (std::size_t r = 0; r < results.size(); ++r)
+        {
+            const BenchmarkResult& result = results[r];
+            const std::size_t totalElements = result.elementsPerSample * result.nsPerElement.size();
+
+            json << (r ? "," : "") << "\n    {\n";
+            json << "      \"name\": \"" << EscapeJson(result.benchmark->name) << "\",\n";
+            json << "      \"type\": \"" << result.benchmark->type << "\",\n";
+            json << "      \"elementsPerSample\": " << result.elementsPerSample << ",\n";
+            json << "      \"nsPerElement\": { \"median\": " << Median(result.nsPerElement)
+                 << ", \"min\": " << *std::min_element(result.nsPerElement.begin(), result.nsPerElement.end()) << ", \"samples\": [";
+            for (std::size_t s = 0; s < result.nsPerElement.size(); ++s)
+                json << (s ? ", " : "") << result.nsPerElement[s];
+            json << "] },\n";
+
+            if (result.counters.has(PerfEvent::Cycles))
+            {
+                const bool bIpc = result.counters.has(PerfEvent::Instructions) && result.counters.get(PerfEvent::Cycles) > 0;
+                json << "      \"counters\": { \"ipc\": ";
+                if (bIpc)
+                    json << double(result.counters.get(PerfEvent::Instructions)) / double(result.counters.get(PerfEvent::Cycles));
+                else
+                    json << "null";
+                for (int event = 0; event < PERF_EVENT_COUNT; ++event)
+                    json << ", \"" << GetPerfEventName(PerfEvent(event)) << "PerElement\": "
+                         << PerElement(result, PerfEvent(event), totalElements);
+                json << " }\n";
+            }
+            else
+            {
+                json << "      \"counters\": null\n";
+            }
+            json << "    }";
+        }
+        json << "\n  ]\n}\n";
+        return json.str();
+    }
+
+    void PrintRow(const BenchmarkResult& result)
+    {
+        const std::size_t totalElements = result.elementsPerSample * result.nsPerElement.size();
+        const auto perElement = [&](PerfEvent event)
+        {
+            return result.counters.has(event) ? double(result.counters.get(event)) / double(totalElements) : -1.0;
+        };
+
+        std::printf("%-36s %-7s %10.3f ns/elem", result.benchmark->name.c_str(), result.benchmark->type.c_str(), Median(result.nsPerElement));
+        if (result.counters.has(PerfEvent::Cycles) && result.counters.has(PerfEvent::Instructions))
+        {
+            std::printf("  IPC %5.2f  L1D %7.4f  LLC %7.4f  BrMiss %7.4f /elem",
+                        double(result.counters.get(PerfEvent::Instructions)) / double(std::max<std::uint64_t>(1, result.counters.get(PerfEvent::Cycles))),
+                        perElement(PerfEvent::L1DMisses), perElement(PerfEvent::LLCMisses), perElement(PerfEvent::BranchMisses));
+        }
+        std::printf("\n");
+    }
+
+    bool ParseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const bool bHasValue = i + 1 < argc;
+
+            if (arg == "--json" && bHasValue)
+                options.jsonPath = argv[++i];
+            else if (arg == "--filter" && bHasValue)
+                options.filter = argv[++i];
+            else if (arg == "--repetitions" && bHasValue)
+                options.repetitions = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--elements" && bHasValue)
+                options.elements = std::max<std::size_t>(2, std::strtoull(argv[++i], nullptr, 10));
+            else if (arg == "--no-counters")
+                options.bCounters = false;
+            else if (arg == "--list")
+                options.bList = true;
+            else
+            {
+                std::fprintf(stderr, "Usage: %s [--json file] [--filter text] [--repetitions n] [--elements n] [--no-counters] [--list]\n", argv[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+        return 2;
+
+    std::vector<Benchmark> benchmarks;
+    std::vector<std::shared_ptr<void>> fixtures;
+    AddBenchmarks<float>(benchmarks, fixtures, options.elements, "float");
+    AddBenchmarks<double>(benchmarks, fixtures, options.elements, "double");
+
+    std::erase_if(benchmarks, [&options](const Benchmark& benchmark)
+    {
+        return (benchmark.name + " " + benchmark.type).find(options.filter) == std::string::npos;
+    });
+
+    if (options.bList)
+    {
+        for (const Benchmark& benchmark : benchmarks)
+            std::printf("%s %s\n", benchmark.name.c_str(), benchmark.type.c_str());
+        return 0;
+    }
+
+    /// Counters are per thread and benchmarks run on this one
+    std::unique_ptr<PerfCounterGroup> counters;
+    if (options.bCounters)
+    {
+        counters = std::make_unique<PerfCounterGroup>();
+        if (!counters->isAvailable())
+            std::fprintf(stderr, "Hardware counters unavailable, timing only: %s\n", counters->getStatus().c_str());
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        results.push_back(Measure(benchmark, options, counters && counters->isAvailable() ? counters.get() : nullptr));
+        PrintRow(results.back());
+        std::fflush(stdout);
+    }
+
+    if (!options.jsonPath.empty())
+    {
+        std::ofstream file(options.jsonPath);
+        file << ToJson(results, options, counters.get());
+        if (!file)
+        {
+            std::fprintf(stderr, "Cannot write %s\n", options.jsonPath.c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
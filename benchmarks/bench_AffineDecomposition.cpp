@@ -0,0 +1,55 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_AffineDecomposition.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/LinearAlgebra/AffineDecomposition.h>
+#include <memory>
+#include <vector>
+
+#define AFFINE_DECOMPOSITION_TYPES float, double
+
+TEMPLATE_TEST_CASE("AffineDecomposition Decompose", "[AffineDecomposition][benchmark]", AFFINE_DECOMPOSITION_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+    using Matrix3 = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using Quat = ETL::Math::Quaternion<TestType>;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Matrix> mats(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        mats[i] = Matrix::CreateTranslation(TestType(double(i % 9)), TestType(1), TestType(-2)) * Matrix::CreateRotation(0.01 * double(i), 0.2, 0.0)
+                * Matrix::CreateScale(1.5, 1.0, 0.75);
+
+    std::vector<Vec3> translations(COUNT), scales(COUNT);
+    std::vector<Quat> rotations(COUNT);
+    std::vector<Matrix3> shears(COUNT);
+    std::vector<ETL::Math::Vector3<double>> eulers(COUNT), eulerScales(COUNT);
+    const std::unique_ptr<bool[]> ok = std::make_unique<bool[]>(COUNT);
+
+    BENCHMARK("GetRotation + GetScaling loop (Euler)")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            ETL::Math::GetRotation(eulers[i], mats[i]);
+            ETL::Math::GetScaling(eulerScales[i], mats[i]);
+        }
+        return eulers[COUNT - 1].x();
+    };
+
+    BENCHMARK("Single Decompose loop")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ok[i] = ETL::Math::Decompose(mats[i], translations[i], rotations[i], scales[i], &shears[i]);
+        return scales[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Batched Decompose")
+    {
+        ETL::Math::Decompose(std::span<const Matrix>{ mats }, std::span<Vec3>{ translations }, std::span<Quat>{ rotations },
+                             std::span<Vec3>{ scales }, std::span<Matrix3>{ shears }, std::span<bool>{ ok.get(), COUNT });
+        return scales[COUNT - 1].getRawValue(0);
+    };
+}
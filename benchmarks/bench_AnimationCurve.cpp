@@ -0,0 +1,79 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_AnimationCurve.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Animation/AnimationCurve.h>
+#include <cmath>
+#include <vector>
+
+#define ANIMATION_CURVE_TYPES float, double
+
+TEMPLATE_TEST_CASE("AnimationCurve Sample", "[AnimationCurve][benchmark]", ANIMATION_CURVE_TYPES)
+{
+    using Curve = ETL::Math::AnimationCurve<TestType>;
+
+    /// 256 playing instances of a 4s, 30 keys/s clip with 256 channels
+    constexpr int CHANNEL_COUNT = 256;
+    constexpr int KEY_COUNT = 120;
+    constexpr int INSTANCE_COUNT = 256;
+    constexpr double FRAME_TIME = 1.0 / 60.0;
+
+    std::vector<double> times(KEY_COUNT);
+    std::vector<TestType> values(KEY_COUNT * CHANNEL_COUNT);
+    for (int key = 0; key < KEY_COUNT; ++key)
+    {
+        times[key] = key / 30.0;
+        for (int c = 0; c < CHANNEL_COUNT; ++c)
+            values[key * CHANNEL_COUNT + c] = static_cast<TestType>(std::sin(0.1 * key + 0.7 * c));
+    }
+
+    const Curve shared(times, values, CHANNEL_COUNT, ETL::Math::CurveInterpolation::Cubic);
+
+    /// Same data as one single-channel curve per track
+    std::vector<Curve> tracks;
+    std::vector<TestType> trackValues(KEY_COUNT);
+    for (int c = 0; c < CHANNEL_COUNT; ++c)
+    {
+        for (int key = 0; key < KEY_COUNT; ++key)
+            trackValues[key] = values[key * CHANNEL_COUNT + c];
+        tracks.emplace_back(times, trackValues, 1, ETL::Math::CurveInterpolation::Cubic);
+    }
+
+    std::vector<double> instanceTimes(INSTANCE_COUNT);
+    for (int i = 0; i < INSTANCE_COUNT; ++i)
+        instanceTimes[i] = std::fmod(i * 0.37, shared.getEndTime());
+    std::vector<ETL::Math::CurveCursor> cursors(INSTANCE_COUNT);
+    std::vector<TestType> out(INSTANCE_COUNT * CHANNEL_COUNT);
+
+    /// Every run plays one frame
+    const auto advance = [&]()
+    {
+        for (double& time : instanceTimes)
+            time = time + FRAME_TIME < shared.getEndTime() ? time + FRAME_TIME : 0.0;
+    };
+
+    BENCHMARK("Per-track curves, binary search")
+    {
+        advance();
+        for (int i = 0; i < INSTANCE_COUNT; ++i)
+            for (int c = 0; c < CHANNEL_COUNT; ++c)
+                tracks[c].sample(std::span<TestType>{ &out[i * CHANNEL_COUNT + c], 1 }, instanceTimes[i]);
+        return out[0];
+    };
+
+    BENCHMARK("Shared keys, binary search")
+    {
+        advance();
+        for (int i = 0; i < INSTANCE_COUNT; ++i)
+            shared.sample(std::span<TestType>{ out }.subspan(i * CHANNEL_COUNT, CHANNEL_COUNT), instanceTimes[i]);
+        return out[0];
+    };
+
+    BENCHMARK("Shared keys, cursors")
+    {
+        advance();
+        shared.sample(std::span<TestType>{ out }, std::span<const double>{ instanceTimes }, std::span<ETL::Math::CurveCursor>{ cursors });
+        return out[0];
+    };
+}
@@ -0,0 +1,56 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_Decomposition3x3.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/LinearAlgebra/Decomposition3x3.h>
+#include <cmath>
+#include <vector>
+
+#define DECOMPOSITION_TYPES float, double
+
+TEMPLATE_TEST_CASE("Decomposition3x3 Eigen and SVD", "[Decomposition3x3][benchmark]", DECOMPOSITION_TYPES)
+{
+    using Matrix = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Matrix> mats(COUNT), symmetric(COUNT), us(COUNT), vs(COUNT);
+    std::vector<Vec3> values(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        TestType v[9];
+        for (int k = 0; k < 9; ++k)
+            v[k] = TestType(std::sin(1.7 * double(i) + 0.9 * k + 0.1 * k * k));
+
+        mats[i] = Matrix{ v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8] };
+        symmetric[i] = Matrix{ v[0], v[1], v[3], v[1], v[2], v[4], v[3], v[4], v[5] };
+    }
+
+    BENCHMARK("Single EigenSymmetric loop")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::EigenSymmetric(values[i], vs[i], symmetric[i]);
+        return values[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Batched EigenSymmetric")
+    {
+        ETL::Math::EigenSymmetric(std::span<Vec3>{ values }, std::span<Matrix>{ vs }, std::span<const Matrix>{ symmetric });
+        return values[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Single SVD loop")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::SVD(us[i], values[i], vs[i], mats[i]);
+        return values[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Batched SVD")
+    {
+        ETL::Math::SVD(std::span<Matrix>{ us }, std::span<Vec3>{ values }, std::span<Matrix>{ vs }, std::span<const Matrix>{ mats });
+        return values[COUNT - 1].getRawValue(0);
+    };
+}
@@ -0,0 +1,61 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_FrameArena.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/FrameArena.h>
+#include <MathLib/Types/Matrix4x4.h>
+#include <MathLib/Types/Vector3.h>
+#include <vector>
+
+#define FRAMEARENA_TYPES float, double
+
+/// Per-job temporaries: heap vectors vs the thread's scratch arena
+TEMPLATE_TEST_CASE("FrameArena scratch buffers", "[FrameArena][benchmark]", FRAMEARENA_TYPES)
+{
+    using namespace ETL::Math;
+
+    constexpr std::size_t COUNT = 16384;
+    constexpr std::size_t JOB_SIZE = 256;
+
+    std::vector<Matrix4x4<TestType>> mats(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        mats[i] = Matrix4x4<TestType>::CreateRotation(0.01 * double(i), 0.5, 0.25);
+    std::vector<Vector3<TestType>> out(COUNT);
+
+    BENCHMARK("std::vector temporaries")
+    {
+        for (std::size_t job = 0; job < COUNT; job += JOB_SIZE)
+        {
+            std::vector<Matrix4x4<TestType>> products(JOB_SIZE);
+            std::vector<Vector3<TestType>> points(JOB_SIZE);
+            for (std::size_t i = 0; i < JOB_SIZE; ++i)
+            {
+                Multiply(products[i], mats[job + i], mats[(job + i + 1) % COUNT]);
+                points[i] = products[i].getTranslation();
+            }
+            for (std::size_t i = 0; i < JOB_SIZE; ++i)
+                out[job + i] = points[i];
+        }
+        return out[7].x();
+    };
+
+    BENCHMARK("FrameArena temporaries")
+    {
+        FrameArena& scratch = GetMathScratch();
+        for (std::size_t job = 0; job < COUNT; job += JOB_SIZE)
+        {
+            FrameArena::Scope scope(scratch);
+            std::span<Matrix4x4<TestType>> products = scratch.allocate<Matrix4x4<TestType>>(JOB_SIZE);
+            ScratchVector<Vector3<TestType>> points(JOB_SIZE, &scratch);
+            for (std::size_t i = 0; i < JOB_SIZE; ++i)
+            {
+                Multiply(products[i], mats[job + i], mats[(job + i + 1) % COUNT]);
+                points[i] = products[i].getTranslation();
+            }
+            for (std::size_t i = 0; i < JOB_SIZE; ++i)
+                out[job + i] = points[i];
+        }
+        return out[7].x();
+    };
+}
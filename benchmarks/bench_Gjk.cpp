@@ -0,0 +1,129 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_Gjk.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Geometry/Gjk.h>
+#include <cmath>
+#include <vector>
+
+#define GJK_TYPES float, double
+
+TEMPLATE_TEST_CASE("Gjk", "[Gjk][benchmark]", GJK_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Box = ETL::Math::Obb<TestType>;
+    using Capsule = ETL::Math::Capsule<TestType>;
+
+    /// 1024 contact pairs, queried on two consecutive frames where every body moved a little
+    constexpr int COUNT = 1024;
+
+    auto value = [](int i, int k) { return std::sin(0.37 * i + 1.71 * k + 0.001 * i * k); };
+    auto rotation = [](double angleX, double angleY)
+    {
+        const double cx = std::cos(angleX), sx = std::sin(angleX);
+        const double cy = std::cos(angleY), sy = std::sin(angleY);
+        return ETL::Math::Matrix3x3<TestType>{ cy, sy * sx, sy * cx, 0.0, cx, -sx, -sy, cy * sx, cy * cx };
+    };
+
+    std::vector<Box> boxes[2], others[2];
+    std::vector<Capsule> capsules[2];
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        const double step = 0.01 * frame;
+        for (int i = 0; i < COUNT; ++i)
+        {
+            /// Pairs around contact: half separated, half slightly penetrating
+            const Vector offset{ 1.0 + 0.6 * value(i, 0) + step, 0.3 * value(i, 1), 0.3 * value(i, 2) - step };
+            boxes[frame].emplace_back(Vector{ 0.0, 0.0, 0.0 }, rotation(value(i, 3) + step, value(i, 4)), Vector{ 0.5, 0.4, 0.3 });
+            others[frame].emplace_back(offset, rotation(value(i, 5), value(i, 6) - step), Vector{ 0.3, 0.5, 0.4 });
+            capsules[frame].emplace_back(offset, offset + Vector{ 0.2, 0.5 * value(i, 7), 0.4 }, 0.2);
+        }
+    }
+
+    std::vector<ETL::Math::GjkCache<TestType>> caches(COUNT), capsuleCaches(COUNT);
+    ETL::Math::GjkResult<TestType> result;
+
+    BENCHMARK("GjkDistance box-box, cold")
+    {
+        double total = 0.0;
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                ETL::Math::GjkCache<TestType> cache;
+                ETL::Math::GjkDistance(result, boxes[frame][i], others[frame][i], cache);
+                total += result.distance;
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK("GjkDistance box-box, warm")
+    {
+        double total = 0.0;
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                ETL::Math::GjkDistance(result, boxes[frame][i], others[frame][i], caches[i]);
+                total += result.distance;
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK("EpaPenetration box-box, cold")
+    {
+        double total = 0.0;
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                ETL::Math::GjkCache<TestType> cache;
+                ETL::Math::EpaPenetration(result, boxes[frame][i], others[frame][i], cache);
+                total += result.depth;
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK("EpaPenetration box-box, warm")
+    {
+        double total = 0.0;
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                ETL::Math::EpaPenetration(result, boxes[frame][i], others[frame][i], caches[i]);
+                total += result.depth;
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK("GjkIntersect box-capsule, cold")
+    {
+        int hits = 0;
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                ETL::Math::GjkCache<TestType> cache;
+                hits += ETL::Math::GjkIntersect(boxes[frame][i], capsules[frame][i], cache);
+            }
+        }
+        return hits;
+    };
+
+    BENCHMARK("GjkIntersect box-capsule, warm")
+    {
+        int hits = 0;
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            for (int i = 0; i < COUNT; ++i)
+                hits += ETL::Math::GjkIntersect(boxes[frame][i], capsules[frame][i], capsuleCaches[i]);
+        }
+        return hits;
+    };
+}
@@ -0,0 +1,89 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_GpuExport.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Graphics/GpuExport.h>
+#include <cmath>
+#include <vector>
+
+#define GPU_EXPORT_TYPES float, double
+
+TEMPLATE_TEST_CASE("GpuExport", "[GpuExport][benchmark]", GPU_EXPORT_TYPES)
+{
+    using namespace ETL::Math;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Matrix4x4<TestType>> mats4(COUNT);
+    std::vector<Matrix3x3<TestType>> mats3(COUNT);
+    std::vector<Vector3<TestType>> vectors(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        const double a = 0.01 * double(i);
+        mats4[i] = Matrix4x4<TestType>::CreateRotation(a, 0.5 * a, 0.25 * a);
+        mats4[i].setTranslation(TestType(i), TestType(1), TestType(2));
+        mats3[i] = Matrix3x3<TestType>::CreateRotation(a);
+        vectors[i] = Vector3<TestType>{ std::sin(a), std::cos(a), a };
+    }
+
+    std::vector<float> buffer(COUNT * 16);
+
+    BENCHMARK("Matrix4x4 row-major 3x4 per element")
+    {
+        float* out = buffer.data();
+        for (const Matrix4x4<TestType>& mat : mats4)
+            for (int row = 0; row < 3; ++row)
+                for (int col = 0; col < 4; ++col)
+                    *out++ = static_cast<float>(mat(row, col));
+        return buffer[5];
+    };
+
+    BENCHMARK("Matrix4x4 row-major 3x4 batched")
+    {
+        return ExportToGpu<TestType>(buffer, mats4, GpuLayout::Std430, GpuMatrixOrder::RowMajor, true);
+    };
+
+    BENCHMARK("Matrix4x4 std140 batched")
+    {
+        return ExportToGpu<TestType>(buffer, mats4, GpuLayout::Std140);
+    };
+
+    BENCHMARK("Matrix3x3 std140 per element")
+    {
+        float* out = buffer.data();
+        for (const Matrix3x3<TestType>& mat : mats3)
+        {
+            for (int col = 0; col < 3; ++col)
+            {
+                for (int row = 0; row < 3; ++row)
+                    *out++ = static_cast<float>(mat(row, col));
+                *out++ = 0.0f;
+            }
+        }
+        return buffer[5];
+    };
+
+    BENCHMARK("Matrix3x3 std140 batched")
+    {
+        return ExportToGpu<TestType>(buffer, mats3, GpuLayout::Std140);
+    };
+
+    BENCHMARK("Vector3 std140 per element")
+    {
+        float* out = buffer.data();
+        for (const Vector3<TestType>& v : vectors)
+        {
+            *out++ = static_cast<float>(v.x());
+            *out++ = static_cast<float>(v.y());
+            *out++ = static_cast<float>(v.z());
+            *out++ = 0.0f;
+        }
+        return buffer[5];
+    };
+
+    BENCHMARK("Vector3 std140 batched")
+    {
+        return ExportToGpu<TestType>(buffer, vectors, GpuLayout::Std140);
+    };
+}
@@ -0,0 +1,67 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_Instrumentation.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/Instrumentation.h>
+#include <MathLib/Types/Matrix4x4.h>
+#include <MathLib/Types/Quaternion.h>
+#include <MathLib/Types/Vector3.h>
+#include <vector>
+
+#define INSTRUMENT_TYPES float, double
+
+/// Instrumented hot paths, compare a default build with a -DMATHLIB_INSTRUMENT=ON one
+TEMPLATE_TEST_CASE("Instrumentation overhead", "[Instrumentation][benchmark]", INSTRUMENT_TYPES)
+{
+    using namespace ETL::Math;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Matrix4x4<TestType>> mats(COUNT);
+    std::vector<Vector3<TestType>> vectors(COUNT);
+    std::vector<Quaternion<TestType>> quats(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        const double a = 0.01 * double(i);
+        mats[i] = Matrix4x4<TestType>::CreateRotation(a, 0.5 * a, 0.25 * a);
+        vectors[i] = Vector3<TestType>{ 1.0 + a, 2.0, 3.0 - a };
+        quats[i] = Quaternion<TestType>{ 0.1, 0.2 * a, 0.3, 1.0 };
+    }
+    std::vector<Matrix4x4<TestType>> outMats(COUNT);
+    std::vector<Vector3<TestType>> outVectors(COUNT);
+    std::vector<Quaternion<TestType>> outQuats(COUNT);
+
+    ResetInstrumentCounters();
+
+    BENCHMARK("Matrix4x4 Multiply")
+    {
+        for (std::size_t i = 0; i + 1 < COUNT; ++i)
+            Multiply(outMats[i], mats[i], mats[i + 1]);
+        return outMats[7](0, 0);
+    };
+
+    BENCHMARK("Matrix4x4 Inverse")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            Inverse(outMats[i], mats[i]);
+        return outMats[7](0, 0);
+    };
+
+    BENCHMARK("Vector3 Normalize")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            Normalize(outVectors[i], vectors[i]);
+        return outVectors[7].x();
+    };
+
+    BENCHMARK("Quaternion Multiply")
+    {
+        for (std::size_t i = 0; i + 1 < COUNT; ++i)
+            Multiply(outQuats[i], quats[i], quats[i + 1]);
+        return outQuats[7].w();
+    };
+
+    if constexpr (IsInstrumentEnabled())
+        WARN(TakeInstrumentSnapshot().toJson());
+}
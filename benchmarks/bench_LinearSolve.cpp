@@ -0,0 +1,124 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_LinearSolve.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/LinearAlgebra/LinearSolve.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#define LINEARSOLVE_TYPES float, double
+
+namespace
+{
+    /// Symmetric positive definite and diagonally dominant (valid input for every solver)
+    template<typename Mat>
+    Mat MakeSystem(std::size_t seed)
+    {
+        using Shape = ETL::Math::helpers::MatrixShape<Mat>;
+        using Type = typename Shape::ValueType;
+
+        Mat result;
+        for (int row = 0; row < Shape::ROWS; ++row)
+        {
+            for (int col = 0; col <= row; ++col)
+            {
+                const Type value = Type(std::sin(double(seed) * 0.37 + row * 1.3 + col * 0.7));
+                result.setRawValue(row, col, row == col ? value + Type(Shape::ROWS) : value);
+                result.setRawValue(col, row, row == col ? value + Type(Shape::ROWS) : value);
+            }
+        }
+        return result;
+    }
+
+    template<typename Vec>
+    Vec MakeRhs(std::size_t seed)
+    {
+        using Shape = ETL::Math::helpers::VectorShape<Vec>;
+
+        Vec result;
+        for (int i = 0; i < Shape::SIZE; ++i)
+            result.setRawValue(i, typename Shape::ValueType(std::cos(double(seed) * 0.11 + i)));
+        return result;
+    }
+
+    template<typename Mat, typename Vec>
+    void RunSolveBenchmarks(const char* shape)
+    {
+        using namespace ETL::Math;
+
+        constexpr std::size_t COUNT = 16384;
+
+        std::vector<Mat> mats(COUNT);
+        std::vector<Vec> rhs(COUNT), x(COUNT);
+        std::unique_ptr<bool[]> ok = std::make_unique<bool[]>(COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            mats[i] = MakeSystem<Mat>(i);
+            rhs[i] = MakeRhs<Vec>(i);
+        }
+
+        const std::span<Vec> outSpan{ x };
+        const std::span<const Mat> matSpan{ mats };
+        const std::span<const Vec> rhsSpan{ rhs };
+        const std::span<bool> okSpan{ ok.get(), COUNT };
+
+        BENCHMARK(std::string(shape) + " Inverse + Multiply")
+        {
+            Mat inverse{};
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                ok[i] = Inverse(inverse, mats[i]);
+                if (ok[i])
+                    Multiply(x[i], inverse, rhs[i]);
+            }
+            return x[COUNT - 1].getRawValue(0);
+        };
+
+        BENCHMARK(std::string(shape) + " Solve")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+                ok[i] = Solve(x[i], mats[i], rhs[i]);
+            return x[COUNT - 1].getRawValue(0);
+        };
+
+        BENCHMARK(std::string(shape) + " SolveCholesky")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+                ok[i] = SolveCholesky(x[i], mats[i], rhs[i]);
+            return x[COUNT - 1].getRawValue(0);
+        };
+
+        BENCHMARK(std::string(shape) + " SolveLDLT")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+                ok[i] = SolveLDLT(x[i], mats[i], rhs[i]);
+            return x[COUNT - 1].getRawValue(0);
+        };
+
+        BENCHMARK(std::string(shape) + " Solve batch")
+        {
+            return Solve(outSpan, matSpan, rhsSpan, okSpan);
+        };
+
+        BENCHMARK(std::string(shape) + " SolveCholesky batch")
+        {
+            return SolveCholesky(outSpan, matSpan, rhsSpan, okSpan);
+        };
+
+        BENCHMARK(std::string(shape) + " SolveLDLT batch")
+        {
+            return SolveLDLT(outSpan, matSpan, rhsSpan, okSpan);
+        };
+    }
+}
+
+TEMPLATE_TEST_CASE("LinearSolve", "[LinearSolve][benchmark]", LINEARSOLVE_TYPES)
+{
+    using namespace ETL::Math;
+
+    RunSolveBenchmarks<Matrix3x3<TestType>, Vector3<TestType>>("3x3");
+    RunSolveBenchmarks<Matrix4x4<TestType>, Vector4<TestType>>("4x4");
+    RunSolveBenchmarks<Matrix6x6<TestType>, Vector6<TestType>>("6x6");
+}
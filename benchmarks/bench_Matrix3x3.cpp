@@ -0,0 +1,82 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_Matrix3x3.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Types/Matrix3x3.h>
+#include <vector>
+
+#define MATRIX3x3_TYPES int, float, double
+
+namespace
+{
+    constexpr std::size_t COUNT = 4096;
+
+    /// Reference written the way the kernel used to be: every read and write goes through
+    /// the non-const operator()/operator[] ElementProxy (fixed point decode/encode per access)
+    template<typename Type>
+    void MultiplyThroughProxy(ETL::Math::Vector3<Type>& outResult, ETL::Math::Matrix3x3<Type>& mat, ETL::Math::Vector3<Type>& vec)
+    {
+        for (int row = 0; row < 3; ++row)
+            outResult[row] = mat(row, 0) * vec[0] + mat(row, 1) * vec[1] + mat(row, 2) * vec[2];
+    }
+
+    /// Reference working directly on the unchecked raw column accessors (float/double only)
+    template<typename Type>
+    void MultiplyRawColumns(ETL::Math::Vector3<Type>& outResult, const ETL::Math::Matrix3x3<Type>& mat, const ETL::Math::Vector3<Type>& vec)
+    {
+        const Type* c0 = mat.getRawCol(0);
+        const Type* c1 = mat.getRawCol(1);
+        const Type* c2 = mat.getRawCol(2);
+        const Type v0 = vec.getRawValue(0), v1 = vec.getRawValue(1), v2 = vec.getRawValue(2);
+
+        for (int row = 0; row < 3; ++row)
+            outResult.setRawValue(row, c0[row] * v0 + c1[row] * v1 + c2[row] * v2);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Matrix3x3 Multiply Vector3", "[Matrix3x3][benchmark]", MATRIX3x3_TYPES)
+{
+    using Matrix = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    Matrix mat = Matrix::CreateTranslation(TestType(3), TestType(-2)) * Matrix::CreateRotation(0.7) * Matrix::CreateScale(1.5, 0.5);
+    std::vector<Vec3> points(COUNT), results(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        points[i] = Vec3{ double(i % 13) * 0.5, -double(i % 7), 1.0 };
+
+    /// Sanity: the references compute the same product (fixed point proxies decode to whole numbers, so only floats compare)
+    if constexpr (!std::integral<TestType>)
+    {
+        Vec3 viaKernel, viaProxy;
+        ETL::Math::Multiply(viaKernel, mat, points[5]);
+        MultiplyThroughProxy(viaProxy, mat, points[5]);
+        REQUIRE(ETL::Math::isEqual(viaKernel, viaProxy));
+    }
+
+    BENCHMARK("Multiply (raw kernel)")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::Multiply(results[i], mat, points[i]);
+        return results[COUNT - 1].x();
+    };
+
+    BENCHMARK("Element proxy reference")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            MultiplyThroughProxy(results[i], mat, points[i]);
+        return results[COUNT - 1].x();
+    };
+
+    if constexpr (!std::integral<TestType>)
+    {
+        BENCHMARK("Raw column reference")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+                MultiplyRawColumns(results[i], mat, points[i]);
+            return results[COUNT - 1].x();
+        };
+    }
+}
@@ -0,0 +1,88 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_Matrix4x4.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Types/Matrix4x4.h>
+#include <memory>
+#include <vector>
+
+#define MATRIX4x4_TYPES int, float, double
+
+TEMPLATE_TEST_CASE("Matrix4x4 Batched Multiply", "[Matrix4x4][benchmark]", MATRIX4x4_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Matrix> local(COUNT), world(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        local[i] = Matrix::CreateTranslation(TestType(double(i % 9)), TestType(1), TestType(-2)) * Matrix::CreateRotation(0.01 * double(i), 0.2, 0.0);
+    const Matrix parent = Matrix::CreateRotation(0.3, -0.4, 0.5) * Matrix::CreateScale(2.0, 2.0, 2.0);
+
+    BENCHMARK("Single Multiply loop (pairwise)")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::Multiply(world[i], local[i], local[COUNT - 1 - i]);
+        return world[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Batched pairwise")
+    {
+        ETL::Math::Multiply(std::span<Matrix>{ world }, std::span<const Matrix>{ local }, std::span<const Matrix>{ local });
+        return world[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Single Multiply loop (left broadcast)")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::Multiply(world[i], parent, local[i]);
+        return world[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Batched left broadcast")
+    {
+        ETL::Math::Multiply(std::span<Matrix>{ world }, parent, std::span<const Matrix>{ local });
+        return world[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Batched right broadcast")
+    {
+        ETL::Math::Multiply(std::span<Matrix>{ world }, std::span<const Matrix>{ local }, parent);
+        return world[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Parallel left broadcast")
+    {
+        ETL::Math::MultiplyParallel(std::span<Matrix>{ world }, parent, std::span<const Matrix>{ local });
+        return world[COUNT - 1].getRawValue(0);
+    };
+}
+
+
+TEMPLATE_TEST_CASE("Matrix4x4 Batched Inverse", "[Matrix4x4][benchmark]", MATRIX4x4_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Matrix> local(COUNT), inverted(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        local[i] = Matrix::CreateTranslation(TestType(double(i % 9)), TestType(1), TestType(-2)) * Matrix::CreateRotation(0.01 * double(i), 0.2, 0.0)
+                 * Matrix::CreateScale(1.5, 1.0, 0.75);
+    const std::unique_ptr<bool[]> ok = std::make_unique<bool[]>(COUNT); /// std::vector<bool> is not contiguous
+
+    BENCHMARK("Single Inverse loop")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ok[i] = ETL::Math::Inverse(inverted[i], local[i]);
+        return inverted[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Batched InverseN")
+    {
+        ETL::Math::InverseN(std::span<const Matrix>{ local }, std::span<Matrix>{ inverted },
+                            std::span<bool>{ ok.get(), COUNT });
+        return inverted[COUNT - 1].getRawValue(0);
+    };
+}
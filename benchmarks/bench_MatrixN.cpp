@@ -0,0 +1,96 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_MatrixN.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Types/MatrixN.h>
+#include <vector>
+
+#define MATRIXN_TYPES float, double
+
+namespace
+{
+    /// Textbook triple loop over raw values (what generic code did before MatrixN)
+    template<typename Out, typename A, typename B>
+    void NaiveMultiply(Out& out, const A& a, const B& b)
+    {
+        using Shape = ETL::Math::helpers::MatrixShape<A>;
+
+        for (int row = 0; row < Shape::ROWS; ++row)
+        {
+            for (int col = 0; col < ETL::Math::helpers::MatrixShape<B>::COLS; ++col)
+            {
+                typename Shape::ValueType sum = 0;
+                for (int k = 0; k < Shape::COLS; ++k)
+                    sum += a.getRawValue(row, k) * b.getRawValue(k, col);
+                out.setRawValue(row, col, sum);
+            }
+        }
+    }
+
+    template<typename Mat>
+    Mat MakeMatrix(std::size_t seed)
+    {
+        using Shape = ETL::Math::helpers::MatrixShape<Mat>;
+
+        Mat result;
+        for (int elem = 0; elem < Shape::ROWS * Shape::COLS; ++elem)
+            result.setRawValue(elem, typename Shape::ValueType(double((seed * 7 + std::size_t(elem) * 3) % 17) / 8.0 - 1.0));
+        return result;
+    }
+}
+
+TEMPLATE_TEST_CASE("MatrixN Multiply", "[MatrixN][benchmark]", MATRIXN_TYPES)
+{
+    using namespace ETL::Math;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Matrix6x6<TestType>> inertia(COUNT), jacobians(COUNT), spatial(COUNT);
+    std::vector<Matrix3x4<TestType>> affine(COUNT), composed(COUNT);
+    std::vector<Matrix4x4<TestType>> local(COUNT);
+    std::vector<Vector6<TestType>> twists(COUNT), wrenches(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        inertia[i] = MakeMatrix<Matrix6x6<TestType>>(i);
+        jacobians[i] = MakeMatrix<Matrix6x6<TestType>>(i + 5);
+        affine[i] = MakeMatrix<Matrix3x4<TestType>>(i);
+        local[i] = MakeMatrix<Matrix4x4<TestType>>(i + 3);
+        twists[i] = inertia[i].getCol(int(i % 6));
+    }
+
+    BENCHMARK("6x6 * 6x6 naive loop")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            NaiveMultiply(spatial[i], inertia[i], jacobians[i]);
+        return spatial[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("6x6 * 6x6 Multiply")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            Multiply(spatial[i], inertia[i], jacobians[i]);
+        return spatial[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("6x6 * Vector6 Multiply")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            Multiply(wrenches[i], inertia[i], twists[i]);
+        return wrenches[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("3x4 * Matrix4x4 naive loop")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            NaiveMultiply(composed[i], affine[i], local[i]);
+        return composed[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("3x4 * Matrix4x4 Multiply")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            Multiply(composed[i], affine[i], local[i]);
+        return composed[COUNT - 1].getRawValue(0);
+    };
+}
@@ -0,0 +1,129 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_Overlap.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Geometry/Overlap.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#define OVERLAP_TYPES float, double
+
+TEMPLATE_TEST_CASE("Overlap", "[Overlap][benchmark]", OVERLAP_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+
+    constexpr int COUNT = 16384;
+
+    auto value = [](int i, int k, double scale) { return scale * std::sin(0.37 * i + 1.71 * k + 0.1 * i * k); };
+
+    /// Hitbox pairs i / COUNT + i, about half of them overlapping
+    std::vector<Sphere<TestType>> spheres;
+    std::vector<Capsule<TestType>> capsules;
+    std::vector<Obb<TestType>> boxes;
+    std::vector<TestType> components[1 + 3 + 3 + 9 + 3];
+    for (int i = 0; i < 2 * COUNT; ++i)
+    {
+        const double cx = std::cos(value(i, 10, 3.0)), sx = std::sin(value(i, 10, 3.0));
+        const double cy = std::cos(value(i, 11, 3.0)), sy = std::sin(value(i, 11, 3.0));
+        const Matrix3x3<TestType> rotation{ cy, sy * sx, sy * cx, 0.0, cx, -sx, -sy, cy * sx, cy * cx };
+
+        const Vector center{ value(i, 0, 3.0), value(i, 1, 3.0), value(i, 2, 3.0) };
+        const Vector end = center + Vector{ value(i, 3, 2.0), value(i, 4, 2.0), value(i, 5, 2.0) };
+        const double radius = 0.5 + 0.4 * value(i, 6, 1.0);
+        const Vector halfExtents{ 0.8 + 0.5 * value(i, 7, 1.0), 0.8 + 0.5 * value(i, 8, 1.0), 0.8 + 0.5 * value(i, 9, 1.0) };
+
+        spheres.emplace_back(center, radius);
+        capsules.emplace_back(center, end, radius);
+        boxes.emplace_back(center, rotation, halfExtents);
+
+        components[0].push_back(TestType(radius));
+        for (int c = 0; c < 3; ++c)
+        {
+            components[1 + c].push_back(center.getRawValue(c));
+            components[4 + c].push_back(end.getRawValue(c));
+            components[16 + c].push_back(halfExtents.getRawValue(c));
+            for (int axis = 0; axis < 3; ++axis)
+                components[7 + axis * 3 + c].push_back(rotation.getRawValue(c, axis));
+        }
+    }
+
+    auto span = [&](int component, int first) { return std::span<const TestType>{ components[component].data() + first, COUNT }; };
+
+    SphereSoA<TestType> sphereViews[2];
+    CapsuleSoA<TestType> capsuleViews[2];
+    ObbSoA<TestType> boxViews[2];
+    for (int view = 0; view < 2; ++view)
+    {
+        const int first = view * COUNT;
+        sphereViews[view].radius = span(0, first);
+        capsuleViews[view].radius = span(0, first);
+        for (int c = 0; c < 3; ++c)
+        {
+            sphereViews[view].center[c] = span(1 + c, first);
+            capsuleViews[view].start[c] = span(1 + c, first);
+            capsuleViews[view].end[c] = span(4 + c, first);
+            boxViews[view].center[c] = span(1 + c, first);
+            boxViews[view].halfExtents[c] = span(16 + c, first);
+            for (int axis = 0; axis < 3; ++axis)
+                boxViews[view].axes[axis][c] = span(7 + axis * 3 + c, first);
+        }
+    }
+
+    std::unique_ptr<bool[]> overlap = std::make_unique<bool[]>(COUNT);
+    const std::span<bool> out{ overlap.get(), COUNT };
+
+    BENCHMARK("Sphere-sphere single")
+    {
+        int hits = 0;
+        for (int i = 0; i < COUNT; ++i)
+            hits += OverlapSphereSphere(spheres[i], spheres[COUNT + i]) ? 1 : 0;
+        return hits;
+    };
+
+    BENCHMARK("Sphere-sphere batch")
+    {
+        return OverlapSphereSphere(out, sphereViews[0], sphereViews[1]);
+    };
+
+    BENCHMARK("Sphere-capsule single")
+    {
+        int hits = 0;
+        for (int i = 0; i < COUNT; ++i)
+            hits += OverlapSphereCapsule(spheres[i], capsules[COUNT + i]) ? 1 : 0;
+        return hits;
+    };
+
+    BENCHMARK("Sphere-capsule batch")
+    {
+        return OverlapSphereCapsule(out, sphereViews[0], capsuleViews[1]);
+    };
+
+    BENCHMARK("Capsule-capsule single")
+    {
+        int hits = 0;
+        for (int i = 0; i < COUNT; ++i)
+            hits += OverlapCapsuleCapsule(capsules[i], capsules[COUNT + i]) ? 1 : 0;
+        return hits;
+    };
+
+    BENCHMARK("Capsule-capsule batch")
+    {
+        return OverlapCapsuleCapsule(out, capsuleViews[0], capsuleViews[1]);
+    };
+
+    BENCHMARK("Obb-Obb single")
+    {
+        int hits = 0;
+        for (int i = 0; i < COUNT; ++i)
+            hits += OverlapObbObb(boxes[i], boxes[COUNT + i]) ? 1 : 0;
+        return hits;
+    };
+
+    BENCHMARK("Obb-Obb batch")
+    {
+        return OverlapObbObb(out, boxViews[0], boxViews[1]);
+    };
+}
@@ -0,0 +1,103 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_PackedTypes.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Compression/PackedTypes.h>
+#include <cmath>
+#include <vector>
+
+#define PACKED_TYPES float, double
+
+TEMPLATE_TEST_CASE("PackedTypes Encode & Decode", "[PackedTypes][benchmark]", PACKED_TYPES)
+{
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using Quat = ETL::Math::Quaternion<TestType>;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Vec3> vecs(COUNT), normals(COUNT), decodedVecs(COUNT);
+    std::vector<Quat> rotations(COUNT), decodedRotations(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        const double a = 0.01 * double(i);
+        vecs[i] = Vec3{ 100.0 * std::sin(a), 50.0 * std::cos(1.3 * a), double(i % 17) };
+        normals[i] = Vec3{ std::sin(a) * std::cos(0.7 * a), std::sin(a) * std::sin(0.7 * a), std::cos(a) };
+        rotations[i] = Quat{ 0.0, std::sin(0.5 * a), 0.0, std::cos(0.5 * a) };
+    }
+    const ETL::Math::QuantizationRange<TestType> range = ETL::Math::ComputeQuantizationRange(std::span<const Vec3>{ vecs });
+
+    std::vector<ETL::Math::PackedVector3Half> halves(COUNT);
+    std::vector<ETL::Math::PackedUnitVectorOct> octs(COUNT);
+    std::vector<ETL::Math::PackedQuatSmallest3> quats(COUNT);
+    std::vector<ETL::Math::PackedPosition16> positions(COUNT);
+
+    BENCHMARK("Half single loop encode")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::Encode(halves[i], vecs[i]);
+        return halves[COUNT - 1].x;
+    };
+
+    BENCHMARK("Half batched encode")
+    {
+        ETL::Math::Encode(std::span<ETL::Math::PackedVector3Half>{ halves }, std::span<const Vec3>{ vecs });
+        return halves[COUNT - 1].x;
+    };
+
+    BENCHMARK("Half batched decode")
+    {
+        ETL::Math::Decode(std::span<Vec3>{ decodedVecs }, std::span<const ETL::Math::PackedVector3Half>{ halves });
+        return decodedVecs[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Octahedral single loop encode")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::Encode(octs[i], normals[i]);
+        return octs[COUNT - 1].x;
+    };
+
+    BENCHMARK("Octahedral batched encode")
+    {
+        ETL::Math::Encode(std::span<ETL::Math::PackedUnitVectorOct>{ octs }, std::span<const Vec3>{ normals });
+        return octs[COUNT - 1].x;
+    };
+
+    BENCHMARK("Octahedral batched decode")
+    {
+        ETL::Math::Decode(std::span<Vec3>{ decodedVecs }, std::span<const ETL::Math::PackedUnitVectorOct>{ octs });
+        return decodedVecs[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Smallest three single loop encode")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            ETL::Math::Encode(quats[i], rotations[i]);
+        return quats[COUNT - 1].bits[0];
+    };
+
+    BENCHMARK("Smallest three batched encode")
+    {
+        ETL::Math::Encode(std::span<ETL::Math::PackedQuatSmallest3>{ quats }, std::span<const Quat>{ rotations });
+        return quats[COUNT - 1].bits[0];
+    };
+
+    BENCHMARK("Smallest three batched decode")
+    {
+        ETL::Math::Decode(std::span<Quat>{ decodedRotations }, std::span<const ETL::Math::PackedQuatSmallest3>{ quats });
+        return decodedRotations[COUNT - 1].getRawValue(0);
+    };
+
+    BENCHMARK("Position batched encode")
+    {
+        ETL::Math::Encode(std::span<ETL::Math::PackedPosition16>{ positions }, std::span<const Vec3>{ vecs }, range);
+        return positions[COUNT - 1].x;
+    };
+
+    BENCHMARK("Position batched decode")
+    {
+        ETL::Math::Decode(std::span<Vec3>{ decodedVecs }, std::span<const ETL::Math::PackedPosition16>{ positions }, range);
+        return decodedVecs[COUNT - 1].getRawValue(0);
+    };
+}
@@ -0,0 +1,83 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_SpatialHashGrid.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Geometry/SpatialHashGrid.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#define SPATIAL_HASH_GRID_TYPES float, double
+
+TEMPLATE_TEST_CASE("SpatialHashGrid", "[SpatialHashGrid][benchmark]", SPATIAL_HASH_GRID_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Grid = ETL::Math::SpatialHashGrid<TestType>;
+
+    /// A crowd of 128K agents spread over a 400 x 400 x 20 box
+    constexpr int COUNT = 131072;
+    constexpr int QUERY_COUNT = 4096;
+    constexpr double RADIUS = 1.0;
+
+    auto value = [](int i, int k) { return std::sin(0.37 * i + 1.71 * k + 0.001 * i * k); };
+
+    std::vector<Vector> positions;
+    for (int i = 0; i < COUNT; ++i)
+        positions.emplace_back(200.0 * value(i, 0), 200.0 * value(i, 1), 10.0 * value(i, 2));
+
+    /// Mostly static set: 1 agent in 100 walks to another cell every frame
+    std::vector<Vector> moved = positions;
+    std::vector<std::uint32_t> changed;
+    for (int i = 0; i < COUNT; i += 100)
+    {
+        moved[i] = moved[i] + Vector{ 1.5, -1.5, 0.0 };
+        changed.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    Grid grid(RADIUS);
+    grid.build(positions, 1);
+
+    std::vector<std::uint32_t> neighbors(256);
+
+    BENCHMARK("Build, 1 thread")
+    {
+        grid.build(positions, 1);
+        return grid.size();
+    };
+
+    BENCHMARK("Build, all threads")
+    {
+        grid.build(positions);
+        return grid.size();
+    };
+
+    BENCHMARK("Update, 1% moved")
+    {
+        grid.update(moved, changed);
+        return grid.update(positions, changed);
+    };
+
+    BENCHMARK("Rebuild, 1% moved")
+    {
+        grid.build(moved, 1);
+        grid.build(positions, 1);
+        return grid.size();
+    };
+
+    BENCHMARK("Radius queries")
+    {
+        std::size_t found = 0;
+        for (int q = 0; q < QUERY_COUNT; ++q)
+            found += grid.queryRadius(neighbors, positions[q * (COUNT / QUERY_COUNT)], RADIUS).size();
+        return found;
+    };
+
+    BENCHMARK("Nearest 8 queries")
+    {
+        std::size_t found = 0;
+        for (int q = 0; q < QUERY_COUNT; ++q)
+            found += grid.queryNearest(std::span<std::uint32_t>{ neighbors }.first(8), positions[q * (COUNT / QUERY_COUNT)], 4.0 * RADIUS).size();
+        return found;
+    };
+}
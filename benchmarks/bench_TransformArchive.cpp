@@ -0,0 +1,80 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Benchmark
+/// bench_TransformArchive.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Serialization/TransformArchive.h>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#define ARCHIVE_TYPES float, double
+
+TEMPLATE_TEST_CASE("TransformArchive Load", "[TransformArchive][benchmark]", ARCHIVE_TYPES)
+{
+    using Mat4 = ETL::Math::Matrix4x4<TestType>;
+
+    constexpr std::size_t COUNT = 16384;
+
+    std::vector<Mat4> matrices(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        matrices[i] = Mat4::CreateTranslation(TestType(i), TestType(0), TestType(1));
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    const std::filesystem::path archivePath = directory / "etl_mathlib_bench_archive.bin";
+    const std::filesystem::path rawPath = directory / "etl_mathlib_bench_raw.bin";
+
+    ETL::Math::TransformArchiveWriter writer;
+    writer.addMatrices<TestType>("instances", matrices);
+    REQUIRE(writer.write(archivePath) == ETL::Math::ArchiveStatus::Ok);
+
+    /// Reference: the element by element serialization the archive replaces
+    {
+        std::ofstream raw(rawPath, std::ios::binary | std::ios::trunc);
+        for (const Mat4& mat : matrices)
+        {
+            for (int e = 0; e < Mat4::NUM_ELEM; ++e)
+            {
+                const TestType value = mat.getRawValue(e);
+                raw.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+        }
+    }
+
+    std::vector<Mat4> parsed(COUNT);
+
+    BENCHMARK("Element by element parse")
+    {
+        std::ifstream raw(rawPath, std::ios::binary);
+        for (Mat4& mat : parsed)
+        {
+            for (int e = 0; e < Mat4::NUM_ELEM; ++e)
+            {
+                TestType value;
+                raw.read(reinterpret_cast<char*>(&value), sizeof(value));
+                mat.setRawValue(e, value);
+            }
+        }
+        return parsed[COUNT - 1].getRawValue(12);
+    };
+
+    BENCHMARK("Archive open")
+    {
+        ETL::Math::TransformArchive archive;
+        archive.open(archivePath);
+        return archive.getMatrices<TestType>("instances").size();
+    };
+
+    BENCHMARK("Archive open and read all")
+    {
+        ETL::Math::TransformArchive archive;
+        archive.open(archivePath);
+        TestType sum = TestType(0);
+        for (const Mat4& mat : archive.getMatrices<TestType>("instances"))
+            sum += mat.getRawValue(12);
+        return sum;
+    };
+
+    std::filesystem::remove(archivePath);
+    std::filesystem::remove(rawPath);
+}
@@ -0,0 +1,86 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// AnimationCurve.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/FixedPointHelpers.h"
+#include <span>
+#include <vector>
+
+namespace ETL::Math
+{
+    /// Keyframe interpolation modes
+    enum class CurveInterpolation
+    {
+        Step,   /// Hold the previous key
+        Linear, /// Lerp between keys
+        Cubic   /// Hermite with Catmull-Rom tangents (non-uniform key spacing aware)
+    };
+
+
+    /// Playback position cache, one per playing instance. It keeps the segment found by the last
+    /// sample so that monotonically advancing time finds the next segment in O(1) (a short forward
+    /// walk, binary search for long jumps or when time goes backwards).
+    struct CurveCursor
+    {
+        int segment = 0;
+    };
+
+
+    /// Multi-channel keyframed curve: every key stores a value for each of 'channelCount' channels
+    /// and all channels share the key times (e.g. every bone track of a clip). Sampling locates the
+    /// segment once, computes the interpolation weights once, then blends all channels at once
+    /// (SIMD across channels for float/double).
+    /// Values are stored key-major (channels of a key are contiguous). When using
+    /// AnimationCurve<int>, values are raw 16.16 fixed point.
+
+    template<typename Type>
+    class AnimationCurve
+    {
+    public:
+
+        /// Constructors
+        AnimationCurve() = default;
+
+        /// keyTimes must be strictly increasing, keyValues holds keyTimes.size() * channelCount values (key-major)
+        AnimationCurve(std::span<const double> keyTimes, std::span<const Type> keyValues, int channelCount,
+                       CurveInterpolation interpolation = CurveInterpolation::Linear);
+
+        /// Access methods
+        int                getKeyCount() const     { return static_cast<int>(mTimes.size()); }
+        int                getChannelCount() const { return mChannelCount; }
+        CurveInterpolation getInterpolation() const { return mInterpolation; }
+        double             getStartTime() const    { return mTimes.empty() ? 0.0 : mTimes.front(); }
+        double             getEndTime() const      { return mTimes.empty() ? 0.0 : mTimes.back(); }
+
+        /// Segment (index of its first key) containing 'time', clamped to [0, keyCount - 2]
+        int findSegment(double time) const;
+        int findSegment(double time, CurveCursor& cursor) const;
+
+        /// Sample every channel at 'time' (clamped to the key range) into outValues (channelCount values)
+        void sample(std::span<Type> outValues, double time) const;
+        void sample(std::span<Type> outValues, double time, CurveCursor& cursor) const;
+
+        /// Sample several instances: outValues[i * channelCount + c] for times[i], cursors[i]
+        void sample(std::span<Type> outValues, std::span<const double> times, std::span<CurveCursor> cursors) const;
+
+    private:
+        void sampleSegment(Type* outValues, double time, int segment) const;
+
+        std::vector<double>         mTimes;
+        std::vector<Type>           mValues;   /// [key * channelCount + channel]
+        std::vector<CalcType<Type>> mTangents; /// Cubic only, slope per time unit, same layout
+        int                         mChannelCount = 0;
+        CurveInterpolation          mInterpolation = CurveInterpolation::Linear;
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class AnimationCurve<float>;
+    extern template class AnimationCurve<double>;
+    extern template class AnimationCurve<int>;
+
+} /// namespace ETL::Math
@@ -0,0 +1,69 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Interpolation.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Vector2.h"
+#include "MathLib/Types/Vector3.h"
+#include "MathLib/Types/Vector4.h"
+#include <concepts>
+
+namespace ETL::Math
+{
+    /// Interpolation primitives for Vector2/3/4 (any element type, 16.16 fixed point included).
+    /// Every curve is evaluated as a weighted sum of its control values: the weights are computed
+    /// once in double, components are combined in CalcType (fixed point is decoded, summed in
+    /// double and re-encoded, so there is no per-term rounding). All functions are constexpr.
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// Number of components of the interpolable vector types (0 for anything else)
+        template<typename Vec> constexpr int VECTOR_SIZE = 0;
+        template<typename Type> constexpr int VECTOR_SIZE<Vector2<Type>> = 2;
+        template<typename Type> constexpr int VECTOR_SIZE<Vector3<Type>> = 3;
+        template<typename Type> constexpr int VECTOR_SIZE<Vector4<Type>> = 4;
+    }
+
+    /// Vector2, Vector3 or Vector4
+    template<typename Vec>
+    concept InterpolableVector = helpers::VECTOR_SIZE<Vec> > 0;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Scalar easing
+
+    /// Hermite smoothstep: 0 below edge0, 1 above edge1, 3x^2 - 2x^3 in between
+    constexpr double Smoothstep(double edge0, double edge1, double x);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Vector interpolation (t in [0, 1] spans the segment, values outside extrapolate)
+
+    /// a + (b - a) * t
+    template<InterpolableVector Vec>
+    constexpr void Lerp(Vec& outResult, const Vec& a, const Vec& b, double t);
+
+    /// Lerp with a smoothstep-eased t (clamped to [0, 1])
+    template<InterpolableVector Vec>
+    constexpr void Smoothstep(Vec& outResult, const Vec& a, const Vec& b, double t);
+
+    /// Cubic Hermite: positions p0, p1 with tangents m0, m1 (per unit of t)
+    template<InterpolableVector Vec>
+    constexpr void Hermite(Vec& outResult, const Vec& p0, const Vec& m0, const Vec& p1, const Vec& m1, double t);
+
+    /// Uniform Catmull-Rom between p1 and p2 (p0 and p3 shape the tangents)
+    template<InterpolableVector Vec>
+    constexpr void CatmullRom(Vec& outResult, const Vec& p0, const Vec& p1, const Vec& p2, const Vec& p3, double t);
+
+    /// Cubic Bezier: passes through p0 and p3, p1 and p2 are the control points
+    template<InterpolableVector Vec>
+    constexpr void Bezier(Vec& outResult, const Vec& p0, const Vec& p1, const Vec& p2, const Vec& p3, double t);
+
+} /// namespace ETL::Math
+
+#include "inline/Interpolation.inl"
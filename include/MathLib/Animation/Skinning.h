@@ -0,0 +1,124 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Skinning.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/FrameArena.h"
+#include "MathLib/Types/DualQuaternion.h"
+#include "MathLib/Types/Matrix4x4.h"
+#include <cstdint>
+#include <span>
+
+namespace ETL::Math
+{
+    /// Per-vertex bone influences (up to 4). Weights are expected to sum to 1;
+    /// unused influences must have a weight of 0 (their index is still read, keep it valid).
+
+    struct BoneWeights
+    {
+        static constexpr int MAX_INFLUENCES = 4;
+
+        std::uint16_t indices[MAX_INFLUENCES] = {};
+        float         weights[MAX_INFLUENCES] = {};
+    };
+
+
+    /// Vertex streams read by the skinning kernels. Normals and tangents are optional:
+    /// leave the span empty to skip a stream. Every non-empty stream must have the
+    /// same size as 'positions' and 'weights'.
+    template<typename Type>
+    struct SkinningInput
+    {
+        std::span<const Vector3<Type>> positions;
+        std::span<const BoneWeights>   weights;
+        std::span<const Vector3<Type>> normals  = {};
+        std::span<const Vector3<Type>> tangents = {};
+    };
+
+
+    /// Vertex streams written by the skinning kernels (a stream is written only if
+    /// both its input and output spans are non-empty)
+    template<typename Type>
+    struct SkinningOutput
+    {
+        std::span<Vector3<Type>> positions;
+        std::span<Vector3<Type>> normals  = {};
+        std::span<Vector3<Type>> tangents = {};
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Linear blend skinning: v' = sum(w_i * palette[i]) * v
+    /// The 4 bone matrices are blended first (one matrix per vertex, SIMD across columns),
+    /// then positions, normals and tangents share the blended matrix. Normals and tangents
+    /// use its 3x3 part and are re-normalized (palettes are assumed free of non-uniform scale).
+
+    /// Positions only
+    template<typename Type>
+    void SkinVertices(std::span<Vector3<Type>> outPositions, std::span<const Matrix4x4<Type>> palette,
+                      std::span<const Vector3<Type>> positions, std::span<const BoneWeights> weights);
+
+    /// Positions with optional normal/tangent streams. The flattened palette lives in 'scratch' (rewound on return).
+    template<typename Type>
+    void SkinVertices(const SkinningOutput<Type>& out, std::span<const Matrix4x4<Type>> palette, const SkinningInput<Type>& in,
+                      FrameArena& scratch = GetMathScratch());
+
+    /// Multi-threaded version: vertices are split in contiguous ranges (numThreads <= 0 uses all hardware threads)
+    template<typename Type>
+    void SkinVerticesParallel(const SkinningOutput<Type>& out, std::span<const Matrix4x4<Type>> palette, const SkinningInput<Type>& in,
+                              int numThreads = 0, FrameArena& scratch = GetMathScratch());
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Dual quaternion skinning: v' = normalize(sum(w_i * sign_i * palette[i])) * v
+    /// Bones are blended as 8 values (real + dual), each flipped to the hemisphere of the
+    /// first influence so antipodal rotations do not cancel. Rigid bones only (no scale),
+    /// but joints keep their volume where linear blending collapses (candy-wrapper effect).
+    /// Same streams and threading as the linear blend version.
+
+    /// Positions only
+    template<typename Type>
+    void SkinVertices(std::span<Vector3<Type>> outPositions, std::span<const DualQuaternion<Type>> palette,
+                      std::span<const Vector3<Type>> positions, std::span<const BoneWeights> weights);
+
+    /// Positions with optional normal/tangent streams. The flattened palette lives in 'scratch' (rewound on return).
+    template<typename Type>
+    void SkinVertices(const SkinningOutput<Type>& out, std::span<const DualQuaternion<Type>> palette, const SkinningInput<Type>& in,
+                      FrameArena& scratch = GetMathScratch());
+
+    /// Multi-threaded version: vertices are split in contiguous ranges (numThreads <= 0 uses all hardware threads)
+    template<typename Type>
+    void SkinVerticesParallel(const SkinningOutput<Type>& out, std::span<const DualQuaternion<Type>> palette, const SkinningInput<Type>& in,
+                              int numThreads = 0, FrameArena& scratch = GetMathScratch());
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template void SkinVertices(std::span<Vector3<float>>  outPositions, std::span<const Matrix4x4<float>>  palette, std::span<const Vector3<float>>  positions, std::span<const BoneWeights> weights);
+    extern template void SkinVertices(std::span<Vector3<double>> outPositions, std::span<const Matrix4x4<double>> palette, std::span<const Vector3<double>> positions, std::span<const BoneWeights> weights);
+    extern template void SkinVertices(std::span<Vector3<int>>    outPositions, std::span<const Matrix4x4<int>>    palette, std::span<const Vector3<int>>    positions, std::span<const BoneWeights> weights);
+
+    extern template void SkinVertices(const SkinningOutput<float>&  out, std::span<const Matrix4x4<float>>  palette, const SkinningInput<float>&  in, FrameArena& scratch);
+    extern template void SkinVertices(const SkinningOutput<double>& out, std::span<const Matrix4x4<double>> palette, const SkinningInput<double>& in, FrameArena& scratch);
+    extern template void SkinVertices(const SkinningOutput<int>&    out, std::span<const Matrix4x4<int>>    palette, const SkinningInput<int>&    in, FrameArena& scratch);
+
+    extern template void SkinVerticesParallel(const SkinningOutput<float>&  out, std::span<const Matrix4x4<float>>  palette, const SkinningInput<float>&  in, int numThreads, FrameArena& scratch);
+    extern template void SkinVerticesParallel(const SkinningOutput<double>& out, std::span<const Matrix4x4<double>> palette, const SkinningInput<double>& in, int numThreads, FrameArena& scratch);
+    extern template void SkinVerticesParallel(const SkinningOutput<int>&    out, std::span<const Matrix4x4<int>>    palette, const SkinningInput<int>&    in, int numThreads, FrameArena& scratch);
+
+    extern template void SkinVertices(std::span<Vector3<float>>  outPositions, std::span<const DualQuaternion<float>>  palette, std::span<const Vector3<float>>  positions, std::span<const BoneWeights> weights);
+    extern template void SkinVertices(std::span<Vector3<double>> outPositions, std::span<const DualQuaternion<double>> palette, std::span<const Vector3<double>> positions, std::span<const BoneWeights> weights);
+    extern template void SkinVertices(std::span<Vector3<int>>    outPositions, std::span<const DualQuaternion<int>>    palette, std::span<const Vector3<int>>    positions, std::span<const BoneWeights> weights);
+
+    extern template void SkinVertices(const SkinningOutput<float>&  out, std::span<const DualQuaternion<float>>  palette, const SkinningInput<float>&  in, FrameArena& scratch);
+    extern template void SkinVertices(const SkinningOutput<double>& out, std::span<const DualQuaternion<double>> palette, const SkinningInput<double>& in, FrameArena& scratch);
+    extern template void SkinVertices(const SkinningOutput<int>&    out, std::span<const DualQuaternion<int>>    palette, const SkinningInput<int>&    in, FrameArena& scratch);
+
+    extern template void SkinVerticesParallel(const SkinningOutput<float>&  out, std::span<const DualQuaternion<float>>  palette, const SkinningInput<float>&  in, int numThreads, FrameArena& scratch);
+    extern template void SkinVerticesParallel(const SkinningOutput<double>& out, std::span<const DualQuaternion<double>> palette, const SkinningInput<double>& in, int numThreads, FrameArena& scratch);
+    extern template void SkinVerticesParallel(const SkinningOutput<int>&    out, std::span<const DualQuaternion<int>>    palette, const SkinningInput<int>&    in, int numThreads, FrameArena& scratch);
+
+
+} /// namespace ETL::Math
@@ -0,0 +1,129 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Interpolation.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/FixedPointHelpers.h"
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// <summary>
+        /// outResult = sum(weights[k] * points[k]), component-wise in CalcType
+        /// </summary>
+        template<typename Vec, int COUNT>
+        constexpr void WeightedSum(Vec& outResult, const Vec* const (&points)[COUNT], const double (&weights)[COUNT])
+        {
+            using Type = std::remove_cvref_t<decltype(points[0]->getRawValue(0))>;
+            using Calc = CalcType<Type>;
+
+            for (int i = 0; i < VECTOR_SIZE<Vec>; ++i)
+            {
+                Calc sum = Calc(0);
+                for (int k = 0; k < COUNT; ++k)
+                    sum += static_cast<Calc>(weights[k]) * DecodeValue<Calc>(points[k]->getRawValue(i));
+                outResult.setRawValue(i, EncodeValue<Type>(sum));
+            }
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Scalar easing
+
+    /// <summary>
+    /// Hermite smoothstep between edge0 and edge1
+    /// </summary>
+    /// <param name="edge0"></param>
+    /// <param name="edge1"></param>
+    /// <param name="x"></param>
+    /// <returns>0 for x <= edge0, 1 for x >= edge1</returns>
+    constexpr double Smoothstep(double edge0, double edge1, double x)
+    {
+        double t = (x - edge0) / (edge1 - edge0);
+        t = t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+        return t * t * (3.0 - 2.0 * t);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Vector interpolation
+
+    /// <summary>
+    /// Linear interpolation
+    /// </summary>
+    /// <typeparam name="Vec">Vector2, Vector3 or Vector4</typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="a">Value at t = 0</param>
+    /// <param name="b">Value at t = 1</param>
+    /// <param name="t"></param>
+    template<InterpolableVector Vec>
+    constexpr void Lerp(Vec& outResult, const Vec& a, const Vec& b, double t)
+    {
+        helpers::WeightedSum(outResult, { &a, &b }, { 1.0 - t, t });
+    }
+
+
+    /// <summary>
+    /// Smoothstep interpolation (zero velocity at both ends)
+    /// </summary>
+    template<InterpolableVector Vec>
+    constexpr void Smoothstep(Vec& outResult, const Vec& a, const Vec& b, double t)
+    {
+        Lerp(outResult, a, b, Smoothstep(0.0, 1.0, t));
+    }
+
+
+    /// <summary>
+    /// Cubic Hermite interpolation
+    /// </summary>
+    /// <typeparam name="Vec">Vector2, Vector3 or Vector4</typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="p0">Value at t = 0</param>
+    /// <param name="m0">Tangent at t = 0</param>
+    /// <param name="p1">Value at t = 1</param>
+    /// <param name="m1">Tangent at t = 1</param>
+    /// <param name="t"></param>
+    template<InterpolableVector Vec>
+    constexpr void Hermite(Vec& outResult, const Vec& p0, const Vec& m0, const Vec& p1, const Vec& m1, double t)
+    {
+        const double t2 = t * t;
+        const double t3 = t2 * t;
+
+        helpers::WeightedSum(outResult, { &p0, &m0, &p1, &m1 },
+                             { 2.0 * t3 - 3.0 * t2 + 1.0, t3 - 2.0 * t2 + t, 3.0 * t2 - 2.0 * t3, t3 - t2 });
+    }
+
+
+    /// <summary>
+    /// Uniform Catmull-Rom spline segment from p1 (t = 0) to p2 (t = 1)
+    /// </summary>
+    template<InterpolableVector Vec>
+    constexpr void CatmullRom(Vec& outResult, const Vec& p0, const Vec& p1, const Vec& p2, const Vec& p3, double t)
+    {
+        const double t2 = t * t;
+        const double t3 = t2 * t;
+
+        helpers::WeightedSum(outResult, { &p0, &p1, &p2, &p3 },
+                             { 0.5 * (-t3 + 2.0 * t2 - t), 0.5 * (3.0 * t3 - 5.0 * t2 + 2.0),
+                               0.5 * (-3.0 * t3 + 4.0 * t2 + t), 0.5 * (t3 - t2) });
+    }
+
+
+    /// <summary>
+    /// Cubic Bezier curve (Bernstein weights)
+    /// </summary>
+    template<InterpolableVector Vec>
+    constexpr void Bezier(Vec& outResult, const Vec& p0, const Vec& p1, const Vec& p2, const Vec& p3, double t)
+    {
+        const double s = 1.0 - t;
+
+        helpers::WeightedSum(outResult, { &p0, &p1, &p2, &p3 },
+                             { s * s * s, 3.0 * s * s * t, 3.0 * s * t * t, t * t * t });
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,39 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Determinism.h
+///----------------------------------------------------------------------------
+#pragma once
+
+/// Bit-reproducible float/double results (build with -DMATHLIB_DETERMINISTIC=ON).
+///
+/// In a deterministic build Multiply, TransformPoint(s), Normalize and the rotation factories
+/// return the same bits on every IEEE-754 machine, whichever code path computed them:
+///  - MathLib and its users are compiled without FMA contraction (-ffp-contract=off, MSVC /fp:precise)
+///    and, on 32-bit x86, with SSE2 arithmetic instead of x87 extended precision. AVX2 builds also
+///    drop -mfma, GCC's vectorizer fuses add/sub pairs (vfmaddsub) regardless of -ffp-contract.
+///  - Sums are written in one fixed order shared by the scalar and SIMD kernels, and the SIMD
+///    layer never fuses (Simd::MulAdd is a multiply then an add).
+///  - sin/cos come from the in-library FastTrig polynomials (about 1 ulp in double) instead of libm.
+///    sqrt stays std::sqrt: IEEE-754 requires it to be correctly rounded, so it already is portable.
+///  - Batched, SIMD and multi-threaded paths match the scalar functions bit for bit.
+/// Fast-math flags break all of the above and are rejected at compile time.
+
+#if defined(MATHLIB_DETERMINISTIC)
+#if defined(__FAST_MATH__) || defined(_M_FP_FAST)
+#error "MATHLIB_DETERMINISTIC cannot be combined with fast-math (-ffast-math, /fp:fast)"
+#endif
+#endif
+
+namespace ETL::Math
+{
+    /// True when the library was built with MATHLIB_DETERMINISTIC
+    constexpr bool IsDeterministic()
+    {
+#if defined(MATHLIB_DETERMINISTIC)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+} /// namespace ETL::Math
@@ -8,7 +8,9 @@
 
 namespace ETL::Math
 {
-    /// Proxy class for non-const access
+    /// Proxy class for non-const access.
+    /// Header-only and constexpr so it folds away entirely; library kernels never go through it
+    /// (they use the raw accessors), it only serves the public operator()/operator[] API.
     template<typename Type>
     class ElementProxy
     {
@@ -16,26 +18,26 @@ namespace ETL::Math
         Type& element;
 
     public:
-        ElementProxy(Type& elem);
+        constexpr ElementProxy(Type& elem);
 
         // Conversion operator for reading
-        operator Type() const;
+        constexpr operator Type() const;
 
         // Assignment operator for writing
-        ElementProxy& operator=(Type value);
-        ElementProxy& operator=(const ElementProxy& other);
+        constexpr ElementProxy& operator=(Type value);
+        constexpr ElementProxy& operator=(const ElementProxy& other);
 
         // Compound operators if needed
-        ElementProxy& operator+=(Type value);
-        ElementProxy& operator-=(Type value);
-        ElementProxy& operator*=(Type value);
-        ElementProxy& operator/=(Type value);
+        constexpr ElementProxy& operator+=(Type value);
+        constexpr ElementProxy& operator-=(Type value);
+        constexpr ElementProxy& operator*=(Type value);
+        constexpr ElementProxy& operator/=(Type value);
     };
 
 
     /// Constructor
     template<typename Type>
-    inline ElementProxy<Type>::ElementProxy(Type& elem)
+    constexpr ElementProxy<Type>::ElementProxy(Type& elem)
         : element(elem)
     {
     }
@@ -43,14 +45,14 @@ namespace ETL::Math
 
     /// Read conversion
     template<typename Type>
-    inline ElementProxy<Type>::operator Type() const
+    constexpr ElementProxy<Type>::operator Type() const
     {
         return DecodeValue<Type>(element); /// Integers converted from Fixed Point
     }
 
     /// Write assignment
     template<typename Type>
-    inline ElementProxy<Type>& ElementProxy<Type>::operator=(Type value)
+    constexpr ElementProxy<Type>& ElementProxy<Type>::operator=(Type value)
     {
         element = EncodeValue<Type>(value); /// Integers converted to Fixed Point
 
@@ -59,7 +61,7 @@ namespace ETL::Math
 
     /// Copy assignment from another proxy
     template<typename Type>
-    inline ElementProxy<Type>& ElementProxy<Type>::operator=(const ElementProxy& other)
+    constexpr ElementProxy<Type>& ElementProxy<Type>::operator=(const ElementProxy& other)
     {
         element = other.element;
         return *this;
@@ -67,7 +69,7 @@ namespace ETL::Math
 
     /// Addition compound operator
     template<typename Type>
-    inline ElementProxy<Type>& ElementProxy<Type>::operator+=(Type value)
+    constexpr ElementProxy<Type>& ElementProxy<Type>::operator+=(Type value)
     {
         element += EncodeValue<Type>(value); /// Integers converted to Fixed Point
 
@@ -76,7 +78,7 @@ namespace ETL::Math
 
     /// Subtraction compound operator
     template<typename Type>
-    inline ElementProxy<Type>& ElementProxy<Type>::operator-=(Type value)
+    constexpr ElementProxy<Type>& ElementProxy<Type>::operator-=(Type value)
     {
         element -= EncodeValue<Type>(value);  /// Integers converted to Fixed Point
 
@@ -85,7 +87,7 @@ namespace ETL::Math
 
     /// Multiplication compound operator
     template<typename Type>
-    inline ElementProxy<Type>& ElementProxy<Type>::operator*=(Type value)
+    constexpr ElementProxy<Type>& ElementProxy<Type>::operator*=(Type value)
     {
         element *= value;
         return *this;
@@ -93,16 +95,10 @@ namespace ETL::Math
 
     /// Division compound operator
     template<typename Type>
-    inline ElementProxy<Type>& ElementProxy<Type>::operator/=(Type value)
+    constexpr ElementProxy<Type>& ElementProxy<Type>::operator/=(Type value)
     {
         element /= value;
         return *this;
     }
 
-
-    /// Explicit template instantiation (precompiled declaration)
-    extern template class ElementProxy<float>;
-    extern template class ElementProxy<double>;
-    extern template class ElementProxy<int>;
-
 } // namespace ETL::Math
@@ -0,0 +1,209 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// FastTrig.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/Determinism.h"
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace ETL::Math
+{
+    /// Trigonometry used by the rotation factories and setters.
+    /// Precise calls std::sin/std::cos, Fast evaluates the FastTrig polynomials
+    /// (double precision, see FastTrig::MAX_ERROR_DOUBLE).
+    /// MATHLIB_DETERMINISTIC builds use the polynomials for both: libm results vary between platforms.
+    enum class TrigPrecision
+    {
+        Precise,
+        Fast
+    };
+}
+
+namespace ETL::Math::FastTrig
+{
+    /// Minimax polynomial sine/cosine.
+    /// The angle is reduced to [-pi/4, pi/4] with a 3-part Cody-Waite split of pi/2,
+    /// then sin and cos share the reduced argument and are swapped/negated per quadrant.
+    /// Max absolute error against std::sin/std::cos (measured over [-8192, 8192]):
+    ///   float  : MAX_ERROR_FLOAT  (about 1 ulp of 1.0f)
+    ///   double : MAX_ERROR_DOUBLE (about 1 ulp of 1.0)
+    /// Accuracy degrades for |angle| beyond ~1e5 (float) / ~1e9 (double): the reduction
+    /// is exact only while k * pi/2 fits the split constants. No NaN/Inf handling.
+    /// All scalar functions are constexpr; the span overloads run 4/8 lanes at a time
+    /// (same reduction, rounding and polynomials: bit-identical to the scalar version when the
+    /// compiler does not contract to FMA, which MATHLIB_DETERMINISTIC guarantees).
+
+    constexpr double MAX_ERROR_FLOAT = 1.2e-7;
+    constexpr double MAX_ERROR_DOUBLE = 3.0e-16;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// Polynomial coefficients and pi/2 split per precision
+        template<typename Type>
+        struct TrigCoefficients;
+
+        template<>
+        struct TrigCoefficients<float>
+        {
+            static constexpr float TWO_OVER_PI = 0.636619772367581343f;
+            static constexpr float PIO2_1 = 1.5703125f;
+            static constexpr float PIO2_2 = 4.837512969970703125e-4f;
+            static constexpr float PIO2_3 = 7.54978995489188216e-8f;
+
+            static constexpr float SIN[] = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+            static constexpr float COS[] = { 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+        };
+
+        template<>
+        struct TrigCoefficients<double>
+        {
+            static constexpr double TWO_OVER_PI = 0.636619772367581343075535053490057448;
+            static constexpr double PIO2_1 = 1.57079632673412561417e+00;
+            static constexpr double PIO2_2 = 6.07710050630396597660e-11;
+            static constexpr double PIO2_3 = 2.02226624871116645580e-21;
+
+            static constexpr double SIN[] = { -1.66666666666666307295e-1, 8.33333333332211858878e-3, -1.98412698295895385996e-4,
+                                               2.75573136213857245213e-6, -2.50507477628578072866e-8, 1.58962301576546568060e-10 };
+            static constexpr double COS[] = { 4.16666666666665929218e-2, -1.38888888888730564116e-3, 2.48015872888517045348e-5,
+                                              -2.75573141792967388112e-7, 2.08757008419747316778e-9, -1.13585365213876817300e-11 };
+        };
+
+
+        /// Horner evaluation of c[0] + c[1] * z + ... (works for scalars and SIMD packs,
+        /// 'broadcast' turns a coefficient into a Value)
+        template<typename Value, typename Coef, std::size_t N, typename Broadcast>
+        constexpr Value Horner(const Value& z, const Coef (&c)[N], Broadcast broadcast)
+        {
+            Value result = broadcast(c[N - 1]);
+            for (std::size_t i = N - 1; i-- > 0;)
+                result = result * z + broadcast(c[i]);
+            return result;
+        }
+
+
+        /// sin(r) and cos(r) for r in [-pi/4, pi/4]
+        template<typename Coef, typename Value, typename Broadcast>
+        constexpr void SinCosReduced(Value& outSin, Value& outCos, const Value& r, Broadcast broadcast)
+        {
+            using C = TrigCoefficients<Coef>;
+
+            const Value z = r * r;
+            outSin = r + r * z * Horner(z, C::SIN, broadcast);
+            outCos = broadcast(Coef(1)) - broadcast(Coef(0.5)) * z + z * z * Horner(z, C::COS, broadcast);
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Scalar API (constexpr)
+
+    /// <summary>
+    /// Sine and cosine of 'angle' (radians) in one evaluation
+    /// </summary>
+    /// <typeparam name="Type">float or double</typeparam>
+    /// <param name="outSin"></param>
+    /// <param name="outCos"></param>
+    /// <param name="angle"></param>
+    template<std::floating_point Type>
+    constexpr void SinCos(Type& outSin, Type& outCos, Type angle)
+    {
+        using C = helpers::TrigCoefficients<Type>;
+
+        /// Nearest quadrant, ties to even like the SIMD rounding (constexpr friendly, 'frac' is exact)
+        const Type kf = angle * C::TWO_OVER_PI;
+        long long k = static_cast<long long>(kf);
+        const Type frac = kf - static_cast<Type>(k);
+        if (frac > Type(0.5) || (frac == Type(0.5) && (k & 1)))
+            ++k;
+        else if (frac < Type(-0.5) || (frac == Type(-0.5) && (k & 1)))
+            --k;
+        const Type kr = static_cast<Type>(k);
+
+        const Type r = ((angle - kr * C::PIO2_1) - kr * C::PIO2_2) - kr * C::PIO2_3;
+
+        Type s{}, c{};
+        helpers::SinCosReduced<Type>(s, c, r, [](Type value) { return value; });
+
+        switch (k & 3)
+        {
+        case 0: outSin =  s; outCos =  c; break;
+        case 1: outSin =  c; outCos = -s; break;
+        case 2: outSin = -s; outCos = -c; break;
+        default: outSin = -c; outCos =  s; break;
+        }
+    }
+
+
+    /// <summary>
+    /// Sine of 'angle' (radians)
+    /// </summary>
+    template<std::floating_point Type>
+    constexpr Type Sin(Type angle)
+    {
+        Type s{}, c{};
+        SinCos(s, c, angle);
+        return s;
+    }
+
+
+    /// <summary>
+    /// Cosine of 'angle' (radians)
+    /// </summary>
+    template<std::floating_point Type>
+    constexpr Type Cos(Type angle)
+    {
+        Type s{}, c{};
+        SinCos(s, c, angle);
+        return c;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Batch API (SIMD) - all spans must have the same size, outputs may alias 'angles'
+
+    void SinCos(std::span<float>  outSin, std::span<float>  outCos, std::span<const float>  angles);
+    void SinCos(std::span<double> outSin, std::span<double> outCos, std::span<const double> angles);
+
+} /// namespace ETL::Math::FastTrig
+
+
+namespace ETL::Math
+{
+    /// <summary>
+    /// Sine and cosine of 'angle' with the requested precision policy.
+    /// Constant evaluation and MATHLIB_DETERMINISTIC builds always use the FastTrig polynomials
+    /// (std::sin/std::cos are not constexpr, and not bit-identical across libm implementations).
+    /// </summary>
+    /// <param name="outSin"></param>
+    /// <param name="outCos"></param>
+    /// <param name="angle"></param>
+    /// <param name="precision"></param>
+    constexpr void SinCos(double& outSin, double& outCos, double angle, TrigPrecision precision)
+    {
+        if consteval
+        {
+            FastTrig::SinCos(outSin, outCos, angle);
+        }
+        else
+        {
+            if (IsDeterministic() || precision == TrigPrecision::Fast)
+            {
+                FastTrig::SinCos(outSin, outCos, angle);
+            }
+            else
+            {
+                outSin = std::sin(angle);
+                outCos = std::cos(angle);
+            }
+        }
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,136 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// FrameArena.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ETL::Math
+{
+    /// Scratch memory for transient math buffers.
+    ///
+    /// A FrameArena is a bump allocator: allocating moves a pointer forward in a block, freeing
+    /// does nothing, and reset() (typically once per frame) or a Scope (around a job) rewinds it.
+    /// When a block is full the arena chains a bigger one; the next reset() merges them into a
+    /// single block, so after a warm-up frame the steady state does no heap allocation at all.
+    /// It is a std::pmr::memory_resource, so pmr containers (ScratchVector) can live in it.
+    ///
+    /// An arena is not thread-safe: each thread uses its own. GetMathScratch() returns the
+    /// calling thread's arena, which the library uses for its temporaries when none is given.
+
+    class FrameArena : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;
+        static constexpr std::size_t BLOCK_ALIGNMENT = 64; /// Cache line, enough for any SIMD load
+
+        /// Position in the arena, see rewind()
+        struct Marker
+        {
+            std::size_t block = 0;
+            std::size_t offset = 0;
+        };
+
+        /// Rewinds the arena to where it was at construction (scopes nest)
+        class Scope
+        {
+        public:
+            explicit Scope(FrameArena& arena) : mArena(arena), mMarker(arena.getMarker()) {}
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+            ~Scope() { mArena.rewind(mMarker); }
+
+        private:
+            FrameArena& mArena;
+            Marker      mMarker;
+        };
+
+        explicit FrameArena(std::size_t initialCapacity = DEFAULT_CAPACITY);
+        ~FrameArena() override;
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /// Raw storage, 'alignment' must be a power of two (never null, grows instead)
+        void* allocateBytes(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+        /// 'count' default-constructed objects. Their destructors are never run, hence trivially destructible types only.
+        template<typename T>
+        std::span<T> allocate(std::size_t count, std::size_t alignment = alignof(T));
+
+        /// Current position
+        Marker getMarker() const { return { mCurrent, mOffset }; }
+
+        /// Frees everything allocated after 'marker' (which must come from this arena, and not be older than the last reset)
+        void rewind(const Marker& marker);
+
+        /// Frees everything; merges the blocks into one when the arena had to grow
+        void reset();
+
+        /// Bytes in use (including alignment padding)
+        std::size_t getUsedBytes() const { return mBase + mOffset; }
+
+        /// Highest getUsedBytes() since construction
+        std::size_t getPeakBytes() const { return mPeak; }
+
+        /// Total size of the blocks
+        std::size_t getCapacity() const;
+
+        /// Number of heap blocks (1 in steady state)
+        std::size_t getBlockCount() const { return mBlocks.size(); }
+
+    protected:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override { return allocateBytes(bytes, alignment); }
+        void  do_deallocate(void*, std::size_t, std::size_t) override {} /// released by rewind() / reset()
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        struct Block
+        {
+            std::byte*  data = nullptr;
+            std::size_t size = 0;
+        };
+
+        void addBlock(std::size_t size);
+        void releaseBlocks();
+
+        std::vector<Block> mBlocks;
+        std::size_t        mCurrent = 0; /// Block being filled
+        std::size_t        mOffset = 0;  /// Bytes used in it
+        std::size_t        mBase = 0;    /// Size of the blocks before it
+        std::size_t        mPeak = 0;
+    };
+
+
+    /// Vector whose storage comes from an arena: std::vector growth, no heap once the arena is warm
+    template<typename T>
+    using ScratchVector = std::pmr::vector<T>;
+
+    /// Allocator for any other pmr container
+    template<typename T>
+    using ScratchAllocator = std::pmr::polymorphic_allocator<T>;
+
+    /// Scratch arena of the calling thread (created on first use, DEFAULT_CAPACITY bytes).
+    /// Library functions rewind it before returning; reset it once per frame if you allocate from it too.
+    FrameArena& GetMathScratch();
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Template implementation
+
+    template<typename T>
+    std::span<T> FrameArena::allocate(std::size_t count, std::size_t alignment /*= alignof(T)*/)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+
+        T* data = static_cast<T*>(allocateBytes(count * sizeof(T), alignment < alignof(T) ? alignof(T) : alignment));
+        std::uninitialized_default_construct_n(data, count);
+        return { data, count };
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,215 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Instrumentation.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(MATHLIB_INSTRUMENT)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#endif
+
+namespace ETL::Math
+{
+    /// Opt-in call counters for the hot math entry points (build with -DMATHLIB_INSTRUMENT=ON).
+    ///
+    /// Every instrumented function starts with ETLMATH_INSTRUMENT(op) (InstrumentationHook.h, the
+    /// only part the math headers include), which without MATHLIB_INSTRUMENT expands to nothing. With it, each call bumps a counter owned by the
+    /// calling thread (no lock, no atomic read-modify-write), and one call out of
+    /// INSTRUMENT_SAMPLE_PERIOD per thread and op is timed with the cycle counter (rdtsc on x86).
+    /// Counters are split by scope: code tags its work with an InstrumentScope ("Physics",
+    /// "Animation"...) and the calls it makes on that thread are attributed to it.
+    /// TakeInstrumentSnapshot() sums all threads (including finished ones) into a snapshot
+    /// that can be queried or exported as JSON.
+    /// Constant evaluation is never counted.
+
+    /// Instrumented operations
+    enum class InstrumentOp : int
+    {
+        Matrix3x3Multiply,
+        Matrix3x3MultiplyVector,
+        Matrix3x3Inverse,
+        Matrix3x3CreateRotation,
+        Matrix4x4Multiply,
+        Matrix4x4MultiplyVector,
+        Matrix4x4Inverse,
+        Matrix4x4CreateRotation,
+        Matrix4x4InverseProjection,
+        Matrix4x4MultiplyBatch,
+        Matrix4x4InverseBatch,
+        Vector2Normalize,
+        Vector3Normalize,
+        Vector4Normalize,
+        QuaternionMultiply,
+        QuaternionNormalize,
+        QuaternionInverse,
+        Count
+    };
+
+    constexpr int INSTRUMENT_OP_COUNT = static_cast<int>(InstrumentOp::Count);
+    constexpr int INSTRUMENT_MAX_SCOPES = 16;           /// Scope 0 is "Default"
+    constexpr std::uint64_t INSTRUMENT_SAMPLE_PERIOD = 64; /// Power of two
+
+    /// Op name as used in the JSON export
+    std::string_view GetInstrumentOpName(InstrumentOp op);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Scopes
+
+    /// Index of the scope called 'name' (registered on first use). Returns 0 (Default) once
+    /// INSTRUMENT_MAX_SCOPES scopes exist.
+    int RegisterInstrumentScope(std::string_view name);
+
+    /// Attributes the calls made on this thread to 'scope' until destruction (scopes nest)
+    class InstrumentScope
+    {
+    public:
+        explicit InstrumentScope(int scope);
+        explicit InstrumentScope(std::string_view name) : InstrumentScope(RegisterInstrumentScope(name)) {}
+        InstrumentScope(const InstrumentScope&) = delete;
+        InstrumentScope& operator=(const InstrumentScope&) = delete;
+        ~InstrumentScope();
+
+    private:
+        int mPrevious;
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Snapshot & export
+
+    struct InstrumentStats
+    {
+        std::uint64_t calls = 0;
+        std::uint64_t sampledCalls = 0;
+        std::uint64_t sampledCycles = 0;
+
+        /// Mean cycles per call over the sampled calls (0 when none)
+        double getAverageCycles() const { return sampledCalls ? double(sampledCycles) / double(sampledCalls) : 0.0; }
+    };
+
+    struct InstrumentSnapshot
+    {
+        std::vector<std::string>     scopeNames;
+        std::vector<InstrumentStats> stats; /// [scope * INSTRUMENT_OP_COUNT + op]
+
+        const InstrumentStats& get(int scope, InstrumentOp op) const { return stats[scope * INSTRUMENT_OP_COUNT + static_cast<int>(op)]; }
+
+        /// Sum over all scopes
+        InstrumentStats getTotal(InstrumentOp op) const;
+
+        /// {"samplePeriod":64,"scopes":[{"name":"Default","ops":{"Matrix4x4Multiply":{"calls":..,"sampledCalls":..,"averageCycles":..}}}]}
+        /// Ops that were never called are omitted.
+        std::string toJson() const;
+    };
+
+    /// Sum of the counters of every thread (live and finished) since the last reset
+    InstrumentSnapshot TakeInstrumentSnapshot();
+
+    /// Zero all counters (counts made concurrently by other threads during the reset may survive it)
+    void ResetInstrumentCounters();
+
+    /// True when the library was built with MATHLIB_INSTRUMENT
+    constexpr bool IsInstrumentEnabled()
+    {
+#if defined(MATHLIB_INSTRUMENT)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// Single writer (the owning thread), read by snapshots: relaxed load + store, no lock prefix
+        struct InstrumentCounter
+        {
+            std::atomic<std::uint64_t> calls{ 0 };
+            std::atomic<std::uint64_t> sampledCalls{ 0 };
+            std::atomic<std::uint64_t> sampledCycles{ 0 };
+        };
+
+        struct InstrumentThreadData
+        {
+            InstrumentCounter counters[INSTRUMENT_MAX_SCOPES][INSTRUMENT_OP_COUNT];
+            int               scope = 0;
+        };
+
+        /// Calling thread's counters, allocated and registered on first use
+        InstrumentThreadData& AcquireInstrumentThreadData();
+        extern constinit thread_local InstrumentThreadData* tlsInstrumentData;
+
+        inline void Bump(std::atomic<std::uint64_t>& counter, std::uint64_t value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+#if defined(MATHLIB_INSTRUMENT)
+        inline std::uint64_t ReadCycleCounter()
+        {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        /// Counts one call of 'op' for the lifetime of the probe, timing it when sampled
+        class InstrumentProbe
+        {
+        public:
+            constexpr explicit InstrumentProbe(InstrumentOp op)
+            {
+                if !consteval
+                {
+                    InstrumentThreadData* data = tlsInstrumentData ? tlsInstrumentData : &AcquireInstrumentThreadData();
+                    InstrumentCounter& counter = data->counters[data->scope][static_cast<int>(op)];
+                    const std::uint64_t calls = counter.calls.load(std::memory_order_relaxed);
+                    counter.calls.store(calls + 1, std::memory_order_relaxed);
+                    if ((calls & (INSTRUMENT_SAMPLE_PERIOD - 1)) == 0)
+                    {
+                        mSampled = &counter;
+                        mStart = ReadCycleCounter();
+                    }
+                }
+            }
+
+            constexpr ~InstrumentProbe()
+            {
+                if !consteval
+                {
+                    if (mSampled)
+                    {
+                        Bump(mSampled->sampledCycles, ReadCycleCounter() - mStart);
+                        Bump(mSampled->sampledCalls, 1);
+                    }
+                }
+            }
+
+            InstrumentProbe(const InstrumentProbe&) = delete;
+            InstrumentProbe& operator=(const InstrumentProbe&) = delete;
+
+        private:
+            InstrumentCounter* mSampled = nullptr;
+            std::uint64_t      mStart = 0;
+        };
+#endif
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,17 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// InstrumentationHook.h
+///----------------------------------------------------------------------------
+#pragma once
+
+/// ETLMATH_INSTRUMENT(op): instrumentation hook, first statement of an instrumented function body.
+/// This is the only part of Instrumentation.h the math headers need: without MATHLIB_INSTRUMENT it
+/// expands to nothing and this header includes nothing, so normal builds do not pay for the
+/// counter and snapshot API.
+
+#if defined(MATHLIB_INSTRUMENT)
+#include "MathLib/Common/Instrumentation.h"
+#define ETLMATH_INSTRUMENT(op) const ::ETL::Math::helpers::InstrumentProbe etlmathInstrumentProbe{ ::ETL::Math::InstrumentOp::op }
+#else
+#define ETLMATH_INSTRUMENT(op) ((void)0)
+#endif
@@ -56,13 +56,13 @@ namespace ETL::Math
         }
 
         template<typename T>
-        inline bool zeroElement(T value, double epsilon)
+        constexpr bool zeroElement(T value, double epsilon)
         {
             return abs<T>(value) < EncodeValue<T>(epsilon);
         }
 
         template<typename Cont, typename T, int SIZE>
-        inline bool zeroContainer(const Cont& container, double epsilon)
+        constexpr bool zeroContainer(const Cont& container, double epsilon)
         {
             bool bIsZero = true;
             for (int i = 0; i < SIZE; ++i)
@@ -81,6 +81,9 @@ namespace ETL::Math
     template<typename T> class Vector4;
     template<typename T> class Matrix3x3;
     template<typename T> class Matrix4x4;
+    template<typename T> class Quaternion;
+    template<typename T, int Size> class VectorN;
+    template<typename T, int Rows, int Cols> class MatrixN;
 
 
     ///------------------------------------------------------------------------------------------
@@ -88,20 +91,20 @@ namespace ETL::Math
 
     /// Element comparison
     template<typename T>
-    inline bool isZeroRaw(T value, T epsilon = static_cast<T>(Epsilon<T>::value))
+    constexpr bool isZeroRaw(T value, T epsilon = static_cast<T>(Epsilon<T>::value))
     {
         return helpers::abs<T>(value) < epsilon;
     }
 
 
     template<typename T>
-    inline bool isZero(T value, double epsilon = Epsilon<T>::value)
+    constexpr bool isZero(T value, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroElement<T>(value, epsilon);
     }
 
     template<typename T>
-    inline bool isEqual(T a, T b, double epsilon = Epsilon<T>::value)
+    constexpr bool isEqual(T a, T b, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroElement<T>(a - b, epsilon);
     }
@@ -109,13 +112,13 @@ namespace ETL::Math
     /// Vector2 Comparisons
 
     template<typename T>
-    inline bool isZero(const Vector2<T>& vec, double epsilon = Epsilon<T>::value)
+    constexpr bool isZero(const Vector2<T>& vec, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Vector2<T>, T, 2>(vec, epsilon);
     }
 
     template<typename T>
-    inline bool isEqual(const Vector2<T>& a, const Vector2<T>& b, double epsilon = Epsilon<T>::value)
+    constexpr bool isEqual(const Vector2<T>& a, const Vector2<T>& b, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Vector2<T>, T, 2>(a - b, epsilon);
     }
@@ -123,13 +126,13 @@ namespace ETL::Math
     /// Vector3 Comparisons
 
     template<typename T>
-    inline bool isZero(const Vector3<T>& vec, double epsilon = Epsilon<T>::value)
+    constexpr bool isZero(const Vector3<T>& vec, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Vector3<T>, T, 3>(vec, epsilon);
     }
 
     template<typename T>
-    inline bool isEqual(const Vector3<T>& a, const Vector3<T>& b, double epsilon = Epsilon<T>::value)
+    constexpr bool isEqual(const Vector3<T>& a, const Vector3<T>& b, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Vector3<T>, T, 3>(a - b, epsilon);
     }
@@ -137,13 +140,13 @@ namespace ETL::Math
     /// Vector4 Comparisons
 
     template<typename T>
-    inline bool isZero(const Vector4<T>& vec, double epsilon = Epsilon<T>::value)
+    constexpr bool isZero(const Vector4<T>& vec, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Vector4<T>, T, 4>(vec, epsilon);
     }
 
     template<typename T>
-    inline bool isEqual(const Vector4<T>& a, const Vector4<T>& b, double epsilon = Epsilon<T>::value)
+    constexpr bool isEqual(const Vector4<T>& a, const Vector4<T>& b, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Vector4<T>, T, 4>(a - b, epsilon);
     }
@@ -151,13 +154,13 @@ namespace ETL::Math
     /// Matrix3x3 Comparisons
 
     template<typename T>
-    inline bool isZero(const Matrix3x3<T>& vec, double epsilon = Epsilon<T>::value)
+    constexpr bool isZero(const Matrix3x3<T>& vec, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Matrix3x3<T>, T, 9>(vec, epsilon);
     }
 
     template<typename T>
-    inline bool isEqual(const Matrix3x3<T>& a, const Matrix3x3<T>& b, double epsilon = Epsilon<T>::value)
+    constexpr bool isEqual(const Matrix3x3<T>& a, const Matrix3x3<T>& b, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Matrix3x3<T>, T, 9>(a - b, epsilon);
     }
@@ -165,17 +168,59 @@ namespace ETL::Math
     /// Matrix4x4 Comparisons
 
     template<typename T>
-    inline bool isZero(const Matrix4x4<T>& vec, double epsilon = Epsilon<T>::value)
+    constexpr bool isZero(const Matrix4x4<T>& vec, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Matrix4x4<T>, T, 16>(vec, epsilon);
     }
 
     template<typename T>
-    inline bool isEqual(const Matrix4x4<T>& a, const Matrix4x4<T>& b, double epsilon = Epsilon<T>::value)
+    constexpr bool isEqual(const Matrix4x4<T>& a, const Matrix4x4<T>& b, double epsilon = Epsilon<T>::value)
     {
         return helpers::zeroContainer<Matrix4x4<T>, T, 16>(a - b, epsilon);
     }
 
+    /// VectorN Comparisons
+
+    template<typename T, int Size>
+    constexpr bool isZero(const VectorN<T, Size>& vec, double epsilon = Epsilon<T>::value)
+    {
+        return helpers::zeroContainer<VectorN<T, Size>, T, Size>(vec, epsilon);
+    }
+
+    template<typename T, int Size>
+    constexpr bool isEqual(const VectorN<T, Size>& a, const VectorN<T, Size>& b, double epsilon = Epsilon<T>::value)
+    {
+        return helpers::zeroContainer<VectorN<T, Size>, T, Size>(a - b, epsilon);
+    }
+
+    /// MatrixN Comparisons
+
+    template<typename T, int Rows, int Cols>
+    constexpr bool isZero(const MatrixN<T, Rows, Cols>& mat, double epsilon = Epsilon<T>::value)
+    {
+        return helpers::zeroContainer<MatrixN<T, Rows, Cols>, T, Rows * Cols>(mat, epsilon);
+    }
+
+    template<typename T, int Rows, int Cols>
+    constexpr bool isEqual(const MatrixN<T, Rows, Cols>& a, const MatrixN<T, Rows, Cols>& b, double epsilon = Epsilon<T>::value)
+    {
+        return helpers::zeroContainer<MatrixN<T, Rows, Cols>, T, Rows * Cols>(a - b, epsilon);
+    }
+
+    /// Quaternion Comparisons (component-wise: q and -q are NOT considered equal)
+
+    template<typename T>
+    inline bool isZero(const Quaternion<T>& quat, double epsilon = Epsilon<T>::value)
+    {
+        return helpers::zeroContainer<Quaternion<T>, T, 4>(quat, epsilon);
+    }
+
+    template<typename T>
+    inline bool isEqual(const Quaternion<T>& a, const Quaternion<T>& b, double epsilon = Epsilon<T>::value)
+    {
+        return helpers::zeroContainer<Quaternion<T>, T, 4>(a - b, epsilon);
+    }
+
 
     ///------------------------------------------------------------------------------------------
     /// Explicit template instantiations (precompiled declaration)
@@ -225,4 +270,13 @@ namespace ETL::Math
     extern template bool isEqual(const Matrix4x4<float>&, const Matrix4x4<float>&, double);
     extern template bool isEqual(const Matrix4x4<double>&, const Matrix4x4<double>&, double);
 
+    /// Quaternion
+    extern template bool isZero(const Quaternion<int>&,    double);
+    extern template bool isZero(const Quaternion<float>&,  double);
+    extern template bool isZero(const Quaternion<double>&, double);
+
+    extern template bool isEqual(const Quaternion<int>&,    const Quaternion<int>&,    double);
+    extern template bool isEqual(const Quaternion<float>&,  const Quaternion<float>&,  double);
+    extern template bool isEqual(const Quaternion<double>&, const Quaternion<double>&, double);
+
 } /// namespace ETL::Math
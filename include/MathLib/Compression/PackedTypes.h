@@ -0,0 +1,238 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// PackedTypes.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/Quaternion.h"
+#include "MathLib/Types/Vector3.h"
+#include <cstdint>
+#include <span>
+
+namespace ETL::Math
+{
+    /// Compact storage formats for replication and animation clips. Every format has a scalar
+    /// Encode/Decode pair and a batched span version (SIMD across elements, identical results).
+    /// Error bounds below are worst cases against the source value, measured over several
+    /// million random inputs for float (double and 16.16 fixed point sources are encoded
+    /// from their double value and behave the same, fixed point adds its own 2^-16 truncation).
+
+
+    /// 3 IEEE 754 half floats (6 bytes instead of 12).
+    /// Round to nearest even. Relative error <= 2^-11 (4.9e-4) for |v| in [6.1e-5, 65504],
+    /// absolute error <= 2^-25 (3e-8) below (subnormals). Larger magnitudes saturate to +-65504.
+    struct PackedVector3Half
+    {
+        std::uint16_t x = 0;
+        std::uint16_t y = 0;
+        std::uint16_t z = 0;
+    };
+
+
+    /// Unit vector, octahedral mapping with 2 snorm16 coordinates (4 bytes instead of 12).
+    /// Any non-zero input length is accepted (the projection divides by the L1 norm), the decoded
+    /// vector is unit length.
+    /// Angular error <= 6.5e-5 rad (0.004 degree).
+    struct PackedUnitVectorOct
+    {
+        std::int16_t x = 0;
+        std::int16_t y = 0;
+    };
+
+
+    /// Rotation quaternion, "smallest three" in 48 bits (6 bytes instead of 16):
+    /// bits 0-44 hold the three smallest components on 15 bits each, quantized over
+    /// [-1/sqrt(2), 1/sqrt(2)], bits 45-46 hold the index of the dropped largest component
+    /// (rebuilt from the unit length constraint), bit 47 is unused.
+    /// The input is normalized first. The decoded quaternion may be the negated input (same rotation).
+    /// Error <= 2.2e-5 on the three stored components, 6e-5 on the rebuilt one,
+    /// rotation angle error <= 1.4e-4 rad (0.008 degree).
+    struct PackedQuatSmallest3
+    {
+        std::uint16_t bits[3] = {};
+    };
+
+
+    /// Position quantized on 16 bits per axis inside a QuantizationRange (6 bytes instead of 12).
+    /// Error per axis <= (max - min) / 131070 (plus the rounding of the decoded type),
+    /// positions outside the range are clamped to it.
+    struct PackedPosition16
+    {
+        std::uint16_t x = 0;
+        std::uint16_t y = 0;
+        std::uint16_t z = 0;
+    };
+
+
+    /// Axis-aligned box covered by PackedPosition16 (typically the bounds of a clip or a level)
+    template<typename Type>
+    struct QuantizationRange
+    {
+        Vector3<Type> min;
+        Vector3<Type> max;
+    };
+
+
+    /// Affine transform as translation (PackedPosition16), rotation (PackedQuatSmallest3) and
+    /// scale (PackedVector3Half), 18 bytes instead of 64. Shear is dropped.
+    /// For a transform without shear, decoded upper 3x3 elements are within
+    /// 5e-4 * max(|scale|) of the source, the translation column within the position bound.
+    struct PackedTransform
+    {
+        PackedPosition16    translation;
+        PackedQuatSmallest3 rotation;
+        PackedVector3Half   scale;
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Half float vector
+
+    template<typename Type>
+    void Encode(PackedVector3Half& outPacked, const Vector3<Type>& vec);
+    template<typename Type>
+    void Decode(Vector3<Type>& outVec, const PackedVector3Half& packed);
+
+    /// Batched versions, spans must have the same size
+    template<typename Type>
+    void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<Type>> vecs);
+    template<typename Type>
+    void Decode(std::span<Vector3<Type>> outVecs, std::span<const PackedVector3Half> packed);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Octahedral unit vector
+
+    template<typename Type>
+    void Encode(PackedUnitVectorOct& outPacked, const Vector3<Type>& normal);
+    template<typename Type>
+    void Decode(Vector3<Type>& outNormal, const PackedUnitVectorOct& packed);
+
+    template<typename Type>
+    void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<Type>> normals);
+    template<typename Type>
+    void Decode(std::span<Vector3<Type>> outNormals, std::span<const PackedUnitVectorOct> packed);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Smallest three quaternion
+
+    template<typename Type>
+    void Encode(PackedQuatSmallest3& outPacked, const Quaternion<Type>& rotation);
+    template<typename Type>
+    void Decode(Quaternion<Type>& outRotation, const PackedQuatSmallest3& packed);
+
+    template<typename Type>
+    void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<Type>> rotations);
+    template<typename Type>
+    void Decode(std::span<Quaternion<Type>> outRotations, std::span<const PackedQuatSmallest3> packed);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Range quantized position
+
+    /// Bounds of 'positions' (empty span gives an empty range at the origin)
+    template<typename Type>
+    QuantizationRange<Type> ComputeQuantizationRange(std::span<const Vector3<Type>> positions);
+
+    template<typename Type>
+    void Encode(PackedPosition16& outPacked, const Vector3<Type>& position, const QuantizationRange<Type>& range);
+    template<typename Type>
+    void Decode(Vector3<Type>& outPosition, const PackedPosition16& packed, const QuantizationRange<Type>& range);
+
+    template<typename Type>
+    void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<Type>> positions, const QuantizationRange<Type>& range);
+    template<typename Type>
+    void Decode(std::span<Vector3<Type>> outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<Type>& range);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Transform (translation range applies to the translation column)
+
+    /// Returns false for a singular matrix: rotation and scale are then a best-effort fit (the columns
+    /// projected on an orthonormal frame built from them), exact for a rank-deficient matrix without shear
+    template<typename Type>
+    bool Encode(PackedTransform& outPacked, const Matrix4x4<Type>& mat, const QuantizationRange<Type>& translationRange);
+    template<typename Type>
+    void Decode(Matrix4x4<Type>& outMat, const PackedTransform& packed, const QuantizationRange<Type>& translationRange);
+
+    /// Returns true if no matrix was singular
+    template<typename Type>
+    bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<Type>> mats, const QuantizationRange<Type>& translationRange);
+    template<typename Type>
+    void Decode(std::span<Matrix4x4<Type>> outMats, std::span<const PackedTransform> packed, const QuantizationRange<Type>& translationRange);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template void Encode(PackedVector3Half& outPacked, const Vector3<float>&  vec);
+    extern template void Encode(PackedVector3Half& outPacked, const Vector3<double>& vec);
+    extern template void Encode(PackedVector3Half& outPacked, const Vector3<int>&    vec);
+    extern template void Decode(Vector3<float>&  outVec, const PackedVector3Half& packed);
+    extern template void Decode(Vector3<double>& outVec, const PackedVector3Half& packed);
+    extern template void Decode(Vector3<int>&    outVec, const PackedVector3Half& packed);
+    extern template void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<float>>  vecs);
+    extern template void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<double>> vecs);
+    extern template void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<int>>    vecs);
+    extern template void Decode(std::span<Vector3<float>>  outVecs, std::span<const PackedVector3Half> packed);
+    extern template void Decode(std::span<Vector3<double>> outVecs, std::span<const PackedVector3Half> packed);
+    extern template void Decode(std::span<Vector3<int>>    outVecs, std::span<const PackedVector3Half> packed);
+
+    extern template void Encode(PackedUnitVectorOct& outPacked, const Vector3<float>&  normal);
+    extern template void Encode(PackedUnitVectorOct& outPacked, const Vector3<double>& normal);
+    extern template void Encode(PackedUnitVectorOct& outPacked, const Vector3<int>&    normal);
+    extern template void Decode(Vector3<float>&  outNormal, const PackedUnitVectorOct& packed);
+    extern template void Decode(Vector3<double>& outNormal, const PackedUnitVectorOct& packed);
+    extern template void Decode(Vector3<int>&    outNormal, const PackedUnitVectorOct& packed);
+    extern template void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<float>>  normals);
+    extern template void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<double>> normals);
+    extern template void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<int>>    normals);
+    extern template void Decode(std::span<Vector3<float>>  outNormals, std::span<const PackedUnitVectorOct> packed);
+    extern template void Decode(std::span<Vector3<double>> outNormals, std::span<const PackedUnitVectorOct> packed);
+    extern template void Decode(std::span<Vector3<int>>    outNormals, std::span<const PackedUnitVectorOct> packed);
+
+    extern template void Encode(PackedQuatSmallest3& outPacked, const Quaternion<float>&  rotation);
+    extern template void Encode(PackedQuatSmallest3& outPacked, const Quaternion<double>& rotation);
+    extern template void Encode(PackedQuatSmallest3& outPacked, const Quaternion<int>&    rotation);
+    extern template void Decode(Quaternion<float>&  outRotation, const PackedQuatSmallest3& packed);
+    extern template void Decode(Quaternion<double>& outRotation, const PackedQuatSmallest3& packed);
+    extern template void Decode(Quaternion<int>&    outRotation, const PackedQuatSmallest3& packed);
+    extern template void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<float>>  rotations);
+    extern template void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<double>> rotations);
+    extern template void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<int>>    rotations);
+    extern template void Decode(std::span<Quaternion<float>>  outRotations, std::span<const PackedQuatSmallest3> packed);
+    extern template void Decode(std::span<Quaternion<double>> outRotations, std::span<const PackedQuatSmallest3> packed);
+    extern template void Decode(std::span<Quaternion<int>>    outRotations, std::span<const PackedQuatSmallest3> packed);
+
+    extern template QuantizationRange<float>  ComputeQuantizationRange(std::span<const Vector3<float>>  positions);
+    extern template QuantizationRange<double> ComputeQuantizationRange(std::span<const Vector3<double>> positions);
+    extern template QuantizationRange<int>    ComputeQuantizationRange(std::span<const Vector3<int>>    positions);
+    extern template void Encode(PackedPosition16& outPacked, const Vector3<float>&  position, const QuantizationRange<float>&  range);
+    extern template void Encode(PackedPosition16& outPacked, const Vector3<double>& position, const QuantizationRange<double>& range);
+    extern template void Encode(PackedPosition16& outPacked, const Vector3<int>&    position, const QuantizationRange<int>&    range);
+    extern template void Decode(Vector3<float>&  outPosition, const PackedPosition16& packed, const QuantizationRange<float>&  range);
+    extern template void Decode(Vector3<double>& outPosition, const PackedPosition16& packed, const QuantizationRange<double>& range);
+    extern template void Decode(Vector3<int>&    outPosition, const PackedPosition16& packed, const QuantizationRange<int>&    range);
+    extern template void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<float>>  positions, const QuantizationRange<float>&  range);
+    extern template void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<double>> positions, const QuantizationRange<double>& range);
+    extern template void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<int>>    positions, const QuantizationRange<int>&    range);
+    extern template void Decode(std::span<Vector3<float>>  outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<float>&  range);
+    extern template void Decode(std::span<Vector3<double>> outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<double>& range);
+    extern template void Decode(std::span<Vector3<int>>    outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<int>&    range);
+
+    extern template bool Encode(PackedTransform& outPacked, const Matrix4x4<float>&  mat, const QuantizationRange<float>&  translationRange);
+    extern template bool Encode(PackedTransform& outPacked, const Matrix4x4<double>& mat, const QuantizationRange<double>& translationRange);
+    extern template bool Encode(PackedTransform& outPacked, const Matrix4x4<int>&    mat, const QuantizationRange<int>&    translationRange);
+    extern template void Decode(Matrix4x4<float>&  outMat, const PackedTransform& packed, const QuantizationRange<float>&  translationRange);
+    extern template void Decode(Matrix4x4<double>& outMat, const PackedTransform& packed, const QuantizationRange<double>& translationRange);
+    extern template void Decode(Matrix4x4<int>&    outMat, const PackedTransform& packed, const QuantizationRange<int>&    translationRange);
+    extern template bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<float>>  mats, const QuantizationRange<float>&  translationRange);
+    extern template bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<double>> mats, const QuantizationRange<double>& translationRange);
+    extern template bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<int>>    mats, const QuantizationRange<int>&    translationRange);
+    extern template void Decode(std::span<Matrix4x4<float>>  outMats, std::span<const PackedTransform> packed, const QuantizationRange<float>&  translationRange);
+    extern template void Decode(std::span<Matrix4x4<double>> outMats, std::span<const PackedTransform> packed, const QuantizationRange<double>& translationRange);
+    extern template void Decode(std::span<Matrix4x4<int>>    outMats, std::span<const PackedTransform> packed, const QuantizationRange<int>&    translationRange);
+
+} /// namespace ETL::Math
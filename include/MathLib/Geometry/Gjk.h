@@ -0,0 +1,194 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Gjk.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/FixedPointHelpers.h"
+#include "MathLib/Common/TypeComparisons.h"
+#include "MathLib/Geometry/Primitives.h"
+#include <concepts>
+#include <span>
+
+namespace ETL::Math
+{
+    /// GJK distance / intersection and EPA penetration depth between convex shapes.
+    ///
+    /// A shape is given by its support mapping: one of Sphere, Capsule, Obb, a convex hull (a
+    /// std::span of its points), or any callable support(outPoint, direction) writing the point
+    /// of the shape furthest along 'direction'. Directions are Vector3<CalcType<Type>> (double
+    /// for fixed point) and are not normalized. Spheres and capsules run as their center / segment
+    /// and get their radius added at the end, so they converge like polytopes.
+    /// Everything is computed in CalcType: fixed point shapes run in double on their exact
+    /// decoded coordinates. Only + - * / and sqrt are used, so with MATHLIB_DETERMINISTIC the
+    /// results are bit-reproducible across machines.
+    ///
+    /// Warm start: every query takes the GjkCache of the shape pair, which remembers the
+    /// directions that produced the final simplex. The next query starts from the supports in
+    /// those directions instead of a single arbitrary point, so pairs that moved little since
+    /// the last query converge in one or two iterations. A default cache is a cold start.
+
+
+    /// Per-pair warm start data: keep one per shape pair, from one query (frame) to the next
+    template<typename Type>
+    struct GjkCache
+    {
+        Vector3<CalcType<Type>> directions[4]{};
+        int                     count = 0;
+    };
+
+
+    /// Result of GjkDistance / EpaPenetration
+    template<typename Type>
+    struct GjkResult
+    {
+        Vector3<Type> pointA{};        /// Separated: closest points. Penetrating: deepest points.
+        Vector3<Type> pointB{};        /// Intersecting, GJK only: both are a point common to A and B.
+        Vector3<Type> normal{};        /// Unit, from A towards B (separating direction, or direction to push B out of A)
+        double        distance = 0.0;  /// Separation, 0 when intersecting
+        double        depth = 0.0;     /// Penetration depth (EpaPenetration), 0 otherwise
+        int           iterations = 0;  /// GJK + EPA iterations
+        bool          intersecting = false;
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Support mappings of the primitives (the point furthest along 'direction')
+
+    template<typename Type>
+    void Support(Vector3<Type>& outResult, const Sphere<Type>& sphere, const Vector3<CalcType<Type>>& direction);
+
+    template<typename Type>
+    void Support(Vector3<Type>& outResult, const Capsule<Type>& capsule, const Vector3<CalcType<Type>>& direction);
+
+    template<typename Type>
+    void Support(Vector3<Type>& outResult, const Obb<Type>& box, const Vector3<CalcType<Type>>& direction);
+
+    /// Convex hull given by its points (any point set: the hull is implied), first point on ties
+    template<typename Type>
+    void Support(Vector3<Type>& outResult, std::span<const Vector3<Type>> points, const Vector3<CalcType<Type>>& direction);
+
+
+    /// A primitive with a Support overload, or a support callable
+    template<typename Shape, typename Type>
+    concept GjkShape = std::invocable<const Shape&, Vector3<Type>&, const Vector3<CalcType<Type>>&>
+                    || requires(Vector3<Type>& out, const Shape& shape, const Vector3<CalcType<Type>>& direction) { Support(out, shape, direction); };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Queries (touching counts as intersecting)
+
+    /// Boolean test: stops at the first separating direction
+    template<typename Type, GjkShape<Type> ShapeA, GjkShape<Type> ShapeB>
+    bool GjkIntersect(const ShapeA& a, const ShapeB& b, GjkCache<Type>& cache);
+
+    /// Distance and closest points. Returns true when the shapes are separated.
+    template<typename Type, GjkShape<Type> ShapeA, GjkShape<Type> ShapeB>
+    bool GjkDistance(GjkResult<Type>& outResult, const ShapeA& a, const ShapeB& b, GjkCache<Type>& cache);
+
+    /// GJK, then EPA from the enclosing simplex when the shapes intersect.
+    /// Returns true when they penetrate (depth, normal and deepest points), otherwise outResult is as GjkDistance.
+    template<typename Type, GjkShape<Type> ShapeA, GjkShape<Type> ShapeB>
+    bool EpaPenetration(GjkResult<Type>& outResult, const ShapeA& a, const ShapeB& b, GjkCache<Type>& cache);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper (the parts that do not depend on the shapes, precompiled for float / double)
+
+    namespace helpers
+    {
+        /// Point of the Minkowski difference A - B with the support points and direction that produced it
+        template<typename Calc>
+        struct GjkVertex
+        {
+            Calc w[3];
+            Calc a[3];
+            Calc b[3];
+            Calc direction[3];
+        };
+
+        template<typename Calc>
+        struct GjkSimplex
+        {
+            GjkVertex<Calc> vertices[4];
+            Calc            weights[4];  /// Barycentric coordinates of the closest point
+            int             count = 0;
+        };
+
+        /// Reduce the simplex to the smallest sub-simplex holding its point closest to the origin,
+        /// write that point and its weights. Returns true when a tetrahedron encloses the origin.
+        template<typename Calc>
+        bool SolveSimplex(GjkSimplex<Calc>& simplex, Calc (&outClosest)[3]);
+
+
+        /// Convex polytope grown by EPA, fixed capacity (no allocation): removed faces free their slot for new ones
+        template<typename Calc>
+        class EpaPolytope
+        {
+        public:
+            static constexpr int MAX_VERTICES = 68;
+            static constexpr int MAX_FACES = 2 * MAX_VERTICES;
+
+            struct Face
+            {
+                int  vertices[3];
+                Calc normal[3];   /// Unit, outward
+                Calc distance;    /// From the origin to the face plane
+                bool live;
+            };
+
+            /// Tetrahedron around the origin, false when it is flat
+            bool init(const GjkSimplex<Calc>& tetrahedron);
+
+            /// Closest live face to the origin (-1 when none)
+            int         getClosestFace() const;
+            const Face& getFace(int face) const { return mFaces[face]; }
+
+            /// Add a vertex beyond 'face': faces it sees are replaced by a cone to their horizon.
+            /// False (polytope unchanged) when out of capacity.
+            bool expand(const GjkVertex<Calc>& vertex, int face);
+
+            /// Points of A and B whose difference is the projection of the origin on 'face' (a face of this polytope, live or not)
+            void getContact(Calc (&outA)[3], Calc (&outB)[3], const Face& face) const;
+
+        private:
+            void addFace(int v0, int v1, int v2);
+
+            GjkVertex<Calc> mVertices[MAX_VERTICES];
+            Face            mFaces[MAX_FACES];
+            int             mFreeFaces[MAX_FACES];
+            int             mVertexCount = 0;
+            int             mFaceCount = 0;
+            int             mFreeCount = 0;
+        };
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template void Support(Vector3<float>&  outResult, const Sphere<float>&  sphere, const Vector3<float>&  direction);
+    extern template void Support(Vector3<double>& outResult, const Sphere<double>& sphere, const Vector3<double>& direction);
+    extern template void Support(Vector3<int>&    outResult, const Sphere<int>&    sphere, const Vector3<double>& direction);
+
+    extern template void Support(Vector3<float>&  outResult, const Capsule<float>&  capsule, const Vector3<float>&  direction);
+    extern template void Support(Vector3<double>& outResult, const Capsule<double>& capsule, const Vector3<double>& direction);
+    extern template void Support(Vector3<int>&    outResult, const Capsule<int>&    capsule, const Vector3<double>& direction);
+
+    extern template void Support(Vector3<float>&  outResult, const Obb<float>&  box, const Vector3<float>&  direction);
+    extern template void Support(Vector3<double>& outResult, const Obb<double>& box, const Vector3<double>& direction);
+    extern template void Support(Vector3<int>&    outResult, const Obb<int>&    box, const Vector3<double>& direction);
+
+    extern template void Support(Vector3<float>&  outResult, std::span<const Vector3<float>>  points, const Vector3<float>&  direction);
+    extern template void Support(Vector3<double>& outResult, std::span<const Vector3<double>> points, const Vector3<double>& direction);
+    extern template void Support(Vector3<int>&    outResult, std::span<const Vector3<int>>    points, const Vector3<double>& direction);
+
+    extern template bool helpers::SolveSimplex(helpers::GjkSimplex<float>&  simplex, float  (&outClosest)[3]);
+    extern template bool helpers::SolveSimplex(helpers::GjkSimplex<double>& simplex, double (&outClosest)[3]);
+
+    extern template class helpers::EpaPolytope<float>;
+    extern template class helpers::EpaPolytope<double>;
+
+} /// namespace ETL::Math
+
+#include "inline/Gjk.inl"
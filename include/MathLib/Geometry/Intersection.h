@@ -0,0 +1,80 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Intersection.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Geometry/Ray.h"
+
+namespace ETL::Math
+{
+    /// Ray queries. Single-ray tests are evaluated in double precision whatever the storage
+    /// type (fixed point included); packet tests run Width rays at once in SIMD registers
+    /// and return a bit mask of the lanes that hit (bit i set -> ray i hit).
+    /// Hits are only reported for 0 <= t <= tMax, and hit records are only written for
+    /// the lanes that hit, so packets can be swept over many primitives keeping the closest.
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Single ray
+
+    /// Ray-triangle (Möller–Trumbore, two-sided)
+    template<typename Type>
+    bool IntersectRayTriangle(double& outT, const Ray<Type>& ray,
+                              const Vector3<Type>& v0, const Vector3<Type>& v1, const Vector3<Type>& v2,
+                              double tMax = std::numeric_limits<double>::infinity());
+
+    /// Ray-triangle (Möller–Trumbore, two-sided) with barycentric coordinates of the hit (P = (1-u-v)*v0 + u*v1 + v*v2)
+    template<typename Type>
+    bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<Type>& ray,
+                              const Vector3<Type>& v0, const Vector3<Type>& v1, const Vector3<Type>& v2,
+                              double tMax = std::numeric_limits<double>::infinity());
+
+    /// Ray-AABB (slab test). outTNear is 0 when the origin is inside the box
+    template<typename Type>
+    bool IntersectRayAabb(double& outTNear, const Ray<Type>& ray,
+                          const Vector3<Type>& boxMin, const Vector3<Type>& boxMax,
+                          double tMax = std::numeric_limits<double>::infinity());
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Ray packets
+
+    /// Ray-triangle (Möller–Trumbore, two-sided) for every lane of the packet
+    template<typename Type, int Width>
+    int IntersectRayTriangle(RayPacketHit<Type, Width>& outHit, const RayPacket<Type, Width>& rays,
+                             const Vector3<Type>& v0, const Vector3<Type>& v1, const Vector3<Type>& v2);
+
+    /// Ray-AABB (slab test) for every lane of the packet
+    template<typename Type, int Width>
+    int IntersectRayAabb(Type (&outTNear)[Width], const RayPacket<Type, Width>& rays,
+                         const Vector3<Type>& boxMin, const Vector3<Type>& boxMax);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template bool IntersectRayTriangle(double& outT, const Ray<float>&  ray, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2, double tMax);
+    extern template bool IntersectRayTriangle(double& outT, const Ray<double>& ray, const Vector3<double>& v0, const Vector3<double>& v1, const Vector3<double>& v2, double tMax);
+    extern template bool IntersectRayTriangle(double& outT, const Ray<int>&    ray, const Vector3<int>&    v0, const Vector3<int>&    v1, const Vector3<int>&    v2, double tMax);
+
+    extern template bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<float>&  ray, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2, double tMax);
+    extern template bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<double>& ray, const Vector3<double>& v0, const Vector3<double>& v1, const Vector3<double>& v2, double tMax);
+    extern template bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<int>&    ray, const Vector3<int>&    v0, const Vector3<int>&    v1, const Vector3<int>&    v2, double tMax);
+
+    extern template bool IntersectRayAabb(double& outTNear, const Ray<float>&  ray, const Vector3<float>&  boxMin, const Vector3<float>&  boxMax, double tMax);
+    extern template bool IntersectRayAabb(double& outTNear, const Ray<double>& ray, const Vector3<double>& boxMin, const Vector3<double>& boxMax, double tMax);
+    extern template bool IntersectRayAabb(double& outTNear, const Ray<int>&    ray, const Vector3<int>&    boxMin, const Vector3<int>&    boxMax, double tMax);
+
+    extern template int IntersectRayTriangle(RayPacketHit<float, 4>&  outHit, const RayPacket<float, 4>&  rays, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2);
+    extern template int IntersectRayTriangle(RayPacketHit<float, 8>&  outHit, const RayPacket<float, 8>&  rays, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2);
+    extern template int IntersectRayTriangle(RayPacketHit<double, 4>& outHit, const RayPacket<double, 4>& rays, const Vector3<double>& v0, const Vector3<double>& v1, const Vector3<double>& v2);
+
+    extern template int IntersectRayAabb(float  (&outTNear)[4], const RayPacket<float, 4>&  rays, const Vector3<float>&  boxMin, const Vector3<float>&  boxMax);
+    extern template int IntersectRayAabb(float  (&outTNear)[8], const RayPacket<float, 8>&  rays, const Vector3<float>&  boxMin, const Vector3<float>&  boxMax);
+    extern template int IntersectRayAabb(double (&outTNear)[4], const RayPacket<double, 4>& rays, const Vector3<double>& boxMin, const Vector3<double>& boxMax);
+
+
+} /// namespace ETL::Math
+
+#include "inline/Intersection.inl"
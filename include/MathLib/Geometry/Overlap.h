@@ -0,0 +1,134 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Overlap.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Geometry/Primitives.h"
+#include <cstddef>
+#include <span>
+
+namespace ETL::Math
+{
+    /// Closest point and overlap queries between the convex primitives (solid volumes,
+    /// touching counts as overlapping). Single queries are evaluated in double precision
+    /// whatever the storage type (fixed point included); batched queries test pair i of two
+    /// SoA views (a[i] against b[i]) with one pair per SIMD lane, in the lane precision.
+    /// Every overlap test is a single kernel shared by both paths.
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Closest points
+
+    /// Point of the segment [start, end] closest to 'point'
+    template<typename Type>
+    void ClosestPointOnSegment(Vector3<Type>& outResult, const Vector3<Type>& start, const Vector3<Type>& end, const Vector3<Type>& point);
+
+    /// Closest pair of points between the segments [start1, end1] and [start2, end2]
+    /// (a consistent pair is returned for parallel segments)
+    template<typename Type>
+    void ClosestPointsSegmentSegment(Vector3<Type>& outOnFirst, Vector3<Type>& outOnSecond,
+                                     const Vector3<Type>& start1, const Vector3<Type>& end1,
+                                     const Vector3<Type>& start2, const Vector3<Type>& end2);
+
+    /// Point of the volume closest to 'point' ('point' itself when inside)
+    template<typename Type>
+    void ClosestPoint(Vector3<Type>& outResult, const Sphere<Type>& sphere, const Vector3<Type>& point);
+
+    template<typename Type>
+    void ClosestPoint(Vector3<Type>& outResult, const Capsule<Type>& capsule, const Vector3<Type>& point);
+
+    template<typename Type>
+    void ClosestPoint(Vector3<Type>& outResult, const Obb<Type>& box, const Vector3<Type>& point);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Overlap tests
+
+    template<typename Type>
+    bool OverlapSphereSphere(const Sphere<Type>& a, const Sphere<Type>& b);
+
+    template<typename Type>
+    bool OverlapSphereCapsule(const Sphere<Type>& sphere, const Capsule<Type>& capsule);
+
+    template<typename Type>
+    bool OverlapCapsuleCapsule(const Capsule<Type>& a, const Capsule<Type>& b);
+
+    /// Separating axis test (15 axes), parallel edge pairs are handled with an epsilon bias
+    template<typename Type>
+    bool OverlapObbObb(const Obb<Type>& a, const Obb<Type>& b);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Batched overlap tests (SIMD across pairs)
+    /// outOverlap[i] = overlap(a[i], b[i]); views must have the same size.
+    /// Returns the number of overlapping pairs.
+
+    template<typename Type>
+    std::size_t OverlapSphereSphere(std::span<bool> outOverlap, const SphereSoA<Type>& a, const SphereSoA<Type>& b);
+
+    template<typename Type>
+    std::size_t OverlapSphereCapsule(std::span<bool> outOverlap, const SphereSoA<Type>& spheres, const CapsuleSoA<Type>& capsules);
+
+    template<typename Type>
+    std::size_t OverlapCapsuleCapsule(std::span<bool> outOverlap, const CapsuleSoA<Type>& a, const CapsuleSoA<Type>& b);
+
+    template<typename Type>
+    std::size_t OverlapObbObb(std::span<bool> outOverlap, const ObbSoA<Type>& a, const ObbSoA<Type>& b);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template void ClosestPointOnSegment(Vector3<float>&  outResult, const Vector3<float>&  start, const Vector3<float>&  end, const Vector3<float>&  point);
+    extern template void ClosestPointOnSegment(Vector3<double>& outResult, const Vector3<double>& start, const Vector3<double>& end, const Vector3<double>& point);
+    extern template void ClosestPointOnSegment(Vector3<int>&    outResult, const Vector3<int>&    start, const Vector3<int>&    end, const Vector3<int>&    point);
+
+    extern template void ClosestPointsSegmentSegment(Vector3<float>&  outOnFirst, Vector3<float>&  outOnSecond, const Vector3<float>&  start1, const Vector3<float>&  end1, const Vector3<float>&  start2, const Vector3<float>&  end2);
+    extern template void ClosestPointsSegmentSegment(Vector3<double>& outOnFirst, Vector3<double>& outOnSecond, const Vector3<double>& start1, const Vector3<double>& end1, const Vector3<double>& start2, const Vector3<double>& end2);
+    extern template void ClosestPointsSegmentSegment(Vector3<int>&    outOnFirst, Vector3<int>&    outOnSecond, const Vector3<int>&    start1, const Vector3<int>&    end1, const Vector3<int>&    start2, const Vector3<int>&    end2);
+
+    extern template void ClosestPoint(Vector3<float>&  outResult, const Sphere<float>&  sphere, const Vector3<float>&  point);
+    extern template void ClosestPoint(Vector3<double>& outResult, const Sphere<double>& sphere, const Vector3<double>& point);
+    extern template void ClosestPoint(Vector3<int>&    outResult, const Sphere<int>&    sphere, const Vector3<int>&    point);
+
+    extern template void ClosestPoint(Vector3<float>&  outResult, const Capsule<float>&  capsule, const Vector3<float>&  point);
+    extern template void ClosestPoint(Vector3<double>& outResult, const Capsule<double>& capsule, const Vector3<double>& point);
+    extern template void ClosestPoint(Vector3<int>&    outResult, const Capsule<int>&    capsule, const Vector3<int>&    point);
+
+    extern template void ClosestPoint(Vector3<float>&  outResult, const Obb<float>&  box, const Vector3<float>&  point);
+    extern template void ClosestPoint(Vector3<double>& outResult, const Obb<double>& box, const Vector3<double>& point);
+    extern template void ClosestPoint(Vector3<int>&    outResult, const Obb<int>&    box, const Vector3<int>&    point);
+
+    extern template bool OverlapSphereSphere(const Sphere<float>&  a, const Sphere<float>&  b);
+    extern template bool OverlapSphereSphere(const Sphere<double>& a, const Sphere<double>& b);
+    extern template bool OverlapSphereSphere(const Sphere<int>&    a, const Sphere<int>&    b);
+
+    extern template bool OverlapSphereCapsule(const Sphere<float>&  sphere, const Capsule<float>&  capsule);
+    extern template bool OverlapSphereCapsule(const Sphere<double>& sphere, const Capsule<double>& capsule);
+    extern template bool OverlapSphereCapsule(const Sphere<int>&    sphere, const Capsule<int>&    capsule);
+
+    extern template bool OverlapCapsuleCapsule(const Capsule<float>&  a, const Capsule<float>&  b);
+    extern template bool OverlapCapsuleCapsule(const Capsule<double>& a, const Capsule<double>& b);
+    extern template bool OverlapCapsuleCapsule(const Capsule<int>&    a, const Capsule<int>&    b);
+
+    extern template bool OverlapObbObb(const Obb<float>&  a, const Obb<float>&  b);
+    extern template bool OverlapObbObb(const Obb<double>& a, const Obb<double>& b);
+    extern template bool OverlapObbObb(const Obb<int>&    a, const Obb<int>&    b);
+
+    extern template std::size_t OverlapSphereSphere(std::span<bool> outOverlap, const SphereSoA<float>&  a, const SphereSoA<float>&  b);
+    extern template std::size_t OverlapSphereSphere(std::span<bool> outOverlap, const SphereSoA<double>& a, const SphereSoA<double>& b);
+
+    extern template std::size_t OverlapSphereCapsule(std::span<bool> outOverlap, const SphereSoA<float>&  spheres, const CapsuleSoA<float>&  capsules);
+    extern template std::size_t OverlapSphereCapsule(std::span<bool> outOverlap, const SphereSoA<double>& spheres, const CapsuleSoA<double>& capsules);
+
+    extern template std::size_t OverlapCapsuleCapsule(std::span<bool> outOverlap, const CapsuleSoA<float>&  a, const CapsuleSoA<float>&  b);
+    extern template std::size_t OverlapCapsuleCapsule(std::span<bool> outOverlap, const CapsuleSoA<double>& a, const CapsuleSoA<double>& b);
+
+    extern template std::size_t OverlapObbObb(std::span<bool> outOverlap, const ObbSoA<float>&  a, const ObbSoA<float>&  b);
+    extern template std::size_t OverlapObbObb(std::span<bool> outOverlap, const ObbSoA<double>& a, const ObbSoA<double>& b);
+
+
+} /// namespace ETL::Math
+
+#include "inline/Overlap.inl"
@@ -0,0 +1,214 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Primitives.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Vector3.h"
+#include "MathLib/Types/Matrix3x3.h"
+#include <concepts>
+#include <span>
+
+namespace ETL::Math
+{
+    /// Convex volumes for the overlap and closest point queries (see Overlap.h).
+    /// Radii are given and returned as plain values (encoded to fixed point for int, like
+    /// vector components), so Sphere<int>{ center, 0.5 } is a half unit sphere.
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Sphere
+
+    template<typename Type>
+    class Sphere
+    {
+    public:
+
+        /// Constructors
+        constexpr Sphere() = default;
+        constexpr Sphere(const Vector3<Type>& center, double radius);
+
+        /// Copy, Move & Destructor (default)
+        Sphere(const Sphere&) = default;
+        Sphere(Sphere&&) noexcept = default;
+        Sphere& operator=(const Sphere&) = default;
+        Sphere& operator=(Sphere&&) noexcept = default;
+        ~Sphere() = default;
+
+        /// Access methods
+        const Vector3<Type>& getCenter() const;
+        double               getRadius() const;
+
+        void setCenter(const Vector3<Type>& center);
+        void setRadius(double radius);
+
+        bool operator==(const Sphere& other) const;
+        bool operator!=(const Sphere& other) const;
+
+        /// Direct access to internal storage - no conversions applied (use with caution for integral types)
+        Type getRawRadius() const;
+
+    private:
+        Vector3<Type> mCenter{};
+        Type          mRadius{};
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Capsule: every point within 'radius' of the segment [start, end]
+
+    template<typename Type>
+    class Capsule
+    {
+    public:
+
+        /// Constructors
+        constexpr Capsule() = default;
+        constexpr Capsule(const Vector3<Type>& start, const Vector3<Type>& end, double radius);
+
+        /// Copy, Move & Destructor (default)
+        Capsule(const Capsule&) = default;
+        Capsule(Capsule&&) noexcept = default;
+        Capsule& operator=(const Capsule&) = default;
+        Capsule& operator=(Capsule&&) noexcept = default;
+        ~Capsule() = default;
+
+        /// Access methods
+        const Vector3<Type>& getStart() const;
+        const Vector3<Type>& getEnd() const;
+        double               getRadius() const;
+
+        void setStart(const Vector3<Type>& start);
+        void setEnd(const Vector3<Type>& end);
+        void setRadius(double radius);
+
+        bool operator==(const Capsule& other) const;
+        bool operator!=(const Capsule& other) const;
+
+        /// Direct access to internal storage - no conversions applied (use with caution for integral types)
+        Type getRawRadius() const;
+
+    private:
+        Vector3<Type> mStart{};
+        Vector3<Type> mEnd{};
+        Type          mRadius{};
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Oriented box: center + rotation (columns are the box axes in world space, orthonormal)
+    /// + half extents along those axes
+
+    template<typename Type>
+    class Obb
+    {
+    public:
+
+        /// Constructors
+        constexpr Obb() = default;
+        constexpr Obb(const Vector3<Type>& center, const Matrix3x3<Type>& rotation, const Vector3<Type>& halfExtents);
+
+        /// Copy, Move & Destructor (default)
+        Obb(const Obb&) = default;
+        Obb(Obb&&) noexcept = default;
+        Obb& operator=(const Obb&) = default;
+        Obb& operator=(Obb&&) noexcept = default;
+        ~Obb() = default;
+
+        /// Access methods
+        const Vector3<Type>&   getCenter() const;
+        const Matrix3x3<Type>& getRotation() const;
+        const Vector3<Type>&   getHalfExtents() const;
+        Vector3<Type>          getAxis(int index) const;
+
+        void setCenter(const Vector3<Type>& center);
+        void setRotation(const Matrix3x3<Type>& rotation);
+        void setHalfExtents(const Vector3<Type>& halfExtents);
+
+        bool operator==(const Obb& other) const;
+        bool operator!=(const Obb& other) const;
+
+    private:
+        Vector3<Type>   mCenter{};
+        Matrix3x3<Type> mRotation{ Matrix3x3<Type>::Identity() };
+        Vector3<Type>   mHalfExtents{};
+    };
+
+
+    /// Helpful aliases
+    using Sphere3 = Sphere<float>;
+    using Sphere3d = Sphere<double>;
+    using Sphere3i = Sphere<int>;
+
+    using Capsule3 = Capsule<float>;
+    using Capsule3d = Capsule<double>;
+    using Capsule3i = Capsule<int>;
+
+    using Obb3 = Obb<float>;
+    using Obb3d = Obb<double>;
+    using Obb3i = Obb<int>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// SoA views (batched queries)
+
+    /// Component-wise views over caller-owned arrays, element i of every span describing shape i,
+    /// so the batched kernels load one component of WIDTH shapes per SIMD register.
+    /// All spans of a view must have the same size. Only float/double lanes are supported.
+
+    template<typename Type>
+    struct SphereSoA
+    {
+        static_assert(std::floating_point<Type>, "SoA lanes must be float or double");
+
+        std::span<const Type> center[3];
+        std::span<const Type> radius;
+
+        std::size_t size() const { return radius.size(); }
+    };
+
+    template<typename Type>
+    struct CapsuleSoA
+    {
+        static_assert(std::floating_point<Type>, "SoA lanes must be float or double");
+
+        std::span<const Type> start[3];
+        std::span<const Type> end[3];
+        std::span<const Type> radius;
+
+        std::size_t size() const { return radius.size(); }
+    };
+
+    /// axes[i][c]: component c of box axis i (column i of the rotation)
+    template<typename Type>
+    struct ObbSoA
+    {
+        static_assert(std::floating_point<Type>, "SoA lanes must be float or double");
+
+        std::span<const Type> center[3];
+        std::span<const Type> axes[3][3];
+        std::span<const Type> halfExtents[3];
+
+        std::size_t size() const { return center[0].size(); }
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class Sphere<float>;
+    extern template class Sphere<double>;
+    extern template class Sphere<int>;
+
+    extern template class Capsule<float>;
+    extern template class Capsule<double>;
+    extern template class Capsule<int>;
+
+    extern template class Obb<float>;
+    extern template class Obb<double>;
+    extern template class Obb<int>;
+
+
+} /// namespace ETL::Math
+
+#include "inline/Primitives.inl"
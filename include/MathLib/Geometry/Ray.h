@@ -0,0 +1,127 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Ray.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Vector3.h"
+#include <limits>
+
+namespace ETL::Math
+{
+    /// Half-line defined by an origin and a direction: P(t) = origin + t * direction, t >= 0.
+    /// The direction is not required to be normalized; hit distances returned by the
+    /// intersection tests are expressed in units of the direction length.
+
+    template<typename Type>
+    class Ray
+    {
+    public:
+
+        /// Constructors
+        constexpr Ray() = default;
+        constexpr Ray(const Vector3<Type>& origin, const Vector3<Type>& direction);
+
+        /// Copy, Move & Destructor (default)
+        Ray(const Ray&) = default;
+        Ray(Ray&&) noexcept = default;
+        Ray& operator=(const Ray&) = default;
+        Ray& operator=(Ray&&) noexcept = default;
+        ~Ray() = default;
+
+        /// Access methods
+        const Vector3<Type>& getOrigin() const;
+        const Vector3<Type>& getDirection() const;
+
+        void setOrigin(const Vector3<Type>& origin);
+        void setDirection(const Vector3<Type>& direction);
+
+        /// Ray methods
+        Vector3<Type> getPoint(double t) const;
+        void          getPointTo(Vector3<Type>& outResult, double t) const;
+
+        bool operator==(const Ray& other) const;
+        bool operator!=(const Ray& other) const;
+
+    private:
+        Vector3<Type> mOrigin{};
+        Vector3<Type> mDirection{};
+    };
+
+
+    /// Helpful aliases
+    using Ray3 = Ray<float>;
+    using Ray3d = Ray<double>;
+    using Ray3i = Ray<int>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Ray packets (SoA layout for the SIMD intersection kernels)
+
+    /// 'Width' rays stored component-wise so a single SIMD register holds one component
+    /// of every ray. The reciprocal direction is cached by setRay() for the slab test.
+    /// Only float/double lanes are supported (4 x float on SSE, 8 x float / 4 x double on AVX).
+
+    template<typename Type, int Width>
+    struct RayPacket
+    {
+        static_assert(std::floating_point<Type>, "RayPacket lanes must be float or double");
+
+        alignas(sizeof(Type) * Width) Type originX[Width];
+        alignas(sizeof(Type) * Width) Type originY[Width];
+        alignas(sizeof(Type) * Width) Type originZ[Width];
+        alignas(sizeof(Type) * Width) Type dirX[Width];
+        alignas(sizeof(Type) * Width) Type dirY[Width];
+        alignas(sizeof(Type) * Width) Type dirZ[Width];
+        alignas(sizeof(Type) * Width) Type invDirX[Width];
+        alignas(sizeof(Type) * Width) Type invDirY[Width];
+        alignas(sizeof(Type) * Width) Type invDirZ[Width];
+        alignas(sizeof(Type) * Width) Type tMax[Width];
+
+        template<typename RayType>
+        void setRay(int lane, const Ray<RayType>& ray, double maxDistance = std::numeric_limits<double>::infinity());
+
+        template<typename RayType>
+        void getRay(int lane, Ray<RayType>& outRay) const;
+    };
+
+
+    /// Per-lane hit record of the packet intersection tests (t and barycentric u, v)
+    template<typename Type, int Width>
+    struct RayPacketHit
+    {
+        alignas(sizeof(Type) * Width) Type t[Width];
+        alignas(sizeof(Type) * Width) Type u[Width];
+        alignas(sizeof(Type) * Width) Type v[Width];
+    };
+
+
+    /// Helpful aliases
+    using RayPacket4 = RayPacket<float, 4>;
+    using RayPacket8 = RayPacket<float, 8>;
+    using RayPacket4d = RayPacket<double, 4>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers (also present as class member functions.
+
+    /// Point along the ray at distance t
+    template<typename Type>
+    void GetPoint(Vector3<Type>& outResult, const Ray<Type>& ray, double t);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class Ray<float>;
+    extern template class Ray<double>;
+    extern template class Ray<int>;
+
+    extern template void GetPoint(Vector3<float>&  outResult, const Ray<float>&  ray, double t);
+    extern template void GetPoint(Vector3<double>& outResult, const Ray<double>& ray, double t);
+    extern template void GetPoint(Vector3<int>&    outResult, const Ray<int>&    ray, double t);
+
+
+} /// namespace ETL::Math
+
+#include "inline/Ray.inl"
@@ -0,0 +1,121 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// SpatialHashGrid.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/FrameArena.h"
+#include "MathLib/Common/FixedPointHelpers.h"
+#include "MathLib/Types/Vector3.h"
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ETL::Math
+{
+    /// Fixed-radius neighbor search over a point set (crowds, particles).
+    ///
+    /// Space is divided in cubic cells of 'cellSize'; cells are hashed into a power of two table
+    /// (twice the point count by default) and the points are counting-sorted by bucket into one
+    /// compact array: the points of bucket b are getSortedIndices()[start(b) .. start(b + 1)),
+    /// in increasing index order. Positions are copied in that order so that a query reads
+    /// memory linearly. Building is multi-threaded and gives the same result for any thread count.
+    ///
+    /// Queries write point indices into a caller span and return the filled part: they never
+    /// allocate. A cell size close to the usual query radius keeps radius queries at 27 cells.
+    /// For mostly-static sets, update() re-sorts only the points it is told have moved.
+    /// When using SpatialHashGrid<int>, cells are computed on the raw 16.16 values with integer
+    /// division, so the grid is bit-exact across platforms; distances are compared in double.
+
+    template<typename Type>
+    class SpatialHashGrid
+    {
+    public:
+        using Calc = CalcType<Type>;
+
+        /// update() rebuilds from scratch when more than 1 / REBUILD_FRACTION of the points changed
+        static constexpr std::size_t REBUILD_FRACTION = 8;
+
+        /// Constructors
+        SpatialHashGrid() = default;
+
+        /// tableSize is rounded up to a power of two, 0 sizes the table from the point count on every build
+        explicit SpatialHashGrid(double cellSize, std::size_t tableSize = 0);
+
+        /// Access methods
+        double      getCellSize() const  { return mCellSize; }
+        std::size_t getTableSize() const { return mCellStart.empty() ? 0 : mCellStart.size() - 1; }
+        std::size_t size() const         { return mSortedIndices.size(); }
+        bool        empty() const        { return mSortedIndices.empty(); }
+
+        /// Empties the grid: build() again with the new size
+        void setCellSize(double cellSize);
+
+        /// Point indices sorted by bucket (the compact cell array)
+        std::span<const std::uint32_t> getSortedIndices() const { return mSortedIndices; }
+
+        /// Points of the bucket holding the cell of 'position' (may include points of other cells sharing the bucket)
+        std::span<const std::uint32_t> getBucket(const Vector3<Type>& position) const;
+
+        /// Grid methods
+        /// Sort 'positions' into the grid (numThreads <= 0 uses all hardware threads)
+        void build(std::span<const Vector3<Type>> positions, int numThreads = 0);
+
+        /// Refresh after the points listed in 'changed' moved to 'positions', same point count. An index listed
+        /// more than once counts once.
+        /// Returns false when it rebuilt from scratch instead (more than 1 / REBUILD_FRACTION of the points changed).
+        bool update(std::span<const Vector3<Type>> positions, std::span<const std::uint32_t> changed, int numThreads = 0,
+                    FrameArena& scratch = GetMathScratch());
+
+        void clear();
+
+        /// Queries (against the positions of the last build / update)
+        /// Points with distance <= radius, in grid order. Stops when outIndices is full.
+        std::span<std::uint32_t> queryRadius(std::span<std::uint32_t> outIndices, const Vector3<Type>& center, double radius) const;
+
+        /// The outIndices.size() points closest to 'center' within maxRadius, closest first (ties by index).
+        /// outDistancesSquared receives their squared distances (same size as outIndices).
+        std::span<std::uint32_t> queryNearest(std::span<std::uint32_t> outIndices, std::span<Calc> outDistancesSquared,
+                                              const Vector3<Type>& center, double maxRadius) const;
+
+        std::span<std::uint32_t> queryNearest(std::span<std::uint32_t> outIndices, const Vector3<Type>& center, double maxRadius,
+                                              FrameArena& scratch = GetMathScratch()) const;
+
+    private:
+        /// Cell coordinates are floor(position / cellSize), in 64 bits so that no input can overflow them
+        using Coordinate = std::conditional_t<std::integral<Type>, std::int64_t, Type>;
+
+        std::int64_t  cellCoordinate(Coordinate value) const;
+        std::uint32_t bucketOf(std::int64_t x, std::int64_t y, std::int64_t z) const;
+        std::uint32_t bucketOf(const Vector3<Type>& position) const;
+        bool          isInCell(const Vector3<Type>& position, std::int64_t x, std::int64_t y, std::int64_t z) const;
+        void          cellRange(std::int64_t (&outLow)[3], std::int64_t (&outHigh)[3], const Vector3<Type>& center, double radius) const;
+        Calc          distanceSquared(const Vector3<Type>& a, const Vector3<Type>& b) const;
+
+        std::vector<std::uint32_t> mCellStart;     /// tableSize + 1 offsets into mSortedIndices
+        std::vector<std::uint32_t> mSortedIndices;
+        std::vector<std::uint32_t> mPointBuckets;  /// Bucket of each point, by index
+        std::vector<Vector3<Type>> mSortedPositions;
+        double                     mCellSize = 1.0;
+        Calc                       mInvCellSize = Calc(1);   /// Floating point cells
+        std::int64_t               mRawCellSize = FIXED_ONE; /// Fixed point cells (raw units)
+        std::size_t                mFixedTableSize = 0;
+        int                        mTableShift = 32;         /// 32 - log2(tableSize)
+    };
+
+
+    /// Helpful aliases
+    using SpatialHashGrid3 = SpatialHashGrid<float>;
+    using SpatialHashGrid3d = SpatialHashGrid<double>;
+    using SpatialHashGrid3i = SpatialHashGrid<int>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class SpatialHashGrid<float>;
+    extern template class SpatialHashGrid<double>;
+    extern template class SpatialHashGrid<int>;
+
+} /// namespace ETL::Math
@@ -0,0 +1,708 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Gjk.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Asserts.h"
+#include <cmath>
+#include <limits>
+
+namespace ETL::Math
+{
+
+    ///------------------------------------------------------------------------------------------
+    /// Support mappings
+
+    namespace helpers
+    {
+        /// <summary>
+        /// Point of the sphere (center, radius) furthest along 'direction' (+X for a zero direction)
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <param name="outResult"></param>
+        /// <param name="center"></param>
+        /// <param name="radius"></param>
+        /// <param name="direction"></param>
+        template<typename Type>
+        inline void SupportSphere(Vector3<Type>& outResult, const Vector3<Type>& center, double radius, const Vector3<CalcType<Type>>& direction)
+        {
+            using Calc = CalcType<Type>;
+
+            Calc lengthSq = Calc(0);
+            for (int i = 0; i < 3; ++i)
+                lengthSq += direction.getRawValue(i) * direction.getRawValue(i);
+
+            if (lengthSq <= Calc(0))
+            {
+                outResult = center;
+                outResult.setRawValue(0, EncodeValue<Type>(DecodeValue<Calc>(center.getRawValue(0)) + Calc(radius)));
+                return;
+            }
+
+            const Calc scale = Calc(radius) / std::sqrt(lengthSq);
+            for (int i = 0; i < 3; ++i)
+                outResult.setRawValue(i, EncodeValue<Type>(DecodeValue<Calc>(center.getRawValue(i)) + direction.getRawValue(i) * scale));
+        }
+
+
+        /// <summary>
+        /// End of the capsule segment furthest along 'direction' (start on ties)
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <param name="capsule"></param>
+        /// <param name="direction"></param>
+        /// <returns></returns>
+        template<typename Type>
+        inline const Vector3<Type>& SupportSegment(const Capsule<Type>& capsule, const Vector3<CalcType<Type>>& direction)
+        {
+            using Calc = CalcType<Type>;
+
+            Calc along = Calc(0);
+            for (int i = 0; i < 3; ++i)
+                along += (DecodeValue<Calc>(capsule.getEnd().getRawValue(i)) - DecodeValue<Calc>(capsule.getStart().getRawValue(i))) * direction.getRawValue(i);
+
+            return along > Calc(0) ? capsule.getEnd() : capsule.getStart();
+        }
+    }
+
+
+    /// <summary>
+    /// Point of the sphere furthest along 'direction'
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="sphere"></param>
+    /// <param name="direction"></param>
+    template<typename Type>
+    inline void Support(Vector3<Type>& outResult, const Sphere<Type>& sphere, const Vector3<CalcType<Type>>& direction)
+    {
+        helpers::SupportSphere(outResult, sphere.getCenter(), sphere.getRadius(), direction);
+    }
+
+
+    /// <summary>
+    /// Point of the capsule furthest along 'direction': the sphere support around the furthest segment end
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="capsule"></param>
+    /// <param name="direction"></param>
+    template<typename Type>
+    inline void Support(Vector3<Type>& outResult, const Capsule<Type>& capsule, const Vector3<CalcType<Type>>& direction)
+    {
+        helpers::SupportSphere(outResult, helpers::SupportSegment(capsule, direction), capsule.getRadius(), direction);
+    }
+
+
+    /// <summary>
+    /// Point of the box furthest along 'direction': the corner on the direction side of every axis
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="box"></param>
+    /// <param name="direction"></param>
+    template<typename Type>
+    inline void Support(Vector3<Type>& outResult, const Obb<Type>& box, const Vector3<CalcType<Type>>& direction)
+    {
+        using Calc = CalcType<Type>;
+
+        Calc result[3];
+        for (int i = 0; i < 3; ++i)
+            result[i] = DecodeValue<Calc>(box.getCenter().getRawValue(i));
+
+        for (int k = 0; k < 3; ++k)
+        {
+            const Vector3<Type> axis = box.getAxis(k);
+
+            Calc a[3];
+            Calc along = Calc(0);
+            for (int i = 0; i < 3; ++i)
+            {
+                a[i] = DecodeValue<Calc>(axis.getRawValue(i));
+                along += a[i] * direction.getRawValue(i);
+            }
+
+            const Calc extent = DecodeValue<Calc>(box.getHalfExtents().getRawValue(k));
+            const Calc offset = along >= Calc(0) ? extent : -extent;
+            for (int i = 0; i < 3; ++i)
+                result[i] += a[i] * offset;
+        }
+
+        for (int i = 0; i < 3; ++i)
+            outResult.setRawValue(i, EncodeValue<Type>(result[i]));
+    }
+
+
+    /// <summary>
+    /// Point of the set furthest along 'direction' (first one on ties)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="points">Not empty</param>
+    /// <param name="direction"></param>
+    template<typename Type>
+    inline void Support(Vector3<Type>& outResult, std::span<const Vector3<Type>> points, const Vector3<CalcType<Type>>& direction)
+    {
+        using Calc = CalcType<Type>;
+        ETLMATH_ASSERT(!points.empty(), "Support of an empty convex hull");
+
+        std::size_t best = 0;
+        Calc bestAlong = -std::numeric_limits<Calc>::max();
+        for (std::size_t p = 0; p < points.size(); ++p)
+        {
+            Calc along = Calc(0);
+            for (int i = 0; i < 3; ++i)
+                along += DecodeValue<Calc>(points[p].getRawValue(i)) * direction.getRawValue(i);
+
+            if (along > bestAlong)
+            {
+                bestAlong = along;
+                best = p;
+            }
+        }
+
+        outResult = points[best];
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// GJK / EPA
+
+    namespace helpers
+    {
+        /// GJK stops when the distance improves by less than this (relative to the squared distance);
+        /// it is also the touching distance and the size under which simplex vertices are merged
+        template<typename Type>
+        constexpr double GJK_TOLERANCE = Epsilon<Type>::value;
+
+        /// EPA stops when the support gains less than this relative to the depth
+        template<typename Type>
+        constexpr double EPA_TOLERANCE = std::is_same_v<Type, double> ? 1.0e-6 : 1.0e-4;
+
+        constexpr int GJK_MAX_ITERATIONS = 32;
+
+
+        template<typename Calc>
+        inline Calc GjkDot(const Calc (&a)[3], const Calc (&b)[3])
+        {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+
+
+        template<typename Calc>
+        inline void GjkCross(Calc (&outResult)[3], const Calc (&a)[3], const Calc (&b)[3])
+        {
+            outResult[0] = a[1] * b[2] - a[2] * b[1];
+            outResult[1] = a[2] * b[0] - a[0] * b[2];
+            outResult[2] = a[0] * b[1] - a[1] * b[0];
+        }
+
+
+        template<typename Calc>
+        inline void GjkSubtract(Calc (&outResult)[3], const Calc (&a)[3], const Calc (&b)[3])
+        {
+            for (int i = 0; i < 3; ++i)
+                outResult[i] = a[i] - b[i];
+        }
+
+
+        /// <summary>
+        /// Radius of the rounded shapes: spheres and capsules run GJK as their center / segment, which is exact
+        /// in a few iterations where the curved surface converges slowly, and the radius is added afterwards
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <typeparam name="Shape"></typeparam>
+        /// <param name="shape"></param>
+        /// <returns>0 for the other shapes</returns>
+        template<typename Type, typename Shape>
+        inline CalcType<Type> CoreRadius(const Shape& shape)
+        {
+            if constexpr (std::same_as<Shape, Sphere<Type>> || std::same_as<Shape, Capsule<Type>>)
+                return CalcType<Type>(shape.getRadius());
+            else
+                return CalcType<Type>(0);
+        }
+
+
+        /// <summary>
+        /// Support point of a shape (of its core when Core), from its callable or its Support overload
+        /// </summary>
+        /// <typeparam name="Core"></typeparam>
+        /// <typeparam name="Type"></typeparam>
+        /// <typeparam name="Shape"></typeparam>
+        /// <param name="outPoint"></param>
+        /// <param name="shape"></param>
+        /// <param name="direction"></param>
+        template<bool Core, typename Type, typename Shape>
+        inline void ShapeSupport(CalcType<Type> (&outPoint)[3], const Shape& shape, const Vector3<CalcType<Type>>& direction)
+        {
+            Vector3<Type> point;
+            if constexpr (Core && std::same_as<Shape, Sphere<Type>>)
+                point = shape.getCenter();
+            else if constexpr (Core && std::same_as<Shape, Capsule<Type>>)
+                point = SupportSegment(shape, direction);
+            else if constexpr (std::invocable<const Shape&, Vector3<Type>&, const Vector3<CalcType<Type>>&>)
+                shape(point, direction);
+            else
+                Support(point, shape, direction);
+
+            for (int i = 0; i < 3; ++i)
+                outPoint[i] = DecodeValue<CalcType<Type>>(point.getRawValue(i));
+        }
+
+
+        /// <summary>
+        /// Support point of A - B along 'direction'
+        /// </summary>
+        /// <typeparam name="Core"></typeparam>
+        /// <typeparam name="Type"></typeparam>
+        /// <typeparam name="ShapeA"></typeparam>
+        /// <typeparam name="ShapeB"></typeparam>
+        /// <param name="outVertex"></param>
+        /// <param name="a"></param>
+        /// <param name="b"></param>
+        /// <param name="direction"></param>
+        template<bool Core, typename Type, typename ShapeA, typename ShapeB>
+        inline void MinkowskiSupport(GjkVertex<CalcType<Type>>& outVertex, const ShapeA& a, const ShapeB& b, const CalcType<Type> (&direction)[3])
+        {
+            using Calc = CalcType<Type>;
+
+            const Vector3<Calc> toA{ direction[0], direction[1], direction[2] };
+            ShapeSupport<Core, Type>(outVertex.a, a, toA);
+            ShapeSupport<Core, Type>(outVertex.b, b, -toA);
+
+            GjkSubtract(outVertex.w, outVertex.a, outVertex.b);
+            for (int i = 0; i < 3; ++i)
+                outVertex.direction[i] = direction[i];
+        }
+
+
+        /// <summary>
+        /// True when 'w' is (within toleranceSq) a vertex of the simplex already
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="simplex"></param>
+        /// <param name="w"></param>
+        /// <param name="toleranceSq"></param>
+        /// <returns></returns>
+        template<typename Calc>
+        inline bool IsSimplexVertex(const GjkSimplex<Calc>& simplex, const Calc (&w)[3], Calc toleranceSq)
+        {
+            for (int k = 0; k < simplex.count; ++k)
+            {
+                Calc d[3];
+                GjkSubtract(d, w, simplex.vertices[k].w);
+                if (GjkDot(d, d) <= toleranceSq)
+                    return true;
+            }
+            return false;
+        }
+
+
+        /// <summary>
+        /// GJK on A - B (on their cores when Core), started from the supports in the cached directions;
+        /// the cache is refreshed with the final simplex.
+        /// </summary>
+        /// <typeparam name="Core"></typeparam>
+        /// <typeparam name="Type"></typeparam>
+        /// <typeparam name="ShapeA"></typeparam>
+        /// <typeparam name="ShapeB"></typeparam>
+        /// <param name="outSimplex">Final simplex, its weights give the closest points</param>
+        /// <param name="outClosest">Point of A - B closest to the origin (the origin when it encloses it)</param>
+        /// <param name="outIterations"></param>
+        /// <param name="a"></param>
+        /// <param name="b"></param>
+        /// <param name="cache"></param>
+        /// <param name="margin">Sum of the core radii</param>
+        /// <param name="boolean">Stop as soon as the answer is known, without converging the distance</param>
+        /// <returns>True when the origin is within margin (and tolerance) of A - B</returns>
+        template<bool Core, typename Type, typename ShapeA, typename ShapeB>
+        inline bool GjkRun(GjkSimplex<CalcType<Type>>& outSimplex, CalcType<Type> (&outClosest)[3], int& outIterations,
+                           const ShapeA& a, const ShapeB& b, GjkCache<Type>& cache, CalcType<Type> margin, bool boolean)
+        {
+            using Calc = CalcType<Type>;
+            const Calc tolerance = Calc(GJK_TOLERANCE<Type>);
+            const Calc toleranceSq = tolerance * tolerance;
+            const Calc contactSq = (margin + tolerance) * (margin + tolerance);
+
+            /// Warm start: the simplex of the previous query, re-evaluated on the current shapes
+            GjkVertex<Calc> vertex;
+            outSimplex.count = 0;
+            for (int k = 0; k < cache.count; ++k)
+            {
+                const Calc direction[3] = { cache.directions[k].getRawValue(0), cache.directions[k].getRawValue(1), cache.directions[k].getRawValue(2) };
+                MinkowskiSupport<Core, Type>(vertex, a, b, direction);
+                if (!IsSimplexVertex(outSimplex, vertex.w, toleranceSq))
+                    outSimplex.vertices[outSimplex.count++] = vertex;
+            }
+
+            if (outSimplex.count == 0)
+            {
+                const Calc direction[3] = { Calc(1), Calc(0), Calc(0) };
+                MinkowskiSupport<Core, Type>(vertex, a, b, direction);
+                outSimplex.vertices[outSimplex.count++] = vertex;
+            }
+
+            /// The distance must shrink every iteration: when rounding in a flat simplex says otherwise, the previous simplex is the answer.
+            /// The first solved simplex has no previous one and is always kept (its distance may even overflow on huge coordinates).
+            GjkSimplex<Calc> previous = outSimplex;
+            Calc previousClosest[3] = {};
+            Calc previousSq = std::numeric_limits<Calc>::max();
+
+            bool intersecting = false;
+            outIterations = 0;
+            while (outIterations < GJK_MAX_ITERATIONS)
+            {
+                ++outIterations;
+                if (SolveSimplex(outSimplex, outClosest))
+                {
+                    intersecting = true;
+                    break;
+                }
+
+                const Calc distanceSq = GjkDot(outClosest, outClosest);
+                if (outIterations > 1 && distanceSq >= previousSq)
+                {
+                    outSimplex = previous;
+                    for (int i = 0; i < 3; ++i)
+                        outClosest[i] = previousClosest[i];
+                    break;
+                }
+
+                if (distanceSq <= toleranceSq || (boolean && distanceSq <= contactSq))
+                {
+                    intersecting = true;
+                    break;
+                }
+
+                const Calc direction[3] = { -outClosest[0], -outClosest[1], -outClosest[2] };
+                MinkowskiSupport<Core, Type>(vertex, a, b, direction);
+
+                /// The support plane keeps A - B further than margin from the origin: separated
+                const Calc along = GjkDot(outClosest, vertex.w);
+                if (boolean && along > Calc(0) && along * along > contactSq * distanceSq)
+                    break;
+                if (distanceSq - along <= tolerance * distanceSq || IsSimplexVertex(outSimplex, vertex.w, toleranceSq))
+                    break;
+
+                previous = outSimplex;
+                previousSq = distanceSq;
+                for (int i = 0; i < 3; ++i)
+                    previousClosest[i] = outClosest[i];
+                outSimplex.vertices[outSimplex.count++] = vertex;
+            }
+
+            cache.count = outSimplex.count;
+            for (int k = 0; k < outSimplex.count; ++k)
+            {
+                const Calc (&direction)[3] = outSimplex.vertices[k].direction;
+                cache.directions[k] = Vector3<Calc>{ direction[0], direction[1], direction[2] };
+            }
+            return intersecting || GjkDot(outClosest, outClosest) <= contactSq;
+        }
+
+
+        /// <summary>
+        /// Points of A and B (of their cores) given by the simplex weights
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="outA"></param>
+        /// <param name="outB"></param>
+        /// <param name="simplex"></param>
+        template<typename Calc>
+        inline void GjkWitness(Calc (&outA)[3], Calc (&outB)[3], const GjkSimplex<Calc>& simplex)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                outA[i] = Calc(0);
+                outB[i] = Calc(0);
+                for (int k = 0; k < simplex.count; ++k)
+                {
+                    outA[i] += simplex.weights[k] * simplex.vertices[k].a[i];
+                    outB[i] += simplex.weights[k] * simplex.vertices[k].b[i];
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Fill the result of a GJK run on the cores: closest points pushed out by the radii, normal and distance.
+        /// Intersecting shapes get a common point: on the core axis, at the share of the gap of radiusA.
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <param name="outResult"></param>
+        /// <param name="simplex"></param>
+        /// <param name="closest"></param>
+        /// <param name="radiusA"></param>
+        /// <param name="radiusB"></param>
+        /// <param name="intersecting"></param>
+        template<typename Type>
+        inline void GjkFillResult(GjkResult<Type>& outResult, const GjkSimplex<CalcType<Type>>& simplex, const CalcType<Type> (&closest)[3],
+                                  CalcType<Type> radiusA, CalcType<Type> radiusB, bool intersecting)
+        {
+            using Calc = CalcType<Type>;
+
+            Calc pointA[3], pointB[3];
+            GjkWitness(pointA, pointB, simplex);
+
+            const Calc distance = std::sqrt(GjkDot(closest, closest));
+            const Calc margin = radiusA + radiusB;
+            const Calc share = margin > Calc(0) ? radiusA / margin : Calc(0);
+            for (int i = 0; i < 3; ++i)
+            {
+                if (intersecting)
+                {
+                    const Calc common = pointA[i] - closest[i] * share;
+                    outResult.pointA.setRawValue(i, EncodeValue<Type>(common));
+                    outResult.pointB.setRawValue(i, EncodeValue<Type>(common));
+                    outResult.normal.setRawValue(i, EncodeValue<Type>(Calc(0)));
+                }
+                else
+                {
+                    const Calc normal = -closest[i] / distance;
+                    outResult.pointA.setRawValue(i, EncodeValue<Type>(pointA[i] + normal * radiusA));
+                    outResult.pointB.setRawValue(i, EncodeValue<Type>(pointB[i] - normal * radiusB));
+                    outResult.normal.setRawValue(i, EncodeValue<Type>(normal));
+                }
+            }
+
+            outResult.distance = intersecting ? 0.0 : double(distance - margin);
+            outResult.depth = 0.0;
+            outResult.intersecting = intersecting;
+        }
+
+
+        /// <summary>
+        /// Grow the simplex GJK ended with (the origin in or on it) into a tetrahedron for EPA
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <typeparam name="ShapeA"></typeparam>
+        /// <typeparam name="ShapeB"></typeparam>
+        /// <param name="simplex"></param>
+        /// <param name="a"></param>
+        /// <param name="b"></param>
+        /// <returns>False when A - B is flat (no volume to find)</returns>
+        template<typename Type, typename ShapeA, typename ShapeB>
+        inline bool EpaCompleteSimplex(GjkSimplex<CalcType<Type>>& simplex, const ShapeA& a, const ShapeB& b)
+        {
+            using Calc = CalcType<Type>;
+            const Calc toleranceSq = Calc(GJK_TOLERANCE<Type> * GJK_TOLERANCE<Type>);
+
+            GjkVertex<Calc> vertex;
+            Calc offset[3];
+
+            /// Point: any axis that reaches away from it
+            if (simplex.count == 1)
+            {
+                constexpr Calc AXES[6][3] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+                for (const Calc (&axis)[3] : AXES)
+                {
+                    MinkowskiSupport<false, Type>(vertex, a, b, axis);
+                    GjkSubtract(offset, vertex.w, simplex.vertices[0].w);
+                    if (GjkDot(offset, offset) > toleranceSq)
+                    {
+                        simplex.vertices[simplex.count++] = vertex;
+                        break;
+                    }
+                }
+            }
+
+            /// Segment: four directions around it
+            if (simplex.count == 2)
+            {
+                Calc line[3];
+                GjkSubtract(line, simplex.vertices[1].w, simplex.vertices[0].w);
+                const Calc lineSq = GjkDot(line, line);
+
+                int least = 0;
+                for (int i = 1; i < 3; ++i)
+                {
+                    if (std::abs(line[i]) < std::abs(line[least]))
+                        least = i;
+                }
+                Calc axis[3] = {};
+                axis[least] = Calc(1);
+
+                Calc side[3], next[3], away[3];
+                GjkCross(side, line, axis);
+                for (int turn = 0; turn < 4 && simplex.count == 2; ++turn)
+                {
+                    MinkowskiSupport<false, Type>(vertex, a, b, side);
+                    GjkSubtract(offset, vertex.w, simplex.vertices[0].w);
+                    GjkCross(away, offset, line);
+                    if (GjkDot(away, away) > toleranceSq * lineSq)
+                        simplex.vertices[simplex.count++] = vertex;
+
+                    GjkCross(next, line, side);
+                    const Calc scale = Calc(1) / std::sqrt(GjkDot(next, next));
+                    for (int i = 0; i < 3; ++i)
+                        side[i] = next[i] * scale;
+                }
+            }
+
+            /// Triangle: either side of its plane
+            if (simplex.count == 3)
+            {
+                Calc edge1[3], edge2[3], normal[3];
+                GjkSubtract(edge1, simplex.vertices[1].w, simplex.vertices[0].w);
+                GjkSubtract(edge2, simplex.vertices[2].w, simplex.vertices[0].w);
+                GjkCross(normal, edge1, edge2);
+                const Calc normalSq = GjkDot(normal, normal);
+
+                for (int side = 0; side < 2 && simplex.count == 3; ++side)
+                {
+                    MinkowskiSupport<false, Type>(vertex, a, b, normal);
+                    GjkSubtract(offset, vertex.w, simplex.vertices[0].w);
+                    const Calc height = GjkDot(offset, normal);
+                    if (height * height > toleranceSq * normalSq)
+                        simplex.vertices[simplex.count++] = vertex;
+
+                    for (int i = 0; i < 3; ++i)
+                        normal[i] = -normal[i];
+                }
+            }
+
+            return simplex.count == 4;
+        }
+    }
+
+
+    /// <summary>
+    /// True when the shapes intersect (touching counts)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <typeparam name="ShapeA"></typeparam>
+    /// <typeparam name="ShapeB"></typeparam>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <param name="cache">Warm start of the pair, updated</param>
+    /// <returns></returns>
+    template<typename Type, GjkShape<Type> ShapeA, GjkShape<Type> ShapeB>
+    inline bool GjkIntersect(const ShapeA& a, const ShapeB& b, GjkCache<Type>& cache)
+    {
+        helpers::GjkSimplex<CalcType<Type>> simplex;
+        CalcType<Type> closest[3];
+        int iterations;
+        const CalcType<Type> margin = helpers::CoreRadius<Type>(a) + helpers::CoreRadius<Type>(b);
+        return helpers::GjkRun<true>(simplex, closest, iterations, a, b, cache, margin, true);
+    }
+
+
+    /// <summary>
+    /// Distance and closest points of the shapes
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <typeparam name="ShapeA"></typeparam>
+    /// <typeparam name="ShapeB"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <param name="cache">Warm start of the pair, updated</param>
+    /// <returns>True when separated</returns>
+    template<typename Type, GjkShape<Type> ShapeA, GjkShape<Type> ShapeB>
+    inline bool GjkDistance(GjkResult<Type>& outResult, const ShapeA& a, const ShapeB& b, GjkCache<Type>& cache)
+    {
+        helpers::GjkSimplex<CalcType<Type>> simplex;
+        CalcType<Type> closest[3];
+        const CalcType<Type> radiusA = helpers::CoreRadius<Type>(a);
+        const CalcType<Type> radiusB = helpers::CoreRadius<Type>(b);
+        const bool intersecting = helpers::GjkRun<true>(simplex, closest, outResult.iterations, a, b, cache, radiusA + radiusB, false);
+        helpers::GjkFillResult(outResult, simplex, closest, radiusA, radiusB, intersecting);
+        return !intersecting;
+    }
+
+
+    /// <summary>
+    /// Penetration depth, normal and deepest points of intersecting shapes (EPA), distance otherwise
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <typeparam name="ShapeA"></typeparam>
+    /// <typeparam name="ShapeB"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <param name="cache">Warm start of the pair, updated</param>
+    /// <returns>True when intersecting</returns>
+    template<typename Type, GjkShape<Type> ShapeA, GjkShape<Type> ShapeB>
+    inline bool EpaPenetration(GjkResult<Type>& outResult, const ShapeA& a, const ShapeB& b, GjkCache<Type>& cache)
+    {
+        using Calc = CalcType<Type>;
+        using Polytope = helpers::EpaPolytope<Calc>;
+
+        helpers::GjkSimplex<Calc> simplex;
+        Calc closest[3];
+        const Calc radiusA = helpers::CoreRadius<Type>(a);
+        const Calc radiusB = helpers::CoreRadius<Type>(b);
+        const bool intersecting = helpers::GjkRun<true>(simplex, closest, outResult.iterations, a, b, cache, radiusA + radiusB, false);
+        helpers::GjkFillResult(outResult, simplex, closest, radiusA, radiusB, intersecting);
+        if (!intersecting)
+            return false;
+
+        Calc pointA[3], pointB[3];
+        const Calc tolerance = Calc(helpers::GJK_TOLERANCE<Type>);
+        const Calc distance = std::sqrt(helpers::GjkDot(closest, closest));
+
+        /// Cores apart, radii overlapping: the depth is along the core axis, no EPA
+        if (distance > tolerance)
+        {
+            helpers::GjkWitness(pointA, pointB, simplex);
+            for (int i = 0; i < 3; ++i)
+            {
+                const Calc normal = -closest[i] / distance;
+                outResult.pointA.setRawValue(i, EncodeValue<Type>(pointA[i] + normal * radiusA));
+                outResult.pointB.setRawValue(i, EncodeValue<Type>(pointB[i] - normal * radiusB));
+                outResult.normal.setRawValue(i, EncodeValue<Type>(normal));
+            }
+            outResult.depth = double(radiusA + radiusB - distance);
+            return true;
+        }
+
+        /// Cores intersecting: EPA needs a simplex around the origin in the full shapes
+        if (radiusA + radiusB > Calc(0))
+        {
+            GjkCache<Type> full = cache;
+            int iterations = 0;
+            helpers::GjkRun<false>(simplex, closest, iterations, a, b, full, Calc(0), false);
+            outResult.iterations += iterations;
+        }
+
+        /// Flat Minkowski difference: touching, no depth
+        Polytope polytope;
+        if (!helpers::EpaCompleteSimplex<Type>(simplex, a, b) || !polytope.init(simplex))
+            return true;
+
+        int face = polytope.getClosestFace();
+        if (face < 0)
+            return true;
+
+        /// Push the closest face out until the support no longer moves it
+        const Calc epaTolerance = Calc(helpers::EPA_TOLERANCE<Type>);
+        typename Polytope::Face result = polytope.getFace(face);
+        helpers::GjkVertex<Calc> vertex;
+        for (int i = 0; i < Polytope::MAX_VERTICES - 4; ++i)
+        {
+            ++outResult.iterations;
+
+            helpers::MinkowskiSupport<false, Type>(vertex, a, b, result.normal);
+            const Calc gain = helpers::GjkDot(result.normal, vertex.w) - result.distance;
+            if (gain <= epaTolerance * result.distance + tolerance || !polytope.expand(vertex, face))
+                break;
+
+            face = polytope.getClosestFace();
+            if (face < 0)
+                break;
+            result = polytope.getFace(face);
+        }
+
+        polytope.getContact(pointA, pointB, result);
+        for (int i = 0; i < 3; ++i)
+        {
+            outResult.pointA.setRawValue(i, EncodeValue<Type>(pointA[i]));
+            outResult.pointB.setRawValue(i, EncodeValue<Type>(pointB[i]));
+            outResult.normal.setRawValue(i, EncodeValue<Type>(result.normal[i]));
+        }
+        outResult.depth = double(result.distance);
+        return true;
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,155 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Intersection.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/TypeComparisons.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Ray-triangle intersection (Möller–Trumbore, two-sided)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outT"></param>
+    /// <param name="ray"></param>
+    /// <param name="v0"></param>
+    /// <param name="v1"></param>
+    /// <param name="v2"></param>
+    /// <param name="tMax"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool IntersectRayTriangle(double& outT, const Ray<Type>& ray,
+                                     const Vector3<Type>& v0, const Vector3<Type>& v1, const Vector3<Type>& v2,
+                                     double tMax /*= inf*/)
+    {
+        double u, v;
+        return IntersectRayTriangle(outT, u, v, ray, v0, v1, v2, tMax);
+    }
+
+
+    /// <summary>
+    /// Ray-triangle intersection (Möller–Trumbore, two-sided) with barycentric coordinates.
+    /// A ray is considered parallel to the triangle when the determinant is negligible
+    /// relative to the edge and ray lengths, which keeps the test scale independent.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outT"></param>
+    /// <param name="outU"></param>
+    /// <param name="outV"></param>
+    /// <param name="ray"></param>
+    /// <param name="v0"></param>
+    /// <param name="v1"></param>
+    /// <param name="v2"></param>
+    /// <param name="tMax"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<Type>& ray,
+                                     const Vector3<Type>& v0, const Vector3<Type>& v1, const Vector3<Type>& v2,
+                                     double tMax /*= inf*/)
+    {
+        const Vector3<Type>& origin = ray.getOrigin();
+        const Vector3<Type>& direction = ray.getDirection();
+
+        double o[3], d[3], e1[3], e2[3], s[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const double p0 = DecodeValue<double>(v0.getRawValue(i));
+            o[i]  = DecodeValue<double>(origin.getRawValue(i));
+            d[i]  = DecodeValue<double>(direction.getRawValue(i));
+            e1[i] = DecodeValue<double>(v1.getRawValue(i)) - p0;
+            e2[i] = DecodeValue<double>(v2.getRawValue(i)) - p0;
+            s[i]  = o[i] - p0;
+        }
+
+        /// p = d x e2, det = e1 . p
+        const double p[3] = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0] };
+        const double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+
+        const double e1LengthSq = e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2];
+        const double pLengthSq = p[0] * p[0] + p[1] * p[1] + p[2] * p[2];
+        constexpr double eps = Epsilon<Type>::value;
+        if (det * det <= eps * eps * e1LengthSq * pLengthSq)
+            return false;
+
+        const double invDet = 1.0 / det;
+
+        const double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+        if (u < 0.0 || u > 1.0)
+            return false;
+
+        /// q = s x e1
+        const double q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+
+        const double v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * invDet;
+        if (v < 0.0 || u + v > 1.0)
+            return false;
+
+        const double t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * invDet;
+        if (t < 0.0 || t > tMax)
+            return false;
+
+        outT = t;
+        outU = u;
+        outV = v;
+        return true;
+    }
+
+
+    /// <summary>
+    /// Ray-AABB intersection (slab test).
+    /// Zero direction components are handled explicitly: the ray hits that slab only if
+    /// its origin already lies between the two planes.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outTNear"></param>
+    /// <param name="ray"></param>
+    /// <param name="boxMin"></param>
+    /// <param name="boxMax"></param>
+    /// <param name="tMax"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool IntersectRayAabb(double& outTNear, const Ray<Type>& ray,
+                                 const Vector3<Type>& boxMin, const Vector3<Type>& boxMax,
+                                 double tMax /*= inf*/)
+    {
+        const Vector3<Type>& origin = ray.getOrigin();
+        const Vector3<Type>& direction = ray.getDirection();
+
+        double tNear = 0.0;
+        double tFar = tMax;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const double o = DecodeValue<double>(origin.getRawValue(i));
+            const double d = DecodeValue<double>(direction.getRawValue(i));
+            const double lo = DecodeValue<double>(boxMin.getRawValue(i));
+            const double hi = DecodeValue<double>(boxMax.getRawValue(i));
+
+            if (d == 0.0)
+            {
+                if (o < lo || o > hi)
+                    return false;
+                continue;
+            }
+
+            const double invD = 1.0 / d;
+            double t0 = (lo - o) * invD;
+            double t1 = (hi - o) * invD;
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            tNear = std::max(tNear, t0);
+            tFar = std::min(tFar, t1);
+            if (tNear > tFar)
+                return false;
+        }
+
+        outTNear = tNear;
+        return true;
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,131 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Overlap.inl
+///----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Point of the segment [start, end] closest to 'point' (start for a degenerate segment)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="start"></param>
+    /// <param name="end"></param>
+    /// <param name="point"></param>
+    template<typename Type>
+    inline void ClosestPointOnSegment(Vector3<Type>& outResult, const Vector3<Type>& start, const Vector3<Type>& end, const Vector3<Type>& point)
+    {
+        double a[3], d[3];
+        double dd = 0.0, pd = 0.0;
+        for (int i = 0; i < 3; ++i)
+        {
+            a[i] = DecodeValue<double>(start.getRawValue(i));
+            d[i] = DecodeValue<double>(end.getRawValue(i)) - a[i];
+            dd += d[i] * d[i];
+            pd += (DecodeValue<double>(point.getRawValue(i)) - a[i]) * d[i];
+        }
+
+        const double t = dd > 0.0 ? std::clamp(pd / dd, 0.0, 1.0) : 0.0;
+        for (int i = 0; i < 3; ++i)
+            outResult.setRawValue(i, EncodeValue<Type>(a[i] + d[i] * t));
+    }
+
+
+    /// <summary>
+    /// Point of the sphere closest to 'point'
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="sphere"></param>
+    /// <param name="point"></param>
+    template<typename Type>
+    inline void ClosestPoint(Vector3<Type>& outResult, const Sphere<Type>& sphere, const Vector3<Type>& point)
+    {
+        const Vector3<Type>& center = sphere.getCenter();
+
+        double c[3], v[3];
+        double lengthSq = 0.0;
+        for (int i = 0; i < 3; ++i)
+        {
+            c[i] = DecodeValue<double>(center.getRawValue(i));
+            v[i] = DecodeValue<double>(point.getRawValue(i)) - c[i];
+            lengthSq += v[i] * v[i];
+        }
+
+        const double radius = sphere.getRadius();
+        if (lengthSq <= radius * radius)
+        {
+            outResult = point;
+            return;
+        }
+
+        const double scale = radius / std::sqrt(lengthSq);
+        for (int i = 0; i < 3; ++i)
+            outResult.setRawValue(i, EncodeValue<Type>(c[i] + v[i] * scale));
+    }
+
+
+    /// <summary>
+    /// Point of the capsule closest to 'point': the closest point of its segment pushed out by the radius
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="capsule"></param>
+    /// <param name="point"></param>
+    template<typename Type>
+    inline void ClosestPoint(Vector3<Type>& outResult, const Capsule<Type>& capsule, const Vector3<Type>& point)
+    {
+        Vector3<Type> onSegment;
+        ClosestPointOnSegment(onSegment, capsule.getStart(), capsule.getEnd(), point);
+        ClosestPoint(outResult, Sphere<Type>{ onSegment, capsule.getRadius() }, point);
+    }
+
+
+    /// <summary>
+    /// Point of the box closest to 'point': offset from the center clamped along each box axis
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="box"></param>
+    /// <param name="point"></param>
+    template<typename Type>
+    inline void ClosestPoint(Vector3<Type>& outResult, const Obb<Type>& box, const Vector3<Type>& point)
+    {
+        const Vector3<Type>& center = box.getCenter();
+        const Matrix3x3<Type>& rotation = box.getRotation();
+        const Vector3<Type>& halfExtents = box.getHalfExtents();
+
+        double c[3], v[3], result[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            c[i] = DecodeValue<double>(center.getRawValue(i));
+            v[i] = DecodeValue<double>(point.getRawValue(i)) - c[i];
+            result[i] = c[i];
+        }
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            double u[3];
+            double distance = 0.0;
+            for (int i = 0; i < 3; ++i)
+            {
+                u[i] = DecodeValue<double>(rotation.getRawValue(i, axis));
+                distance += v[i] * u[i];
+            }
+
+            const double extent = DecodeValue<double>(halfExtents.getRawValue(axis));
+            distance = std::clamp(distance, -extent, extent);
+            for (int i = 0; i < 3; ++i)
+                result[i] += u[i] * distance;
+        }
+
+        for (int i = 0; i < 3; ++i)
+            outResult.setRawValue(i, EncodeValue<Type>(result[i]));
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,372 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Primitives.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Asserts.h"
+
+namespace ETL::Math
+{
+
+    ///------------------------------------------------------------------------------------------
+    /// Sphere
+
+    /// <summary>
+    /// Explicit constructor
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="center"></param>
+    /// <param name="radius"></param>
+    template<typename Type>
+    constexpr Sphere<Type>::Sphere(const Vector3<Type>& center, double radius)
+        : mCenter{ center }, mRadius{ EncodeValue<Type>(radius) }
+    {
+        ETLMATH_ASSERT(radius >= 0.0, "Sphere radius must be positive");
+    }
+
+
+    /// <summary>
+    /// Center getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Vector3<Type>& Sphere<Type>::getCenter() const
+    {
+        return mCenter;
+    }
+
+
+    /// <summary>
+    /// Radius getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline double Sphere<Type>::getRadius() const
+    {
+        return DecodeValue<double>(mRadius);
+    }
+
+
+    /// <summary>
+    /// Center setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="center"></param>
+    template<typename Type>
+    inline void Sphere<Type>::setCenter(const Vector3<Type>& center)
+    {
+        mCenter = center;
+    }
+
+
+    /// <summary>
+    /// Radius setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="radius"></param>
+    template<typename Type>
+    inline void Sphere<Type>::setRadius(double radius)
+    {
+        ETLMATH_ASSERT(radius >= 0.0, "Sphere radius must be positive");
+        mRadius = EncodeValue<Type>(radius);
+    }
+
+
+    /// <summary>
+    /// Equality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Sphere<Type>::operator==(const Sphere& other) const
+    {
+        return mCenter == other.mCenter && mRadius == other.mRadius;
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Sphere<Type>::operator!=(const Sphere& other) const
+    {
+        return !(*this == other);
+    }
+
+
+    /// <summary>
+    /// Raw radius (fixed point for int)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Sphere<Type>::getRawRadius() const
+    {
+        return mRadius;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Capsule
+
+    /// <summary>
+    /// Explicit constructor
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="start"></param>
+    /// <param name="end"></param>
+    /// <param name="radius"></param>
+    template<typename Type>
+    constexpr Capsule<Type>::Capsule(const Vector3<Type>& start, const Vector3<Type>& end, double radius)
+        : mStart{ start }, mEnd{ end }, mRadius{ EncodeValue<Type>(radius) }
+    {
+        ETLMATH_ASSERT(radius >= 0.0, "Capsule radius must be positive");
+    }
+
+
+    /// <summary>
+    /// Segment start getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Vector3<Type>& Capsule<Type>::getStart() const
+    {
+        return mStart;
+    }
+
+
+    /// <summary>
+    /// Segment end getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Vector3<Type>& Capsule<Type>::getEnd() const
+    {
+        return mEnd;
+    }
+
+
+    /// <summary>
+    /// Radius getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline double Capsule<Type>::getRadius() const
+    {
+        return DecodeValue<double>(mRadius);
+    }
+
+
+    /// <summary>
+    /// Segment start setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="start"></param>
+    template<typename Type>
+    inline void Capsule<Type>::setStart(const Vector3<Type>& start)
+    {
+        mStart = start;
+    }
+
+
+    /// <summary>
+    /// Segment end setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="end"></param>
+    template<typename Type>
+    inline void Capsule<Type>::setEnd(const Vector3<Type>& end)
+    {
+        mEnd = end;
+    }
+
+
+    /// <summary>
+    /// Radius setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="radius"></param>
+    template<typename Type>
+    inline void Capsule<Type>::setRadius(double radius)
+    {
+        ETLMATH_ASSERT(radius >= 0.0, "Capsule radius must be positive");
+        mRadius = EncodeValue<Type>(radius);
+    }
+
+
+    /// <summary>
+    /// Equality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Capsule<Type>::operator==(const Capsule& other) const
+    {
+        return mStart == other.mStart && mEnd == other.mEnd && mRadius == other.mRadius;
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Capsule<Type>::operator!=(const Capsule& other) const
+    {
+        return !(*this == other);
+    }
+
+
+    /// <summary>
+    /// Raw radius (fixed point for int)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Capsule<Type>::getRawRadius() const
+    {
+        return mRadius;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Obb
+
+    /// <summary>
+    /// Explicit constructor
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="center"></param>
+    /// <param name="rotation"></param>
+    /// <param name="halfExtents"></param>
+    template<typename Type>
+    constexpr Obb<Type>::Obb(const Vector3<Type>& center, const Matrix3x3<Type>& rotation, const Vector3<Type>& halfExtents)
+        : mCenter{ center }, mRotation{ rotation }, mHalfExtents{ halfExtents }
+    {
+    }
+
+
+    /// <summary>
+    /// Center getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Vector3<Type>& Obb<Type>::getCenter() const
+    {
+        return mCenter;
+    }
+
+
+    /// <summary>
+    /// Rotation getter (columns are the box axes)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Matrix3x3<Type>& Obb<Type>::getRotation() const
+    {
+        return mRotation;
+    }
+
+
+    /// <summary>
+    /// Half extents getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Vector3<Type>& Obb<Type>::getHalfExtents() const
+    {
+        return mHalfExtents;
+    }
+
+
+    /// <summary>
+    /// Box axis getter (world space)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> Obb<Type>::getAxis(int index) const
+    {
+        ETLMATH_ASSERT(index >= 0 && index < 3, "Obb axis index out of bounds");
+        return mRotation.getCol(index);
+    }
+
+
+    /// <summary>
+    /// Center setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="center"></param>
+    template<typename Type>
+    inline void Obb<Type>::setCenter(const Vector3<Type>& center)
+    {
+        mCenter = center;
+    }
+
+
+    /// <summary>
+    /// Rotation setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="rotation"></param>
+    template<typename Type>
+    inline void Obb<Type>::setRotation(const Matrix3x3<Type>& rotation)
+    {
+        mRotation = rotation;
+    }
+
+
+    /// <summary>
+    /// Half extents setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="halfExtents"></param>
+    template<typename Type>
+    inline void Obb<Type>::setHalfExtents(const Vector3<Type>& halfExtents)
+    {
+        mHalfExtents = halfExtents;
+    }
+
+
+    /// <summary>
+    /// Equality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Obb<Type>::operator==(const Obb& other) const
+    {
+        return mCenter == other.mCenter && mRotation == other.mRotation && mHalfExtents == other.mHalfExtents;
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Obb<Type>::operator!=(const Obb& other) const
+    {
+        return !(*this == other);
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,206 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Ray.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Asserts.h"
+#include <cmath>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Explicit constructor
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="origin"></param>
+    /// <param name="direction"></param>
+    template<typename Type>
+    constexpr Ray<Type>::Ray(const Vector3<Type>& origin, const Vector3<Type>& direction)
+        : mOrigin{ origin }, mDirection{ direction }
+    {
+    }
+
+
+    /// <summary>
+    /// Origin getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Vector3<Type>& Ray<Type>::getOrigin() const
+    {
+        return mOrigin;
+    }
+
+
+    /// <summary>
+    /// Direction getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline const Vector3<Type>& Ray<Type>::getDirection() const
+    {
+        return mDirection;
+    }
+
+
+    /// <summary>
+    /// Origin setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="origin"></param>
+    template<typename Type>
+    inline void Ray<Type>::setOrigin(const Vector3<Type>& origin)
+    {
+        mOrigin = origin;
+    }
+
+
+    /// <summary>
+    /// Direction setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="direction"></param>
+    template<typename Type>
+    inline void Ray<Type>::setDirection(const Vector3<Type>& direction)
+    {
+        mDirection = direction;
+    }
+
+
+    /// <summary>
+    /// Point along the ray at distance t
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="t"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> Ray<Type>::getPoint(double t) const
+    {
+        Vector3<Type> result;
+        GetPoint(result, *this, t);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Point along the ray at distance t (to output)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="t"></param>
+    template<typename Type>
+    inline void Ray<Type>::getPointTo(Vector3<Type>& outResult, double t) const
+    {
+        GetPoint(outResult, *this, t);
+    }
+
+
+    /// <summary>
+    /// Equality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Ray<Type>::operator==(const Ray& other) const
+    {
+        return mOrigin == other.mOrigin && mDirection == other.mDirection;
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Ray<Type>::operator!=(const Ray& other) const
+    {
+        return !(*this == other);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Ray packets
+
+    /// <summary>
+    /// Store a ray in the given lane and cache its reciprocal direction.
+    /// Zero direction components are nudged to a tiny signed value so the cached
+    /// reciprocal stays finite (the slab kernel resolves zero components explicitly).
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <typeparam name="Width"></typeparam>
+    /// <typeparam name="RayType"></typeparam>
+    /// <param name="lane"></param>
+    /// <param name="ray"></param>
+    /// <param name="maxDistance"></param>
+    template<typename Type, int Width>
+    template<typename RayType>
+    inline void RayPacket<Type, Width>::setRay(int lane, const Ray<RayType>& ray, double maxDistance /*= inf*/)
+    {
+        ETLMATH_ASSERT(lane >= 0 && lane < Width, "RayPacket lane out of bounds access");
+
+        const Vector3<RayType>& origin = ray.getOrigin();
+        const Vector3<RayType>& direction = ray.getDirection();
+
+        originX[lane] = DecodeValue<Type>(origin.getRawValue(0));
+        originY[lane] = DecodeValue<Type>(origin.getRawValue(1));
+        originZ[lane] = DecodeValue<Type>(origin.getRawValue(2));
+        dirX[lane]    = DecodeValue<Type>(direction.getRawValue(0));
+        dirY[lane]    = DecodeValue<Type>(direction.getRawValue(1));
+        dirZ[lane]    = DecodeValue<Type>(direction.getRawValue(2));
+        tMax[lane]    = static_cast<Type>(maxDistance);
+
+        constexpr Type tiny = std::numeric_limits<Type>::min();
+        invDirX[lane] = Type(1) / (dirX[lane] != Type(0) ? dirX[lane] : std::copysign(tiny, dirX[lane]));
+        invDirY[lane] = Type(1) / (dirY[lane] != Type(0) ? dirY[lane] : std::copysign(tiny, dirY[lane]));
+        invDirZ[lane] = Type(1) / (dirZ[lane] != Type(0) ? dirZ[lane] : std::copysign(tiny, dirZ[lane]));
+    }
+
+
+    /// <summary>
+    /// Read back the ray stored in the given lane
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <typeparam name="Width"></typeparam>
+    /// <typeparam name="RayType"></typeparam>
+    /// <param name="lane"></param>
+    /// <param name="outRay"></param>
+    template<typename Type, int Width>
+    template<typename RayType>
+    inline void RayPacket<Type, Width>::getRay(int lane, Ray<RayType>& outRay) const
+    {
+        ETLMATH_ASSERT(lane >= 0 && lane < Width, "RayPacket lane out of bounds access");
+
+        outRay.setOrigin(Vector3<RayType>{ double(originX[lane]), double(originY[lane]), double(originZ[lane]) });
+        outRay.setDirection(Vector3<RayType>{ double(dirX[lane]), double(dirY[lane]), double(dirZ[lane]) });
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions
+
+    /// <summary>
+    /// Point along the ray at distance t
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="ray"></param>
+    /// <param name="t"></param>
+    template<typename Type>
+    inline void GetPoint(Vector3<Type>& outResult, const Ray<Type>& ray, double t)
+    {
+        const Vector3<Type>& origin = ray.getOrigin();
+        const Vector3<Type>& direction = ray.getDirection();
+
+        /// Raw values share the same scale (fixed point or not), t is a plain factor
+        outResult.setRawValue(0, static_cast<Type>(origin.getRawValue(0) + direction.getRawValue(0) * t));
+        outResult.setRawValue(1, static_cast<Type>(origin.getRawValue(1) + direction.getRawValue(1) * t));
+        outResult.setRawValue(2, static_cast<Type>(origin.getRawValue(2) + direction.getRawValue(2) * t));
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,100 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// GpuExport.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/Vector3.h"
+#include <cstddef>
+#include <span>
+
+namespace ETL::Math
+{
+    /// Batched conversion of math types into GPU buffer layouts (uniform/storage buffers,
+    /// instance streams). Destinations are float arrays, double and 16.16 fixed point sources
+    /// are converted. Padding floats are written as 0, so uploads are deterministic.
+    ///
+    /// Per element sizes (floats):
+    ///                                    Std140 / Std430    Scalar
+    ///     Vector3                        4 (vec3 + pad)     3
+    ///     Matrix3x3                      12 (3 x vec4)      9
+    ///     Matrix4x4                      16                 16
+    ///     Matrix4x4, last row dropped    column-major: 16 (4 x vec3 + pad) / 12, row-major: 12 (3 x vec4)
+    ///
+    /// std140 and std430 only differ for scalar/vec2 arrays and are identical for these types (vec3 and
+    /// matrix columns are 16-byte aligned in both), both names are kept so call sites state their block layout.
+    /// Row-major order writes the transposed storage (GLSL row_major, HLSL default packing).
+    /// Dropping the last row of a row-major Matrix4x4 gives the 3x4 affine layout of
+    /// VkTransformMatrixKHR / D3D12 instance descriptors.
+
+    /// Block layout of the destination buffer
+    enum class GpuLayout
+    {
+        Std140, /// Uniform buffers (vec3 padded to 16 bytes)
+        Std430, /// Storage buffers (same as Std140 for vec3/mat3/mat4)
+        Scalar  /// Tightly packed (scalar block layout, vertex/instance streams)
+    };
+
+    /// Storage order of exported matrices
+    enum class GpuMatrixOrder
+    {
+        ColumnMajor, /// Same as Matrix3x3/Matrix4x4 internal storage (GLSL/SPIR-V default)
+        RowMajor     /// Transposed
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Destination sizes (in floats)
+
+    constexpr std::size_t GetGpuFloatCount4x4(GpuLayout layout, GpuMatrixOrder order, bool bDropLastRow)
+    {
+        if (!bDropLastRow)
+            return 16;
+        return (order == GpuMatrixOrder::RowMajor || layout == GpuLayout::Scalar) ? 12 : 16;
+    }
+
+    constexpr std::size_t GetGpuFloatCount3x3(GpuLayout layout)
+    {
+        return layout == GpuLayout::Scalar ? 9 : 12;
+    }
+
+    constexpr std::size_t GetGpuFloatCountVector3(GpuLayout layout)
+    {
+        return layout == GpuLayout::Scalar ? 3 : 4;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Batched export (destination must hold count * GetGpuFloatCount*() floats)
+
+    /// Matrix4x4 array, returns the number of floats written
+    template<typename Type>
+    std::size_t ExportToGpu(std::span<float> outBuffer, std::span<const Matrix4x4<Type>> mats, GpuLayout layout,
+                            GpuMatrixOrder order = GpuMatrixOrder::ColumnMajor, bool bDropLastRow = false);
+
+    /// Matrix3x3 array, returns the number of floats written
+    template<typename Type>
+    std::size_t ExportToGpu(std::span<float> outBuffer, std::span<const Matrix3x3<Type>> mats, GpuLayout layout,
+                            GpuMatrixOrder order = GpuMatrixOrder::ColumnMajor);
+
+    /// Vector3 array, returns the number of floats written
+    template<typename Type>
+    std::size_t ExportToGpu(std::span<float> outBuffer, std::span<const Vector3<Type>> vectors, GpuLayout layout);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix4x4<float>>,  GpuLayout, GpuMatrixOrder, bool);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix4x4<double>>, GpuLayout, GpuMatrixOrder, bool);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix4x4<int>>,    GpuLayout, GpuMatrixOrder, bool);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix3x3<float>>,  GpuLayout, GpuMatrixOrder);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix3x3<double>>, GpuLayout, GpuMatrixOrder);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix3x3<int>>,    GpuLayout, GpuMatrixOrder);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Vector3<float>>,    GpuLayout);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Vector3<double>>,   GpuLayout);
+    extern template std::size_t ExportToGpu(std::span<float>, std::span<const Vector3<int>>,      GpuLayout);
+
+} /// namespace ETL::Math
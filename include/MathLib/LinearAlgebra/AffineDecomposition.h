@@ -0,0 +1,70 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// AffineDecomposition.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/Quaternion.h"
+#include "MathLib/Types/Vector3.h"
+#include <span>
+
+namespace ETL::Math
+{
+    /// Translation / rotation / scale / shear decomposition of affine transforms.
+    /// The linear part L (upper 3x3) is split by polar decomposition L = Q * K (Q orthogonal,
+    /// K symmetric stretch), computed with scaled Newton iterations Q <- (g * Q + Q^-T / g) / 2
+    /// that stop as soon as Q no longer changes (typically 4-7 iterations, 20 at most).
+    /// Unlike GetRotation/GetScaling this tolerates shear and never goes through Euler angles.
+    ///
+    /// Results satisfy L = R * shear * diag(scale):
+    ///  - R is the rotation 'outRotation', shear has a unit diagonal (identity without shear),
+    ///  - for a reflection (det(L) < 0) one scale component is negative: the axis whose basis
+    ///    vector is most flipped by Q (a mirror along X gives scale.x < 0 and no rotation).
+    /// Fixed point matrices are decomposed in double precision.
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Decompose
+
+    /// <summary>
+    /// Decompose 'mat' into translation, rotation, scale and (optionally) shear.
+    /// Returns false (outputs untouched) if the linear part is singular.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="mat">Affine transform (last row is ignored)</param>
+    /// <param name="outTranslation"></param>
+    /// <param name="outRotation">Unit quaternion</param>
+    /// <param name="outScale"></param>
+    /// <param name="outShear">Unit diagonal shear, may be null (the shear is then dropped)</param>
+    template<typename Type>
+    bool Decompose(const Matrix4x4<Type>& mat, Vector3<Type>& outTranslation, Quaternion<Type>& outRotation,
+                   Vector3<Type>& outScale, Matrix3x3<Type>* outShear = nullptr);
+
+    /// <summary>
+    /// Batched version (SIMD across matrices, 4/8 lanes iterate until all of them converged).
+    /// ok[i] is false for a singular matrix (its outputs are untouched). outShears may be empty,
+    /// all other spans must have the same size. Returns true if every matrix was decomposed.
+    /// </summary>
+    template<typename Type>
+    bool Decompose(std::span<const Matrix4x4<Type>> mats, std::span<Vector3<Type>> outTranslations,
+                   std::span<Quaternion<Type>> outRotations, std::span<Vector3<Type>> outScales,
+                   std::span<Matrix3x3<Type>> outShears, std::span<bool> ok);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template bool Decompose(const Matrix4x4<float>&  mat, Vector3<float>&  outTranslation, Quaternion<float>&  outRotation, Vector3<float>&  outScale, Matrix3x3<float>*  outShear);
+    extern template bool Decompose(const Matrix4x4<double>& mat, Vector3<double>& outTranslation, Quaternion<double>& outRotation, Vector3<double>& outScale, Matrix3x3<double>* outShear);
+    extern template bool Decompose(const Matrix4x4<int>&    mat, Vector3<int>&    outTranslation, Quaternion<int>&    outRotation, Vector3<int>&    outScale, Matrix3x3<int>*    outShear);
+
+    extern template bool Decompose(std::span<const Matrix4x4<float>>  mats, std::span<Vector3<float>>  outTranslations, std::span<Quaternion<float>>  outRotations,
+                                   std::span<Vector3<float>>  outScales, std::span<Matrix3x3<float>>  outShears, std::span<bool> ok);
+    extern template bool Decompose(std::span<const Matrix4x4<double>> mats, std::span<Vector3<double>> outTranslations, std::span<Quaternion<double>> outRotations,
+                                   std::span<Vector3<double>> outScales, std::span<Matrix3x3<double>> outShears, std::span<bool> ok);
+    extern template bool Decompose(std::span<const Matrix4x4<int>>    mats, std::span<Vector3<int>>    outTranslations, std::span<Quaternion<int>>    outRotations,
+                                   std::span<Vector3<int>>    outScales, std::span<Matrix3x3<int>>    outShears, std::span<bool> ok);
+
+} /// namespace ETL::Math
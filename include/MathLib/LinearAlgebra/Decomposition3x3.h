@@ -0,0 +1,73 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Decomposition3x3.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Types/Vector3.h"
+#include <span>
+
+namespace ETL::Math
+{
+    /// 3x3 factorizations (McAdams et al., "Computing the Singular Value Decomposition of 3x3
+    /// matrices with minimal branching and elementary floating point operations").
+    /// Both solvers run a fixed number of cyclic Jacobi sweeps with quaternion-accumulated
+    /// approximate Givens rotations, so every matrix costs the same and the SIMD batch versions
+    /// (one matrix per lane, 4/8 lanes) have no data dependent branches.
+    ///
+    /// Accuracy (worst reconstruction error over random matrices with entries in [-1, 1], relative
+    /// to the largest eigen/singular value): float 5e-6, double 4e-15. Output rotations are
+    /// orthonormal to 1e-6 (float) / 2e-15 (double).
+    /// Fixed point matrices are decoded and solved in double precision.
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Symmetric eigen decomposition: mat = outVectors * diag(outValues) * outVectors^T
+    /// Only the lower triangle of 'mat' is read. Eigenvalues are sorted in decreasing order,
+    /// eigenvectors are the columns of outVectors, a proper rotation (det = +1).
+
+    template<typename Type>
+    void EigenSymmetric(Vector3<Type>& outValues, Matrix3x3<Type>& outVectors, const Matrix3x3<Type>& mat);
+
+    /// Batched version (SIMD across matrices): all spans must have the same size
+    template<typename Type>
+    void EigenSymmetric(std::span<Vector3<Type>> outValues, std::span<Matrix3x3<Type>> outVectors, std::span<const Matrix3x3<Type>> mats);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Singular value decomposition: mat = outU * diag(outSigma) * outV^T
+    /// outU and outV are proper rotations (det = +1), singular values are sorted by decreasing
+    /// magnitude. For a reflection (det(mat) < 0) the sign goes to the smallest one, outSigma.z < 0.
+    /// Small singular values are computed through mat^T * mat: their absolute error follows the
+    /// largest one (relative accuracy is lost on ill-conditioned matrices).
+
+    template<typename Type>
+    void SVD(Matrix3x3<Type>& outU, Vector3<Type>& outSigma, Matrix3x3<Type>& outV, const Matrix3x3<Type>& mat);
+
+    /// Batched version (SIMD across matrices): all spans must have the same size
+    template<typename Type>
+    void SVD(std::span<Matrix3x3<Type>> outU, std::span<Vector3<Type>> outSigma, std::span<Matrix3x3<Type>> outV,
+             std::span<const Matrix3x3<Type>> mats);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template void EigenSymmetric(Vector3<float>&  outValues, Matrix3x3<float>&  outVectors, const Matrix3x3<float>&  mat);
+    extern template void EigenSymmetric(Vector3<double>& outValues, Matrix3x3<double>& outVectors, const Matrix3x3<double>& mat);
+    extern template void EigenSymmetric(Vector3<int>&    outValues, Matrix3x3<int>&    outVectors, const Matrix3x3<int>&    mat);
+
+    extern template void EigenSymmetric(std::span<Vector3<float>>  outValues, std::span<Matrix3x3<float>>  outVectors, std::span<const Matrix3x3<float>>  mats);
+    extern template void EigenSymmetric(std::span<Vector3<double>> outValues, std::span<Matrix3x3<double>> outVectors, std::span<const Matrix3x3<double>> mats);
+    extern template void EigenSymmetric(std::span<Vector3<int>>    outValues, std::span<Matrix3x3<int>>    outVectors, std::span<const Matrix3x3<int>>    mats);
+
+    extern template void SVD(Matrix3x3<float>&  outU, Vector3<float>&  outSigma, Matrix3x3<float>&  outV, const Matrix3x3<float>&  mat);
+    extern template void SVD(Matrix3x3<double>& outU, Vector3<double>& outSigma, Matrix3x3<double>& outV, const Matrix3x3<double>& mat);
+    extern template void SVD(Matrix3x3<int>&    outU, Vector3<int>&    outSigma, Matrix3x3<int>&    outV, const Matrix3x3<int>&    mat);
+
+    extern template void SVD(std::span<Matrix3x3<float>>  outU, std::span<Vector3<float>>  outSigma, std::span<Matrix3x3<float>>  outV, std::span<const Matrix3x3<float>>  mats);
+    extern template void SVD(std::span<Matrix3x3<double>> outU, std::span<Vector3<double>> outSigma, std::span<Matrix3x3<double>> outV, std::span<const Matrix3x3<double>> mats);
+    extern template void SVD(std::span<Matrix3x3<int>>    outU, std::span<Vector3<int>>    outSigma, std::span<Matrix3x3<int>>    outV, std::span<const Matrix3x3<int>>    mats);
+
+} /// namespace ETL::Math
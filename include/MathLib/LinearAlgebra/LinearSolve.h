@@ -0,0 +1,177 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// LinearSolve.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/MatrixN.h"
+#include <span>
+
+namespace ETL::Math
+{
+    /// Small dense linear systems mat * outX = b (3x3, 4x4 and 6x6).
+    /// No explicit inverse is formed, so results are better conditioned than Inverse + Multiply.
+    /// For 6x6 systems solving is about twice cheaper as well; the closed form 3x3/4x4 inverses stay
+    /// competitive for one-off systems, throughput comes from the batched versions.
+    /// Every solver is a single kernel written against Simd::Pack:
+    /// the single system API runs it on one lane, the batched API on the widest pack available
+    /// (one system per lane), so both agree (bit identical with MATHLIB_DETERMINISTIC).
+    /// Fixed point systems are decoded and solved in double precision.
+    ///
+    /// All solvers return false when the system is numerically singular for the method
+    /// (a pivot below Epsilon<Type>); outX is then left untouched.
+    /// Batched versions fill 'ok' per system and return true if every system was solved;
+    /// all spans must have the same size.
+
+
+    ///------------------------------------------------------------------------------------------
+    /// General matrices: Gaussian elimination with partial pivoting (LU)
+
+    template<typename Type>
+    bool Solve(Vector3<Type>& outX, const Matrix3x3<Type>& mat, const Vector3<Type>& b);
+
+    template<typename Type>
+    bool Solve(Vector4<Type>& outX, const Matrix4x4<Type>& mat, const Vector4<Type>& b);
+
+    template<typename Type>
+    bool Solve(Vector6<Type>& outX, const Matrix6x6<Type>& mat, const Vector6<Type>& b);
+
+    /// Batched versions (SIMD across systems)
+    template<typename Type>
+    bool Solve(std::span<Vector3<Type>> outX, std::span<const Matrix3x3<Type>> mats, std::span<const Vector3<Type>> b, std::span<bool> ok);
+
+    template<typename Type>
+    bool Solve(std::span<Vector4<Type>> outX, std::span<const Matrix4x4<Type>> mats, std::span<const Vector4<Type>> b, std::span<bool> ok);
+
+    template<typename Type>
+    bool Solve(std::span<Vector6<Type>> outX, std::span<const Matrix6x6<Type>> mats, std::span<const Vector6<Type>> b, std::span<bool> ok);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Symmetric positive definite matrices: Cholesky (mat = L * L^T)
+    /// Only the lower triangle of 'mat' is read. Fails on matrices that are not positive definite.
+
+    template<typename Type>
+    bool SolveCholesky(Vector3<Type>& outX, const Matrix3x3<Type>& mat, const Vector3<Type>& b);
+
+    template<typename Type>
+    bool SolveCholesky(Vector4<Type>& outX, const Matrix4x4<Type>& mat, const Vector4<Type>& b);
+
+    template<typename Type>
+    bool SolveCholesky(Vector6<Type>& outX, const Matrix6x6<Type>& mat, const Vector6<Type>& b);
+
+    /// Batched versions (SIMD across systems)
+    template<typename Type>
+    bool SolveCholesky(std::span<Vector3<Type>> outX, std::span<const Matrix3x3<Type>> mats, std::span<const Vector3<Type>> b, std::span<bool> ok);
+
+    template<typename Type>
+    bool SolveCholesky(std::span<Vector4<Type>> outX, std::span<const Matrix4x4<Type>> mats, std::span<const Vector4<Type>> b, std::span<bool> ok);
+
+    template<typename Type>
+    bool SolveCholesky(std::span<Vector6<Type>> outX, std::span<const Matrix6x6<Type>> mats, std::span<const Vector6<Type>> b, std::span<bool> ok);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Symmetric matrices: LDL^T without pivoting (mat = L * D * L^T, unit lower L)
+    /// Only the lower triangle of 'mat' is read. No square roots, and unlike Cholesky it also
+    /// handles symmetric indefinite systems whose leading minors are non-singular (e.g. KKT systems).
+
+    template<typename Type>
+    bool SolveLDLT(Vector3<Type>& outX, const Matrix3x3<Type>& mat, const Vector3<Type>& b);
+
+    template<typename Type>
+    bool SolveLDLT(Vector4<Type>& outX, const Matrix4x4<Type>& mat, const Vector4<Type>& b);
+
+    template<typename Type>
+    bool SolveLDLT(Vector6<Type>& outX, const Matrix6x6<Type>& mat, const Vector6<Type>& b);
+
+    /// Batched versions (SIMD across systems)
+    template<typename Type>
+    bool SolveLDLT(std::span<Vector3<Type>> outX, std::span<const Matrix3x3<Type>> mats, std::span<const Vector3<Type>> b, std::span<bool> ok);
+
+    template<typename Type>
+    bool SolveLDLT(std::span<Vector4<Type>> outX, std::span<const Matrix4x4<Type>> mats, std::span<const Vector4<Type>> b, std::span<bool> ok);
+
+    template<typename Type>
+    bool SolveLDLT(std::span<Vector6<Type>> outX, std::span<const Matrix6x6<Type>> mats, std::span<const Vector6<Type>> b, std::span<bool> ok);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template bool Solve(Vector3<float>&  outX, const Matrix3x3<float>&  mat, const Vector3<float>&  b);
+    extern template bool Solve(Vector3<double>& outX, const Matrix3x3<double>& mat, const Vector3<double>& b);
+    extern template bool Solve(Vector3<int>&    outX, const Matrix3x3<int>&    mat, const Vector3<int>&    b);
+
+    extern template bool Solve(Vector4<float>&  outX, const Matrix4x4<float>&  mat, const Vector4<float>&  b);
+    extern template bool Solve(Vector4<double>& outX, const Matrix4x4<double>& mat, const Vector4<double>& b);
+    extern template bool Solve(Vector4<int>&    outX, const Matrix4x4<int>&    mat, const Vector4<int>&    b);
+
+    extern template bool Solve(Vector6<float>&  outX, const Matrix6x6<float>&  mat, const Vector6<float>&  b);
+    extern template bool Solve(Vector6<double>& outX, const Matrix6x6<double>& mat, const Vector6<double>& b);
+    extern template bool Solve(Vector6<int>&    outX, const Matrix6x6<int>&    mat, const Vector6<int>&    b);
+
+    extern template bool Solve(std::span<Vector3<float>>  outX, std::span<const Matrix3x3<float>>  mats, std::span<const Vector3<float>>  b, std::span<bool> ok);
+    extern template bool Solve(std::span<Vector3<double>> outX, std::span<const Matrix3x3<double>> mats, std::span<const Vector3<double>> b, std::span<bool> ok);
+    extern template bool Solve(std::span<Vector3<int>>    outX, std::span<const Matrix3x3<int>>    mats, std::span<const Vector3<int>>    b, std::span<bool> ok);
+
+    extern template bool Solve(std::span<Vector4<float>>  outX, std::span<const Matrix4x4<float>>  mats, std::span<const Vector4<float>>  b, std::span<bool> ok);
+    extern template bool Solve(std::span<Vector4<double>> outX, std::span<const Matrix4x4<double>> mats, std::span<const Vector4<double>> b, std::span<bool> ok);
+    extern template bool Solve(std::span<Vector4<int>>    outX, std::span<const Matrix4x4<int>>    mats, std::span<const Vector4<int>>    b, std::span<bool> ok);
+
+    extern template bool Solve(std::span<Vector6<float>>  outX, std::span<const Matrix6x6<float>>  mats, std::span<const Vector6<float>>  b, std::span<bool> ok);
+    extern template bool Solve(std::span<Vector6<double>> outX, std::span<const Matrix6x6<double>> mats, std::span<const Vector6<double>> b, std::span<bool> ok);
+    extern template bool Solve(std::span<Vector6<int>>    outX, std::span<const Matrix6x6<int>>    mats, std::span<const Vector6<int>>    b, std::span<bool> ok);
+
+    extern template bool SolveCholesky(Vector3<float>&  outX, const Matrix3x3<float>&  mat, const Vector3<float>&  b);
+    extern template bool SolveCholesky(Vector3<double>& outX, const Matrix3x3<double>& mat, const Vector3<double>& b);
+    extern template bool SolveCholesky(Vector3<int>&    outX, const Matrix3x3<int>&    mat, const Vector3<int>&    b);
+
+    extern template bool SolveCholesky(Vector4<float>&  outX, const Matrix4x4<float>&  mat, const Vector4<float>&  b);
+    extern template bool SolveCholesky(Vector4<double>& outX, const Matrix4x4<double>& mat, const Vector4<double>& b);
+    extern template bool SolveCholesky(Vector4<int>&    outX, const Matrix4x4<int>&    mat, const Vector4<int>&    b);
+
+    extern template bool SolveCholesky(Vector6<float>&  outX, const Matrix6x6<float>&  mat, const Vector6<float>&  b);
+    extern template bool SolveCholesky(Vector6<double>& outX, const Matrix6x6<double>& mat, const Vector6<double>& b);
+    extern template bool SolveCholesky(Vector6<int>&    outX, const Matrix6x6<int>&    mat, const Vector6<int>&    b);
+
+    extern template bool SolveCholesky(std::span<Vector3<float>>  outX, std::span<const Matrix3x3<float>>  mats, std::span<const Vector3<float>>  b, std::span<bool> ok);
+    extern template bool SolveCholesky(std::span<Vector3<double>> outX, std::span<const Matrix3x3<double>> mats, std::span<const Vector3<double>> b, std::span<bool> ok);
+    extern template bool SolveCholesky(std::span<Vector3<int>>    outX, std::span<const Matrix3x3<int>>    mats, std::span<const Vector3<int>>    b, std::span<bool> ok);
+
+    extern template bool SolveCholesky(std::span<Vector4<float>>  outX, std::span<const Matrix4x4<float>>  mats, std::span<const Vector4<float>>  b, std::span<bool> ok);
+    extern template bool SolveCholesky(std::span<Vector4<double>> outX, std::span<const Matrix4x4<double>> mats, std::span<const Vector4<double>> b, std::span<bool> ok);
+    extern template bool SolveCholesky(std::span<Vector4<int>>    outX, std::span<const Matrix4x4<int>>    mats, std::span<const Vector4<int>>    b, std::span<bool> ok);
+
+    extern template bool SolveCholesky(std::span<Vector6<float>>  outX, std::span<const Matrix6x6<float>>  mats, std::span<const Vector6<float>>  b, std::span<bool> ok);
+    extern template bool SolveCholesky(std::span<Vector6<double>> outX, std::span<const Matrix6x6<double>> mats, std::span<const Vector6<double>> b, std::span<bool> ok);
+    extern template bool SolveCholesky(std::span<Vector6<int>>    outX, std::span<const Matrix6x6<int>>    mats, std::span<const Vector6<int>>    b, std::span<bool> ok);
+
+    extern template bool SolveLDLT(Vector3<float>&  outX, const Matrix3x3<float>&  mat, const Vector3<float>&  b);
+    extern template bool SolveLDLT(Vector3<double>& outX, const Matrix3x3<double>& mat, const Vector3<double>& b);
+    extern template bool SolveLDLT(Vector3<int>&    outX, const Matrix3x3<int>&    mat, const Vector3<int>&    b);
+
+    extern template bool SolveLDLT(Vector4<float>&  outX, const Matrix4x4<float>&  mat, const Vector4<float>&  b);
+    extern template bool SolveLDLT(Vector4<double>& outX, const Matrix4x4<double>& mat, const Vector4<double>& b);
+    extern template bool SolveLDLT(Vector4<int>&    outX, const Matrix4x4<int>&    mat, const Vector4<int>&    b);
+
+    extern template bool SolveLDLT(Vector6<float>&  outX, const Matrix6x6<float>&  mat, const Vector6<float>&  b);
+    extern template bool SolveLDLT(Vector6<double>& outX, const Matrix6x6<double>& mat, const Vector6<double>& b);
+    extern template bool SolveLDLT(Vector6<int>&    outX, const Matrix6x6<int>&    mat, const Vector6<int>&    b);
+
+    extern template bool SolveLDLT(std::span<Vector3<float>>  outX, std::span<const Matrix3x3<float>>  mats, std::span<const Vector3<float>>  b, std::span<bool> ok);
+    extern template bool SolveLDLT(std::span<Vector3<double>> outX, std::span<const Matrix3x3<double>> mats, std::span<const Vector3<double>> b, std::span<bool> ok);
+    extern template bool SolveLDLT(std::span<Vector3<int>>    outX, std::span<const Matrix3x3<int>>    mats, std::span<const Vector3<int>>    b, std::span<bool> ok);
+
+    extern template bool SolveLDLT(std::span<Vector4<float>>  outX, std::span<const Matrix4x4<float>>  mats, std::span<const Vector4<float>>  b, std::span<bool> ok);
+    extern template bool SolveLDLT(std::span<Vector4<double>> outX, std::span<const Matrix4x4<double>> mats, std::span<const Vector4<double>> b, std::span<bool> ok);
+    extern template bool SolveLDLT(std::span<Vector4<int>>    outX, std::span<const Matrix4x4<int>>    mats, std::span<const Vector4<int>>    b, std::span<bool> ok);
+
+    extern template bool SolveLDLT(std::span<Vector6<float>>  outX, std::span<const Matrix6x6<float>>  mats, std::span<const Vector6<float>>  b, std::span<bool> ok);
+    extern template bool SolveLDLT(std::span<Vector6<double>> outX, std::span<const Matrix6x6<double>> mats, std::span<const Vector6<double>> b, std::span<bool> ok);
+    extern template bool SolveLDLT(std::span<Vector6<int>>    outX, std::span<const Matrix6x6<int>>    mats, std::span<const Vector6<int>>    b, std::span<bool> ok);
+
+
+} /// namespace ETL::Math
@@ -9,12 +9,48 @@
 #include "MathLib/Common/Asserts.h"
 #include "MathLib/Common/Constants.h"
 #include "MathLib/Common/TypeComparisons.h"
+#include "MathLib/Common/Determinism.h"
+#include "MathLib/Common/FastTrig.h"
+#include "MathLib/Common/FrameArena.h"
+#include "MathLib/Common/Instrumentation.h"
 
 /// Math types
 #include "MathLib/Types/Vector2.h"
 #include "MathLib/Types/Vector3.h"
 #include "MathLib/Types/Vector4.h"
+#include "MathLib/Types/VectorN.h"
 #include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/MatrixN.h"
+#include "MathLib/Types/Quaternion.h"
+#include "MathLib/Types/DualQuaternion.h"
+
+/// Geometry
+#include "MathLib/Geometry/Ray.h"
+#include "MathLib/Geometry/Intersection.h"
+#include "MathLib/Geometry/Primitives.h"
+#include "MathLib/Geometry/Overlap.h"
+#include "MathLib/Geometry/SpatialHashGrid.h"
+#include "MathLib/Geometry/Gjk.h"
+
+/// Animation
+#include "MathLib/Animation/Skinning.h"
+#include "MathLib/Animation/Interpolation.h"
+#include "MathLib/Animation/AnimationCurve.h"
+
+/// Linear algebra
+#include "MathLib/LinearAlgebra/Decomposition3x3.h"
+#include "MathLib/LinearAlgebra/AffineDecomposition.h"
+#include "MathLib/LinearAlgebra/LinearSolve.h"
+
+/// Compression
+#include "MathLib/Compression/PackedTypes.h"
+
+/// Serialization
+#include "MathLib/Serialization/TransformArchive.h"
+
+/// Graphics
+#include "MathLib/Graphics/GpuExport.h"
 
 
 /// Constants
@@ -0,0 +1,222 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// TransformArchive.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/Vector3.h"
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ETL::Math
+{
+    /// Binary archive of named Matrix4x4/Vector3 arrays (baked instance transforms, bind poses...).
+    ///
+    /// File layout, version 1 (all fields in the byte order given by the header tag):
+    ///     ArchiveHeader        32 bytes   magic "ETLMARCH", endian tag, version, section count, file size
+    ///     section table        80 bytes per section: name, element, scalar, count, offset, byte size
+    ///     payloads             raw element storage, each one starting on a 64 byte boundary
+    ///
+    /// Payloads are the in-memory representation of the elements (Matrix4x4 is column-major,
+    /// fixed point is raw 16.16), so a reader on a machine with the same byte order maps the file
+    /// and returns spans pointing straight into the mapping: opening an archive costs one mmap
+    /// (MapViewOfFile on Windows) and a table validation, pages are loaded on first access.
+    /// An archive written with the other byte order is still readable, it is then copied and
+    /// byte swapped once at open.
+
+    /// Stored element kind
+    enum class ArchiveElement : std::uint32_t
+    {
+        Matrix4x4 = 1,
+        Vector3   = 2
+    };
+
+    /// Stored scalar kind
+    enum class ArchiveScalar : std::uint32_t
+    {
+        Float32    = 1,
+        Float64    = 2,
+        Fixed16_16 = 3 /// int storage of Matrix4x4<int>/Vector3<int>
+    };
+
+    /// Result of archive reads and writes
+    enum class ArchiveStatus
+    {
+        Ok,
+        FileError,          /// Cannot open/map/write the file
+        InvalidFormat,      /// Not an archive (magic or endian tag mismatch)
+        UnsupportedVersion, /// Written by a newer version of the format
+        Corrupted           /// Truncated file or inconsistent section table
+    };
+
+    /// Format constants
+    constexpr std::uint16_t ARCHIVE_VERSION = 1;
+    constexpr std::size_t   ARCHIVE_ALIGNMENT = 64;
+    constexpr std::size_t   ARCHIVE_MAX_NAME_LENGTH = 47; /// Names are stored in 48 bytes, zero terminated
+
+    /// Description of one section of an opened archive
+    struct ArchiveSection
+    {
+        std::string    name;
+        ArchiveElement element = ArchiveElement::Matrix4x4;
+        ArchiveScalar  scalar = ArchiveScalar::Float32;
+        std::size_t    count = 0;
+        std::size_t    offset = 0; /// Payload position in the file
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        template<typename Type>
+        constexpr ArchiveScalar ArchiveScalarOf()
+        {
+            if constexpr (std::same_as<Type, float>)
+                return ArchiveScalar::Float32;
+            else if constexpr (std::same_as<Type, double>)
+                return ArchiveScalar::Float64;
+            else
+            {
+                static_assert(std::same_as<Type, int>, "Archives store float, double and 16.16 fixed point (int) elements");
+                return ArchiveScalar::Fixed16_16;
+            }
+        }
+
+        /// Payloads are reinterpreted in place, the element types must be plain arrays of scalars
+        template<typename Element, typename Type, int SCALAR_COUNT>
+        constexpr bool IsArchivable = std::is_trivially_copyable_v<Element> && std::is_standard_layout_v<Element>
+                                   && sizeof(Element) == SCALAR_COUNT * sizeof(Type) && alignof(Element) <= ARCHIVE_ALIGNMENT;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Writer
+
+    /// Collects sections then writes them in one pass. Sections reference the caller's data
+    /// (no copy), the spans must stay valid until write() returns.
+    class TransformArchiveWriter
+    {
+    public:
+
+        /// Add a named section, names must be unique and at most ARCHIVE_MAX_NAME_LENGTH characters
+        template<typename Type>
+        void addMatrices(std::string_view name, std::span<const Matrix4x4<Type>> matrices);
+        template<typename Type>
+        void addVectors(std::string_view name, std::span<const Vector3<Type>> vectors);
+
+        /// Write the archive, in native byte order by default (or for a target of the other order)
+        ArchiveStatus write(const std::filesystem::path& path, std::endian byteOrder = std::endian::native) const;
+
+        /// Access methods
+        int  getSectionCount() const { return static_cast<int>(mSections.size()); }
+        void clear() { mSections.clear(); }
+
+    private:
+        struct PendingSection
+        {
+            std::string      name;
+            ArchiveElement   element;
+            ArchiveScalar    scalar;
+            std::size_t      count;
+            const std::byte* data;
+        };
+
+        void addSection(std::string_view name, ArchiveElement element, ArchiveScalar scalar, std::size_t count, const void* data);
+
+        std::vector<PendingSection> mSections;
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Reader
+
+    /// Memory-mapped, read-only archive. Spans returned by getMatrices/getVectors stay valid until
+    /// the archive is closed, reopened or destroyed. Move-only.
+    class TransformArchive
+    {
+    public:
+
+        /// Constructors
+        TransformArchive() = default;
+        TransformArchive(const TransformArchive&) = delete;
+        TransformArchive(TransformArchive&& other) noexcept;
+        TransformArchive& operator=(const TransformArchive&) = delete;
+        TransformArchive& operator=(TransformArchive&& other) noexcept;
+        ~TransformArchive();
+
+        /// Map 'path' (closes the current archive first). On failure the archive is left closed.
+        ArchiveStatus open(const std::filesystem::path& path);
+        void          close();
+
+        /// Access methods
+        bool isOpen() const   { return mData != nullptr; }
+        bool isMapped() const { return mMappedSize != 0; } /// False when the payload had to be byte swapped into memory
+        int  getSectionCount() const { return static_cast<int>(mSections.size()); }
+        const ArchiveSection& getSection(int index) const;
+
+        /// Index of the section called 'name', -1 when absent
+        int findSection(std::string_view name) const;
+
+        /// Zero-copy view of a section, empty when absent or stored with another element/scalar kind
+        template<typename Type>
+        std::span<const Matrix4x4<Type>> getMatrices(std::string_view name) const;
+        template<typename Type>
+        std::span<const Vector3<Type>> getVectors(std::string_view name) const;
+
+    private:
+        const std::byte* findPayload(std::string_view name, ArchiveElement element, ArchiveScalar scalar, std::size_t& outCount) const;
+
+        const std::byte*            mData = nullptr;    /// Start of the file (mapping or swapped copy)
+        std::size_t                 mMappedSize = 0;    /// Mapping length, 0 when mData points into mSwapped
+        std::vector<std::byte>      mSwapped;
+        std::vector<ArchiveSection> mSections;
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Template members
+
+    template<typename Type>
+    void TransformArchiveWriter::addMatrices(std::string_view name, std::span<const Matrix4x4<Type>> matrices)
+    {
+        static_assert(helpers::IsArchivable<Matrix4x4<Type>, Type, 16>);
+        addSection(name, ArchiveElement::Matrix4x4, helpers::ArchiveScalarOf<Type>(), matrices.size(), matrices.data());
+    }
+
+    template<typename Type>
+    void TransformArchiveWriter::addVectors(std::string_view name, std::span<const Vector3<Type>> vectors)
+    {
+        static_assert(helpers::IsArchivable<Vector3<Type>, Type, 3>);
+        addSection(name, ArchiveElement::Vector3, helpers::ArchiveScalarOf<Type>(), vectors.size(), vectors.data());
+    }
+
+    template<typename Type>
+    std::span<const Matrix4x4<Type>> TransformArchive::getMatrices(std::string_view name) const
+    {
+        static_assert(helpers::IsArchivable<Matrix4x4<Type>, Type, 16>);
+        std::size_t count = 0;
+        const std::byte* payload = findPayload(name, ArchiveElement::Matrix4x4, helpers::ArchiveScalarOf<Type>(), count);
+        return { reinterpret_cast<const Matrix4x4<Type>*>(payload), count };
+    }
+
+    template<typename Type>
+    std::span<const Vector3<Type>> TransformArchive::getVectors(std::string_view name) const
+    {
+        static_assert(helpers::IsArchivable<Vector3<Type>, Type, 3>);
+        std::size_t count = 0;
+        const std::byte* payload = findPayload(name, ArchiveElement::Vector3, helpers::ArchiveScalarOf<Type>(), count);
+        return { reinterpret_cast<const Vector3<Type>*>(payload), count };
+    }
+
+} /// namespace ETL::Math
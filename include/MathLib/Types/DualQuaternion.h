@@ -0,0 +1,165 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// DualQuaternion.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Types/Quaternion.h"
+
+namespace ETL::Math
+{
+    /// Rigid transform (rotation + translation) as real + eps * dual quaternion.
+    /// Unit dual quaternions have |real| = 1 and dot(real, dual) = 0, with
+    /// dual = 0.5 * (t, 0) * real. Products compose like matrices:
+    /// (dq1 * dq2) applies dq2 first, then dq1.
+    /// When using DualQuaternion<int> integral types, both parts are stored
+    /// in 16.16 fixed-point format (see Quaternion).
+
+    template<typename Type>
+    class DualQuaternion
+    {
+    public:
+
+        /// Static Factories
+        static constexpr DualQuaternion Identity() { return DualQuaternion{ Quaternion<Type>::Identity(), Quaternion<Type>{ Type(0), Type(0), Type(0), Type(0) } }; }
+        static DualQuaternion CreateFromRotationTranslation(const Quaternion<Type>& rotation, const Vector3<Type>& translation);
+        static DualQuaternion CreateTranslation(const Vector3<Type>& translation);
+        static DualQuaternion CreateFromMatrix(const Matrix4x4<Type>& mat);
+
+        /// Constructors
+        constexpr DualQuaternion() = default;
+        constexpr DualQuaternion(const Quaternion<Type>& real, const Quaternion<Type>& dual);
+
+        /// Copy, Move & Destructor (default)
+        DualQuaternion(const DualQuaternion&) = default;
+        DualQuaternion(DualQuaternion&&) noexcept = default;
+        DualQuaternion& operator=(const DualQuaternion&) = default;
+        DualQuaternion& operator=(DualQuaternion&&) noexcept = default;
+        ~DualQuaternion() = default;
+
+        /// Access methods
+        const Quaternion<Type>& getReal() const { return mReal; }
+        const Quaternion<Type>& getDual() const { return mDual; }
+        void setReal(const Quaternion<Type>& real) { mReal = real; }
+        void setDual(const Quaternion<Type>& dual) { mDual = dual; }
+
+        Quaternion<Type> getRotation() const;
+        Vector3<Type>    getTranslation() const;
+        void             getTranslationTo(Vector3<Type>& outTranslation) const;
+
+        /// Operators
+        DualQuaternion  operator+(const DualQuaternion& other) const;
+        DualQuaternion  operator*(const DualQuaternion& other) const;
+        DualQuaternion  operator*(Type scalar) const;
+        DualQuaternion& operator+=(const DualQuaternion& other);
+        DualQuaternion& operator*=(const DualQuaternion& other);
+        bool            operator==(const DualQuaternion& other) const;
+        bool            operator!=(const DualQuaternion& other) const;
+
+        /// Dual quaternion methods
+        DualQuaternion  normalize() const;
+        DualQuaternion& makeNormalize();
+        DualQuaternion  inverse() const;
+        DualQuaternion& makeInverse();
+
+        /// Vector Transformations (dual quaternion must be unit)
+        Vector3<Type> transformPoint(const Vector3<Type>& point) const;
+        void          transformPointTo(Vector3<Type>& outResult, const Vector3<Type>& inPoint) const;
+        Vector3<Type> transformDirection(const Vector3<Type>& direction) const;
+        void          transformDirectionTo(Vector3<Type>& outResult, const Vector3<Type>& inDirection) const;
+
+        /// Conversions
+        Matrix4x4<Type> toMatrix() const;
+        void            toMatrixTo(Matrix4x4<Type>& outResult) const;
+
+    private:
+        Quaternion<Type> mReal;
+        Quaternion<Type> mDual;
+    };
+
+
+    /// Helpful aliases
+    using DualQuat = DualQuaternion<float>;
+    using DualQuatd = DualQuaternion<double>;
+    using DualQuati = DualQuaternion<int>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers (also present as class member functions.
+
+    /// dq1 * dq2 = (r1 * r2, r1 * d2 + d1 * r2)
+    template<typename Type>
+    void Multiply(DualQuaternion<Type>& outResult, const DualQuaternion<Type>& dq1, const DualQuaternion<Type>& dq2);
+
+    /// Normalize: unit real part and dual part orthogonal to it
+    template<typename Type>
+    bool Normalize(DualQuaternion<Type>& outResult, const DualQuaternion<Type>& dq);
+
+    /// Inverse: (r^-1, -r^-1 * d * r^-1)
+    template<typename Type>
+    bool Inverse(DualQuaternion<Type>& outResult, const DualQuaternion<Type>& dq);
+
+    /// Translation encoded by a unit dual quaternion: 2 * dual * conjugate(real)
+    template<typename Type>
+    void GetTranslation(Vector3<Type>& outResult, const DualQuaternion<Type>& dq);
+
+    /// Rotate then translate a point
+    template<typename Type>
+    void TransformPoint(Vector3<Type>& outResult, const DualQuaternion<Type>& dq, const Vector3<Type>& point);
+
+    /// Rotate a direction (translation ignored)
+    template<typename Type>
+    void TransformDirection(Vector3<Type>& outResult, const DualQuaternion<Type>& dq, const Vector3<Type>& direction);
+
+    /// Rigid matrix from unit dual quaternion
+    template<typename Type>
+    void ToMatrix(Matrix4x4<Type>& outResult, const DualQuaternion<Type>& dq);
+
+    /// Unit dual quaternion from a rigid matrix (upper 3x3 must be orthonormal)
+    template<typename Type>
+    void FromMatrix(DualQuaternion<Type>& outResult, const Matrix4x4<Type>& mat);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class DualQuaternion<float>;
+    extern template class DualQuaternion<double>;
+    extern template class DualQuaternion<int>;
+
+    extern template void Multiply(DualQuaternion<float>&  outResult, const DualQuaternion<float>&  dq1, const DualQuaternion<float>&  dq2);
+    extern template void Multiply(DualQuaternion<double>& outResult, const DualQuaternion<double>& dq1, const DualQuaternion<double>& dq2);
+    extern template void Multiply(DualQuaternion<int>&    outResult, const DualQuaternion<int>&    dq1, const DualQuaternion<int>&    dq2);
+
+    extern template bool Normalize(DualQuaternion<float>&  outResult, const DualQuaternion<float>&  dq);
+    extern template bool Normalize(DualQuaternion<double>& outResult, const DualQuaternion<double>& dq);
+    extern template bool Normalize(DualQuaternion<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    extern template bool Inverse(DualQuaternion<float>&  outResult, const DualQuaternion<float>&  dq);
+    extern template bool Inverse(DualQuaternion<double>& outResult, const DualQuaternion<double>& dq);
+    extern template bool Inverse(DualQuaternion<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    extern template void GetTranslation(Vector3<float>&  outResult, const DualQuaternion<float>&  dq);
+    extern template void GetTranslation(Vector3<double>& outResult, const DualQuaternion<double>& dq);
+    extern template void GetTranslation(Vector3<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    extern template void TransformPoint(Vector3<float>&  outResult, const DualQuaternion<float>&  dq, const Vector3<float>&  point);
+    extern template void TransformPoint(Vector3<double>& outResult, const DualQuaternion<double>& dq, const Vector3<double>& point);
+    extern template void TransformPoint(Vector3<int>&    outResult, const DualQuaternion<int>&    dq, const Vector3<int>&    point);
+
+    extern template void TransformDirection(Vector3<float>&  outResult, const DualQuaternion<float>&  dq, const Vector3<float>&  direction);
+    extern template void TransformDirection(Vector3<double>& outResult, const DualQuaternion<double>& dq, const Vector3<double>& direction);
+    extern template void TransformDirection(Vector3<int>&    outResult, const DualQuaternion<int>&    dq, const Vector3<int>&    direction);
+
+    extern template void ToMatrix(Matrix4x4<float>&  outResult, const DualQuaternion<float>&  dq);
+    extern template void ToMatrix(Matrix4x4<double>& outResult, const DualQuaternion<double>& dq);
+    extern template void ToMatrix(Matrix4x4<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    extern template void FromMatrix(DualQuaternion<float>&  outResult, const Matrix4x4<float>&  mat);
+    extern template void FromMatrix(DualQuaternion<double>& outResult, const Matrix4x4<double>& mat);
+    extern template void FromMatrix(DualQuaternion<int>&    outResult, const Matrix4x4<int>&    mat);
+
+
+} /// namespace ETL::Math
+
+#include "inline/DualQuaternion.inl"
@@ -5,7 +5,9 @@
 #pragma once
 
 #include "MathLib/Common/ElementProxy.h"
+#include "MathLib/Common/FastTrig.h"
 #include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/MatrixCore.h"
 #include "MathLib/Types/Vector3.h"
 #include "MathLib/Types/Vector2.h"
 
@@ -29,9 +31,9 @@ namespace ETL::Math
         /// Static 2D Transform Factories
         static constexpr Matrix3x3 Zero() { return Matrix3x3{ Type(0) }; }
         static constexpr Matrix3x3 Identity() { return Matrix3x3{ Type(1) }; }
-        static Matrix3x3 CreateScale(double sX, double sY);
-        static Matrix3x3 CreateRotation(double angleRad);
-        static Matrix3x3 CreateTranslation(Type tX, Type tY);
+        static constexpr Matrix3x3 CreateScale(double sX, double sY);
+        static constexpr Matrix3x3 CreateRotation(double angleRad, TrigPrecision precision = TrigPrecision::Precise);
+        static constexpr Matrix3x3 CreateTranslation(Type tX, Type tY);
 
         /// Constructors
         constexpr Matrix3x3() = default;
@@ -55,81 +57,88 @@ namespace ETL::Math
         ~Matrix3x3() = default;
 
         /// Access methods
-        Type               operator()(int row, int col) const;
-        ElementProxy<Type> operator()(int row, int col);
-        Type               operator[](int index) const;
-        ElementProxy<Type> operator[](int index);
+        constexpr Type               operator()(int row, int col) const;
+        constexpr ElementProxy<Type> operator()(int row, int col);
+        constexpr Type               operator[](int index) const;
+        constexpr ElementProxy<Type> operator[](int index);
 
-        Vector3<Type> getCol(int colIndex) const;
-        Vector3<Type> getRow(int rowIndex) const;
-        void getColTo(Vector3<Type>& outCol, int colIndex) const;
-        void getRowTo(Vector3<Type>& outRow, int rowIndex) const;
+        constexpr Vector3<Type> getCol(int colIndex) const;
+        constexpr Vector3<Type> getRow(int rowIndex) const;
+        constexpr void getColTo(Vector3<Type>& outCol, int colIndex) const;
+        constexpr void getRowTo(Vector3<Type>& outRow, int rowIndex) const;
 
-        void setCol(int col, const Vector3<Type>& value);
-        void setRow(int row, const Vector3<Type>& value);
-        void setCol(int col, Type c0, Type c1, Type c2);
-        void setRow(int row, Type r0, Type r1, Type r2);
+        constexpr void setCol(int col, const Vector3<Type>& value);
+        constexpr void setRow(int row, const Vector3<Type>& value);
+        constexpr void setCol(int col, Type c0, Type c1, Type c2);
+        constexpr void setRow(int row, Type r0, Type r1, Type r2);
 
         /// Operators
-        Matrix3x3     operator+(const Matrix3x3& other) const;
-        Matrix3x3     operator-(const Matrix3x3& other) const;
-        Matrix3x3     operator*(const Matrix3x3& other) const;
-        Vector3<Type> operator*(const Vector3<Type>& vector) const;
-        Matrix3x3     operator*(Type scalar) const;
-        Matrix3x3     operator/(Type scalar) const;
-        Matrix3x3&    operator+=(const Matrix3x3& other);
-        Matrix3x3&    operator-=(const Matrix3x3& other);
-        Matrix3x3&    operator*=(const Matrix3x3& other);
-        Matrix3x3&    operator*=(Type scalar);
-        Matrix3x3&    operator/=(Type scalar);
-        bool          operator==(const Matrix3x3& other) const;
-        bool          operator!=(const Matrix3x3& other) const;
+        constexpr Matrix3x3     operator+(const Matrix3x3& other) const;
+        constexpr Matrix3x3     operator-(const Matrix3x3& other) const;
+        constexpr Matrix3x3     operator*(const Matrix3x3& other) const;
+        constexpr Vector3<Type> operator*(const Vector3<Type>& vector) const;
+        constexpr Matrix3x3     operator*(Type scalar) const;
+        constexpr Matrix3x3     operator/(Type scalar) const;
+        constexpr Matrix3x3&    operator+=(const Matrix3x3& other);
+        constexpr Matrix3x3&    operator-=(const Matrix3x3& other);
+        constexpr Matrix3x3&    operator*=(const Matrix3x3& other);
+        constexpr Matrix3x3&    operator*=(Type scalar);
+        constexpr Matrix3x3&    operator/=(Type scalar);
+        constexpr bool          operator==(const Matrix3x3& other) const;
+        constexpr bool          operator!=(const Matrix3x3& other) const;
 
         /// 2D Vector Transformations
-        Vector2<Type> transformPoint(const Vector2<Type>& point) const;
-        void          transformPointTo(Vector2<Type>& outResult, const Vector2<Type>& inPoint) const;
-        void          transformPointInPlace(Vector2<Type>& inOutPoint) const;
-        Vector2<Type> transformDirection(const Vector2<Type>& direction) const;
-        void          transformDirectionTo(Vector2<Type>& outResult, const Vector2<Type>& inDirection) const;
-        void          transformDirectionInPlace(Vector2<Type>& inOutDirection) const;
+        constexpr Vector2<Type> transformPoint(const Vector2<Type>& point) const;
+        constexpr void          transformPointTo(Vector2<Type>& outResult, const Vector2<Type>& inPoint) const;
+        constexpr void          transformPointInPlace(Vector2<Type>& inOutPoint) const;
+        constexpr Vector2<Type> transformDirection(const Vector2<Type>& direction) const;
+        constexpr void          transformDirectionTo(Vector2<Type>& outResult, const Vector2<Type>& inDirection) const;
+        constexpr void          transformDirectionInPlace(Vector2<Type>& inOutDirection) const;
 
         /// 2D Transformation modifiers (post multiply: this *= other)
-        Matrix3x3&    scale(double sX, double sY);
-        Matrix3x3&    scale(const Vector2<double>& scale);
+        constexpr Matrix3x3&    scale(double sX, double sY);
+        constexpr Matrix3x3&    scale(const Vector2<double>& scale);
         Matrix3x3&    rotate(double angleRad);
-        Matrix3x3&    translate(Type tX, Type tY);
-        Matrix3x3&    translate(const Vector2<Type>& translation);
+        constexpr Matrix3x3&    translate(Type tX, Type tY);
+        constexpr Matrix3x3&    translate(const Vector2<Type>& translation);
 
         /// 2D Transformation setters (override current, leaving rest untouched)
         Matrix3x3&    setScale(double newSX, double newSY);
         Matrix3x3&    setScale(const Vector2<double>& newScale);
-        Matrix3x3&    setRotation(double newAngleRad);
-        Matrix3x3&    setTranslation(Type newTX, Type newTY);
-        Matrix3x3&    setTranslation(const Vector2<Type>& newTranslation);
+        Matrix3x3&    setRotation(double newAngleRad, TrigPrecision precision = TrigPrecision::Precise);
+        constexpr Matrix3x3&    setTranslation(Type newTX, Type newTY);
+        constexpr Matrix3x3&    setTranslation(const Vector2<Type>& newTranslation);
 
         /// 2D Transformations Decomposition
         Vector2<double> getScale() const;
         void            getScaleTo(Vector2<double>& outScale) const;
         double          getRotation() const;
         void            getRotationTo(double& outAngleRad) const;
-        Vector2<Type>   getTranslation() const;
-        void            getTranslationTo(Vector2<Type>& outTranslation) const;
+        constexpr Vector2<Type>   getTranslation() const;
+        constexpr void            getTranslationTo(Vector2<Type>& outTranslation) const;
 
         /// Matrix methods
-        Type       determinant(bool bFixedPoint = false) const;
-        void       determinantTo(Type& outResult, bool bFixedPoint = false) const;
-        Matrix3x3  transpose() const;
-        void       transposeTo(Matrix3x3& outResult) const;
+        constexpr Type       determinant(bool bFixedPoint = false) const;
+        constexpr void       determinantTo(Type& outResult, bool bFixedPoint = false) const;
+        constexpr Matrix3x3  transpose() const;
+        constexpr void       transposeTo(Matrix3x3& outResult) const;
         Matrix3x3& makeTranspose();
-        Matrix3x3  inverse() const;
-        void       inverseTo(Matrix3x3& outResult) const;
-        Matrix3x3& makeInverse();
+        constexpr Matrix3x3  inverse() const;
+        constexpr void       inverseTo(Matrix3x3& outResult) const;
+        constexpr Matrix3x3& makeInverse();
 
         /// Direct access to internal storage - no conversions applied (use with caution for integral types)
-        Type getRawValue(int row, int col) const;
-        Type getRawValue(int elem) const;
-        void setRawValue(int row, int col, Type value);
-        void setRawValue(int elem, Type value);
+        constexpr Type getRawValue(int row, int col) const;
+        constexpr Type getRawValue(int elem) const;
+        constexpr void setRawValue(int row, int col, Type value);
+        constexpr void setRawValue(int elem, Type value);
+
+        /// Unchecked raw access for hot loops - no bounds asserts, no conversions applied.
+        /// Columns are contiguous (column-major storage), rows are gathered.
+        constexpr const Type* getRawCol(int col) const;
+        constexpr Type*       getRawCol(int col);
+        constexpr void        getRawRowTo(Type* outRow, int row) const;
+        constexpr Type        getRawValueUnchecked(int row, int col) const;
 
     protected:
         const Type* const getRawData() const { return mData; }
@@ -138,7 +147,7 @@ namespace ETL::Math
         union {
             struct { Type m00, m10, m20, m01, m11, m21, m02, m12, m22; }; /// Named access
             Type m[3][3];                                                 /// 2D access [COL][ROW]
-            Type mData[9];                                                /// 1D access
+            Type mData[9];                                                /// 1D access (only member used by constexpr code)
         };
     };
 
@@ -162,47 +171,47 @@ namespace ETL::Math
 
     /// Matrix * vector
     template<typename Type>
-    void Multiply(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector3<Type>& vec);
+    constexpr void Multiply(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector3<Type>& vec);
 
     /// Matrix1 * Matrix2
     template<typename Type>
-    void Multiply(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& m1, const Matrix3x3<Type>& m2);
+    constexpr void Multiply(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& m1, const Matrix3x3<Type>& m2);
 
     /// GetCol
     template<typename Type>
-    void GetCol(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index);
+    constexpr void GetCol(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index);
 
     /// GetRow
     template<typename Type>
-    void GetRow(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index);
+    constexpr void GetRow(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index);
 
     /// SetCol
     template<typename Type>
-    void SetCol(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& col);
+    constexpr void SetCol(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& col);
 
     /// SetRow
     template<typename Type>
-    void SetRow(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& row);
+    constexpr void SetRow(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& row);
 
     /// TransformPoint
     template<typename Type>
-    void TransformPoint(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& point);
+    constexpr void TransformPoint(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& point);
 
     /// TransformDirection
     template<typename Type>
-    void TransformDirection(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& direction);
+    constexpr void TransformDirection(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& direction);
 
     /// Translate
     template<typename Type>
-    void Translate(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation);
+    constexpr void Translate(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation);
 
     /// SetTranslation
     template<typename Type>
-    void SetTranslation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation);
+    constexpr void SetTranslation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation);
 
     /// GetTranslation
     template<typename Type>
-    void GetTranslation(Vector2<Type>& outResult, const Matrix3x3<Type>& mat);
+    constexpr void GetTranslation(Vector2<Type>& outResult, const Matrix3x3<Type>& mat);
 
     /// Rotate
     template<typename Type>
@@ -210,7 +219,7 @@ namespace ETL::Math
 
     /// SetRotation
     template<typename Type>
-    void SetRotation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, double angleRad);
+    void SetRotation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, double angleRad, TrigPrecision precision = TrigPrecision::Precise);
 
     /// SetRotation
     template<typename Type>
@@ -218,7 +227,7 @@ namespace ETL::Math
 
     /// Scale
     template<typename Type>
-    void Scale(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<double>& scale);
+    constexpr void Scale(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<double>& scale);
 
     /// SetScaling
     template<typename Type>
@@ -230,19 +239,19 @@ namespace ETL::Math
 
     /// Determinant
     template<typename Type>
-    void Determinant(Type& outResult, const Matrix3x3<Type>& mat, bool bFixedPoint = false);
+    constexpr void Determinant(Type& outResult, const Matrix3x3<Type>& mat, bool bFixedPoint = false);
 
     /// Inverse
     template<typename Type>
-    bool Inverse(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat);
+    constexpr bool Inverse(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat);
 
     /// Transpose
     template<typename Type>
-    void Transpose(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat);
+    constexpr void Transpose(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat);
 
     /// Scalar * matrix operator (completeness product commutative)
     template<typename Type>
-    Matrix3x3<Type> operator*(Type scalar, const Matrix3x3<Type>& matrix);
+    constexpr Matrix3x3<Type> operator*(Type scalar, const Matrix3x3<Type>& matrix);
 
 
     ///------------------------------------------------------------------------------------------
@@ -300,9 +309,9 @@ namespace ETL::Math
     extern template void Rotate(Matrix3x3<double>& outResult, const Matrix3x3<double>& mat, double angleRad);
     extern template void Rotate(Matrix3x3<int>&    outResult, const Matrix3x3<int>&    mat, double angleRad);
 
-    extern template void SetRotation(Matrix3x3<float>&  outResult, const Matrix3x3<float>&  mat, double angleRad);
-    extern template void SetRotation(Matrix3x3<double>& outResult, const Matrix3x3<double>& mat, double angleRad);
-    extern template void SetRotation(Matrix3x3<int>&    outResult, const Matrix3x3<int>&    mat, double angleRad);
+    extern template void SetRotation(Matrix3x3<float>&  outResult, const Matrix3x3<float>&  mat, double angleRad, TrigPrecision precision);
+    extern template void SetRotation(Matrix3x3<double>& outResult, const Matrix3x3<double>& mat, double angleRad, TrigPrecision precision);
+    extern template void SetRotation(Matrix3x3<int>&    outResult, const Matrix3x3<int>&    mat, double angleRad, TrigPrecision precision);
 
     extern template void GetRotation(double& outResult, const Matrix3x3<float>&  mat);
     extern template void GetRotation(double& outResult, const Matrix3x3<double>& mat);
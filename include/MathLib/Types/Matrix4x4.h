@@ -5,12 +5,24 @@
 #pragma once
 
 #include "MathLib/Common/ElementProxy.h"
+#include "MathLib/Common/FastTrig.h"
 #include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Types/MatrixCore.h"
 #include "MathLib/Types/Vector4.h"
+#include <span>
 
 namespace ETL::Math
 {
 
+    /// Clip-space depth convention used by the projection factories
+    enum class DepthRange
+    {
+        NegativeOneToOne,   /// OpenGL: near -> -1, far -> 1
+        ZeroToOne,          /// Direct3D / Vulkan / Metal: near -> 0, far -> 1
+        ReversedZ           /// Reversed zero-to-one: near -> 1, far -> 0 (best depth precision with float buffers)
+    };
+
     /// When using Matrix4x4<int> integral types, values are stored
     /// internally in 16.16 fixed-point format (FIXED_SHIFT = 16).
     /// Normal accessors like operator[] and operator() automatically 
@@ -28,9 +40,16 @@ namespace ETL::Math
         /// Static 2D Transform Factories
         static constexpr Matrix4x4 Zero() { return Matrix4x4{ Type(0) }; }
         static constexpr Matrix4x4 Identity() { return Matrix4x4{ Type(1) }; }
-        static Matrix4x4 CreateScale(double sX, double sY, double sZ);
-        static Matrix4x4 CreateRotation(double rX, double rY, double rZ);
-        static Matrix4x4 CreateTranslation(Type tX, Type tY, Type tZ);
+        static constexpr Matrix4x4 CreateScale(double sX, double sY, double sZ);
+        static constexpr Matrix4x4 CreateRotation(double rX, double rY, double rZ, TrigPrecision precision = TrigPrecision::Precise);
+        static constexpr Matrix4x4 CreateTranslation(Type tX, Type tY, Type tZ);
+
+        /// Static 3D Projection & View Factories (right-handed, view space looks down -Z)
+        static Matrix4x4 CreatePerspective(double fovY, double aspect, double zNear, double zFar, DepthRange depth = DepthRange::NegativeOneToOne);
+        static Matrix4x4 CreatePerspectiveInfinite(double fovY, double aspect, double zNear, DepthRange depth = DepthRange::NegativeOneToOne);
+        static Matrix4x4 CreateOrthographic(double left, double right, double bottom, double top, double zNear, double zFar,
+                                            DepthRange depth = DepthRange::NegativeOneToOne);
+        static Matrix4x4 CreateLookAt(const Vector3<Type>& eye, const Vector3<Type>& target, const Vector3<Type>& up);
 
         /// Constructors
         constexpr Matrix4x4() = default;
@@ -53,83 +72,90 @@ namespace ETL::Math
         ~Matrix4x4() = default;
 
         /// Access methods
-        Type               operator()(int row, int col) const;
-        ElementProxy<Type> operator()(int row, int col);
-        Type               operator[](int index) const;
-        ElementProxy<Type> operator[](int index);
+        constexpr Type               operator()(int row, int col) const;
+        constexpr ElementProxy<Type> operator()(int row, int col);
+        constexpr Type               operator[](int index) const;
+        constexpr ElementProxy<Type> operator[](int index);
 
-        Vector4<Type> getCol(int colIndex) const;
-        Vector4<Type> getRow(int rowIndex) const;
-        void getColTo(Vector4<Type>& outCol, int colIndex) const;
-        void getRowTo(Vector4<Type>& outRow, int rowIndex) const;
+        constexpr Vector4<Type> getCol(int colIndex) const;
+        constexpr Vector4<Type> getRow(int rowIndex) const;
+        constexpr void getColTo(Vector4<Type>& outCol, int colIndex) const;
+        constexpr void getRowTo(Vector4<Type>& outRow, int rowIndex) const;
 
-        void setCol(int col, const Vector4<Type>& value);
-        void setRow(int row, const Vector4<Type>& value);
-        void setCol(int col, Type c0, Type c1, Type c2, Type c3);
-        void setRow(int row, Type r0, Type r1, Type r2, Type r3);
+        constexpr void setCol(int col, const Vector4<Type>& value);
+        constexpr void setRow(int row, const Vector4<Type>& value);
+        constexpr void setCol(int col, Type c0, Type c1, Type c2, Type c3);
+        constexpr void setRow(int row, Type r0, Type r1, Type r2, Type r3);
 
         /// Operators
-        Matrix4x4     operator+(const Matrix4x4& other) const;
-        Matrix4x4     operator-(const Matrix4x4& other) const;
-        Matrix4x4     operator*(const Matrix4x4& other) const;
-        Vector4<Type> operator*(const Vector4<Type>& vector) const;
-        Matrix4x4     operator*(Type scalar) const;
-        Matrix4x4     operator/(Type scalar) const;
-        Matrix4x4&    operator+=(const Matrix4x4& other);
-        Matrix4x4&    operator-=(const Matrix4x4& other);
-        Matrix4x4&    operator*=(const Matrix4x4& other);
-        Matrix4x4&    operator*=(Type scalar);
-        Matrix4x4&    operator/=(Type scalar);
-        bool          operator==(const Matrix4x4& other) const;
-        bool          operator!=(const Matrix4x4& other) const;
+        constexpr Matrix4x4     operator+(const Matrix4x4& other) const;
+        constexpr Matrix4x4     operator-(const Matrix4x4& other) const;
+        constexpr Matrix4x4     operator*(const Matrix4x4& other) const;
+        constexpr Vector4<Type> operator*(const Vector4<Type>& vector) const;
+        constexpr Matrix4x4     operator*(Type scalar) const;
+        constexpr Matrix4x4     operator/(Type scalar) const;
+        constexpr Matrix4x4&    operator+=(const Matrix4x4& other);
+        constexpr Matrix4x4&    operator-=(const Matrix4x4& other);
+        constexpr Matrix4x4&    operator*=(const Matrix4x4& other);
+        constexpr Matrix4x4&    operator*=(Type scalar);
+        constexpr Matrix4x4&    operator/=(Type scalar);
+        constexpr bool          operator==(const Matrix4x4& other) const;
+        constexpr bool          operator!=(const Matrix4x4& other) const;
 
         /// 2D Vector Transformations
-        Vector3<Type> transformPoint(const Vector3<Type>& point) const;
-        void          transformPointTo(Vector3<Type>& outResult, const Vector3<Type>& inPoint) const;
-        void          transformPointInPlace(Vector3<Type>& inOutPoint) const;
-        Vector3<Type> transformDirection(const Vector3<Type>& direction) const;
-        void          transformDirectionTo(Vector3<Type>& outResult, const Vector3<Type>& inDirection) const;
-        void          transformDirectionInPlace(Vector3<Type>& inOutDirection) const;
+        constexpr Vector3<Type> transformPoint(const Vector3<Type>& point) const;
+        constexpr void          transformPointTo(Vector3<Type>& outResult, const Vector3<Type>& inPoint) const;
+        constexpr void          transformPointInPlace(Vector3<Type>& inOutPoint) const;
+        constexpr Vector3<Type> transformDirection(const Vector3<Type>& direction) const;
+        constexpr void          transformDirectionTo(Vector3<Type>& outResult, const Vector3<Type>& inDirection) const;
+        constexpr void          transformDirectionInPlace(Vector3<Type>& inOutDirection) const;
 
         /// 2D Transformation modifiers (post multiply: this *= other)
-        Matrix4x4&    scale(double sX, double sY, double sZ);
-        Matrix4x4&    scale(const Vector3<double>& scale);
+        constexpr Matrix4x4&    scale(double sX, double sY, double sZ);
+        constexpr Matrix4x4&    scale(const Vector3<double>& scale);
         Matrix4x4&    rotate(double rX, double rY, double rZ);
         Matrix4x4&    rotate(const Vector3<double>& rotation);
-        Matrix4x4&    translate(Type tX, Type tY, Type tZ);
-        Matrix4x4&    translate(const Vector3<Type>& translation);
+        constexpr Matrix4x4&    translate(Type tX, Type tY, Type tZ);
+        constexpr Matrix4x4&    translate(const Vector3<Type>& translation);
 
         /// 2D Transformation setters (override current, leaving rest untouched)
         Matrix4x4&    setScale(double newSX, double newSY, double newSZ);
         Matrix4x4&    setScale(const Vector3<double>& newScale);
-        Matrix4x4&    setRotation(double newRX, double newRY, double newRZ);
-        Matrix4x4&    setRotation(const Vector3<double>& newRotation);
-        Matrix4x4&    setTranslation(Type newTX, Type newTY, Type newTZ);
-        Matrix4x4&    setTranslation(const Vector3<Type>& newTranslation);
+        Matrix4x4&    setRotation(double newRX, double newRY, double newRZ, TrigPrecision precision = TrigPrecision::Precise);
+        Matrix4x4&    setRotation(const Vector3<double>& newRotation, TrigPrecision precision = TrigPrecision::Precise);
+        constexpr Matrix4x4&    setTranslation(Type newTX, Type newTY, Type newTZ);
+        constexpr Matrix4x4&    setTranslation(const Vector3<Type>& newTranslation);
 
         /// 2D Transformations Decomposition
         Vector3<double> getScale() const;
         void            getScaleTo(Vector3<double>& outScale) const;
         Vector3<double> getRotation() const;
         void            getRotationTo(Vector3<double>& outRotation) const;
-        Vector3<Type>   getTranslation() const;
-        void            getTranslationTo(Vector3<Type>& outTranslation) const;
+        constexpr Vector3<Type>   getTranslation() const;
+        constexpr void            getTranslationTo(Vector3<Type>& outTranslation) const;
 
         /// Matrix methods
-        Type       determinant(bool bFixedPoint = false) const;
-        void       determinantTo(Type& outResult, bool bFixedPoint = false) const;
-        Matrix4x4  transpose() const;
-        void       transposeTo(Matrix4x4& outResult) const;
+        constexpr Type       determinant(bool bFixedPoint = false) const;
+        constexpr void       determinantTo(Type& outResult, bool bFixedPoint = false) const;
+        constexpr Matrix4x4  transpose() const;
+        constexpr void       transposeTo(Matrix4x4& outResult) const;
         Matrix4x4& makeTranspose();
-        Matrix4x4  inverse() const;
-        void       inverseTo(Matrix4x4& outResult) const;
-        Matrix4x4& makeInverse();
+        constexpr Matrix4x4  inverse() const;
+        constexpr void       inverseTo(Matrix4x4& outResult) const;
+        constexpr Matrix4x4& makeInverse();
 
         /// Direct access to internal storage - no conversions applied (use with caution for integral types)
-        Type getRawValue(int row, int col) const;
-        Type getRawValue(int elem) const;
-        void setRawValue(int row, int col, Type value);
-        void setRawValue(int elem, Type value);
+        constexpr Type getRawValue(int row, int col) const;
+        constexpr Type getRawValue(int elem) const;
+        constexpr void setRawValue(int row, int col, Type value);
+        constexpr void setRawValue(int elem, Type value);
+
+        /// Unchecked raw access for hot loops - no bounds asserts, no conversions applied.
+        /// Columns are contiguous (column-major storage), rows are gathered.
+        constexpr const Type* getRawCol(int col) const;
+        constexpr Type*       getRawCol(int col);
+        constexpr void        getRawRowTo(Type* outRow, int row) const;
+        constexpr Type        getRawValueUnchecked(int row, int col) const;
 
     protected:
         const Type* const getRawData() const { return mData; }
@@ -139,7 +165,7 @@ namespace ETL::Math
             struct { Type m00, m10, m20, m30, m01, m11, m21, m31,
                           m02, m12, m22, m32, m03, m13, m23, m33; }; /// Named access
             Type m[COL_SIZE][COL_SIZE];                              /// 2D access [COL][ROW]
-            Type mData[NUM_ELEM];                                    /// 1D access
+            Type mData[NUM_ELEM];                                    /// 1D access (only member used by constexpr code)
         };
 
 
@@ -174,47 +200,47 @@ namespace ETL::Math
 
     /// Matrix * vector
     template<typename Type>
-    void Multiply(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector4<Type>& vec);
+    constexpr void Multiply(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector4<Type>& vec);
 
     /// Matrix1 * Matrix2
     template<typename Type>
-    void Multiply(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& m1, const Matrix4x4<Type>& m2);
+    constexpr void Multiply(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& m1, const Matrix4x4<Type>& m2);
 
     /// GetCol
     template<typename Type>
-    void GetCol(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index);
+    constexpr void GetCol(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index);
 
     /// GetRow
     template<typename Type>
-    void GetRow(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index);
+    constexpr void GetRow(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index);
 
     /// SetCol
     template<typename Type>
-    void SetCol(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& col);
+    constexpr void SetCol(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& col);
 
     /// SetRow
     template<typename Type>
-    void SetRow(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& row);
+    constexpr void SetRow(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& row);
 
     /// TransformPoint
     template<typename Type>
-    void TransformPoint(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& point);
+    constexpr void TransformPoint(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& point);
 
     /// TransformDirection
     template<typename Type>
-    void TransformDirection(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& direction);
+    constexpr void TransformDirection(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& direction);
 
     /// Translate
     template<typename Type>
-    void Translate(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation);
+    constexpr void Translate(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation);
 
     /// SetTranslation
     template<typename Type>
-    void SetTranslation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation);
+    constexpr void SetTranslation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation);
 
     /// GetTranslation
     template<typename Type>
-    void GetTranslation(Vector3<Type>& outResult, const Matrix4x4<Type>& mat);
+    constexpr void GetTranslation(Vector3<Type>& outResult, const Matrix4x4<Type>& mat);
 
     /// Rotate
     template<typename Type>
@@ -222,7 +248,7 @@ namespace ETL::Math
 
     /// SetRotation
     template<typename Type>
-    void SetRotation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& rotation);
+    void SetRotation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& rotation, TrigPrecision precision = TrigPrecision::Precise);
 
     /// SetRotation
     template<typename Type>
@@ -230,7 +256,7 @@ namespace ETL::Math
 
     /// Scale
     template<typename Type>
-    void Scale(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& scale);
+    constexpr void Scale(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& scale);
 
     /// SetScaling
     template<typename Type>
@@ -242,19 +268,72 @@ namespace ETL::Math
 
     /// Determinant
     template<typename Type>
-    void Determinant(Type& outResult, const Matrix4x4<Type>& mat, bool bFixedPoint = false);
+    constexpr void Determinant(Type& outResult, const Matrix4x4<Type>& mat, bool bFixedPoint = false);
 
     /// Inverse
     template<typename Type>
-    bool Inverse(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat);
+    constexpr bool Inverse(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat);
 
     /// Transpose
     template<typename Type>
-    void Transpose(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat);
+    constexpr void Transpose(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat);
+
+    /// Inverse of a projection built by CreatePerspective/CreateOrthographic (sparse, falls back to Inverse otherwise)
+    template<typename Type>
+    bool InverseProjection(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& proj);
+
+    /// Batched point transform to clip space: outClip[i] = mat * (points[i], 1)
+    template<typename Type>
+    void TransformPoints(std::span<Vector4<Type>> outClip, const Matrix4x4<Type>& mat, std::span<const Vector3<Type>> points);
+
+    /// Batched point projection: clip-space transform followed by the perspective divide (points must have w != 0)
+    template<typename Type>
+    void ProjectPoints(std::span<Vector3<Type>> outNdc, const Matrix4x4<Type>& viewProj, std::span<const Vector3<Type>> points);
+
+    /// Batched CreateRotation from euler angles (same convention), sines/cosines evaluated with the FastTrig SIMD kernels
+    template<typename Type>
+    void CreateRotations(std::span<Matrix4x4<Type>> outResult, std::span<const Vector3<double>> rotations);
+
+    /// Batched matrix products. outResult[i] may alias a[i] or b[i] (in-place updates), other overlaps are not allowed.
+    /// Floating point types run a SIMD column-broadcast kernel (one register per column of the left matrix)
+
+    /// Pairwise: outResult[i] = a[i] * b[i]
+    template<typename Type>
+    void Multiply(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, std::span<const Matrix4x4<Type>> b);
+
+    /// Left broadcast: outResult[i] = a * b[i] (e.g. world[i] = parent * local[i])
+    template<typename Type>
+    void Multiply(std::span<Matrix4x4<Type>> outResult, const Matrix4x4<Type>& a, std::span<const Matrix4x4<Type>> b);
+
+    /// Right broadcast: outResult[i] = a[i] * b
+    template<typename Type>
+    void Multiply(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, const Matrix4x4<Type>& b);
+
+    /// Multi-threaded versions: arrays are split in contiguous ranges (numThreads <= 0 uses all hardware threads),
+    /// arrays below MULTIPLY_PARALLEL_THRESHOLD matrices run on the calling thread
+    constexpr std::size_t MULTIPLY_PARALLEL_THRESHOLD = 2048;
+
+    template<typename Type>
+    void MultiplyParallel(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, std::span<const Matrix4x4<Type>> b,
+                          int numThreads = 0);
+
+    template<typename Type>
+    void MultiplyParallel(std::span<Matrix4x4<Type>> outResult, const Matrix4x4<Type>& a, std::span<const Matrix4x4<Type>> b,
+                          int numThreads = 0);
+
+    template<typename Type>
+    void MultiplyParallel(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, const Matrix4x4<Type>& b,
+                          int numThreads = 0);
+
+    /// Batched inverse: outResult[i] = mats[i]^-1 and ok[i] = false where mats[i] is singular (outResult[i] is then left untouched).
+    /// outResult may alias mats element for element. Floating point types invert 4/8 matrices per SIMD register (SoA).
+    /// Returns true when every matrix was invertible.
+    template<typename Type>
+    bool InverseN(std::span<const Matrix4x4<Type>> mats, std::span<Matrix4x4<Type>> outResult, std::span<bool> ok);
 
     /// Scalar * matrix operator (completeness product commutative)
     template<typename Type>
-    Matrix4x4<Type> operator*(Type scalar, const Matrix4x4<Type>& matrix);
+    constexpr Matrix4x4<Type> operator*(Type scalar, const Matrix4x4<Type>& matrix);
 
 
     ///------------------------------------------------------------------------------------------
@@ -312,9 +391,9 @@ namespace ETL::Math
     extern template void Rotate(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat, const Vector3<double>& rotation);
     extern template void Rotate(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat, const Vector3<double>& rotation);
 
-    extern template void SetRotation(Matrix4x4<float>&  outResult, const Matrix4x4<float>&  mat, const Vector3<double>& rotation);
-    extern template void SetRotation(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat, const Vector3<double>& rotation);
-    extern template void SetRotation(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat, const Vector3<double>& rotation);
+    extern template void SetRotation(Matrix4x4<float>&  outResult, const Matrix4x4<float>&  mat, const Vector3<double>& rotation, TrigPrecision precision);
+    extern template void SetRotation(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat, const Vector3<double>& rotation, TrigPrecision precision);
+    extern template void SetRotation(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat, const Vector3<double>& rotation, TrigPrecision precision);
 
     extern template void GetRotation(Vector3<double>& outResult, const Matrix4x4<float>&  mat);
     extern template void GetRotation(Vector3<double>& outResult, const Matrix4x4<double>& mat);
@@ -344,6 +423,50 @@ namespace ETL::Math
     extern template void Transpose(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat);
     extern template void Transpose(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat);
 
+    extern template bool InverseProjection(Matrix4x4<float>&  outResult, const Matrix4x4<float>&  proj);
+    extern template bool InverseProjection(Matrix4x4<double>& outResult, const Matrix4x4<double>& proj);
+    extern template bool InverseProjection(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    proj);
+
+    extern template void TransformPoints(std::span<Vector4<float>>  outClip, const Matrix4x4<float>&  mat, std::span<const Vector3<float>>  points);
+    extern template void TransformPoints(std::span<Vector4<double>> outClip, const Matrix4x4<double>& mat, std::span<const Vector3<double>> points);
+    extern template void TransformPoints(std::span<Vector4<int>>    outClip, const Matrix4x4<int>&    mat, std::span<const Vector3<int>>    points);
+
+    extern template void ProjectPoints(std::span<Vector3<float>>  outNdc, const Matrix4x4<float>&  viewProj, std::span<const Vector3<float>>  points);
+    extern template void ProjectPoints(std::span<Vector3<double>> outNdc, const Matrix4x4<double>& viewProj, std::span<const Vector3<double>> points);
+    extern template void ProjectPoints(std::span<Vector3<int>>    outNdc, const Matrix4x4<int>&    viewProj, std::span<const Vector3<int>>    points);
+
+    extern template void CreateRotations(std::span<Matrix4x4<float>>  outResult, std::span<const Vector3<double>> rotations);
+    extern template void CreateRotations(std::span<Matrix4x4<double>> outResult, std::span<const Vector3<double>> rotations);
+    extern template void CreateRotations(std::span<Matrix4x4<int>>    outResult, std::span<const Vector3<double>> rotations);
+
+    extern template void Multiply(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, std::span<const Matrix4x4<float>>  b);
+    extern template void Multiply(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, std::span<const Matrix4x4<double>> b);
+    extern template void Multiply(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, std::span<const Matrix4x4<int>>    b);
+
+    extern template void Multiply(std::span<Matrix4x4<float>>  outResult, const Matrix4x4<float>&  a, std::span<const Matrix4x4<float>>  b);
+    extern template void Multiply(std::span<Matrix4x4<double>> outResult, const Matrix4x4<double>& a, std::span<const Matrix4x4<double>> b);
+    extern template void Multiply(std::span<Matrix4x4<int>>    outResult, const Matrix4x4<int>&    a, std::span<const Matrix4x4<int>>    b);
+
+    extern template void Multiply(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, const Matrix4x4<float>&  b);
+    extern template void Multiply(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, const Matrix4x4<double>& b);
+    extern template void Multiply(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, const Matrix4x4<int>&    b);
+
+    extern template void MultiplyParallel(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, std::span<const Matrix4x4<float>>  b, int numThreads);
+    extern template void MultiplyParallel(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, std::span<const Matrix4x4<double>> b, int numThreads);
+    extern template void MultiplyParallel(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, std::span<const Matrix4x4<int>>    b, int numThreads);
+
+    extern template void MultiplyParallel(std::span<Matrix4x4<float>>  outResult, const Matrix4x4<float>&  a, std::span<const Matrix4x4<float>>  b, int numThreads);
+    extern template void MultiplyParallel(std::span<Matrix4x4<double>> outResult, const Matrix4x4<double>& a, std::span<const Matrix4x4<double>> b, int numThreads);
+    extern template void MultiplyParallel(std::span<Matrix4x4<int>>    outResult, const Matrix4x4<int>&    a, std::span<const Matrix4x4<int>>    b, int numThreads);
+
+    extern template void MultiplyParallel(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, const Matrix4x4<float>&  b, int numThreads);
+    extern template void MultiplyParallel(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, const Matrix4x4<double>& b, int numThreads);
+    extern template void MultiplyParallel(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, const Matrix4x4<int>&    b, int numThreads);
+
+    extern template bool InverseN(std::span<const Matrix4x4<float>>  mats, std::span<Matrix4x4<float>>  outResult, std::span<bool> ok);
+    extern template bool InverseN(std::span<const Matrix4x4<double>> mats, std::span<Matrix4x4<double>> outResult, std::span<bool> ok);
+    extern template bool InverseN(std::span<const Matrix4x4<int>>    mats, std::span<Matrix4x4<int>>    outResult, std::span<bool> ok);
+
     extern template Matrix4x4<float>  operator*(float  scalar, const Matrix4x4<float>&  matrix);
     extern template Matrix4x4<double> operator*(double scalar, const Matrix4x4<double>& matrix);
     extern template Matrix4x4<int>    operator*(int    scalar, const Matrix4x4<int>&    matrix);
@@ -0,0 +1,80 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// MatrixCore.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include <concepts>
+
+namespace ETL::Math
+{
+    /// Shape-generic kernels shared by every vector and matrix type (Vector2/3/4, VectorN,
+    /// Matrix3x3/4x4, MatrixN). They work on raw storage: vectors are Size contiguous values,
+    /// matrices are column-major, fixed point stays encoded. The types keep their own API and
+    /// forward their arithmetic, products and transposes here, so an optimization of one of
+    /// these kernels applies to every shape at once.
+    ///
+    /// Products of floating point shapes listed in HasSimdProduct dispatch at compile time to a
+    /// SIMD column kernel (src/Types/MatrixCore.cpp); every other shape, constant evaluation and
+    /// fixed point take the scalar path. Both sum in the same order, so results are identical.
+
+    namespace helpers
+    {
+        /// inOut[i] += b[i]
+        template<typename Type, int Count>
+        constexpr void AddRaw(Type* inOut, const Type* b);
+
+        /// inOut[i] -= b[i]
+        template<typename Type, int Count>
+        constexpr void SubtractRaw(Type* inOut, const Type* b);
+
+        /// inOut[i] *= scalar (raw scalar, no fixed point shift)
+        template<typename Type, int Count>
+        constexpr void ScaleRaw(Type* inOut, Type scalar);
+
+        /// inOut[i] /= scalar: integer division for fixed point, multiplication by the inverse otherwise
+        template<typename Type, int Count>
+        constexpr void DivideRaw(Type* inOut, Type scalar);
+
+        /// out(Rows x Cols) = a(Rows x Inner) * b(Inner x Cols), column-major. 'out' must not alias 'a' or 'b'.
+        /// Fixed point sums in 64 bits and shifts back once per element.
+        template<typename Type, int Rows, int Inner, int Cols>
+        constexpr void MultiplyRaw(Type* out, const Type* a, const Type* b);
+
+        /// out(Cols x Rows) = transpose of a(Rows x Cols), column-major. 'out' must not alias 'a'.
+        template<typename Type, int Rows, int Cols>
+        constexpr void TransposeRaw(Type* out, const Type* a);
+
+
+        /// Shapes with a precompiled SIMD product: out(Rows x Cols) = a(Rows x Inner) * b(Inner x Cols), Cols == Inner or 1
+        /// (3x3 and 4x4 stay inline: the compiler vectorizes them better than an out-of-line call)
+        template<typename Type, int Rows, int Inner, int Cols>
+        constexpr bool HasSimdProduct = std::floating_point<Type> && (Cols == Inner || Cols == 1)
+                                     && ((Rows == 2 && Inner == 2) || (Rows == 3 && Inner == 4) || (Rows == 6 && Inner == 6));
+
+        /// Column-major raw product kernel, same summation order as the scalar path
+        template<typename Type, int Rows, int Inner, int Cols>
+        void MultiplyColumnsSimd(Type* out, const Type* a, const Type* b);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template void helpers::MultiplyColumnsSimd<float, 2, 2, 2>(float* out, const float* a, const float* b);
+    extern template void helpers::MultiplyColumnsSimd<float, 2, 2, 1>(float* out, const float* a, const float* b);
+    extern template void helpers::MultiplyColumnsSimd<float, 3, 4, 4>(float* out, const float* a, const float* b);
+    extern template void helpers::MultiplyColumnsSimd<float, 3, 4, 1>(float* out, const float* a, const float* b);
+    extern template void helpers::MultiplyColumnsSimd<float, 6, 6, 6>(float* out, const float* a, const float* b);
+    extern template void helpers::MultiplyColumnsSimd<float, 6, 6, 1>(float* out, const float* a, const float* b);
+
+    extern template void helpers::MultiplyColumnsSimd<double, 2, 2, 2>(double* out, const double* a, const double* b);
+    extern template void helpers::MultiplyColumnsSimd<double, 2, 2, 1>(double* out, const double* a, const double* b);
+    extern template void helpers::MultiplyColumnsSimd<double, 3, 4, 4>(double* out, const double* a, const double* b);
+    extern template void helpers::MultiplyColumnsSimd<double, 3, 4, 1>(double* out, const double* a, const double* b);
+    extern template void helpers::MultiplyColumnsSimd<double, 6, 6, 6>(double* out, const double* a, const double* b);
+    extern template void helpers::MultiplyColumnsSimd<double, 6, 6, 1>(double* out, const double* a, const double* b);
+
+} /// namespace ETL::Math
+
+#include "inline/MatrixCore.inl"
@@ -0,0 +1,236 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// MatrixN.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/ElementProxy.h"
+#include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/MatrixCore.h"
+#include "MathLib/Types/VectorN.h"
+#include <concepts>
+#include <type_traits>
+
+namespace ETL::Math
+{
+    /// Fixed-size Rows x Cols matrices.
+    ///
+    /// Matrix<Type, Rows, Cols> is the one name generic code uses: 3x3 and 4x4 resolve at compile
+    /// time to Matrix3x3/4x4 (which add the transform API and batched paths), every other shape
+    /// to MatrixN<Type, Rows, Cols>. Storage is column-major like the existing matrices, so the
+    /// generic Multiply/Transpose/GetBlock below accept any mix of them (e.g. Matrix3x4 * Matrix4x4).
+    /// All of them run their arithmetic, products and transposes on the kernels of MatrixCore.h:
+    /// floating point products of the precompiled shapes (2x2, 3x4, 6x6) use its SIMD column
+    /// kernel, selected at compile time; constant evaluation and fixed point take the scalar path.
+
+    template<typename Type, int Rows, int Cols>
+    class MatrixN;
+
+    namespace helpers
+    {
+        template<typename Type, int Rows, int Cols>
+        struct MatrixSelect { using type = MatrixN<Type, Rows, Cols>; };
+
+        template<typename Type> struct MatrixSelect<Type, 3, 3> { using type = Matrix3x3<Type>; };
+        template<typename Type> struct MatrixSelect<Type, 4, 4> { using type = Matrix4x4<Type>; };
+
+
+        /// Dimensions of any matrix type (undefined for non-matrices)
+        template<typename Mat>
+        struct MatrixShape;
+
+        template<typename Type> struct MatrixShape<Matrix3x3<Type>> { using ValueType = Type; static constexpr int ROWS = 3, COLS = 3; };
+        template<typename Type> struct MatrixShape<Matrix4x4<Type>> { using ValueType = Type; static constexpr int ROWS = 4, COLS = 4; };
+        template<typename Type, int Rows, int Cols> struct MatrixShape<MatrixN<Type, Rows, Cols>> { using ValueType = Type; static constexpr int ROWS = Rows, COLS = Cols; };
+
+        template<typename Mat>
+        struct IsMatrixN : std::false_type {};
+
+        template<typename Type, int Rows, int Cols>
+        struct IsMatrixN<MatrixN<Type, Rows, Cols>> : std::true_type {};
+
+        /// At least one operand is a generic type (the Matrix3x3/4x4 and Vector2/3/4 combinations keep their own overloads)
+        template<typename... Types>
+        constexpr bool AnyGeneric = ((IsMatrixN<Types>::value || IsVectorN<Types>::value) || ...);
+    }
+
+    /// Matrix3x3/4x4 for square 3 and 4, MatrixN otherwise
+    template<typename Type, int Rows, int Cols>
+    using Matrix = typename helpers::MatrixSelect<Type, Rows, Cols>::type;
+
+    /// Any matrix type (Matrix3x3/4x4 or MatrixN)
+    template<typename Mat>
+    concept MatrixType = requires { helpers::MatrixShape<Mat>::ROWS; };
+
+
+    template<typename Type, int Rows, int Cols>
+    class MatrixN
+    {
+        static_assert(Rows > 0 && Cols > 0, "MatrixN needs at least one row and one column");
+        static_assert(Rows != Cols || (Rows != 3 && Rows != 4), "3x3 and 4x4 are Matrix3x3/4x4, use Matrix<Type, Rows, Cols>");
+
+    public:
+
+        static constexpr int ROWS = Rows;
+        static constexpr int COLS = Cols;
+        static constexpr int COL_SIZE = Rows;
+        static constexpr int NUM_ELEM = Rows * Cols;
+
+        /// Common constants
+        static constexpr MatrixN Zero() { return MatrixN{ Type(0) }; }
+        static constexpr MatrixN Identity() { return MatrixN{ Type(1) }; }
+
+        /// Constructors
+        constexpr MatrixN() = default;
+        explicit constexpr MatrixN(Type val); /// Diagonal, rest 0
+
+        /// Elements in row-major order (as written), converted like the Matrix3x3/4x4 constructors
+        template<typename... Values>
+        requires (Rows * Cols > 1 && sizeof...(Values) == Rows * Cols && (std::is_arithmetic_v<Values> && ...))
+        constexpr MatrixN(Values... values);
+
+        /// Raw elements in row-major order, no conversions applied
+        template<typename... Values>
+        requires (sizeof...(Values) == Rows * Cols && (std::same_as<Values, Type> && ...))
+        constexpr MatrixN(RawTag, Values... values);
+
+        /// Copy, Move & Destructor (default)
+        MatrixN(const MatrixN&) = default;
+        MatrixN(MatrixN&&) noexcept = default;
+        MatrixN& operator=(const MatrixN&) = default;
+        MatrixN& operator=(MatrixN&&) noexcept = default;
+        ~MatrixN() = default;
+
+        /// Access methods
+        constexpr Type               operator()(int row, int col) const;
+        constexpr ElementProxy<Type> operator()(int row, int col);
+        constexpr Type               operator[](int index) const;
+        constexpr ElementProxy<Type> operator[](int index);
+
+        constexpr Vector<Type, Rows> getCol(int colIndex) const;
+        constexpr Vector<Type, Cols> getRow(int rowIndex) const;
+        constexpr void setCol(int col, const Vector<Type, Rows>& value);
+        constexpr void setRow(int row, const Vector<Type, Cols>& value);
+
+        /// Operators
+        constexpr MatrixN            operator+(const MatrixN& other) const;
+        constexpr MatrixN            operator-(const MatrixN& other) const;
+        constexpr Vector<Type, Rows> operator*(const Vector<Type, Cols>& vector) const;
+        constexpr MatrixN            operator*(Type scalar) const;
+        constexpr MatrixN            operator/(Type scalar) const;
+        constexpr MatrixN&           operator+=(const MatrixN& other);
+        constexpr MatrixN&           operator-=(const MatrixN& other);
+        constexpr MatrixN&           operator*=(Type scalar);
+        constexpr MatrixN&           operator/=(Type scalar);
+        constexpr bool               operator==(const MatrixN& other) const;
+        constexpr bool               operator!=(const MatrixN& other) const;
+
+        /// Product with any matrix of Cols rows (MatrixN, Matrix3x3 or Matrix4x4)
+        template<MatrixType Other>
+        requires (helpers::MatrixShape<Other>::ROWS == Cols && std::same_as<typename helpers::MatrixShape<Other>::ValueType, Type>)
+        constexpr Matrix<Type, Rows, helpers::MatrixShape<Other>::COLS> operator*(const Other& other) const;
+
+        /// Matrix methods
+        constexpr Matrix<Type, Cols, Rows> transpose() const;
+        constexpr double                   determinant() const requires (Rows == Cols);
+        constexpr MatrixN                  inverse() const requires (Rows == Cols);
+        constexpr MatrixN&                 makeInverse() requires (Rows == Cols);
+
+        /// Direct access to internal storage - no conversions applied (use with caution for integral types)
+        constexpr Type getRawValue(int row, int col) const;
+        constexpr Type getRawValue(int elem) const;
+        constexpr void setRawValue(int row, int col, Type value);
+        constexpr void setRawValue(int elem, Type value);
+
+        /// Unchecked raw access for hot loops. Columns are contiguous (column-major storage).
+        constexpr const Type* getRawCol(int col) const { return mData + col * Rows; }
+        constexpr Type*       getRawCol(int col)       { return mData + col * Rows; }
+
+    private:
+        Type mData[NUM_ELEM];
+    };
+
+
+    /// Helpful aliases
+    template<typename Type>
+    using Matrix2x2 = MatrixN<Type, 2, 2>;
+
+    template<typename Type>
+    using Matrix3x4 = MatrixN<Type, 3, 4>; /// Affine 3D transform without the constant last row
+
+    template<typename Type>
+    using Matrix6x6 = MatrixN<Type, 6, 6>; /// Spatial inertia / 6-DOF Jacobian blocks
+
+    using Mat2 = Matrix2x2<float>;
+    using Mat2d = Matrix2x2<double>;
+    using Mat2i = Matrix2x2<int>;
+
+    using Mat3x4 = Matrix3x4<float>;
+    using Mat3x4d = Matrix3x4<double>;
+    using Mat3x4i = Matrix3x4<int>;
+
+    using Mat6 = Matrix6x6<float>;
+    using Mat6d = Matrix6x6<double>;
+    using Mat6i = Matrix6x6<int>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers (also present as class member functions.
+    /// The generic versions take any mix of matrix types of compatible shapes, as long as one of them is generic.
+
+    /// Matrix1 * Matrix2
+    template<MatrixType Out, MatrixType A, MatrixType B>
+    requires (helpers::AnyGeneric<Out, A, B>)
+    constexpr void Multiply(Out& outResult, const A& mA, const B& mB);
+
+    /// Matrix * vector
+    template<VectorType Out, MatrixType Mat, VectorType Vec>
+    requires (helpers::AnyGeneric<Out, Mat, Vec>)
+    constexpr void Multiply(Out& outResult, const Mat& mat, const Vec& vec);
+
+    /// Transpose
+    template<MatrixType Out, MatrixType Mat>
+    requires (helpers::AnyGeneric<Out, Mat>)
+    constexpr void Transpose(Out& outResult, const Mat& mat);
+
+    /// Sub-matrix of outResult's size starting at (Row0, Col0), e.g. the 3x3 part of a Matrix4x4 or a 6x6 block
+    template<int Row0, int Col0, MatrixType Block, MatrixType Mat>
+    constexpr void GetBlock(Block& outResult, const Mat& mat);
+
+    /// Overwrite the sub-matrix starting at (Row0, Col0) with 'block'
+    template<int Row0, int Col0, MatrixType Mat, MatrixType Block>
+    constexpr void SetBlock(Mat& inOutMat, const Block& block);
+
+    /// Determinant (closed form for 2x2, partial pivoting elimination in double otherwise)
+    template<typename Type, int Size>
+    constexpr void Determinant(double& outResult, const MatrixN<Type, Size, Size>& mat);
+
+    /// Inverse (Gauss-Jordan in double with partial pivoting). Returns false (outResult untouched) if singular.
+    template<typename Type, int Size>
+    constexpr bool Inverse(MatrixN<Type, Size, Size>& outResult, const MatrixN<Type, Size, Size>& mat);
+
+    /// Scalar * matrix operator (completeness product commutative)
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols> operator*(Type scalar, const MatrixN<Type, Rows, Cols>& matrix);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class MatrixN<float, 2, 2>;
+    extern template class MatrixN<double, 2, 2>;
+    extern template class MatrixN<int, 2, 2>;
+
+    extern template class MatrixN<float, 3, 4>;
+    extern template class MatrixN<double, 3, 4>;
+    extern template class MatrixN<int, 3, 4>;
+
+    extern template class MatrixN<float, 6, 6>;
+    extern template class MatrixN<double, 6, 6>;
+    extern template class MatrixN<int, 6, 6>;
+
+} /// namespace ETL::Math
+
+#include "inline/MatrixN.inl"
@@ -0,0 +1,216 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Quaternion.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/ElementProxy.h"
+#include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/Matrix4x4.h"
+
+namespace ETL::Math
+{
+    /// Rotation quaternion (x, y, z) + w, Hamilton convention.
+    /// Products compose like matrices: (q1 * q2) rotates by q2 first, then q1.
+    /// When using Quaternion<int> integral types, values are stored
+    /// internally in 16.16 fixed-point format (FIXED_SHIFT = 16).
+    /// Use getRawValue()/setRawValue for explicit control storage.
+
+    template<typename Type>
+    class Quaternion
+    {
+    public:
+
+        /// Static Factories
+        static constexpr Quaternion Identity() { return Quaternion{ Type(0), Type(0), Type(0), Type(1) }; }
+        static Quaternion CreateFromAxisAngle(const Vector3<double>& axis, double angle);
+        static Quaternion CreateFromEuler(double rX, double rY, double rZ);
+        static Quaternion CreateFromMatrix(const Matrix4x4<Type>& mat);
+
+        /// Constructors
+        constexpr Quaternion() = default;
+        constexpr Quaternion(Type x, Type y, Type z, Type w);
+        constexpr Quaternion(double x, double y, double z, double w) requires (!std::same_as<Type, double>);
+        constexpr Quaternion(const Vector3<Type>& xyz, Type w);
+
+        /// Copy, Move & Destructor (default)
+        Quaternion(const Quaternion&) = default;
+        Quaternion(Quaternion&&) noexcept = default;
+        Quaternion& operator=(const Quaternion&) = default;
+        Quaternion& operator=(Quaternion&&) noexcept = default;
+        ~Quaternion() = default;
+
+        /// Access methods
+        Type x() const;
+        Type y() const;
+        Type z() const;
+        Type w() const;
+
+        void x(Type x);
+        void y(Type y);
+        void z(Type z);
+        void w(Type w);
+
+        ElementProxy<Type> operator[](int index);
+        Type               operator[](int index) const;
+
+        Vector3<Type> getVector() const;
+
+        /// Operators
+        Quaternion    operator+(const Quaternion& other) const;
+        Quaternion    operator-(const Quaternion& other) const;
+        Quaternion    operator*(const Quaternion& other) const;
+        Vector3<Type> operator*(const Vector3<Type>& vector) const;
+        Quaternion    operator*(Type scalar) const;
+        Quaternion    operator-() const;
+        Quaternion&   operator+=(const Quaternion& other);
+        Quaternion&   operator-=(const Quaternion& other);
+        Quaternion&   operator*=(const Quaternion& other);
+        Quaternion&   operator*=(Type scalar);
+        bool          operator==(const Quaternion& other) const;
+        bool          operator!=(const Quaternion& other) const;
+
+        /// Quaternion methods
+        double dot(const Quaternion& other) const;
+        double length() const;
+        double lengthSquared() const;
+
+        Quaternion  normalize() const;
+        Quaternion& makeNormalize();
+        Quaternion  conjugate() const;
+        Quaternion  inverse() const;
+        Quaternion& makeInverse();
+
+        /// Rotation helpers
+        Vector3<Type>   rotate(const Vector3<Type>& vector) const;
+        void            rotateTo(Vector3<Type>& outResult, const Vector3<Type>& vector) const;
+        Matrix4x4<Type> toMatrix() const;
+        void            toMatrixTo(Matrix4x4<Type>& outResult) const;
+
+        /// Direct access to internal storage - no conversions applied (use with caution for integral types)
+        Type getRawValue(int index) const;
+        void setRawValue(int index, Type value);
+
+    private:
+        union {
+            struct { Type mX, mY, mZ, mW; };
+            Type mData[4];
+        };
+
+        constexpr Quaternion(RawTag, Type x, Type y, Type z, Type w);
+    };
+
+
+    /// Deduction guide
+    template<typename Type> Quaternion(Type, Type, Type, Type) -> Quaternion<Type>;
+
+
+    /// Helpful aliases
+    using Quat = Quaternion<float>;
+    using Quatd = Quaternion<double>;
+    using Quati = Quaternion<int>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers (also present as class member functions.
+
+    /// q1 * q2 (rotates by q2, then q1)
+    template<typename Type>
+    void Multiply(Quaternion<Type>& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2);
+
+    /// Dot prod
+    template<typename Type>
+    void Dot(double& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2);
+
+    /// Length
+    template<typename Type>
+    void Length(double& outResult, const Quaternion<Type>& quat);
+
+    /// Normalize
+    template<typename Type>
+    bool Normalize(Quaternion<Type>& outResult, const Quaternion<Type>& quat);
+
+    /// Conjugate
+    template<typename Type>
+    void Conjugate(Quaternion<Type>& outResult, const Quaternion<Type>& quat);
+
+    /// Inverse
+    template<typename Type>
+    bool Inverse(Quaternion<Type>& outResult, const Quaternion<Type>& quat);
+
+    /// Rotate a vector (quat must be unit length)
+    template<typename Type>
+    void Rotate(Vector3<Type>& outResult, const Quaternion<Type>& quat, const Vector3<Type>& vector);
+
+    /// Rotation matrix from unit quaternion
+    template<typename Type>
+    void ToMatrix(Matrix4x4<Type>& outResult, const Quaternion<Type>& quat);
+
+    /// Unit quaternion from the rotation part of a matrix (upper 3x3 must be orthonormal)
+    template<typename Type>
+    void FromMatrix(Quaternion<Type>& outResult, const Matrix4x4<Type>& mat);
+
+    /// Normalized linear interpolation (shortest path)
+    template<typename Type>
+    void Nlerp(Quaternion<Type>& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2, double t);
+
+    /// Spherical linear interpolation (shortest path)
+    template<typename Type>
+    void Slerp(Quaternion<Type>& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2, double t);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class Quaternion<float>;
+    extern template class Quaternion<double>;
+    extern template class Quaternion<int>;
+
+    extern template void Multiply(Quaternion<float>&  outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2);
+    extern template void Multiply(Quaternion<double>& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2);
+    extern template void Multiply(Quaternion<int>&    outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2);
+
+    extern template void Dot(double& outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2);
+    extern template void Dot(double& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2);
+    extern template void Dot(double& outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2);
+
+    extern template void Length(double& outResult, const Quaternion<float>&  quat);
+    extern template void Length(double& outResult, const Quaternion<double>& quat);
+    extern template void Length(double& outResult, const Quaternion<int>&    quat);
+
+    extern template bool Normalize(Quaternion<float>&  outResult, const Quaternion<float>&  quat);
+    extern template bool Normalize(Quaternion<double>& outResult, const Quaternion<double>& quat);
+    extern template bool Normalize(Quaternion<int>&    outResult, const Quaternion<int>&    quat);
+
+    extern template void Conjugate(Quaternion<float>&  outResult, const Quaternion<float>&  quat);
+    extern template void Conjugate(Quaternion<double>& outResult, const Quaternion<double>& quat);
+    extern template void Conjugate(Quaternion<int>&    outResult, const Quaternion<int>&    quat);
+
+    extern template bool Inverse(Quaternion<float>&  outResult, const Quaternion<float>&  quat);
+    extern template bool Inverse(Quaternion<double>& outResult, const Quaternion<double>& quat);
+    extern template bool Inverse(Quaternion<int>&    outResult, const Quaternion<int>&    quat);
+
+    extern template void Rotate(Vector3<float>&  outResult, const Quaternion<float>&  quat, const Vector3<float>&  vector);
+    extern template void Rotate(Vector3<double>& outResult, const Quaternion<double>& quat, const Vector3<double>& vector);
+    extern template void Rotate(Vector3<int>&    outResult, const Quaternion<int>&    quat, const Vector3<int>&    vector);
+
+    extern template void ToMatrix(Matrix4x4<float>&  outResult, const Quaternion<float>&  quat);
+    extern template void ToMatrix(Matrix4x4<double>& outResult, const Quaternion<double>& quat);
+    extern template void ToMatrix(Matrix4x4<int>&    outResult, const Quaternion<int>&    quat);
+
+    extern template void FromMatrix(Quaternion<float>&  outResult, const Matrix4x4<float>&  mat);
+    extern template void FromMatrix(Quaternion<double>& outResult, const Matrix4x4<double>& mat);
+    extern template void FromMatrix(Quaternion<int>&    outResult, const Matrix4x4<int>&    mat);
+
+    extern template void Nlerp(Quaternion<float>&  outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2, double t);
+    extern template void Nlerp(Quaternion<double>& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2, double t);
+    extern template void Nlerp(Quaternion<int>&    outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2, double t);
+
+    extern template void Slerp(Quaternion<float>&  outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2, double t);
+    extern template void Slerp(Quaternion<double>& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2, double t);
+    extern template void Slerp(Quaternion<int>&    outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2, double t);
+
+
+} /// namespace ETL::Math
+
+#include "inline/Quaternion.inl"
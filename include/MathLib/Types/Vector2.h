@@ -6,6 +6,7 @@
 
 #include "MathLib/Common/ElementProxy.h"
 #include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/MatrixCore.h"
 
 namespace ETL::Math
 {
@@ -36,48 +37,48 @@ namespace ETL::Math
         ~Vector2() = default;
 
         /// Access methods
-        Type x() const;
-        Type y() const;
+        constexpr Type x() const;
+        constexpr Type y() const;
 
-        void x(Type x);
-        void y(Type y);
+        constexpr void x(Type x);
+        constexpr void y(Type y);
 
-        ElementProxy<Type> operator[](int index);
-        Type               operator[](int index) const;
+        constexpr ElementProxy<Type> operator[](int index);
+        constexpr Type               operator[](int index) const;
 
         /// Operators
-        Vector2  operator+(const Vector2& other) const;
-        Vector2  operator-(const Vector2& other) const;
-        double   operator*(const Vector2& other) const;
-        double   operator^(const Vector2& other) const;
-        Vector2  operator*(Type scalar) const;
-        Vector2  operator/(Type scalar) const;
-        Vector2  operator-() const;
-        Vector2& operator+=(const Vector2& other);
-        Vector2& operator-=(const Vector2& other);
-        Vector2& operator*=(Type scalar);
-        Vector2& operator/=(Type scalar);
-        bool     operator==(const Vector2& other) const;
-        bool     operator!=(const Vector2& other) const;
-
-        Vector2  componentMul(const Vector2& other) const;
-        Vector2  componentDiv(const Vector2& other) const;
-        void     componentMulInPlace(const Vector2& other);
-        void     componentDivInPlace(const Vector2& other);
+        constexpr Vector2  operator+(const Vector2& other) const;
+        constexpr Vector2  operator-(const Vector2& other) const;
+        constexpr double   operator*(const Vector2& other) const;
+        constexpr double   operator^(const Vector2& other) const;
+        constexpr Vector2  operator*(Type scalar) const;
+        constexpr Vector2  operator/(Type scalar) const;
+        constexpr Vector2  operator-() const;
+        constexpr Vector2& operator+=(const Vector2& other);
+        constexpr Vector2& operator-=(const Vector2& other);
+        constexpr Vector2& operator*=(Type scalar);
+        constexpr Vector2& operator/=(Type scalar);
+        constexpr bool     operator==(const Vector2& other) const;
+        constexpr bool     operator!=(const Vector2& other) const;
+
+        constexpr Vector2  componentMul(const Vector2& other) const;
+        constexpr Vector2  componentDiv(const Vector2& other) const;
+        constexpr void     componentMulInPlace(const Vector2& other);
+        constexpr void     componentDivInPlace(const Vector2& other);
 
         /// Vector methods
-        double dot(const Vector2& other) const;
-        double cross(const Vector2& other) const;
+        constexpr double dot(const Vector2& other) const;
+        constexpr double cross(const Vector2& other) const;
 
         double length() const;
-        double lengthSquared() const;
+        constexpr double lengthSquared() const;
 
         Vector2  normalize() const;
         Vector2& makeNormalize();
 
         /// Direct access to internal storage - no conversions applied (use with caution for integral types)
-        Type getRawValue(int index) const;
-        void setRawValue(int index, Type value);
+        constexpr Type getRawValue(int index) const;
+        constexpr void setRawValue(int index, Type value);
 
         /// Common constants
         static constexpr Vector2<Type> Zero()  { return { Type(0), Type(0) }; }
@@ -94,7 +95,7 @@ namespace ETL::Math
     private:
         union {
             struct { Type mX, mY; };
-            Type mData[2];
+            Type mData[2]; /// Only member used by constexpr code
         };
 
         constexpr Vector2(RawTag, Type x, Type y);
@@ -117,19 +118,19 @@ namespace ETL::Math
 
     /// Component-wise mul
     template<typename Type>
-    void ComponentMul(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
+    constexpr void ComponentMul(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
 
     /// Component-wise div
     template<typename Type>
-    void ComponentDiv(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
+    constexpr void ComponentDiv(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
 
     /// Dot prod
     template<typename Type>
-    void Dot(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
+    constexpr void Dot(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
 
     /// Cross prod
     template<typename Type>
-    void Cross(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
+    constexpr void Cross(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2);
 
     /// Length
     template<typename Type>
@@ -137,7 +138,7 @@ namespace ETL::Math
 
     /// Length Squared
     template<typename Type>
-    void LengthSquared(double& outResult, const Vector2<Type>& vec);
+    constexpr void LengthSquared(double& outResult, const Vector2<Type>& vec);
 
     /// Normalize
     template<typename Type>
@@ -145,7 +146,7 @@ namespace ETL::Math
 
     /// Scalar * matrix operator (commutative property)
     template<typename Type>
-    Vector2<Type> operator*(Type scalar, const Vector2<Type>& vector);
+    constexpr Vector2<Type> operator*(Type scalar, const Vector2<Type>& vector);
 
 
     ///------------------------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 
 #include "MathLib/Common/ElementProxy.h"
 #include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/MatrixCore.h"
 #include "MathLib/Types/Vector2.h"
 
 namespace ETL::Math
@@ -36,56 +37,56 @@ namespace ETL::Math
         ~Vector3() = default;
 
         /// Access methods
-        Type x() const;
-        Type y() const;
-        Type z() const;
+        constexpr Type x() const;
+        constexpr Type y() const;
+        constexpr Type z() const;
 
-        void x(Type x);
-        void y(Type y);
-        void z(Type z);
+        constexpr void x(Type x);
+        constexpr void y(Type y);
+        constexpr void z(Type z);
 
-        ElementProxy<Type> operator[](int index);
-        Type               operator[](int index) const;
+        constexpr ElementProxy<Type> operator[](int index);
+        constexpr Type               operator[](int index) const;
 
         /// Operators
-        Vector3  operator+(const Vector3& other) const;
-        Vector3  operator-(const Vector3& other) const;
-        double   operator*(const Vector3& other) const;
-        Vector3  operator^(const Vector3& other) const;
-        Vector3  operator*(Type scalar) const;
-        Vector3  operator/(Type scalar) const;
-        Vector3  operator-() const;
-        Vector3& operator+=(const Vector3& other);
-        Vector3& operator-=(const Vector3& other);
-        Vector3& operator*=(Type scalar);
-        Vector3& operator/=(Type scalar);
-        bool     operator==(const Vector3& other) const;
-        bool     operator!=(const Vector3& other) const;
-
-        Vector3  componentMul(const Vector3& other) const;
-        Vector3  componentDiv(const Vector3& other) const;
-        void     componentMulInPlace(const Vector3& other); 
-        void     componentDivInPlace(const Vector3& other);
+        constexpr Vector3  operator+(const Vector3& other) const;
+        constexpr Vector3  operator-(const Vector3& other) const;
+        constexpr double   operator*(const Vector3& other) const;
+        constexpr Vector3  operator^(const Vector3& other) const;
+        constexpr Vector3  operator*(Type scalar) const;
+        constexpr Vector3  operator/(Type scalar) const;
+        constexpr Vector3  operator-() const;
+        constexpr Vector3& operator+=(const Vector3& other);
+        constexpr Vector3& operator-=(const Vector3& other);
+        constexpr Vector3& operator*=(Type scalar);
+        constexpr Vector3& operator/=(Type scalar);
+        constexpr bool     operator==(const Vector3& other) const;
+        constexpr bool     operator!=(const Vector3& other) const;
+
+        constexpr Vector3  componentMul(const Vector3& other) const;
+        constexpr Vector3  componentDiv(const Vector3& other) const;
+        constexpr void     componentMulInPlace(const Vector3& other); 
+        constexpr void     componentDivInPlace(const Vector3& other);
 
         /// Vector methods
-        double  dot(const Vector3& other) const;
-        Vector3 cross(const Vector3& other) const;
+        constexpr double  dot(const Vector3& other) const;
+        constexpr Vector3 cross(const Vector3& other) const;
 
         double length() const;
-        double lengthSquared() const;
+        constexpr double lengthSquared() const;
 
         Vector3  normalize() const;
         Vector3& makeNormalize();
 
         /// 3D Transform helpers
-        Vector2<Type> toVector2() const;
-        Vector2<Type> perspectiveDivide() const;
-        bool          isPoint() const;
-        bool          isDirection() const;
+        constexpr Vector2<Type> toVector2() const;
+        constexpr Vector2<Type> perspectiveDivide() const;
+        constexpr bool          isPoint() const;
+        constexpr bool          isDirection() const;
 
         /// Direct access to internal storage - no conversions applied (use with caution for integral types)
-        Type getRawValue(int index) const;
-        void setRawValue(int index, Type value);
+        constexpr Type getRawValue(int index) const;
+        constexpr void setRawValue(int index, Type value);
 
         /// Static 2D Transform Factories
         static constexpr Vector3 MakePoint(const Vector2<Type>& xy)     { return Vector3<Type>{ xy, Type(1) }; }
@@ -109,7 +110,7 @@ namespace ETL::Math
     private:
         union {
             struct { Type mX, mY, mZ; };
-            Type mData[3];
+            Type mData[3]; /// Only member used by constexpr code
         };
 
         constexpr Vector3(RawTag, Type x, Type y, Type z);
@@ -132,19 +133,19 @@ namespace ETL::Math
 
     /// Component-wise mul
     template<typename Type>
-    void ComponentMul(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
+    constexpr void ComponentMul(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
 
     /// Component-wise div
     template<typename Type>
-    void ComponentDiv(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
+    constexpr void ComponentDiv(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
 
     /// Dot prod
     template<typename Type>
-    void Dot(double& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
+    constexpr void Dot(double& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
 
     /// Cross prod
     template<typename Type>
-    void Cross(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
+    constexpr void Cross(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2);
 
     /// Length
     template<typename Type>
@@ -152,7 +153,7 @@ namespace ETL::Math
 
     /// Length Squared
     template<typename Type>
-    void LengthSquared(double& outResult, const Vector3<Type>& vec);
+    constexpr void LengthSquared(double& outResult, const Vector3<Type>& vec);
 
     /// Normalize
     template<typename Type>
@@ -160,15 +161,15 @@ namespace ETL::Math
 
     /// Extract vector3
     template<typename Type>
-    void ToVector2(Vector2<Type>& outResult, const Vector3<Type>& vec);
+    constexpr void ToVector2(Vector2<Type>& outResult, const Vector3<Type>& vec);
 
     /// Perspective divide
     template<typename Type>
-    void PerspectiveDivide(Vector2<Type>& outResult, const Vector3<Type>& vec);
+    constexpr void PerspectiveDivide(Vector2<Type>& outResult, const Vector3<Type>& vec);
 
     /// Scalar * matrix operator (commutative property)
     template<typename Type>
-    Vector3<Type> operator*(Type scalar, const Vector3<Type>& vector);
+    constexpr Vector3<Type> operator*(Type scalar, const Vector3<Type>& vector);
 
 
     ///------------------------------------------------------------------------------------------
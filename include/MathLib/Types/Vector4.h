@@ -6,6 +6,7 @@
 
 #include "MathLib/Common/ElementProxy.h"
 #include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/MatrixCore.h"
 #include "MathLib/Types/Vector3.h"
 
 namespace ETL::Math
@@ -36,56 +37,56 @@ namespace ETL::Math
         ~Vector4() = default;
 
         /// Access methods
-        Type x() const;
-        Type y() const;
-        Type z() const;
-        Type w() const;
+        constexpr Type x() const;
+        constexpr Type y() const;
+        constexpr Type z() const;
+        constexpr Type w() const;
 
-        void x(Type x);
-        void y(Type y);
-        void z(Type z);
-        void w(Type w);
+        constexpr void x(Type x);
+        constexpr void y(Type y);
+        constexpr void z(Type z);
+        constexpr void w(Type w);
 
-        ElementProxy<Type> operator[](int index);
-        Type               operator[](int index) const;
+        constexpr ElementProxy<Type> operator[](int index);
+        constexpr Type               operator[](int index) const;
 
         /// Operators
-        Vector4  operator+(const Vector4& other) const;
-        Vector4  operator-(const Vector4& other) const;
-        double   operator*(const Vector4& other) const;
-        Vector4  operator*(Type scalar) const;
-        Vector4  operator/(Type scalar) const;
-        Vector4  operator-() const;
-        Vector4& operator+=(const Vector4& other);
-        Vector4& operator-=(const Vector4& other);
-        Vector4& operator*=(Type scalar);
-        Vector4& operator/=(Type scalar);
-        bool     operator==(const Vector4& other) const;
-        bool     operator!=(const Vector4& other) const;
-
-        Vector4  componentMul(const Vector4& other) const;
-        Vector4  componentDiv(const Vector4& other) const;
-        void     componentMulInPlace(const Vector4& other); 
-        void     componentDivInPlace(const Vector4& other);
+        constexpr Vector4  operator+(const Vector4& other) const;
+        constexpr Vector4  operator-(const Vector4& other) const;
+        constexpr double   operator*(const Vector4& other) const;
+        constexpr Vector4  operator*(Type scalar) const;
+        constexpr Vector4  operator/(Type scalar) const;
+        constexpr Vector4  operator-() const;
+        constexpr Vector4& operator+=(const Vector4& other);
+        constexpr Vector4& operator-=(const Vector4& other);
+        constexpr Vector4& operator*=(Type scalar);
+        constexpr Vector4& operator/=(Type scalar);
+        constexpr bool     operator==(const Vector4& other) const;
+        constexpr bool     operator!=(const Vector4& other) const;
+
+        constexpr Vector4  componentMul(const Vector4& other) const;
+        constexpr Vector4  componentDiv(const Vector4& other) const;
+        constexpr void     componentMulInPlace(const Vector4& other); 
+        constexpr void     componentDivInPlace(const Vector4& other);
 
         /// Vector methods
-        double dot(const Vector4& other) const;
+        constexpr double dot(const Vector4& other) const;
 
         double length() const;
-        double lengthSquared() const;
+        constexpr double lengthSquared() const;
 
         Vector4  normalize() const;
         Vector4& makeNormalize();
 
         /// 3D Transform helpers
-        Vector3<Type> toVector3() const;
-        Vector3<Type> perspectiveDivide() const;
-        bool          isPoint() const;
-        bool          isDirection() const;
+        constexpr Vector3<Type> toVector3() const;
+        constexpr Vector3<Type> perspectiveDivide() const;
+        constexpr bool          isPoint() const;
+        constexpr bool          isDirection() const;
 
         /// Direct access to internal storage - no conversions applied (use with caution for integral types)
-        Type getRawValue(int index) const;
-        void setRawValue(int index, Type value);
+        constexpr Type getRawValue(int index) const;
+        constexpr void setRawValue(int index, Type value);
 
         /// Static 3D Transform Factories
         static constexpr Vector4 MakePoint(const Vector3<Type>& xyz)     { return Vector4<Type>{ xyz, Type(1) }; }
@@ -101,7 +102,7 @@ namespace ETL::Math
     private:
         union {
             struct { Type mX, mY, mZ, mW; };
-            Type mData[4];
+            Type mData[4]; /// Only member used by constexpr code
         };
 
         constexpr Vector4(RawTag, Type x, Type y, Type z, Type w);
@@ -124,15 +125,15 @@ namespace ETL::Math
 
     /// Component-wise mul
     template<typename Type>
-    void ComponentMul(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2);
+    constexpr void ComponentMul(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2);
 
     /// Component-wise div
     template<typename Type>
-    void ComponentDiv(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2);
+    constexpr void ComponentDiv(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2);
 
     /// Dot prod
     template<typename Type>
-    void Dot(double& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2);
+    constexpr void Dot(double& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2);
 
     /// Length
     template<typename Type>
@@ -140,7 +141,7 @@ namespace ETL::Math
 
     /// Length Squared
     template<typename Type>
-    void LengthSquared(double& outResult, const Vector4<Type>& vec);
+    constexpr void LengthSquared(double& outResult, const Vector4<Type>& vec);
 
     /// Normalize
     template<typename Type>
@@ -156,7 +157,7 @@ namespace ETL::Math
 
     /// Scalar * matrix operator (commutative property)
     template<typename Type>
-    Vector4<Type> operator*(Type scalar, const Vector4<Type>& vector);
+    constexpr Vector4<Type> operator*(Type scalar, const Vector4<Type>& vector);
 
 
     ///------------------------------------------------------------------------------------------
@@ -0,0 +1,183 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// VectorN.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include "MathLib/Common/ElementProxy.h"
+#include "MathLib/Common/RawTag.h"
+#include "MathLib/Types/MatrixCore.h"
+#include "MathLib/Types/Vector2.h"
+#include "MathLib/Types/Vector3.h"
+#include "MathLib/Types/Vector4.h"
+#include <concepts>
+#include <type_traits>
+
+namespace ETL::Math
+{
+    /// Fixed-size vectors of any dimension.
+    ///
+    /// Vector<Type, Size> is the one name generic code uses: sizes 2, 3 and 4 resolve at compile
+    /// time to the hand-tuned Vector2/3/4, every other size to VectorN<Type, Size>. All of them
+    /// share the raw interface (getRawValue/setRawValue) the generic kernels are written against.
+    /// As for the other types, VectorN<int, Size> stores 16.16 fixed point values.
+
+    template<typename Type, int Size>
+    class VectorN;
+
+    namespace helpers
+    {
+        template<typename Type, int Size>
+        struct VectorSelect { using type = VectorN<Type, Size>; };
+
+        template<typename Type> struct VectorSelect<Type, 2> { using type = Vector2<Type>; };
+        template<typename Type> struct VectorSelect<Type, 3> { using type = Vector3<Type>; };
+        template<typename Type> struct VectorSelect<Type, 4> { using type = Vector4<Type>; };
+
+
+        /// Dimension of any vector type (undefined for non-vectors)
+        template<typename Vec>
+        struct VectorShape;
+
+        template<typename Type> struct VectorShape<Vector2<Type>> { using ValueType = Type; static constexpr int SIZE = 2; };
+        template<typename Type> struct VectorShape<Vector3<Type>> { using ValueType = Type; static constexpr int SIZE = 3; };
+        template<typename Type> struct VectorShape<Vector4<Type>> { using ValueType = Type; static constexpr int SIZE = 4; };
+        template<typename Type, int Size> struct VectorShape<VectorN<Type, Size>> { using ValueType = Type; static constexpr int SIZE = Size; };
+
+        template<typename Vec>
+        struct IsVectorN : std::false_type {};
+
+        template<typename Type, int Size>
+        struct IsVectorN<VectorN<Type, Size>> : std::true_type {};
+    }
+
+    /// Vector2/3/4 for sizes 2 to 4, VectorN otherwise
+    template<typename Type, int Size>
+    using Vector = typename helpers::VectorSelect<Type, Size>::type;
+
+    /// Any vector type (Vector2/3/4 or VectorN)
+    template<typename Vec>
+    concept VectorType = requires { helpers::VectorShape<Vec>::SIZE; };
+
+
+    template<typename Type, int Size>
+    class VectorN
+    {
+        static_assert(Size == 1 || Size > 4, "Sizes 2 to 4 are Vector2/3/4, use Vector<Type, Size>");
+
+    public:
+
+        static constexpr int SIZE = Size;
+
+        /// Constructors
+        constexpr VectorN() = default;
+        explicit constexpr VectorN(Type val);
+
+        /// Components, converted like the Vector2/3/4 constructors (int and double arguments both accepted)
+        template<typename... Values>
+        requires (Size > 1 && sizeof...(Values) == Size && (std::is_arithmetic_v<Values> && ...))
+        constexpr VectorN(Values... values) : mData{ EncodeValue<Type>(values)... } {}
+
+        /// Copy, Move & Destructor (default)
+        VectorN(const VectorN&) = default;
+        VectorN(VectorN&&) noexcept = default;
+        VectorN& operator=(const VectorN&) = default;
+        VectorN& operator=(VectorN&&) noexcept = default;
+        ~VectorN() = default;
+
+        /// Access methods
+        constexpr ElementProxy<Type> operator[](int index);
+        constexpr Type               operator[](int index) const;
+
+        /// Sub-vector [Offset, Offset + Count) (e.g. the angular and linear halves of a spatial vector)
+        template<int Offset, int Count>
+        constexpr Vector<Type, Count> getSegment() const;
+
+        template<int Offset, VectorType Vec>
+        constexpr void setSegment(const Vec& value);
+
+        /// Operators
+        constexpr VectorN  operator+(const VectorN& other) const;
+        constexpr VectorN  operator-(const VectorN& other) const;
+        constexpr double   operator*(const VectorN& other) const;
+        constexpr VectorN  operator*(Type scalar) const;
+        constexpr VectorN  operator/(Type scalar) const;
+        constexpr VectorN  operator-() const;
+        constexpr VectorN& operator+=(const VectorN& other);
+        constexpr VectorN& operator-=(const VectorN& other);
+        constexpr VectorN& operator*=(Type scalar);
+        constexpr VectorN& operator/=(Type scalar);
+        constexpr bool     operator==(const VectorN& other) const;
+        constexpr bool     operator!=(const VectorN& other) const;
+
+        /// Vector methods
+        constexpr double dot(const VectorN& other) const;
+        double           length() const;
+        constexpr double lengthSquared() const;
+        VectorN          normalize() const;
+        VectorN&         makeNormalize();
+
+        /// Direct access to internal storage - no conversions applied (use with caution for integral types)
+        constexpr Type        getRawValue(int index) const;
+        constexpr void        setRawValue(int index, Type value);
+        constexpr const Type* getRawData() const { return mData; }
+        constexpr Type*       getRawData()       { return mData; }
+
+        /// Common constants
+        static constexpr VectorN Zero() { return VectorN{ Type(0) }; }
+        static constexpr VectorN One()  { return VectorN{ Type(1) }; }
+        static constexpr VectorN Unit(int index);
+
+    private:
+        Type mData[Size];
+    };
+
+
+    /// Helpful aliases (6D: spatial / twist vectors)
+    template<typename Type>
+    using Vector6 = VectorN<Type, 6>;
+
+    using Vec6 = Vector6<float>;
+    using Vec6d = Vector6<double>;
+    using Vec6i = Vector6<int>;
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers (also present as class member functions.
+
+    /// Dot prod
+    template<typename Type, int Size>
+    constexpr void Dot(double& outResult, const VectorN<Type, Size>& v1, const VectorN<Type, Size>& v2);
+
+    /// Length
+    template<typename Type, int Size>
+    void Length(double& outResult, const VectorN<Type, Size>& vec);
+
+    /// Length Squared
+    template<typename Type, int Size>
+    constexpr void LengthSquared(double& outResult, const VectorN<Type, Size>& vec);
+
+    /// Normalize
+    template<typename Type, int Size>
+    bool Normalize(VectorN<Type, Size>& outResult, const VectorN<Type, Size>& vec);
+
+    /// Scalar * vector operator (commutative property)
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> operator*(Type scalar, const VectorN<Type, Size>& vector);
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    extern template class VectorN<float, 6>;
+    extern template class VectorN<double, 6>;
+    extern template class VectorN<int, 6>;
+
+    extern template bool Normalize(VectorN<float, 6>&  outResult, const VectorN<float, 6>&  vec);
+    extern template bool Normalize(VectorN<double, 6>& outResult, const VectorN<double, 6>& vec);
+    extern template bool Normalize(VectorN<int, 6>&    outResult, const VectorN<int, 6>&    vec);
+
+
+} /// namespace ETL::Math
+
+#include "inline/VectorN.inl"
@@ -0,0 +1,528 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// DualQuaternion.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/TypeComparisons.h"
+#include <cmath>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Rigid transform: rotate by 'rotation' (unit), then translate by 'translation'
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="rotation"></param>
+    /// <param name="translation"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::CreateFromRotationTranslation(const Quaternion<Type>& rotation, const Vector3<Type>& translation)
+    {
+        using Calc = CalcType<Type>;
+
+        const Calc rx = DecodeValue<Calc>(rotation.getRawValue(0)), ry = DecodeValue<Calc>(rotation.getRawValue(1));
+        const Calc rz = DecodeValue<Calc>(rotation.getRawValue(2)), rw = DecodeValue<Calc>(rotation.getRawValue(3));
+        const Calc tx = DecodeValue<Calc>(translation.getRawValue(0)) * Calc(0.5);
+        const Calc ty = DecodeValue<Calc>(translation.getRawValue(1)) * Calc(0.5);
+        const Calc tz = DecodeValue<Calc>(translation.getRawValue(2)) * Calc(0.5);
+
+        /// dual = 0.5 * (t, 0) * r
+        Quaternion<Type> dual;
+        dual.setRawValue(0, EncodeValue<Type>( tx * rw + ty * rz - tz * ry));
+        dual.setRawValue(1, EncodeValue<Type>(-tx * rz + ty * rw + tz * rx));
+        dual.setRawValue(2, EncodeValue<Type>( tx * ry - ty * rx + tz * rw));
+        dual.setRawValue(3, EncodeValue<Type>(-tx * rx - ty * ry - tz * rz));
+
+        return DualQuaternion<Type>{ rotation, dual };
+    }
+
+
+    /// <summary>
+    /// Pure translation
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="translation"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::CreateTranslation(const Vector3<Type>& translation)
+    {
+        return CreateFromRotationTranslation(Quaternion<Type>::Identity(), translation);
+    }
+
+
+    /// <summary>
+    /// Rigid transform from a matrix (upper 3x3 must be orthonormal)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="mat"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::CreateFromMatrix(const Matrix4x4<Type>& mat)
+    {
+        DualQuaternion<Type> result;
+        FromMatrix(result, mat);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Explicit constructor (no normalization applied)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="real"></param>
+    /// <param name="dual"></param>
+    template<typename Type>
+    constexpr DualQuaternion<Type>::DualQuaternion(const Quaternion<Type>& real, const Quaternion<Type>& dual)
+        : mReal{ real }, mDual{ dual }
+    {
+    }
+
+
+    /// <summary>
+    /// Rotation part (the real quaternion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> DualQuaternion<Type>::getRotation() const
+    {
+        return mReal;
+    }
+
+
+    /// <summary>
+    /// Translation part
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> DualQuaternion<Type>::getTranslation() const
+    {
+        Vector3<Type> result;
+        GetTranslation(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Translation part into outTranslation
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outTranslation"></param>
+    template<typename Type>
+    inline void DualQuaternion<Type>::getTranslationTo(Vector3<Type>& outTranslation) const
+    {
+        GetTranslation(outTranslation, *this);
+    }
+
+
+    /// <summary>
+    /// Addition operator (component-wise, used for blending)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::operator+(const DualQuaternion& other) const
+    {
+        return DualQuaternion<Type>{ mReal + other.mReal, mDual + other.mDual };
+    }
+
+
+    /// <summary>
+    /// Composition operator (applies other first, then this)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::operator*(const DualQuaternion& other) const
+    {
+        DualQuaternion<Type> result;
+        Multiply(result, *this, other);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Scalar multiplication operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::operator*(Type scalar) const
+    {
+        return DualQuaternion<Type>{ mReal * scalar, mDual * scalar };
+    }
+
+
+    /// <summary>
+    /// Addition assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type>& DualQuaternion<Type>::operator+=(const DualQuaternion& other)
+    {
+        mReal += other.mReal;
+        mDual += other.mDual;
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Composition assignment operator (this = this * other)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type>& DualQuaternion<Type>::operator*=(const DualQuaternion& other)
+    {
+        Multiply(*this, *this, other);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Equality operator (exact compare)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool DualQuaternion<Type>::operator==(const DualQuaternion<Type>& other) const
+    {
+        return mReal == other.mReal && mDual == other.mDual;
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool DualQuaternion<Type>::operator!=(const DualQuaternion<Type>& other) const
+    {
+        return !(*this == other);
+    }
+
+
+    /// <summary>
+    /// Normalized copy (returns the input unchanged if the real part is zero)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::normalize() const
+    {
+        DualQuaternion<Type> result{ *this };
+        Normalize(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Normalize in place
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type>& DualQuaternion<Type>::makeNormalize()
+    {
+        Normalize(*this, *this);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Inverse (returns the input unchanged if the real part is zero)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type> DualQuaternion<Type>::inverse() const
+    {
+        DualQuaternion<Type> result{ *this };
+        Inverse(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Inverse in place
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline DualQuaternion<Type>& DualQuaternion<Type>::makeInverse()
+    {
+        Inverse(*this, *this);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Transform a point (rotation + translation)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="point"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> DualQuaternion<Type>::transformPoint(const Vector3<Type>& point) const
+    {
+        Vector3<Type> result;
+        TransformPoint(result, *this, point);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Transform a point into outResult
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="inPoint"></param>
+    template<typename Type>
+    inline void DualQuaternion<Type>::transformPointTo(Vector3<Type>& outResult, const Vector3<Type>& inPoint) const
+    {
+        TransformPoint(outResult, *this, inPoint);
+    }
+
+
+    /// <summary>
+    /// Transform a direction (rotation only)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="direction"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> DualQuaternion<Type>::transformDirection(const Vector3<Type>& direction) const
+    {
+        Vector3<Type> result;
+        TransformDirection(result, *this, direction);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Transform a direction into outResult
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="inDirection"></param>
+    template<typename Type>
+    inline void DualQuaternion<Type>::transformDirectionTo(Vector3<Type>& outResult, const Vector3<Type>& inDirection) const
+    {
+        TransformDirection(outResult, *this, inDirection);
+    }
+
+
+    /// <summary>
+    /// Rigid transform matrix
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Matrix4x4<Type> DualQuaternion<Type>::toMatrix() const
+    {
+        Matrix4x4<Type> result;
+        ToMatrix(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Rigid transform matrix into outResult
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    template<typename Type>
+    inline void DualQuaternion<Type>::toMatrixTo(Matrix4x4<Type>& outResult) const
+    {
+        ToMatrix(outResult, *this);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers (also present as class member functions.
+
+
+    /// <summary>
+    /// Composition dq1 * dq2 = (r1 * r2, r1 * d2 + d1 * r2) (safe when outResult aliases an input)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="dq1"></param>
+    /// <param name="dq2"></param>
+    template<typename Type>
+    inline void Multiply(DualQuaternion<Type>& outResult, const DualQuaternion<Type>& dq1, const DualQuaternion<Type>& dq2)
+    {
+        Quaternion<Type> real, dualA, dualB;
+        Multiply(real, dq1.getReal(), dq2.getReal());
+        Multiply(dualA, dq1.getReal(), dq2.getDual());
+        Multiply(dualB, dq1.getDual(), dq2.getReal());
+
+        outResult.setReal(real);
+        outResult.setDual(dualA + dualB);
+    }
+
+
+    /// <summary>
+    /// Normalize: divide by |real| and remove the dual component parallel to real, so the result
+    /// is a valid rigid transform (returns false and leaves outResult untouched if real is zero)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="dq"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Normalize(DualQuaternion<Type>& outResult, const DualQuaternion<Type>& dq)
+    {
+        double lengthSq;
+        Dot(lengthSq, dq.getReal(), dq.getReal());
+        if (isZero(lengthSq))
+            return false;
+
+        const double invLength = 1.0 / std::sqrt(lengthSq);
+
+        double real[4], dual[4];
+        double realDotDual = 0.0;
+        for (int i = 0; i < 4; ++i)
+        {
+            real[i] = DecodeValue<double>(dq.getReal().getRawValue(i)) * invLength;
+            dual[i] = DecodeValue<double>(dq.getDual().getRawValue(i)) * invLength;
+            realDotDual += real[i] * dual[i];
+        }
+
+        Quaternion<Type> outReal, outDual;
+        for (int i = 0; i < 4; ++i)
+        {
+            outReal.setRawValue(i, EncodeValue<Type>(real[i]));
+            outDual.setRawValue(i, EncodeValue<Type>(dual[i] - real[i] * realDotDual));
+        }
+
+        outResult.setReal(outReal);
+        outResult.setDual(outDual);
+        return true;
+    }
+
+
+    /// <summary>
+    /// Inverse (r^-1, -r^-1 * d * r^-1). For unit dual quaternions this reduces to the
+    /// quaternion conjugate of both parts. Returns false and leaves outResult untouched if real is zero.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="dq"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Inverse(DualQuaternion<Type>& outResult, const DualQuaternion<Type>& dq)
+    {
+        Quaternion<Type> realInv;
+        if (!Inverse(realInv, dq.getReal()))
+            return false;
+
+        Quaternion<Type> dual;
+        Multiply(dual, realInv, dq.getDual());
+        Multiply(dual, dual, realInv);
+
+        outResult.setReal(realInv);
+        outResult.setDual(-dual);
+        return true;
+    }
+
+
+    /// <summary>
+    /// Translation of a unit dual quaternion: t = 2 * (r.w * d.xyz - d.w * r.xyz + r.xyz x d.xyz)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="dq"></param>
+    template<typename Type>
+    inline void GetTranslation(Vector3<Type>& outResult, const DualQuaternion<Type>& dq)
+    {
+        using Calc = CalcType<Type>;
+
+        const Quaternion<Type>& r = dq.getReal();
+        const Quaternion<Type>& d = dq.getDual();
+
+        const Calc rx = DecodeValue<Calc>(r.getRawValue(0)), ry = DecodeValue<Calc>(r.getRawValue(1));
+        const Calc rz = DecodeValue<Calc>(r.getRawValue(2)), rw = DecodeValue<Calc>(r.getRawValue(3));
+        const Calc dx = DecodeValue<Calc>(d.getRawValue(0)), dy = DecodeValue<Calc>(d.getRawValue(1));
+        const Calc dz = DecodeValue<Calc>(d.getRawValue(2)), dw = DecodeValue<Calc>(d.getRawValue(3));
+
+        outResult.setRawValue(0, EncodeValue<Type>(Calc(2) * (rw * dx - dw * rx + (ry * dz - rz * dy))));
+        outResult.setRawValue(1, EncodeValue<Type>(Calc(2) * (rw * dy - dw * ry + (rz * dx - rx * dz))));
+        outResult.setRawValue(2, EncodeValue<Type>(Calc(2) * (rw * dz - dw * rz + (rx * dy - ry * dx))));
+    }
+
+
+    /// <summary>
+    /// Transform a point: rotate by real, then add the encoded translation
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="dq"></param>
+    /// <param name="point"></param>
+    template<typename Type>
+    inline void TransformPoint(Vector3<Type>& outResult, const DualQuaternion<Type>& dq, const Vector3<Type>& point)
+    {
+        Vector3<Type> translation;
+        GetTranslation(translation, dq);
+        Rotate(outResult, dq.getReal(), point);
+        outResult += translation;
+    }
+
+
+    /// <summary>
+    /// Transform a direction: rotation only
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="dq"></param>
+    /// <param name="direction"></param>
+    template<typename Type>
+    inline void TransformDirection(Vector3<Type>& outResult, const DualQuaternion<Type>& dq, const Vector3<Type>& direction)
+    {
+        Rotate(outResult, dq.getReal(), direction);
+    }
+
+
+    /// <summary>
+    /// Rigid transform matrix from unit dual quaternion
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="dq"></param>
+    template<typename Type>
+    inline void ToMatrix(Matrix4x4<Type>& outResult, const DualQuaternion<Type>& dq)
+    {
+        Vector3<Type> translation;
+        GetTranslation(translation, dq);
+        ToMatrix(outResult, dq.getReal());
+        outResult.setTranslation(translation);
+    }
+
+
+    /// <summary>
+    /// Unit dual quaternion from a rigid transform matrix (scale and shear are not supported)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    inline void FromMatrix(DualQuaternion<Type>& outResult, const Matrix4x4<Type>& mat)
+    {
+        Quaternion<Type> rotation;
+        FromMatrix(rotation, mat);
+        outResult = DualQuaternion<Type>::CreateFromRotationTranslation(rotation, mat.getTranslation());
+    }
+
+} /// namespace ETL::Math
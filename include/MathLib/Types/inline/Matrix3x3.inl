@@ -4,6 +4,7 @@
 ///----------------------------------------------------------------------------
 
 #include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/InstrumentationHook.h"
 #include "MathLib/Common/TypeComparisons.h"
 #include <algorithm>
 #include <cmath>
@@ -19,7 +20,7 @@ namespace ETL::Math
     /// <param name="sY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::CreateScale(double sX, double sY)
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::CreateScale(double sX, double sY)
     {
         return Matrix3x3<Type>{ Raw,
             EncodeValue<Type>(sX), Type(0),               Type(0),
@@ -34,12 +35,18 @@ namespace ETL::Math
     /// </summary>
     /// <typeparam name="Type"></typeparam>
     /// <param name="angleRadians"></param>
+    /// <param name="precision">Fast uses the FastTrig polynomials instead of std::sin/std::cos</param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::CreateRotation(double angleRadians)
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::CreateRotation(double angleRadians, TrigPrecision precision /*= TrigPrecision::Precise*/)
     {
-        const Type cos = EncodeValue<Type>(std::cos(angleRadians));
-        const Type sin = EncodeValue<Type>(std::sin(angleRadians));
+        ETLMATH_INSTRUMENT(Matrix3x3CreateRotation);
+
+        double s, c;
+        SinCos(s, c, angleRadians, precision);
+
+        const Type cos = EncodeValue<Type>(c);
+        const Type sin = EncodeValue<Type>(s);
 
         return Matrix3x3<Type>{ Raw,
             cos,    -sin,     Type(0),
@@ -57,7 +64,7 @@ namespace ETL::Math
     /// <param name="tY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::CreateTranslation(Type tX, Type tY)
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::CreateTranslation(Type tX, Type tY)
     {
         return Matrix3x3<Type>{ Raw,
             EncodeValue<Type>(Type(1)), Type(0),                    EncodeValue<Type>(tX),
@@ -172,12 +179,12 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline Type Matrix3x3<Type>::operator()(int row, int col) const
+    constexpr Type Matrix3x3<Type>::operator()(int row, int col) const
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix3x3 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix3x3 out of bounds COL access");
 
-        return DecodeValue<Type>(m[col][row]);
+        return DecodeValue<Type>(mData[col * COL_SIZE + row]);
     }
 
 
@@ -188,12 +195,12 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline ElementProxy<Type> Matrix3x3<Type>::operator()(int row, int col)
+    constexpr ElementProxy<Type> Matrix3x3<Type>::operator()(int row, int col)
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix3x3 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix3x3 out of bounds COL access");
 
-        return ElementProxy<Type>{ m[col][row] };
+        return ElementProxy<Type>{ mData[col * COL_SIZE + row] };
     }
 
 
@@ -204,7 +211,7 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline Type Matrix3x3<Type>::operator[](int elem) const
+    constexpr Type Matrix3x3<Type>::operator[](int elem) const
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix3x3 out of bounds ELEM access");
 
@@ -219,7 +226,7 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline ElementProxy<Type> Matrix3x3<Type>::operator[](int elem)
+    constexpr ElementProxy<Type> Matrix3x3<Type>::operator[](int elem)
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix3x3 out of bounds ELEM access");
 
@@ -234,7 +241,7 @@ namespace ETL::Math
     /// <param name="colIndex"></param>
     /// <returns>Column as Vector3</returns>
     template<typename Type>
-    inline Vector3<Type> Matrix3x3<Type>::getCol(int colIndex) const
+    constexpr Vector3<Type> Matrix3x3<Type>::getCol(int colIndex) const
     {
         Vector3<Type> result;
         GetCol(result, *this, colIndex);
@@ -249,7 +256,7 @@ namespace ETL::Math
     /// <param name="rowIndex"></param>
     /// <returns>Row as Vector3</returns>
     template<typename Type>
-    inline Vector3<Type> Matrix3x3<Type>::getRow(int rowIndex) const
+    constexpr Vector3<Type> Matrix3x3<Type>::getRow(int rowIndex) const
     {
         Vector3<Type> result;
         GetRow(result, *this, rowIndex);
@@ -264,7 +271,7 @@ namespace ETL::Math
     /// <param name="outValue"></param>
     /// <param name="colIndex"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::getColTo(Vector3<Type>& outValue, int colIndex) const
+    constexpr void Matrix3x3<Type>::getColTo(Vector3<Type>& outValue, int colIndex) const
     {
         GetCol(outValue, *this, colIndex);
     }
@@ -277,7 +284,7 @@ namespace ETL::Math
     /// <param name="outValue"></param>
     /// <param name="rowIndex"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::getRowTo(Vector3<Type>& outValue, int rowIndex) const
+    constexpr void Matrix3x3<Type>::getRowTo(Vector3<Type>& outValue, int rowIndex) const
     {
         GetRow(outValue, *this, rowIndex);
     }
@@ -292,7 +299,7 @@ namespace ETL::Math
     /// <param name="c1"></param>
     /// <param name="c2"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::setCol(int col, Type c0, Type c1, Type c2)
+    constexpr void Matrix3x3<Type>::setCol(int col, Type c0, Type c1, Type c2)
     {
         SetCol(*this, *this, col, Vector3<Type>{c0, c1, c2});
     }
@@ -307,7 +314,7 @@ namespace ETL::Math
     /// <param name="r1"></param>
     /// <param name="r2"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::setRow(int row, Type r0, Type r1, Type r2)
+    constexpr void Matrix3x3<Type>::setRow(int row, Type r0, Type r1, Type r2)
     {
         SetRow(*this, *this, row, Vector3<Type>{r0, r1, r2});
     }
@@ -320,7 +327,7 @@ namespace ETL::Math
     /// <param name="col"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::setCol(int col, const Vector3<Type>& value)
+    constexpr void Matrix3x3<Type>::setCol(int col, const Vector3<Type>& value)
     {
         SetCol(*this, *this, col, value);
     }
@@ -333,7 +340,7 @@ namespace ETL::Math
     /// <param name="row"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::setRow(int row, const Vector3<Type>& value)
+    constexpr void Matrix3x3<Type>::setRow(int row, const Vector3<Type>& value)
     {
         SetRow(*this, *this, row, value);
     }
@@ -346,11 +353,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::operator+(const Matrix3x3& other) const
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::operator+(const Matrix3x3& other) const
     {
-        return Matrix3x3<Type>{ Raw, m00 + other.m00, m01 + other.m01, m02 + other.m02,
-                                     m10 + other.m10, m11 + other.m11, m12 + other.m12,
-                                     m20 + other.m20, m21 + other.m21, m22 + other.m22 };
+        Matrix3x3<Type> result{ *this };
+        result += other;
+        return result;
     }
 
 
@@ -361,11 +368,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::operator-(const Matrix3x3& other) const
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::operator-(const Matrix3x3& other) const
     {
-        return Matrix3x3<Type>{ Raw, m00 - other.m00, m01 - other.m01, m02 - other.m02,
-                                     m10 - other.m10, m11 - other.m11, m12 - other.m12,
-                                     m20 - other.m20, m21 - other.m21, m22 - other.m22 };
+        Matrix3x3<Type> result{ *this };
+        result -= other;
+        return result;
     }
 
 
@@ -376,7 +383,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::operator*(const Matrix3x3& other) const
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::operator*(const Matrix3x3& other) const
     {
         Matrix3x3<Type> result;
         Multiply(result, *this, other);
@@ -391,7 +398,7 @@ namespace ETL::Math
     /// <param name="vector"></param>
     /// <returns>Resulting vector</returns>
     template<typename Type>
-    inline Vector3<Type> Matrix3x3<Type>::operator*(const Vector3<Type>& vector) const
+    constexpr Vector3<Type> Matrix3x3<Type>::operator*(const Vector3<Type>& vector) const
     {
         Vector3<Type> result;
         Multiply(result, *this, vector);
@@ -406,11 +413,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::operator*(Type scalar) const
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::operator*(Type scalar) const
     {
-        return Matrix3x3<Type>{ Raw, m00 * scalar, m01 * scalar, m02 * scalar,
-                                     m10 * scalar, m11 * scalar, m12 * scalar,
-                                     m20 * scalar, m21 * scalar, m22 * scalar };
+        Matrix3x3<Type> result{ *this };
+        result *= scalar;
+        return result;
     }
 
 
@@ -421,24 +428,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::operator/(Type scalar) const
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::operator/(Type scalar) const
     {
-        ETLMATH_ASSERT(!isZeroRaw(scalar), "Matrix3x3 division by 0");
-
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            return Matrix3x3<Type>{ Raw, m00 / scalar, m01 / scalar, m02 / scalar,
-                                         m10 / scalar, m11 / scalar, m12 / scalar,
-                                         m20 / scalar, m21 / scalar, m22 / scalar };
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            return Matrix3x3<Type>{ Raw, m00 * inv, m01 * inv, m02 * inv,
-                                         m10 * inv, m11 * inv, m12 * inv,
-                                         m20 * inv, m21 * inv, m22 * inv };
-        }
+        Matrix3x3<Type> result{ *this };
+        result /= scalar;
+        return result;
     }
 
 
@@ -449,11 +443,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::operator+=(const Matrix3x3& other)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::operator+=(const Matrix3x3& other)
     {
-        for (int i = 0; i < NUM_ELEM; ++i)
-            mData[i] += other.mData[i];
-
+        helpers::AddRaw<Type, NUM_ELEM>(mData, other.mData);
         return *this;
     }
 
@@ -465,11 +457,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::operator-=(const Matrix3x3& other)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::operator-=(const Matrix3x3& other)
     {
-        for (int i = 0; i < NUM_ELEM; ++i)
-            mData[i] -= other.mData[i];
-
+        helpers::SubtractRaw<Type, NUM_ELEM>(mData, other.mData);
         return *this;
     }
 
@@ -481,7 +471,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::operator*=(const Matrix3x3& other)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::operator*=(const Matrix3x3& other)
     {
         Multiply(*this, *this, other);
 
@@ -496,11 +486,9 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::operator*=(Type scalar)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::operator*=(Type scalar)
     {
-        for (int i = 0; i < NUM_ELEM; ++i)
-            mData[i] *= scalar;
-
+        helpers::ScaleRaw<Type, NUM_ELEM>(mData, scalar);
         return *this;
     }
 
@@ -512,24 +500,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::operator/=(Type scalar)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::operator/=(Type scalar)
     {
         ETLMATH_ASSERT(!isZeroRaw(scalar), "Matrix3x3 division by 0");
 
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            for (int i = 0; i < NUM_ELEM; ++i)
-                mData[i] /= scalar;
-        }
-        else
-        {
-            /// Compute inverse and multiply (avoids extra divisions)
-            const Type inv = Type(1) / scalar;
-            for (int i = 0; i < NUM_ELEM; ++i)
-                mData[i] *= inv;
-        }
-
+        helpers::DivideRaw<Type, NUM_ELEM>(mData, scalar);
         return *this;
     }
 
@@ -541,7 +516,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Matrix3x3<Type>::operator==(const Matrix3x3<Type>& other) const
+    constexpr bool Matrix3x3<Type>::operator==(const Matrix3x3<Type>& other) const
     {
         return std::equal(mData, mData + NUM_ELEM, other.mData);
     }
@@ -554,7 +529,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Matrix3x3<Type>::operator!=(const Matrix3x3<Type>& other) const
+    constexpr bool Matrix3x3<Type>::operator!=(const Matrix3x3<Type>& other) const
     {
         return !(*this == other);
     }
@@ -567,7 +542,7 @@ namespace ETL::Math
     /// <param name="point"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Matrix3x3<Type>::transformPoint(const Vector2<Type>& point) const
+    constexpr Vector2<Type> Matrix3x3<Type>::transformPoint(const Vector2<Type>& point) const
     {
         Vector2<Type> result;
         TransformPoint(result, *this, point);
@@ -582,7 +557,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="point"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::transformPointTo(Vector2<Type>& outResult, const Vector2<Type>& point) const
+    constexpr void Matrix3x3<Type>::transformPointTo(Vector2<Type>& outResult, const Vector2<Type>& point) const
     {
         TransformPoint(outResult, *this, point);
     }
@@ -594,7 +569,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="inOutPoint"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::transformPointInPlace(Vector2<Type>& inOutPoint) const
+    constexpr void Matrix3x3<Type>::transformPointInPlace(Vector2<Type>& inOutPoint) const
     {
         TransformPoint(inOutPoint, *this, inOutPoint);
     }
@@ -607,7 +582,7 @@ namespace ETL::Math
     /// <param name="point"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Matrix3x3<Type>::transformDirection(const Vector2<Type>& direction) const
+    constexpr Vector2<Type> Matrix3x3<Type>::transformDirection(const Vector2<Type>& direction) const
     {
         Vector2<Type> result;
         TransformDirection(result, *this, direction);
@@ -622,7 +597,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="direction"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::transformDirectionTo(Vector2<Type>& outResult, const Vector2<Type>& direction) const
+    constexpr void Matrix3x3<Type>::transformDirectionTo(Vector2<Type>& outResult, const Vector2<Type>& direction) const
     {
         TransformDirection(outResult, *this, direction);
     }
@@ -634,7 +609,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="direction"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::transformDirectionInPlace(Vector2<Type>& inOutDirection) const
+    constexpr void Matrix3x3<Type>::transformDirectionInPlace(Vector2<Type>& inOutDirection) const
     {
         TransformDirection(inOutDirection, *this, inOutDirection);
     }
@@ -648,7 +623,7 @@ namespace ETL::Math
     /// <param name="sY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::scale(double sX, double sY)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::scale(double sX, double sY)
     {
         Scale(*this, *this, Vector2<double>{sX, sY});
         return *this;
@@ -663,7 +638,7 @@ namespace ETL::Math
     /// <param name="sY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::scale(const Vector2<double>& scaleVec)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::scale(const Vector2<double>& scaleVec)
     {
         Scale(*this, *this, scaleVec);
         return *this;
@@ -692,7 +667,7 @@ namespace ETL::Math
     /// <param name="tY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::translate(Type tX, Type tY)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::translate(Type tX, Type tY)
     {
         Translate(*this, *this, Vector2<Type>{tX, tY});
         return *this;
@@ -706,7 +681,7 @@ namespace ETL::Math
     /// <param name="pos"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::translate(const Vector2<Type>& translation)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::translate(const Vector2<Type>& translation)
     {
         Translate(*this, *this, translation);
         return *this;
@@ -747,11 +722,12 @@ namespace ETL::Math
     /// </summary>
     /// <typeparam name="Type"></typeparam>
     /// <param name="newAngleRad"></param>
+    /// <param name="precision"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::setRotation(double newAngleRad)
+    inline Matrix3x3<Type>& Matrix3x3<Type>::setRotation(double newAngleRad, TrigPrecision precision /*= TrigPrecision::Precise*/)
     {
-        SetRotation(*this, *this, newAngleRad);
+        SetRotation(*this, *this, newAngleRad, precision);
         return *this;
     }
 
@@ -764,7 +740,7 @@ namespace ETL::Math
     /// <param name="newTY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::setTranslation(Type newTX, Type newTY)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::setTranslation(Type newTX, Type newTY)
     {
         SetTranslation(*this, *this, Vector2<Type>{newTX, newTY});
         return *this;
@@ -778,7 +754,7 @@ namespace ETL::Math
     /// <param name="newTranslation"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::setTranslation(const Vector2<Type>& newTranslation)
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::setTranslation(const Vector2<Type>& newTranslation)
     {
         SetTranslation(*this, *this, newTranslation);
         return *this;
@@ -819,7 +795,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Matrix3x3<Type>::getTranslation() const
+    constexpr Vector2<Type> Matrix3x3<Type>::getTranslation() const
     {
         Vector2<Type> result;
         GetTranslation(result, *this);
@@ -857,7 +833,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="outTranslation"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::getTranslationTo(Vector2<Type>& outTranslation) const
+    constexpr void Matrix3x3<Type>::getTranslationTo(Vector2<Type>& outTranslation) const
     {
         GetTranslation(outTranslation, *this);
     }
@@ -869,7 +845,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Matrix3x3<Type>::determinant(bool bFixedPoint /*= false*/) const
+    constexpr Type Matrix3x3<Type>::determinant(bool bFixedPoint /*= false*/) const
     {
         Type result;
         Determinant(result, *this, bFixedPoint);
@@ -884,7 +860,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="bFixedPoint"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::determinantTo(Type& outResult, bool bFixedPoint /*= false*/) const
+    constexpr void Matrix3x3<Type>::determinantTo(Type& outResult, bool bFixedPoint /*= false*/) const
     {
         Determinant(outResult, *this, bFixedPoint);
     }
@@ -896,7 +872,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::inverse() const
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::inverse() const
     {
         Matrix3x3<Type> result;
         Inverse(result, *this);
@@ -910,7 +886,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="outResult"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::inverseTo(Matrix3x3<Type>& outResult) const
+    constexpr void Matrix3x3<Type>::inverseTo(Matrix3x3<Type>& outResult) const
     {
         Inverse(outResult, *this);
     }
@@ -922,7 +898,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type>& Matrix3x3<Type>::makeInverse()
+    constexpr Matrix3x3<Type>& Matrix3x3<Type>::makeInverse()
     {
         Inverse(*this, *this);
         return *this;
@@ -935,7 +911,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> Matrix3x3<Type>::transpose() const
+    constexpr Matrix3x3<Type> Matrix3x3<Type>::transpose() const
     {
         Matrix3x3<Type> result;
         Transpose(result, *this);
@@ -949,7 +925,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="outResult"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::transposeTo(Matrix3x3<Type>& outResult) const
+    constexpr void Matrix3x3<Type>::transposeTo(Matrix3x3<Type>& outResult) const
     {
         Transpose(outResult, *this);
     };
@@ -976,11 +952,11 @@ namespace ETL::Math
     /// <param name="col"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Matrix3x3<Type>::getRawValue(int row, int col) const
+    constexpr Type Matrix3x3<Type>::getRawValue(int row, int col) const
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix3x3 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix3x3 out of bounds COL access");
-        return m[col][row];
+        return mData[col * COL_SIZE + row];
     }
 
 
@@ -991,7 +967,7 @@ namespace ETL::Math
     /// <param name="elem"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Matrix3x3<Type>::getRawValue(int elem) const
+    constexpr Type Matrix3x3<Type>::getRawValue(int elem) const
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix3x3 out of bounds ELEM access");
         return mData[elem];
@@ -1006,11 +982,11 @@ namespace ETL::Math
     /// <param name="col"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::setRawValue(int row, int col, Type value)
+    constexpr void Matrix3x3<Type>::setRawValue(int row, int col, Type value)
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix3x3 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix3x3 out of bounds COL access");
-        m[col][row] = value;
+        mData[col * COL_SIZE + row] = value;
     }
 
 
@@ -1021,16 +997,249 @@ namespace ETL::Math
     /// <param name="elem"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix3x3<Type>::setRawValue(int elem, Type value)
+    constexpr void Matrix3x3<Type>::setRawValue(int elem, Type value)
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix3x3 out of bounds ELEM access");
         mData[elem] = value;
     }
 
 
+    /// <summary>
+    /// Unchecked raw column access: COL_SIZE contiguous storage values (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type>
+    constexpr const Type* Matrix3x3<Type>::getRawCol(int col) const
+    {
+        return mData + col * COL_SIZE;
+    }
+
+
+    /// <summary>
+    /// Unchecked raw column access: COL_SIZE contiguous storage values (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type>
+    constexpr Type* Matrix3x3<Type>::getRawCol(int col)
+    {
+        return mData + col * COL_SIZE;
+    }
+
+
+    /// <summary>
+    /// Unchecked raw row gather into COL_SIZE values (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outRow"></param>
+    /// <param name="row"></param>
+    template<typename Type>
+    constexpr void Matrix3x3<Type>::getRawRowTo(Type* outRow, int row) const
+    {
+        for (int col = 0; col < COL_SIZE; ++col)
+            outRow[col] = mData[col * COL_SIZE + row];
+    }
+
+
+    /// <summary>
+    /// Unchecked raw element access (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="row"></param>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type>
+    constexpr Type Matrix3x3<Type>::getRawValueUnchecked(int row, int col) const
+    {
+        return mData[col * COL_SIZE + row];
+    }
+
+
     ///------------------------------------------------------------------------------------------
     /// Free functions - implement logic
 
+    /// <summary>
+    /// Matrix * Vector
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    /// <param name="vec"></param>
+    template<typename Type>
+    constexpr void Multiply(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector3<Type>& vec)
+    {
+        ETLMATH_INSTRUMENT(Matrix3x3MultiplyVector);
+
+        /// Gathered once, the result is stored last: outResult may alias vec
+        const Type v[3] = { vec.getRawValue(0), vec.getRawValue(1), vec.getRawValue(2) };
+        Type result[3];
+        helpers::MultiplyRaw<Type, 3, 3, 1>(result, mat.getRawCol(0), v);
+
+        for (int row = 0; row < Matrix3x3<Type>::COL_SIZE; ++row)
+            outResult.setRawValue(row, result[row]);
+    }
+
+
+
+    /// <summary>
+    /// Matrix * Matrix
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mA"></param>
+    /// <param name="mB"></param>
+    template<typename Type>
+    constexpr void Multiply(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mA, const Matrix3x3<Type>& mB)
+    {
+        ETLMATH_INSTRUMENT(Matrix3x3Multiply);
+
+        /// Computed into a local buffer first, so outResult may alias mA or mB
+        Type result[Matrix3x3<Type>::NUM_ELEM];
+        helpers::MultiplyRaw<Type, 3, 3, 3>(result, mA.getRawCol(0), mB.getRawCol(0));
+
+        for (int i = 0; i < Matrix3x3<Type>::NUM_ELEM; ++i)
+            outResult.setRawValue(i, result[i]);
+    }
+
+
+
+    /// <summary>
+    /// Compute Determinant
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    constexpr void Determinant(Type& outResult, const Matrix3x3<Type>& mat, bool bFixedPoint /*= false*/)
+    {
+        if constexpr (std::integral<Type>)
+        {
+            /// 1. Calculate the determinant components using 64-bit integers.
+            /// Each term is scaled by FIXED_ONE, so the determinant ->
+            /// (FIXED_ONE * FIXED_ONE * FIXED_ONE) = FIXED_ONE^3. -> is scaled thrice, but 
+            /// we de-scale after each multiply to avoid overflows
+            const int64_t det_fixed = ((((static_cast<int64_t>(mat.getRawValue(0,0)) * mat.getRawValue(1,1)) >> FIXED_SHIFT) * mat.getRawValue(2,2)) >> FIXED_SHIFT)
+                                    + ((((static_cast<int64_t>(mat.getRawValue(0,1)) * mat.getRawValue(1,2)) >> FIXED_SHIFT) * mat.getRawValue(2,0)) >> FIXED_SHIFT)
+                                    + ((((static_cast<int64_t>(mat.getRawValue(0,2)) * mat.getRawValue(1,0)) >> FIXED_SHIFT) * mat.getRawValue(2,1)) >> FIXED_SHIFT)
+                                    - ((((static_cast<int64_t>(mat.getRawValue(0,2)) * mat.getRawValue(1,1)) >> FIXED_SHIFT) * mat.getRawValue(2,0)) >> FIXED_SHIFT)
+                                    - ((((static_cast<int64_t>(mat.getRawValue(0,0)) * mat.getRawValue(1,2)) >> FIXED_SHIFT) * mat.getRawValue(2,1)) >> FIXED_SHIFT)
+                                    - ((((static_cast<int64_t>(mat.getRawValue(0,1)) * mat.getRawValue(1,0)) >> FIXED_SHIFT) * mat.getRawValue(2,2)) >> FIXED_SHIFT);
+
+            outResult = static_cast<Type>(bFixedPoint ? det_fixed : det_fixed >> FIXED_SHIFT);
+        }
+        else
+        {
+            outResult = mat(0,0) * mat(1,1) * mat(2,2) 
+                      + mat(0,1) * mat(1,2) * mat(2,0)
+                      + mat(0,2) * mat(1,0) * mat(2,1)
+                      - mat(0,2) * mat(1,1) * mat(2,0)
+                      - mat(0,0) * mat(1,2) * mat(2,1)
+                      - mat(0,1) * mat(1,0) * mat(2,2);
+        }
+    }
+
+
+
+    /// <summary>
+    /// Compute Inverse
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    constexpr bool Inverse(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat)
+    {
+        /// --- SAFETY CHECK FOR ALIASING ---
+        /// If outResult is the same object as mat, we must use a temporary buffer.
+        if (&outResult == &mat)
+        {
+            Matrix3x3<Type> temp;
+            bool ok = Inverse(temp, mat);
+
+            if (ok)
+                outResult = temp;
+
+            return ok;
+        }
+
+        ETLMATH_INSTRUMENT(Matrix3x3Inverse);
+
+        Type det;
+        Determinant(det, mat, true);
+        if (isZero(det))
+            return false;
+
+        if constexpr (std::integral<Type>)
+        {
+            /// Calculate Adjugate elements safely using 64-bit integers.
+            /// This array of int64 is ESSENTIAL to prevent overflow (FX * FX = FX^2) due to double scale
+            const int64_t adjugate_64[Matrix3x3<Type>::NUM_ELEM]{
+                static_cast<int64_t>(mat.getRawValue(1,1)) * mat.getRawValue(2,2) - static_cast<int64_t>(mat.getRawValue(1,2)) * mat.getRawValue(2,1),
+                static_cast<int64_t>(mat.getRawValue(0,2)) * mat.getRawValue(2,1) - static_cast<int64_t>(mat.getRawValue(0,1)) * mat.getRawValue(2,2),
+                static_cast<int64_t>(mat.getRawValue(0,1)) * mat.getRawValue(1,2) - static_cast<int64_t>(mat.getRawValue(0,2)) * mat.getRawValue(1,1),
+                static_cast<int64_t>(mat.getRawValue(1,2)) * mat.getRawValue(2,0) - static_cast<int64_t>(mat.getRawValue(1,0)) * mat.getRawValue(2,2),
+                static_cast<int64_t>(mat.getRawValue(0,0)) * mat.getRawValue(2,2) - static_cast<int64_t>(mat.getRawValue(0,2)) * mat.getRawValue(2,0),
+                static_cast<int64_t>(mat.getRawValue(0,2)) * mat.getRawValue(1,0) - static_cast<int64_t>(mat.getRawValue(0,0)) * mat.getRawValue(1,2),
+                static_cast<int64_t>(mat.getRawValue(1,0)) * mat.getRawValue(2,1) - static_cast<int64_t>(mat.getRawValue(1,1)) * mat.getRawValue(2,0),
+                static_cast<int64_t>(mat.getRawValue(0,1)) * mat.getRawValue(2,0) - static_cast<int64_t>(mat.getRawValue(0,0)) * mat.getRawValue(2,1),
+                static_cast<int64_t>(mat.getRawValue(0,0)) * mat.getRawValue(1,1) - static_cast<int64_t>(mat.getRawValue(0,1)) * mat.getRawValue(1,0)
+            };
+
+            /// Cast back to Type only after dividing by "det".
+            /// Adj(FX^2) / Det(FX) = Result(FX) -> result scaled only once, as expected
+            outResult.setRawValue(0, 0, static_cast<Type>(adjugate_64[0] / det));
+            outResult.setRawValue(0, 1, static_cast<Type>(adjugate_64[1] / det));
+            outResult.setRawValue(0, 2, static_cast<Type>(adjugate_64[2] / det));
+            outResult.setRawValue(1, 0, static_cast<Type>(adjugate_64[3] / det));
+            outResult.setRawValue(1, 1, static_cast<Type>(adjugate_64[4] / det));
+            outResult.setRawValue(1, 2, static_cast<Type>(adjugate_64[5] / det));
+            outResult.setRawValue(2, 0, static_cast<Type>(adjugate_64[6] / det));
+            outResult.setRawValue(2, 1, static_cast<Type>(adjugate_64[7] / det));
+            outResult.setRawValue(2, 2, static_cast<Type>(adjugate_64[8] / det));
+        }
+        else
+        {
+            /// adjugate
+            outResult.setRawValue(0, 0, mat(1,1) * mat(2,2) - mat(1,2) * mat(2,1));
+            outResult.setRawValue(0, 1, mat(0,2) * mat(2,1) - mat(0,1) * mat(2,2));
+            outResult.setRawValue(0, 2, mat(0,1) * mat(1,2) - mat(0,2) * mat(1,1));
+            outResult.setRawValue(1, 0, mat(1,2) * mat(2,0) - mat(1,0) * mat(2,2));
+            outResult.setRawValue(1, 1, mat(0,0) * mat(2,2) - mat(0,2) * mat(2,0));
+            outResult.setRawValue(1, 2, mat(0,2) * mat(1,0) - mat(0,0) * mat(1,2));
+            outResult.setRawValue(2, 0, mat(1,0) * mat(2,1) - mat(1,1) * mat(2,0));
+            outResult.setRawValue(2, 1, mat(0,1) * mat(2,0) - mat(0,0) * mat(2,1));
+            outResult.setRawValue(2, 2, mat(0,0) * mat(1,1) - mat(0,1) * mat(1,0));
+
+            /// apply det
+            outResult /= det;
+        }
+
+        return true;
+    }
+
+
+
+    /// <summary>
+    /// Compute Transpose
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    constexpr void Transpose(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat)
+    {
+        /// Computed into a local buffer first, so outResult may alias mat
+        Type result[Matrix3x3<Type>::NUM_ELEM];
+        helpers::TransposeRaw<Type, 3, 3>(result, mat.getRawCol(0));
+
+        for (int i = 0; i < Matrix3x3<Type>::NUM_ELEM; ++i)
+            outResult.setRawValue(i, result[i]);
+    }
+
+
     /// <summary>
     /// Column getter
     /// </summary>
@@ -1039,7 +1248,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="index"></param>
     template<typename Type>
-    inline void GetCol(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index)
+    constexpr void GetCol(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix3x3<Type>::COL_SIZE, "Matrix3x3 out of bounds ROW access");
 
@@ -1057,7 +1266,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="index"></param>
     template<typename Type>
-    inline void GetRow(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index)
+    constexpr void GetRow(Vector3<Type>& outResult, const Matrix3x3<Type>& mat, int index)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix3x3<Type>::COL_SIZE, "Matrix3x3 out of bounds ROW access");
 
@@ -1076,7 +1285,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <param name="col"></param>
     template<typename Type>
-    inline void SetCol(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& col)
+    constexpr void SetCol(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& col)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix3x3<Type>::COL_SIZE, "Matrix3x3 out of bounds ROW access");
 
@@ -1100,7 +1309,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <param name="row"></param>
     template<typename Type>
-    inline void SetRow(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& row)
+    constexpr void SetRow(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, int index, const Vector3<Type>& row)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix3x3<Type>::COL_SIZE, "Matrix3x3 out of bounds ROW access");
 
@@ -1123,7 +1332,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="point"></param>
     template<typename Type>
-    inline void TransformPoint(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& point)
+    constexpr void TransformPoint(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& point)
     {
         if constexpr (std::integral<Type>)
         {
@@ -1152,7 +1361,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="direction"></param>
     template<typename Type>
-    inline void TransformDirection(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& direction)
+    constexpr void TransformDirection(Vector2<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& direction)
     {
         if constexpr (std::integral<Type>)
         {
@@ -1181,7 +1390,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="translation"></param>
     template<typename Type>
-    inline void Translate(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation)
+    constexpr void Translate(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation)
     {
         outResult.setRawValue(0, 2, mat.getRawValue(0, 2) + translation.getRawValue(0));
         outResult.setRawValue(1, 2, mat.getRawValue(1, 2) + translation.getRawValue(1));
@@ -1207,7 +1416,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="translation"></param>
     template<typename Type>
-    inline void SetTranslation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation)
+    constexpr void SetTranslation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<Type>& translation)
     {
         outResult.setRawValue(0, 2, translation.getRawValue(0));
         outResult.setRawValue(1, 2, translation.getRawValue(1));
@@ -1232,7 +1441,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="mat"></param>
     template<typename Type>
-    inline void GetTranslation(Vector2<Type>& outResult, const Matrix3x3<Type>& mat)
+    constexpr void GetTranslation(Vector2<Type>& outResult, const Matrix3x3<Type>& mat)
     {
         outResult.setRawValue(0, mat.getRawValue(0, 2));
         outResult.setRawValue(1, mat.getRawValue(1, 2));
@@ -1254,8 +1463,8 @@ namespace ETL::Math
         const Type xBasis[2]{ mat.getRawValue(0,0), mat.getRawValue(1,0) };  /// X-axis basis vector -> COL 0
         const Type yBasis[2]{ mat.getRawValue(0,1), mat.getRawValue(1,1) };  /// Y-axis basis vector -> COL 1
 
-        const double c = std::cos(angleRad);
-        const double s = std::sin(angleRad);
+        double s, c;
+        SinCos(s, c, angleRad, TrigPrecision::Precise);
 
         outResult.setRawValue(0, 0, static_cast<Type>(xBasis[0] * c - xBasis[1] * s));  /// New X-basis x-component
         outResult.setRawValue(1, 0, static_cast<Type>(xBasis[0] * s + xBasis[1] * c));  /// New X-basis y-component
@@ -1280,14 +1489,15 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="mat"></param>
     /// <param name="angleRad"></param>
+    /// <param name="precision"></param>
     template<typename Type>
-    inline void SetRotation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, double angleRad)
+    inline void SetRotation(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, double angleRad, TrigPrecision precision /*= TrigPrecision::Precise*/)
     {
         Vector2<double> scale;
         GetScaling(scale, mat);
 
-        const double c = std::cos(angleRad);
-        const double s = std::sin(angleRad);
+        double s, c;
+        SinCos(s, c, angleRad, precision);
 
         outResult.setRawValue(0, 0, EncodeValue<Type>( c * scale.x()));
         outResult.setRawValue(1, 0, EncodeValue<Type>( s * scale.x()));
@@ -1330,7 +1540,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="scale"></param>
     template<typename Type>
-    inline void Scale(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<double>& scale)
+    constexpr void Scale(Matrix3x3<Type>& outResult, const Matrix3x3<Type>& mat, const Vector2<double>& scale)
     {
         outResult.setRawValue(0, 0, static_cast<Type>(mat.getRawValue(0, 0) * scale.getRawValue(0)));
         outResult.setRawValue(1, 0, static_cast<Type>(mat.getRawValue(1, 0) * scale.getRawValue(0)));
@@ -1361,8 +1571,8 @@ namespace ETL::Math
         double rotation;
         GetRotation(rotation, mat);
 
-        const double c = std::cos(rotation);
-        const double s = std::sin(rotation);
+        double s, c;
+        SinCos(s, c, rotation, TrigPrecision::Precise);
 
         outResult.setRawValue(0, 0, EncodeValue<Type>( c * scale.getRawValue(0)));
         outResult.setRawValue(1, 0, EncodeValue<Type>( s * scale.getRawValue(0)));
@@ -1408,7 +1618,7 @@ namespace ETL::Math
     /// <param name="matrix"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix3x3<Type> operator*(Type scalar, const Matrix3x3<Type>& matrix)
+    constexpr Matrix3x3<Type> operator*(Type scalar, const Matrix3x3<Type>& matrix)
     {
         return matrix * scalar;
     }
@@ -4,10 +4,12 @@
 ///----------------------------------------------------------------------------
 
 #include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/InstrumentationHook.h"
 #include "MathLib/Common/Constants.h"
 #include "MathLib/Common/TypeComparisons.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace ETL::Math
 {
@@ -20,7 +22,7 @@ namespace ETL::Math
     /// <param name="sY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::CreateScale(double sX, double sY, double sZ)
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::CreateScale(double sX, double sY, double sZ)
     {
         return Matrix4x4<Type>{ Raw,
             EncodeValue<Type>(sX), Type(0),               Type(0),               Type(0),
@@ -36,17 +38,20 @@ namespace ETL::Math
     /// Combined rotation matrix using ZYX Euler order
     /// </summary>
     /// <typeparam name="Type"></typeparam>
-    /// <param name="angleRadians"></param>
+    /// <param name="rX"></param>
+    /// <param name="rY"></param>
+    /// <param name="rZ"></param>
+    /// <param name="precision">Fast uses the FastTrig polynomials instead of std::sin/std::cos</param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::CreateRotation(double rX, double rY, double rZ)
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::CreateRotation(double rX, double rY, double rZ, TrigPrecision precision /*= TrigPrecision::Precise*/)
     {
-        const double cosX = std::cos(rX);
-        const double sinX = std::sin(rX);
-        const double cosY = std::cos(rY);
-        const double sinY = std::sin(rY);
-        const double cosZ = std::cos(rZ);
-        const double sinZ = std::sin(rZ);
+        ETLMATH_INSTRUMENT(Matrix4x4CreateRotation);
+
+        double sinX, cosX, sinY, cosY, sinZ, cosZ;
+        SinCos(sinX, cosX, rX, precision);
+        SinCos(sinY, cosY, rY, precision);
+        SinCos(sinZ, cosZ, rZ, precision);
 
         return Matrix4x4<Type>{ Raw,
             EncodeValue<Type>(cosY * cosZ),
@@ -74,7 +79,7 @@ namespace ETL::Math
     /// <param name="tY"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::CreateTranslation(Type tX, Type tY, Type tZ)
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::CreateTranslation(Type tX, Type tY, Type tZ)
     {
         return Matrix4x4<Type>{ Raw,
             EncodeValue<Type>(Type(1)), Type(0),                    Type(0),                    EncodeValue<Type>(tX),
@@ -85,6 +90,170 @@ namespace ETL::Math
     }
 
 
+    /// <summary>
+    /// 3D Projection Factory - Perspective Matrix (right-handed, view space looks down -Z).
+    /// Pass an infinite zFar (or use CreatePerspectiveInfinite) for an infinite far plane.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="fovY">Vertical field of view (radians)</param>
+    /// <param name="aspect">Width / height</param>
+    /// <param name="zNear">Near plane distance (> 0)</param>
+    /// <param name="zFar">Far plane distance (> zNear, may be infinite)</param>
+    /// <param name="depth">Clip-space depth convention</param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Matrix4x4<Type> Matrix4x4<Type>::CreatePerspective(double fovY, double aspect, double zNear, double zFar,
+                                                              DepthRange depth /*= DepthRange::NegativeOneToOne*/)
+    {
+        ETLMATH_ASSERT(zNear > 0.0 && zFar > zNear, "Invalid near/far planes in CreatePerspective");
+        ETLMATH_ASSERT(!isZero(aspect), "Invalid aspect ratio in CreatePerspective");
+
+        const double f = 1.0 / std::tan(fovY * 0.5);
+        const bool bInfinite = std::isinf(zFar);
+
+        /// clip.z = a * z + b, clip.w = -z
+        double a, b;
+        switch (depth)
+        {
+        case DepthRange::ZeroToOne:
+            a = bInfinite ? -1.0   : zFar / (zNear - zFar);
+            b = bInfinite ? -zNear : zNear * zFar / (zNear - zFar);
+            break;
+        case DepthRange::ReversedZ:
+            a = bInfinite ? 0.0   : zNear / (zFar - zNear);
+            b = bInfinite ? zNear : zNear * zFar / (zFar - zNear);
+            break;
+        default:
+            a = bInfinite ? -1.0         : (zFar + zNear) / (zNear - zFar);
+            b = bInfinite ? -2.0 * zNear : 2.0 * zNear * zFar / (zNear - zFar);
+            break;
+        }
+
+        return Matrix4x4<Type>{ Raw,
+            EncodeValue<Type>(f / aspect), Type(0),              Type(0),                 Type(0),
+            Type(0),                       EncodeValue<Type>(f), Type(0),                 Type(0),
+            Type(0),                       Type(0),              EncodeValue<Type>(a),    EncodeValue<Type>(b),
+            Type(0),                       Type(0),              EncodeValue<Type>(-1.0), Type(0),
+        };
+    }
+
+
+    /// <summary>
+    /// 3D Projection Factory - Perspective Matrix with infinite far plane
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="fovY">Vertical field of view (radians)</param>
+    /// <param name="aspect">Width / height</param>
+    /// <param name="zNear">Near plane distance (> 0)</param>
+    /// <param name="depth">Clip-space depth convention</param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Matrix4x4<Type> Matrix4x4<Type>::CreatePerspectiveInfinite(double fovY, double aspect, double zNear,
+                                                                      DepthRange depth /*= DepthRange::NegativeOneToOne*/)
+    {
+        return CreatePerspective(fovY, aspect, zNear, std::numeric_limits<double>::infinity(), depth);
+    }
+
+
+    /// <summary>
+    /// 3D Projection Factory - Orthographic Matrix (right-handed, view space looks down -Z)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="left"></param>
+    /// <param name="right"></param>
+    /// <param name="bottom"></param>
+    /// <param name="top"></param>
+    /// <param name="zNear"></param>
+    /// <param name="zFar"></param>
+    /// <param name="depth">Clip-space depth convention</param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Matrix4x4<Type> Matrix4x4<Type>::CreateOrthographic(double left, double right, double bottom, double top,
+                                                               double zNear, double zFar,
+                                                               DepthRange depth /*= DepthRange::NegativeOneToOne*/)
+    {
+        ETLMATH_ASSERT(right != left && top != bottom && zFar != zNear, "Degenerate volume in CreateOrthographic");
+        ETLMATH_ASSERT(!std::isinf(zFar), "Orthographic projection requires a finite far plane");
+
+        const double invWidth = 1.0 / (right - left);
+        const double invHeight = 1.0 / (top - bottom);
+        const double invDepth = 1.0 / (zFar - zNear);
+
+        /// clip.z = a * z + b
+        double a, b;
+        switch (depth)
+        {
+        case DepthRange::ZeroToOne:
+            a = -invDepth;
+            b = -zNear * invDepth;
+            break;
+        case DepthRange::ReversedZ:
+            a = invDepth;
+            b = zFar * invDepth;
+            break;
+        default:
+            a = -2.0 * invDepth;
+            b = -(zFar + zNear) * invDepth;
+            break;
+        }
+
+        return Matrix4x4<Type>{ Raw,
+            EncodeValue<Type>(2.0 * invWidth), Type(0),                            Type(0),              EncodeValue<Type>(-(right + left) * invWidth),
+            Type(0),                           EncodeValue<Type>(2.0 * invHeight), Type(0),              EncodeValue<Type>(-(top + bottom) * invHeight),
+            Type(0),                           Type(0),                            EncodeValue<Type>(a), EncodeValue<Type>(b),
+            Type(0),                           Type(0),                            Type(0),              EncodeValue<Type>(1.0),
+        };
+    }
+
+
+    /// <summary>
+    /// 3D View Factory - LookAt Matrix (right-handed, camera looks down -Z, world to view)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="eye"></param>
+    /// <param name="target"></param>
+    /// <param name="up"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Matrix4x4<Type> Matrix4x4<Type>::CreateLookAt(const Vector3<Type>& eye, const Vector3<Type>& target, const Vector3<Type>& up)
+    {
+        double e[3], f[3], u[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            e[i] = DecodeValue<double>(eye.getRawValue(i));
+            f[i] = DecodeValue<double>(target.getRawValue(i)) - e[i];
+            u[i] = DecodeValue<double>(up.getRawValue(i));
+        }
+
+        const double fLength = std::sqrt(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
+        ETLMATH_ASSERT(!isZero(fLength), "Eye and target are the same point in CreateLookAt");
+        for (double& c : f)
+            c /= fLength;
+
+        /// s = f x up, u = s x f
+        double s[3] = { f[1] * u[2] - f[2] * u[1], f[2] * u[0] - f[0] * u[2], f[0] * u[1] - f[1] * u[0] };
+        const double sLength = std::sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+        ETLMATH_ASSERT(!isZero(sLength), "Up vector parallel to view direction in CreateLookAt");
+        for (double& c : s)
+            c /= sLength;
+
+        u[0] = s[1] * f[2] - s[2] * f[1];
+        u[1] = s[2] * f[0] - s[0] * f[2];
+        u[2] = s[0] * f[1] - s[1] * f[0];
+
+        const double sDotE = s[0] * e[0] + s[1] * e[1] + s[2] * e[2];
+        const double uDotE = u[0] * e[0] + u[1] * e[1] + u[2] * e[2];
+        const double fDotE = f[0] * e[0] + f[1] * e[1] + f[2] * e[2];
+
+        return Matrix4x4<Type>{ Raw,
+            EncodeValue<Type>(s[0]),  EncodeValue<Type>(s[1]),  EncodeValue<Type>(s[2]),  EncodeValue<Type>(-sDotE),
+            EncodeValue<Type>(u[0]),  EncodeValue<Type>(u[1]),  EncodeValue<Type>(u[2]),  EncodeValue<Type>(-uDotE),
+            EncodeValue<Type>(-f[0]), EncodeValue<Type>(-f[1]), EncodeValue<Type>(-f[2]), EncodeValue<Type>(fDotE),
+            Type(0),                  Type(0),                  Type(0),                  EncodeValue<Type>(1.0),
+        };
+    }
+
+
     /// <summary>
     /// Matrix diagonal constructor
     /// </summary>
@@ -216,12 +385,12 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline Type Matrix4x4<Type>::operator()(int row, int col) const
+    constexpr Type Matrix4x4<Type>::operator()(int row, int col) const
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix4x4 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix4x4 out of bounds COL access");
 
-        return DecodeValue<Type>(m[col][row]);
+        return DecodeValue<Type>(mData[col * COL_SIZE + row]);
     }
 
 
@@ -232,12 +401,12 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline ElementProxy<Type> Matrix4x4<Type>::operator()(int row, int col)
+    constexpr ElementProxy<Type> Matrix4x4<Type>::operator()(int row, int col)
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix4x4 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix4x4 out of bounds COL access");
 
-        return ElementProxy<Type>{ m[col][row] };
+        return ElementProxy<Type>{ mData[col * COL_SIZE + row] };
     }
 
 
@@ -248,7 +417,7 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline Type Matrix4x4<Type>::operator[](int elem) const
+    constexpr Type Matrix4x4<Type>::operator[](int elem) const
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix4x4 out of bounds ELEM access");
 
@@ -263,7 +432,7 @@ namespace ETL::Math
     /// <param name="x"></param>
     /// <param name="y"></param>
     template<typename Type>
-    inline ElementProxy<Type> Matrix4x4<Type>::operator[](int elem)
+    constexpr ElementProxy<Type> Matrix4x4<Type>::operator[](int elem)
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix4x4 out of bounds ELEM access");
 
@@ -278,7 +447,7 @@ namespace ETL::Math
     /// <param name="colIndex"></param>
     /// <returns>Column as Vector4</returns>
     template<typename Type>
-    inline Vector4<Type> Matrix4x4<Type>::getCol(int colIndex) const
+    constexpr Vector4<Type> Matrix4x4<Type>::getCol(int colIndex) const
     {
         Vector4<Type> result;
         GetCol(result, *this, colIndex);
@@ -293,7 +462,7 @@ namespace ETL::Math
     /// <param name="rowIndex"></param>
     /// <returns>Row as Vector4</returns>
     template<typename Type>
-    inline Vector4<Type> Matrix4x4<Type>::getRow(int rowIndex) const
+    constexpr Vector4<Type> Matrix4x4<Type>::getRow(int rowIndex) const
     {
         Vector4<Type> result;
         GetRow(result, *this, rowIndex);
@@ -308,7 +477,7 @@ namespace ETL::Math
     /// <param name="outValue"></param>
     /// <param name="colIndex"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::getColTo(Vector4<Type>& outValue, int colIndex) const
+    constexpr void Matrix4x4<Type>::getColTo(Vector4<Type>& outValue, int colIndex) const
     {
         GetCol(outValue, *this, colIndex);
     }
@@ -321,7 +490,7 @@ namespace ETL::Math
     /// <param name="outValue"></param>
     /// <param name="rowIndex"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::getRowTo(Vector4<Type>& outValue, int rowIndex) const
+    constexpr void Matrix4x4<Type>::getRowTo(Vector4<Type>& outValue, int rowIndex) const
     {
         GetRow(outValue, *this, rowIndex);
     }
@@ -337,7 +506,7 @@ namespace ETL::Math
     /// <param name="c2"></param>
     /// <param name="c3"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::setCol(int col, Type c0, Type c1, Type c2, Type c3)
+    constexpr void Matrix4x4<Type>::setCol(int col, Type c0, Type c1, Type c2, Type c3)
     {
         SetCol(*this, *this, col, Vector4<Type>{c0, c1, c2, c3});
     }
@@ -353,7 +522,7 @@ namespace ETL::Math
     /// <param name="r2"></param>
     /// <param name="r3"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::setRow(int row, Type r0, Type r1, Type r2, Type r3)
+    constexpr void Matrix4x4<Type>::setRow(int row, Type r0, Type r1, Type r2, Type r3)
     {
         SetRow(*this, *this, row, Vector4<Type>{r0, r1, r2, r3});
     }
@@ -366,7 +535,7 @@ namespace ETL::Math
     /// <param name="col"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::setCol(int col, const Vector4<Type>& value)
+    constexpr void Matrix4x4<Type>::setCol(int col, const Vector4<Type>& value)
     {
         SetCol(*this, *this, col, value);
     }
@@ -379,7 +548,7 @@ namespace ETL::Math
     /// <param name="row"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::setRow(int row, const Vector4<Type>& value)
+    constexpr void Matrix4x4<Type>::setRow(int row, const Vector4<Type>& value)
     {
         SetRow(*this, *this, row, value);
     }
@@ -392,12 +561,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::operator+(const Matrix4x4& other) const
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::operator+(const Matrix4x4& other) const
     {
-        return Matrix4x4<Type>{ Raw, m00 + other.m00, m01 + other.m01, m02 + other.m02, m03 + other.m03,
-                                     m10 + other.m10, m11 + other.m11, m12 + other.m12, m13 + other.m13,
-                                     m20 + other.m20, m21 + other.m21, m22 + other.m22, m23 + other.m23,
-                                     m30 + other.m30, m31 + other.m31, m32 + other.m32, m33 + other.m33 };
+        Matrix4x4<Type> result{ *this };
+        result += other;
+        return result;
     }
 
 
@@ -408,12 +576,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::operator-(const Matrix4x4& other) const
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::operator-(const Matrix4x4& other) const
     {
-        return Matrix4x4<Type>{ Raw, m00 - other.m00, m01 - other.m01, m02 - other.m02, m03 - other.m03,
-                                     m10 - other.m10, m11 - other.m11, m12 - other.m12, m13 - other.m13,
-                                     m20 - other.m20, m21 - other.m21, m22 - other.m22, m23 - other.m23,
-                                     m30 - other.m30, m31 - other.m31, m32 - other.m32, m33 - other.m33 };
+        Matrix4x4<Type> result{ *this };
+        result -= other;
+        return result;
     }
 
 
@@ -424,7 +591,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::operator*(const Matrix4x4& other) const
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::operator*(const Matrix4x4& other) const
     {
         Matrix4x4<Type> result;
         Multiply(result, *this, other);
@@ -439,7 +606,7 @@ namespace ETL::Math
     /// <param name="vector"></param>
     /// <returns>Resulting vector</returns>
     template<typename Type>
-    inline Vector4<Type> Matrix4x4<Type>::operator*(const Vector4<Type>& vector) const
+    constexpr Vector4<Type> Matrix4x4<Type>::operator*(const Vector4<Type>& vector) const
     {
         Vector4<Type> result;
         Multiply(result, *this, vector);
@@ -454,12 +621,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::operator*(Type scalar) const
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::operator*(Type scalar) const
     {
-        return Matrix4x4<Type>{ Raw, m00 * scalar, m01 * scalar, m02 * scalar, m03 * scalar,
-                                     m10 * scalar, m11 * scalar, m12 * scalar, m13 * scalar,
-                                     m20 * scalar, m21 * scalar, m22 * scalar, m23 * scalar,
-                                     m30 * scalar, m31 * scalar, m32 * scalar, m33 * scalar };
+        Matrix4x4<Type> result{ *this };
+        result *= scalar;
+        return result;
     }
 
 
@@ -470,26 +636,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::operator/(Type scalar) const
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::operator/(Type scalar) const
     {
-        ETLMATH_ASSERT(!isZeroRaw(scalar), "Matrix4x4 division by 0");
-
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            return Matrix4x4<Type>{ Raw, m00 / scalar, m01 / scalar, m02 / scalar, m03 / scalar,
-                                         m10 / scalar, m11 / scalar, m12 / scalar, m13 / scalar,
-                                         m20 / scalar, m21 / scalar, m22 / scalar, m23 / scalar,
-                                         m30 / scalar, m31 / scalar, m32 / scalar, m33 / scalar };
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            return Matrix4x4<Type>{ Raw, m00 * inv, m01 * inv, m02 * inv, m03 * inv,
-                                         m10 * inv, m11 * inv, m12 * inv, m13 * inv,
-                                         m20 * inv, m21 * inv, m22 * inv, m23 * inv,
-                                         m30 * inv, m31 * inv, m32 * inv, m33 * inv };
-        }
+        Matrix4x4<Type> result{ *this };
+        result /= scalar;
+        return result;
     }
 
 
@@ -500,11 +651,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::operator+=(const Matrix4x4& other)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::operator+=(const Matrix4x4& other)
     {
-        for (int i = 0; i < NUM_ELEM; ++i)
-            mData[i] += other.mData[i];
-
+        helpers::AddRaw<Type, NUM_ELEM>(mData, other.mData);
         return *this;
     }
 
@@ -516,11 +665,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::operator-=(const Matrix4x4& other)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::operator-=(const Matrix4x4& other)
     {
-        for (int i = 0; i < NUM_ELEM; ++i)
-            mData[i] -= other.mData[i];
-
+        helpers::SubtractRaw<Type, NUM_ELEM>(mData, other.mData);
         return *this;
     }
 
@@ -532,7 +679,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns>Resulting matrix</returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::operator*=(const Matrix4x4& other)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::operator*=(const Matrix4x4& other)
     {
         Multiply(*this, *this, other);
 
@@ -547,11 +694,9 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::operator*=(Type scalar)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::operator*=(Type scalar)
     {
-        for (int i = 0; i < NUM_ELEM; ++i)
-            mData[i] *= scalar;
-
+        helpers::ScaleRaw<Type, NUM_ELEM>(mData, scalar);
         return *this;
     }
 
@@ -563,24 +708,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::operator/=(Type scalar)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::operator/=(Type scalar)
     {
         ETLMATH_ASSERT(!isZeroRaw(scalar), "Matrix4x4 division by 0");
 
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            for (int i = 0; i < NUM_ELEM; ++i)
-                mData[i] /= scalar;
-        }
-        else
-        {
-            /// Compute inverse and multiply (avoids extra divisions)
-            const Type inv = Type(1) / scalar;
-            for (int i = 0; i < NUM_ELEM; ++i)
-                mData[i] *= inv;
-        }
-
+        helpers::DivideRaw<Type, NUM_ELEM>(mData, scalar);
         return *this;
     }
 
@@ -592,7 +724,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Matrix4x4<Type>::operator==(const Matrix4x4<Type>& other) const
+    constexpr bool Matrix4x4<Type>::operator==(const Matrix4x4<Type>& other) const
     {
         return std::equal(mData, mData + NUM_ELEM, other.mData);
     }
@@ -605,7 +737,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Matrix4x4<Type>::operator!=(const Matrix4x4<Type>& other) const
+    constexpr bool Matrix4x4<Type>::operator!=(const Matrix4x4<Type>& other) const
     {
         return !(*this == other);
     }
@@ -618,7 +750,7 @@ namespace ETL::Math
     /// <param name="point"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Matrix4x4<Type>::transformPoint(const Vector3<Type>& point) const
+    constexpr Vector3<Type> Matrix4x4<Type>::transformPoint(const Vector3<Type>& point) const
     {
         Vector3<Type> result;
         TransformPoint(result, *this, point);
@@ -633,7 +765,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="point"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::transformPointTo(Vector3<Type>& outResult, const Vector3<Type>& point) const
+    constexpr void Matrix4x4<Type>::transformPointTo(Vector3<Type>& outResult, const Vector3<Type>& point) const
     {
         TransformPoint(outResult, *this, point);
     }
@@ -645,7 +777,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="inOutPoint"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::transformPointInPlace(Vector3<Type>& inOutPoint) const
+    constexpr void Matrix4x4<Type>::transformPointInPlace(Vector3<Type>& inOutPoint) const
     {
         TransformPoint(inOutPoint, *this, inOutPoint);
     }
@@ -658,7 +790,7 @@ namespace ETL::Math
     /// <param name="point"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Matrix4x4<Type>::transformDirection(const Vector3<Type>& direction) const
+    constexpr Vector3<Type> Matrix4x4<Type>::transformDirection(const Vector3<Type>& direction) const
     {
         Vector3<Type> result;
         TransformDirection(result, *this, direction);
@@ -673,7 +805,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="direction"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::transformDirectionTo(Vector3<Type>& outResult, const Vector3<Type>& direction) const
+    constexpr void Matrix4x4<Type>::transformDirectionTo(Vector3<Type>& outResult, const Vector3<Type>& direction) const
     {
         TransformDirection(outResult, *this, direction);
     }
@@ -685,7 +817,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="direction"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::transformDirectionInPlace(Vector3<Type>& inOutDirection) const
+    constexpr void Matrix4x4<Type>::transformDirectionInPlace(Vector3<Type>& inOutDirection) const
     {
         TransformDirection(inOutDirection, *this, inOutDirection);
     }
@@ -700,7 +832,7 @@ namespace ETL::Math
     /// <param name="sZ"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::scale(double sX, double sY, double sZ)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::scale(double sX, double sY, double sZ)
     {
         Scale(*this, *this, Vector3<double>{sX, sY, sZ});
         return *this;
@@ -714,7 +846,7 @@ namespace ETL::Math
     /// <param name="scaleVec"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::scale(const Vector3<double>& scaleVec)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::scale(const Vector3<double>& scaleVec)
     {
         Scale(*this, *this, scaleVec);
         return *this;
@@ -760,7 +892,7 @@ namespace ETL::Math
     /// <param name="tZ"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::translate(Type tX, Type tY, Type tZ)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::translate(Type tX, Type tY, Type tZ)
     {
         Translate(*this, *this, Vector3<Type>{tX, tY, tZ});
         return *this;
@@ -774,7 +906,7 @@ namespace ETL::Math
     /// <param name="translation"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::translate(const Vector3<Type>& translation)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::translate(const Vector3<Type>& translation)
     {
         Translate(*this, *this, translation);
         return *this;
@@ -818,11 +950,12 @@ namespace ETL::Math
     /// <param name="newRX"></param>
     /// <param name="newRY"></param>
     /// <param name="newRZ"></param>
+    /// <param name="precision"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::setRotation(double newRX, double newRY, double newRZ)
+    inline Matrix4x4<Type>& Matrix4x4<Type>::setRotation(double newRX, double newRY, double newRZ, TrigPrecision precision /*= TrigPrecision::Precise*/)
     {
-        SetRotation(*this, *this, Vector3<double>{newRX, newRY, newRZ});
+        SetRotation(*this, *this, Vector3<double>{newRX, newRY, newRZ}, precision);
         return *this;
     }
 
@@ -832,11 +965,12 @@ namespace ETL::Math
     /// </summary>
     /// <typeparam name="Type"></typeparam>
     /// <param name="newRotation"></param>
+    /// <param name="precision"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::setRotation(const Vector3<double>& newRotation)
+    inline Matrix4x4<Type>& Matrix4x4<Type>::setRotation(const Vector3<double>& newRotation, TrigPrecision precision /*= TrigPrecision::Precise*/)
     {
-        SetRotation(*this, *this, newRotation);
+        SetRotation(*this, *this, newRotation, precision);
         return *this;
     }
 
@@ -850,7 +984,7 @@ namespace ETL::Math
     /// <param name="newTZ"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::setTranslation(Type newTX, Type newTY, Type newTZ)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::setTranslation(Type newTX, Type newTY, Type newTZ)
     {
         SetTranslation(*this, *this, Vector3<Type>{newTX, newTY, newTZ});
         return *this;
@@ -864,7 +998,7 @@ namespace ETL::Math
     /// <param name="newTranslation"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::setTranslation(const Vector3<Type>& newTranslation)
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::setTranslation(const Vector3<Type>& newTranslation)
     {
         SetTranslation(*this, *this, newTranslation);
         return *this;
@@ -905,7 +1039,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Matrix4x4<Type>::getTranslation() const
+    constexpr Vector3<Type> Matrix4x4<Type>::getTranslation() const
     {
         Vector3<Type> result;
         GetTranslation(result, *this);
@@ -943,7 +1077,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="outTranslation"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::getTranslationTo(Vector3<Type>& outTranslation) const
+    constexpr void Matrix4x4<Type>::getTranslationTo(Vector3<Type>& outTranslation) const
     {
         GetTranslation(outTranslation, *this);
     }
@@ -955,7 +1089,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Matrix4x4<Type>::determinant(bool bFixedPoint /*= false*/) const
+    constexpr Type Matrix4x4<Type>::determinant(bool bFixedPoint /*= false*/) const
     {
         Type result;
         Determinant(result, *this, bFixedPoint);
@@ -970,7 +1104,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="bFixedPoint"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::determinantTo(Type& outResult, bool bFixedPoint /*= false*/) const
+    constexpr void Matrix4x4<Type>::determinantTo(Type& outResult, bool bFixedPoint /*= false*/) const
     {
         Determinant(outResult, *this, bFixedPoint);
     }
@@ -982,7 +1116,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::inverse() const
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::inverse() const
     {
         Matrix4x4<Type> result;
         Inverse(result, *this);
@@ -996,7 +1130,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="outResult"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::inverseTo(Matrix4x4<Type>& outResult) const
+    constexpr void Matrix4x4<Type>::inverseTo(Matrix4x4<Type>& outResult) const
     {
         Inverse(outResult, *this);
     }
@@ -1008,7 +1142,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type>& Matrix4x4<Type>::makeInverse()
+    constexpr Matrix4x4<Type>& Matrix4x4<Type>::makeInverse()
     {
         Inverse(*this, *this);
         return *this;
@@ -1021,7 +1155,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> Matrix4x4<Type>::transpose() const
+    constexpr Matrix4x4<Type> Matrix4x4<Type>::transpose() const
     {
         Matrix4x4<Type> result;
         Transpose(result, *this);
@@ -1035,7 +1169,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="outResult"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::transposeTo(Matrix4x4<Type>& outResult) const
+    constexpr void Matrix4x4<Type>::transposeTo(Matrix4x4<Type>& outResult) const
     {
         Transpose(outResult, *this);
     };
@@ -1062,11 +1196,11 @@ namespace ETL::Math
     /// <param name="col"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Matrix4x4<Type>::getRawValue(int row, int col) const
+    constexpr Type Matrix4x4<Type>::getRawValue(int row, int col) const
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix4x4 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix4x4 out of bounds COL access");
-        return m[col][row];
+        return mData[col * COL_SIZE + row];
     }
 
 
@@ -1077,7 +1211,7 @@ namespace ETL::Math
     /// <param name="elem"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Matrix4x4<Type>::getRawValue(int elem) const
+    constexpr Type Matrix4x4<Type>::getRawValue(int elem) const
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix4x4 out of bounds ELEM access");
         return mData[elem];
@@ -1092,11 +1226,11 @@ namespace ETL::Math
     /// <param name="col"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::setRawValue(int row, int col, Type value)
+    constexpr void Matrix4x4<Type>::setRawValue(int row, int col, Type value)
     {
         ETLMATH_ASSERT(row >= 0 && row < COL_SIZE, "Matrix4x4 out of bounds ROW access");
         ETLMATH_ASSERT(col >= 0 && col < COL_SIZE, "Matrix4x4 out of bounds COL access");
-        m[col][row] = value;
+        mData[col * COL_SIZE + row] = value;
     }
 
 
@@ -1107,16 +1241,300 @@ namespace ETL::Math
     /// <param name="elem"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Matrix4x4<Type>::setRawValue(int elem, Type value)
+    constexpr void Matrix4x4<Type>::setRawValue(int elem, Type value)
     {
         ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "Matrix4x4 out of bounds ELEM access");
         mData[elem] = value;
     }
 
 
+    /// <summary>
+    /// Unchecked raw column access: COL_SIZE contiguous storage values (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type>
+    constexpr const Type* Matrix4x4<Type>::getRawCol(int col) const
+    {
+        return mData + col * COL_SIZE;
+    }
+
+
+    /// <summary>
+    /// Unchecked raw column access: COL_SIZE contiguous storage values (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type>
+    constexpr Type* Matrix4x4<Type>::getRawCol(int col)
+    {
+        return mData + col * COL_SIZE;
+    }
+
+
+    /// <summary>
+    /// Unchecked raw row gather into COL_SIZE values (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outRow"></param>
+    /// <param name="row"></param>
+    template<typename Type>
+    constexpr void Matrix4x4<Type>::getRawRowTo(Type* outRow, int row) const
+    {
+        for (int col = 0; col < COL_SIZE; ++col)
+            outRow[col] = mData[col * COL_SIZE + row];
+    }
+
+
+    /// <summary>
+    /// Unchecked raw element access (no bounds check, no fixed-point conversion)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="row"></param>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type>
+    constexpr Type Matrix4x4<Type>::getRawValueUnchecked(int row, int col) const
+    {
+        return mData[col * COL_SIZE + row];
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// <summary>
+        /// Determinant and adjugate of a column-major 4x4 (m[col * 4 + row]) from shared 2x2 minors.
+        /// The six minors of rows 0-1 and the six of rows 2-3 give the determinant (Laplace expansion
+        /// along the row pair) and all sixteen cofactors, so no 3x3 minor is evaluated twice.
+        /// Each minor, cofactor and the determinant is passed through 'narrow' once its products are
+        /// summed: identity for floating point values and SIMD packs, a rounding 32.32 -> 16.16 shift
+        /// for fixed point widened to 64 bits (one rounding per term keeps the error close to one ulp).
+        /// outAdj is column-major and not yet divided by the determinant.
+        /// </summary>
+        /// <typeparam name="Value">Scalar or Simd::Pack (one matrix per lane)</typeparam>
+        /// <param name="outAdj"></param>
+        /// <param name="m"></param>
+        /// <param name="narrow"></param>
+        /// <returns>Determinant</returns>
+        template<typename Value, typename Narrow>
+        constexpr Value InverseCofactors(Value (&outAdj)[16], const Value (&m)[16], Narrow narrow)
+        {
+            const Value& a00 = m[0], & a10 = m[1], & a20 = m[2],  & a30 = m[3];
+            const Value& a01 = m[4], & a11 = m[5], & a21 = m[6],  & a31 = m[7];
+            const Value& a02 = m[8], & a12 = m[9], & a22 = m[10], & a32 = m[11];
+            const Value& a03 = m[12], & a13 = m[13], & a23 = m[14], & a33 = m[15];
+
+            /// 2x2 minors of the top two rows
+            const Value s0 = narrow(a00 * a11 - a10 * a01);
+            const Value s1 = narrow(a00 * a12 - a10 * a02);
+            const Value s2 = narrow(a00 * a13 - a10 * a03);
+            const Value s3 = narrow(a01 * a12 - a11 * a02);
+            const Value s4 = narrow(a01 * a13 - a11 * a03);
+            const Value s5 = narrow(a02 * a13 - a12 * a03);
+
+            /// 2x2 minors of the bottom two rows
+            const Value c0 = narrow(a20 * a31 - a30 * a21);
+            const Value c1 = narrow(a20 * a32 - a30 * a22);
+            const Value c2 = narrow(a20 * a33 - a30 * a23);
+            const Value c3 = narrow(a21 * a32 - a31 * a22);
+            const Value c4 = narrow(a21 * a33 - a31 * a23);
+            const Value c5 = narrow(a22 * a33 - a32 * a23);
+
+            /// Adjugate (transposed cofactors), column-major
+            outAdj[0]  = narrow(a11 * c5 - a12 * c4 + a13 * c3);
+            outAdj[1]  = narrow(-a10 * c5 + a12 * c2 - a13 * c1);
+            outAdj[2]  = narrow(a10 * c4 - a11 * c2 + a13 * c0);
+            outAdj[3]  = narrow(-a10 * c3 + a11 * c1 - a12 * c0);
+
+            outAdj[4]  = narrow(-a01 * c5 + a02 * c4 - a03 * c3);
+            outAdj[5]  = narrow(a00 * c5 - a02 * c2 + a03 * c1);
+            outAdj[6]  = narrow(-a00 * c4 + a01 * c2 - a03 * c0);
+            outAdj[7]  = narrow(a00 * c3 - a01 * c1 + a02 * c0);
+
+            outAdj[8]  = narrow(a31 * s5 - a32 * s4 + a33 * s3);
+            outAdj[9]  = narrow(-a30 * s5 + a32 * s2 - a33 * s1);
+            outAdj[10] = narrow(a30 * s4 - a31 * s2 + a33 * s0);
+            outAdj[11] = narrow(-a30 * s3 + a31 * s1 - a32 * s0);
+
+            outAdj[12] = narrow(-a21 * s5 + a22 * s4 - a23 * s3);
+            outAdj[13] = narrow(a20 * s5 - a22 * s2 + a23 * s1);
+            outAdj[14] = narrow(-a20 * s4 + a21 * s2 - a23 * s0);
+            outAdj[15] = narrow(a20 * s3 - a21 * s1 + a22 * s0);
+
+            return narrow(s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+        }
+
+
+        /// Sum of 16.16 x 16.16 products back to 16.16 (rounded to nearest)
+        constexpr int64_t FixedNarrow(int64_t value)
+        {
+            return (value + (int64_t(1) << (FIXED_SHIFT - 1))) >> FIXED_SHIFT;
+        }
+    }
+
+
     ///------------------------------------------------------------------------------------------
     /// Free functions - implement logic
 
+    /// <summary>
+    /// Matrix * Vector
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    /// <param name="vec"></param>
+    template<typename Type>
+    constexpr void Multiply(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector4<Type>& vec)
+    {
+        ETLMATH_INSTRUMENT(Matrix4x4MultiplyVector);
+
+        /// Gathered once, the result is stored last: outResult may alias vec
+        const Type v[4] = { vec.getRawValue(0), vec.getRawValue(1), vec.getRawValue(2), vec.getRawValue(3) };
+        Type result[4];
+        helpers::MultiplyRaw<Type, 4, 4, 1>(result, mat.getRawCol(0), v);
+
+        for (int row = 0; row < Matrix4x4<Type>::COL_SIZE; ++row)
+            outResult.setRawValue(row, result[row]);
+    }
+
+
+
+    /// <summary>
+    /// Matrix * Matrix
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mA"></param>
+    /// <param name="mB"></param>
+    template<typename Type>
+    constexpr void Multiply(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mA, const Matrix4x4<Type>& mB)
+    {
+        ETLMATH_INSTRUMENT(Matrix4x4Multiply);
+
+        /// Computed into a local buffer first, so outResult may alias mA or mB
+        Type result[Matrix4x4<Type>::NUM_ELEM];
+        helpers::MultiplyRaw<Type, 4, 4, 4>(result, mA.getRawCol(0), mB.getRawCol(0));
+
+        for (int i = 0; i < Matrix4x4<Type>::NUM_ELEM; ++i)
+            outResult.setRawValue(i, result[i]);
+    }
+
+
+
+    /// <summary>
+    /// Compute Determinant
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    constexpr void Determinant(Type& outResult, const Matrix4x4<Type>& mat, bool bFixedPoint /*= false*/)
+    {
+
+        const Matrix3x3<Type> adj00{ Raw, mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
+                                          mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3),
+                                          mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3) };
+
+        const Matrix3x3<Type> adj01{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
+                                          mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3),
+                                          mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3) };
+
+        const Matrix3x3<Type> adj02{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
+                                          mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3),
+                                          mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3) };
+
+        const Matrix3x3<Type> adj03{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
+                                          mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2),
+                                          mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2) };
+
+        if constexpr (std::integral<Type>)
+        {
+            int64_t fixedPointDet = ((static_cast<int64_t>(mat.getRawValue(0, 0)) * adj00.determinant(true)) >> FIXED_SHIFT)
+                                  - ((static_cast<int64_t>(mat.getRawValue(0, 1)) * adj01.determinant(true)) >> FIXED_SHIFT)
+                                  + ((static_cast<int64_t>(mat.getRawValue(0, 2)) * adj02.determinant(true)) >> FIXED_SHIFT)
+                                  - ((static_cast<int64_t>(mat.getRawValue(0, 3)) * adj03.determinant(true)) >> FIXED_SHIFT);
+
+            outResult = static_cast<Type>(bFixedPoint ? fixedPointDet : fixedPointDet >> FIXED_SHIFT);
+        }
+        else
+        {
+            outResult = mat.getRawValue(0, 0) * adj00.determinant()
+                      - mat.getRawValue(0, 1) * adj01.determinant()
+                      + mat.getRawValue(0, 2) * adj02.determinant()
+                      - mat.getRawValue(0, 3) * adj03.determinant();
+        }
+    }
+
+
+
+    /// <summary>
+    /// Compute Inverse (adjugate over determinant, both built from the same twelve 2x2 minors)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    constexpr bool Inverse(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat)
+    {
+        ETLMATH_INSTRUMENT(Matrix4x4Inverse);
+
+        /// Everything is read into locals before the first write, so outResult may alias mat
+        if constexpr (std::integral<Type>)
+        {
+            int64_t m[16], adj[16];
+            for (int i = 0; i < Matrix4x4<Type>::NUM_ELEM; ++i)
+                m[i] = mat.getRawValue(i);
+
+            const int64_t det = helpers::InverseCofactors(adj, m, helpers::FixedNarrow);
+            if (isZero(static_cast<Type>(det)))
+                return false;
+
+            for (int i = 0; i < Matrix4x4<Type>::NUM_ELEM; ++i)
+                outResult.setRawValue(i, static_cast<Type>((adj[i] << FIXED_SHIFT) / det));
+        }
+        else
+        {
+            Type m[16], adj[16];
+            for (int i = 0; i < Matrix4x4<Type>::NUM_ELEM; ++i)
+                m[i] = mat.getRawValue(i);
+
+            const Type det = helpers::InverseCofactors(adj, m, [](Type value) { return value; });
+            if (isZero(det))
+                return false;
+
+            const Type invDet = Type(1) / det;
+            for (int i = 0; i < Matrix4x4<Type>::NUM_ELEM; ++i)
+                outResult.setRawValue(i, adj[i] * invDet);
+        }
+
+        return true;
+    }
+
+
+
+    /// <summary>
+    /// Compute Transpose
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    constexpr void Transpose(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat)
+    {
+        /// Computed into a local buffer first, so outResult may alias mat
+        Type result[Matrix4x4<Type>::NUM_ELEM];
+        helpers::TransposeRaw<Type, 4, 4>(result, mat.getRawCol(0));
+
+        for (int i = 0; i < Matrix4x4<Type>::NUM_ELEM; ++i)
+            outResult.setRawValue(i, result[i]);
+    }
+
+
     /// <summary>
     /// Column getter
     /// </summary>
@@ -1125,7 +1543,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="index"></param>
     template<typename Type>
-    inline void GetCol(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index)
+    constexpr void GetCol(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix4x4<Type>::COL_SIZE, "Matrix4x4 out of bounds ROW access");
 
@@ -1144,7 +1562,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="index"></param>
     template<typename Type>
-    inline void GetRow(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index)
+    constexpr void GetRow(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, int index)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix4x4<Type>::COL_SIZE, "Matrix4x4 out of bounds ROW access");
 
@@ -1164,7 +1582,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <param name="col"></param>
     template<typename Type>
-    inline void SetCol(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& col)
+    constexpr void SetCol(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& col)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix4x4<Type>::COL_SIZE, "Matrix4x4 out of bounds ROW access");
 
@@ -1189,7 +1607,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <param name="row"></param>
     template<typename Type>
-    inline void SetRow(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& row)
+    constexpr void SetRow(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, int index, const Vector4<Type>& row)
     {
         ETLMATH_ASSERT(index >= 0 && index < Matrix4x4<Type>::COL_SIZE, "Matrix4x4 out of bounds ROW access");
 
@@ -1213,7 +1631,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="point"></param>
     template<typename Type>
-    inline void TransformPoint(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& point)
+    constexpr void TransformPoint(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& point)
     {
         if constexpr (std::integral<Type>)
         {
@@ -1247,7 +1665,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="direction"></param>
     template<typename Type>
-    inline void TransformDirection(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& direction)
+    constexpr void TransformDirection(Vector3<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& direction)
     {
         if constexpr (std::integral<Type>)
         {
@@ -1281,7 +1699,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="translation"></param>
     template<typename Type>
-    inline void Translate(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation)
+    constexpr void Translate(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation)
     {
         outResult.setRawValue(0, 3, mat.getRawValue(0, 3) + translation.getRawValue(0));
         outResult.setRawValue(1, 3, mat.getRawValue(1, 3) + translation.getRawValue(1));
@@ -1314,7 +1732,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="translation"></param>
     template<typename Type>
-    inline void SetTranslation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation)
+    constexpr void SetTranslation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<Type>& translation)
     {
         outResult.setRawValue(0, 3, translation.getRawValue(0));
         outResult.setRawValue(1, 3, translation.getRawValue(1));
@@ -1346,7 +1764,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="mat"></param>
     template<typename Type>
-    inline void GetTranslation(Vector3<Type>& outResult, const Matrix4x4<Type>& mat)
+    constexpr void GetTranslation(Vector3<Type>& outResult, const Matrix4x4<Type>& mat)
     {
         outResult.setRawValue(0, mat.getRawValue(0, 3));
         outResult.setRawValue(1, mat.getRawValue(1, 3));
@@ -1396,15 +1814,15 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="mat"></param>
     /// <param name="angleRad"></param>
+    /// <param name="precision"></param>
     template<typename Type>
-    inline void SetRotation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& rotation)
+    inline void SetRotation(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& rotation,
+                            TrigPrecision precision /*= TrigPrecision::Precise*/)
     {
-        const double cosX = std::cos(rotation.x());
-        const double sinX = std::sin(rotation.x());
-        const double cosY = std::cos(rotation.y());
-        const double sinY = std::sin(rotation.y());
-        const double cosZ = std::cos(rotation.z());
-        const double sinZ = std::sin(rotation.z());
+        double sinX, cosX, sinY, cosY, sinZ, cosZ;
+        SinCos(sinX, cosX, rotation.x(), precision);
+        SinCos(sinY, cosY, rotation.y(), precision);
+        SinCos(sinZ, cosZ, rotation.z(), precision);
 
         const double v00 = cosY * cosZ;
         const double v01 = -cosY * sinZ;
@@ -1510,7 +1928,7 @@ namespace ETL::Math
     /// <param name="mat"></param>
     /// <param name="scale"></param>
     template<typename Type>
-    inline void Scale(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& scale)
+    constexpr void Scale(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector3<double>& scale)
     {
         outResult.setRawValue(0, 0, static_cast<Type>(mat.getRawValue(0, 0) * scale.x()));
         outResult.setRawValue(1, 0, static_cast<Type>(mat.getRawValue(1, 0) * scale.x()));
@@ -1624,7 +2042,7 @@ namespace ETL::Math
     /// <param name="matrix"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Matrix4x4<Type> operator*(Type scalar, const Matrix4x4<Type>& matrix)
+    constexpr Matrix4x4<Type> operator*(Type scalar, const Matrix4x4<Type>& matrix)
     {
         return matrix * scalar;
     }
@@ -0,0 +1,137 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// MatrixCore.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/FixedPointHelpers.h"
+#include <cstdint>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Element-wise addition
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="inOut"></param>
+    /// <param name="b"></param>
+    template<typename Type, int Count>
+    constexpr void helpers::AddRaw(Type* inOut, const Type* b)
+    {
+        for (int i = 0; i < Count; ++i)
+            inOut[i] += b[i];
+    }
+
+
+    /// <summary>
+    /// Element-wise subtraction
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="inOut"></param>
+    /// <param name="b"></param>
+    template<typename Type, int Count>
+    constexpr void helpers::SubtractRaw(Type* inOut, const Type* b)
+    {
+        for (int i = 0; i < Count; ++i)
+            inOut[i] -= b[i];
+    }
+
+
+    /// <summary>
+    /// Scale by a raw scalar
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="inOut"></param>
+    /// <param name="scalar"></param>
+    template<typename Type, int Count>
+    constexpr void helpers::ScaleRaw(Type* inOut, Type scalar)
+    {
+        for (int i = 0; i < Count; ++i)
+            inOut[i] *= scalar;
+    }
+
+
+    /// <summary>
+    /// Divide by a raw scalar
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="inOut"></param>
+    /// <param name="scalar"></param>
+    template<typename Type, int Count>
+    constexpr void helpers::DivideRaw(Type* inOut, Type scalar)
+    {
+        if constexpr (std::integral<Type>)
+        {
+            /// integer division, divide to avoid truncation errors
+            for (int i = 0; i < Count; ++i)
+                inOut[i] /= scalar;
+        }
+        else
+        {
+            const Type inv = Type(1) / scalar;
+            for (int i = 0; i < Count; ++i)
+                inOut[i] *= inv;
+        }
+    }
+
+
+    /// <summary>
+    /// Matrix product on column-major storage: each result column is a linear combination of a's columns
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="out"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    template<typename Type, int Rows, int Inner, int Cols>
+    constexpr void helpers::MultiplyRaw(Type* out, const Type* a, const Type* b)
+    {
+        if !consteval
+        {
+            if constexpr (HasSimdProduct<Type, Rows, Inner, Cols>)
+            {
+                MultiplyColumnsSimd<Type, Rows, Inner, Cols>(out, a, b);
+                return;
+            }
+        }
+
+        for (int col = 0; col < Cols; ++col, out += Rows, b += Inner)
+        {
+            for (int row = 0; row < Rows; ++row)
+            {
+                if constexpr (std::integral<Type>)
+                {
+                    int64_t sum = 0;
+                    for (int k = 0; k < Inner; ++k)
+                        sum += static_cast<int64_t>(a[k * Rows + row]) * b[k];
+
+                    /// Bitshift result back to Fixed Point
+                    out[row] = static_cast<Type>(sum >> FIXED_SHIFT);
+                }
+                else
+                {
+                    Type sum = a[row] * b[0];
+                    for (int k = 1; k < Inner; ++k)
+                        sum += a[k * Rows + row] * b[k];
+
+                    out[row] = sum;
+                }
+            }
+        }
+    }
+
+
+    /// <summary>
+    /// Transpose on column-major storage
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="out"></param>
+    /// <param name="a"></param>
+    template<typename Type, int Rows, int Cols>
+    constexpr void helpers::TransposeRaw(Type* out, const Type* a)
+    {
+        for (int col = 0; col < Cols; ++col)
+            for (int row = 0; row < Rows; ++row)
+                out[row * Cols + col] = a[col * Rows + row];
+    }
+
+} /// namespace ETL::Math
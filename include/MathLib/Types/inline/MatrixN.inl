@@ -0,0 +1,786 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// MatrixN.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/TypeComparisons.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Diagonal constructor (rest 0)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="val"></param>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols>::MatrixN(Type val)
+        : mData{}
+    {
+        for (int i = 0; i < std::min(Rows, Cols); ++i)
+            mData[i * Rows + i] = EncodeValue<Type>(val);
+    }
+
+
+    /// <summary>
+    /// Element constructor (row-major order)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="values"></param>
+    template<typename Type, int Rows, int Cols>
+    template<typename... Values>
+    requires (Rows * Cols > 1 && sizeof...(Values) == Rows * Cols && (std::is_arithmetic_v<Values> && ...))
+    constexpr MatrixN<Type, Rows, Cols>::MatrixN(Values... values)
+        : mData{}
+    {
+        const Type rowMajor[NUM_ELEM] = { EncodeValue<Type>(values)... };
+        for (int row = 0; row < Rows; ++row)
+            for (int col = 0; col < Cols; ++col)
+                mData[col * Rows + row] = rowMajor[row * Cols + col];
+    }
+
+
+    /// <summary>
+    /// Raw element constructor (row-major order)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="values"></param>
+    template<typename Type, int Rows, int Cols>
+    template<typename... Values>
+    requires (sizeof...(Values) == Rows * Cols && (std::same_as<Values, Type> && ...))
+    constexpr MatrixN<Type, Rows, Cols>::MatrixN(RawTag, Values... values)
+        : mData{}
+    {
+        const Type rowMajor[NUM_ELEM] = { values... };
+        for (int row = 0; row < Rows; ++row)
+            for (int col = 0; col < Cols; ++col)
+                mData[col * Rows + row] = rowMajor[row * Cols + col];
+    }
+
+
+    /// <summary>
+    /// Element access
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="row"></param>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Type MatrixN<Type, Rows, Cols>::operator()(int row, int col) const
+    {
+        ETLMATH_ASSERT(row >= 0 && row < Rows, "MatrixN out of bounds ROW access");
+        ETLMATH_ASSERT(col >= 0 && col < Cols, "MatrixN out of bounds COL access");
+
+        return DecodeValue<Type>(mData[col * Rows + row]);
+    }
+
+
+    /// <summary>
+    /// Element access
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="row"></param>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr ElementProxy<Type> MatrixN<Type, Rows, Cols>::operator()(int row, int col)
+    {
+        ETLMATH_ASSERT(row >= 0 && row < Rows, "MatrixN out of bounds ROW access");
+        ETLMATH_ASSERT(col >= 0 && col < Cols, "MatrixN out of bounds COL access");
+
+        return ElementProxy<Type>{ mData[col * Rows + row] };
+    }
+
+
+    /// <summary>
+    /// Element access (column-major index)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Type MatrixN<Type, Rows, Cols>::operator[](int index) const
+    {
+        ETLMATH_ASSERT(index >= 0 && index < NUM_ELEM, "MatrixN out of bounds access");
+
+        return DecodeValue<Type>(mData[index]);
+    }
+
+
+    /// <summary>
+    /// Element access (column-major index)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr ElementProxy<Type> MatrixN<Type, Rows, Cols>::operator[](int index)
+    {
+        ETLMATH_ASSERT(index >= 0 && index < NUM_ELEM, "MatrixN out of bounds access");
+
+        return ElementProxy<Type>{ mData[index] };
+    }
+
+
+    /// <summary>
+    /// Column getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="colIndex"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Vector<Type, Rows> MatrixN<Type, Rows, Cols>::getCol(int colIndex) const
+    {
+        ETLMATH_ASSERT(colIndex >= 0 && colIndex < Cols, "MatrixN out of bounds COL access");
+
+        Vector<Type, Rows> result;
+        for (int row = 0; row < Rows; ++row)
+            result.setRawValue(row, mData[colIndex * Rows + row]);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Row getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="rowIndex"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Vector<Type, Cols> MatrixN<Type, Rows, Cols>::getRow(int rowIndex) const
+    {
+        ETLMATH_ASSERT(rowIndex >= 0 && rowIndex < Rows, "MatrixN out of bounds ROW access");
+
+        Vector<Type, Cols> result;
+        for (int col = 0; col < Cols; ++col)
+            result.setRawValue(col, mData[col * Rows + rowIndex]);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Column setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="col"></param>
+    /// <param name="value"></param>
+    template<typename Type, int Rows, int Cols>
+    constexpr void MatrixN<Type, Rows, Cols>::setCol(int col, const Vector<Type, Rows>& value)
+    {
+        ETLMATH_ASSERT(col >= 0 && col < Cols, "MatrixN out of bounds COL access");
+
+        for (int row = 0; row < Rows; ++row)
+            mData[col * Rows + row] = value.getRawValue(row);
+    }
+
+
+    /// <summary>
+    /// Row setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="row"></param>
+    /// <param name="value"></param>
+    template<typename Type, int Rows, int Cols>
+    constexpr void MatrixN<Type, Rows, Cols>::setRow(int row, const Vector<Type, Cols>& value)
+    {
+        ETLMATH_ASSERT(row >= 0 && row < Rows, "MatrixN out of bounds ROW access");
+
+        for (int col = 0; col < Cols; ++col)
+            mData[col * Rows + row] = value.getRawValue(col);
+    }
+
+
+    /// <summary>
+    /// Addition operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols> MatrixN<Type, Rows, Cols>::operator+(const MatrixN& other) const
+    {
+        MatrixN result{ *this };
+        result += other;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Subtraction operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols> MatrixN<Type, Rows, Cols>::operator-(const MatrixN& other) const
+    {
+        MatrixN result{ *this };
+        result -= other;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Matrix * Vector operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="vector"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Vector<Type, Rows> MatrixN<Type, Rows, Cols>::operator*(const Vector<Type, Cols>& vector) const
+    {
+        Vector<Type, Rows> result;
+        Multiply(result, *this, vector);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Matrix * Matrix operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    template<MatrixType Other>
+    requires (helpers::MatrixShape<Other>::ROWS == Cols && std::same_as<typename helpers::MatrixShape<Other>::ValueType, Type>)
+    constexpr Matrix<Type, Rows, helpers::MatrixShape<Other>::COLS> MatrixN<Type, Rows, Cols>::operator*(const Other& other) const
+    {
+        Matrix<Type, Rows, helpers::MatrixShape<Other>::COLS> result;
+        Multiply(result, *this, other);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Matrix * Scalar operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols> MatrixN<Type, Rows, Cols>::operator*(Type scalar) const
+    {
+        MatrixN result{ *this };
+        result *= scalar;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Matrix / Scalar operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols> MatrixN<Type, Rows, Cols>::operator/(Type scalar) const
+    {
+        MatrixN result{ *this };
+        result /= scalar;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Addition assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols>& MatrixN<Type, Rows, Cols>::operator+=(const MatrixN& other)
+    {
+        helpers::AddRaw<Type, NUM_ELEM>(mData, other.mData);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Subtraction assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols>& MatrixN<Type, Rows, Cols>::operator-=(const MatrixN& other)
+    {
+        helpers::SubtractRaw<Type, NUM_ELEM>(mData, other.mData);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Multiplication assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols>& MatrixN<Type, Rows, Cols>::operator*=(Type scalar)
+    {
+        helpers::ScaleRaw<Type, NUM_ELEM>(mData, scalar);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Division assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols>& MatrixN<Type, Rows, Cols>::operator/=(Type scalar)
+    {
+        ETLMATH_ASSERT(!isZeroRaw(scalar), "MatrixN division by 0");
+
+        helpers::DivideRaw<Type, NUM_ELEM>(mData, scalar);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Equality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr bool MatrixN<Type, Rows, Cols>::operator==(const MatrixN& other) const
+    {
+        return std::equal(mData, mData + NUM_ELEM, other.mData);
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr bool MatrixN<Type, Rows, Cols>::operator!=(const MatrixN& other) const
+    {
+        return !(*this == other);
+    }
+
+
+    /// <summary>
+    /// Transposed copy
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Matrix<Type, Cols, Rows> MatrixN<Type, Rows, Cols>::transpose() const
+    {
+        Matrix<Type, Cols, Rows> result;
+        Transpose(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Determinant (decoded)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr double MatrixN<Type, Rows, Cols>::determinant() const requires (Rows == Cols)
+    {
+        double result;
+        Determinant(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Inverse copy (unchanged copy if singular)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols> MatrixN<Type, Rows, Cols>::inverse() const requires (Rows == Cols)
+    {
+        MatrixN result{ *this };
+        Inverse(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Invert self (unchanged if singular)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols>& MatrixN<Type, Rows, Cols>::makeInverse() requires (Rows == Cols)
+    {
+        Inverse(*this, *this);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Raw value getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="row"></param>
+    /// <param name="col"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Type MatrixN<Type, Rows, Cols>::getRawValue(int row, int col) const
+    {
+        ETLMATH_ASSERT(row >= 0 && row < Rows, "MatrixN out of bounds ROW access");
+        ETLMATH_ASSERT(col >= 0 && col < Cols, "MatrixN out of bounds COL access");
+
+        return mData[col * Rows + row];
+    }
+
+
+    /// <summary>
+    /// Raw value getter (column-major index)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="elem"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr Type MatrixN<Type, Rows, Cols>::getRawValue(int elem) const
+    {
+        ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "MatrixN out of bounds access");
+
+        return mData[elem];
+    }
+
+
+    /// <summary>
+    /// Raw value setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="row"></param>
+    /// <param name="col"></param>
+    /// <param name="value"></param>
+    template<typename Type, int Rows, int Cols>
+    constexpr void MatrixN<Type, Rows, Cols>::setRawValue(int row, int col, Type value)
+    {
+        ETLMATH_ASSERT(row >= 0 && row < Rows, "MatrixN out of bounds ROW access");
+        ETLMATH_ASSERT(col >= 0 && col < Cols, "MatrixN out of bounds COL access");
+
+        mData[col * Rows + row] = value;
+    }
+
+
+    /// <summary>
+    /// Raw value setter (column-major index)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="elem"></param>
+    /// <param name="value"></param>
+    template<typename Type, int Rows, int Cols>
+    constexpr void MatrixN<Type, Rows, Cols>::setRawValue(int elem, Type value)
+    {
+        ETLMATH_ASSERT(elem >= 0 && elem < NUM_ELEM, "MatrixN out of bounds access");
+
+        mData[elem] = value;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers
+
+    /// <summary>
+    /// Matrix * Matrix, any compatible mix of matrix types
+    /// </summary>
+    /// <typeparam name="Out"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mA"></param>
+    /// <param name="mB"></param>
+    template<MatrixType Out, MatrixType A, MatrixType B>
+    requires (helpers::AnyGeneric<Out, A, B>)
+    constexpr void Multiply(Out& outResult, const A& mA, const B& mB)
+    {
+        using Type = typename helpers::MatrixShape<Out>::ValueType;
+        constexpr int ROWS = helpers::MatrixShape<A>::ROWS;
+        constexpr int INNER = helpers::MatrixShape<A>::COLS;
+        constexpr int COLS = helpers::MatrixShape<B>::COLS;
+
+        static_assert(std::same_as<typename helpers::MatrixShape<A>::ValueType, Type> && std::same_as<typename helpers::MatrixShape<B>::ValueType, Type>, "Multiply of different value types");
+        static_assert(helpers::MatrixShape<B>::ROWS == INNER, "Multiply: A columns must match B rows");
+        static_assert(helpers::MatrixShape<Out>::ROWS == ROWS && helpers::MatrixShape<Out>::COLS == COLS, "Multiply: wrong result shape");
+
+        /// --- SAFETY CHECK FOR ALIASING ---
+        const void* out = &outResult;
+        if (out == &mA || out == &mB)
+        {
+            Out temp;
+            Multiply(temp, mA, mB);
+
+            outResult = temp;
+            return;
+        }
+
+        helpers::MultiplyRaw<Type, ROWS, INNER, COLS>(outResult.getRawCol(0), mA.getRawCol(0), mB.getRawCol(0));
+    }
+
+
+    /// <summary>
+    /// Matrix * Vector, any compatible mix of matrix and vector types
+    /// </summary>
+    /// <typeparam name="Out"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    /// <param name="vec"></param>
+    template<VectorType Out, MatrixType Mat, VectorType Vec>
+    requires (helpers::AnyGeneric<Out, Mat, Vec>)
+    constexpr void Multiply(Out& outResult, const Mat& mat, const Vec& vec)
+    {
+        using Type = typename helpers::MatrixShape<Mat>::ValueType;
+        constexpr int ROWS = helpers::MatrixShape<Mat>::ROWS;
+        constexpr int INNER = helpers::MatrixShape<Mat>::COLS;
+
+        static_assert(std::same_as<typename helpers::VectorShape<Out>::ValueType, Type> && std::same_as<typename helpers::VectorShape<Vec>::ValueType, Type>, "Multiply of different value types");
+        static_assert(helpers::VectorShape<Vec>::SIZE == INNER, "Multiply: matrix columns must match vector size");
+        static_assert(helpers::VectorShape<Out>::SIZE == ROWS, "Multiply: wrong result size");
+
+        /// Gathered once, the result is stored last: outResult may alias vec
+        Type v[INNER];
+        for (int k = 0; k < INNER; ++k)
+            v[k] = vec.getRawValue(k);
+
+        Type result[ROWS];
+        helpers::MultiplyRaw<Type, ROWS, INNER, 1>(result, mat.getRawCol(0), v);
+
+        for (int row = 0; row < ROWS; ++row)
+            outResult.setRawValue(row, result[row]);
+    }
+
+
+    /// <summary>
+    /// Transpose, any compatible mix of matrix types
+    /// </summary>
+    /// <typeparam name="Out"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<MatrixType Out, MatrixType Mat>
+    requires (helpers::AnyGeneric<Out, Mat>)
+    constexpr void Transpose(Out& outResult, const Mat& mat)
+    {
+        using Type = typename helpers::MatrixShape<Mat>::ValueType;
+        constexpr int ROWS = helpers::MatrixShape<Mat>::ROWS;
+        constexpr int COLS = helpers::MatrixShape<Mat>::COLS;
+
+        static_assert(std::same_as<typename helpers::MatrixShape<Out>::ValueType, typename helpers::MatrixShape<Mat>::ValueType>, "Transpose of different value types");
+        static_assert(helpers::MatrixShape<Out>::ROWS == COLS && helpers::MatrixShape<Out>::COLS == ROWS, "Transpose: wrong result shape");
+
+        /// Computed into a local buffer first, so outResult may alias mat
+        Type result[ROWS * COLS];
+        helpers::TransposeRaw<Type, ROWS, COLS>(result, mat.getRawCol(0));
+
+        for (int i = 0; i < ROWS * COLS; ++i)
+            outResult.setRawValue(i, result[i]);
+    }
+
+
+    /// <summary>
+    /// Extract the block of outResult's size at (Row0, Col0)
+    /// </summary>
+    /// <typeparam name="Block"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<int Row0, int Col0, MatrixType Block, MatrixType Mat>
+    constexpr void GetBlock(Block& outResult, const Mat& mat)
+    {
+        constexpr int ROWS = helpers::MatrixShape<Block>::ROWS;
+        constexpr int COLS = helpers::MatrixShape<Block>::COLS;
+
+        static_assert(std::same_as<typename helpers::MatrixShape<Block>::ValueType, typename helpers::MatrixShape<Mat>::ValueType>, "GetBlock of different value types");
+        static_assert(Row0 >= 0 && Col0 >= 0 && Row0 + ROWS <= helpers::MatrixShape<Mat>::ROWS && Col0 + COLS <= helpers::MatrixShape<Mat>::COLS, "GetBlock out of bounds");
+
+        for (int col = 0; col < COLS; ++col)
+            for (int row = 0; row < ROWS; ++row)
+                outResult.setRawValue(row, col, mat.getRawValue(Row0 + row, Col0 + col));
+    }
+
+
+    /// <summary>
+    /// Write 'block' at (Row0, Col0)
+    /// </summary>
+    /// <typeparam name="Mat"></typeparam>
+    /// <param name="inOutMat"></param>
+    /// <param name="block"></param>
+    template<int Row0, int Col0, MatrixType Mat, MatrixType Block>
+    constexpr void SetBlock(Mat& inOutMat, const Block& block)
+    {
+        constexpr int ROWS = helpers::MatrixShape<Block>::ROWS;
+        constexpr int COLS = helpers::MatrixShape<Block>::COLS;
+
+        static_assert(std::same_as<typename helpers::MatrixShape<Block>::ValueType, typename helpers::MatrixShape<Mat>::ValueType>, "SetBlock of different value types");
+        static_assert(Row0 >= 0 && Col0 >= 0 && Row0 + ROWS <= helpers::MatrixShape<Mat>::ROWS && Col0 + COLS <= helpers::MatrixShape<Mat>::COLS, "SetBlock out of bounds");
+
+        for (int col = 0; col < COLS; ++col)
+            for (int row = 0; row < ROWS; ++row)
+                inOutMat.setRawValue(Row0 + row, Col0 + col, block.getRawValue(row, col));
+    }
+
+
+    /// <summary>
+    /// Determinant (decoded, computed in double)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type, int Size>
+    constexpr void Determinant(double& outResult, const MatrixN<Type, Size, Size>& mat)
+    {
+        if constexpr (Size == 2)
+        {
+            outResult = DecodeValue<double>(mat.getRawValue(0, 0)) * DecodeValue<double>(mat.getRawValue(1, 1))
+                      - DecodeValue<double>(mat.getRawValue(0, 1)) * DecodeValue<double>(mat.getRawValue(1, 0));
+        }
+        else
+        {
+            /// Row-major working copy, eliminated in place
+            double a[Size * Size];
+            for (int row = 0; row < Size; ++row)
+                for (int col = 0; col < Size; ++col)
+                    a[row * Size + col] = DecodeValue<double>(mat.getRawValue(row, col));
+
+            double det = 1.0;
+            for (int k = 0; k < Size; ++k)
+            {
+                int pivot = k;
+                for (int row = k + 1; row < Size; ++row)
+                    if (helpers::abs(a[row * Size + k]) > helpers::abs(a[pivot * Size + k]))
+                        pivot = row;
+
+                if (a[pivot * Size + k] == 0.0)
+                {
+                    outResult = 0.0;
+                    return;
+                }
+
+                if (pivot != k)
+                {
+                    for (int col = 0; col < Size; ++col)
+                        std::swap(a[k * Size + col], a[pivot * Size + col]);
+                    det = -det;
+                }
+
+                det *= a[k * Size + k];
+                for (int row = k + 1; row < Size; ++row)
+                {
+                    const double factor = a[row * Size + k] / a[k * Size + k];
+                    for (int col = k + 1; col < Size; ++col)
+                        a[row * Size + col] -= factor * a[k * Size + col];
+                }
+            }
+            outResult = det;
+        }
+    }
+
+
+    /// <summary>
+    /// Inverse (computed in double)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    /// <returns>False (outResult untouched) if the matrix is singular</returns>
+    template<typename Type, int Size>
+    constexpr bool Inverse(MatrixN<Type, Size, Size>& outResult, const MatrixN<Type, Size, Size>& mat)
+    {
+        if constexpr (Size == 2)
+        {
+            double det;
+            Determinant(det, mat);
+            if (helpers::abs(det) < Epsilon<Type>::value)
+                return false;
+
+            const double invDet = 1.0 / det;
+            const double m00 = DecodeValue<double>(mat.getRawValue(0, 0)), m01 = DecodeValue<double>(mat.getRawValue(0, 1));
+            const double m10 = DecodeValue<double>(mat.getRawValue(1, 0)), m11 = DecodeValue<double>(mat.getRawValue(1, 1));
+
+            outResult.setRawValue(0, 0, EncodeValue<Type>( m11 * invDet));
+            outResult.setRawValue(0, 1, EncodeValue<Type>(-m01 * invDet));
+            outResult.setRawValue(1, 0, EncodeValue<Type>(-m10 * invDet));
+            outResult.setRawValue(1, 1, EncodeValue<Type>( m00 * invDet));
+            return true;
+        }
+        else
+        {
+            /// Gauss-Jordan on [A | I], row-major
+            double a[Size * Size], inv[Size * Size];
+            for (int row = 0; row < Size; ++row)
+            {
+                for (int col = 0; col < Size; ++col)
+                {
+                    a[row * Size + col] = DecodeValue<double>(mat.getRawValue(row, col));
+                    inv[row * Size + col] = row == col ? 1.0 : 0.0;
+                }
+            }
+
+            for (int k = 0; k < Size; ++k)
+            {
+                int pivot = k;
+                for (int row = k + 1; row < Size; ++row)
+                    if (helpers::abs(a[row * Size + k]) > helpers::abs(a[pivot * Size + k]))
+                        pivot = row;
+
+                if (helpers::abs(a[pivot * Size + k]) < Epsilon<Type>::value)
+                    return false;
+
+                if (pivot != k)
+                {
+                    for (int col = 0; col < Size; ++col)
+                    {
+                        std::swap(a[k * Size + col], a[pivot * Size + col]);
+                        std::swap(inv[k * Size + col], inv[pivot * Size + col]);
+                    }
+                }
+
+                const double invPivot = 1.0 / a[k * Size + k];
+                for (int col = 0; col < Size; ++col)
+                {
+                    a[k * Size + col] *= invPivot;
+                    inv[k * Size + col] *= invPivot;
+                }
+
+                for (int row = 0; row < Size; ++row)
+                {
+                    const double factor = a[row * Size + k];
+                    if (row == k || factor == 0.0)
+                        continue;
+
+                    for (int col = 0; col < Size; ++col)
+                    {
+                        a[row * Size + col] -= factor * a[k * Size + col];
+                        inv[row * Size + col] -= factor * inv[k * Size + col];
+                    }
+                }
+            }
+
+            for (int row = 0; row < Size; ++row)
+                for (int col = 0; col < Size; ++col)
+                    outResult.setRawValue(row, col, EncodeValue<Type>(inv[row * Size + col]));
+            return true;
+        }
+    }
+
+
+    /// <summary>
+    /// Scalar * matrix
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <param name="matrix"></param>
+    /// <returns></returns>
+    template<typename Type, int Rows, int Cols>
+    constexpr MatrixN<Type, Rows, Cols> operator*(Type scalar, const MatrixN<Type, Rows, Cols>& matrix)
+    {
+        return matrix * scalar;
+    }
+
+} /// namespace ETL::Math
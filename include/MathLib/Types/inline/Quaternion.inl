@@ -0,0 +1,948 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Quaternion.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/InstrumentationHook.h"
+#include "MathLib/Common/TypeComparisons.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Rotation of 'angle' radians around 'axis' (axis is normalized internally)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="axis"></param>
+    /// <param name="angle"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::CreateFromAxisAngle(const Vector3<double>& axis, double angle)
+    {
+        const double axisLength = axis.length();
+        ETLMATH_ASSERT(!isZero(axisLength), "Quaternion axis must not be zero");
+
+        double s, c;
+        SinCos(s, c, angle * 0.5, TrigPrecision::Precise);
+        s /= axisLength;
+
+        Quaternion<Type> result;
+        result.mX = EncodeValue<Type>(axis.x() * s);
+        result.mY = EncodeValue<Type>(axis.y() * s);
+        result.mZ = EncodeValue<Type>(axis.z() * s);
+        result.mW = EncodeValue<Type>(c);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Rotation from euler angles, matching Matrix4x4::CreateRotation (R = Rx * Ry * Rz)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="rX"></param>
+    /// <param name="rY"></param>
+    /// <param name="rZ"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::CreateFromEuler(double rX, double rY, double rZ)
+    {
+        double sX, cX, sY, cY, sZ, cZ;
+        SinCos(sX, cX, rX * 0.5, TrigPrecision::Precise);
+        SinCos(sY, cY, rY * 0.5, TrigPrecision::Precise);
+        SinCos(sZ, cZ, rZ * 0.5, TrigPrecision::Precise);
+
+        /// qX * qY * qZ expanded
+        const double x =  sX * cY * cZ + cX * sY * sZ;
+        const double y = -sX * cY * sZ + cX * sY * cZ;
+        const double z =  sX * sY * cZ + cX * cY * sZ;
+        const double w = -sX * sY * sZ + cX * cY * cZ;
+
+        Quaternion<Type> result;
+        result.mX = EncodeValue<Type>(x);
+        result.mY = EncodeValue<Type>(y);
+        result.mZ = EncodeValue<Type>(z);
+        result.mW = EncodeValue<Type>(w);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Rotation extracted from the upper 3x3 of a matrix (must be orthonormal)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="mat"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::CreateFromMatrix(const Matrix4x4<Type>& mat)
+    {
+        Quaternion<Type> result;
+        FromMatrix(result, mat);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Explicit constructor
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="x"></param>
+    /// <param name="y"></param>
+    /// <param name="z"></param>
+    /// <param name="w"></param>
+    template<typename Type>
+    constexpr Quaternion<Type>::Quaternion(Type x, Type y, Type z, Type w)
+        : mData{ EncodeValue<Type>(x), EncodeValue<Type>(y), EncodeValue<Type>(z), EncodeValue<Type>(w) }
+    {
+    }
+
+
+    /// <summary>
+    /// Explicit constructor from double (allows fixed point setup to non integral values)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="x"></param>
+    /// <param name="y"></param>
+    /// <param name="z"></param>
+    /// <param name="w"></param>
+    template<typename Type>
+    constexpr Quaternion<Type>::Quaternion(double x, double y, double z, double w) requires (!std::same_as<Type, double>)
+        : mData{ EncodeValue<Type>(x), EncodeValue<Type>(y), EncodeValue<Type>(z), EncodeValue<Type>(w) }
+    {
+    }
+
+
+    /// <summary>
+    /// Constructor from vector part and scalar part
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="xyz"></param>
+    /// <param name="w"></param>
+    template<typename Type>
+    constexpr Quaternion<Type>::Quaternion(const Vector3<Type>& xyz, Type w)
+        : mData{ xyz.getRawValue(0), xyz.getRawValue(1), xyz.getRawValue(2), EncodeValue<Type>(w) }
+    {
+    }
+
+
+    /// <summary>
+    /// Explicit Raw constructor
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name=""></param>
+    /// <param name="x"></param>
+    /// <param name="y"></param>
+    /// <param name="z"></param>
+    /// <param name="w"></param>
+    template<typename Type>
+    constexpr Quaternion<Type>::Quaternion(RawTag, Type x, Type y, Type z, Type w)
+        : mData{ x, y, z, w }
+    {
+    }
+
+
+    /// <summary>
+    /// X component getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Quaternion<Type>::x() const
+    {
+        return DecodeValue<Type>(mX);
+    }
+
+
+    /// <summary>
+    /// Y component getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Quaternion<Type>::y() const
+    {
+        return DecodeValue<Type>(mY);
+    }
+
+
+    /// <summary>
+    /// Z component getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Quaternion<Type>::z() const
+    {
+        return DecodeValue<Type>(mZ);
+    }
+
+
+    /// <summary>
+    /// W component getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Quaternion<Type>::w() const
+    {
+        return DecodeValue<Type>(mW);
+    }
+
+
+    /// <summary>
+    /// X component setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="x"></param>
+    template<typename Type>
+    inline void Quaternion<Type>::x(Type x)
+    {
+        mX = EncodeValue<Type>(x);
+    }
+
+
+    /// <summary>
+    /// Y component setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="y"></param>
+    template<typename Type>
+    inline void Quaternion<Type>::y(Type y)
+    {
+        mY = EncodeValue<Type>(y);
+    }
+
+
+    /// <summary>
+    /// Z component setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="z"></param>
+    template<typename Type>
+    inline void Quaternion<Type>::z(Type z)
+    {
+        mZ = EncodeValue<Type>(z);
+    }
+
+
+    /// <summary>
+    /// W component setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="w"></param>
+    template<typename Type>
+    inline void Quaternion<Type>::w(Type w)
+    {
+        mW = EncodeValue<Type>(w);
+    }
+
+
+    /// <summary>
+    /// Subscript operator (x, y, z, w)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline ElementProxy<Type> Quaternion<Type>::operator[](int index)
+    {
+        ETLMATH_ASSERT(index >= 0 && index < 4, "Quaternion out of bounds access");
+        return ElementProxy<Type>{ mData[index] };
+    }
+
+
+    /// <summary>
+    /// Const subscript operator (x, y, z, w)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Quaternion<Type>::operator[](int index) const
+    {
+        ETLMATH_ASSERT(index >= 0 && index < 4, "Quaternion out of bounds access");
+        return DecodeValue<Type>(mData[index]);
+    }
+
+
+    /// <summary>
+    /// Vector (imaginary) part getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> Quaternion<Type>::getVector() const
+    {
+        Vector3<Type> result;
+        result.setRawValue(0, mX);
+        result.setRawValue(1, mY);
+        result.setRawValue(2, mZ);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Addition operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::operator+(const Quaternion& other) const
+    {
+        return Quaternion<Type>{ Raw, mX + other.mX, mY + other.mY, mZ + other.mZ, mW + other.mW };
+    }
+
+
+    /// <summary>
+    /// Subtraction operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::operator-(const Quaternion& other) const
+    {
+        return Quaternion<Type>{ Raw, mX - other.mX, mY - other.mY, mZ - other.mZ, mW - other.mW };
+    }
+
+
+    /// <summary>
+    /// Hamilton product operator (composition: rotates by other, then this)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::operator*(const Quaternion& other) const
+    {
+        Quaternion<Type> result;
+        Multiply(result, *this, other);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Vector rotation operator (quaternion must be unit length)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="vector"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> Quaternion<Type>::operator*(const Vector3<Type>& vector) const
+    {
+        Vector3<Type> result;
+        Rotate(result, *this, vector);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Scalar multiplication operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::operator*(Type scalar) const
+    {
+        return Quaternion<Type>{ Raw, mX * scalar, mY * scalar, mZ * scalar, mW * scalar };
+    }
+
+
+    /// <summary>
+    /// Negation operator (same rotation, opposite hemisphere)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::operator-() const
+    {
+        return Quaternion<Type>{ Raw, -mX, -mY, -mZ, -mW };
+    }
+
+
+    /// <summary>
+    /// Addition assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type>& Quaternion<Type>::operator+=(const Quaternion& other)
+    {
+        mX += other.mX;
+        mY += other.mY;
+        mZ += other.mZ;
+        mW += other.mW;
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Subtraction assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type>& Quaternion<Type>::operator-=(const Quaternion& other)
+    {
+        mX -= other.mX;
+        mY -= other.mY;
+        mZ -= other.mZ;
+        mW -= other.mW;
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Hamilton product assignment operator (this = this * other)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type>& Quaternion<Type>::operator*=(const Quaternion& other)
+    {
+        Multiply(*this, *this, other);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Scalar multiplication assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type>& Quaternion<Type>::operator*=(Type scalar)
+    {
+        mX *= scalar;
+        mY *= scalar;
+        mZ *= scalar;
+        mW *= scalar;
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Equality operator (exact compare, q and -q are NOT considered equal)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Quaternion<Type>::operator==(const Quaternion<Type>& other) const
+    {
+        return std::equal(mData, mData + 4, other.mData);
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Quaternion<Type>::operator!=(const Quaternion<Type>& other) const
+    {
+        return !(*this == other);
+    }
+
+
+    /// <summary>
+    /// Dot product
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline double Quaternion<Type>::dot(const Quaternion<Type>& other) const
+    {
+        double result;
+        Dot(result, *this, other);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Length
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline double Quaternion<Type>::length() const
+    {
+        double result;
+        Length(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Squared length
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline double Quaternion<Type>::lengthSquared() const
+    {
+        double result;
+        Dot(result, *this, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Normalized copy (returns the input unchanged if length is zero)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::normalize() const
+    {
+        Quaternion<Type> result{ *this };
+        Normalize(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Normalize in place
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type>& Quaternion<Type>::makeNormalize()
+    {
+        Normalize(*this, *this);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Conjugate (inverse rotation for unit quaternions)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::conjugate() const
+    {
+        return Quaternion<Type>{ Raw, -mX, -mY, -mZ, mW };
+    }
+
+
+    /// <summary>
+    /// Inverse (returns the input unchanged if length is zero)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type> Quaternion<Type>::inverse() const
+    {
+        Quaternion<Type> result{ *this };
+        Inverse(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Inverse in place
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Quaternion<Type>& Quaternion<Type>::makeInverse()
+    {
+        Inverse(*this, *this);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Rotate a vector (quaternion must be unit length)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="vector"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Vector3<Type> Quaternion<Type>::rotate(const Vector3<Type>& vector) const
+    {
+        Vector3<Type> result;
+        Rotate(result, *this, vector);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Rotate a vector into outResult (quaternion must be unit length)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="vector"></param>
+    template<typename Type>
+    inline void Quaternion<Type>::rotateTo(Vector3<Type>& outResult, const Vector3<Type>& vector) const
+    {
+        Rotate(outResult, *this, vector);
+    }
+
+
+    /// <summary>
+    /// Rotation matrix (quaternion must be unit length)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type>
+    inline Matrix4x4<Type> Quaternion<Type>::toMatrix() const
+    {
+        Matrix4x4<Type> result;
+        ToMatrix(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Rotation matrix into outResult (quaternion must be unit length)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    template<typename Type>
+    inline void Quaternion<Type>::toMatrixTo(Matrix4x4<Type>& outResult) const
+    {
+        ToMatrix(outResult, *this);
+    }
+
+
+    /// <summary>
+    /// Direct access to internal storage - no conversions applied
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline Type Quaternion<Type>::getRawValue(int index) const
+    {
+        ETLMATH_ASSERT(index >= 0 && index < 4, "Quaternion out of bounds raw access");
+        return mData[index];
+    }
+
+
+    /// <summary>
+    /// Direct access to internal storage - no conversions applied
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <param name="value"></param>
+    template<typename Type>
+    inline void Quaternion<Type>::setRawValue(int index, Type value)
+    {
+        ETLMATH_ASSERT(index >= 0 && index < 4, "Quaternion out of bounds raw access");
+        mData[index] = value;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers (also present as class member functions.
+
+
+    /// <summary>
+    /// Hamilton product q1 * q2 (safe when outResult aliases an input)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="q1"></param>
+    /// <param name="q2"></param>
+    template<typename Type>
+    inline void Multiply(Quaternion<Type>& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2)
+    {
+        ETLMATH_INSTRUMENT(QuaternionMultiply);
+
+        using Calc = CalcType<Type>;
+
+        const Calc x1 = DecodeValue<Calc>(q1.getRawValue(0)), y1 = DecodeValue<Calc>(q1.getRawValue(1));
+        const Calc z1 = DecodeValue<Calc>(q1.getRawValue(2)), w1 = DecodeValue<Calc>(q1.getRawValue(3));
+        const Calc x2 = DecodeValue<Calc>(q2.getRawValue(0)), y2 = DecodeValue<Calc>(q2.getRawValue(1));
+        const Calc z2 = DecodeValue<Calc>(q2.getRawValue(2)), w2 = DecodeValue<Calc>(q2.getRawValue(3));
+
+        outResult.setRawValue(0, EncodeValue<Type>(w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2));
+        outResult.setRawValue(1, EncodeValue<Type>(w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2));
+        outResult.setRawValue(2, EncodeValue<Type>(w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2));
+        outResult.setRawValue(3, EncodeValue<Type>(w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2));
+    }
+
+
+    /// <summary>
+    /// Dot product
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="q1"></param>
+    /// <param name="q2"></param>
+    template<typename Type>
+    inline void Dot(double& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2)
+    {
+        outResult = 0.0;
+        for (int i = 0; i < 4; ++i)
+            outResult += DecodeValue<double>(q1.getRawValue(i)) * DecodeValue<double>(q2.getRawValue(i));
+    }
+
+
+    /// <summary>
+    /// Length
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="quat"></param>
+    template<typename Type>
+    inline void Length(double& outResult, const Quaternion<Type>& quat)
+    {
+        Dot(outResult, quat, quat);
+        outResult = std::sqrt(outResult);
+    }
+
+
+    /// <summary>
+    /// Normalize (returns false and leaves outResult untouched if length is zero)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="quat"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Normalize(Quaternion<Type>& outResult, const Quaternion<Type>& quat)
+    {
+        ETLMATH_INSTRUMENT(QuaternionNormalize);
+
+        double lengthSq;
+        Dot(lengthSq, quat, quat);
+        if (isZero(lengthSq))
+            return false;
+
+        const double invLength = 1.0 / std::sqrt(lengthSq);
+        for (int i = 0; i < 4; ++i)
+            outResult.setRawValue(i, static_cast<Type>(quat.getRawValue(i) * invLength));
+
+        return true;
+    }
+
+
+    /// <summary>
+    /// Conjugate
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="quat"></param>
+    template<typename Type>
+    inline void Conjugate(Quaternion<Type>& outResult, const Quaternion<Type>& quat)
+    {
+        outResult = quat.conjugate();
+    }
+
+
+    /// <summary>
+    /// Inverse: conjugate / lengthSquared (returns false and leaves outResult untouched if length is zero)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="quat"></param>
+    /// <returns></returns>
+    template<typename Type>
+    inline bool Inverse(Quaternion<Type>& outResult, const Quaternion<Type>& quat)
+    {
+        ETLMATH_INSTRUMENT(QuaternionInverse);
+
+        double lengthSq;
+        Dot(lengthSq, quat, quat);
+        if (isZero(lengthSq))
+            return false;
+
+        const double invLengthSq = 1.0 / lengthSq;
+        outResult.setRawValue(0, static_cast<Type>(-quat.getRawValue(0) * invLengthSq));
+        outResult.setRawValue(1, static_cast<Type>(-quat.getRawValue(1) * invLengthSq));
+        outResult.setRawValue(2, static_cast<Type>(-quat.getRawValue(2) * invLengthSq));
+        outResult.setRawValue(3, static_cast<Type>( quat.getRawValue(3) * invLengthSq));
+
+        return true;
+    }
+
+
+    /// <summary>
+    /// Rotate a vector: v' = v + w * t + q.xyz x t, with t = 2 * (q.xyz x v)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="quat"></param>
+    /// <param name="vector"></param>
+    template<typename Type>
+    inline void Rotate(Vector3<Type>& outResult, const Quaternion<Type>& quat, const Vector3<Type>& vector)
+    {
+        using Calc = CalcType<Type>;
+
+        const Calc qx = DecodeValue<Calc>(quat.getRawValue(0)), qy = DecodeValue<Calc>(quat.getRawValue(1));
+        const Calc qz = DecodeValue<Calc>(quat.getRawValue(2)), qw = DecodeValue<Calc>(quat.getRawValue(3));
+        const Calc vx = DecodeValue<Calc>(vector.getRawValue(0));
+        const Calc vy = DecodeValue<Calc>(vector.getRawValue(1));
+        const Calc vz = DecodeValue<Calc>(vector.getRawValue(2));
+
+        const Calc tx = Calc(2) * (qy * vz - qz * vy);
+        const Calc ty = Calc(2) * (qz * vx - qx * vz);
+        const Calc tz = Calc(2) * (qx * vy - qy * vx);
+
+        outResult.setRawValue(0, EncodeValue<Type>(vx + qw * tx + (qy * tz - qz * ty)));
+        outResult.setRawValue(1, EncodeValue<Type>(vy + qw * ty + (qz * tx - qx * tz)));
+        outResult.setRawValue(2, EncodeValue<Type>(vz + qw * tz + (qx * ty - qy * tx)));
+    }
+
+
+    /// <summary>
+    /// Rotation matrix from unit quaternion (no translation, w row/col = identity)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="quat"></param>
+    template<typename Type>
+    inline void ToMatrix(Matrix4x4<Type>& outResult, const Quaternion<Type>& quat)
+    {
+        using Calc = CalcType<Type>;
+
+        const Calc x = DecodeValue<Calc>(quat.getRawValue(0)), y = DecodeValue<Calc>(quat.getRawValue(1));
+        const Calc z = DecodeValue<Calc>(quat.getRawValue(2)), w = DecodeValue<Calc>(quat.getRawValue(3));
+
+        const Calc xx = x * x, yy = y * y, zz = z * z;
+        const Calc xy = x * y, xz = x * z, yz = y * z;
+        const Calc wx = w * x, wy = w * y, wz = w * z;
+
+        const Calc one{ 1 }, two{ 2 }, zero{ 0 };
+        outResult = Matrix4x4<Type>{ one - two * (yy + zz),       two * (xy - wz),       two * (xz + wy), zero,
+                                           two * (xy + wz), one - two * (xx + zz),       two * (yz - wx), zero,
+                                           two * (xz - wy),       two * (yz + wx), one - two * (xx + yy), zero,
+                                                      zero,                  zero,                  zero, one };
+    }
+
+
+    /// <summary>
+    /// Unit quaternion from the upper 3x3 rotation of a matrix (Shepperd's method, picks the
+    /// largest diagonal term to stay well conditioned)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    inline void FromMatrix(Quaternion<Type>& outResult, const Matrix4x4<Type>& mat)
+    {
+        auto m = [&mat](int row, int col) { return DecodeValue<double>(mat.getRawValue(row, col)); };
+
+        const double m00 = m(0, 0), m11 = m(1, 1), m22 = m(2, 2);
+        const double trace = m00 + m11 + m22;
+
+        double x, y, z, w;
+        if (trace > 0.0)
+        {
+            const double s = std::sqrt(trace + 1.0) * 2.0;
+            w = 0.25 * s;
+            x = (m(2, 1) - m(1, 2)) / s;
+            y = (m(0, 2) - m(2, 0)) / s;
+            z = (m(1, 0) - m(0, 1)) / s;
+        }
+        else if (m00 > m11 && m00 > m22)
+        {
+            const double s = std::sqrt(1.0 + m00 - m11 - m22) * 2.0;
+            w = (m(2, 1) - m(1, 2)) / s;
+            x = 0.25 * s;
+            y = (m(0, 1) + m(1, 0)) / s;
+            z = (m(0, 2) + m(2, 0)) / s;
+        }
+        else if (m11 > m22)
+        {
+            const double s = std::sqrt(1.0 + m11 - m00 - m22) * 2.0;
+            w = (m(0, 2) - m(2, 0)) / s;
+            x = (m(0, 1) + m(1, 0)) / s;
+            y = 0.25 * s;
+            z = (m(1, 2) + m(2, 1)) / s;
+        }
+        else
+        {
+            const double s = std::sqrt(1.0 + m22 - m00 - m11) * 2.0;
+            w = (m(1, 0) - m(0, 1)) / s;
+            x = (m(0, 2) + m(2, 0)) / s;
+            y = (m(1, 2) + m(2, 1)) / s;
+            z = 0.25 * s;
+        }
+
+        outResult.setRawValue(0, EncodeValue<Type>(x));
+        outResult.setRawValue(1, EncodeValue<Type>(y));
+        outResult.setRawValue(2, EncodeValue<Type>(z));
+        outResult.setRawValue(3, EncodeValue<Type>(w));
+    }
+
+
+    /// <summary>
+    /// Normalized linear interpolation along the shortest path
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="q1"></param>
+    /// <param name="q2"></param>
+    /// <param name="t"></param>
+    template<typename Type>
+    inline void Nlerp(Quaternion<Type>& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2, double t)
+    {
+        double cosTheta;
+        Dot(cosTheta, q1, q2);
+        const double t2 = (cosTheta < 0.0) ? -t : t;
+
+        double values[4];
+        double lengthSq = 0.0;
+        for (int i = 0; i < 4; ++i)
+        {
+            values[i] = DecodeValue<double>(q1.getRawValue(i)) * (1.0 - t) + DecodeValue<double>(q2.getRawValue(i)) * t2;
+            lengthSq += values[i] * values[i];
+        }
+
+        const double invLength = isZero(lengthSq) ? 0.0 : 1.0 / std::sqrt(lengthSq);
+        for (int i = 0; i < 4; ++i)
+            outResult.setRawValue(i, EncodeValue<Type>(values[i] * invLength));
+    }
+
+
+    /// <summary>
+    /// Spherical linear interpolation along the shortest path (falls back to Nlerp for nearly parallel inputs)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="q1"></param>
+    /// <param name="q2"></param>
+    /// <param name="t"></param>
+    template<typename Type>
+    inline void Slerp(Quaternion<Type>& outResult, const Quaternion<Type>& q1, const Quaternion<Type>& q2, double t)
+    {
+        double cosTheta;
+        Dot(cosTheta, q1, q2);
+        const double sign = (cosTheta < 0.0) ? -1.0 : 1.0;
+        cosTheta *= sign;
+
+        if (cosTheta > 0.9995)
+        {
+            Nlerp(outResult, q1, q2, t);
+            return;
+        }
+
+        const double theta = std::acos(cosTheta);
+        const double invSin = 1.0 / std::sin(theta);
+        const double w1 = std::sin((1.0 - t) * theta) * invSin;
+        const double w2 = std::sin(t * theta) * invSin * sign;
+
+        double values[4];
+        for (int i = 0; i < 4; ++i)
+            values[i] = DecodeValue<double>(q1.getRawValue(i)) * w1 + DecodeValue<double>(q2.getRawValue(i)) * w2;
+
+        for (int i = 0; i < 4; ++i)
+            outResult.setRawValue(i, EncodeValue<Type>(values[i]));
+    }
+
+} /// namespace ETL::Math
@@ -4,6 +4,7 @@
 ///----------------------------------------------------------------------------
 
 #include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/InstrumentationHook.h"
 #include "MathLib/Common/TypeComparisons.h"
 #include <algorithm>
 #include <cmath>
@@ -69,9 +70,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector2<Type>::x() const
+    constexpr Type Vector2<Type>::x() const
     {
-        return DecodeValue<Type>(mX);
+        return DecodeValue<Type>(mData[0]);
     }
 
 
@@ -81,9 +82,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector2<Type>::y() const
+    constexpr Type Vector2<Type>::y() const
     {
-        return DecodeValue<Type>(mY);
+        return DecodeValue<Type>(mData[1]);
     }
 
 
@@ -93,9 +94,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="x"></param>
     template<typename Type>
-    inline void Vector2<Type>::x(Type x)
+    constexpr void Vector2<Type>::x(Type x)
     {
-        mX = EncodeValue<Type>(x);
+        mData[0] = EncodeValue<Type>(x);
     }
 
 
@@ -105,9 +106,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="y"></param>
     template<typename Type>
-    inline void Vector2<Type>::y(Type y)
+    constexpr void Vector2<Type>::y(Type y)
     {
-        mY = EncodeValue<Type>(y);
+        mData[1] = EncodeValue<Type>(y);
     }
 
 
@@ -118,7 +119,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline ElementProxy<Type> Vector2<Type>::operator[](int index)
+    constexpr ElementProxy<Type> Vector2<Type>::operator[](int index)
     {
         ETLMATH_ASSERT(index >= 0 && index < 2, "Vector2 out of bounds access");
         return ElementProxy<Type>{ mData[index] };
@@ -132,7 +133,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector2<Type>::operator[](int index) const
+    constexpr Type Vector2<Type>::operator[](int index) const
     {
         ETLMATH_ASSERT(index >= 0 && index < 2, "Vector2 out of bounds access");
         return DecodeValue<Type>(mData[index]);
@@ -146,9 +147,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector2<Type>::operator+(const Vector2<Type>& other) const
+    constexpr Vector2<Type> Vector2<Type>::operator+(const Vector2<Type>& other) const
     {
-        return Vector2<Type>{ Raw, mX + other.mX, mY + other.mY };
+        Vector2<Type> result{ *this };
+        result += other;
+        return result;
     }
 
 
@@ -159,9 +162,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector2<Type>::operator-(const Vector2<Type>& other) const
+    constexpr Vector2<Type> Vector2<Type>::operator-(const Vector2<Type>& other) const
     {
-        return Vector2<Type>{ Raw, mX - other.mX, mY - other.mY };
+        Vector2<Type> result{ *this };
+        result -= other;
+        return result;
     }
 
 
@@ -172,7 +177,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector2<Type>::operator*(const Vector2<Type>& other) const
+    constexpr double Vector2<Type>::operator*(const Vector2<Type>& other) const
     {
         double result;
         Dot(result, *this, other);
@@ -187,7 +192,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector2<Type>::operator^(const Vector2<Type>& other) const
+    constexpr double Vector2<Type>::operator^(const Vector2<Type>& other) const
     {
         double result;
         Cross(result, *this, other);
@@ -202,9 +207,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector2<Type>::operator*(Type scalar) const
+    constexpr Vector2<Type> Vector2<Type>::operator*(Type scalar) const
     {
-        return Vector2<Type>{ Raw, mX * scalar, mY * scalar };
+        Vector2<Type> result{ *this };
+        result *= scalar;
+        return result;
     }
 
 
@@ -215,20 +222,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector2<Type>::operator/(Type scalar) const
+    constexpr Vector2<Type> Vector2<Type>::operator/(Type scalar) const
     {
-        ETLMATH_ASSERT(!isZeroRaw(scalar), "Vector2 division by 0");
-
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            return Vector2<Type>{ Raw, mX / scalar, mY / scalar };
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            return Vector2<Type>{ Raw, mX * inv, mY * inv };
-        }
+        Vector2<Type> result{ *this };
+        result /= scalar;
+        return result;
     }
 
 
@@ -238,9 +236,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector2<Type>::operator-() const
+    constexpr Vector2<Type> Vector2<Type>::operator-() const
     {
-        return Vector2<Type>{ Raw, -mX, -mY };
+        return Vector2<Type>{ Raw, -mData[0], -mData[1] };
     }
 
 
@@ -251,10 +249,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type>& Vector2<Type>::operator+=(const Vector2<Type>& other)
+    constexpr Vector2<Type>& Vector2<Type>::operator+=(const Vector2<Type>& other)
     {
-        mX += other.mX;
-        mY += other.mY;
+        helpers::AddRaw<Type, 2>(mData, other.mData);
         return *this;
     }
 
@@ -266,10 +263,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type>& Vector2<Type>::operator-=(const Vector2<Type>& other)
+    constexpr Vector2<Type>& Vector2<Type>::operator-=(const Vector2<Type>& other)
     {
-        mX -= other.mX;
-        mY -= other.mY;
+        helpers::SubtractRaw<Type, 2>(mData, other.mData);
         return *this;
     }
 
@@ -281,10 +277,9 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type>& Vector2<Type>::operator*=(Type scalar)
+    constexpr Vector2<Type>& Vector2<Type>::operator*=(Type scalar)
     {
-        mX *= scalar;
-        mY *= scalar;
+        helpers::ScaleRaw<Type, 2>(mData, scalar);
         return *this;
     }
 
@@ -296,23 +291,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type>& Vector2<Type>::operator/=(Type scalar)
+    constexpr Vector2<Type>& Vector2<Type>::operator/=(Type scalar)
     {
         ETLMATH_ASSERT(!isZeroRaw(scalar), "Vector2 division by 0");
 
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            mX /= scalar;
-            mY /= scalar;
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            mX *= inv;
-            mY *= inv;
-        }
-
+        helpers::DivideRaw<Type, 2>(mData, scalar);
         return *this;
     }
 
@@ -324,7 +307,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector2<Type>::operator==(const Vector2<Type>& other) const
+    constexpr bool Vector2<Type>::operator==(const Vector2<Type>& other) const
     {
         return std::equal(mData, mData + 2, other.mData);
     }
@@ -337,7 +320,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector2<Type>::operator!=(const Vector2<Type>& other) const
+    constexpr bool Vector2<Type>::operator!=(const Vector2<Type>& other) const
     {
         return !(*this == other);
     }
@@ -350,7 +333,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector2<Type>::componentMul(const Vector2<Type>& other) const
+    constexpr Vector2<Type> Vector2<Type>::componentMul(const Vector2<Type>& other) const
     {
         Vector2<Type> result;
         ComponentMul(result, *this, other);
@@ -365,7 +348,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector2<Type>::componentDiv(const Vector2<Type>& other) const
+    constexpr Vector2<Type> Vector2<Type>::componentDiv(const Vector2<Type>& other) const
     {
         Vector2<Type> result;
         ComponentDiv(result, *this, other);
@@ -379,7 +362,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="other"></param>
     template<typename Type>
-    inline void Vector2<Type>::componentMulInPlace(const Vector2<Type>& other)
+    constexpr void Vector2<Type>::componentMulInPlace(const Vector2<Type>& other)
     {
         ComponentMul(*this, *this, other);
     }
@@ -391,7 +374,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="other"></param>
     template<typename Type>
-    inline void Vector2<Type>::componentDivInPlace(const Vector2<Type>& other)
+    constexpr void Vector2<Type>::componentDivInPlace(const Vector2<Type>& other)
     {
         ComponentDiv(*this, *this, other);
     }
@@ -404,7 +387,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector2<Type>::dot(const Vector2<Type>& other) const
+    constexpr double Vector2<Type>::dot(const Vector2<Type>& other) const
     {
         double result;
         Dot(result, *this, other);
@@ -419,7 +402,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector2<Type>::cross(const Vector2<Type>& other) const
+    constexpr double Vector2<Type>::cross(const Vector2<Type>& other) const
     {
         double result;
         Cross(result, *this, other);
@@ -447,7 +430,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector2<Type>::lengthSquared() const
+    constexpr double Vector2<Type>::lengthSquared() const
     {
         double result;
         LengthSquared(result, *this);
@@ -489,7 +472,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector2<Type>::getRawValue(int index) const
+    constexpr Type Vector2<Type>::getRawValue(int index) const
     {
         ETLMATH_ASSERT(index >= 0 && index < 2, "Vector2 out of bounds raw access");
         return mData[index];
@@ -503,7 +486,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Vector2<Type>::setRawValue(int index, Type value)
+    constexpr void Vector2<Type>::setRawValue(int index, Type value)
     {
         ETLMATH_ASSERT(index >= 0 && index < 2, "Vector2 out of bounds raw access");
         mData[index] = value;
@@ -521,7 +504,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void ComponentMul(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
+    constexpr void ComponentMul(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
     {
         if constexpr (std::integral<Type>)
         {
@@ -546,7 +529,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void ComponentDiv(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
+    constexpr void ComponentDiv(Vector2<Type>& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
     {
         ETLMATH_ASSERT(!isZero(v2.getRawValue(0)) && !isZero(v2.getRawValue(1)), "Division by 0 in ComponentDiv (Vector2)");
 
@@ -575,7 +558,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void Dot(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
+    constexpr void Dot(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
     {
         //constexpr int fixedPointScale = std::integral<Type> ? FIXED_ONE : 1;
         //const double x1 = static_cast<double>(v1.getRawValue(0)) / fixedPointScale;
@@ -611,7 +594,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void Cross(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
+    constexpr void Cross(double& outResult, const Vector2<Type>& v1, const Vector2<Type>& v2)
     {
         if constexpr (std::integral<Type>)
         {
@@ -654,7 +637,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="vec"></param>
     template<typename Type>
-    inline void LengthSquared(double& outResult, const Vector2<Type>& vec)
+    constexpr void LengthSquared(double& outResult, const Vector2<Type>& vec)
     {
         Dot(outResult, vec, vec);
     }
@@ -669,6 +652,8 @@ namespace ETL::Math
     template<typename Type>
     inline bool Normalize(Vector2<Type>& outResult, const Vector2<Type>& vec)
     {
+        ETLMATH_INSTRUMENT(Vector2Normalize);
+
         double lengthSq;
         LengthSquared(lengthSq, vec);
         if (isZero(lengthSq))
@@ -691,7 +676,7 @@ namespace ETL::Math
     /// <param name="vector"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> operator*(Type scalar, const Vector2<Type>& vector)
+    constexpr Vector2<Type> operator*(Type scalar, const Vector2<Type>& vector)
     {
         return vector * scalar;
     }
@@ -4,6 +4,7 @@
 ///----------------------------------------------------------------------------
 
 #include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/InstrumentationHook.h"
 #include "MathLib/Common/TypeComparisons.h"
 #include <algorithm>
 #include <cmath>
@@ -84,9 +85,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector3<Type>::x() const
+    constexpr Type Vector3<Type>::x() const
     {
-        return DecodeValue<Type>(mX);
+        return DecodeValue<Type>(mData[0]);
     }
 
 
@@ -96,9 +97,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector3<Type>::y() const
+    constexpr Type Vector3<Type>::y() const
     {
-        return DecodeValue<Type>(mY);
+        return DecodeValue<Type>(mData[1]);
     }
 
 
@@ -108,9 +109,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector3<Type>::z() const
+    constexpr Type Vector3<Type>::z() const
     {
-        return DecodeValue<Type>(mZ);
+        return DecodeValue<Type>(mData[2]);
     }
 
 
@@ -120,9 +121,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="x"></param>
     template<typename Type>
-    inline void Vector3<Type>::x(Type x)
+    constexpr void Vector3<Type>::x(Type x)
     {
-        mX = EncodeValue<Type>(x);
+        mData[0] = EncodeValue<Type>(x);
     }
 
 
@@ -132,9 +133,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="y"></param>
     template<typename Type>
-    inline void Vector3<Type>::y(Type y)
+    constexpr void Vector3<Type>::y(Type y)
     {
-        mY = EncodeValue<Type>(y);
+        mData[1] = EncodeValue<Type>(y);
     }
 
 
@@ -144,9 +145,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="z"></param>
     template<typename Type>
-    inline void Vector3<Type>::z(Type z)
+    constexpr void Vector3<Type>::z(Type z)
     {
-        mZ = EncodeValue<Type>(z);
+        mData[2] = EncodeValue<Type>(z);
     }
 
 
@@ -157,7 +158,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline ElementProxy<Type> Vector3<Type>::operator[](int index)
+    constexpr ElementProxy<Type> Vector3<Type>::operator[](int index)
     {
         ETLMATH_ASSERT(index >= 0 && index < 3, "Vector3 out of bounds access");
         return ElementProxy<Type>{ mData[index] };
@@ -171,7 +172,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector3<Type>::operator[](int index) const
+    constexpr Type Vector3<Type>::operator[](int index) const
     {
         ETLMATH_ASSERT(index >= 0 && index < 3, "Vector3 out of bounds access");
         return DecodeValue<Type>(mData[index]);
@@ -185,9 +186,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::operator+(const Vector3& other) const
+    constexpr Vector3<Type> Vector3<Type>::operator+(const Vector3& other) const
     {
-        return Vector3<Type>{ Raw, mX + other.mX, mY + other.mY, mZ + other.mZ };
+        Vector3<Type> result{ *this };
+        result += other;
+        return result;
     }
 
 
@@ -198,9 +201,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::operator-(const Vector3& other) const
+    constexpr Vector3<Type> Vector3<Type>::operator-(const Vector3& other) const
     {
-        return Vector3<Type>{ Raw, mX - other.mX, mY - other.mY, mZ - other.mZ };
+        Vector3<Type> result{ *this };
+        result -= other;
+        return result;
     }
 
 
@@ -211,7 +216,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector3<Type>::operator*(const Vector3<Type>& other) const
+    constexpr double Vector3<Type>::operator*(const Vector3<Type>& other) const
     {
         double result;
         Dot(result, *this, other);
@@ -226,7 +231,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::operator^(const Vector3<Type>& other) const
+    constexpr Vector3<Type> Vector3<Type>::operator^(const Vector3<Type>& other) const
     {
         Vector3<Type> result;
         Cross(result, *this, other);
@@ -241,9 +246,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::operator*(Type scalar) const
+    constexpr Vector3<Type> Vector3<Type>::operator*(Type scalar) const
     {
-        return Vector3<Type>{ Raw, mX * scalar, mY * scalar, mZ * scalar };
+        Vector3<Type> result{ *this };
+        result *= scalar;
+        return result;
     }
 
 
@@ -254,20 +261,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::operator/(Type scalar) const
+    constexpr Vector3<Type> Vector3<Type>::operator/(Type scalar) const
     {
-        ETLMATH_ASSERT(!isZeroRaw(scalar), "Vector3 division by 0");
-
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            return Vector3<Type>{ Raw, mX / scalar, mY / scalar, mZ / scalar };
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            return Vector3<Type>{ Raw, mX * inv, mY * inv, mZ * inv };
-        }
+        Vector3<Type> result{ *this };
+        result /= scalar;
+        return result;
     }
 
 
@@ -277,9 +275,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::operator-() const
+    constexpr Vector3<Type> Vector3<Type>::operator-() const
     {
-        return Vector3<Type>{ Raw, -mX, -mY, -mZ };
+        return Vector3<Type>{ Raw, -mData[0], -mData[1], -mData[2] };
     }
 
 
@@ -290,11 +288,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type>& Vector3<Type>::operator+=(const Vector3& other)
+    constexpr Vector3<Type>& Vector3<Type>::operator+=(const Vector3& other)
     {
-        mX += other.mX;
-        mY += other.mY;
-        mZ += other.mZ;
+        helpers::AddRaw<Type, 3>(mData, other.mData);
         return *this;
     }
 
@@ -306,11 +302,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type>& Vector3<Type>::operator-=(const Vector3& other)
+    constexpr Vector3<Type>& Vector3<Type>::operator-=(const Vector3& other)
     {
-        mX -= other.mX;
-        mY -= other.mY;
-        mZ -= other.mZ;
+        helpers::SubtractRaw<Type, 3>(mData, other.mData);
         return *this;
     }
 
@@ -322,11 +316,9 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type>& Vector3<Type>::operator*=(Type scalar)
+    constexpr Vector3<Type>& Vector3<Type>::operator*=(Type scalar)
     {
-        mX *= scalar;
-        mY *= scalar;
-        mZ *= scalar;
+        helpers::ScaleRaw<Type, 3>(mData, scalar);
         return *this;
     }
 
@@ -338,25 +330,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type>& Vector3<Type>::operator/=(Type scalar)
+    constexpr Vector3<Type>& Vector3<Type>::operator/=(Type scalar)
     {
         ETLMATH_ASSERT(!isZeroRaw(scalar), "Vector3 division by 0");
 
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            mX /= scalar;
-            mY /= scalar;
-            mZ /= scalar;
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            mX *= inv;
-            mY *= inv;
-            mZ *= inv;
-        }
-
+        helpers::DivideRaw<Type, 3>(mData, scalar);
         return *this;
     }
 
@@ -368,7 +346,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector3<Type>::operator==(const Vector3<Type>& other) const
+    constexpr bool Vector3<Type>::operator==(const Vector3<Type>& other) const
     {
         return std::equal(mData, mData + 3, other.mData);
     }
@@ -381,7 +359,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector3<Type>::operator!=(const Vector3<Type>& other) const
+    constexpr bool Vector3<Type>::operator!=(const Vector3<Type>& other) const
     {
         return !(*this == other);
     }
@@ -394,7 +372,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::componentMul(const Vector3<Type>& other) const
+    constexpr Vector3<Type> Vector3<Type>::componentMul(const Vector3<Type>& other) const
     {
         Vector3<Type> result;
         ComponentMul(result, *this, other);
@@ -409,7 +387,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::componentDiv(const Vector3<Type>& other) const
+    constexpr Vector3<Type> Vector3<Type>::componentDiv(const Vector3<Type>& other) const
     {
         Vector3<Type> result;
         ComponentDiv(result, *this, other);
@@ -423,7 +401,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="other"></param>
     template<typename Type>
-    inline void Vector3<Type>::componentMulInPlace(const Vector3<Type>& other)
+    constexpr void Vector3<Type>::componentMulInPlace(const Vector3<Type>& other)
     {
         ComponentMul(*this, *this, other);
     }
@@ -435,7 +413,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="other"></param>
     template<typename Type>
-    inline void Vector3<Type>::componentDivInPlace(const Vector3<Type>& other)
+    constexpr void Vector3<Type>::componentDivInPlace(const Vector3<Type>& other)
     {
         ComponentDiv(*this, *this, other);
     }
@@ -448,7 +426,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector3<Type>::dot(const Vector3<Type>& other) const
+    constexpr double Vector3<Type>::dot(const Vector3<Type>& other) const
     {
         double result;
         Dot(result, *this, other);
@@ -463,7 +441,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector3<Type>::cross(const Vector3<Type>& other) const
+    constexpr Vector3<Type> Vector3<Type>::cross(const Vector3<Type>& other) const
     {
         Vector3<Type> result;
         Cross(result, *this, other);
@@ -491,7 +469,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector3<Type>::lengthSquared() const
+    constexpr double Vector3<Type>::lengthSquared() const
     {
         double result;
         LengthSquared(result, *this);
@@ -532,7 +510,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector3<Type>::toVector2() const
+    constexpr Vector2<Type> Vector3<Type>::toVector2() const
     {
         Vector2<Type> result;
         ToVector2(result, *this);
@@ -546,7 +524,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector2<Type> Vector3<Type>::perspectiveDivide() const
+    constexpr Vector2<Type> Vector3<Type>::perspectiveDivide() const
     {
         Vector2<Type> result;
         PerspectiveDivide(result, *this);
@@ -560,9 +538,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector3<Type>::isPoint() const
+    constexpr bool Vector3<Type>::isPoint() const
     {
-        return isEqual(mZ, EncodeValue<Type>(Type(1)));
+        return isEqual(mData[2], EncodeValue<Type>(Type(1)));
     }
 
 
@@ -572,9 +550,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector3<Type>::isDirection() const
+    constexpr bool Vector3<Type>::isDirection() const
     {
-        return isEqual(mZ, EncodeValue<Type>(Type(0)));
+        return isEqual(mData[2], EncodeValue<Type>(Type(0)));
     }
 
 
@@ -585,7 +563,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector3<Type>::getRawValue(int index) const
+    constexpr Type Vector3<Type>::getRawValue(int index) const
     {
         ETLMATH_ASSERT(index >= 0 && index < 3, "Vector3 out of bounds raw access");
         return mData[index];
@@ -599,7 +577,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Vector3<Type>::setRawValue(int index, Type value)
+    constexpr void Vector3<Type>::setRawValue(int index, Type value)
     {
         ETLMATH_ASSERT(index >= 0 && index < 3, "Vector3 out of bounds raw access");
         mData[index] = value;
@@ -617,7 +595,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void ComponentMul(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
+    constexpr void ComponentMul(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
     {
         if constexpr (std::integral<Type>)
         {
@@ -645,7 +623,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void ComponentDiv(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
+    constexpr void ComponentDiv(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
     {
         ETLMATH_ASSERT(!isZero(v2.getRawValue(0)) && !isZero(v2.getRawValue(1)) && !isZero(v2.getRawValue(2)),
                        "Division by 0 in ComponentDiv (Vector3)");
@@ -678,7 +656,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void Dot(double& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
+    constexpr void Dot(double& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
     {
         if constexpr (std::integral<Type>)
         {
@@ -711,7 +689,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void Cross(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
+    constexpr void Cross(Vector3<Type>& outResult, const Vector3<Type>& v1, const Vector3<Type>& v2)
     {
         if constexpr (std::integral<Type>)
         {
@@ -761,7 +739,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="vec"></param>
     template<typename Type>
-    inline void LengthSquared(double& outResult, const Vector3<Type>& vec)
+    constexpr void LengthSquared(double& outResult, const Vector3<Type>& vec)
     {
         Dot(outResult, vec, vec);
     }
@@ -776,6 +754,8 @@ namespace ETL::Math
     template<typename Type>
     inline bool Normalize(Vector3<Type>& outResult, const Vector3<Type>& vec)
     {
+        ETLMATH_INSTRUMENT(Vector3Normalize);
+
         double lengthSq;
         LengthSquared(lengthSq, vec);
         if (isZero(lengthSq))
@@ -798,7 +778,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="vec"></param>
     template<typename Type>
-    inline void ToVector2(Vector2<Type>& outResult, const Vector3<Type>& vec)
+    constexpr void ToVector2(Vector2<Type>& outResult, const Vector3<Type>& vec)
     {
         outResult.setRawValue(0, vec.getRawValue(0));
         outResult.setRawValue(1, vec.getRawValue(1));
@@ -812,7 +792,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="vec"></param>
     template<typename Type>
-    inline void PerspectiveDivide(Vector2<Type>& outResult, const Vector3<Type>& vec)
+    constexpr void PerspectiveDivide(Vector2<Type>& outResult, const Vector3<Type>& vec)
     {
         ETLMATH_ASSERT(!isZero(vec.getRawValue(2)), "Division by 0 in PerspectiveDivide (Vector3 to Vector2)");
 
@@ -841,7 +821,7 @@ namespace ETL::Math
     /// <param name="vector"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> operator*(Type scalar, const Vector3<Type>& vector)
+    constexpr Vector3<Type> operator*(Type scalar, const Vector3<Type>& vector)
     {
         return vector * scalar;
     }
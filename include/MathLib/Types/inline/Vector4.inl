@@ -4,6 +4,7 @@
 ///----------------------------------------------------------------------------
 
 #include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/InstrumentationHook.h"
 #include "MathLib/Common/TypeComparisons.h"
 #include <algorithm>
 #include <cmath>
@@ -88,9 +89,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector4<Type>::x() const
+    constexpr Type Vector4<Type>::x() const
     {
-        return DecodeValue<Type>(mX);
+        return DecodeValue<Type>(mData[0]);
     }
 
 
@@ -100,9 +101,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector4<Type>::y() const
+    constexpr Type Vector4<Type>::y() const
     {
-        return DecodeValue<Type>(mY);
+        return DecodeValue<Type>(mData[1]);
     }
 
 
@@ -112,9 +113,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector4<Type>::z() const
+    constexpr Type Vector4<Type>::z() const
     {
-        return DecodeValue<Type>(mZ);
+        return DecodeValue<Type>(mData[2]);
     }
 
 
@@ -124,9 +125,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector4<Type>::w() const
+    constexpr Type Vector4<Type>::w() const
     {
-        return DecodeValue<Type>(mW);
+        return DecodeValue<Type>(mData[3]);
     }
 
 
@@ -136,9 +137,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="x"></param>
     template<typename Type>
-    inline void Vector4<Type>::x(Type x)
+    constexpr void Vector4<Type>::x(Type x)
     {
-        mX = EncodeValue<Type>(x);
+        mData[0] = EncodeValue<Type>(x);
     }
 
 
@@ -148,9 +149,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="y"></param>
     template<typename Type>
-    inline void Vector4<Type>::y(Type y)
+    constexpr void Vector4<Type>::y(Type y)
     {
-        mY = EncodeValue<Type>(y);
+        mData[1] = EncodeValue<Type>(y);
     }
 
 
@@ -160,9 +161,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="z"></param>
     template<typename Type>
-    inline void Vector4<Type>::z(Type z)
+    constexpr void Vector4<Type>::z(Type z)
     {
-        mZ = EncodeValue<Type>(z);
+        mData[2] = EncodeValue<Type>(z);
     }
 
 
@@ -172,9 +173,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="z"></param>
     template<typename Type>
-    inline void Vector4<Type>::w(Type w)
+    constexpr void Vector4<Type>::w(Type w)
     {
-        mW = EncodeValue<Type>(w);
+        mData[3] = EncodeValue<Type>(w);
     }
 
 
@@ -185,7 +186,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline ElementProxy<Type> Vector4<Type>::operator[](int index)
+    constexpr ElementProxy<Type> Vector4<Type>::operator[](int index)
     {
         ETLMATH_ASSERT(index >= 0 && index < 4, "Vector4 out of bounds access");
         return ElementProxy<Type>{ mData[index] };
@@ -199,7 +200,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector4<Type>::operator[](int index) const
+    constexpr Type Vector4<Type>::operator[](int index) const
     {
         ETLMATH_ASSERT(index >= 0 && index < 4, "Vector4 out of bounds access");
         return DecodeValue<Type>(mData[index]);
@@ -213,9 +214,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> Vector4<Type>::operator+(const Vector4& other) const
+    constexpr Vector4<Type> Vector4<Type>::operator+(const Vector4& other) const
     {
-        return Vector4<Type>{ Raw, mX + other.mX, mY + other.mY, mZ + other.mZ, mW + other.mW };
+        Vector4<Type> result{ *this };
+        result += other;
+        return result;
     }
 
 
@@ -226,9 +229,11 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> Vector4<Type>::operator-(const Vector4& other) const
+    constexpr Vector4<Type> Vector4<Type>::operator-(const Vector4& other) const
     {
-        return Vector4<Type>{ Raw, mX - other.mX, mY - other.mY, mZ - other.mZ, mW - other.mW  };
+        Vector4<Type> result{ *this };
+        result -= other;
+        return result;
     }
 
 
@@ -239,7 +244,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector4<Type>::operator*(const Vector4<Type>& other) const
+    constexpr double Vector4<Type>::operator*(const Vector4<Type>& other) const
     {
         double result;
         Dot(result, *this, other);
@@ -254,9 +259,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> Vector4<Type>::operator*(Type scalar) const
+    constexpr Vector4<Type> Vector4<Type>::operator*(Type scalar) const
     {
-        return Vector4<Type>{ Raw, mX * scalar, mY * scalar, mZ * scalar, mW* scalar };
+        Vector4<Type> result{ *this };
+        result *= scalar;
+        return result;
     }
 
 
@@ -267,20 +274,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> Vector4<Type>::operator/(Type scalar) const
+    constexpr Vector4<Type> Vector4<Type>::operator/(Type scalar) const
     {
-        ETLMATH_ASSERT(!isZeroRaw(scalar), "Vector3 division by 0");
-
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            return Vector4<Type>{ Raw, mX / scalar, mY / scalar, mZ / scalar, mW / scalar };
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            return Vector4<Type>{ Raw, mX * inv, mY * inv, mZ * inv, mW * inv };
-        }
+        Vector4<Type> result{ *this };
+        result /= scalar;
+        return result;
     }
 
 
@@ -290,9 +288,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> Vector4<Type>::operator-() const
+    constexpr Vector4<Type> Vector4<Type>::operator-() const
     {
-        return Vector4<Type>{ Raw, -mX, -mY, -mZ, -mW };
+        return Vector4<Type>{ Raw, -mData[0], -mData[1], -mData[2], -mData[3] };
     }
 
 
@@ -303,12 +301,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type>& Vector4<Type>::operator+=(const Vector4& other)
+    constexpr Vector4<Type>& Vector4<Type>::operator+=(const Vector4& other)
     {
-        mX += other.mX;
-        mY += other.mY;
-        mZ += other.mZ;
-        mW += other.mW;
+        helpers::AddRaw<Type, 4>(mData, other.mData);
         return *this;
     }
 
@@ -320,12 +315,9 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type>& Vector4<Type>::operator-=(const Vector4& other)
+    constexpr Vector4<Type>& Vector4<Type>::operator-=(const Vector4& other)
     {
-        mX -= other.mX;
-        mY -= other.mY;
-        mZ -= other.mZ;
-        mW -= other.mW;
+        helpers::SubtractRaw<Type, 4>(mData, other.mData);
         return *this;
     }
 
@@ -337,12 +329,9 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type>& Vector4<Type>::operator*=(Type scalar)
+    constexpr Vector4<Type>& Vector4<Type>::operator*=(Type scalar)
     {
-        mX *= scalar;
-        mY *= scalar;
-        mZ *= scalar;
-        mW *= scalar;
+        helpers::ScaleRaw<Type, 4>(mData, scalar);
         return *this;
     }
 
@@ -354,27 +343,11 @@ namespace ETL::Math
     /// <param name="scalar"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type>& Vector4<Type>::operator/=(Type scalar)
+    constexpr Vector4<Type>& Vector4<Type>::operator/=(Type scalar)
     {
         ETLMATH_ASSERT(!isZeroRaw(scalar), "Vector3 division by 0");
 
-        if constexpr (std::integral<Type>)
-        {
-            /// integer division, divide to avoid truncation errors
-            mX /= scalar;
-            mY /= scalar;
-            mZ /= scalar;
-            mW /= scalar;
-        }
-        else
-        {
-            const Type inv = Type(1) / scalar;
-            mX *= inv;
-            mY *= inv;
-            mZ *= inv;
-            mW *= inv;
-        }
-
+        helpers::DivideRaw<Type, 4>(mData, scalar);
         return *this;
     }
 
@@ -386,7 +359,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector4<Type>::operator==(const Vector4<Type>& other) const
+    constexpr bool Vector4<Type>::operator==(const Vector4<Type>& other) const
     {
         return std::equal(mData, mData + 4, other.mData);
     }
@@ -399,7 +372,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector4<Type>::operator!=(const Vector4<Type>& other) const
+    constexpr bool Vector4<Type>::operator!=(const Vector4<Type>& other) const
     {
         return !(*this == other);
     }
@@ -412,7 +385,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> Vector4<Type>::componentMul(const Vector4<Type>& other) const
+    constexpr Vector4<Type> Vector4<Type>::componentMul(const Vector4<Type>& other) const
     {
         Vector4<Type> result;
         ComponentMul(result, *this, other);
@@ -427,7 +400,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> Vector4<Type>::componentDiv(const Vector4<Type>& other) const
+    constexpr Vector4<Type> Vector4<Type>::componentDiv(const Vector4<Type>& other) const
     {
         Vector4<Type> result;
         ComponentDiv(result, *this, other);
@@ -441,7 +414,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="other"></param>
     template<typename Type>
-    inline void Vector4<Type>::componentMulInPlace(const Vector4<Type>& other)
+    constexpr void Vector4<Type>::componentMulInPlace(const Vector4<Type>& other)
     {
         ComponentMul(*this, *this, other);
     }
@@ -453,7 +426,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <param name="other"></param>
     template<typename Type>
-    inline void Vector4<Type>::componentDivInPlace(const Vector4<Type>& other)
+    constexpr void Vector4<Type>::componentDivInPlace(const Vector4<Type>& other)
     {
         ComponentDiv(*this, *this, other);
     }
@@ -466,7 +439,7 @@ namespace ETL::Math
     /// <param name="other"></param>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector4<Type>::dot(const Vector4<Type>& other) const
+    constexpr double Vector4<Type>::dot(const Vector4<Type>& other) const
     {
         double result;
         Dot(result, *this, other);
@@ -494,7 +467,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline double Vector4<Type>::lengthSquared() const
+    constexpr double Vector4<Type>::lengthSquared() const
     {
         double result;
         LengthSquared(result, *this);
@@ -535,7 +508,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector4<Type>::toVector3() const
+    constexpr Vector3<Type> Vector4<Type>::toVector3() const
     {
         Vector3<Type> result;
         ToVector3(result, *this);
@@ -549,7 +522,7 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline Vector3<Type> Vector4<Type>::perspectiveDivide() const
+    constexpr Vector3<Type> Vector4<Type>::perspectiveDivide() const
     {
         Vector3<Type> result;
         PerspectiveDivide(result, *this);
@@ -563,9 +536,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector4<Type>::isPoint() const
+    constexpr bool Vector4<Type>::isPoint() const
     {
-        return isEqual(mW, EncodeValue<Type>(Type(1)));
+        return isEqual(mData[3], EncodeValue<Type>(Type(1)));
     }
 
 
@@ -575,9 +548,9 @@ namespace ETL::Math
     /// <typeparam name="Type"></typeparam>
     /// <returns></returns>
     template<typename Type>
-    inline bool Vector4<Type>::isDirection() const
+    constexpr bool Vector4<Type>::isDirection() const
     {
-        return isEqual(mW, EncodeValue<Type>(Type(0)));
+        return isEqual(mData[3], EncodeValue<Type>(Type(0)));
     }
 
 
@@ -588,7 +561,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Type Vector4<Type>::getRawValue(int index) const
+    constexpr Type Vector4<Type>::getRawValue(int index) const
     {
         ETLMATH_ASSERT(index >= 0 && index < 4, "Vector4 out of bounds raw access");
         return mData[index];
@@ -602,7 +575,7 @@ namespace ETL::Math
     /// <param name="index"></param>
     /// <param name="value"></param>
     template<typename Type>
-    inline void Vector4<Type>::setRawValue(int index, Type value)
+    constexpr void Vector4<Type>::setRawValue(int index, Type value)
     {
         ETLMATH_ASSERT(index >= 0 && index < 4, "Vector4 out of bounds raw access");
         mData[index] = value;
@@ -620,7 +593,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void ComponentMul(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2)
+    constexpr void ComponentMul(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2)
     {
         if constexpr (std::integral<Type>)
         {
@@ -651,7 +624,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void ComponentDiv(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2)
+    constexpr void ComponentDiv(Vector4<Type>& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2)
     {
         ETLMATH_ASSERT(!isZero(v2.getRawValue(0)) && !isZero(v2.getRawValue(1)) &&
                        !isZero(v2.getRawValue(2)) && !isZero(v2.getRawValue(3)),
@@ -688,7 +661,7 @@ namespace ETL::Math
     /// <param name="v1"></param>
     /// <param name="v2"></param>
     template<typename Type>
-    inline void Dot(double& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2)
+    constexpr void Dot(double& outResult, const Vector4<Type>& v1, const Vector4<Type>& v2)
     {
         if constexpr (std::integral<Type>)
         {
@@ -739,7 +712,7 @@ namespace ETL::Math
     /// <param name="outResult"></param>
     /// <param name="vec"></param>
     template<typename Type>
-    inline void LengthSquared(double& outResult, const Vector4<Type>& vec)
+    constexpr void LengthSquared(double& outResult, const Vector4<Type>& vec)
     {
         Dot(outResult, vec, vec);
     }
@@ -754,6 +727,8 @@ namespace ETL::Math
     template<typename Type>
     inline bool Normalize(Vector4<Type>& outResult, const Vector4<Type>& vec)
     {
+        ETLMATH_INSTRUMENT(Vector4Normalize);
+
         double lengthSq;
         LengthSquared(lengthSq, vec);
         if (isZero(lengthSq))
@@ -824,7 +799,7 @@ namespace ETL::Math
     /// <param name="vector"></param>
     /// <returns></returns>
     template<typename Type>
-    inline Vector4<Type> operator*(Type scalar, const Vector4<Type>& vector)
+    constexpr Vector4<Type> operator*(Type scalar, const Vector4<Type>& vector)
     {
         return vector * scalar;
     }
@@ -0,0 +1,466 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// VectorN.inl
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/TypeComparisons.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Same value constructor
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="val"></param>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size>::VectorN(Type val)
+        : mData{}
+    {
+        for (int i = 0; i < Size; ++i)
+            mData[i] = EncodeValue<Type>(val);
+    }
+
+
+    /// <summary>
+    /// Unit vector along 'index'
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> VectorN<Type, Size>::Unit(int index)
+    {
+        ETLMATH_ASSERT(index >= 0 && index < Size, "VectorN out of bounds access");
+
+        VectorN<Type, Size> result{ Type(0) };
+        result.mData[index] = EncodeValue<Type>(Type(1));
+        return result;
+    }
+
+
+    /// <summary>
+    /// Subscription operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr ElementProxy<Type> VectorN<Type, Size>::operator[](int index)
+    {
+        ETLMATH_ASSERT(index >= 0 && index < Size, "VectorN out of bounds access");
+
+        return ElementProxy<Type>{ mData[index] };
+    }
+
+
+    /// <summary>
+    /// Const subscription operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr Type VectorN<Type, Size>::operator[](int index) const
+    {
+        ETLMATH_ASSERT(index >= 0 && index < Size, "VectorN out of bounds access");
+
+        return DecodeValue<Type>(mData[index]);
+    }
+
+
+    /// <summary>
+    /// Sub-vector getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns>Components [Offset, Offset + Count)</returns>
+    template<typename Type, int Size>
+    template<int Offset, int Count>
+    constexpr Vector<Type, Count> VectorN<Type, Size>::getSegment() const
+    {
+        static_assert(Offset >= 0 && Count > 0 && Offset + Count <= Size, "VectorN segment out of bounds");
+
+        Vector<Type, Count> result;
+        for (int i = 0; i < Count; ++i)
+            result.setRawValue(i, mData[Offset + i]);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Sub-vector setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="value">Written to [Offset, Offset + its size)</param>
+    template<typename Type, int Size>
+    template<int Offset, VectorType Vec>
+    constexpr void VectorN<Type, Size>::setSegment(const Vec& value)
+    {
+        constexpr int COUNT = helpers::VectorShape<Vec>::SIZE;
+        static_assert(std::same_as<typename helpers::VectorShape<Vec>::ValueType, Type>, "VectorN segment of another value type");
+        static_assert(Offset >= 0 && Offset + COUNT <= Size, "VectorN segment out of bounds");
+
+        for (int i = 0; i < COUNT; ++i)
+            mData[Offset + i] = value.getRawValue(i);
+    }
+
+
+    /// <summary>
+    /// Addition operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> VectorN<Type, Size>::operator+(const VectorN& other) const
+    {
+        VectorN<Type, Size> result{ *this };
+        result += other;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Subtraction operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> VectorN<Type, Size>::operator-(const VectorN& other) const
+    {
+        VectorN<Type, Size> result{ *this };
+        result -= other;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Dot product operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr double VectorN<Type, Size>::operator*(const VectorN& other) const
+    {
+        return dot(other);
+    }
+
+
+    /// <summary>
+    /// Multiplication operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> VectorN<Type, Size>::operator*(Type scalar) const
+    {
+        VectorN<Type, Size> result{ *this };
+        result *= scalar;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Division operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> VectorN<Type, Size>::operator/(Type scalar) const
+    {
+        VectorN<Type, Size> result{ *this };
+        result /= scalar;
+        return result;
+    }
+
+
+    /// <summary>
+    /// Negation operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> VectorN<Type, Size>::operator-() const
+    {
+        VectorN<Type, Size> result;
+        for (int i = 0; i < Size; ++i)
+            result.mData[i] = -mData[i];
+        return result;
+    }
+
+
+    /// <summary>
+    /// Addition assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size>& VectorN<Type, Size>::operator+=(const VectorN& other)
+    {
+        helpers::AddRaw<Type, Size>(mData, other.mData);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Subtraction assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size>& VectorN<Type, Size>::operator-=(const VectorN& other)
+    {
+        helpers::SubtractRaw<Type, Size>(mData, other.mData);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Multiplication assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size>& VectorN<Type, Size>::operator*=(Type scalar)
+    {
+        helpers::ScaleRaw<Type, Size>(mData, scalar);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Division assignment operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size>& VectorN<Type, Size>::operator/=(Type scalar)
+    {
+        ETLMATH_ASSERT(!isZeroRaw(scalar), "VectorN division by 0");
+
+        helpers::DivideRaw<Type, Size>(mData, scalar);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Equality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr bool VectorN<Type, Size>::operator==(const VectorN& other) const
+    {
+        return std::equal(mData, mData + Size, other.mData);
+    }
+
+
+    /// <summary>
+    /// Inequality operator
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr bool VectorN<Type, Size>::operator!=(const VectorN& other) const
+    {
+        return !(*this == other);
+    }
+
+
+    /// <summary>
+    /// Dot product
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="other"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr double VectorN<Type, Size>::dot(const VectorN& other) const
+    {
+        double result;
+        Dot(result, *this, other);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Length
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    inline double VectorN<Type, Size>::length() const
+    {
+        double result;
+        Length(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Length squared
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr double VectorN<Type, Size>::lengthSquared() const
+    {
+        double result;
+        LengthSquared(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Normalized copy
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    inline VectorN<Type, Size> VectorN<Type, Size>::normalize() const
+    {
+        VectorN<Type, Size> result{ *this };
+        Normalize(result, *this);
+        return result;
+    }
+
+
+    /// <summary>
+    /// Normalize self
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    inline VectorN<Type, Size>& VectorN<Type, Size>::makeNormalize()
+    {
+        Normalize(*this, *this);
+        return *this;
+    }
+
+
+    /// <summary>
+    /// Raw value getter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr Type VectorN<Type, Size>::getRawValue(int index) const
+    {
+        ETLMATH_ASSERT(index >= 0 && index < Size, "VectorN out of bounds access");
+
+        return mData[index];
+    }
+
+
+    /// <summary>
+    /// Raw value setter
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="index"></param>
+    /// <param name="value"></param>
+    template<typename Type, int Size>
+    constexpr void VectorN<Type, Size>::setRawValue(int index, Type value)
+    {
+        ETLMATH_ASSERT(index >= 0 && index < Size, "VectorN out of bounds access");
+
+        mData[index] = value;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions and common helpers
+
+    /// <summary>
+    /// Dot product V1*V2 (accumulated in double, in component order)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="v1"></param>
+    /// <param name="v2"></param>
+    template<typename Type, int Size>
+    constexpr void Dot(double& outResult, const VectorN<Type, Size>& v1, const VectorN<Type, Size>& v2)
+    {
+        outResult = 0.0;
+        for (int i = 0; i < Size; ++i)
+            outResult += DecodeValue<double>(v1.getRawValue(i)) * DecodeValue<double>(v2.getRawValue(i));
+    }
+
+
+    /// <summary>
+    /// Return length
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="vec"></param>
+    template<typename Type, int Size>
+    inline void Length(double& outResult, const VectorN<Type, Size>& vec)
+    {
+        double lengthSq;
+        LengthSquared(lengthSq, vec);
+        outResult = std::sqrt(lengthSq);
+    }
+
+
+    /// <summary>
+    /// Return length squared
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="vec"></param>
+    template<typename Type, int Size>
+    constexpr void LengthSquared(double& outResult, const VectorN<Type, Size>& vec)
+    {
+        Dot(outResult, vec, vec);
+    }
+
+
+    /// <summary>
+    /// Normalize vec
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="vec"></param>
+    /// <returns>False (and outResult untouched) if vec has zero length</returns>
+    template<typename Type, int Size>
+    inline bool Normalize(VectorN<Type, Size>& outResult, const VectorN<Type, Size>& vec)
+    {
+        double lengthSq;
+        LengthSquared(lengthSq, vec);
+        if (isZero(lengthSq))
+            return false;
+
+        const double invLength = 1.0 / std::sqrt(lengthSq);
+        for (int i = 0; i < Size; ++i)
+            outResult.setRawValue(i, static_cast<Type>(vec.getRawValue(i) * invLength));
+
+        return true;
+    }
+
+
+    /// <summary>
+    /// Scalar * vector
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="scalar"></param>
+    /// <param name="vector"></param>
+    /// <returns></returns>
+    template<typename Type, int Size>
+    constexpr VectorN<Type, Size> operator*(Type scalar, const VectorN<Type, Size>& vector)
+    {
+        return vector * scalar;
+    }
+
+} /// namespace ETL::Math
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <concepts>
+#include <type_traits>
 
 namespace ETL::Math
 {
@@ -13,6 +14,12 @@ namespace ETL::Math
     constexpr int FIXED_ONE = 1 << FIXED_SHIFT;
 
 
+    /// Type used for intermediate computations: fixed point values are decoded to double,
+    /// floating point types compute in their own precision
+    template<typename Type>
+    using CalcType = std::conditional_t<std::integral<Type>, double, Type>;
+
+
     /// Helper to safely convert FROM FIXED POINT to normal value
     template<typename ReturnType, typename InputType>
     requires (std::integral<InputType>)
@@ -0,0 +1,52 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Parallel.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ETL::Math
+{
+    /// Split [0, count) into contiguous ranges and run 'func(begin, end)' on each one,
+    /// using the calling thread plus up to (numThreads - 1) short-lived std::jthreads.
+    /// numThreads <= 0 uses the hardware concurrency. Ranges smaller than 'minBatch'
+    /// are not worth a thread: small workloads run inline on the caller.
+
+    /// Number of threads ParallelFor uses for these arguments (1: runs inline on the caller)
+    inline std::size_t ParallelThreadCount(std::size_t count, std::size_t minBatch, int numThreads)
+    {
+        const std::size_t threads = numThreads > 0 ? static_cast<std::size_t>(numThreads)
+                                                   : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        return std::min(threads, std::max<std::size_t>(1, count / std::max<std::size_t>(1, minBatch)));
+    }
+
+
+    template<typename Func>
+    void ParallelFor(std::size_t count, std::size_t minBatch, int numThreads, Func&& func)
+    {
+        if (count == 0)
+            return;
+
+        const std::size_t threads = ParallelThreadCount(count, minBatch, numThreads);
+        if (threads <= 1)
+        {
+            func(std::size_t(0), count);
+            return;
+        }
+
+        const std::size_t batch = (count + threads - 1) / threads;
+
+        /// jthreads join on destruction: also on unwinding, when a spawn or the caller's range throws
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        for (std::size_t begin = batch; begin < count; begin += batch)
+            workers.emplace_back([&func, begin, end = std::min(begin + batch, count)]() { func(begin, end); });
+
+        func(std::size_t(0), std::min(batch, count));
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,516 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// SimdPack.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+
+/// Instruction sets available at compile time (x86-64 always provides SSE2)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ETLMATH_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX__)
+#define ETLMATH_SIMD_AVX 1
+#include <immintrin.h>
+#endif
+
+/// Half float conversions (every AVX2 CPU has F16C, MSVC does not define __F16C__)
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define ETLMATH_SIMD_F16C 1
+#include <immintrin.h>
+#endif
+
+namespace ETL::Math::Simd
+{
+    /// Pack of 'Width' lanes of 'Type', used by the batch/packet kernels in src/.
+    /// The generic version is a plain array (loops auto-vectorize where possible),
+    /// x86 specializations below map a pack to a single SSE/AVX register.
+    /// All kernels are written once against this interface.
+
+    template<typename Type, int Width>
+    struct Pack
+    {
+        Type lanes[Width];
+
+        static Pack Load(const Type* ptr)      { Pack r; for (int i = 0; i < Width; ++i) r.lanes[i] = ptr[i]; return r; }
+        static Pack Broadcast(Type value)      { Pack r; for (int i = 0; i < Width; ++i) r.lanes[i] = value; return r; }
+        static Pack Zero()                     { return Broadcast(Type(0)); }
+        void        store(Type* ptr) const     { for (int i = 0; i < Width; ++i) ptr[i] = lanes[i]; }
+    };
+
+    /// Per-lane boolean result of pack comparisons
+    template<typename Type, int Width>
+    struct Mask
+    {
+        bool lanes[Width];
+    };
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Generic implementation
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> operator+(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] + b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> operator-(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] - b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> operator*(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] * b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> operator/(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] / b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> operator-(const Pack<Type, Width>& a)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = -a.lanes[i];
+        return r;
+    }
+
+    /// Min/Max follow SSE semantics: if either lane is NaN, the second operand is returned
+    template<typename Type, int Width>
+    inline Pack<Type, Width> Min(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] < b.lanes[i] ? a.lanes[i] : b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> Max(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] > b.lanes[i] ? a.lanes[i] : b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> Abs(const Pack<Type, Width>& a)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = std::fabs(a.lanes[i]);
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Pack<Type, Width> Sqrt(const Pack<Type, Width>& a)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = std::sqrt(a.lanes[i]);
+        return r;
+    }
+
+    /// Round to nearest integral value (ties to even, as the SSE conversion does)
+    template<typename Type, int Width>
+    inline Pack<Type, Width> Round(const Pack<Type, Width>& a)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = std::nearbyint(a.lanes[i]);
+        return r;
+    }
+
+    /// a * b + c. Never fused, so results match the scalar code bit for bit
+    template<typename Type, int Width>
+    inline Pack<Type, Width> MulAdd(const Pack<Type, Width>& a, const Pack<Type, Width>& b, const Pack<Type, Width>& c)
+    {
+        return a * b + c;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator<(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Mask<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] < b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator<=(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Mask<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] <= b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator>(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        return b < a;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator>=(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        return b <= a;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator==(const Pack<Type, Width>& a, const Pack<Type, Width>& b)
+    {
+        Mask<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] == b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator&(const Mask<Type, Width>& a, const Mask<Type, Width>& b)
+    {
+        Mask<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] && b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator|(const Mask<Type, Width>& a, const Mask<Type, Width>& b)
+    {
+        Mask<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = a.lanes[i] || b.lanes[i];
+        return r;
+    }
+
+    template<typename Type, int Width>
+    inline Mask<Type, Width> operator!(const Mask<Type, Width>& a)
+    {
+        Mask<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = !a.lanes[i];
+        return r;
+    }
+
+    /// Per lane: mask ? ifTrue : ifFalse
+    template<typename Type, int Width>
+    inline Pack<Type, Width> Select(const Mask<Type, Width>& mask, const Pack<Type, Width>& ifTrue, const Pack<Type, Width>& ifFalse)
+    {
+        Pack<Type, Width> r;
+        for (int i = 0; i < Width; ++i) r.lanes[i] = mask.lanes[i] ? ifTrue.lanes[i] : ifFalse.lanes[i];
+        return r;
+    }
+
+    /// Lane i set -> bit i set
+    template<typename Type, int Width>
+    inline int MoveMask(const Mask<Type, Width>& mask)
+    {
+        int bits = 0;
+        for (int i = 0; i < Width; ++i) bits |= mask.lanes[i] ? (1 << i) : 0;
+        return bits;
+    }
+
+    /// In-place transpose of the Width x Width block rows[0..Width-1] (rows[i].lanes[j] <-> rows[j].lanes[i]),
+    /// turns Width AoS records into Width SoA registers and back. Works on a slice of a larger pack array
+    /// so kernels transpose their operands where they live (no staging copies)
+    template<typename Type, int Width>
+    inline void Transpose(Pack<Type, Width>* rows)
+    {
+        for (int i = 0; i < Width; ++i)
+            for (int j = i + 1; j < Width; ++j)
+            {
+                const Type value = rows[i].lanes[j];
+                rows[i].lanes[j] = rows[j].lanes[i];
+                rows[j].lanes[i] = value;
+            }
+    }
+
+
+#if defined(ETLMATH_SIMD_SSE2)
+
+    ///------------------------------------------------------------------------------------------
+    /// SSE2 - 4 x float
+
+    template<>
+    struct Pack<float, 4>
+    {
+        __m128 v;
+
+        static Pack Load(const float* ptr)    { return { _mm_loadu_ps(ptr) }; }
+        static Pack Broadcast(float value)    { return { _mm_set1_ps(value) }; }
+        static Pack Zero()                    { return { _mm_setzero_ps() }; }
+        void        store(float* ptr) const   { _mm_storeu_ps(ptr, v); }
+    };
+
+    template<>
+    struct Mask<float, 4>
+    {
+        __m128 v;
+    };
+
+    using Pack4f = Pack<float, 4>;
+    using Mask4f = Mask<float, 4>;
+
+    inline Pack4f operator+(const Pack4f& a, const Pack4f& b) { return { _mm_add_ps(a.v, b.v) }; }
+    inline Pack4f operator-(const Pack4f& a, const Pack4f& b) { return { _mm_sub_ps(a.v, b.v) }; }
+    inline Pack4f operator*(const Pack4f& a, const Pack4f& b) { return { _mm_mul_ps(a.v, b.v) }; }
+    inline Pack4f operator/(const Pack4f& a, const Pack4f& b) { return { _mm_div_ps(a.v, b.v) }; }
+    inline Pack4f operator-(const Pack4f& a)                  { return { _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)) }; }
+    inline Pack4f Min(const Pack4f& a, const Pack4f& b)       { return { _mm_min_ps(a.v, b.v) }; }
+    inline Pack4f Max(const Pack4f& a, const Pack4f& b)       { return { _mm_max_ps(a.v, b.v) }; }
+    inline Pack4f Abs(const Pack4f& a)                        { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+    inline Pack4f Sqrt(const Pack4f& a)                       { return { _mm_sqrt_ps(a.v) }; }
+    inline Pack4f Round(const Pack4f& a)                      { return { _mm_cvtepi32_ps(_mm_cvtps_epi32(a.v)) }; }
+    inline Pack4f MulAdd(const Pack4f& a, const Pack4f& b, const Pack4f& c) { return { _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v) }; }
+
+    inline Mask4f operator<(const Pack4f& a, const Pack4f& b)  { return { _mm_cmplt_ps(a.v, b.v) }; }
+    inline Mask4f operator<=(const Pack4f& a, const Pack4f& b) { return { _mm_cmple_ps(a.v, b.v) }; }
+    inline Mask4f operator>(const Pack4f& a, const Pack4f& b)  { return { _mm_cmpgt_ps(a.v, b.v) }; }
+    inline Mask4f operator>=(const Pack4f& a, const Pack4f& b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+    inline Mask4f operator==(const Pack4f& a, const Pack4f& b) { return { _mm_cmpeq_ps(a.v, b.v) }; }
+    inline Mask4f operator&(const Mask4f& a, const Mask4f& b)  { return { _mm_and_ps(a.v, b.v) }; }
+    inline Mask4f operator|(const Mask4f& a, const Mask4f& b)  { return { _mm_or_ps(a.v, b.v) }; }
+    inline Mask4f operator!(const Mask4f& a)                   { return { _mm_xor_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(-1))) }; }
+
+    inline Pack4f Select(const Mask4f& mask, const Pack4f& ifTrue, const Pack4f& ifFalse)
+    {
+        return { _mm_or_ps(_mm_and_ps(mask.v, ifTrue.v), _mm_andnot_ps(mask.v, ifFalse.v)) };
+    }
+
+    inline int MoveMask(const Mask4f& mask) { return _mm_movemask_ps(mask.v); }
+
+    inline void Transpose(Pack4f* rows)
+    {
+        _MM_TRANSPOSE4_PS(rows[0].v, rows[1].v, rows[2].v, rows[3].v);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// SSE2 - 2 x double
+
+    template<>
+    struct Pack<double, 2>
+    {
+        __m128d v;
+
+        static Pack Load(const double* ptr)   { return { _mm_loadu_pd(ptr) }; }
+        static Pack Broadcast(double value)   { return { _mm_set1_pd(value) }; }
+        static Pack Zero()                    { return { _mm_setzero_pd() }; }
+        void        store(double* ptr) const  { _mm_storeu_pd(ptr, v); }
+    };
+
+    template<>
+    struct Mask<double, 2>
+    {
+        __m128d v;
+    };
+
+    using Pack2d = Pack<double, 2>;
+    using Mask2d = Mask<double, 2>;
+
+    inline Pack2d operator+(const Pack2d& a, const Pack2d& b) { return { _mm_add_pd(a.v, b.v) }; }
+    inline Pack2d operator-(const Pack2d& a, const Pack2d& b) { return { _mm_sub_pd(a.v, b.v) }; }
+    inline Pack2d operator*(const Pack2d& a, const Pack2d& b) { return { _mm_mul_pd(a.v, b.v) }; }
+    inline Pack2d operator/(const Pack2d& a, const Pack2d& b) { return { _mm_div_pd(a.v, b.v) }; }
+    inline Pack2d operator-(const Pack2d& a)                  { return { _mm_xor_pd(a.v, _mm_set1_pd(-0.0)) }; }
+    inline Pack2d Min(const Pack2d& a, const Pack2d& b)       { return { _mm_min_pd(a.v, b.v) }; }
+    inline Pack2d Max(const Pack2d& a, const Pack2d& b)       { return { _mm_max_pd(a.v, b.v) }; }
+    inline Pack2d Abs(const Pack2d& a)                        { return { _mm_andnot_pd(_mm_set1_pd(-0.0), a.v) }; }
+    inline Pack2d Sqrt(const Pack2d& a)                       { return { _mm_sqrt_pd(a.v) }; }
+    inline Pack2d MulAdd(const Pack2d& a, const Pack2d& b, const Pack2d& c) { return { _mm_add_pd(_mm_mul_pd(a.v, b.v), c.v) }; }
+
+    inline Mask2d operator<(const Pack2d& a, const Pack2d& b)  { return { _mm_cmplt_pd(a.v, b.v) }; }
+    inline Mask2d operator<=(const Pack2d& a, const Pack2d& b) { return { _mm_cmple_pd(a.v, b.v) }; }
+    inline Mask2d operator>(const Pack2d& a, const Pack2d& b)  { return { _mm_cmpgt_pd(a.v, b.v) }; }
+    inline Mask2d operator>=(const Pack2d& a, const Pack2d& b) { return { _mm_cmpge_pd(a.v, b.v) }; }
+    inline Mask2d operator==(const Pack2d& a, const Pack2d& b) { return { _mm_cmpeq_pd(a.v, b.v) }; }
+    inline Mask2d operator&(const Mask2d& a, const Mask2d& b)  { return { _mm_and_pd(a.v, b.v) }; }
+    inline Mask2d operator|(const Mask2d& a, const Mask2d& b)  { return { _mm_or_pd(a.v, b.v) }; }
+    inline Mask2d operator!(const Mask2d& a)                   { return { _mm_xor_pd(a.v, _mm_castsi128_pd(_mm_set1_epi32(-1))) }; }
+
+    inline Pack2d Select(const Mask2d& mask, const Pack2d& ifTrue, const Pack2d& ifFalse)
+    {
+        return { _mm_or_pd(_mm_and_pd(mask.v, ifTrue.v), _mm_andnot_pd(mask.v, ifFalse.v)) };
+    }
+
+    inline Pack2d Round(const Pack2d& a)
+    {
+        /// No packed double->int64 conversion in SSE2: use the 2^52 magic-number trick (|a| < 2^51)
+        const __m128d magic = _mm_set1_pd(6755399441055744.0);
+        return { _mm_sub_pd(_mm_add_pd(a.v, magic), magic) };
+    }
+
+    inline int MoveMask(const Mask2d& mask) { return _mm_movemask_pd(mask.v); }
+
+    inline void Transpose(Pack2d* rows)
+    {
+        const __m128d r0 = rows[0].v;
+        rows[0].v = _mm_unpacklo_pd(r0, rows[1].v);
+        rows[1].v = _mm_unpackhi_pd(r0, rows[1].v);
+    }
+
+#endif /// ETLMATH_SIMD_SSE2
+
+
+#if defined(ETLMATH_SIMD_AVX)
+
+    ///------------------------------------------------------------------------------------------
+    /// AVX - 8 x float
+
+    template<>
+    struct Pack<float, 8>
+    {
+        __m256 v;
+
+        static Pack Load(const float* ptr)    { return { _mm256_loadu_ps(ptr) }; }
+        static Pack Broadcast(float value)    { return { _mm256_set1_ps(value) }; }
+        static Pack Zero()                    { return { _mm256_setzero_ps() }; }
+        void        store(float* ptr) const   { _mm256_storeu_ps(ptr, v); }
+    };
+
+    template<>
+    struct Mask<float, 8>
+    {
+        __m256 v;
+    };
+
+    using Pack8f = Pack<float, 8>;
+    using Mask8f = Mask<float, 8>;
+
+    inline Pack8f operator+(const Pack8f& a, const Pack8f& b) { return { _mm256_add_ps(a.v, b.v) }; }
+    inline Pack8f operator-(const Pack8f& a, const Pack8f& b) { return { _mm256_sub_ps(a.v, b.v) }; }
+    inline Pack8f operator*(const Pack8f& a, const Pack8f& b) { return { _mm256_mul_ps(a.v, b.v) }; }
+    inline Pack8f operator/(const Pack8f& a, const Pack8f& b) { return { _mm256_div_ps(a.v, b.v) }; }
+    inline Pack8f operator-(const Pack8f& a)                  { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)) }; }
+    inline Pack8f Min(const Pack8f& a, const Pack8f& b)       { return { _mm256_min_ps(a.v, b.v) }; }
+    inline Pack8f Max(const Pack8f& a, const Pack8f& b)       { return { _mm256_max_ps(a.v, b.v) }; }
+    inline Pack8f Abs(const Pack8f& a)                        { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+    inline Pack8f Sqrt(const Pack8f& a)                       { return { _mm256_sqrt_ps(a.v) }; }
+    inline Pack8f Round(const Pack8f& a)                      { return { _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+    inline Pack8f MulAdd(const Pack8f& a, const Pack8f& b, const Pack8f& c) { return { _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v) }; }
+
+    inline Mask8f operator<(const Pack8f& a, const Pack8f& b)  { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+    inline Mask8f operator<=(const Pack8f& a, const Pack8f& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+    inline Mask8f operator>(const Pack8f& a, const Pack8f& b)  { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+    inline Mask8f operator>=(const Pack8f& a, const Pack8f& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+    inline Mask8f operator==(const Pack8f& a, const Pack8f& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+    inline Mask8f operator&(const Mask8f& a, const Mask8f& b)  { return { _mm256_and_ps(a.v, b.v) }; }
+    inline Mask8f operator|(const Mask8f& a, const Mask8f& b)  { return { _mm256_or_ps(a.v, b.v) }; }
+    inline Mask8f operator!(const Mask8f& a)                   { return { _mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) }; }
+
+    inline Pack8f Select(const Mask8f& mask, const Pack8f& ifTrue, const Pack8f& ifFalse)
+    {
+        return { _mm256_blendv_ps(ifFalse.v, ifTrue.v, mask.v) };
+    }
+
+    inline int MoveMask(const Mask8f& mask) { return _mm256_movemask_ps(mask.v); }
+
+    inline void Transpose(Pack8f* rows)
+    {
+        /// 2x2 blocks within each 128-bit half, then 4x4, then swap the off-diagonal halves
+        __m256 t[8], u[8];
+        for (int i = 0; i < 8; i += 2)
+        {
+            t[i]     = _mm256_unpacklo_ps(rows[i].v, rows[i + 1].v);
+            t[i + 1] = _mm256_unpackhi_ps(rows[i].v, rows[i + 1].v);
+        }
+        for (int i = 0; i < 8; i += 4)
+        {
+            u[i]     = _mm256_shuffle_ps(t[i],     t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+            u[i + 1] = _mm256_shuffle_ps(t[i],     t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+            u[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+            u[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            rows[i].v     = _mm256_permute2f128_ps(u[i], u[i + 4], 0x20);
+            rows[i + 4].v = _mm256_permute2f128_ps(u[i], u[i + 4], 0x31);
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// AVX - 4 x double
+
+    template<>
+    struct Pack<double, 4>
+    {
+        __m256d v;
+
+        static Pack Load(const double* ptr)   { return { _mm256_loadu_pd(ptr) }; }
+        static Pack Broadcast(double value)   { return { _mm256_set1_pd(value) }; }
+        static Pack Zero()                    { return { _mm256_setzero_pd() }; }
+        void        store(double* ptr) const  { _mm256_storeu_pd(ptr, v); }
+    };
+
+    template<>
+    struct Mask<double, 4>
+    {
+        __m256d v;
+    };
+
+    using Pack4d = Pack<double, 4>;
+    using Mask4d = Mask<double, 4>;
+
+    inline Pack4d operator+(const Pack4d& a, const Pack4d& b) { return { _mm256_add_pd(a.v, b.v) }; }
+    inline Pack4d operator-(const Pack4d& a, const Pack4d& b) { return { _mm256_sub_pd(a.v, b.v) }; }
+    inline Pack4d operator*(const Pack4d& a, const Pack4d& b) { return { _mm256_mul_pd(a.v, b.v) }; }
+    inline Pack4d operator/(const Pack4d& a, const Pack4d& b) { return { _mm256_div_pd(a.v, b.v) }; }
+    inline Pack4d operator-(const Pack4d& a)                  { return { _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)) }; }
+    inline Pack4d Min(const Pack4d& a, const Pack4d& b)       { return { _mm256_min_pd(a.v, b.v) }; }
+    inline Pack4d Max(const Pack4d& a, const Pack4d& b)       { return { _mm256_max_pd(a.v, b.v) }; }
+    inline Pack4d Abs(const Pack4d& a)                        { return { _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v) }; }
+    inline Pack4d Sqrt(const Pack4d& a)                       { return { _mm256_sqrt_pd(a.v) }; }
+    inline Pack4d Round(const Pack4d& a)                      { return { _mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+    inline Pack4d MulAdd(const Pack4d& a, const Pack4d& b, const Pack4d& c) { return { _mm256_add_pd(_mm256_mul_pd(a.v, b.v), c.v) }; }
+
+    inline Mask4d operator<(const Pack4d& a, const Pack4d& b)  { return { _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ) }; }
+    inline Mask4d operator<=(const Pack4d& a, const Pack4d& b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ) }; }
+    inline Mask4d operator>(const Pack4d& a, const Pack4d& b)  { return { _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ) }; }
+    inline Mask4d operator>=(const Pack4d& a, const Pack4d& b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ) }; }
+    inline Mask4d operator==(const Pack4d& a, const Pack4d& b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ) }; }
+    inline Mask4d operator&(const Mask4d& a, const Mask4d& b)  { return { _mm256_and_pd(a.v, b.v) }; }
+    inline Mask4d operator|(const Mask4d& a, const Mask4d& b)  { return { _mm256_or_pd(a.v, b.v) }; }
+    inline Mask4d operator!(const Mask4d& a)                   { return { _mm256_xor_pd(a.v, _mm256_castsi256_pd(_mm256_set1_epi32(-1))) }; }
+
+    inline Pack4d Select(const Mask4d& mask, const Pack4d& ifTrue, const Pack4d& ifFalse)
+    {
+        return { _mm256_blendv_pd(ifFalse.v, ifTrue.v, mask.v) };
+    }
+
+    inline int MoveMask(const Mask4d& mask) { return _mm256_movemask_pd(mask.v); }
+
+    inline void Transpose(Pack4d* rows)
+    {
+        const __m256d t0 = _mm256_unpacklo_pd(rows[0].v, rows[1].v);
+        const __m256d t1 = _mm256_unpackhi_pd(rows[0].v, rows[1].v);
+        const __m256d t2 = _mm256_unpacklo_pd(rows[2].v, rows[3].v);
+        const __m256d t3 = _mm256_unpackhi_pd(rows[2].v, rows[3].v);
+        rows[0].v = _mm256_permute2f128_pd(t0, t2, 0x20);
+        rows[1].v = _mm256_permute2f128_pd(t1, t3, 0x20);
+        rows[2].v = _mm256_permute2f128_pd(t0, t2, 0x31);
+        rows[3].v = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+#endif /// ETLMATH_SIMD_AVX
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Widest pack of the build for each precision (one full register), the width batch kernels run at
+
+#if defined(ETLMATH_SIMD_AVX)
+    template<typename Type> constexpr int NATIVE_WIDTH = 32 / sizeof(Type);
+#else
+    template<typename Type> constexpr int NATIVE_WIDTH = 16 / sizeof(Type);
+#endif
+
+} /// namespace ETL::Math::Simd
@@ -0,0 +1,272 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// AnimationCurve.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Animation/AnimationCurve.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/SimdPack.h"
+#include <algorithm>
+#include <concepts>
+#include <functional>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// Forward walk length before the cursor lookup falls back to a binary search
+        constexpr int CURVE_CURSOR_MAX_WALK = 4;
+
+
+        /// <summary>
+        /// out[c] = sum(weights[k] * sources[k][c]) for c in [0, count)
+        /// Floating point channels run 4/8 at a time, fixed point is blended in double.
+        /// </summary>
+        template<typename Type, int COUNT>
+        inline void BlendChannels(Type* out, int count, const Type* const (&sources)[COUNT], const double (&weights)[COUNT])
+        {
+            int c = 0;
+            if constexpr (std::floating_point<Type>)
+            {
+                constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+                using Pack = Simd::Pack<Type, WIDTH>;
+
+                Pack w[COUNT];
+                for (int k = 0; k < COUNT; ++k)
+                    w[k] = Pack::Broadcast(static_cast<Type>(weights[k]));
+
+                for (; c + WIDTH <= count; c += WIDTH)
+                {
+                    Pack sum = w[0] * Pack::Load(sources[0] + c);
+                    for (int k = 1; k < COUNT; ++k)
+                        sum = Simd::MulAdd(w[k], Pack::Load(sources[k] + c), sum);
+                    sum.store(out + c);
+                }
+            }
+
+            using Calc = CalcType<Type>;
+            for (; c < count; ++c)
+            {
+                Calc sum = Calc(0);
+                for (int k = 0; k < COUNT; ++k)
+                    sum += static_cast<Calc>(weights[k]) * DecodeValue<Calc>(sources[k][c]);
+                out[c] = EncodeValue<Type>(sum);
+            }
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Constructors
+
+    /// <summary>
+    /// Build a curve from key times and key-major values. Cubic curves precompute one tangent per
+    /// key and channel: (v[k+1] - v[k-1]) / (t[k+1] - t[k-1]), one-sided at both ends.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="keyTimes">Strictly increasing</param>
+    /// <param name="keyValues">keyTimes.size() * channelCount values</param>
+    /// <param name="channelCount"></param>
+    /// <param name="interpolation"></param>
+    template<typename Type>
+    AnimationCurve<Type>::AnimationCurve(std::span<const double> keyTimes, std::span<const Type> keyValues, int channelCount,
+                                         CurveInterpolation interpolation)
+        : mTimes(keyTimes.begin(), keyTimes.end())
+        , mValues(keyValues.begin(), keyValues.end())
+        , mChannelCount(channelCount)
+        , mInterpolation(interpolation)
+    {
+        ETLMATH_ASSERT(!keyTimes.empty() && channelCount > 0, "AnimationCurve needs at least one key and one channel");
+        ETLMATH_ASSERT(keyValues.size() == keyTimes.size() * static_cast<std::size_t>(channelCount), "AnimationCurve value count mismatch");
+        ETLMATH_ASSERT(std::adjacent_find(keyTimes.begin(), keyTimes.end(), std::greater_equal<double>()) == keyTimes.end(),
+                       "AnimationCurve key times must be strictly increasing");
+
+        if (interpolation != CurveInterpolation::Cubic || mTimes.size() < 2)
+            return;
+
+        using Calc = CalcType<Type>;
+        const int keyCount = getKeyCount();
+        mTangents.resize(mValues.size());
+        for (int key = 0; key < keyCount; ++key)
+        {
+            const int prev = std::max(key - 1, 0);
+            const int next = std::min(key + 1, keyCount - 1);
+            const Calc invDuration = static_cast<Calc>(1.0 / (mTimes[next] - mTimes[prev]));
+
+            for (int c = 0; c < mChannelCount; ++c)
+            {
+                const Calc delta = DecodeValue<Calc>(mValues[next * mChannelCount + c]) - DecodeValue<Calc>(mValues[prev * mChannelCount + c]);
+                mTangents[key * mChannelCount + c] = delta * invDuration;
+            }
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Segment lookup
+
+    /// <summary>
+    /// Segment containing 'time' by binary search
+    /// </summary>
+    /// <returns>Index of the segment's first key, in [0, keyCount - 2] (0 for a single key)</returns>
+    template<typename Type>
+    int AnimationCurve<Type>::findSegment(double time) const
+    {
+        const int lastSegment = std::max(getKeyCount() - 2, 0);
+        const auto it = std::upper_bound(mTimes.begin(), mTimes.end(), time);
+        const int segment = static_cast<int>(it - mTimes.begin()) - 1;
+        return std::clamp(segment, 0, lastSegment);
+    }
+
+
+    /// <summary>
+    /// Segment containing 'time', starting from the cursor's last segment
+    /// </summary>
+    template<typename Type>
+    int AnimationCurve<Type>::findSegment(double time, CurveCursor& cursor) const
+    {
+        /// Empty curve: no key time to compare with, segment 0 like the plain lookup
+        if (mTimes.empty())
+        {
+            cursor.segment = 0;
+            return 0;
+        }
+
+        const int lastSegment = std::max(getKeyCount() - 2, 0);
+        int segment = std::clamp(cursor.segment, 0, lastSegment);
+
+        if (time < mTimes[segment])
+        {
+            segment = findSegment(time);
+        }
+        else
+        {
+            for (int walk = 0; segment < lastSegment && time >= mTimes[segment + 1]; ++walk)
+            {
+                if (walk == helpers::CURVE_CURSOR_MAX_WALK)
+                {
+                    segment = findSegment(time);
+                    break;
+                }
+                ++segment;
+            }
+        }
+
+        cursor.segment = segment;
+        return segment;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Sampling
+
+    /// <summary>
+    /// Blend all channels of 'segment' at 'time'
+    /// </summary>
+    template<typename Type>
+    void AnimationCurve<Type>::sampleSegment(Type* outValues, double time, int segment) const
+    {
+        const Type* values0 = mValues.data() + static_cast<std::size_t>(segment) * mChannelCount;
+
+        /// Clamped ends and single-key curves hold the key value
+        if (getKeyCount() < 2 || time <= mTimes.front() || time >= mTimes.back())
+        {
+            const Type* key = (getKeyCount() < 2 || time <= mTimes.front()) ? mValues.data() : mValues.data() + mValues.size() - mChannelCount;
+            std::copy(key, key + mChannelCount, outValues);
+            return;
+        }
+
+        const Type* values1 = values0 + mChannelCount;
+        const double duration = mTimes[segment + 1] - mTimes[segment];
+        const double t = (time - mTimes[segment]) / duration;
+
+        switch (mInterpolation)
+        {
+        case CurveInterpolation::Step:
+            std::copy(values0, values0 + mChannelCount, outValues);
+            break;
+
+        case CurveInterpolation::Linear:
+            helpers::BlendChannels(outValues, mChannelCount, { values0, values1 }, { 1.0 - t, t });
+            break;
+
+        case CurveInterpolation::Cubic:
+        {
+            /// Hermite basis, tangents scaled from per-time-unit to per-segment
+            const double t2 = t * t;
+            const double t3 = t2 * t;
+            const double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+            const double h10 = (t3 - 2.0 * t2 + t) * duration;
+            const double h01 = 3.0 * t2 - 2.0 * t3;
+            const double h11 = (t3 - t2) * duration;
+
+            const CalcType<Type>* tangents0 = mTangents.data() + static_cast<std::size_t>(segment) * mChannelCount;
+            const CalcType<Type>* tangents1 = tangents0 + mChannelCount;
+
+            if constexpr (std::floating_point<Type>)
+            {
+                helpers::BlendChannels(outValues, mChannelCount, { values0, tangents0, values1, tangents1 }, { h00, h10, h01, h11 });
+            }
+            else
+            {
+                /// Fixed point tangents are kept in double
+                for (int c = 0; c < mChannelCount; ++c)
+                {
+                    const double value = h00 * DecodeValue<double>(values0[c]) + h01 * DecodeValue<double>(values1[c])
+                                       + h10 * tangents0[c] + h11 * tangents1[c];
+                    outValues[c] = EncodeValue<Type>(value);
+                }
+            }
+            break;
+        }
+        }
+    }
+
+
+    /// <summary>
+    /// Sample every channel at 'time' (binary search)
+    /// </summary>
+    template<typename Type>
+    void AnimationCurve<Type>::sample(std::span<Type> outValues, double time) const
+    {
+        ETLMATH_ASSERT(outValues.size() >= static_cast<std::size_t>(mChannelCount), "Output span too small in AnimationCurve::sample");
+        sampleSegment(outValues.data(), time, findSegment(time));
+    }
+
+
+    /// <summary>
+    /// Sample every channel at 'time', segment lookup starting from the cursor
+    /// </summary>
+    template<typename Type>
+    void AnimationCurve<Type>::sample(std::span<Type> outValues, double time, CurveCursor& cursor) const
+    {
+        ETLMATH_ASSERT(outValues.size() >= static_cast<std::size_t>(mChannelCount), "Output span too small in AnimationCurve::sample");
+        sampleSegment(outValues.data(), time, findSegment(time, cursor));
+    }
+
+
+    /// <summary>
+    /// Sample several instances (one time and cursor each), outputs are instance-major
+    /// </summary>
+    template<typename Type>
+    void AnimationCurve<Type>::sample(std::span<Type> outValues, std::span<const double> times, std::span<CurveCursor> cursors) const
+    {
+        ETLMATH_ASSERT(cursors.size() >= times.size(), "Cursor span too small in AnimationCurve::sample");
+        ETLMATH_ASSERT(outValues.size() >= times.size() * static_cast<std::size_t>(mChannelCount), "Output span too small in AnimationCurve::sample");
+
+        for (std::size_t i = 0; i < times.size(); ++i)
+            sampleSegment(outValues.data() + i * mChannelCount, times[i], findSegment(times[i], cursors[i]));
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template class AnimationCurve<float>;
+    template class AnimationCurve<double>;
+    template class AnimationCurve<int>;
+
+} /// namespace ETL::Math
@@ -0,0 +1,439 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Skinning.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Animation/Skinning.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/Parallel.h"
+#include "MathLib/Common/SimdPack.h"
+#include <cmath>
+
+namespace ETL::Math
+{
+
+    namespace helpers
+    {
+        /// Below this many vertices per thread, threading costs more than it saves
+        constexpr std::size_t SKINNING_MIN_BATCH = 1024;
+
+
+        /// <summary>
+        /// Copy the palette into a flat column-major array of decoded values (16 per bone),
+        /// so the kernel can load each matrix column straight into a SIMD register
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <param name="scratch"></param>
+        /// <param name="palette"></param>
+        /// <returns>Columns, allocated in 'scratch'</returns>
+        template<typename Type>
+        const CalcType<Type>* FlattenPalette(FrameArena& scratch, std::span<const Matrix4x4<Type>> palette)
+        {
+            std::span<CalcType<Type>> columns = scratch.allocate<CalcType<Type>>(palette.size() * Matrix4x4<Type>::NUM_ELEM, FrameArena::BLOCK_ALIGNMENT);
+
+            CalcType<Type>* dst = columns.data();
+            for (const Matrix4x4<Type>& bone : palette)
+            {
+                for (int col = 0; col < Matrix4x4<Type>::COL_SIZE; ++col)
+                    for (int row = 0; row < Matrix4x4<Type>::COL_SIZE; ++row)
+                        *dst++ = DecodeValue<CalcType<Type>>(bone.getRawValue(row, col));
+            }
+            return columns.data();
+        }
+
+
+        /// <summary>
+        /// Transform a direction by the blended matrix columns and re-normalize it
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline void SkinDirection(Vector3<Type>& outDir, const Vector3<Type>& dir, const Pack& c0, const Pack& c1, const Pack& c2)
+        {
+            using Calc = CalcType<Type>;
+
+            const Pack result = c0 * Pack::Broadcast(DecodeValue<Calc>(dir.getRawValue(0)))
+                              + c1 * Pack::Broadcast(DecodeValue<Calc>(dir.getRawValue(1)))
+                              + c2 * Pack::Broadcast(DecodeValue<Calc>(dir.getRawValue(2)));
+
+            Calc v[4];
+            result.store(v);
+
+            const Calc lengthSq = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+            const Calc invLength = lengthSq > Calc(0) ? Calc(1) / std::sqrt(lengthSq) : Calc(0);
+
+            outDir.setRawValue(0, EncodeValue<Type>(v[0] * invLength));
+            outDir.setRawValue(1, EncodeValue<Type>(v[1] * invLength));
+            outDir.setRawValue(2, EncodeValue<Type>(v[2] * invLength));
+        }
+
+
+        /// <summary>
+        /// Skin vertices [begin, end). One blended matrix per vertex, built column by column:
+        /// col_c = sum(w_i * bone_i.col_c), 4 lanes per column.
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <param name="out"></param>
+        /// <param name="columns">Flattened palette (see FlattenPalette)</param>
+        /// <param name="in"></param>
+        /// <param name="begin"></param>
+        /// <param name="end"></param>
+        template<typename Type>
+        void SkinRange(const SkinningOutput<Type>& out, const CalcType<Type>* columns, const SkinningInput<Type>& in,
+                       std::size_t begin, std::size_t end)
+        {
+            using Calc = CalcType<Type>;
+            using Pack = Simd::Pack<Calc, 4>;
+
+            const bool bNormals = !in.normals.empty() && !out.normals.empty();
+            const bool bTangents = !in.tangents.empty() && !out.tangents.empty();
+
+            Calc p[4];
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const BoneWeights& bw = in.weights[i];
+
+                const Calc* m0 = columns + bw.indices[0] * Matrix4x4<Type>::NUM_ELEM;
+                const Calc* m1 = columns + bw.indices[1] * Matrix4x4<Type>::NUM_ELEM;
+                const Calc* m2 = columns + bw.indices[2] * Matrix4x4<Type>::NUM_ELEM;
+                const Calc* m3 = columns + bw.indices[3] * Matrix4x4<Type>::NUM_ELEM;
+
+                const Pack w0 = Pack::Broadcast(static_cast<Calc>(bw.weights[0]));
+                const Pack w1 = Pack::Broadcast(static_cast<Calc>(bw.weights[1]));
+                const Pack w2 = Pack::Broadcast(static_cast<Calc>(bw.weights[2]));
+                const Pack w3 = Pack::Broadcast(static_cast<Calc>(bw.weights[3]));
+
+                const Pack c0 = Pack::Load(m0)      * w0 + Pack::Load(m1)      * w1 + Pack::Load(m2)      * w2 + Pack::Load(m3)      * w3;
+                const Pack c1 = Pack::Load(m0 + 4)  * w0 + Pack::Load(m1 + 4)  * w1 + Pack::Load(m2 + 4)  * w2 + Pack::Load(m3 + 4)  * w3;
+                const Pack c2 = Pack::Load(m0 + 8)  * w0 + Pack::Load(m1 + 8)  * w1 + Pack::Load(m2 + 8)  * w2 + Pack::Load(m3 + 8)  * w3;
+                const Pack c3 = Pack::Load(m0 + 12) * w0 + Pack::Load(m1 + 12) * w1 + Pack::Load(m2 + 12) * w2 + Pack::Load(m3 + 12) * w3;
+
+                const Vector3<Type>& position = in.positions[i];
+                const Pack result = c0 * Pack::Broadcast(DecodeValue<Calc>(position.getRawValue(0)))
+                                  + c1 * Pack::Broadcast(DecodeValue<Calc>(position.getRawValue(1)))
+                                  + c2 * Pack::Broadcast(DecodeValue<Calc>(position.getRawValue(2)))
+                                  + c3;
+                result.store(p);
+
+                Vector3<Type>& outPosition = out.positions[i];
+                outPosition.setRawValue(0, EncodeValue<Type>(p[0]));
+                outPosition.setRawValue(1, EncodeValue<Type>(p[1]));
+                outPosition.setRawValue(2, EncodeValue<Type>(p[2]));
+
+                if (bNormals)
+                    SkinDirection(out.normals[i], in.normals[i], c0, c1, c2);
+
+                if (bTangents)
+                    SkinDirection(out.tangents[i], in.tangents[i], c0, c1, c2);
+            }
+        }
+
+
+        /// Values per bone in a flattened dual quaternion palette (real xyzw, dual xyzw)
+        constexpr int DUAL_QUATERNION_STRIDE = 8;
+
+
+        /// <summary>
+        /// Copy the palette into a flat array of decoded values (8 per bone)
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <param name="scratch"></param>
+        /// <param name="palette"></param>
+        /// <returns>Bones, allocated in 'scratch'</returns>
+        template<typename Type>
+        const CalcType<Type>* FlattenPalette(FrameArena& scratch, std::span<const DualQuaternion<Type>> palette)
+        {
+            std::span<CalcType<Type>> bones = scratch.allocate<CalcType<Type>>(palette.size() * DUAL_QUATERNION_STRIDE, FrameArena::BLOCK_ALIGNMENT);
+
+            CalcType<Type>* dst = bones.data();
+            for (const DualQuaternion<Type>& bone : palette)
+            {
+                for (int i = 0; i < 4; ++i)
+                    *dst++ = DecodeValue<CalcType<Type>>(bone.getReal().getRawValue(i));
+                for (int i = 0; i < 4; ++i)
+                    *dst++ = DecodeValue<CalcType<Type>>(bone.getDual().getRawValue(i));
+            }
+            return bones.data();
+        }
+
+
+        /// <summary>
+        /// Rotate (x, y, z) by the unit quaternion q (t = 2 * q.xyz x v; v' = v + q.w * t + q.xyz x t)
+        /// </summary>
+        template<typename Calc>
+        inline void RotateVector(Calc* outV, const Calc* q, Calc x, Calc y, Calc z)
+        {
+            const Calc tx = Calc(2) * (q[1] * z - q[2] * y);
+            const Calc ty = Calc(2) * (q[2] * x - q[0] * z);
+            const Calc tz = Calc(2) * (q[0] * y - q[1] * x);
+
+            outV[0] = x + q[3] * tx + (q[1] * tz - q[2] * ty);
+            outV[1] = y + q[3] * ty + (q[2] * tx - q[0] * tz);
+            outV[2] = z + q[3] * tz + (q[0] * ty - q[1] * tx);
+        }
+
+
+        /// <summary>
+        /// Rotate a direction by the blended rotation (unit length is preserved, no re-normalization)
+        /// </summary>
+        template<typename Type>
+        inline void SkinDirection(Vector3<Type>& outDir, const Vector3<Type>& dir, const CalcType<Type>* real)
+        {
+            using Calc = CalcType<Type>;
+
+            Calc v[3];
+            RotateVector(v, real, DecodeValue<Calc>(dir.getRawValue(0)), DecodeValue<Calc>(dir.getRawValue(1)), DecodeValue<Calc>(dir.getRawValue(2)));
+
+            outDir.setRawValue(0, EncodeValue<Type>(v[0]));
+            outDir.setRawValue(1, EncodeValue<Type>(v[1]));
+            outDir.setRawValue(2, EncodeValue<Type>(v[2]));
+        }
+
+
+        /// <summary>
+        /// Dual quaternion skin vertices [begin, end). Real and dual parts are blended 4 lanes
+        /// at a time, with each weight sign-corrected against the first influence's real part.
+        /// </summary>
+        /// <typeparam name="Type"></typeparam>
+        /// <param name="out"></param>
+        /// <param name="bones">Flattened palette (see FlattenPalette)</param>
+        /// <param name="in"></param>
+        /// <param name="begin"></param>
+        /// <param name="end"></param>
+        template<typename Type>
+        void SkinRangeDual(const SkinningOutput<Type>& out, const CalcType<Type>* bones, const SkinningInput<Type>& in,
+                           std::size_t begin, std::size_t end)
+        {
+            using Calc = CalcType<Type>;
+            using Pack = Simd::Pack<Calc, 4>;
+
+            const bool bNormals = !in.normals.empty() && !out.normals.empty();
+            const bool bTangents = !in.tangents.empty() && !out.tangents.empty();
+
+            Calc real[4], dual[4], p[3];
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const BoneWeights& bw = in.weights[i];
+
+                const Calc* b0 = bones + bw.indices[0] * DUAL_QUATERNION_STRIDE;
+                const Pack r0 = Pack::Load(b0);
+
+                Pack blendReal = r0 * Pack::Broadcast(static_cast<Calc>(bw.weights[0]));
+                Pack blendDual = Pack::Load(b0 + 4) * Pack::Broadcast(static_cast<Calc>(bw.weights[0]));
+
+                for (int k = 1; k < BoneWeights::MAX_INFLUENCES; ++k)
+                {
+                    const Calc* b = bones + bw.indices[k] * DUAL_QUATERNION_STRIDE;
+                    const Calc hemisphere = b0[0] * b[0] + b0[1] * b[1] + b0[2] * b[2] + b0[3] * b[3];
+                    const Pack w = Pack::Broadcast(hemisphere < Calc(0) ? -static_cast<Calc>(bw.weights[k]) : static_cast<Calc>(bw.weights[k]));
+
+                    blendReal = blendReal + Pack::Load(b) * w;
+                    blendDual = blendDual + Pack::Load(b + 4) * w;
+                }
+
+                blendReal.store(real);
+                const Calc lengthSq = real[0] * real[0] + real[1] * real[1] + real[2] * real[2] + real[3] * real[3];
+                const Pack invLength = Pack::Broadcast(lengthSq > Calc(0) ? Calc(1) / std::sqrt(lengthSq) : Calc(0));
+
+                (blendReal * invLength).store(real);
+                (blendDual * invLength).store(dual);
+
+                /// Translation from the normalized blend: 2 * (r.w * d.xyz - d.w * r.xyz + r.xyz x d.xyz)
+                const Calc tx = Calc(2) * (real[3] * dual[0] - dual[3] * real[0] + (real[1] * dual[2] - real[2] * dual[1]));
+                const Calc ty = Calc(2) * (real[3] * dual[1] - dual[3] * real[1] + (real[2] * dual[0] - real[0] * dual[2]));
+                const Calc tz = Calc(2) * (real[3] * dual[2] - dual[3] * real[2] + (real[0] * dual[1] - real[1] * dual[0]));
+
+                const Vector3<Type>& position = in.positions[i];
+                RotateVector(p, real, DecodeValue<Calc>(position.getRawValue(0)), DecodeValue<Calc>(position.getRawValue(1)),
+                             DecodeValue<Calc>(position.getRawValue(2)));
+
+                Vector3<Type>& outPosition = out.positions[i];
+                outPosition.setRawValue(0, EncodeValue<Type>(p[0] + tx));
+                outPosition.setRawValue(1, EncodeValue<Type>(p[1] + ty));
+                outPosition.setRawValue(2, EncodeValue<Type>(p[2] + tz));
+
+                if (bNormals)
+                    SkinDirection(out.normals[i], in.normals[i], real);
+
+                if (bTangents)
+                    SkinDirection(out.tangents[i], in.tangents[i], real);
+            }
+        }
+
+
+        /// <summary>
+        /// Debug validation of stream sizes and bone indices
+        /// </summary>
+        template<typename Type, typename Bone>
+        void ValidateSkinning(const SkinningOutput<Type>& out, std::span<const Bone> palette, const SkinningInput<Type>& in)
+        {
+            ETLMATH_ASSERT(in.weights.size() == in.positions.size(), "Skinning weights/positions size mismatch");
+            ETLMATH_ASSERT(out.positions.size() >= in.positions.size(), "Skinning output positions too small");
+            ETLMATH_ASSERT(in.normals.empty() || in.normals.size() == in.positions.size(), "Skinning normals/positions size mismatch");
+            ETLMATH_ASSERT(in.tangents.empty() || in.tangents.size() == in.positions.size(), "Skinning tangents/positions size mismatch");
+            ETLMATH_ASSERT(out.normals.empty() || out.normals.size() >= in.normals.size(), "Skinning output normals too small");
+            ETLMATH_ASSERT(out.tangents.empty() || out.tangents.size() >= in.tangents.size(), "Skinning output tangents too small");
+
+#ifndef NDEBUG
+            for (const BoneWeights& bw : in.weights)
+                for (int i = 0; i < BoneWeights::MAX_INFLUENCES; ++i)
+                    ETLMATH_ASSERT(bw.indices[i] < palette.size(), "Skinning bone index out of palette range");
+#else
+            (void)out;
+            (void)in;
+            (void)palette;
+#endif
+        }
+    }
+
+
+    /// <summary>
+    /// Linear blend skinning - positions only
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outPositions"></param>
+    /// <param name="palette"></param>
+    /// <param name="positions"></param>
+    /// <param name="weights"></param>
+    template<typename Type>
+    void SkinVertices(std::span<Vector3<Type>> outPositions, std::span<const Matrix4x4<Type>> palette,
+                      std::span<const Vector3<Type>> positions, std::span<const BoneWeights> weights)
+    {
+        SkinVertices(SkinningOutput<Type>{ outPositions }, palette, SkinningInput<Type>{ positions, weights });
+    }
+
+
+    /// <summary>
+    /// Linear blend skinning - positions with optional normal/tangent streams
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="out"></param>
+    /// <param name="palette"></param>
+    /// <param name="in"></param>
+    /// <param name="scratch"></param>
+    template<typename Type>
+    void SkinVertices(const SkinningOutput<Type>& out, std::span<const Matrix4x4<Type>> palette, const SkinningInput<Type>& in,
+                      FrameArena& scratch /*= GetMathScratch()*/)
+    {
+        helpers::ValidateSkinning(out, palette, in);
+
+        FrameArena::Scope scope(scratch);
+        const CalcType<Type>* columns = helpers::FlattenPalette(scratch, palette);
+
+        helpers::SkinRange(out, columns, in, 0, in.positions.size());
+    }
+
+
+    /// <summary>
+    /// Linear blend skinning - multi-threaded. The palette is flattened once and shared.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="out"></param>
+    /// <param name="palette"></param>
+    /// <param name="in"></param>
+    /// <param name="numThreads"></param>
+    /// <param name="scratch"></param>
+    template<typename Type>
+    void SkinVerticesParallel(const SkinningOutput<Type>& out, std::span<const Matrix4x4<Type>> palette, const SkinningInput<Type>& in,
+                              int numThreads /*= 0*/, FrameArena& scratch /*= GetMathScratch()*/)
+    {
+        helpers::ValidateSkinning(out, palette, in);
+
+        FrameArena::Scope scope(scratch);
+        const CalcType<Type>* columns = helpers::FlattenPalette(scratch, palette);
+
+        ParallelFor(in.positions.size(), helpers::SKINNING_MIN_BATCH, numThreads, [&](std::size_t begin, std::size_t end)
+        {
+            helpers::SkinRange(out, columns, in, begin, end);
+        });
+    }
+
+
+    /// <summary>
+    /// Dual quaternion skinning - positions only
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outPositions"></param>
+    /// <param name="palette"></param>
+    /// <param name="positions"></param>
+    /// <param name="weights"></param>
+    template<typename Type>
+    void SkinVertices(std::span<Vector3<Type>> outPositions, std::span<const DualQuaternion<Type>> palette,
+                      std::span<const Vector3<Type>> positions, std::span<const BoneWeights> weights)
+    {
+        SkinVertices(SkinningOutput<Type>{ outPositions }, palette, SkinningInput<Type>{ positions, weights });
+    }
+
+
+    /// <summary>
+    /// Dual quaternion skinning - positions with optional normal/tangent streams
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="out"></param>
+    /// <param name="palette"></param>
+    /// <param name="in"></param>
+    /// <param name="scratch"></param>
+    template<typename Type>
+    void SkinVertices(const SkinningOutput<Type>& out, std::span<const DualQuaternion<Type>> palette, const SkinningInput<Type>& in,
+                      FrameArena& scratch /*= GetMathScratch()*/)
+    {
+        helpers::ValidateSkinning(out, palette, in);
+
+        FrameArena::Scope scope(scratch);
+        const CalcType<Type>* bones = helpers::FlattenPalette(scratch, palette);
+
+        helpers::SkinRangeDual(out, bones, in, 0, in.positions.size());
+    }
+
+
+    /// <summary>
+    /// Dual quaternion skinning - multi-threaded. The palette is flattened once and shared.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="out"></param>
+    /// <param name="palette"></param>
+    /// <param name="in"></param>
+    /// <param name="numThreads"></param>
+    /// <param name="scratch"></param>
+    template<typename Type>
+    void SkinVerticesParallel(const SkinningOutput<Type>& out, std::span<const DualQuaternion<Type>> palette, const SkinningInput<Type>& in,
+                              int numThreads /*= 0*/, FrameArena& scratch /*= GetMathScratch()*/)
+    {
+        helpers::ValidateSkinning(out, palette, in);
+
+        FrameArena::Scope scope(scratch);
+        const CalcType<Type>* bones = helpers::FlattenPalette(scratch, palette);
+
+        ParallelFor(in.positions.size(), helpers::SKINNING_MIN_BATCH, numThreads, [&](std::size_t begin, std::size_t end)
+        {
+            helpers::SkinRangeDual(out, bones, in, begin, end);
+        });
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template void SkinVertices(std::span<Vector3<float>>  outPositions, std::span<const Matrix4x4<float>>  palette, std::span<const Vector3<float>>  positions, std::span<const BoneWeights> weights);
+    template void SkinVertices(std::span<Vector3<double>> outPositions, std::span<const Matrix4x4<double>> palette, std::span<const Vector3<double>> positions, std::span<const BoneWeights> weights);
+    template void SkinVertices(std::span<Vector3<int>>    outPositions, std::span<const Matrix4x4<int>>    palette, std::span<const Vector3<int>>    positions, std::span<const BoneWeights> weights);
+
+    template void SkinVertices(const SkinningOutput<float>&  out, std::span<const Matrix4x4<float>>  palette, const SkinningInput<float>&  in, FrameArena& scratch);
+    template void SkinVertices(const SkinningOutput<double>& out, std::span<const Matrix4x4<double>> palette, const SkinningInput<double>& in, FrameArena& scratch);
+    template void SkinVertices(const SkinningOutput<int>&    out, std::span<const Matrix4x4<int>>    palette, const SkinningInput<int>&    in, FrameArena& scratch);
+
+    template void SkinVerticesParallel(const SkinningOutput<float>&  out, std::span<const Matrix4x4<float>>  palette, const SkinningInput<float>&  in, int numThreads, FrameArena& scratch);
+    template void SkinVerticesParallel(const SkinningOutput<double>& out, std::span<const Matrix4x4<double>> palette, const SkinningInput<double>& in, int numThreads, FrameArena& scratch);
+    template void SkinVerticesParallel(const SkinningOutput<int>&    out, std::span<const Matrix4x4<int>>    palette, const SkinningInput<int>&    in, int numThreads, FrameArena& scratch);
+
+    template void SkinVertices(std::span<Vector3<float>>  outPositions, std::span<const DualQuaternion<float>>  palette, std::span<const Vector3<float>>  positions, std::span<const BoneWeights> weights);
+    template void SkinVertices(std::span<Vector3<double>> outPositions, std::span<const DualQuaternion<double>> palette, std::span<const Vector3<double>> positions, std::span<const BoneWeights> weights);
+    template void SkinVertices(std::span<Vector3<int>>    outPositions, std::span<const DualQuaternion<int>>    palette, std::span<const Vector3<int>>    positions, std::span<const BoneWeights> weights);
+
+    template void SkinVertices(const SkinningOutput<float>&  out, std::span<const DualQuaternion<float>>  palette, const SkinningInput<float>&  in, FrameArena& scratch);
+    template void SkinVertices(const SkinningOutput<double>& out, std::span<const DualQuaternion<double>> palette, const SkinningInput<double>& in, FrameArena& scratch);
+    template void SkinVertices(const SkinningOutput<int>&    out, std::span<const DualQuaternion<int>>    palette, const SkinningInput<int>&    in, FrameArena& scratch);
+
+    template void SkinVerticesParallel(const SkinningOutput<float>&  out, std::span<const DualQuaternion<float>>  palette, const SkinningInput<float>&  in, int numThreads, FrameArena& scratch);
+    template void SkinVerticesParallel(const SkinningOutput<double>& out, std::span<const DualQuaternion<double>> palette, const SkinningInput<double>& in, int numThreads, FrameArena& scratch);
+    template void SkinVerticesParallel(const SkinningOutput<int>&    out, std::span<const DualQuaternion<int>>    palette, const SkinningInput<int>&    in, int numThreads, FrameArena& scratch);
+
+} /// namespace ETL::Math
@@ -0,0 +1,113 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// FastTrig.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/FastTrig.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/SimdPack.h"
+
+namespace ETL::Math::FastTrig
+{
+
+    namespace helpers
+    {
+        /// <summary>
+        /// SinCos of one pack: same reduction/polynomials as the scalar version, with the
+        /// quadrant swap and signs applied through masks instead of a switch
+        /// </summary>
+        template<typename Type, int Width>
+        inline void SinCosPack(Simd::Pack<Type, Width>& outSin, Simd::Pack<Type, Width>& outCos, const Simd::Pack<Type, Width>& angle)
+        {
+            using Pack = Simd::Pack<Type, Width>;
+            using C = TrigCoefficients<Type>;
+
+            const Pack k = Simd::Round(angle * Pack::Broadcast(C::TWO_OVER_PI));
+            const Pack r = ((angle - k * Pack::Broadcast(C::PIO2_1)) - k * Pack::Broadcast(C::PIO2_2)) - k * Pack::Broadcast(C::PIO2_3);
+
+            Pack s, c;
+            SinCosReduced<Type>(s, c, r, [](Type value) { return Pack::Broadcast(value); });
+
+            /// m = k - 4 * round(k / 4) in {-2, -1, 0, 1, 2}: quadrant 0, 1, 2, 3 <-> m = 0, 1, +-2, -1
+            const Pack m = k - Pack::Broadcast(Type(4)) * Simd::Round(k * Pack::Broadcast(Type(0.25)));
+            const Pack half = Pack::Broadcast(Type(0.5));
+            const Pack oneAndHalf = Pack::Broadcast(Type(1.5));
+
+            const auto odd = !(Simd::Round(k * half) == k * half);
+            const auto sinNegative = (m < -half) | (m > oneAndHalf);
+            const auto cosNegative = (m > half) | (m < -oneAndHalf);
+
+            const Pack sinValue = Simd::Select(odd, c, s);
+            const Pack cosValue = Simd::Select(odd, s, c);
+
+            outSin = Simd::Select(sinNegative, -sinValue, sinValue);
+            outCos = Simd::Select(cosNegative, -cosValue, cosValue);
+        }
+
+
+        /// <summary>
+        /// Batch kernel: full packs, then a padded tail pack
+        /// </summary>
+        template<typename Type>
+        void SinCosBatch(std::span<Type> outSin, std::span<Type> outCos, std::span<const Type> angles)
+        {
+            ETLMATH_ASSERT(outSin.size() >= angles.size() && outCos.size() >= angles.size(), "FastTrig::SinCos output spans too small");
+
+            constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+            using Pack = Simd::Pack<Type, WIDTH>;
+
+            const std::size_t count = angles.size();
+            const std::size_t fullCount = count - count % WIDTH;
+
+            Pack s, c;
+            for (std::size_t i = 0; i < fullCount; i += WIDTH)
+            {
+                SinCosPack(s, c, Pack::Load(angles.data() + i));
+                s.store(outSin.data() + i);
+                c.store(outCos.data() + i);
+            }
+
+            if (fullCount < count)
+            {
+                Type tailAngles[WIDTH] = {}, tailSin[WIDTH], tailCos[WIDTH];
+                for (std::size_t i = fullCount; i < count; ++i)
+                    tailAngles[i - fullCount] = angles[i];
+
+                SinCosPack(s, c, Pack::Load(tailAngles));
+                s.store(tailSin);
+                c.store(tailCos);
+
+                for (std::size_t i = fullCount; i < count; ++i)
+                {
+                    outSin[i] = tailSin[i - fullCount];
+                    outCos[i] = tailCos[i - fullCount];
+                }
+            }
+        }
+    }
+
+
+    /// <summary>
+    /// Batch SinCos - float
+    /// </summary>
+    /// <param name="outSin"></param>
+    /// <param name="outCos"></param>
+    /// <param name="angles"></param>
+    void SinCos(std::span<float> outSin, std::span<float> outCos, std::span<const float> angles)
+    {
+        helpers::SinCosBatch(outSin, outCos, angles);
+    }
+
+
+    /// <summary>
+    /// Batch SinCos - double
+    /// </summary>
+    /// <param name="outSin"></param>
+    /// <param name="outCos"></param>
+    /// <param name="angles"></param>
+    void SinCos(std::span<double> outSin, std::span<double> outCos, std::span<const double> angles)
+    {
+        helpers::SinCosBatch(outSin, outCos, angles);
+    }
+
+} /// namespace ETL::Math::FastTrig
@@ -0,0 +1,109 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// FrameArena.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/FrameArena.h"
+#include "MathLib/Common/Asserts.h"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace ETL::Math
+{
+    FrameArena::FrameArena(std::size_t initialCapacity /*= DEFAULT_CAPACITY*/)
+    {
+        addBlock(std::max<std::size_t>(initialCapacity, BLOCK_ALIGNMENT));
+    }
+
+
+    FrameArena::~FrameArena()
+    {
+        releaseBlocks();
+    }
+
+
+    void* FrameArena::allocateBytes(std::size_t bytes, std::size_t alignment /*= alignof(std::max_align_t)*/)
+    {
+        ETLMATH_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, "FrameArena: alignment must be a power of two");
+
+        for (;;)
+        {
+            const Block& block = mBlocks[mCurrent];
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block.data) + mOffset;
+            const std::size_t start = mOffset + ((alignment - address % alignment) % alignment);
+
+            if (start <= block.size && bytes <= block.size - start)
+            {
+                mOffset = start + bytes;
+                mPeak = std::max(mPeak, mBase + mOffset);
+                return block.data + start;
+            }
+
+            /// Next block (kept from before a rewind), or a new one at least twice as big
+            mBase += block.size;
+            mOffset = 0;
+            if (++mCurrent == mBlocks.size())
+                addBlock(std::max(2 * block.size, bytes + alignment));
+        }
+    }
+
+
+    void FrameArena::rewind(const Marker& marker)
+    {
+        ETLMATH_ASSERT(marker.block < mCurrent || (marker.block == mCurrent && marker.offset <= mOffset), "FrameArena: marker is ahead of the arena");
+
+        mCurrent = marker.block;
+        mOffset = marker.offset;
+        mBase = 0;
+        for (std::size_t i = 0; i < mCurrent; ++i)
+            mBase += mBlocks[i].size;
+    }
+
+
+    void FrameArena::reset()
+    {
+        if (mBlocks.size() > 1)
+        {
+            const std::size_t capacity = getCapacity();
+            releaseBlocks();
+            addBlock(capacity);
+        }
+
+        mCurrent = 0;
+        mOffset = 0;
+        mBase = 0;
+    }
+
+
+    std::size_t FrameArena::getCapacity() const
+    {
+        std::size_t capacity = 0;
+        for (const Block& block : mBlocks)
+            capacity += block.size;
+        return capacity;
+    }
+
+
+    void FrameArena::addBlock(std::size_t size)
+    {
+        size = (size + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+        mBlocks.push_back({ static_cast<std::byte*>(::operator new(size, std::align_val_t(BLOCK_ALIGNMENT))), size });
+    }
+
+
+    void FrameArena::releaseBlocks()
+    {
+        for (const Block& block : mBlocks)
+            ::operator delete(block.data, std::align_val_t(BLOCK_ALIGNMENT));
+        mBlocks.clear();
+    }
+
+
+    FrameArena& GetMathScratch()
+    {
+        thread_local FrameArena scratch;
+        return scratch;
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,229 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Instrumentation.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Common/Instrumentation.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        constexpr std::array<std::string_view, INSTRUMENT_OP_COUNT> INSTRUMENT_OP_NAMES = {
+            "Matrix3x3Multiply",
+            "Matrix3x3MultiplyVector",
+            "Matrix3x3Inverse",
+            "Matrix3x3CreateRotation",
+            "Matrix4x4Multiply",
+            "Matrix4x4MultiplyVector",
+            "Matrix4x4Inverse",
+            "Matrix4x4CreateRotation",
+            "Matrix4x4InverseProjection",
+            "Matrix4x4MultiplyBatch",
+            "Matrix4x4InverseBatch",
+            "Vector2Normalize",
+            "Vector3Normalize",
+            "Vector4Normalize",
+            "QuaternionMultiply",
+            "QuaternionNormalize",
+            "QuaternionInverse"
+        };
+
+        constexpr int INSTRUMENT_SLOT_COUNT = INSTRUMENT_MAX_SCOPES * INSTRUMENT_OP_COUNT;
+
+        /// Live threads, totals of finished threads and scope names. Only touched when a thread
+        /// first uses a probe or exits, and by snapshots / resets / scope registration.
+        struct InstrumentRegistry
+        {
+            std::mutex                                         mutex;
+            std::vector<InstrumentThreadData*>                 threads;
+            std::array<InstrumentStats, INSTRUMENT_SLOT_COUNT> retired{};
+            std::vector<std::string>                           scopeNames{ "Default" };
+        };
+
+        inline InstrumentRegistry& GetInstrumentRegistry()
+        {
+            static InstrumentRegistry registry;
+            return registry;
+        }
+
+        /// Owns the calling thread's counters, folds them into the registry at thread exit
+        struct InstrumentThreadOwner
+        {
+            std::unique_ptr<InstrumentThreadData> data;
+
+            ~InstrumentThreadOwner()
+            {
+                if (!data)
+                    return;
+
+                InstrumentRegistry& registry = GetInstrumentRegistry();
+                std::lock_guard lock(registry.mutex);
+                for (int slot = 0; slot < INSTRUMENT_SLOT_COUNT; ++slot)
+                {
+                    const InstrumentCounter& counter = data->counters[slot / INSTRUMENT_OP_COUNT][slot % INSTRUMENT_OP_COUNT];
+                    registry.retired[slot].calls += counter.calls.load(std::memory_order_relaxed);
+                    registry.retired[slot].sampledCalls += counter.sampledCalls.load(std::memory_order_relaxed);
+                    registry.retired[slot].sampledCycles += counter.sampledCycles.load(std::memory_order_relaxed);
+                }
+                std::erase(registry.threads, data.get());
+                tlsInstrumentData = nullptr;
+            }
+        };
+
+        thread_local InstrumentThreadOwner tlsInstrumentOwner;
+        constinit thread_local InstrumentThreadData* tlsInstrumentData = nullptr;
+
+
+        InstrumentThreadData& AcquireInstrumentThreadData()
+        {
+            if (!tlsInstrumentData)
+            {
+                tlsInstrumentOwner.data = std::make_unique<InstrumentThreadData>();
+
+                InstrumentRegistry& registry = GetInstrumentRegistry();
+                std::lock_guard lock(registry.mutex);
+                registry.threads.push_back(tlsInstrumentOwner.data.get());
+                tlsInstrumentData = tlsInstrumentOwner.data.get();
+            }
+            return *tlsInstrumentData;
+        }
+    }
+
+
+    std::string_view GetInstrumentOpName(InstrumentOp op)
+    {
+        const int index = static_cast<int>(op);
+        return (index >= 0 && index < INSTRUMENT_OP_COUNT) ? helpers::INSTRUMENT_OP_NAMES[index] : std::string_view("Unknown");
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Scopes
+
+    int RegisterInstrumentScope(std::string_view name)
+    {
+        helpers::InstrumentRegistry& registry = helpers::GetInstrumentRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        const auto it = std::find(registry.scopeNames.begin(), registry.scopeNames.end(), name);
+        if (it != registry.scopeNames.end())
+            return static_cast<int>(it - registry.scopeNames.begin());
+
+        if (registry.scopeNames.size() >= INSTRUMENT_MAX_SCOPES)
+            return 0;
+
+        registry.scopeNames.emplace_back(name);
+        return static_cast<int>(registry.scopeNames.size()) - 1;
+    }
+
+
+    InstrumentScope::InstrumentScope(int scope)
+    {
+        helpers::InstrumentThreadData& data = helpers::AcquireInstrumentThreadData();
+        mPrevious = data.scope;
+        data.scope = (scope >= 0 && scope < INSTRUMENT_MAX_SCOPES) ? scope : 0;
+    }
+
+    InstrumentScope::~InstrumentScope()
+    {
+        helpers::AcquireInstrumentThreadData().scope = mPrevious;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Snapshot & export
+
+    InstrumentStats InstrumentSnapshot::getTotal(InstrumentOp op) const
+    {
+        InstrumentStats total;
+        for (std::size_t scope = 0; scope < scopeNames.size(); ++scope)
+        {
+            const InstrumentStats& stat = get(static_cast<int>(scope), op);
+            total.calls += stat.calls;
+            total.sampledCalls += stat.sampledCalls;
+            total.sampledCycles += stat.sampledCycles;
+        }
+        return total;
+    }
+
+
+    std::string InstrumentSnapshot::toJson() const
+    {
+        std::ostringstream json;
+        json << "{\"samplePeriod\":" << INSTRUMENT_SAMPLE_PERIOD << ",\"scopes\":[";
+        for (std::size_t scope = 0; scope < scopeNames.size(); ++scope)
+        {
+            json << (scope ? "," : "") << "{\"name\":\"" << scopeNames[scope] << "\",\"ops\":{";
+            bool bFirst = true;
+            for (int op = 0; op < INSTRUMENT_OP_COUNT; ++op)
+            {
+                const InstrumentStats& stat = get(static_cast<int>(scope), InstrumentOp(op));
+                if (stat.calls == 0)
+                    continue;
+
+                json << (bFirst ? "" : ",") << "\"" << GetInstrumentOpName(InstrumentOp(op)) << "\":{\"calls\":" << stat.calls
+                     << ",\"sampledCalls\":" << stat.sampledCalls << ",\"averageCycles\":" << stat.getAverageCycles() << "}";
+                bFirst = false;
+            }
+            json << "}}";
+        }
+        json << "]}";
+        return json.str();
+    }
+
+
+    InstrumentSnapshot TakeInstrumentSnapshot()
+    {
+        using namespace helpers;
+        InstrumentRegistry& registry = GetInstrumentRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        InstrumentSnapshot snapshot;
+        snapshot.scopeNames = registry.scopeNames;
+        snapshot.stats.assign(registry.retired.begin(), registry.retired.begin() + registry.scopeNames.size() * INSTRUMENT_OP_COUNT);
+
+        for (const InstrumentThreadData* data : registry.threads)
+        {
+            for (std::size_t slot = 0; slot < snapshot.stats.size(); ++slot)
+            {
+                const InstrumentCounter& counter = data->counters[slot / INSTRUMENT_OP_COUNT][slot % INSTRUMENT_OP_COUNT];
+                snapshot.stats[slot].calls += counter.calls.load(std::memory_order_relaxed);
+                snapshot.stats[slot].sampledCalls += counter.sampledCalls.load(std::memory_order_relaxed);
+                snapshot.stats[slot].sampledCycles += counter.sampledCycles.load(std::memory_order_relaxed);
+            }
+        }
+        return snapshot;
+    }
+
+
+    void ResetInstrumentCounters()
+    {
+        using namespace helpers;
+        InstrumentRegistry& registry = GetInstrumentRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        registry.retired.fill({});
+        for (InstrumentThreadData* data : registry.threads)
+        {
+            for (auto& scopeCounters : data->counters)
+            {
+                for (InstrumentCounter& counter : scopeCounters)
+                {
+                    counter.calls.store(0, std::memory_order_relaxed);
+                    counter.sampledCalls.store(0, std::memory_order_relaxed);
+                    counter.sampledCycles.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+} /// namespace ETL::Math
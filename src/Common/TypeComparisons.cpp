@@ -9,6 +9,7 @@
 #include "MathLib/Types/Vector4.h"
 #include "MathLib/Types/Matrix3x3.h"
 #include "MathLib/Types/Matrix4x4.h"
+#include "MathLib/Types/Quaternion.h"
 
 namespace ETL::Math
 {
@@ -60,4 +61,13 @@ namespace ETL::Math
     template bool isEqual(const Matrix4x4<float>&,  const Matrix4x4<float>&,  double);
     template bool isEqual(const Matrix4x4<double>&, const Matrix4x4<double>&, double);
 
+    /// Quaternion
+    template bool isZero(const Quaternion<int>&,    double);
+    template bool isZero(const Quaternion<float>&,  double);
+    template bool isZero(const Quaternion<double>&, double);
+
+    template bool isEqual(const Quaternion<int>&,    const Quaternion<int>&,    double);
+    template bool isEqual(const Quaternion<float>&,  const Quaternion<float>&,  double);
+    template bool isEqual(const Quaternion<double>&, const Quaternion<double>&, double);
+
 } /// namespace ETL::Math
@@ -0,0 +1,966 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// PackedTypes.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Compression/PackedTypes.h"
+#include "MathLib/LinearAlgebra/AffineDecomposition.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/FixedPointHelpers.h"
+#include "MathLib/Common/SimdPack.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// Largest finite half float
+        constexpr float HALF_MAX = 65504.0f;
+
+        /// snorm16 scale of the octahedral coordinates
+        constexpr double OCT_SCALE = 32767.0;
+
+        /// Smallest three: components quantized over [-QUAT_LIMIT, QUAT_LIMIT] on 15 bits
+        constexpr double QUAT_LIMIT = 0.70710678118654752440;
+        constexpr double QUAT_STEPS = 32767.0;
+
+        /// Position quantization steps per axis
+        constexpr double POSITION_STEPS = 65535.0;
+
+        /// Batched half conversions copy whole arrays of packed vectors
+        static_assert(sizeof(PackedVector3Half) == 3 * sizeof(std::uint16_t));
+
+        /// Transforms are decomposed in chunks of this many matrices
+        constexpr std::size_t TRANSFORM_CHUNK = 256;
+
+
+        /// <summary>
+        /// float -> half, round to nearest even (inputs are clamped to +-HALF_MAX by the callers, NaN is kept)
+        /// </summary>
+        inline std::uint16_t FloatToHalf(float value)
+        {
+            constexpr std::uint32_t F32_INFINITY = 255u << 23;
+            constexpr std::uint32_t F16_OVERFLOW = (127u + 16u) << 23;
+            constexpr std::uint32_t DENORMAL_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+            std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+            const std::uint32_t sign = bits & 0x80000000u;
+            bits ^= sign;
+
+            std::uint32_t result;
+            if (bits >= F16_OVERFLOW)
+            {
+                result = bits > F32_INFINITY ? 0x7E00u : 0x7C00u;
+            }
+            else if (bits < (113u << 23))
+            {
+                /// Subnormal half: let the FPU round by aligning the mantissa with a magic addend
+                const float aligned = std::bit_cast<float>(bits) + std::bit_cast<float>(DENORMAL_MAGIC);
+                result = std::bit_cast<std::uint32_t>(aligned) - DENORMAL_MAGIC;
+            }
+            else
+            {
+                const std::uint32_t mantissaOdd = (bits >> 13) & 1u;
+                bits += (static_cast<std::uint32_t>(15 - 127) << 23) + 0xFFFu + mantissaOdd;
+                result = bits >> 13;
+            }
+            return static_cast<std::uint16_t>(result | (sign >> 16));
+        }
+
+
+        /// <summary>
+        /// half -> float (exact)
+        /// </summary>
+        inline float HalfToFloat(std::uint16_t half)
+        {
+            constexpr std::uint32_t SHIFTED_EXPONENT = 0x7C00u << 13;
+            constexpr std::uint32_t MAGIC = 113u << 23;
+
+            std::uint32_t bits = (half & 0x7FFFu) << 13;
+            const std::uint32_t exponent = bits & SHIFTED_EXPONENT;
+            bits += (127u - 15u) << 23;
+
+            if (exponent == SHIFTED_EXPONENT)
+            {
+                bits += (128u - 16u) << 23; /// Inf / NaN
+            }
+            else if (exponent == 0)
+            {
+                bits += 1u << 23; /// Subnormal: renormalize
+                bits = std::bit_cast<std::uint32_t>(std::bit_cast<float>(bits) - std::bit_cast<float>(MAGIC));
+            }
+            return std::bit_cast<float>(bits | (static_cast<std::uint32_t>(half & 0x8000u) << 16));
+        }
+
+
+        /// <summary>
+        /// Run 'kernel' over 'count' elements, WIDTH at a time.
+        /// load(values, index) fills IN values of element 'index', kernel(in, out) maps IN packs to
+        /// OUT packs, store(index, values) writes OUT values. Padding lanes repeat the group's first element.
+        /// </summary>
+        template<typename Calc, int WIDTH, int IN, int OUT, typename Load, typename Kernel, typename Store>
+        inline void RunBatch(std::size_t count, Load load, Kernel kernel, Store store)
+        {
+            using Pack = Simd::Pack<Calc, WIDTH>;
+
+            for (std::size_t first = 0; first < count; first += WIDTH)
+            {
+                const int active = static_cast<int>(std::min<std::size_t>(WIDTH, count - first));
+
+                alignas(32) Calc inLanes[IN][WIDTH];
+                Calc values[IN];
+                for (int lane = 0; lane < WIDTH; ++lane)
+                {
+                    load(values, first + (lane < active ? lane : 0));
+                    for (int k = 0; k < IN; ++k)
+                        inLanes[k][lane] = values[k];
+                }
+
+                Pack in[IN];
+                Pack out[OUT];
+                for (int k = 0; k < IN; ++k)
+                    in[k] = Pack::Load(inLanes[k]);
+
+                kernel(in, out);
+
+                alignas(32) Calc outLanes[OUT][WIDTH];
+                for (int k = 0; k < OUT; ++k)
+                    out[k].store(outLanes[k]);
+
+                Calc results[OUT];
+                for (int lane = 0; lane < active; ++lane)
+                {
+                    for (int k = 0; k < OUT; ++k)
+                        results[k] = outLanes[k][lane];
+                    store(first + lane, results);
+                }
+            }
+        }
+
+
+        /// +1 for positive lanes (zero included), -1 otherwise
+        template<typename Calc, typename Pack>
+        inline Pack SignNotZero(const Pack& a)
+        {
+            const Pack one = Pack::Broadcast(Calc(1));
+            return Simd::Select(a >= Pack::Zero(), one, -one);
+        }
+
+
+        /// <summary>
+        /// Octahedral projection of (x, y, z) folded onto the square, quantized to snorm16
+        /// </summary>
+        template<typename Calc, typename Pack>
+        inline void OctEncodeKernel(const Pack (&normal)[3], Pack (&outCoords)[2])
+        {
+            const Pack one = Pack::Broadcast(Calc(1));
+            const Pack invNorm = one / (Simd::Abs(normal[0]) + Simd::Abs(normal[1]) + Simd::Abs(normal[2]));
+            const Pack x = normal[0] * invNorm;
+            const Pack y = normal[1] * invNorm;
+
+            /// Lower hemisphere is folded over the diagonals
+            const auto lower = normal[2] < Pack::Zero();
+            const Pack foldedX = (one - Simd::Abs(y)) * SignNotZero<Calc>(x);
+            const Pack foldedY = (one - Simd::Abs(x)) * SignNotZero<Calc>(y);
+
+            const Pack scale = Pack::Broadcast(static_cast<Calc>(OCT_SCALE));
+            outCoords[0] = Simd::Round(Simd::Min(Simd::Max(Simd::Select(lower, foldedX, x), -one), one) * scale);
+            outCoords[1] = Simd::Round(Simd::Min(Simd::Max(Simd::Select(lower, foldedY, y), -one), one) * scale);
+        }
+
+
+        /// <summary>
+        /// snorm16 octahedral coordinates back to a unit vector
+        /// </summary>
+        template<typename Calc, typename Pack>
+        inline void OctDecodeKernel(const Pack (&coords)[2], Pack (&outNormal)[3])
+        {
+            const Pack one = Pack::Broadcast(Calc(1));
+            const Pack invScale = Pack::Broadcast(static_cast<Calc>(1.0 / OCT_SCALE));
+            Pack x = coords[0] * invScale;
+            Pack y = coords[1] * invScale;
+            const Pack z = one - Simd::Abs(x) - Simd::Abs(y);
+
+            /// Unfold the lower hemisphere (t = 0 in the upper one)
+            const Pack t = Simd::Max(-z, Pack::Zero());
+            x = x - t * SignNotZero<Calc>(x);
+            y = y - t * SignNotZero<Calc>(y);
+
+            const Pack invLength = one / Simd::Sqrt(x * x + y * y + z * z);
+            outNormal[0] = x * invLength;
+            outNormal[1] = y * invLength;
+            outNormal[2] = z * invLength;
+        }
+
+
+        /// <summary>
+        /// floor(x / divisor) for integral x in [0, 65535] and a power of two divisor, exact in float
+        /// (the fraction (x mod d) / d is offset into (-0.5, 0.5) before rounding)
+        /// </summary>
+        template<typename Calc, typename Pack>
+        inline Pack FloorDivide(const Pack& x, double divisor)
+        {
+            return Simd::Round(x * Pack::Broadcast(static_cast<Calc>(1.0 / divisor)) - Pack::Broadcast(static_cast<Calc>(0.5 - 0.5 / divisor)));
+        }
+
+
+        /// <summary>
+        /// Normalized quaternion (x, y, z, w) to the 3 16-bit words of the 48-bit layout
+        /// (index << 45 | a << 30 | b << 15 | c, word 0 lowest). The dropped component is made
+        /// positive by negating the quaternion if needed.
+        /// </summary>
+        template<typename Calc, typename Pack>
+        inline void QuatEncodeKernel(const Pack (&quat)[4], Pack (&outWords)[3])
+        {
+            const Pack one = Pack::Broadcast(Calc(1));
+            const Pack invLength = one / Simd::Sqrt(quat[0] * quat[0] + quat[1] * quat[1] + quat[2] * quat[2] + quat[3] * quat[3]);
+
+            Pack c[4];
+            for (int k = 0; k < 4; ++k)
+                c[k] = quat[k] * invLength;
+
+            Pack largest = Simd::Abs(c[0]);
+            Pack signedLargest = c[0];
+            Pack index = Pack::Zero();
+            for (int k = 1; k < 4; ++k)
+            {
+                const auto greater = Simd::Abs(c[k]) > largest;
+                largest = Simd::Select(greater, Simd::Abs(c[k]), largest);
+                signedLargest = Simd::Select(greater, c[k], signedLargest);
+                index = Simd::Select(greater, Pack::Broadcast(static_cast<Calc>(k)), index);
+            }
+            const Pack sign = SignNotZero<Calc>(signedLargest);
+
+            /// Remaining components in x, y, z, w order
+            const Pack remaining[3] = {
+                Simd::Select(index == Pack::Zero(), c[1], c[0]),
+                Simd::Select(index <= one, c[2], c[1]),
+                Simd::Select(index <= Pack::Broadcast(Calc(2)), c[3], c[2]),
+            };
+
+            const Pack limit = Pack::Broadcast(static_cast<Calc>(QUAT_LIMIT));
+            const Pack scale = Pack::Broadcast(static_cast<Calc>(QUAT_STEPS / (2.0 * QUAT_LIMIT)));
+            const Pack steps = Pack::Broadcast(static_cast<Calc>(QUAT_STEPS));
+
+            Pack quantized[3];
+            for (int k = 0; k < 3; ++k)
+                quantized[k] = Simd::Round(Simd::Min(Simd::Max((remaining[k] * sign + limit) * scale, Pack::Zero()), steps));
+
+            /// Split the 15-bit fields across 16-bit words (every intermediate is an exact integer below 2^16)
+            const Pack bHigh = FloorDivide<Calc>(quantized[1], 2.0);
+            const Pack aHigh = FloorDivide<Calc>(quantized[0], 4.0);
+            outWords[0] = quantized[2] + (quantized[1] - bHigh * Pack::Broadcast(Calc(2))) * Pack::Broadcast(Calc(32768));
+            outWords[1] = bHigh + (quantized[0] - aHigh * Pack::Broadcast(Calc(4))) * Pack::Broadcast(Calc(16384));
+            outWords[2] = aHigh + index * Pack::Broadcast(Calc(8192));
+        }
+
+
+        /// <summary>
+        /// The 3 16-bit words of the 48-bit layout back to (x, y, z, w)
+        /// </summary>
+        template<typename Calc, typename Pack>
+        inline void QuatDecodeKernel(const Pack (&words)[3], Pack (&outQuat)[4])
+        {
+            const Pack one = Pack::Broadcast(Calc(1));
+            const Pack two = Pack::Broadcast(Calc(2));
+            const Pack limit = Pack::Broadcast(static_cast<Calc>(QUAT_LIMIT));
+            const Pack step = Pack::Broadcast(static_cast<Calc>(2.0 * QUAT_LIMIT / QUAT_STEPS));
+
+            const Pack bLow = FloorDivide<Calc>(words[0], 32768.0);
+            const Pack aLow = FloorDivide<Calc>(words[1], 16384.0);
+            const Pack index = FloorDivide<Calc>(words[2], 8192.0);
+            const Pack quantized[3] = {
+                (words[2] - index * Pack::Broadcast(Calc(8192))) * Pack::Broadcast(Calc(4)) + aLow,
+                (words[1] - aLow * Pack::Broadcast(Calc(16384))) * two + bLow,
+                words[0] - bLow * Pack::Broadcast(Calc(32768)),
+            };
+
+            Pack r[3];
+            for (int k = 0; k < 3; ++k)
+                r[k] = quantized[k] * step - limit;
+
+            const Pack largest = Simd::Sqrt(Simd::Max(one - r[0] * r[0] - r[1] * r[1] - r[2] * r[2], Pack::Zero()));
+
+            outQuat[0] = Simd::Select(index == Pack::Zero(), largest, r[0]);
+            outQuat[1] = Simd::Select(index == one, largest, Simd::Select(index < one, r[0], r[1]));
+            outQuat[2] = Simd::Select(index == two, largest, Simd::Select(index < two, r[1], r[2]));
+            outQuat[3] = Simd::Select(index == Pack::Broadcast(Calc(3)), largest, r[2]);
+        }
+
+
+        /// <summary>
+        /// Quantize positions: round(clamp((p - min) * steps / extent, 0, steps))
+        /// </summary>
+        template<typename Type>
+        inline void EncodePositions(std::size_t count, const Vector3<Type>* positions, PackedPosition16* outPacked,
+                                    const QuantizationRange<Type>& range, auto runner)
+        {
+            using Calc = CalcType<Type>;
+
+            Calc origin[3], scale[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                origin[i] = DecodeValue<Calc>(range.min.getRawValue(i));
+                const Calc extent = DecodeValue<Calc>(range.max.getRawValue(i)) - origin[i];
+                scale[i] = extent > Calc(0) ? static_cast<Calc>(POSITION_STEPS / extent) : Calc(0);
+            }
+
+            runner(count,
+                   [&](Calc (&values)[3], std::size_t index)
+                   {
+                       for (int i = 0; i < 3; ++i)
+                           values[i] = DecodeValue<Calc>(positions[index].getRawValue(i));
+                   },
+                   [&](const auto& in, auto& out)
+                   {
+                       using Pack = std::remove_cvref_t<decltype(in[0])>;
+                       const Pack steps = Pack::Broadcast(static_cast<Calc>(POSITION_STEPS));
+                       for (int i = 0; i < 3; ++i)
+                       {
+                           const Pack scaled = (in[i] - Pack::Broadcast(origin[i])) * Pack::Broadcast(scale[i]);
+                           out[i] = Simd::Round(Simd::Min(Simd::Max(scaled, Pack::Zero()), steps));
+                       }
+                   },
+                   [&](std::size_t index, const Calc (&values)[3])
+                   {
+                       outPacked[index] = { static_cast<std::uint16_t>(values[0]), static_cast<std::uint16_t>(values[1]),
+                                            static_cast<std::uint16_t>(values[2]) };
+                   });
+        }
+
+
+        /// <summary>
+        /// Dequantize positions: min + q * extent / steps
+        /// </summary>
+        template<typename Type>
+        inline void DecodePositions(std::size_t count, const PackedPosition16* packed, Vector3<Type>* outPositions,
+                                    const QuantizationRange<Type>& range, auto runner)
+        {
+            using Calc = CalcType<Type>;
+
+            Calc origin[3], step[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                origin[i] = DecodeValue<Calc>(range.min.getRawValue(i));
+                step[i] = static_cast<Calc>((DecodeValue<Calc>(range.max.getRawValue(i)) - origin[i]) / POSITION_STEPS);
+            }
+
+            runner(count,
+                   [&](Calc (&values)[3], std::size_t index)
+                   {
+                       values[0] = static_cast<Calc>(packed[index].x);
+                       values[1] = static_cast<Calc>(packed[index].y);
+                       values[2] = static_cast<Calc>(packed[index].z);
+                   },
+                   [&](const auto& in, auto& out)
+                   {
+                       using Pack = std::remove_cvref_t<decltype(in[0])>;
+                       for (int i = 0; i < 3; ++i)
+                           out[i] = Simd::MulAdd(in[i], Pack::Broadcast(step[i]), Pack::Broadcast(origin[i]));
+                   },
+                   [&](std::size_t index, const Calc (&values)[3])
+                   {
+                       for (int i = 0; i < 3; ++i)
+                           outPositions[index].setRawValue(i, EncodeValue<Type>(values[i]));
+                   });
+        }
+
+
+        /// Kernel runners: one element (scalar API) or WIDTH elements per pack (batch API)
+        template<typename Type, int IN, int OUT>
+        constexpr auto SINGLE_RUNNER = [](std::size_t count, auto load, auto kernel, auto store)
+        {
+            RunBatch<CalcType<Type>, 1, IN, OUT>(count, load, kernel, store);
+        };
+
+        template<typename Type, int IN, int OUT>
+        constexpr auto BATCH_RUNNER = [](std::size_t count, auto load, auto kernel, auto store)
+        {
+            RunBatch<CalcType<Type>, Simd::NATIVE_WIDTH<CalcType<Type>>, IN, OUT>(count, load, kernel, store);
+        };
+
+
+        /// <summary>
+        /// Octahedral encode of 'count' vectors
+        /// </summary>
+        template<typename Type>
+        inline void EncodeOct(std::size_t count, const Vector3<Type>* normals, PackedUnitVectorOct* outPacked, auto runner)
+        {
+            using Calc = CalcType<Type>;
+            runner(count,
+                   [&](Calc (&values)[3], std::size_t index)
+                   {
+                       for (int i = 0; i < 3; ++i)
+                           values[i] = DecodeValue<Calc>(normals[index].getRawValue(i));
+                   },
+                   [](const auto& in, auto& out) { OctEncodeKernel<Calc>(in, out); },
+                   [&](std::size_t index, const Calc (&values)[2])
+                   {
+                       outPacked[index] = { static_cast<std::int16_t>(values[0]), static_cast<std::int16_t>(values[1]) };
+                   });
+        }
+
+
+        /// <summary>
+        /// Octahedral decode of 'count' vectors
+        /// </summary>
+        template<typename Type>
+        inline void DecodeOct(std::size_t count, const PackedUnitVectorOct* packed, Vector3<Type>* outNormals, auto runner)
+        {
+            using Calc = CalcType<Type>;
+            runner(count,
+                   [&](Calc (&values)[2], std::size_t index)
+                   {
+                       values[0] = static_cast<Calc>(packed[index].x);
+                       values[1] = static_cast<Calc>(packed[index].y);
+                   },
+                   [](const auto& in, auto& out) { OctDecodeKernel<Calc>(in, out); },
+                   [&](std::size_t index, const Calc (&values)[3])
+                   {
+                       for (int i = 0; i < 3; ++i)
+                           outNormals[index].setRawValue(i, EncodeValue<Type>(values[i]));
+                   });
+        }
+
+
+        /// <summary>
+        /// Smallest three encode of 'count' quaternions
+        /// </summary>
+        template<typename Type>
+        inline void EncodeQuat(std::size_t count, const Quaternion<Type>* rotations, PackedQuatSmallest3* outPacked, auto runner)
+        {
+            using Calc = CalcType<Type>;
+            runner(count,
+                   [&](Calc (&values)[4], std::size_t index)
+                   {
+                       for (int i = 0; i < 4; ++i)
+                           values[i] = DecodeValue<Calc>(rotations[index].getRawValue(i));
+                   },
+                   [](const auto& in, auto& out) { QuatEncodeKernel<Calc>(in, out); },
+                   [&](std::size_t index, const Calc (&words)[3])
+                   {
+                       for (int word = 0; word < 3; ++word)
+                           outPacked[index].bits[word] = static_cast<std::uint16_t>(words[word]);
+                   });
+        }
+
+
+        /// <summary>
+        /// Smallest three decode of 'count' quaternions
+        /// </summary>
+        template<typename Type>
+        inline void DecodeQuat(std::size_t count, const PackedQuatSmallest3* packed, Quaternion<Type>* outRotations, auto runner)
+        {
+            using Calc = CalcType<Type>;
+            runner(count,
+                   [&](Calc (&words)[3], std::size_t index)
+                   {
+                       for (int word = 0; word < 3; ++word)
+                           words[word] = static_cast<Calc>(packed[index].bits[word]);
+                   },
+                   [](const auto& in, auto& out) { QuatDecodeKernel<Calc>(in, out); },
+                   [&](std::size_t index, const Calc (&values)[4])
+                   {
+                       for (int i = 0; i < 4; ++i)
+                           outRotations[index].setRawValue(i, EncodeValue<Type>(values[i]));
+                   });
+        }
+
+
+        /// <summary>
+        /// Clamp to the half range (NaN is kept)
+        /// </summary>
+        inline float ClampToHalf(float value)
+        {
+            return value < -HALF_MAX ? -HALF_MAX : (value > HALF_MAX ? HALF_MAX : value);
+        }
+
+
+        /// <summary>
+        /// T * R * diag(scale) from decoded parts
+        /// </summary>
+        template<typename Type>
+        inline void ComposeTransform(Matrix4x4<Type>& outMat, const Vector3<Type>& translation, const Quaternion<Type>& rotation,
+                                     const Vector3<Type>& scale)
+        {
+            using Calc = CalcType<Type>;
+
+            rotation.toMatrixTo(outMat);
+            for (int col = 0; col < 3; ++col)
+            {
+                const Calc s = DecodeValue<Calc>(scale.getRawValue(col));
+                for (int row = 0; row < 3; ++row)
+                    outMat.setRawValue(row, col, EncodeValue<Type>(DecodeValue<Calc>(outMat.getRawValue(row, col)) * s));
+            }
+            for (int row = 0; row < 3; ++row)
+                outMat.setRawValue(row, 3, translation.getRawValue(row));
+        }
+
+
+        /// <summary>
+        /// Best-effort rotation and scale of a singular matrix (Decompose failed): an orthonormal frame
+        /// grown from the longest column, completed by cross products where the columns are degenerate,
+        /// and the columns projected on it. Exact for a rank-deficient matrix without shear.
+        /// </summary>
+        template<typename Type>
+        inline void FallbackFrame(Quaternion<Type>& outRotation, Vector3<Type>& outScale, const Matrix4x4<Type>& mat)
+        {
+            auto dot = [](const double (&a)[3], const double (&b)[3]) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; };
+            auto cross = [](double (&out)[3], const double (&a)[3], const double (&b)[3])
+            {
+                out[0] = a[1] * b[2] - a[2] * b[1];
+                out[1] = a[2] * b[0] - a[0] * b[2];
+                out[2] = a[0] * b[1] - a[1] * b[0];
+            };
+            auto normalize = [&](double (&v)[3])
+            {
+                const double length = std::sqrt(dot(v, v));
+                for (int i = 0; i < 3; ++i)
+                    v[i] /= length;
+            };
+
+            double columns[3][3], lengths[3];
+            for (int col = 0; col < 3; ++col)
+            {
+                for (int row = 0; row < 3; ++row)
+                    columns[col][row] = DecodeValue<double>(mat.getRawValue(row, col));
+                lengths[col] = std::sqrt(dot(columns[col], columns[col]));
+            }
+
+            /// Columns by decreasing length: a keeps its direction, b its component orthogonal to a
+            int order[3] = { 0, 1, 2 };
+            std::sort(order, order + 3, [&](int i, int j) { return lengths[i] > lengths[j]; });
+            const int a = order[0], b = order[1], c = order[2];
+
+            double axes[3][3] = {};
+            if (lengths[a] > 0.0)
+                for (int i = 0; i < 3; ++i)
+                    axes[a][i] = columns[a][i] / lengths[a];
+            else
+                axes[a][a] = 1.0;
+
+            const double along = dot(columns[b], axes[a]);
+            for (int i = 0; i < 3; ++i)
+                axes[b][i] = columns[b][i] - along * axes[a][i];
+            if (dot(axes[b], axes[b]) <= 1e-12 * lengths[a] * lengths[a])
+            {
+                /// Parallel or null: any direction orthogonal to a
+                const int least = std::abs(axes[a][0]) <= std::abs(axes[a][1]) ? (std::abs(axes[a][0]) <= std::abs(axes[a][2]) ? 0 : 2)
+                                                                                : (std::abs(axes[a][1]) <= std::abs(axes[a][2]) ? 1 : 2);
+                double unit[3] = {};
+                unit[least] = 1.0;
+                cross(axes[b], axes[a], unit);
+            }
+            normalize(axes[b]);
+
+            /// Right-handed: x = y * z, y = z * x, z = x * y
+            cross(axes[c], axes[(c + 1) % 3], axes[(c + 2) % 3]);
+
+            Matrix4x4<Type> rotation = Matrix4x4<Type>::Identity();
+            for (int col = 0; col < 3; ++col)
+            {
+                for (int row = 0; row < 3; ++row)
+                    rotation.setRawValue(row, col, EncodeValue<Type>(axes[col][row]));
+                outScale.setRawValue(col, EncodeValue<Type>(dot(columns[col], axes[col])));
+            }
+            FromMatrix(outRotation, rotation);
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Half float vector
+
+    /// <summary>
+    /// Encode to 3 half floats
+    /// </summary>
+    template<typename Type>
+    void Encode(PackedVector3Half& outPacked, const Vector3<Type>& vec)
+    {
+        outPacked.x = helpers::FloatToHalf(helpers::ClampToHalf(DecodeValue<float>(vec.getRawValue(0))));
+        outPacked.y = helpers::FloatToHalf(helpers::ClampToHalf(DecodeValue<float>(vec.getRawValue(1))));
+        outPacked.z = helpers::FloatToHalf(helpers::ClampToHalf(DecodeValue<float>(vec.getRawValue(2))));
+    }
+
+
+    /// <summary>
+    /// Decode 3 half floats
+    /// </summary>
+    template<typename Type>
+    void Decode(Vector3<Type>& outVec, const PackedVector3Half& packed)
+    {
+        outVec.setRawValue(0, EncodeValue<Type>(helpers::HalfToFloat(packed.x)));
+        outVec.setRawValue(1, EncodeValue<Type>(helpers::HalfToFloat(packed.y)));
+        outVec.setRawValue(2, EncodeValue<Type>(helpers::HalfToFloat(packed.z)));
+    }
+
+
+    /// <summary>
+    /// Batched encode: 8 vectors (24 components, 3 registers) per F16C conversion group
+    /// </summary>
+    template<typename Type>
+    void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<Type>> vecs)
+    {
+        ETLMATH_ASSERT(outPacked.size() == vecs.size(), "Span size mismatch in Encode");
+
+        std::size_t i = 0;
+#if defined(ETLMATH_SIMD_F16C)
+        const __m256 lowest = _mm256_set1_ps(-helpers::HALF_MAX);
+        const __m256 highest = _mm256_set1_ps(helpers::HALF_MAX);
+        for (; i + 8 <= vecs.size(); i += 8)
+        {
+            alignas(32) float values[24];
+            for (int v = 0; v < 8; ++v)
+                for (int c = 0; c < 3; ++c)
+                    values[v * 3 + c] = DecodeValue<float>(vecs[i + v].getRawValue(c));
+
+            alignas(16) std::uint16_t halves[24];
+            for (int group = 0; group < 3; ++group)
+            {
+                /// min/max operand order keeps NaN, as the scalar clamp does
+                const __m256 clamped = _mm256_max_ps(lowest, _mm256_min_ps(highest, _mm256_load_ps(values + group * 8)));
+                _mm_store_si128(reinterpret_cast<__m128i*>(halves + group * 8), _mm256_cvtps_ph(clamped, _MM_FROUND_TO_NEAREST_INT));
+            }
+            std::memcpy(&outPacked[i], halves, sizeof(halves));
+        }
+#endif
+        for (; i < vecs.size(); ++i)
+            Encode(outPacked[i], vecs[i]);
+    }
+
+
+    /// <summary>
+    /// Batched decode
+    /// </summary>
+    template<typename Type>
+    void Decode(std::span<Vector3<Type>> outVecs, std::span<const PackedVector3Half> packed)
+    {
+        ETLMATH_ASSERT(outVecs.size() == packed.size(), "Span size mismatch in Decode");
+
+        std::size_t i = 0;
+#if defined(ETLMATH_SIMD_F16C)
+        for (; i + 8 <= packed.size(); i += 8)
+        {
+            alignas(16) std::uint16_t halves[24];
+            std::memcpy(halves, &packed[i], sizeof(halves));
+
+            alignas(32) float values[24];
+            for (int group = 0; group < 3; ++group)
+                _mm256_store_ps(values + group * 8, _mm256_cvtph_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(halves + group * 8))));
+
+            for (int v = 0; v < 8; ++v)
+                for (int c = 0; c < 3; ++c)
+                    outVecs[i + v].setRawValue(c, EncodeValue<Type>(values[v * 3 + c]));
+        }
+#endif
+        for (; i < packed.size(); ++i)
+            Decode(outVecs[i], packed[i]);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Octahedral unit vector
+
+    template<typename Type>
+    void Encode(PackedUnitVectorOct& outPacked, const Vector3<Type>& normal)
+    {
+        helpers::EncodeOct(1, &normal, &outPacked, helpers::SINGLE_RUNNER<Type, 3, 2>);
+    }
+
+    template<typename Type>
+    void Decode(Vector3<Type>& outNormal, const PackedUnitVectorOct& packed)
+    {
+        helpers::DecodeOct(1, &packed, &outNormal, helpers::SINGLE_RUNNER<Type, 2, 3>);
+    }
+
+    template<typename Type>
+    void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<Type>> normals)
+    {
+        ETLMATH_ASSERT(outPacked.size() == normals.size(), "Span size mismatch in Encode");
+        helpers::EncodeOct(normals.size(), normals.data(), outPacked.data(), helpers::BATCH_RUNNER<Type, 3, 2>);
+    }
+
+    template<typename Type>
+    void Decode(std::span<Vector3<Type>> outNormals, std::span<const PackedUnitVectorOct> packed)
+    {
+        ETLMATH_ASSERT(outNormals.size() == packed.size(), "Span size mismatch in Decode");
+        helpers::DecodeOct(packed.size(), packed.data(), outNormals.data(), helpers::BATCH_RUNNER<Type, 2, 3>);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Smallest three quaternion
+
+    template<typename Type>
+    void Encode(PackedQuatSmallest3& outPacked, const Quaternion<Type>& rotation)
+    {
+        helpers::EncodeQuat(1, &rotation, &outPacked, helpers::SINGLE_RUNNER<Type, 4, 3>);
+    }
+
+    template<typename Type>
+    void Decode(Quaternion<Type>& outRotation, const PackedQuatSmallest3& packed)
+    {
+        helpers::DecodeQuat(1, &packed, &outRotation, helpers::SINGLE_RUNNER<Type, 3, 4>);
+    }
+
+    template<typename Type>
+    void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<Type>> rotations)
+    {
+        ETLMATH_ASSERT(outPacked.size() == rotations.size(), "Span size mismatch in Encode");
+        helpers::EncodeQuat(rotations.size(), rotations.data(), outPacked.data(), helpers::BATCH_RUNNER<Type, 4, 3>);
+    }
+
+    template<typename Type>
+    void Decode(std::span<Quaternion<Type>> outRotations, std::span<const PackedQuatSmallest3> packed)
+    {
+        ETLMATH_ASSERT(outRotations.size() == packed.size(), "Span size mismatch in Decode");
+        helpers::DecodeQuat(packed.size(), packed.data(), outRotations.data(), helpers::BATCH_RUNNER<Type, 3, 4>);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Range quantized position
+
+    /// <summary>
+    /// Component-wise bounds of 'positions'
+    /// </summary>
+    template<typename Type>
+    QuantizationRange<Type> ComputeQuantizationRange(std::span<const Vector3<Type>> positions)
+    {
+        QuantizationRange<Type> range{ Vector3<Type>{ Type(0) }, Vector3<Type>{ Type(0) } };
+        if (positions.empty())
+            return range;
+
+        range.min = positions[0];
+        range.max = positions[0];
+        for (const Vector3<Type>& position : positions)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                range.min.setRawValue(i, std::min(range.min.getRawValue(i), position.getRawValue(i)));
+                range.max.setRawValue(i, std::max(range.max.getRawValue(i), position.getRawValue(i)));
+            }
+        }
+        return range;
+    }
+
+    template<typename Type>
+    void Encode(PackedPosition16& outPacked, const Vector3<Type>& position, const QuantizationRange<Type>& range)
+    {
+        helpers::EncodePositions(1, &position, &outPacked, range, helpers::SINGLE_RUNNER<Type, 3, 3>);
+    }
+
+    template<typename Type>
+    void Decode(Vector3<Type>& outPosition, const PackedPosition16& packed, const QuantizationRange<Type>& range)
+    {
+        helpers::DecodePositions(1, &packed, &outPosition, range, helpers::SINGLE_RUNNER<Type, 3, 3>);
+    }
+
+    template<typename Type>
+    void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<Type>> positions, const QuantizationRange<Type>& range)
+    {
+        ETLMATH_ASSERT(outPacked.size() == positions.size(), "Span size mismatch in Encode");
+        helpers::EncodePositions(positions.size(), positions.data(), outPacked.data(), range, helpers::BATCH_RUNNER<Type, 3, 3>);
+    }
+
+    template<typename Type>
+    void Decode(std::span<Vector3<Type>> outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<Type>& range)
+    {
+        ETLMATH_ASSERT(outPositions.size() == packed.size(), "Span size mismatch in Decode");
+        helpers::DecodePositions(packed.size(), packed.data(), outPositions.data(), range, helpers::BATCH_RUNNER<Type, 3, 3>);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Transform
+
+    /// <summary>
+    /// Decompose (translation, rotation, scale) then pack each part
+    /// </summary>
+    template<typename Type>
+    bool Encode(PackedTransform& outPacked, const Matrix4x4<Type>& mat, const QuantizationRange<Type>& translationRange)
+    {
+        Vector3<Type> translation;
+        for (int row = 0; row < 3; ++row)
+            translation.setRawValue(row, mat.getRawValue(row, 3));
+        Quaternion<Type> rotation;
+        Vector3<Type> scale;
+        const bool decomposed = Decompose(mat, translation, rotation, scale);
+        if (!decomposed)
+            helpers::FallbackFrame(rotation, scale, mat);
+
+        Encode(outPacked.translation, translation, translationRange);
+        Encode(outPacked.rotation, rotation);
+        Encode(outPacked.scale, scale);
+        return decomposed;
+    }
+
+    template<typename Type>
+    void Decode(Matrix4x4<Type>& outMat, const PackedTransform& packed, const QuantizationRange<Type>& translationRange)
+    {
+        Vector3<Type> translation, scale;
+        Quaternion<Type> rotation;
+        Decode(translation, packed.translation, translationRange);
+        Decode(rotation, packed.rotation);
+        Decode(scale, packed.scale);
+        helpers::ComposeTransform(outMat, translation, rotation, scale);
+    }
+
+
+    /// <summary>
+    /// Batched encode: matrices are decomposed (batched polar decomposition) and packed
+    /// TRANSFORM_CHUNK at a time
+    /// </summary>
+    template<typename Type>
+    bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<Type>> mats, const QuantizationRange<Type>& translationRange)
+    {
+        ETLMATH_ASSERT(outPacked.size() == mats.size(), "Span size mismatch in Encode");
+
+        std::array<Vector3<Type>, helpers::TRANSFORM_CHUNK> translations, scales;
+        std::array<Quaternion<Type>, helpers::TRANSFORM_CHUNK> rotations;
+        std::array<PackedPosition16, helpers::TRANSFORM_CHUNK> packedTranslations;
+        std::array<PackedQuatSmallest3, helpers::TRANSFORM_CHUNK> packedRotations;
+        std::array<PackedVector3Half, helpers::TRANSFORM_CHUNK> packedScales;
+        bool ok[helpers::TRANSFORM_CHUNK];
+
+        bool allDecomposed = true;
+        for (std::size_t first = 0; first < mats.size(); first += helpers::TRANSFORM_CHUNK)
+        {
+            const std::size_t count = std::min(helpers::TRANSFORM_CHUNK, mats.size() - first);
+            for (std::size_t i = 0; i < count; ++i)
+                for (int row = 0; row < 3; ++row)
+                    translations[i].setRawValue(row, mats[first + i].getRawValue(row, 3));
+
+            if (!Decompose(mats.subspan(first, count), std::span{ translations.data(), count }, std::span{ rotations.data(), count },
+                           std::span{ scales.data(), count }, std::span<Matrix3x3<Type>>{}, std::span{ ok, count }))
+            {
+                allDecomposed = false;
+                for (std::size_t i = 0; i < count; ++i)
+                    if (!ok[i])
+                        helpers::FallbackFrame(rotations[i], scales[i], mats[first + i]);
+            }
+
+            Encode(std::span{ packedTranslations.data(), count }, std::span<const Vector3<Type>>{ translations.data(), count }, translationRange);
+            Encode(std::span{ packedRotations.data(), count }, std::span<const Quaternion<Type>>{ rotations.data(), count });
+            Encode(std::span{ packedScales.data(), count }, std::span<const Vector3<Type>>{ scales.data(), count });
+
+            for (std::size_t i = 0; i < count; ++i)
+                outPacked[first + i] = { packedTranslations[i], packedRotations[i], packedScales[i] };
+        }
+        return allDecomposed;
+    }
+
+
+    /// <summary>
+    /// Batched decode: parts are unpacked TRANSFORM_CHUNK at a time then composed
+    /// </summary>
+    template<typename Type>
+    void Decode(std::span<Matrix4x4<Type>> outMats, std::span<const PackedTransform> packed, const QuantizationRange<Type>& translationRange)
+    {
+        ETLMATH_ASSERT(outMats.size() == packed.size(), "Span size mismatch in Decode");
+
+        std::array<Vector3<Type>, helpers::TRANSFORM_CHUNK> translations, scales;
+        std::array<Quaternion<Type>, helpers::TRANSFORM_CHUNK> rotations;
+        std::array<PackedPosition16, helpers::TRANSFORM_CHUNK> packedTranslations;
+        std::array<PackedQuatSmallest3, helpers::TRANSFORM_CHUNK> packedRotations;
+        std::array<PackedVector3Half, helpers::TRANSFORM_CHUNK> packedScales;
+
+        for (std::size_t first = 0; first < packed.size(); first += helpers::TRANSFORM_CHUNK)
+        {
+            const std::size_t count = std::min(helpers::TRANSFORM_CHUNK, packed.size() - first);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                packedTranslations[i] = packed[first + i].translation;
+                packedRotations[i] = packed[first + i].rotation;
+                packedScales[i] = packed[first + i].scale;
+            }
+
+            Decode(std::span{ translations.data(), count }, std::span<const PackedPosition16>{ packedTranslations.data(), count }, translationRange);
+            Decode(std::span{ rotations.data(), count }, std::span<const PackedQuatSmallest3>{ packedRotations.data(), count });
+            Decode(std::span{ scales.data(), count }, std::span<const PackedVector3Half>{ packedScales.data(), count });
+
+            for (std::size_t i = 0; i < count; ++i)
+                helpers::ComposeTransform(outMats[first + i], translations[i], rotations[i], scales[i]);
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template void Encode(PackedVector3Half& outPacked, const Vector3<float>&  vec);
+    template void Encode(PackedVector3Half& outPacked, const Vector3<double>& vec);
+    template void Encode(PackedVector3Half& outPacked, const Vector3<int>&    vec);
+    template void Decode(Vector3<float>&  outVec, const PackedVector3Half& packed);
+    template void Decode(Vector3<double>& outVec, const PackedVector3Half& packed);
+    template void Decode(Vector3<int>&    outVec, const PackedVector3Half& packed);
+    template void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<float>>  vecs);
+    template void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<double>> vecs);
+    template void Encode(std::span<PackedVector3Half> outPacked, std::span<const Vector3<int>>    vecs);
+    template void Decode(std::span<Vector3<float>>  outVecs, std::span<const PackedVector3Half> packed);
+    template void Decode(std::span<Vector3<double>> outVecs, std::span<const PackedVector3Half> packed);
+    template void Decode(std::span<Vector3<int>>    outVecs, std::span<const PackedVector3Half> packed);
+
+    template void Encode(PackedUnitVectorOct& outPacked, const Vector3<float>&  normal);
+    template void Encode(PackedUnitVectorOct& outPacked, const Vector3<double>& normal);
+    template void Encode(PackedUnitVectorOct& outPacked, const Vector3<int>&    normal);
+    template void Decode(Vector3<float>&  outNormal, const PackedUnitVectorOct& packed);
+    template void Decode(Vector3<double>& outNormal, const PackedUnitVectorOct& packed);
+    template void Decode(Vector3<int>&    outNormal, const PackedUnitVectorOct& packed);
+    template void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<float>>  normals);
+    template void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<double>> normals);
+    template void Encode(std::span<PackedUnitVectorOct> outPacked, std::span<const Vector3<int>>    normals);
+    template void Decode(std::span<Vector3<float>>  outNormals, std::span<const PackedUnitVectorOct> packed);
+    template void Decode(std::span<Vector3<double>> outNormals, std::span<const PackedUnitVectorOct> packed);
+    template void Decode(std::span<Vector3<int>>    outNormals, std::span<const PackedUnitVectorOct> packed);
+
+    template void Encode(PackedQuatSmallest3& outPacked, const Quaternion<float>&  rotation);
+    template void Encode(PackedQuatSmallest3& outPacked, const Quaternion<double>& rotation);
+    template void Encode(PackedQuatSmallest3& outPacked, const Quaternion<int>&    rotation);
+    template void Decode(Quaternion<float>&  outRotation, const PackedQuatSmallest3& packed);
+    template void Decode(Quaternion<double>& outRotation, const PackedQuatSmallest3& packed);
+    template void Decode(Quaternion<int>&    outRotation, const PackedQuatSmallest3& packed);
+    template void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<float>>  rotations);
+    template void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<double>> rotations);
+    template void Encode(std::span<PackedQuatSmallest3> outPacked, std::span<const Quaternion<int>>    rotations);
+    template void Decode(std::span<Quaternion<float>>  outRotations, std::span<const PackedQuatSmallest3> packed);
+    template void Decode(std::span<Quaternion<double>> outRotations, std::span<const PackedQuatSmallest3> packed);
+    template void Decode(std::span<Quaternion<int>>    outRotations, std::span<const PackedQuatSmallest3> packed);
+
+    template QuantizationRange<float>  ComputeQuantizationRange(std::span<const Vector3<float>>  positions);
+    template QuantizationRange<double> ComputeQuantizationRange(std::span<const Vector3<double>> positions);
+    template QuantizationRange<int>    ComputeQuantizationRange(std::span<const Vector3<int>>    positions);
+    template void Encode(PackedPosition16& outPacked, const Vector3<float>&  position, const QuantizationRange<float>&  range);
+    template void Encode(PackedPosition16& outPacked, const Vector3<double>& position, const QuantizationRange<double>& range);
+    template void Encode(PackedPosition16& outPacked, const Vector3<int>&    position, const QuantizationRange<int>&    range);
+    template void Decode(Vector3<float>&  outPosition, const PackedPosition16& packed, const QuantizationRange<float>&  range);
+    template void Decode(Vector3<double>& outPosition, const PackedPosition16& packed, const QuantizationRange<double>& range);
+    template void Decode(Vector3<int>&    outPosition, const PackedPosition16& packed, const QuantizationRange<int>&    range);
+    template void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<float>>  positions, const QuantizationRange<float>&  range);
+    template void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<double>> positions, const QuantizationRange<double>& range);
+    template void Encode(std::span<PackedPosition16> outPacked, std::span<const Vector3<int>>    positions, const QuantizationRange<int>&    range);
+    template void Decode(std::span<Vector3<float>>  outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<float>&  range);
+    template void Decode(std::span<Vector3<double>> outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<double>& range);
+    template void Decode(std::span<Vector3<int>>    outPositions, std::span<const PackedPosition16> packed, const QuantizationRange<int>&    range);
+
+    template bool Encode(PackedTransform& outPacked, const Matrix4x4<float>&  mat, const QuantizationRange<float>&  translationRange);
+    template bool Encode(PackedTransform& outPacked, const Matrix4x4<double>& mat, const QuantizationRange<double>& translationRange);
+    template bool Encode(PackedTransform& outPacked, const Matrix4x4<int>&    mat, const QuantizationRange<int>&    translationRange);
+    template void Decode(Matrix4x4<float>&  outMat, const PackedTransform& packed, const QuantizationRange<float>&  translationRange);
+    template void Decode(Matrix4x4<double>& outMat, const PackedTransform& packed, const QuantizationRange<double>& translationRange);
+    template void Decode(Matrix4x4<int>&    outMat, const PackedTransform& packed, const QuantizationRange<int>&    translationRange);
+    template bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<float>>  mats, const QuantizationRange<float>&  translationRange);
+    template bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<double>> mats, const QuantizationRange<double>& translationRange);
+    template bool Encode(std::span<PackedTransform> outPacked, std::span<const Matrix4x4<int>>    mats, const QuantizationRange<int>&    translationRange);
+    template void Decode(std::span<Matrix4x4<float>>  outMats, std::span<const PackedTransform> packed, const QuantizationRange<float>&  translationRange);
+    template void Decode(std::span<Matrix4x4<double>> outMats, std::span<const PackedTransform> packed, const QuantizationRange<double>& translationRange);
+    template void Decode(std::span<Matrix4x4<int>>    outMats, std::span<const PackedTransform> packed, const QuantizationRange<int>&    translationRange);
+
+} /// namespace ETL::Math
@@ -0,0 +1,496 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Gjk.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Geometry/Gjk.h"
+#include "MathLib/Common/Asserts.h"
+#include <limits>
+
+namespace ETL::Math
+{
+    namespace helpers
+    {
+        /// Sub-simplex: the vertices (indices into the simplex) and weights of a closest point
+        template<typename Calc>
+        struct SimplexPart
+        {
+            int  indices[4];
+            Calc weights[4];
+            int  count;
+        };
+
+
+        /// <summary>
+        /// Squared distance from the origin to the point described by 'part'
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="simplex"></param>
+        /// <param name="part"></param>
+        /// <returns></returns>
+        template<typename Calc>
+        Calc PartDistanceSq(const GjkSimplex<Calc>& simplex, const SimplexPart<Calc>& part)
+        {
+            Calc point[3] = {};
+            for (int k = 0; k < part.count; ++k)
+            {
+                for (int i = 0; i < 3; ++i)
+                    point[i] += part.weights[k] * simplex.vertices[part.indices[k]].w[i];
+            }
+            return GjkDot(point, point);
+        }
+
+
+        /// <summary>
+        /// Point of the segment (i0, i1) closest to the origin
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="simplex"></param>
+        /// <param name="i0"></param>
+        /// <param name="i1"></param>
+        /// <returns></returns>
+        template<typename Calc>
+        SimplexPart<Calc> ClosestOnSegment(const GjkSimplex<Calc>& simplex, int i0, int i1)
+        {
+            const Calc (&a)[3] = simplex.vertices[i0].w;
+            Calc ab[3];
+            GjkSubtract(ab, simplex.vertices[i1].w, a);
+
+            const Calc lengthSq = GjkDot(ab, ab);
+            const Calc along = -GjkDot(a, ab);
+            if (along <= Calc(0) || lengthSq <= Calc(0))
+                return { { i0 }, { Calc(1) }, 1 };
+            if (along >= lengthSq)
+                return { { i1 }, { Calc(1) }, 1 };
+
+            const Calc t = along / lengthSq;
+            return { { i0, i1 }, { Calc(1) - t, t }, 2 };
+        }
+
+
+        /// <summary>
+        /// Point of the triangle (i0, i1, i2) closest to the origin, by Voronoi regions
+        /// (Ericson, Real-Time Collision Detection 5.1.5). Degenerate triangles use their closest edge.
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="simplex"></param>
+        /// <param name="i0"></param>
+        /// <param name="i1"></param>
+        /// <param name="i2"></param>
+        /// <returns></returns>
+        template<typename Calc>
+        SimplexPart<Calc> ClosestOnTriangle(const GjkSimplex<Calc>& simplex, int i0, int i1, int i2)
+        {
+            const Calc (&a)[3] = simplex.vertices[i0].w;
+            const Calc (&b)[3] = simplex.vertices[i1].w;
+            const Calc (&c)[3] = simplex.vertices[i2].w;
+
+            Calc ab[3], ac[3];
+            GjkSubtract(ab, b, a);
+            GjkSubtract(ac, c, a);
+
+            const Calc d1 = -GjkDot(ab, a);
+            const Calc d2 = -GjkDot(ac, a);
+            if (d1 <= Calc(0) && d2 <= Calc(0))
+                return { { i0 }, { Calc(1) }, 1 };
+
+            const Calc d3 = -GjkDot(ab, b);
+            const Calc d4 = -GjkDot(ac, b);
+            if (d3 >= Calc(0) && d4 <= d3)
+                return { { i1 }, { Calc(1) }, 1 };
+
+            const Calc vc = d1 * d4 - d3 * d2;
+            if (vc <= Calc(0) && d1 >= Calc(0) && d3 <= Calc(0))
+            {
+                const Calc t = d1 / (d1 - d3);
+                return { { i0, i1 }, { Calc(1) - t, t }, 2 };
+            }
+
+            const Calc d5 = -GjkDot(ab, c);
+            const Calc d6 = -GjkDot(ac, c);
+            if (d6 >= Calc(0) && d5 <= d6)
+                return { { i2 }, { Calc(1) }, 1 };
+
+            const Calc vb = d5 * d2 - d1 * d6;
+            if (vb <= Calc(0) && d2 >= Calc(0) && d6 <= Calc(0))
+            {
+                const Calc t = d2 / (d2 - d6);
+                return { { i0, i2 }, { Calc(1) - t, t }, 2 };
+            }
+
+            const Calc va = d3 * d6 - d5 * d4;
+            if (va <= Calc(0) && d4 - d3 >= Calc(0) && d5 - d6 >= Calc(0))
+            {
+                const Calc t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                return { { i1, i2 }, { Calc(1) - t, t }, 2 };
+            }
+
+            const Calc sum = va + vb + vc;
+            if (!(sum > Calc(0)))
+            {
+                SimplexPart<Calc> best = ClosestOnSegment(simplex, i0, i1);
+                for (const SimplexPart<Calc>& edge : { ClosestOnSegment(simplex, i1, i2), ClosestOnSegment(simplex, i2, i0) })
+                {
+                    if (PartDistanceSq(simplex, edge) < PartDistanceSq(simplex, best))
+                        best = edge;
+                }
+                return best;
+            }
+
+            const Calc v = vb / sum;
+            const Calc w = vc / sum;
+            return { { i0, i1, i2 }, { Calc(1) - v - w, v, w }, 3 };
+        }
+
+
+        /// <summary>
+        /// Point of the tetrahedron closest to the origin. When the origin is in front of one of the faces it is
+        /// the closest point of the faces (all of them: in a flat tetrahedron the signs of the others are noise).
+        /// When it is behind all of them the origin is inside and the weights are its barycentric coordinates.
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="simplex"></param>
+        /// <param name="outInside"></param>
+        /// <returns></returns>
+        template<typename Calc>
+        SimplexPart<Calc> ClosestOnTetrahedron(const GjkSimplex<Calc>& simplex, bool& outInside)
+        {
+            /// Faces and the opposite vertex
+            constexpr int FACES[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+
+            outInside = true;
+            for (const int (&face)[4] : FACES)
+            {
+                const Calc (&a)[3] = simplex.vertices[face[0]].w;
+                Calc ab[3], ac[3], ad[3], normal[3];
+                GjkSubtract(ab, simplex.vertices[face[1]].w, a);
+                GjkSubtract(ac, simplex.vertices[face[2]].w, a);
+                GjkSubtract(ad, simplex.vertices[face[3]].w, a);
+                GjkCross(normal, ab, ac);
+
+                /// Origin and opposite vertex on different sides (a face of a degenerate tetrahedron counts as such)
+                const Calc origin = -GjkDot(a, normal);
+                const Calc opposite = GjkDot(ad, normal);
+                if (opposite > Calc(0) ? origin < Calc(0) : (opposite < Calc(0) ? origin > Calc(0) : true))
+                    outInside = false;
+            }
+
+            if (!outInside)
+            {
+                SimplexPart<Calc> best{};
+                Calc bestSq = std::numeric_limits<Calc>::max();
+                for (const int (&face)[4] : FACES)
+                {
+                    const SimplexPart<Calc> part = ClosestOnTriangle(simplex, face[0], face[1], face[2]);
+                    const Calc distanceSq = PartDistanceSq(simplex, part);
+                    if (distanceSq < bestSq)
+                    {
+                        bestSq = distanceSq;
+                        best = part;
+                    }
+                }
+                return best;
+            }
+
+            /// Barycentric coordinates of the origin from the volumes of the sub-tetrahedra
+            const Calc (&a)[3] = simplex.vertices[0].w;
+            Calc ab[3], ac[3], ad[3], ao[3], cross[3];
+            GjkSubtract(ab, simplex.vertices[1].w, a);
+            GjkSubtract(ac, simplex.vertices[2].w, a);
+            GjkSubtract(ad, simplex.vertices[3].w, a);
+            for (int i = 0; i < 3; ++i)
+                ao[i] = -a[i];
+
+            GjkCross(cross, ac, ad);
+            const Calc volume = GjkDot(ab, cross);
+            const Calc wb = GjkDot(ao, cross) / volume;
+            GjkCross(cross, ao, ad);
+            const Calc wc = GjkDot(ab, cross) / volume;
+            GjkCross(cross, ac, ao);
+            const Calc wd = GjkDot(ab, cross) / volume;
+            return { { 0, 1, 2, 3 }, { Calc(1) - wb - wc - wd, wb, wc, wd }, 4 };
+        }
+
+
+        /// <summary>
+        /// Reduce the simplex to the smallest sub-simplex holding its point closest to the origin
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="simplex"></param>
+        /// <param name="outClosest"></param>
+        /// <returns>True when a tetrahedron encloses the origin</returns>
+        template<typename Calc>
+        bool SolveSimplex(GjkSimplex<Calc>& simplex, Calc (&outClosest)[3])
+        {
+            ETLMATH_ASSERT(simplex.count >= 1 && simplex.count <= 4, "GJK simplex must have 1 to 4 vertices");
+
+            bool inside = false;
+            SimplexPart<Calc> part;
+            switch (simplex.count)
+            {
+            case 1:  part = { { 0 }, { Calc(1) }, 1 };                    break;
+            case 2:  part = ClosestOnSegment(simplex, 0, 1);              break;
+            case 3:  part = ClosestOnTriangle(simplex, 0, 1, 2);          break;
+            default: part = ClosestOnTetrahedron(simplex, inside);        break;
+            }
+
+            GjkVertex<Calc> vertices[4];
+            for (int k = 0; k < part.count; ++k)
+                vertices[k] = simplex.vertices[part.indices[k]];
+            for (int k = 0; k < part.count; ++k)
+            {
+                simplex.vertices[k] = vertices[k];
+                simplex.weights[k] = part.weights[k];
+            }
+            simplex.count = part.count;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                outClosest[i] = Calc(0);
+                for (int k = 0; k < simplex.count; ++k)
+                    outClosest[i] += simplex.weights[k] * simplex.vertices[k].w[i];
+            }
+            return inside;
+        }
+
+
+        ///------------------------------------------------------------------------------------------
+        /// EpaPolytope
+
+        /// <summary>
+        /// Polytope of the tetrahedron, faces wound outward
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="tetrahedron"></param>
+        /// <returns>False when it is flat</returns>
+        template<typename Calc>
+        bool EpaPolytope<Calc>::init(const GjkSimplex<Calc>& tetrahedron)
+        {
+            ETLMATH_ASSERT(tetrahedron.count == 4, "EPA starts from a tetrahedron");
+
+            mVertexCount = 4;
+            mFaceCount = 0;
+            mFreeCount = 0;
+            for (int k = 0; k < 4; ++k)
+                mVertices[k] = tetrahedron.vertices[k];
+
+            Calc ab[3], ac[3], ad[3], normal[3];
+            GjkSubtract(ab, mVertices[1].w, mVertices[0].w);
+            GjkSubtract(ac, mVertices[2].w, mVertices[0].w);
+            GjkSubtract(ad, mVertices[3].w, mVertices[0].w);
+            GjkCross(normal, ab, ac);
+            const Calc volume = GjkDot(normal, ad);
+            if (volume == Calc(0))
+                return false;
+
+            /// With a positive volume, (0, 2, 1) faces away from vertex 3 and the others follow
+            if (volume > Calc(0))
+            {
+                addFace(0, 2, 1);
+                addFace(0, 1, 3);
+                addFace(0, 3, 2);
+                addFace(1, 2, 3);
+            }
+            else
+            {
+                addFace(0, 1, 2);
+                addFace(0, 3, 1);
+                addFace(0, 2, 3);
+                addFace(1, 3, 2);
+            }
+            return getClosestFace() >= 0;
+        }
+
+
+        /// <summary>
+        /// Live face closest to the origin, degenerate faces excluded
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <returns></returns>
+        template<typename Calc>
+        int EpaPolytope<Calc>::getClosestFace() const
+        {
+            int best = -1;
+            Calc bestDistance = std::numeric_limits<Calc>::max();
+            for (int f = 0; f < mFaceCount; ++f)
+            {
+                if (mFaces[f].live && mFaces[f].distance < bestDistance)
+                {
+                    bestDistance = mFaces[f].distance;
+                    best = f;
+                }
+            }
+            return best;
+        }
+
+
+        /// <summary>
+        /// Replace the faces 'vertex' sees (always including 'face') by the cone from 'vertex' to their horizon
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="vertex"></param>
+        /// <param name="face"></param>
+        /// <returns>False (polytope unchanged) when out of capacity</returns>
+        template<typename Calc>
+        bool EpaPolytope<Calc>::expand(const GjkVertex<Calc>& vertex, int face)
+        {
+            if (mVertexCount == MAX_VERTICES)
+                return false;
+
+            /// Horizon: the edges of the visible faces not shared by two of them (their twin cancels them)
+            int visible[MAX_FACES];
+            int visibleCount = 0;
+            int horizon[3 * MAX_FACES][2];
+            int horizonCount = 0;
+            for (int f = 0; f < mFaceCount; ++f)
+            {
+                const Face& candidate = mFaces[f];
+                if (!candidate.live)
+                    continue;
+
+                Calc offset[3];
+                GjkSubtract(offset, vertex.w, mVertices[candidate.vertices[0]].w);
+                if (f != face && !(GjkDot(candidate.normal, offset) > Calc(0)))
+                    continue;
+
+                visible[visibleCount++] = f;
+                for (int e = 0; e < 3; ++e)
+                {
+                    const int from = candidate.vertices[e];
+                    const int to = candidate.vertices[(e + 1) % 3];
+
+                    int twin = 0;
+                    while (twin < horizonCount && !(horizon[twin][0] == to && horizon[twin][1] == from))
+                        ++twin;
+
+                    if (twin < horizonCount)
+                    {
+                        horizon[twin][0] = horizon[horizonCount - 1][0];
+                        horizon[twin][1] = horizon[horizonCount - 1][1];
+                        --horizonCount;
+                    }
+                    else
+                    {
+                        horizon[horizonCount][0] = from;
+                        horizon[horizonCount][1] = to;
+                        ++horizonCount;
+                    }
+                }
+            }
+
+            if (mFaceCount + horizonCount > MAX_FACES + mFreeCount + visibleCount)
+                return false;
+
+            for (int v = 0; v < visibleCount; ++v)
+            {
+                mFaces[visible[v]].live = false;
+                mFreeFaces[mFreeCount++] = visible[v];
+            }
+
+            const int apex = mVertexCount++;
+            mVertices[apex] = vertex;
+            for (int e = 0; e < horizonCount; ++e)
+                addFace(horizon[e][0], horizon[e][1], apex);
+            return true;
+        }
+
+
+        /// <summary>
+        /// Points of A and B interpolated at the projection of the origin on the face
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="outA"></param>
+        /// <param name="outB"></param>
+        /// <param name="face"></param>
+        template<typename Calc>
+        void EpaPolytope<Calc>::getContact(Calc (&outA)[3], Calc (&outB)[3], const Face& target) const
+        {
+            const GjkVertex<Calc>& v0 = mVertices[target.vertices[0]];
+            const GjkVertex<Calc>& v1 = mVertices[target.vertices[1]];
+            const GjkVertex<Calc>& v2 = mVertices[target.vertices[2]];
+
+            Calc e1[3], e2[3], p[3];
+            GjkSubtract(e1, v1.w, v0.w);
+            GjkSubtract(e2, v2.w, v0.w);
+            for (int i = 0; i < 3; ++i)
+                p[i] = target.normal[i] * target.distance - v0.w[i];
+
+            const Calc d11 = GjkDot(e1, e1);
+            const Calc d12 = GjkDot(e1, e2);
+            const Calc d22 = GjkDot(e2, e2);
+            const Calc dp1 = GjkDot(p, e1);
+            const Calc dp2 = GjkDot(p, e2);
+            const Calc denominator = d11 * d22 - d12 * d12;
+
+            const Calc w1 = denominator > Calc(0) ? (d22 * dp1 - d12 * dp2) / denominator : Calc(0);
+            const Calc w2 = denominator > Calc(0) ? (d11 * dp2 - d12 * dp1) / denominator : Calc(0);
+            const Calc w0 = Calc(1) - w1 - w2;
+            for (int i = 0; i < 3; ++i)
+            {
+                outA[i] = w0 * v0.a[i] + w1 * v1.a[i] + w2 * v2.a[i];
+                outB[i] = w0 * v0.b[i] + w1 * v1.b[i] + w2 * v2.b[i];
+            }
+        }
+
+
+        /// <summary>
+        /// Add a face in a free slot, with its outward normal and distance (degenerate faces stay in the topology but are never closest nor visible)
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="v0"></param>
+        /// <param name="v1"></param>
+        /// <param name="v2"></param>
+        template<typename Calc>
+        void EpaPolytope<Calc>::addFace(int v0, int v1, int v2)
+        {
+            Face& face = mFaces[mFreeCount > 0 ? mFreeFaces[--mFreeCount] : mFaceCount++];
+            face.vertices[0] = v0;
+            face.vertices[1] = v1;
+            face.vertices[2] = v2;
+            face.live = true;
+
+            Calc e1[3], e2[3];
+            GjkSubtract(e1, mVertices[v1].w, mVertices[v0].w);
+            GjkSubtract(e2, mVertices[v2].w, mVertices[v0].w);
+            GjkCross(face.normal, e1, e2);
+
+            const Calc length = std::sqrt(GjkDot(face.normal, face.normal));
+            if (!(length > Calc(0)))
+            {
+                face.distance = std::numeric_limits<Calc>::max();
+                return;
+            }
+
+            for (int i = 0; i < 3; ++i)
+                face.normal[i] /= length;
+            face.distance = GjkDot(face.normal, mVertices[v0].w);
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations
+
+    template void Support(Vector3<float>&  outResult, const Sphere<float>&  sphere, const Vector3<float>&  direction);
+    template void Support(Vector3<double>& outResult, const Sphere<double>& sphere, const Vector3<double>& direction);
+    template void Support(Vector3<int>&    outResult, const Sphere<int>&    sphere, const Vector3<double>& direction);
+
+    template void Support(Vector3<float>&  outResult, const Capsule<float>&  capsule, const Vector3<float>&  direction);
+    template void Support(Vector3<double>& outResult, const Capsule<double>& capsule, const Vector3<double>& direction);
+    template void Support(Vector3<int>&    outResult, const Capsule<int>&    capsule, const Vector3<double>& direction);
+
+    template void Support(Vector3<float>&  outResult, const Obb<float>&  box, const Vector3<float>&  direction);
+    template void Support(Vector3<double>& outResult, const Obb<double>& box, const Vector3<double>& direction);
+    template void Support(Vector3<int>&    outResult, const Obb<int>&    box, const Vector3<double>& direction);
+
+    template void Support(Vector3<float>&  outResult, std::span<const Vector3<float>>  points, const Vector3<float>&  direction);
+    template void Support(Vector3<double>& outResult, std::span<const Vector3<double>> points, const Vector3<double>& direction);
+    template void Support(Vector3<int>&    outResult, std::span<const Vector3<int>>    points, const Vector3<double>& direction);
+
+    template bool helpers::SolveSimplex(helpers::GjkSimplex<float>&  simplex, float  (&outClosest)[3]);
+    template bool helpers::SolveSimplex(helpers::GjkSimplex<double>& simplex, double (&outClosest)[3]);
+
+    template class helpers::EpaPolytope<float>;
+    template class helpers::EpaPolytope<double>;
+
+} /// namespace ETL::Math
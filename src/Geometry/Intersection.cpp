@@ -0,0 +1,174 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Intersection.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Geometry/Intersection.h"
+#include "MathLib/Common/SimdPack.h"
+
+namespace ETL::Math
+{
+
+    /// <summary>
+    /// Packet ray-triangle intersection (Möller–Trumbore, two-sided).
+    /// Same math as the single ray version, one ray per SIMD lane, triangle broadcast.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <typeparam name="Width"></typeparam>
+    /// <param name="outHit"></param>
+    /// <param name="rays"></param>
+    /// <param name="v0"></param>
+    /// <param name="v1"></param>
+    /// <param name="v2"></param>
+    /// <returns>Bit mask of the lanes that hit</returns>
+    template<typename Type, int Width>
+    int IntersectRayTriangle(RayPacketHit<Type, Width>& outHit, const RayPacket<Type, Width>& rays,
+                             const Vector3<Type>& v0, const Vector3<Type>& v1, const Vector3<Type>& v2)
+    {
+        using Pack = Simd::Pack<Type, Width>;
+
+        const Type p0[3] = { v0.getRawValue(0), v0.getRawValue(1), v0.getRawValue(2) };
+        const Type e1[3] = { v1.getRawValue(0) - p0[0], v1.getRawValue(1) - p0[1], v1.getRawValue(2) - p0[2] };
+        const Type e2[3] = { v2.getRawValue(0) - p0[0], v2.getRawValue(1) - p0[1], v2.getRawValue(2) - p0[2] };
+
+        const Pack e1x = Pack::Broadcast(e1[0]), e1y = Pack::Broadcast(e1[1]), e1z = Pack::Broadcast(e1[2]);
+        const Pack e2x = Pack::Broadcast(e2[0]), e2y = Pack::Broadcast(e2[1]), e2z = Pack::Broadcast(e2[2]);
+
+        const Pack dx = Pack::Load(rays.dirX), dy = Pack::Load(rays.dirY), dz = Pack::Load(rays.dirZ);
+
+        /// p = d x e2, det = e1 . p
+        const Pack px = dy * e2z - dz * e2y;
+        const Pack py = dz * e2x - dx * e2z;
+        const Pack pz = dx * e2y - dy * e2x;
+        const Pack det = e1x * px + e1y * py + e1z * pz;
+
+        /// Parallel test relative to the edge and ray lengths (see single ray version)
+        const Type eps = static_cast<Type>(Epsilon<Type>::value);
+        const Pack e1LengthSq = Pack::Broadcast(e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2]);
+        const Pack pLengthSq = px * px + py * py + pz * pz;
+        const auto valid = (det * det) > (Pack::Broadcast(eps * eps) * e1LengthSq * pLengthSq);
+
+        const Pack invDet = Pack::Broadcast(Type(1)) / det;
+
+        const Pack sx = Pack::Load(rays.originX) - Pack::Broadcast(p0[0]);
+        const Pack sy = Pack::Load(rays.originY) - Pack::Broadcast(p0[1]);
+        const Pack sz = Pack::Load(rays.originZ) - Pack::Broadcast(p0[2]);
+
+        const Pack u = (sx * px + sy * py + sz * pz) * invDet;
+
+        /// q = s x e1
+        const Pack qx = sy * e1z - sz * e1y;
+        const Pack qy = sz * e1x - sx * e1z;
+        const Pack qz = sx * e1y - sy * e1x;
+
+        const Pack v = (dx * qx + dy * qy + dz * qz) * invDet;
+        const Pack t = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+
+        const Pack zero = Pack::Zero();
+        const Pack one = Pack::Broadcast(Type(1));
+        const auto hit = valid
+                       & (u >= zero) & (v >= zero) & ((u + v) <= one)
+                       & (t >= zero) & (t <= Pack::Load(rays.tMax));
+
+        const int mask = Simd::MoveMask(hit);
+        if (mask != 0)
+        {
+            Simd::Select(hit, t, Pack::Load(outHit.t)).store(outHit.t);
+            Simd::Select(hit, u, Pack::Load(outHit.u)).store(outHit.u);
+            Simd::Select(hit, v, Pack::Load(outHit.v)).store(outHit.v);
+        }
+
+        return mask;
+    }
+
+
+    /// <summary>
+    /// Packet ray-AABB intersection (slab test), using the cached reciprocal directions
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <typeparam name="Width"></typeparam>
+    /// <param name="outTNear"></param>
+    /// <param name="rays"></param>
+    /// <param name="boxMin"></param>
+    /// <param name="boxMax"></param>
+    /// <returns>Bit mask of the lanes that hit</returns>
+    template<typename Type, int Width>
+    int IntersectRayAabb(Type (&outTNear)[Width], const RayPacket<Type, Width>& rays,
+                         const Vector3<Type>& boxMin, const Vector3<Type>& boxMax)
+    {
+        using Pack = Simd::Pack<Type, Width>;
+
+        const Pack ox = Pack::Load(rays.originX), oy = Pack::Load(rays.originY), oz = Pack::Load(rays.originZ);
+        const Pack ix = Pack::Load(rays.invDirX), iy = Pack::Load(rays.invDirY), iz = Pack::Load(rays.invDirZ);
+
+        /// Slab planes relative to the ray origins
+        const Pack lx = Pack::Broadcast(boxMin.getRawValue(0)) - ox, hx = Pack::Broadcast(boxMax.getRawValue(0)) - ox;
+        const Pack ly = Pack::Broadcast(boxMin.getRawValue(1)) - oy, hy = Pack::Broadcast(boxMax.getRawValue(1)) - oy;
+        const Pack lz = Pack::Broadcast(boxMin.getRawValue(2)) - oz, hz = Pack::Broadcast(boxMax.getRawValue(2)) - oz;
+
+        const Pack tx0 = lx * ix, tx1 = hx * ix;
+        const Pack ty0 = ly * iy, ty1 = hy * iy;
+        const Pack tz0 = lz * iz, tz1 = hz * iz;
+
+        Pack nearX = Simd::Min(tx0, tx1), farX = Simd::Max(tx0, tx1);
+        Pack nearY = Simd::Min(ty0, ty1), farY = Simd::Max(ty0, ty1);
+        Pack nearZ = Simd::Min(tz0, tz1), farZ = Simd::Max(tz0, tz1);
+
+        /// Axis-aligned rays (common for gameplay queries): a zero direction component makes
+        /// the slab either infinite (origin between the planes, borders included) or empty.
+        /// Without this, a ray lying exactly on a plane gets 0 * (1/tiny) = 0 as one bound.
+        const Pack zero = Pack::Zero();
+        const Pack dx = Pack::Load(rays.dirX), dy = Pack::Load(rays.dirY), dz = Pack::Load(rays.dirZ);
+        const auto zeroX = dx == zero, zeroY = dy == zero, zeroZ = dz == zero;
+        if (Simd::MoveMask(zeroX | zeroY | zeroZ) != 0)
+        {
+            const Pack inf = Pack::Broadcast(std::numeric_limits<Type>::infinity());
+            const auto insideX = (lx <= zero) & (hx >= zero);
+            const auto insideY = (ly <= zero) & (hy >= zero);
+            const auto insideZ = (lz <= zero) & (hz >= zero);
+
+            nearX = Simd::Select(zeroX, Simd::Select(insideX, -inf, inf), nearX);
+            farX  = Simd::Select(zeroX, Simd::Select(insideX, inf, -inf), farX);
+            nearY = Simd::Select(zeroY, Simd::Select(insideY, -inf, inf), nearY);
+            farY  = Simd::Select(zeroY, Simd::Select(insideY, inf, -inf), farY);
+            nearZ = Simd::Select(zeroZ, Simd::Select(insideZ, -inf, inf), nearZ);
+            farZ  = Simd::Select(zeroZ, Simd::Select(insideZ, inf, -inf), farZ);
+        }
+
+        const Pack tNear = Simd::Max(Simd::Max(nearX, nearY), Simd::Max(nearZ, zero));
+        const Pack tFar  = Simd::Min(Simd::Min(farX, farY), Simd::Min(farZ, Pack::Load(rays.tMax)));
+
+        const auto hit = tNear <= tFar;
+
+        const int mask = Simd::MoveMask(hit);
+        if (mask != 0)
+            Simd::Select(hit, tNear, Pack::Load(outTNear)).store(outTNear);
+
+        return mask;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template bool IntersectRayTriangle(double& outT, const Ray<float>&  ray, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2, double tMax);
+    template bool IntersectRayTriangle(double& outT, const Ray<double>& ray, const Vector3<double>& v0, const Vector3<double>& v1, const Vector3<double>& v2, double tMax);
+    template bool IntersectRayTriangle(double& outT, const Ray<int>&    ray, const Vector3<int>&    v0, const Vector3<int>&    v1, const Vector3<int>&    v2, double tMax);
+
+    template bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<float>&  ray, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2, double tMax);
+    template bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<double>& ray, const Vector3<double>& v0, const Vector3<double>& v1, const Vector3<double>& v2, double tMax);
+    template bool IntersectRayTriangle(double& outT, double& outU, double& outV, const Ray<int>&    ray, const Vector3<int>&    v0, const Vector3<int>&    v1, const Vector3<int>&    v2, double tMax);
+
+    template bool IntersectRayAabb(double& outTNear, const Ray<float>&  ray, const Vector3<float>&  boxMin, const Vector3<float>&  boxMax, double tMax);
+    template bool IntersectRayAabb(double& outTNear, const Ray<double>& ray, const Vector3<double>& boxMin, const Vector3<double>& boxMax, double tMax);
+    template bool IntersectRayAabb(double& outTNear, const Ray<int>&    ray, const Vector3<int>&    boxMin, const Vector3<int>&    boxMax, double tMax);
+
+    template int IntersectRayTriangle(RayPacketHit<float, 4>&  outHit, const RayPacket<float, 4>&  rays, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2);
+    template int IntersectRayTriangle(RayPacketHit<float, 8>&  outHit, const RayPacket<float, 8>&  rays, const Vector3<float>&  v0, const Vector3<float>&  v1, const Vector3<float>&  v2);
+    template int IntersectRayTriangle(RayPacketHit<double, 4>& outHit, const RayPacket<double, 4>& rays, const Vector3<double>& v0, const Vector3<double>& v1, const Vector3<double>& v2);
+
+    template int IntersectRayAabb(float  (&outTNear)[4], const RayPacket<float, 4>&  rays, const Vector3<float>&  boxMin, const Vector3<float>&  boxMax);
+    template int IntersectRayAabb(float  (&outTNear)[8], const RayPacket<float, 8>&  rays, const Vector3<float>&  boxMin, const Vector3<float>&  boxMax);
+    template int IntersectRayAabb(double (&outTNear)[4], const RayPacket<double, 4>& rays, const Vector3<double>& boxMin, const Vector3<double>& boxMax);
+
+} /// namespace ETL::Math
@@ -0,0 +1,586 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Overlap.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Geometry/Overlap.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/SimdPack.h"
+#include "MathLib/Common/TypeComparisons.h"
+#include <algorithm>
+#include <bit>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+    ///
+    /// Kernels are written against Simd::Pack, one pair per lane, on points stored as Pack[3].
+    /// Single queries run them on a one-lane double pack; batches on the widest pack of the lane type.
+
+    namespace helpers
+    {
+        template<typename Pack>
+        inline Pack Dot3(const Pack (&a)[3], const Pack (&b)[3])
+        {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+
+        template<typename Pack>
+        inline Pack DistanceSq3(const Pack (&a)[3], const Pack (&b)[3])
+        {
+            const Pack dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+            return dx * dx + dy * dy + dz * dz;
+        }
+
+        template<typename Pack>
+        inline Pack Clamp01(const Pack& value)
+        {
+            return Simd::Min(Simd::Max(value, Pack::Zero()), Pack::Broadcast(1));
+        }
+
+        /// numerator / denominator where denominator > epsilon, fallback elsewhere (no division by 0 in any lane)
+        template<typename Pack, typename Mask>
+        inline Pack SafeDivide(const Mask& valid, const Pack& numerator, const Pack& denominator, const Pack& fallback)
+        {
+            return Simd::Select(valid, numerator / Simd::Select(valid, denominator, Pack::Broadcast(1)), fallback);
+        }
+
+
+        /// <summary>
+        /// Parameter t in [0, 1] of the point of segment [start, start + dir] closest to 'point'
+        /// </summary>
+        template<typename Pack>
+        inline Pack SegmentParameter(const Pack (&point)[3], const Pack (&start)[3], const Pack (&dir)[3], const Pack& epsilon)
+        {
+            const Pack offset[3] = { point[0] - start[0], point[1] - start[1], point[2] - start[2] };
+            const Pack lengthSq = Dot3(dir, dir);
+            return Clamp01(SafeDivide(lengthSq > epsilon, Dot3(offset, dir), lengthSq, Pack::Zero()));
+        }
+
+
+        /// <summary>
+        /// Closest points parameters (s on segment 1, t on segment 2), branch-free version of the
+        /// classic clamped solution: unconstrained s, t from s, then s recomputed when t is clamped.
+        /// Degenerate segments (points) and parallel segments are resolved per lane through selects.
+        /// </summary>
+        template<typename Pack>
+        inline void SegmentSegmentParameters(Pack& outS, Pack& outT,
+                                             const Pack (&start1)[3], const Pack (&dir1)[3],
+                                             const Pack (&start2)[3], const Pack (&dir2)[3], const Pack& epsilon)
+        {
+            const Pack r[3] = { start1[0] - start2[0], start1[1] - start2[1], start1[2] - start2[2] };
+            const Pack a = Dot3(dir1, dir1);
+            const Pack e = Dot3(dir2, dir2);
+            const Pack b = Dot3(dir1, dir2);
+            const Pack c = Dot3(dir1, r);
+            const Pack f = Dot3(dir2, r);
+
+            const Pack zero = Pack::Zero();
+            const auto validA = a > epsilon;
+            const auto validE = e > epsilon;
+
+            /// Non parallel: s from the unconstrained minimum, clamped (parallel: any s, 0 is used)
+            const Pack denominator = a * e - b * b;
+            const Pack s = Clamp01(SafeDivide(denominator > epsilon * a * e, b * f - c * e, denominator, zero));
+
+            /// t for that s, then s again if t had to be clamped
+            const Pack t = SafeDivide(validE, b * s + f, e, zero);
+            const Pack sAtStart = Clamp01(SafeDivide(validA, -c, a, zero));
+            const Pack sAtEnd = Clamp01(SafeDivide(validA, b - c, a, zero));
+
+            Pack resultS = Simd::Select(t < zero, sAtStart, Simd::Select(t > Pack::Broadcast(1), sAtEnd, s));
+            Pack resultT = Clamp01(t);
+
+            /// Segment 2 is a point: t = 0, s = closest to it
+            resultS = Simd::Select(validE, resultS, sAtStart);
+            resultT = Simd::Select(validE, resultT, zero);
+
+            /// Segment 1 is a point: s = 0, t = closest to it
+            resultT = Simd::Select(validA, resultT, Clamp01(SafeDivide(validE, f, e, zero)));
+            resultS = Simd::Select(validA, resultS, zero);
+
+            outS = resultS;
+            outT = resultT;
+        }
+
+
+        ///------------------------------------------------------------------------------------------
+        /// Overlap kernels
+
+        template<typename Pack>
+        inline auto SphereSphereKernel(const Pack (&centerA)[3], const Pack& radiusA, const Pack (&centerB)[3], const Pack& radiusB)
+        {
+            const Pack radius = radiusA + radiusB;
+            return DistanceSq3(centerA, centerB) <= radius * radius;
+        }
+
+        template<typename Pack>
+        inline auto SphereCapsuleKernel(const Pack (&center)[3], const Pack& radius,
+                                        const Pack (&start)[3], const Pack (&end)[3], const Pack& capsuleRadius, const Pack& epsilon)
+        {
+            const Pack dir[3] = { end[0] - start[0], end[1] - start[1], end[2] - start[2] };
+            const Pack t = SegmentParameter(center, start, dir, epsilon);
+            const Pack closest[3] = { start[0] + dir[0] * t, start[1] + dir[1] * t, start[2] + dir[2] * t };
+
+            const Pack sum = radius + capsuleRadius;
+            return DistanceSq3(center, closest) <= sum * sum;
+        }
+
+        template<typename Pack>
+        inline auto CapsuleCapsuleKernel(const Pack (&startA)[3], const Pack (&endA)[3], const Pack& radiusA,
+                                         const Pack (&startB)[3], const Pack (&endB)[3], const Pack& radiusB, const Pack& epsilon)
+        {
+            const Pack dirA[3] = { endA[0] - startA[0], endA[1] - startA[1], endA[2] - startA[2] };
+            const Pack dirB[3] = { endB[0] - startB[0], endB[1] - startB[1], endB[2] - startB[2] };
+
+            Pack s, t;
+            SegmentSegmentParameters(s, t, startA, dirA, startB, dirB, epsilon);
+
+            const Pack onA[3] = { startA[0] + dirA[0] * s, startA[1] + dirA[1] * s, startA[2] + dirA[2] * s };
+            const Pack onB[3] = { startB[0] + dirB[0] * t, startB[1] + dirB[1] * t, startB[2] + dirB[2] * t };
+
+            const Pack sum = radiusA + radiusB;
+            return DistanceSq3(onA, onB) <= sum * sum;
+        }
+
+
+        /// <summary>
+        /// OBB-OBB separating axis test: 3 + 3 face axes and 9 edge cross products, expressed in A's frame
+        /// (R[i][j] = Ai . Bj). 'bias' is added to |R| so near parallel edges do not produce degenerate
+        /// cross axes. Every axis is evaluated (no early out across lanes).
+        /// </summary>
+        template<typename Pack>
+        inline auto ObbObbKernel(const Pack (&centerA)[3], const Pack (&axesA)[3][3], const Pack (&extentA)[3],
+                                 const Pack (&centerB)[3], const Pack (&axesB)[3][3], const Pack (&extentB)[3], const Pack& bias)
+        {
+            Pack rot[3][3], absRot[3][3];
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    rot[i][j] = Dot3(axesA[i], axesB[j]);
+                    absRot[i][j] = Simd::Abs(rot[i][j]) + bias;
+                }
+            }
+
+            const Pack offset[3] = { centerB[0] - centerA[0], centerB[1] - centerA[1], centerB[2] - centerA[2] };
+            const Pack t[3] = { Dot3(offset, axesA[0]), Dot3(offset, axesA[1]), Dot3(offset, axesA[2]) };
+
+            /// Axes of A
+            auto separated = Simd::Abs(t[0]) > extentA[0] + extentB[0] * absRot[0][0] + extentB[1] * absRot[0][1] + extentB[2] * absRot[0][2];
+            for (int i = 1; i < 3; ++i)
+                separated = separated | (Simd::Abs(t[i]) > extentA[i] + extentB[0] * absRot[i][0] + extentB[1] * absRot[i][1] + extentB[2] * absRot[i][2]);
+
+            /// Axes of B
+            for (int j = 0; j < 3; ++j)
+            {
+                const Pack distance = Simd::Abs(t[0] * rot[0][j] + t[1] * rot[1][j] + t[2] * rot[2][j]);
+                separated = separated | (distance > extentA[0] * absRot[0][j] + extentA[1] * absRot[1][j] + extentA[2] * absRot[2][j] + extentB[j]);
+            }
+
+            /// Ai x Bj
+            for (int i = 0; i < 3; ++i)
+            {
+                const int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+                for (int j = 0; j < 3; ++j)
+                {
+                    const int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+                    const Pack ra = extentA[i1] * absRot[i2][j] + extentA[i2] * absRot[i1][j];
+                    const Pack rb = extentB[j1] * absRot[i][j2] + extentB[j2] * absRot[i][j1];
+                    const Pack distance = Simd::Abs(t[i2] * rot[i1][j] - t[i1] * rot[i2][j]);
+                    separated = separated | (distance > ra + rb);
+                }
+            }
+
+            return !separated;
+        }
+
+
+        ///------------------------------------------------------------------------------------------
+        /// Loaders
+
+        /// Single query lane (decoded to double)
+        using SinglePack = Simd::Pack<double, 1>;
+
+        template<typename Type>
+        inline void LoadSingle(SinglePack (&outPoint)[3], const Vector3<Type>& vec)
+        {
+            for (int i = 0; i < 3; ++i)
+                outPoint[i] = SinglePack::Broadcast(DecodeValue<double>(vec.getRawValue(i)));
+        }
+
+        template<typename Type>
+        inline void LoadSingle(SinglePack (&outAxes)[3][3], const Matrix3x3<Type>& rotation)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+                for (int i = 0; i < 3; ++i)
+                    outAxes[axis][i] = SinglePack::Broadcast(DecodeValue<double>(rotation.getRawValue(i, axis)));
+        }
+
+        /// Width lanes of a SoA component from 'first' (the tail is zero padded)
+        template<typename Type, int Width>
+        inline void LoadLanes(Simd::Pack<Type, Width>& outPack, std::span<const Type> component, std::size_t first, int count)
+        {
+            if (count == Width)
+            {
+                outPack = Simd::Pack<Type, Width>::Load(component.data() + first);
+                return;
+            }
+
+            alignas(32) Type lanes[Width] = {};
+            for (int lane = 0; lane < count; ++lane)
+                lanes[lane] = component[first + lane];
+            outPack = Simd::Pack<Type, Width>::Load(lanes);
+        }
+
+        template<typename Type, int Width>
+        inline void LoadLanes(Simd::Pack<Type, Width> (&outPoint)[3], const std::span<const Type> (&components)[3], std::size_t first, int count)
+        {
+            for (int i = 0; i < 3; ++i)
+                LoadLanes(outPoint[i], components[i], first, count);
+        }
+
+
+        /// <summary>
+        /// Batch driver: kernel(first, count) returns the overlap bit mask of pairs [first, first + count)
+        /// </summary>
+        template<int WIDTH, typename Kernel>
+        std::size_t RunOverlapBatch(std::span<bool> outOverlap, std::size_t size, Kernel&& kernel)
+        {
+            ETLMATH_ASSERT(outOverlap.size() >= size, "Overlap output span too small");
+
+            std::size_t overlapCount = 0;
+            for (std::size_t first = 0; first < size; first += WIDTH)
+            {
+                const int count = static_cast<int>(std::min<std::size_t>(WIDTH, size - first));
+                const unsigned mask = static_cast<unsigned>(kernel(first, count)) & ((1u << count) - 1u);
+
+                for (int lane = 0; lane < count; ++lane)
+                    outOverlap[first + lane] = (mask >> lane) & 1u;
+                overlapCount += static_cast<std::size_t>(std::popcount(mask));
+            }
+            return overlapCount;
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Closest points
+
+    /// <summary>
+    /// Closest pair of points between two segments
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outOnFirst"></param>
+    /// <param name="outOnSecond"></param>
+    /// <param name="start1"></param>
+    /// <param name="end1"></param>
+    /// <param name="start2"></param>
+    /// <param name="end2"></param>
+    template<typename Type>
+    void ClosestPointsSegmentSegment(Vector3<Type>& outOnFirst, Vector3<Type>& outOnSecond,
+                                     const Vector3<Type>& start1, const Vector3<Type>& end1,
+                                     const Vector3<Type>& start2, const Vector3<Type>& end2)
+    {
+        using Pack = helpers::SinglePack;
+
+        Pack p1[3], q1[3], p2[3], q2[3];
+        helpers::LoadSingle(p1, start1);
+        helpers::LoadSingle(q1, end1);
+        helpers::LoadSingle(p2, start2);
+        helpers::LoadSingle(q2, end2);
+
+        const Pack d1[3] = { q1[0] - p1[0], q1[1] - p1[1], q1[2] - p1[2] };
+        const Pack d2[3] = { q2[0] - p2[0], q2[1] - p2[1], q2[2] - p2[2] };
+
+        Pack s, t;
+        helpers::SegmentSegmentParameters(s, t, p1, d1, p2, d2, Pack::Broadcast(Epsilon<Type>::value * Epsilon<Type>::value));
+
+        for (int i = 0; i < 3; ++i)
+        {
+            double onFirst[1], onSecond[1];
+            (p1[i] + d1[i] * s).store(onFirst);
+            (p2[i] + d2[i] * t).store(onSecond);
+            outOnFirst.setRawValue(i, EncodeValue<Type>(onFirst[0]));
+            outOnSecond.setRawValue(i, EncodeValue<Type>(onSecond[0]));
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Overlap tests
+
+    /// <summary>
+    /// Sphere-sphere overlap
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <returns></returns>
+    template<typename Type>
+    bool OverlapSphereSphere(const Sphere<Type>& a, const Sphere<Type>& b)
+    {
+        using Pack = helpers::SinglePack;
+
+        Pack centerA[3], centerB[3];
+        helpers::LoadSingle(centerA, a.getCenter());
+        helpers::LoadSingle(centerB, b.getCenter());
+
+        return Simd::MoveMask(helpers::SphereSphereKernel(centerA, Pack::Broadcast(a.getRadius()), centerB, Pack::Broadcast(b.getRadius()))) != 0;
+    }
+
+
+    /// <summary>
+    /// Sphere-capsule overlap (sphere against the closest point of the capsule segment)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="sphere"></param>
+    /// <param name="capsule"></param>
+    /// <returns></returns>
+    template<typename Type>
+    bool OverlapSphereCapsule(const Sphere<Type>& sphere, const Capsule<Type>& capsule)
+    {
+        using Pack = helpers::SinglePack;
+
+        Pack center[3], start[3], end[3];
+        helpers::LoadSingle(center, sphere.getCenter());
+        helpers::LoadSingle(start, capsule.getStart());
+        helpers::LoadSingle(end, capsule.getEnd());
+
+        const Pack epsilon = Pack::Broadcast(Epsilon<Type>::value * Epsilon<Type>::value);
+        return Simd::MoveMask(helpers::SphereCapsuleKernel(center, Pack::Broadcast(sphere.getRadius()),
+                                                           start, end, Pack::Broadcast(capsule.getRadius()), epsilon)) != 0;
+    }
+
+
+    /// <summary>
+    /// Capsule-capsule overlap (closest points of the two segments)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <returns></returns>
+    template<typename Type>
+    bool OverlapCapsuleCapsule(const Capsule<Type>& a, const Capsule<Type>& b)
+    {
+        using Pack = helpers::SinglePack;
+
+        Pack startA[3], endA[3], startB[3], endB[3];
+        helpers::LoadSingle(startA, a.getStart());
+        helpers::LoadSingle(endA, a.getEnd());
+        helpers::LoadSingle(startB, b.getStart());
+        helpers::LoadSingle(endB, b.getEnd());
+
+        const Pack epsilon = Pack::Broadcast(Epsilon<Type>::value * Epsilon<Type>::value);
+        return Simd::MoveMask(helpers::CapsuleCapsuleKernel(startA, endA, Pack::Broadcast(a.getRadius()),
+                                                            startB, endB, Pack::Broadcast(b.getRadius()), epsilon)) != 0;
+    }
+
+
+    /// <summary>
+    /// OBB-OBB overlap (separating axis test)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <returns></returns>
+    template<typename Type>
+    bool OverlapObbObb(const Obb<Type>& a, const Obb<Type>& b)
+    {
+        using Pack = helpers::SinglePack;
+
+        Pack centerA[3], axesA[3][3], extentA[3], centerB[3], axesB[3][3], extentB[3];
+        helpers::LoadSingle(centerA, a.getCenter());
+        helpers::LoadSingle(axesA, a.getRotation());
+        helpers::LoadSingle(extentA, a.getHalfExtents());
+        helpers::LoadSingle(centerB, b.getCenter());
+        helpers::LoadSingle(axesB, b.getRotation());
+        helpers::LoadSingle(extentB, b.getHalfExtents());
+
+        return Simd::MoveMask(helpers::ObbObbKernel(centerA, axesA, extentA, centerB, axesB, extentB, Pack::Broadcast(Epsilon<Type>::value))) != 0;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Batched overlap tests
+
+    /// <summary>
+    /// Batched sphere-sphere overlap
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outOverlap"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <returns>Number of overlapping pairs</returns>
+    template<typename Type>
+    std::size_t OverlapSphereSphere(std::span<bool> outOverlap, const SphereSoA<Type>& a, const SphereSoA<Type>& b)
+    {
+        constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+        using Pack = Simd::Pack<Type, WIDTH>;
+
+        ETLMATH_ASSERT(a.size() == b.size(), "SoA size mismatch in OverlapSphereSphere");
+
+        return helpers::RunOverlapBatch<WIDTH>(outOverlap, a.size(), [&](std::size_t first, int count)
+        {
+            Pack centerA[3], radiusA, centerB[3], radiusB;
+            helpers::LoadLanes(centerA, a.center, first, count);
+            helpers::LoadLanes(radiusA, a.radius, first, count);
+            helpers::LoadLanes(centerB, b.center, first, count);
+            helpers::LoadLanes(radiusB, b.radius, first, count);
+
+            return Simd::MoveMask(helpers::SphereSphereKernel(centerA, radiusA, centerB, radiusB));
+        });
+    }
+
+
+    /// <summary>
+    /// Batched sphere-capsule overlap
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outOverlap"></param>
+    /// <param name="spheres"></param>
+    /// <param name="capsules"></param>
+    /// <returns>Number of overlapping pairs</returns>
+    template<typename Type>
+    std::size_t OverlapSphereCapsule(std::span<bool> outOverlap, const SphereSoA<Type>& spheres, const CapsuleSoA<Type>& capsules)
+    {
+        constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+        using Pack = Simd::Pack<Type, WIDTH>;
+
+        ETLMATH_ASSERT(spheres.size() == capsules.size(), "SoA size mismatch in OverlapSphereCapsule");
+
+        const Pack epsilon = Pack::Broadcast(static_cast<Type>(Epsilon<Type>::value * Epsilon<Type>::value));
+        return helpers::RunOverlapBatch<WIDTH>(outOverlap, spheres.size(), [&](std::size_t first, int count)
+        {
+            Pack center[3], radius, start[3], end[3], capsuleRadius;
+            helpers::LoadLanes(center, spheres.center, first, count);
+            helpers::LoadLanes(radius, spheres.radius, first, count);
+            helpers::LoadLanes(start, capsules.start, first, count);
+            helpers::LoadLanes(end, capsules.end, first, count);
+            helpers::LoadLanes(capsuleRadius, capsules.radius, first, count);
+
+            return Simd::MoveMask(helpers::SphereCapsuleKernel(center, radius, start, end, capsuleRadius, epsilon));
+        });
+    }
+
+
+    /// <summary>
+    /// Batched capsule-capsule overlap
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outOverlap"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <returns>Number of overlapping pairs</returns>
+    template<typename Type>
+    std::size_t OverlapCapsuleCapsule(std::span<bool> outOverlap, const CapsuleSoA<Type>& a, const CapsuleSoA<Type>& b)
+    {
+        constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+        using Pack = Simd::Pack<Type, WIDTH>;
+
+        ETLMATH_ASSERT(a.size() == b.size(), "SoA size mismatch in OverlapCapsuleCapsule");
+
+        const Pack epsilon = Pack::Broadcast(static_cast<Type>(Epsilon<Type>::value * Epsilon<Type>::value));
+        return helpers::RunOverlapBatch<WIDTH>(outOverlap, a.size(), [&](std::size_t first, int count)
+        {
+            Pack startA[3], endA[3], radiusA, startB[3], endB[3], radiusB;
+            helpers::LoadLanes(startA, a.start, first, count);
+            helpers::LoadLanes(endA, a.end, first, count);
+            helpers::LoadLanes(radiusA, a.radius, first, count);
+            helpers::LoadLanes(startB, b.start, first, count);
+            helpers::LoadLanes(endB, b.end, first, count);
+            helpers::LoadLanes(radiusB, b.radius, first, count);
+
+            return Simd::MoveMask(helpers::CapsuleCapsuleKernel(startA, endA, radiusA, startB, endB, radiusB, epsilon));
+        });
+    }
+
+
+    /// <summary>
+    /// Batched OBB-OBB overlap
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outOverlap"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    /// <returns>Number of overlapping pairs</returns>
+    template<typename Type>
+    std::size_t OverlapObbObb(std::span<bool> outOverlap, const ObbSoA<Type>& a, const ObbSoA<Type>& b)
+    {
+        constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+        using Pack = Simd::Pack<Type, WIDTH>;
+
+        ETLMATH_ASSERT(a.size() == b.size(), "SoA size mismatch in OverlapObbObb");
+
+        const Pack bias = Pack::Broadcast(static_cast<Type>(Epsilon<Type>::value));
+        return helpers::RunOverlapBatch<WIDTH>(outOverlap, a.size(), [&](std::size_t first, int count)
+        {
+            Pack centerA[3], axesA[3][3], extentA[3], centerB[3], axesB[3][3], extentB[3];
+            helpers::LoadLanes(centerA, a.center, first, count);
+            helpers::LoadLanes(extentA, a.halfExtents, first, count);
+            helpers::LoadLanes(centerB, b.center, first, count);
+            helpers::LoadLanes(extentB, b.halfExtents, first, count);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                helpers::LoadLanes(axesA[axis], a.axes[axis], first, count);
+                helpers::LoadLanes(axesB[axis], b.axes[axis], first, count);
+            }
+
+            return Simd::MoveMask(helpers::ObbObbKernel(centerA, axesA, extentA, centerB, axesB, extentB, bias));
+        });
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template void ClosestPointOnSegment(Vector3<float>&  outResult, const Vector3<float>&  start, const Vector3<float>&  end, const Vector3<float>&  point);
+    template void ClosestPointOnSegment(Vector3<double>& outResult, const Vector3<double>& start, const Vector3<double>& end, const Vector3<double>& point);
+    template void ClosestPointOnSegment(Vector3<int>&    outResult, const Vector3<int>&    start, const Vector3<int>&    end, const Vector3<int>&    point);
+
+    template void ClosestPointsSegmentSegment(Vector3<float>&  outOnFirst, Vector3<float>&  outOnSecond, const Vector3<float>&  start1, const Vector3<float>&  end1, const Vector3<float>&  start2, const Vector3<float>&  end2);
+    template void ClosestPointsSegmentSegment(Vector3<double>& outOnFirst, Vector3<double>& outOnSecond, const Vector3<double>& start1, const Vector3<double>& end1, const Vector3<double>& start2, const Vector3<double>& end2);
+    template void ClosestPointsSegmentSegment(Vector3<int>&    outOnFirst, Vector3<int>&    outOnSecond, const Vector3<int>&    start1, const Vector3<int>&    end1, const Vector3<int>&    start2, const Vector3<int>&    end2);
+
+    template void ClosestPoint(Vector3<float>&  outResult, const Sphere<float>&  sphere, const Vector3<float>&  point);
+    template void ClosestPoint(Vector3<double>& outResult, const Sphere<double>& sphere, const Vector3<double>& point);
+    template void ClosestPoint(Vector3<int>&    outResult, const Sphere<int>&    sphere, const Vector3<int>&    point);
+
+    template void ClosestPoint(Vector3<float>&  outResult, const Capsule<float>&  capsule, const Vector3<float>&  point);
+    template void ClosestPoint(Vector3<double>& outResult, const Capsule<double>& capsule, const Vector3<double>& point);
+    template void ClosestPoint(Vector3<int>&    outResult, const Capsule<int>&    capsule, const Vector3<int>&    point);
+
+    template void ClosestPoint(Vector3<float>&  outResult, const Obb<float>&  box, const Vector3<float>&  point);
+    template void ClosestPoint(Vector3<double>& outResult, const Obb<double>& box, const Vector3<double>& point);
+    template void ClosestPoint(Vector3<int>&    outResult, const Obb<int>&    box, const Vector3<int>&    point);
+
+    template bool OverlapSphereSphere(const Sphere<float>&  a, const Sphere<float>&  b);
+    template bool OverlapSphereSphere(const Sphere<double>& a, const Sphere<double>& b);
+    template bool OverlapSphereSphere(const Sphere<int>&    a, const Sphere<int>&    b);
+
+    template bool OverlapSphereCapsule(const Sphere<float>&  sphere, const Capsule<float>&  capsule);
+    template bool OverlapSphereCapsule(const Sphere<double>& sphere, const Capsule<double>& capsule);
+    template bool OverlapSphereCapsule(const Sphere<int>&    sphere, const Capsule<int>&    capsule);
+
+    template bool OverlapCapsuleCapsule(const Capsule<float>&  a, const Capsule<float>&  b);
+    template bool OverlapCapsuleCapsule(const Capsule<double>& a, const Capsule<double>& b);
+    template bool OverlapCapsuleCapsule(const Capsule<int>&    a, const Capsule<int>&    b);
+
+    template bool OverlapObbObb(const Obb<float>&  a, const Obb<float>&  b);
+    template bool OverlapObbObb(const Obb<double>& a, const Obb<double>& b);
+    template bool OverlapObbObb(const Obb<int>&    a, const Obb<int>&    b);
+
+    template std::size_t OverlapSphereSphere(std::span<bool> outOverlap, const SphereSoA<float>&  a, const SphereSoA<float>&  b);
+    template std::size_t OverlapSphereSphere(std::span<bool> outOverlap, const SphereSoA<double>& a, const SphereSoA<double>& b);
+
+    template std::size_t OverlapSphereCapsule(std::span<bool> outOverlap, const SphereSoA<float>&  spheres, const CapsuleSoA<float>&  capsules);
+    template std::size_t OverlapSphereCapsule(std::span<bool> outOverlap, const SphereSoA<double>& spheres, const CapsuleSoA<double>& capsules);
+
+    template std::size_t OverlapCapsuleCapsule(std::span<bool> outOverlap, const CapsuleSoA<float>&  a, const CapsuleSoA<float>&  b);
+    template std::size_t OverlapCapsuleCapsule(std::span<bool> outOverlap, const CapsuleSoA<double>& a, const CapsuleSoA<double>& b);
+
+    template std::size_t OverlapObbObb(std::span<bool> outOverlap, const ObbSoA<float>&  a, const ObbSoA<float>&  b);
+    template std::size_t OverlapObbObb(std::span<bool> outOverlap, const ObbSoA<double>& a, const ObbSoA<double>& b);
+
+} /// namespace ETL::Math
@@ -0,0 +1,26 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Primitives.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Geometry/Primitives.h"
+
+namespace ETL::Math
+{
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template class Sphere<float>;
+    template class Sphere<double>;
+    template class Sphere<int>;
+
+    template class Capsule<float>;
+    template class Capsule<double>;
+    template class Capsule<int>;
+
+    template class Obb<float>;
+    template class Obb<double>;
+    template class Obb<int>;
+
+} /// namespace ETL::Math
@@ -0,0 +1,22 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Ray.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Geometry/Ray.h"
+
+namespace ETL::Math
+{
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template class Ray<float>;
+    template class Ray<double>;
+    template class Ray<int>;
+
+    template void GetPoint(Vector3<float>&  outResult, const Ray<float>&  ray, double t);
+    template void GetPoint(Vector3<double>& outResult, const Ray<double>& ray, double t);
+    template void GetPoint(Vector3<int>&    outResult, const Ray<int>&    ray, double t);
+
+} /// namespace ETL::Math
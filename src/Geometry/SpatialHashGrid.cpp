@@ -0,0 +1,664 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// SpatialHashGrid.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Geometry/SpatialHashGrid.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/Parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// Below this many points per thread, threading costs more than it saves
+        constexpr std::size_t GRID_MIN_BATCH = 4096;
+
+        constexpr std::size_t GRID_MIN_TABLE_SIZE = 64;
+        constexpr std::size_t GRID_MAX_TABLE_SIZE = std::size_t(1) << 31;
+
+        /// Radius queries spanning up to this many cells visit each bucket once, larger ones check the cell of every hit
+        constexpr int GRID_MAX_QUERY_BUCKETS = 64;
+
+        /// Cell coordinates are clamped to +/- 2^40 (infinite radii, far away points)
+        constexpr double GRID_COORDINATE_LIMIT = 1099511627776.0;
+
+
+        /// <summary>
+        /// floor(value / divisor) for a positive divisor
+        /// </summary>
+        /// <param name="value"></param>
+        /// <param name="divisor"></param>
+        /// <returns></returns>
+        inline std::int64_t FloorDivide(std::int64_t value, std::int64_t divisor)
+        {
+            const std::int64_t quotient = value / divisor;
+            return (value % divisor < 0) ? quotient - 1 : quotient;
+        }
+
+
+        /// Point that changed bucket during an update: leaves slot 'from' of the old array and
+        /// enters 'bucket', before the old slot 'to' (where 'index' sorts in the old bucket)
+        struct GridMove
+        {
+            std::uint32_t from;
+            std::uint32_t fromBucket;
+            std::uint32_t to;
+            std::uint32_t bucket;
+            std::uint32_t index;
+        };
+
+
+        /// <summary>
+        /// Insert (index, distanceSquared) in the list sorted by (distance, index), dropping the last entry when full
+        /// </summary>
+        /// <typeparam name="Calc"></typeparam>
+        /// <param name="indices"></param>
+        /// <param name="distancesSquared"></param>
+        /// <param name="count">Entries in use, updated</param>
+        /// <param name="index"></param>
+        /// <param name="distanceSquared"></param>
+        template<typename Calc>
+        inline void InsertNearest(std::span<std::uint32_t> indices, std::span<Calc> distancesSquared, std::size_t& count,
+                                  std::uint32_t index, Calc distanceSquared)
+        {
+            auto before = [&](std::size_t slot)
+            {
+                return distanceSquared < distancesSquared[slot] || (distanceSquared == distancesSquared[slot] && index < indices[slot]);
+            };
+
+            std::size_t slot = count;
+            if (count == indices.size())
+            {
+                if (!before(count - 1))
+                    return;
+                --slot;
+            }
+            else
+            {
+                ++count;
+            }
+
+            for (; slot > 0 && before(slot - 1); --slot)
+            {
+                indices[slot] = indices[slot - 1];
+                distancesSquared[slot] = distancesSquared[slot - 1];
+            }
+            indices[slot] = index;
+            distancesSquared[slot] = distanceSquared;
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Constructors
+
+    /// <summary>
+    /// Empty grid
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="cellSize">Edge length of the cells, > 0</param>
+    /// <param name="tableSize">Number of buckets (rounded up to a power of two), 0 for twice the point count</param>
+    template<typename Type>
+    SpatialHashGrid<Type>::SpatialHashGrid(double cellSize, std::size_t tableSize /*= 0*/)
+        : mFixedTableSize(tableSize)
+    {
+        setCellSize(cellSize);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Access methods
+
+    /// <summary>
+    /// Change the cell size, the grid is emptied
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="cellSize"></param>
+    template<typename Type>
+    void SpatialHashGrid<Type>::setCellSize(double cellSize)
+    {
+        ETLMATH_ASSERT(cellSize > 0.0, "SpatialHashGrid cell size must be positive");
+
+        mCellSize = cellSize;
+        mInvCellSize = static_cast<Calc>(1.0 / cellSize);
+        mRawCellSize = std::max<std::int64_t>(1, static_cast<std::int64_t>(cellSize * FIXED_ONE));
+        clear();
+    }
+
+
+    /// <summary>
+    /// Points sorted in the bucket of the cell containing 'position'
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="position"></param>
+    /// <returns>Point indices, in increasing order</returns>
+    template<typename Type>
+    std::span<const std::uint32_t> SpatialHashGrid<Type>::getBucket(const Vector3<Type>& position) const
+    {
+        if (mCellStart.empty())
+            return {};
+
+        const std::uint32_t bucket = bucketOf(position);
+        return std::span<const std::uint32_t>{ mSortedIndices }.subspan(mCellStart[bucket], mCellStart[bucket + 1] - mCellStart[bucket]);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Grid methods
+
+    /// <summary>
+    /// Counting sort of the points by bucket: count the points per bucket, prefix sum the counts
+    /// into bucket ends, then scatter every point index to its slot, filling the buckets backwards.
+    /// Single-threaded, scattering from the last point keeps each bucket in increasing index order.
+    /// Multi-threaded, hashing and scattering use relaxed atomic counters and each bucket (a few
+    /// points) is sorted afterwards, so the result does not depend on the thread count.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="positions"></param>
+    /// <param name="numThreads"></param>
+    template<typename Type>
+    void SpatialHashGrid<Type>::build(std::span<const Vector3<Type>> positions, int numThreads /*= 0*/)
+    {
+        ETLMATH_ASSERT(positions.size() < std::numeric_limits<std::uint32_t>::max(), "Too many points for SpatialHashGrid");
+
+        const std::size_t count = positions.size();
+        const std::size_t tableSize = std::clamp(std::bit_ceil(mFixedTableSize != 0 ? mFixedTableSize : 2 * count),
+                                                 helpers::GRID_MIN_TABLE_SIZE, helpers::GRID_MAX_TABLE_SIZE);
+
+        mTableShift = 32 - std::countr_zero(tableSize);
+        mCellStart.assign(tableSize + 1, 0);
+        mCellStart[tableSize] = static_cast<std::uint32_t>(count);
+        mSortedIndices.resize(count);
+        mSortedPositions.resize(count);
+        mPointBuckets.resize(count);
+
+        std::uint32_t* const cellEnd = mCellStart.data();
+        std::uint32_t* const buckets = mPointBuckets.data();
+
+        if (ParallelThreadCount(count, helpers::GRID_MIN_BATCH, numThreads) <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                buckets[i] = bucketOf(positions[i]);
+                ++cellEnd[buckets[i]];
+            }
+
+            std::inclusive_scan(cellEnd, cellEnd + tableSize, cellEnd);
+
+            for (std::size_t i = count; i-- > 0;)
+                mSortedIndices[--cellEnd[buckets[i]]] = static_cast<std::uint32_t>(i);
+        }
+        else
+        {
+            ParallelFor(count, helpers::GRID_MIN_BATCH, numThreads, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    buckets[i] = bucketOf(positions[i]);
+                    std::atomic_ref<std::uint32_t>(cellEnd[buckets[i]]).fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+
+            std::inclusive_scan(cellEnd, cellEnd + tableSize, cellEnd);
+
+            ParallelFor(count, helpers::GRID_MIN_BATCH, numThreads, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const std::uint32_t slot = std::atomic_ref<std::uint32_t>(cellEnd[buckets[i]]).fetch_sub(1, std::memory_order_relaxed) - 1;
+                    mSortedIndices[slot] = static_cast<std::uint32_t>(i);
+                }
+            });
+
+            /// After the scatter, cellEnd[bucket] is the start of the bucket
+            ParallelFor(tableSize, helpers::GRID_MIN_BATCH, numThreads, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t bucket = begin; bucket < end; ++bucket)
+                    std::sort(mSortedIndices.begin() + cellEnd[bucket], mSortedIndices.begin() + cellEnd[bucket + 1]);
+            });
+        }
+
+        ParallelFor(count, helpers::GRID_MIN_BATCH, numThreads, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t slot = begin; slot < end; ++slot)
+                mSortedPositions[slot] = positions[mSortedIndices[slot]];
+        });
+    }
+
+
+    /// <summary>
+    /// Incremental rebuild, same result as build(). Each changed point is found in its old bucket
+    /// (binary search, buckets are sorted by index); when it stays in the bucket only its copied
+    /// position is refreshed. The points changing bucket are removed from the compact array in a
+    /// forward pass and inserted in a backward pass, each moving the slots between two edits as
+    /// one block; then the starts of the buckets between the first and last edit are offset.
+    /// Cost: the changed points, plus block moves and bucket offsets over the span of the edits.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="positions">All the points, as for build()</param>
+    /// <param name="changed">Indices of the points whose position changed since the last build / update</param>
+    /// <param name="numThreads">Used when rebuilding from scratch</param>
+    /// <param name="scratch">Temporary edit lists</param>
+    /// <returns>True when updated incrementally</returns>
+    template<typename Type>
+    bool SpatialHashGrid<Type>::update(std::span<const Vector3<Type>> positions, std::span<const std::uint32_t> changed,
+                                       int numThreads /*= 0*/, FrameArena& scratch /*= GetMathScratch()*/)
+    {
+        const std::size_t count = positions.size();
+        if (mCellStart.empty() || count != size() || changed.size() > count / REBUILD_FRACTION)
+        {
+            build(positions, numThreads);
+            return false;
+        }
+
+        FrameArena::Scope scope(scratch);
+        const std::span<helpers::GridMove> inserts = scratch.allocate<helpers::GridMove>(changed.size());
+        std::size_t moveCount = 0;
+
+        auto findSlot = [this](std::uint32_t bucket, std::uint32_t index)
+        {
+            const auto first = mSortedIndices.begin();
+            return static_cast<std::uint32_t>(std::lower_bound(first + mCellStart[bucket], first + mCellStart[bucket + 1], index) - first);
+        };
+
+        for (const std::uint32_t index : changed)
+        {
+            ETLMATH_ASSERT(index < count, "Changed index out of range in SpatialHashGrid::update");
+
+            const std::uint32_t oldBucket = mPointBuckets[index];
+            const std::uint32_t newBucket = bucketOf(positions[index]);
+            const std::uint32_t slot = findSlot(oldBucket, index);
+            if (newBucket == oldBucket)
+                mSortedPositions[slot] = positions[index];
+            else
+                inserts[moveCount++] = { slot, oldBucket, findSlot(newBucket, index), newBucket, index };
+        }
+
+        if (moveCount == 0)
+            return true;
+
+        /// Same moves, one list in removal order and one in insertion order (both by old slot)
+        std::span<helpers::GridMove> removes = scratch.allocate<helpers::GridMove>(moveCount);
+        std::copy(inserts.begin(), inserts.begin() + moveCount, removes.begin());
+        std::sort(removes.begin(), removes.end(), [](const helpers::GridMove& a, const helpers::GridMove& b) { return a.from < b.from; });
+        std::sort(inserts.begin(), inserts.begin() + moveCount, [](const helpers::GridMove& a, const helpers::GridMove& b)
+        {
+            return a.bucket != b.bucket ? a.bucket < b.bucket : a.index < b.index;
+        });
+
+        /// An index listed twice gives the same move twice (both from the original slots): keep one.
+        /// Duplicates are adjacent in both orders, and the two lists keep the same moves.
+        std::unique(inserts.begin(), inserts.begin() + moveCount, [](const helpers::GridMove& a, const helpers::GridMove& b) { return a.index == b.index; });
+        moveCount = static_cast<std::size_t>(std::unique(removes.begin(), removes.end(), [](const helpers::GridMove& a, const helpers::GridMove& b) { return a.from == b.from; })
+                                             - removes.begin());
+        removes = removes.first(moveCount);
+
+        /// Removal pass, forward: close the gaps left by the moving points
+        std::size_t write = removes.front().from;
+        for (std::size_t r = 0; r < moveCount; ++r)
+        {
+            const std::size_t begin = removes[r].from + 1;
+            const std::size_t end = (r + 1 < moveCount) ? removes[r + 1].from : count;
+            std::move(mSortedIndices.begin() + begin, mSortedIndices.begin() + end, mSortedIndices.begin() + write);
+            std::move(mSortedPositions.begin() + begin, mSortedPositions.begin() + end, mSortedPositions.begin() + write);
+            write += end - begin;
+        }
+
+        /// Insertion pass, backward: open a slot before each target (old slots shifted by the removals before them)
+        std::size_t read = count - moveCount;
+        write = count;
+        std::size_t removed = moveCount;
+        for (std::size_t i = moveCount; i-- > 0;)
+        {
+            const helpers::GridMove& move = inserts[i];
+            while (removed > 0 && removes[removed - 1].from >= move.to)
+                --removed;
+
+            const std::size_t boundary = move.to - removed;
+            std::move_backward(mSortedIndices.begin() + boundary, mSortedIndices.begin() + read, mSortedIndices.begin() + write);
+            std::move_backward(mSortedPositions.begin() + boundary, mSortedPositions.begin() + read, mSortedPositions.begin() + write);
+            write -= read - boundary + 1;
+            read = boundary;
+
+            mSortedIndices[write] = move.index;
+            mSortedPositions[write] = positions[move.index];
+            mPointBuckets[move.index] = move.bucket;
+        }
+        ETLMATH_ASSERT(read == write, "SpatialHashGrid::update lost track of the slots");
+
+        /// A bucket start moves by the insertions minus the removals in the buckets before it
+        const std::uint32_t firstBucket = std::min(removes.front().fromBucket, inserts.front().bucket);
+        const std::uint32_t lastBucket = std::max(removes.back().fromBucket, inserts[moveCount - 1].bucket);
+        std::int64_t offset = 0;
+        std::size_t r = 0, i = 0;
+        for (std::uint32_t bucket = firstBucket + 1; bucket <= lastBucket; ++bucket)
+        {
+            for (; r < moveCount && removes[r].fromBucket < bucket; ++r)
+                --offset;
+            for (; i < moveCount && inserts[i].bucket < bucket; ++i)
+                ++offset;
+            mCellStart[bucket] = static_cast<std::uint32_t>(mCellStart[bucket] + offset);
+        }
+
+        return true;
+    }
+
+
+    /// <summary>
+    /// Remove every point (keeps the memory)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    template<typename Type>
+    void SpatialHashGrid<Type>::clear()
+    {
+        mCellStart.clear();
+        mSortedIndices.clear();
+        mSortedPositions.clear();
+        mPointBuckets.clear();
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Queries
+
+    /// <summary>
+    /// Points within 'radius' of 'center'. The cells overlapping the query box are mapped to their
+    /// buckets and every bucket is scanned once; when the box covers more cells than there are
+    /// points, all points are tested instead.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outIndices"></param>
+    /// <param name="center"></param>
+    /// <param name="radius"></param>
+    /// <returns>The filled front of outIndices</returns>
+    template<typename Type>
+    std::span<std::uint32_t> SpatialHashGrid<Type>::queryRadius(std::span<std::uint32_t> outIndices, const Vector3<Type>& center, double radius) const
+    {
+        std::size_t found = 0;
+        if (empty() || outIndices.empty() || !(radius >= 0.0))
+            return outIndices.first(0);
+
+        const Calc radiusSquared = static_cast<Calc>(radius) * static_cast<Calc>(radius);
+
+        /// Returns true when outIndices is full
+        auto scanSlots = [&](std::uint32_t begin, std::uint32_t end, auto&& accept)
+        {
+            for (std::uint32_t slot = begin; slot < end; ++slot)
+            {
+                if (distanceSquared(mSortedPositions[slot], center) <= radiusSquared && accept(slot))
+                {
+                    outIndices[found++] = mSortedIndices[slot];
+                    if (found == outIndices.size())
+                        return true;
+                }
+            }
+            return false;
+        };
+        auto acceptAll = [](std::uint32_t) { return true; };
+
+        std::int64_t low[3], high[3];
+        cellRange(low, high, center, radius);
+        const double cellCount = double(high[0] - low[0] + 1) * double(high[1] - low[1] + 1) * double(high[2] - low[2] + 1);
+
+        if (cellCount > static_cast<double>(size()))
+        {
+            scanSlots(0, static_cast<std::uint32_t>(size()), acceptAll);
+            return outIndices.first(found);
+        }
+
+        if (cellCount <= helpers::GRID_MAX_QUERY_BUCKETS)
+        {
+            std::uint32_t buckets[helpers::GRID_MAX_QUERY_BUCKETS];
+            int bucketCount = 0;
+            for (std::int64_t z = low[2]; z <= high[2]; ++z)
+                for (std::int64_t y = low[1]; y <= high[1]; ++y)
+                    for (std::int64_t x = low[0]; x <= high[0]; ++x)
+                        buckets[bucketCount++] = bucketOf(x, y, z);
+
+            std::sort(buckets, buckets + bucketCount);
+            bucketCount = static_cast<int>(std::unique(buckets, buckets + bucketCount) - buckets);
+
+            for (int b = 0; b < bucketCount; ++b)
+            {
+                if (scanSlots(mCellStart[buckets[b]], mCellStart[buckets[b] + 1], acceptAll))
+                    break;
+            }
+            return outIndices.first(found);
+        }
+
+        /// Too many cells to remember their buckets: a hit counts only in its own cell
+        for (std::int64_t z = low[2]; z <= high[2]; ++z)
+        {
+            for (std::int64_t y = low[1]; y <= high[1]; ++y)
+            {
+                for (std::int64_t x = low[0]; x <= high[0]; ++x)
+                {
+                    const std::uint32_t bucket = bucketOf(x, y, z);
+                    auto inCell = [&](std::uint32_t slot) { return isInCell(mSortedPositions[slot], x, y, z); };
+                    if (scanSlots(mCellStart[bucket], mCellStart[bucket + 1], inCell))
+                        return outIndices.first(found);
+                }
+            }
+        }
+        return outIndices.first(found);
+    }
+
+
+    /// <summary>
+    /// k nearest points. Cells are visited in rings of growing Chebyshev distance around the cell of
+    /// 'center'; after ring r every unvisited point is at least r * cellSize away, so the search stops
+    /// once the k-th distance is below that. A hit counts only in its own cell (rings share buckets).
+    /// When the rings would cover more cells than there are points, all points are tested instead.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outIndices">k = outIndices.size()</param>
+    /// <param name="outDistancesSquared"></param>
+    /// <param name="center"></param>
+    /// <param name="maxRadius"></param>
+    /// <returns>The filled front of outIndices</returns>
+    template<typename Type>
+    std::span<std::uint32_t> SpatialHashGrid<Type>::queryNearest(std::span<std::uint32_t> outIndices, std::span<Calc> outDistancesSquared,
+                                                                 const Vector3<Type>& center, double maxRadius) const
+    {
+        ETLMATH_ASSERT(outDistancesSquared.size() >= outIndices.size(), "Distance span too small in queryNearest");
+
+        std::size_t found = 0;
+        if (empty() || outIndices.empty() || !(maxRadius >= 0.0))
+            return outIndices.first(0);
+
+        const std::span<Calc> distances = outDistancesSquared.first(outIndices.size());
+        const Calc maxRadiusSquared = static_cast<Calc>(maxRadius) * static_cast<Calc>(maxRadius);
+
+        auto consider = [&](std::uint32_t slot)
+        {
+            const Calc distance = distanceSquared(mSortedPositions[slot], center);
+            if (distance <= maxRadiusSquared)
+                helpers::InsertNearest(outIndices, distances, found, mSortedIndices[slot], distance);
+        };
+
+        std::int64_t low[3], high[3], cell[3];
+        cellRange(low, high, center, maxRadius);
+
+        std::int64_t maxRing = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            cell[i] = cellCoordinate(center.getRawValue(i));
+            maxRing = std::max({ maxRing, cell[i] - low[i], high[i] - cell[i] });
+        }
+
+        const Calc cellSize = std::integral<Type> ? static_cast<Calc>(mRawCellSize) / FIXED_ONE : static_cast<Calc>(mCellSize);
+        for (std::int64_t ring = 0; ring <= maxRing; ++ring)
+        {
+            const double side = double(2 * ring + 1);
+            if (side * side * side > static_cast<double>(size()))
+            {
+                found = 0;
+                for (std::uint32_t slot = 0; slot < size(); ++slot)
+                    consider(slot);
+                break;
+            }
+
+            for (std::int64_t z = std::max(cell[2] - ring, low[2]); z <= std::min(cell[2] + ring, high[2]); ++z)
+            {
+                for (std::int64_t y = std::max(cell[1] - ring, low[1]); y <= std::min(cell[1] + ring, high[1]); ++y)
+                {
+                    /// Inside the ring's faces in z and y, only the two x ends belong to the ring
+                    const bool face = ring == 0 || z == cell[2] - ring || z == cell[2] + ring || y == cell[1] - ring || y == cell[1] + ring;
+                    const std::int64_t step = face ? 1 : 2 * ring;
+                    for (std::int64_t x = cell[0] - ring; x <= cell[0] + ring; x += step)
+                    {
+                        if (x < low[0] || x > high[0])
+                            continue;
+
+                        const std::uint32_t bucket = bucketOf(x, y, z);
+                        for (std::uint32_t slot = mCellStart[bucket]; slot < mCellStart[bucket + 1]; ++slot)
+                        {
+                            if (isInCell(mSortedPositions[slot], x, y, z))
+                                consider(slot);
+                        }
+                    }
+                }
+            }
+
+            const Calc reach = static_cast<Calc>(ring) * cellSize;
+            if (found == outIndices.size() && distances[found - 1] < reach * reach)
+                break;
+        }
+
+        return outIndices.first(found);
+    }
+
+
+    /// <summary>
+    /// k nearest points, distances kept in the scratch arena
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outIndices"></param>
+    /// <param name="center"></param>
+    /// <param name="maxRadius"></param>
+    /// <param name="scratch"></param>
+    /// <returns>The filled front of outIndices</returns>
+    template<typename Type>
+    std::span<std::uint32_t> SpatialHashGrid<Type>::queryNearest(std::span<std::uint32_t> outIndices, const Vector3<Type>& center, double maxRadius,
+                                                                 FrameArena& scratch /*= GetMathScratch()*/) const
+    {
+        FrameArena::Scope scope(scratch);
+        return queryNearest(outIndices, scratch.allocate<Calc>(outIndices.size()), center, maxRadius);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Cells
+
+    /// <summary>
+    /// floor(value / cellSize): integer division of the raw value for fixed point
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="value">Raw value</param>
+    /// <returns></returns>
+    template<typename Type>
+    std::int64_t SpatialHashGrid<Type>::cellCoordinate(Coordinate value) const
+    {
+        if constexpr (std::integral<Type>)
+        {
+            return helpers::FloorDivide(value, mRawCellSize);
+        }
+        else
+        {
+            constexpr Calc LIMIT = static_cast<Calc>(helpers::GRID_COORDINATE_LIMIT);
+            return static_cast<std::int64_t>(std::clamp(std::floor(value * mInvCellSize), -LIMIT, LIMIT));
+        }
+    }
+
+
+    /// <summary>
+    /// Bucket of a cell: spatial hash of the coordinates (Teschner et al.), high bits of a Fibonacci multiply
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="x"></param>
+    /// <param name="y"></param>
+    /// <param name="z"></param>
+    /// <returns></returns>
+    template<typename Type>
+    std::uint32_t SpatialHashGrid<Type>::bucketOf(std::int64_t x, std::int64_t y, std::int64_t z) const
+    {
+        const std::uint32_t hash = (static_cast<std::uint32_t>(x) * 73856093u) ^ (static_cast<std::uint32_t>(y) * 19349663u)
+                                 ^ (static_cast<std::uint32_t>(z) * 83492791u);
+        return (hash * 2654435769u) >> mTableShift;
+    }
+
+
+    template<typename Type>
+    std::uint32_t SpatialHashGrid<Type>::bucketOf(const Vector3<Type>& position) const
+    {
+        return bucketOf(cellCoordinate(position.getRawValue(0)), cellCoordinate(position.getRawValue(1)), cellCoordinate(position.getRawValue(2)));
+    }
+
+
+    template<typename Type>
+    bool SpatialHashGrid<Type>::isInCell(const Vector3<Type>& position, std::int64_t x, std::int64_t y, std::int64_t z) const
+    {
+        return cellCoordinate(position.getRawValue(0)) == x && cellCoordinate(position.getRawValue(1)) == y && cellCoordinate(position.getRawValue(2)) == z;
+    }
+
+
+    /// <summary>
+    /// Cells overlapped by the box of half size 'radius' around 'center' (inclusive bounds)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outLow"></param>
+    /// <param name="outHigh"></param>
+    /// <param name="center"></param>
+    /// <param name="radius"></param>
+    template<typename Type>
+    void SpatialHashGrid<Type>::cellRange(std::int64_t (&outLow)[3], std::int64_t (&outHigh)[3], const Vector3<Type>& center, double radius) const
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            const Coordinate value = center.getRawValue(i);
+            if constexpr (std::integral<Type>)
+            {
+                const std::int64_t rawRadius = static_cast<std::int64_t>(std::min(std::ceil(radius * FIXED_ONE), helpers::GRID_COORDINATE_LIMIT));
+                outLow[i] = cellCoordinate(value - rawRadius);
+                outHigh[i] = cellCoordinate(value + rawRadius);
+            }
+            else
+            {
+                outLow[i] = cellCoordinate(value - static_cast<Type>(radius));
+                outHigh[i] = cellCoordinate(value + static_cast<Type>(radius));
+            }
+        }
+    }
+
+
+    template<typename Type>
+    typename SpatialHashGrid<Type>::Calc SpatialHashGrid<Type>::distanceSquared(const Vector3<Type>& a, const Vector3<Type>& b) const
+    {
+        Calc result = Calc(0);
+        for (int i = 0; i < 3; ++i)
+        {
+            const Calc d = DecodeValue<Calc>(a.getRawValue(i)) - DecodeValue<Calc>(b.getRawValue(i));
+            result += d * d;
+        }
+        return result;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations
+
+    template class SpatialHashGrid<float>;
+    template class SpatialHashGrid<double>;
+    template class SpatialHashGrid<int>;
+
+} /// namespace ETL::Math
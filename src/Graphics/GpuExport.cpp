@@ -0,0 +1,332 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// GpuExport.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Graphics/GpuExport.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/FixedPointHelpers.h"
+#include "MathLib/Common/SimdPack.h"
+#include <concepts>
+#include <cstring>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// One GPU vec4 (a matrix column/row or a padded vector) per pack
+        using GpuPack = Simd::Pack<float, 4>;
+
+        constexpr float GPU_LANE_INDEX[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+
+
+        /// Lanes x, y, z kept, w cleared (padding is always written as 0)
+        inline GpuPack ClearW(const GpuPack& value)
+        {
+            const Simd::Mask<float, 4> xyz = GpuPack::Load(GPU_LANE_INDEX) < GpuPack::Broadcast(3.0f);
+            return Simd::Select(xyz, value, GpuPack::Zero());
+        }
+
+        /// 4 consecutive source scalars as floats (fixed point scaling by 2^-16 is exact)
+        template<typename Type>
+        inline GpuPack LoadAsFloat4(const Type* ptr)
+        {
+            if constexpr (std::same_as<Type, float>)
+            {
+                return GpuPack::Load(ptr);
+            }
+#if defined(ETLMATH_SIMD_AVX)
+            else if constexpr (std::same_as<Type, double>)
+            {
+                return { _mm256_cvtpd_ps(_mm256_loadu_pd(ptr)) };
+            }
+#elif defined(ETLMATH_SIMD_SSE2)
+            else if constexpr (std::same_as<Type, double>)
+            {
+                return { _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(ptr)), _mm_cvtpd_ps(_mm_loadu_pd(ptr + 2))) };
+            }
+#endif
+#if defined(ETLMATH_SIMD_SSE2)
+            else if constexpr (std::same_as<Type, int>)
+            {
+                const __m128 values = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+                return { _mm_mul_ps(values, _mm_set1_ps(1.0f / FIXED_ONE)) };
+            }
+#endif
+            else
+            {
+                float values[4];
+                for (int i = 0; i < 4; ++i)
+                    values[i] = DecodeValue<float>(ptr[i]);
+                return GpuPack::Load(values);
+            }
+        }
+
+        /// 3 consecutive source scalars as floats, w = 0 (never reads past ptr[2])
+        template<typename Type>
+        inline GpuPack LoadAsFloat3(const Type* ptr)
+        {
+#if defined(ETLMATH_SIMD_SSE2)
+            if constexpr (std::same_as<Type, float>)
+            {
+                const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(ptr)));
+                return { _mm_movelh_ps(xy, _mm_load_ss(ptr + 2)) };
+            }
+            else if constexpr (std::same_as<Type, double>)
+            {
+                return { _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(ptr)), _mm_cvtpd_ps(_mm_load_sd(ptr + 2))) };
+            }
+            else if constexpr (std::same_as<Type, int>)
+            {
+                const __m128i xy = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr));
+                const __m128 values = _mm_cvtepi32_ps(_mm_unpacklo_epi64(xy, _mm_cvtsi32_si128(ptr[2])));
+                return { _mm_mul_ps(values, _mm_set1_ps(1.0f / FIXED_ONE)) };
+            }
+            else
+#endif
+            {
+                const float values[4] = { DecodeValue<float>(ptr[0]), DecodeValue<float>(ptr[1]), DecodeValue<float>(ptr[2]), 0.0f };
+                return GpuPack::Load(values);
+            }
+        }
+
+        /// Store x, y, z only (never writes past outPtr[2])
+        inline void Store3(float* outPtr, const GpuPack& value)
+        {
+#if defined(ETLMATH_SIMD_SSE2)
+            _mm_storel_pi(reinterpret_cast<__m64*>(outPtr), value.v);
+            _mm_store_ss(outPtr + 2, _mm_movehl_ps(value.v, value.v));
+#else
+            float values[4];
+            value.store(values);
+            outPtr[0] = values[0];
+            outPtr[1] = values[1];
+            outPtr[2] = values[2];
+#endif
+        }
+
+        /// Flat conversion of 'count' scalars (straight copy for float)
+        template<typename Type>
+        inline void ConvertToFloat(float* outValues, const Type* values, std::size_t count)
+        {
+            if constexpr (std::same_as<Type, float>)
+            {
+                std::memcpy(outValues, values, count * sizeof(float));
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    outValues[i] = DecodeValue<float>(values[i]);
+            }
+        }
+
+        /// Write 'COUNT' x/y/z vectors tightly packed (3 floats each). Full 4-lane stores overlap the
+        /// next vector, which the following store overwrites, only the very last one is narrowed.
+        template<int COUNT>
+        inline void StoreTight3(float* outValues, const GpuPack (&vectors)[COUNT], bool bLast)
+        {
+            for (int i = 0; i < COUNT - 1; ++i)
+                vectors[i].store(outValues + 3 * i);
+
+            if (bLast)
+                Store3(outValues + 3 * (COUNT - 1), vectors[COUNT - 1]);
+            else
+                vectors[COUNT - 1].store(outValues + 3 * (COUNT - 1));
+        }
+
+
+        /// <summary>
+        /// Matrix4x4 kernel, one instantiation per output form so the per-matrix loop is branch free.
+        /// Loads the four columns as vec4 packs, transposes them for row-major and stores 3 or 4 of them.
+        /// </summary>
+        template<typename Type, bool ROW_MAJOR, bool DROP_LAST_ROW, bool TIGHT>
+        void ExportMatrices4x4(float* outValues, const Matrix4x4<Type>* mats, std::size_t count)
+        {
+            constexpr std::size_t STRIDE = (DROP_LAST_ROW && (ROW_MAJOR || TIGHT)) ? 12 : 16;
+
+            for (std::size_t i = 0; i < count; ++i, outValues += STRIDE)
+            {
+                GpuPack cols[4];
+                for (int c = 0; c < 4; ++c)
+                    cols[c] = LoadAsFloat4(mats[i].getRawCol(c));
+
+                if constexpr (ROW_MAJOR)
+                {
+                    /// cols[] now holds the rows, the 4th one (0 0 0 1 for affine matrices) is optional
+                    Simd::Transpose(cols);
+                    for (int r = 0; r < (DROP_LAST_ROW ? 3 : 4); ++r)
+                        cols[r].store(outValues + 4 * r);
+                }
+                else if constexpr (!TIGHT)
+                {
+                    for (int c = 0; c < 4; ++c)
+                        ClearW(cols[c]).store(outValues + 4 * c);
+                }
+                else
+                {
+                    StoreTight3(outValues, cols, i + 1 == count);
+                }
+            }
+        }
+
+
+        /// <summary>
+        /// Matrix3x3 kernel: columns (or rows after a transpose) as padded vec4 or packed vec3.
+        /// The first two columns load 4 scalars (into the next column), the last one exactly 3.
+        /// The 4th pack stays zero, so the transposed rows also get a zero w.
+        /// </summary>
+        template<typename Type, bool ROW_MAJOR, bool TIGHT>
+        void ExportMatrices3x3(float* outValues, const Matrix3x3<Type>* mats, std::size_t count)
+        {
+            constexpr std::size_t STRIDE = TIGHT ? 9 : 12;
+
+            for (std::size_t i = 0; i < count; ++i, outValues += STRIDE)
+            {
+                GpuPack cols[4];
+                cols[0] = ClearW(LoadAsFloat4(mats[i].getRawCol(0)));
+                cols[1] = ClearW(LoadAsFloat4(mats[i].getRawCol(1)));
+                cols[2] = LoadAsFloat3(mats[i].getRawCol(2));
+                cols[3] = GpuPack::Zero();
+
+                if constexpr (ROW_MAJOR)
+                    Simd::Transpose(cols);
+
+                if constexpr (!TIGHT)
+                {
+                    for (int c = 0; c < 3; ++c)
+                        cols[c].store(outValues + 4 * c);
+                }
+                else
+                {
+                    const GpuPack vectors[3] = { cols[0], cols[1], cols[2] };
+                    StoreTight3(outValues, vectors, i + 1 == count);
+                }
+            }
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Matrix4x4
+
+    /// <summary>
+    /// Export Matrix4x4 array. Column-major full matrices are a flat conversion (a copy for float),
+    /// other forms go through the pack kernel.
+    /// </summary>
+    template<typename Type>
+    std::size_t ExportToGpu(std::span<float> outBuffer, std::span<const Matrix4x4<Type>> mats, GpuLayout layout,
+                            GpuMatrixOrder order, bool bDropLastRow)
+    {
+        using namespace helpers;
+        const std::size_t stride = GetGpuFloatCount4x4(layout, order, bDropLastRow);
+        ETLMATH_ASSERT(outBuffer.size() >= mats.size() * stride, "Destination buffer too small in ExportToGpu");
+
+        float* dst = outBuffer.data();
+        const std::size_t count = mats.size();
+
+        if (order == GpuMatrixOrder::ColumnMajor && !bDropLastRow)
+        {
+            static_assert(sizeof(Matrix4x4<Type>) == 16 * sizeof(Type), "Matrix4x4 must be tightly packed");
+            ConvertToFloat(dst, reinterpret_cast<const Type*>(mats.data()), 16 * count);
+            return count * stride;
+        }
+
+        /// Remaining forms: row-major (3 or 4 rows) or column-major without the last row
+        if (order == GpuMatrixOrder::RowMajor && bDropLastRow)
+            ExportMatrices4x4<Type, true, true, false>(dst, mats.data(), count);
+        else if (order == GpuMatrixOrder::RowMajor)
+            ExportMatrices4x4<Type, true, false, false>(dst, mats.data(), count);
+        else if (layout == GpuLayout::Scalar)
+            ExportMatrices4x4<Type, false, true, true>(dst, mats.data(), count);
+        else
+            ExportMatrices4x4<Type, false, true, false>(dst, mats.data(), count);
+        return count * stride;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Matrix3x3
+
+    /// <summary>
+    /// Export Matrix3x3 array. Packed column-major is a flat conversion, other forms go through the pack kernel.
+    /// </summary>
+    template<typename Type>
+    std::size_t ExportToGpu(std::span<float> outBuffer, std::span<const Matrix3x3<Type>> mats, GpuLayout layout, GpuMatrixOrder order)
+    {
+        using namespace helpers;
+        const std::size_t stride = GetGpuFloatCount3x3(layout);
+        ETLMATH_ASSERT(outBuffer.size() >= mats.size() * stride, "Destination buffer too small in ExportToGpu");
+
+        float* dst = outBuffer.data();
+        const std::size_t count = mats.size();
+
+        if (order == GpuMatrixOrder::ColumnMajor && layout == GpuLayout::Scalar)
+        {
+            static_assert(sizeof(Matrix3x3<Type>) == 9 * sizeof(Type), "Matrix3x3 must be tightly packed");
+            ConvertToFloat(dst, reinterpret_cast<const Type*>(mats.data()), 9 * count);
+            return count * stride;
+        }
+
+        if (order == GpuMatrixOrder::RowMajor && layout == GpuLayout::Scalar)
+            ExportMatrices3x3<Type, true, true>(dst, mats.data(), count);
+        else if (order == GpuMatrixOrder::RowMajor)
+            ExportMatrices3x3<Type, true, false>(dst, mats.data(), count);
+        else
+            ExportMatrices3x3<Type, false, false>(dst, mats.data(), count);
+        return count * stride;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Vector3
+
+    /// <summary>
+    /// Export Vector3 array. Padded layouts load 4 floats per vector (x y z and the next x, the last
+    /// vector loads exactly 3) and clear w. Scalar layout is a flat conversion.
+    /// </summary>
+    template<typename Type>
+    std::size_t ExportToGpu(std::span<float> outBuffer, std::span<const Vector3<Type>> vectors, GpuLayout layout)
+    {
+        using namespace helpers;
+        static_assert(sizeof(Vector3<Type>) == 3 * sizeof(Type), "Vector3 must be tightly packed");
+
+        const std::size_t stride = GetGpuFloatCountVector3(layout);
+        ETLMATH_ASSERT(outBuffer.size() >= vectors.size() * stride, "Destination buffer too small in ExportToGpu");
+
+        float* dst = outBuffer.data();
+        const std::size_t count = vectors.size();
+        const Type* src = reinterpret_cast<const Type*>(vectors.data());
+
+        if (layout == GpuLayout::Scalar)
+        {
+            ConvertToFloat(dst, src, 3 * count);
+            return count * stride;
+        }
+
+        std::size_t i = 0;
+        for (; i + 1 < count; ++i)
+            ClearW(LoadAsFloat4(src + 3 * i)).store(dst + 4 * i);
+        if (i < count)
+            LoadAsFloat3(src + 3 * i).store(dst + 4 * i);
+
+        return count * stride;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix4x4<float>>,  GpuLayout, GpuMatrixOrder, bool);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix4x4<double>>, GpuLayout, GpuMatrixOrder, bool);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix4x4<int>>,    GpuLayout, GpuMatrixOrder, bool);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix3x3<float>>,  GpuLayout, GpuMatrixOrder);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix3x3<double>>, GpuLayout, GpuMatrixOrder);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Matrix3x3<int>>,    GpuLayout, GpuMatrixOrder);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Vector3<float>>,    GpuLayout);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Vector3<double>>,   GpuLayout);
+    template std::size_t ExportToGpu(std::span<float>, std::span<const Vector3<int>>,      GpuLayout);
+
+} /// namespace ETL::Math
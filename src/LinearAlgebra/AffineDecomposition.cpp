@@ -0,0 +1,327 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// AffineDecomposition.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/LinearAlgebra/AffineDecomposition.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/FixedPointHelpers.h"
+#include "MathLib/Common/SimdPack.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+    ///
+    /// Kernels are written against Simd::Pack (one matrix per lane, row-major a[row][col]);
+    /// the scalar API runs them on single-lane packs, the batch API on 4/8 lanes.
+
+    namespace helpers
+    {
+        /// Scaled Newton converges quadratically: 20 iterations cover condition numbers far beyond 1e12
+        constexpr int POLAR_MAX_ITERATIONS = 20;
+
+        /// Relative Frobenius change of Q below which a lane stops iterating
+        template<typename Type> constexpr Type POLAR_TOLERANCE = sizeof(Type) == sizeof(float) ? Type(1e-6) : Type(1e-13);
+
+        /// |det| relative to the product of the column lengths below which a matrix is singular
+        template<typename Type> constexpr Type SINGULAR_TOLERANCE = sizeof(Type) == sizeof(float) ? Type(1e-5) : Type(1e-12);
+
+
+        /// Cofactor matrix of m (= det(m) * m^-T)
+        template<typename Pack>
+        inline void Cofactors(Pack (&outCof)[3][3], const Pack (&m)[3][3])
+        {
+            outCof[0][0] = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+            outCof[0][1] = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+            outCof[0][2] = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+            outCof[1][0] = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+            outCof[1][1] = m[0][0] * m[2][2] - m[0][2] * m[2][0];
+            outCof[1][2] = m[0][1] * m[2][0] - m[0][0] * m[2][1];
+            outCof[2][0] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+            outCof[2][1] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+            outCof[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+        }
+
+
+        /// Squared Frobenius norm
+        template<typename Pack>
+        inline Pack NormSquared(const Pack (&m)[3][3])
+        {
+            Pack sum = m[0][0] * m[0][0];
+            for (int i = 1; i < 9; ++i)
+                sum = sum + m[i / 3][i % 3] * m[i / 3][i % 3];
+            return sum;
+        }
+
+
+        /// <summary>
+        /// Orthogonal polar factor of every lane of 'q' (in place). Lanes with a singular matrix
+        /// are left as they are and reported false in the returned mask.
+        /// Q <- (g * Q + Q^-T / g) / 2 with Higham's Frobenius scaling g = (|Q^-1| / |Q|)^(1/2).
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline auto PolarKernel(Pack (&q)[3][3])
+        {
+            const Pack half = Pack::Broadcast(Type(0.5));
+            const Pack tolerance = Pack::Broadcast(POLAR_TOLERANCE<Type> * POLAR_TOLERANCE<Type>);
+
+            Pack cof[3][3];
+            Cofactors(cof, q);
+            const Pack det0 = q[0][0] * cof[0][0] + q[0][1] * cof[0][1] + q[0][2] * cof[0][2];
+
+            /// Singular when |det| is negligible against the product of the column lengths (its Hadamard
+            /// bound): the ratio is 1 for any orthogonal frame, whatever the spread of its scales
+            Pack columns = Pack::Broadcast(Type(1));
+            for (int col = 0; col < 3; ++col)
+                columns = columns * (q[0][col] * q[0][col] + q[1][col] * q[1][col] + q[2][col] * q[2][col]);
+
+            const Pack singular = Pack::Broadcast(SINGULAR_TOLERANCE<Type> * SINGULAR_TOLERANCE<Type>);
+            const auto valid = det0 * det0 > singular * columns;
+
+            auto active = valid;
+            for (int iteration = 0; iteration < POLAR_MAX_ITERATIONS && Simd::MoveMask(active) != 0; ++iteration)
+            {
+                if (iteration > 0)
+                    Cofactors(cof, q);
+                const Pack det = q[0][0] * cof[0][0] + q[0][1] * cof[0][1] + q[0][2] * cof[0][2];
+
+                const Pack normQ = NormSquared(q);
+                const Pack normInverse = NormSquared(cof) / (det * det);
+                const Pack gamma = Simd::Sqrt(Simd::Sqrt(normInverse / normQ));
+
+                const Pack a = half * gamma;
+                const Pack b = half / (gamma * det);
+
+                Pack change = Pack::Zero();
+                for (int row = 0; row < 3; ++row)
+                    for (int col = 0; col < 3; ++col)
+                    {
+                        const Pack next = a * q[row][col] + b * cof[row][col];
+                        const Pack delta = next - q[row][col];
+                        change = change + delta * delta;
+                        q[row][col] = Simd::Select(active, next, q[row][col]);
+                    }
+
+                active = active & (change > tolerance * normQ);
+            }
+
+            return valid;
+        }
+
+
+        /// <summary>
+        /// Stretch K = Q^T * L, reflection moved to one scale axis (the most flipped basis vector
+        /// of Q), scale = diag(K), shear = K * diag(1 / scale) and the quaternion of Q (same case
+        /// selection as FromMatrix, branch-free)
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline void FinishKernel(Pack (&outQuat)[4], Pack (&outScale)[3], Pack (&outShear)[3][3], Pack (&q)[3][3], const Pack (&l)[3][3])
+        {
+            const Pack one = Pack::Broadcast(Type(1));
+            const Pack two = Pack::Broadcast(Type(2));
+            const Pack quarter = Pack::Broadcast(Type(0.25));
+
+            Pack k[3][3];
+            for (int row = 0; row < 3; ++row)
+                for (int col = 0; col < 3; ++col)
+                    k[row][col] = q[0][row] * l[0][col] + q[1][row] * l[1][col] + q[2][row] * l[2][col];
+
+            /// Reflection: flip column 'axis' of Q and row 'axis' of K
+            Pack cof[3][3];
+            Cofactors(cof, q);
+            const auto bFlip = q[0][0] * cof[0][0] + q[0][1] * cof[0][1] + q[0][2] * cof[0][2] < Pack::Zero();
+            const auto bMinX = (q[0][0] <= q[1][1]) & (q[0][0] <= q[2][2]);
+            const auto bMinY = (!bMinX) & (q[1][1] <= q[2][2]);
+            const decltype(bFlip) flipAxis[3] = { bFlip & bMinX, bFlip & bMinY, bFlip & (!bMinX) & (!bMinY) };
+            for (int axis = 0; axis < 3; ++axis)
+                for (int i = 0; i < 3; ++i)
+                {
+                    q[i][axis] = Simd::Select(flipAxis[axis], -q[i][axis], q[i][axis]);
+                    k[axis][i] = Simd::Select(flipAxis[axis], -k[axis][i], k[axis][i]);
+                }
+
+            for (int col = 0; col < 3; ++col)
+            {
+                outScale[col] = k[col][col];
+                const Pack invScale = one / k[col][col];
+                for (int row = 0; row < 3; ++row)
+                    outShear[row][col] = row == col ? one : k[row][col] * invScale;
+            }
+
+            /// Quaternion (x, y, z, w): one candidate per largest component
+            const Pack trace = q[0][0] + q[1][1] + q[2][2];
+            const Pack sW = two * Simd::Sqrt(trace + one);
+            const Pack sX = two * Simd::Sqrt(one + q[0][0] - q[1][1] - q[2][2]);
+            const Pack sY = two * Simd::Sqrt(one + q[1][1] - q[0][0] - q[2][2]);
+            const Pack sZ = two * Simd::Sqrt(one + q[2][2] - q[0][0] - q[1][1]);
+            const Pack iW = one / sW, iX = one / sX, iY = one / sY, iZ = one / sZ;
+
+            const Pack d21 = q[2][1] - q[1][2], d02 = q[0][2] - q[2][0], d10 = q[1][0] - q[0][1];
+            const Pack s01 = q[0][1] + q[1][0], s02 = q[0][2] + q[2][0], s12 = q[1][2] + q[2][1];
+
+            const auto bUseW = trace > Pack::Zero();
+            const auto bUseX = (q[0][0] > q[1][1]) & (q[0][0] > q[2][2]);
+            const auto bUseY = q[1][1] > q[2][2];
+            const auto pick = [&](const Pack& w, const Pack& x, const Pack& y, const Pack& z)
+            {
+                return Simd::Select(bUseW, w, Simd::Select(bUseX, x, Simd::Select(bUseY, y, z)));
+            };
+
+            outQuat[0] = pick(d21 * iW, quarter * sX, s01 * iY, s02 * iZ);
+            outQuat[1] = pick(d02 * iW, s01 * iX, quarter * sY, s12 * iZ);
+            outQuat[2] = pick(d10 * iW, s02 * iX, s12 * iY, quarter * sZ);
+            outQuat[3] = pick(quarter * sW, d21 * iX, d02 * iY, d10 * iZ);
+        }
+
+
+        /// Write lane 'lane' of the spilled results: lanes = quat[4], scale[3], shear[9] (row-major)
+        template<typename Type, int WIDTH>
+        inline void StoreDecomposition(Quaternion<Type>& outRotation, Vector3<Type>& outScale, Matrix3x3<Type>* outShear,
+                                       const CalcType<Type> (&lanes)[16][WIDTH], int lane)
+        {
+            for (int i = 0; i < 4; ++i)
+                outRotation.setRawValue(i, EncodeValue<Type>(lanes[i][lane]));
+            for (int i = 0; i < 3; ++i)
+                outScale.setRawValue(i, EncodeValue<Type>(lanes[4 + i][lane]));
+            if (outShear)
+                for (int row = 0; row < 3; ++row)
+                    for (int col = 0; col < 3; ++col)
+                        outShear->setRawValue(row, col, EncodeValue<Type>(lanes[7 + row * 3 + col][lane]));
+        }
+
+
+        /// Polar iteration then per-matrix tail, results packed as [quat(4), scale(3), shear(9)]
+        template<typename Type, typename Pack>
+        inline auto DecomposeKernel(Pack (&outResults)[16], const Pack (&l)[3][3])
+        {
+            Pack q[3][3];
+            for (int row = 0; row < 3; ++row)
+                for (int col = 0; col < 3; ++col)
+                    q[row][col] = l[row][col];
+
+            const auto valid = PolarKernel<Type>(q);
+
+            Pack quat[4], scale[3], shear[3][3];
+            FinishKernel<Type>(quat, scale, shear, q, l);
+
+            for (int i = 0; i < 4; ++i)
+                outResults[i] = quat[i];
+            for (int i = 0; i < 3; ++i)
+                outResults[4 + i] = scale[i];
+            for (int i = 0; i < 9; ++i)
+                outResults[7 + i] = shear[i / 3][i % 3];
+
+            return valid;
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions
+
+    /// <summary>
+    /// Decompose 'mat' into translation, rotation, scale and shear (single matrix)
+    /// </summary>
+    template<typename Type>
+    bool Decompose(const Matrix4x4<Type>& mat, Vector3<Type>& outTranslation, Quaternion<Type>& outRotation,
+                   Vector3<Type>& outScale, Matrix3x3<Type>* outShear)
+    {
+        using Calc = CalcType<Type>;
+        using Pack = Simd::Pack<Calc, 1>;
+
+        Pack l[3][3];
+        for (int row = 0; row < 3; ++row)
+            for (int col = 0; col < 3; ++col)
+                l[row][col] = Pack::Broadcast(DecodeValue<Calc>(mat.getRawValue(row, col)));
+
+        Pack results[16];
+        if (Simd::MoveMask(helpers::DecomposeKernel<Calc>(results, l)) == 0)
+            return false;
+
+        Calc lanes[16][1];
+        for (int i = 0; i < 16; ++i)
+            results[i].store(lanes[i]);
+
+        GetTranslation(outTranslation, mat);
+        helpers::StoreDecomposition(outRotation, outScale, outShear, lanes, 0);
+        return true;
+    }
+
+
+    /// <summary>
+    /// Decompose a batch of matrices (SIMD across matrices)
+    /// </summary>
+    template<typename Type>
+    bool Decompose(std::span<const Matrix4x4<Type>> mats, std::span<Vector3<Type>> outTranslations,
+                   std::span<Quaternion<Type>> outRotations, std::span<Vector3<Type>> outScales,
+                   std::span<Matrix3x3<Type>> outShears, std::span<bool> ok)
+    {
+        ETLMATH_ASSERT(outTranslations.size() >= mats.size() && outRotations.size() >= mats.size() && outScales.size() >= mats.size()
+                       && ok.size() >= mats.size() && (outShears.empty() || outShears.size() >= mats.size()),
+                       "Output span too small in Decompose");
+
+        using Calc = CalcType<Type>;
+        constexpr int WIDTH = Simd::NATIVE_WIDTH<Calc>;
+        using Pack = Simd::Pack<Calc, WIDTH>;
+
+        bool bAllValid = true;
+        for (std::size_t first = 0; first < mats.size(); first += WIDTH)
+        {
+            const int count = static_cast<int>(std::min<std::size_t>(WIDTH, mats.size() - first));
+
+            /// Gather (tail padded with identities)
+            alignas(32) Calc lanes[3][3][WIDTH];
+            for (int lane = 0; lane < WIDTH; ++lane)
+                for (int row = 0; row < 3; ++row)
+                    for (int col = 0; col < 3; ++col)
+                        lanes[row][col][lane] = lane < count ? DecodeValue<Calc>(mats[first + lane].getRawValue(row, col)) : Calc(row == col ? 1 : 0);
+
+            Pack l[3][3];
+            for (int row = 0; row < 3; ++row)
+                for (int col = 0; col < 3; ++col)
+                    l[row][col] = Pack::Load(lanes[row][col]);
+
+            Pack results[16];
+            const int validBits = Simd::MoveMask(helpers::DecomposeKernel<Calc>(results, l));
+
+            alignas(32) Calc resultLanes[16][WIDTH];
+            for (int i = 0; i < 16; ++i)
+                results[i].store(resultLanes[i]);
+
+            for (int lane = 0; lane < count; ++lane)
+            {
+                const std::size_t index = first + lane;
+                ok[index] = (validBits >> lane) & 1;
+                if (!ok[index])
+                {
+                    bAllValid = false;
+                    continue;
+                }
+
+                GetTranslation(outTranslations[index], mats[index]);
+                helpers::StoreDecomposition(outRotations[index], outScales[index], outShears.empty() ? nullptr : &outShears[index], resultLanes, lane);
+            }
+        }
+
+        return bAllValid;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template bool Decompose(const Matrix4x4<float>&  mat, Vector3<float>&  outTranslation, Quaternion<float>&  outRotation, Vector3<float>&  outScale, Matrix3x3<float>*  outShear);
+    template bool Decompose(const Matrix4x4<double>& mat, Vector3<double>& outTranslation, Quaternion<double>& outRotation, Vector3<double>& outScale, Matrix3x3<double>* outShear);
+    template bool Decompose(const Matrix4x4<int>&    mat, Vector3<int>&    outTranslation, Quaternion<int>&    outRotation, Vector3<int>&    outScale, Matrix3x3<int>*    outShear);
+
+    template bool Decompose(std::span<const Matrix4x4<float>>  mats, std::span<Vector3<float>>  outTranslations, std::span<Quaternion<float>>  outRotations,
+                            std::span<Vector3<float>>  outScales, std::span<Matrix3x3<float>>  outShears, std::span<bool> ok);
+    template bool Decompose(std::span<const Matrix4x4<double>> mats, std::span<Vector3<double>> outTranslations, std::span<Quaternion<double>> outRotations,
+                            std::span<Vector3<double>> outScales, std::span<Matrix3x3<double>> outShears, std::span<bool> ok);
+    template bool Decompose(std::span<const Matrix4x4<int>>    mats, std::span<Vector3<int>>    outTranslations, std::span<Quaternion<int>>    outRotations,
+                            std::span<Vector3<int>>    outScales, std::span<Matrix3x3<int>>    outShears, std::span<bool> ok);
+
+} /// namespace ETL::Math
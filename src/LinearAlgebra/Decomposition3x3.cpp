@@ -0,0 +1,537 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Decomposition3x3.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/LinearAlgebra/Decomposition3x3.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/FixedPointHelpers.h"
+#include "MathLib/Common/SimdPack.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+    ///
+    /// Every kernel is written against Simd::Pack (one matrix per lane). The scalar API runs
+    /// them on single-lane packs, the batch API on the widest pack available. Matrices are
+    /// handled as row-major 3x3 arrays of packs: a[row][col].
+
+    namespace helpers
+    {
+        /// Cyclic Jacobi sweeps (3 rotations each). Convergence is quadratic once the off-diagonal
+        /// terms are small; the worst cases over random matrices settle after 5 sweeps in float
+        /// (4 leaves ~4e-3 residuals) and 6 in double.
+        template<typename Type> constexpr int JACOBI_SWEEPS = sizeof(Type) == sizeof(float) ? 5 : 6;
+
+        /// Approximate Givens constants: 3 + 2 * sqrt(2), cos(pi / 8), sin(pi / 8)
+        constexpr double GIVENS_GAMMA = 5.82842712474619009760;
+        constexpr double GIVENS_CSTAR = 0.92387953251128675613;
+        constexpr double GIVENS_SSTAR = 0.38268343236508977173;
+
+
+        /// Lower triangle of a symmetric matrix
+        template<typename Pack>
+        struct Symmetric3
+        {
+            Pack s11, s21, s22, s31, s32, s33;
+        };
+
+
+        /// mask ? swap(x, y) : nothing
+        template<typename Pack, typename Mask>
+        inline void CondSwap(const Mask& mask, Pack& x, Pack& y)
+        {
+            const Pack z = x;
+            x = Simd::Select(mask, y, x);
+            y = Simd::Select(mask, z, y);
+        }
+
+
+        /// mask ? (x, y) = (y, -x) : nothing. Swapping two columns of a rotation this way keeps det = +1
+        template<typename Pack, typename Mask>
+        inline void CondNegSwap(const Mask& mask, Pack& x, Pack& y)
+        {
+            const Pack z = -x;
+            x = Simd::Select(mask, y, x);
+            y = Simd::Select(mask, z, y);
+        }
+
+
+        /// <summary>
+        /// Quaternion (ch, sh) of the rotation that approximately zeroes a12 in the 2x2 symmetric
+        /// block [a11 a12; a12 a22]. Falls back to a pi/4 rotation when the exact angle is larger
+        /// (the approximation would then be poor), which still reduces the off-diagonal term.
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline void ApproximateGivens(Pack& outCh, Pack& outSh, const Pack& a11, const Pack& a12, const Pack& a22)
+        {
+            const Pack ch = Pack::Broadcast(Type(2)) * (a11 - a22);
+            const Pack sh = a12;
+            const auto bAccurate = Pack::Broadcast(Type(GIVENS_GAMMA)) * sh * sh < ch * ch;
+            const Pack w = Pack::Broadcast(Type(1)) / Simd::Sqrt(ch * ch + sh * sh);
+
+            outCh = Simd::Select(bAccurate, w * ch, Pack::Broadcast(Type(GIVENS_CSTAR)));
+            outSh = Simd::Select(bAccurate, w * sh, Pack::Broadcast(Type(GIVENS_SSTAR)));
+        }
+
+
+        /// <summary>
+        /// One Jacobi step on the (1,2) pair: S = Q^T * S * Q and q = q * Q, then the matrix is
+        /// cyclically re-labelled so the next call works on the following pair. Three calls
+        /// (X, Y, Z) = (0, 1, 2), (1, 2, 0), (2, 0, 1) visit (1,2), (2,3), (3,1) and restore the labels.
+        /// q is stored (x, y, z, w).
+        /// </summary>
+        template<typename Type, int X, int Y, int Z, typename Pack>
+        inline void JacobiConjugation(Symmetric3<Pack>& s, Pack (&q)[4])
+        {
+            const Pack two = Pack::Broadcast(Type(2));
+
+            Pack ch, sh;
+            ApproximateGivens<Type>(ch, sh, s.s11, s.s21, s.s22);
+
+            /// Rotation by twice the quaternion angle: cos = a, sin = b ((ch, sh) is unit length)
+            const Pack a = ch * ch - sh * sh;
+            const Pack b = two * sh * ch;
+
+            const Symmetric3<Pack> t = s;
+            s.s11 = a * (a * t.s11 + b * t.s21) + b * (a * t.s21 + b * t.s22);
+            s.s21 = a * (a * t.s21 - b * t.s11) + b * (a * t.s22 - b * t.s21);
+            s.s22 = b * (b * t.s11 - a * t.s21) + a * (a * t.s22 - b * t.s21);
+            s.s31 = a * t.s31 + b * t.s32;
+            s.s32 = a * t.s32 - b * t.s31;
+
+            /// q = q * (sh along axis Z, ch)
+            const Pack tmp[3] = { q[0] * sh, q[1] * sh, q[2] * sh };
+            const Pack shw = sh * q[3];
+            q[0] = q[0] * ch;
+            q[1] = q[1] * ch;
+            q[2] = q[2] * ch;
+            q[3] = q[3] * ch;
+
+            q[Z] = q[Z] + shw;
+            q[3] = q[3] - tmp[Z];
+            q[X] = q[X] + tmp[Y];
+            q[Y] = q[Y] - tmp[X];
+
+            /// Relabel (1, 2, 3) -> (2, 3, 1)
+            s = Symmetric3<Pack>{ s.s22, s.s32, s.s33, s.s21, s.s31, s.s11 };
+        }
+
+
+        /// <summary>
+        /// Cyclic Jacobi on a symmetric matrix. On return 's' is (almost) diagonal and
+        /// q (x, y, z, w, normalized) is the rotation whose columns are the eigenvectors.
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline void JacobiEigen(Symmetric3<Pack>& s, Pack (&q)[4])
+        {
+            q[0] = q[1] = q[2] = Pack::Zero();
+            q[3] = Pack::Broadcast(Type(1));
+
+            for (int sweep = 0; sweep < JACOBI_SWEEPS<Type>; ++sweep)
+            {
+                JacobiConjugation<Type, 0, 1, 2>(s, q);
+                JacobiConjugation<Type, 1, 2, 0>(s, q);
+                JacobiConjugation<Type, 2, 0, 1>(s, q);
+            }
+
+            const Pack invLength = Pack::Broadcast(Type(1)) / Simd::Sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            for (Pack& value : q)
+                value = value * invLength;
+        }
+
+
+        /// Rotation matrix (row-major) of a unit quaternion (x, y, z, w)
+        template<typename Type, typename Pack>
+        inline void QuaternionToMatrix(Pack (&outM)[3][3], const Pack (&q)[4])
+        {
+            const Pack one = Pack::Broadcast(Type(1));
+            const Pack two = Pack::Broadcast(Type(2));
+
+            const Pack xx = q[0] * q[0], yy = q[1] * q[1], zz = q[2] * q[2];
+            const Pack xy = q[0] * q[1], xz = q[0] * q[2], yz = q[1] * q[2];
+            const Pack wx = q[3] * q[0], wy = q[3] * q[1], wz = q[3] * q[2];
+
+            outM[0][0] = one - two * (yy + zz); outM[0][1] = two * (xy - wz);       outM[0][2] = two * (xz + wy);
+            outM[1][0] = two * (xy + wz);       outM[1][1] = one - two * (xx + zz); outM[1][2] = two * (yz - wx);
+            outM[2][0] = two * (xz - wy);       outM[2][1] = two * (yz + wx);       outM[2][2] = one - two * (xx + yy);
+        }
+
+
+        /// Swap columns c0 and c1 of every matrix (negating one, see CondNegSwap) where mask is set
+        template<typename Pack, typename Mask>
+        inline void CondNegSwapColumns(const Mask& mask, Pack (&m)[3][3], int c0, int c1)
+        {
+            for (int row = 0; row < 3; ++row)
+                CondNegSwap(mask, m[row][c0], m[row][c1]);
+        }
+
+
+        /// <summary>
+        /// Symmetric eigen decomposition kernel: values sorted in decreasing order, vectors as columns
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline void EigenKernel(Pack (&outValues)[3], Pack (&outVectors)[3][3], const Pack (&a)[3][3])
+        {
+            Symmetric3<Pack> s{ a[0][0], a[1][0], a[1][1], a[2][0], a[2][1], a[2][2] };
+
+            Pack q[4];
+            JacobiEigen<Type>(s, q);
+            QuaternionToMatrix<Type>(outVectors, q);
+
+            outValues[0] = s.s11;
+            outValues[1] = s.s22;
+            outValues[2] = s.s33;
+
+            /// Sorting network on 3 values, columns follow
+            const auto swap01 = outValues[0] < outValues[1];
+            CondSwap(swap01, outValues[0], outValues[1]);
+            CondNegSwapColumns(swap01, outVectors, 0, 1);
+
+            const auto swap02 = outValues[0] < outValues[2];
+            CondSwap(swap02, outValues[0], outValues[2]);
+            CondNegSwapColumns(swap02, outVectors, 0, 2);
+
+            const auto swap12 = outValues[1] < outValues[2];
+            CondSwap(swap12, outValues[1], outValues[2]);
+            CondNegSwapColumns(swap12, outVectors, 1, 2);
+        }
+
+
+        /// <summary>
+        /// Givens quaternion (ch, sh) zeroing a2 against the pivot a1 (QR step), robust to a1 ~ 0
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline void QRGivens(Pack& outCh, Pack& outSh, const Pack& a1, const Pack& a2)
+        {
+            /// Smallest magnitude whose square does not underflow
+            const Pack epsilon = Pack::Broadcast(std::sqrt(std::numeric_limits<Type>::min()));
+
+            const Pack rho = Simd::Sqrt(a1 * a1 + a2 * a2);
+            Pack sh = Simd::Select(rho > epsilon, a2, Pack::Zero());
+            Pack ch = Simd::Abs(a1) + Simd::Max(rho, epsilon);
+            CondSwap(a1 < Pack::Zero(), sh, ch);
+
+            const Pack w = Pack::Broadcast(Type(1)) / Simd::Sqrt(ch * ch + sh * sh);
+            outCh = ch * w;
+            outSh = sh * w;
+        }
+
+
+        /// <summary>
+        /// SVD kernel: a = u * diag(sigma) * v^T
+        /// 1. Jacobi on a^T * a gives v, 2. columns of b = a * v are sorted by decreasing norm
+        /// (v follows), 3. three Givens rotations reduce b to upper triangular r = u^T * b,
+        /// whose diagonal is sigma.
+        /// </summary>
+        template<typename Type, typename Pack>
+        inline void SVDKernel(Pack (&outU)[3][3], Pack (&outSigma)[3], Pack (&outV)[3][3], const Pack (&a)[3][3])
+        {
+            const Pack one = Pack::Broadcast(Type(1));
+            const Pack two = Pack::Broadcast(Type(2));
+
+            /// Normal equations matrix a^T * a (lower triangle)
+            const auto dotCols = [&a](int c0, int c1) { return a[0][c0] * a[0][c1] + a[1][c0] * a[1][c1] + a[2][c0] * a[2][c1]; };
+            Symmetric3<Pack> s{ dotCols(0, 0), dotCols(1, 0), dotCols(1, 1), dotCols(2, 0), dotCols(2, 1), dotCols(2, 2) };
+
+            Pack q[4];
+            JacobiEigen<Type>(s, q);
+            QuaternionToMatrix<Type>(outV, q);
+
+            /// b = a * v
+            Pack b[3][3];
+            for (int row = 0; row < 3; ++row)
+                for (int col = 0; col < 3; ++col)
+                    b[row][col] = a[row][0] * outV[0][col] + a[row][1] * outV[1][col] + a[row][2] * outV[2][col];
+
+            /// Sort columns by decreasing norm
+            Pack rho[3];
+            for (int col = 0; col < 3; ++col)
+                rho[col] = b[0][col] * b[0][col] + b[1][col] * b[1][col] + b[2][col] * b[2][col];
+
+            const auto swap01 = rho[0] < rho[1];
+            CondNegSwapColumns(swap01, b, 0, 1);
+            CondNegSwapColumns(swap01, outV, 0, 1);
+            CondSwap(swap01, rho[0], rho[1]);
+
+            const auto swap02 = rho[0] < rho[2];
+            CondNegSwapColumns(swap02, b, 0, 2);
+            CondNegSwapColumns(swap02, outV, 0, 2);
+            CondSwap(swap02, rho[0], rho[2]);
+
+            const auto swap12 = rho[1] < rho[2];
+            CondNegSwapColumns(swap12, b, 1, 2);
+            CondNegSwapColumns(swap12, outV, 1, 2);
+
+            /// QR: rotations on rows (0,1), (0,2) then (1,2)
+            Pack ch1, sh1, ch2, sh2, ch3, sh3;
+            Pack r[3][3];
+
+            QRGivens<Type>(ch1, sh1, b[0][0], b[1][0]);
+            Pack c = one - two * sh1 * sh1;
+            Pack s1 = two * ch1 * sh1;
+            for (int col = 0; col < 3; ++col)
+            {
+                r[0][col] = c * b[0][col] + s1 * b[1][col];
+                r[1][col] = c * b[1][col] - s1 * b[0][col];
+                r[2][col] = b[2][col];
+            }
+
+            QRGivens<Type>(ch2, sh2, r[0][0], r[2][0]);
+            c = one - two * sh2 * sh2;
+            s1 = two * ch2 * sh2;
+            for (int col = 0; col < 3; ++col)
+            {
+                b[0][col] = c * r[0][col] + s1 * r[2][col];
+                b[1][col] = r[1][col];
+                b[2][col] = c * r[2][col] - s1 * r[0][col];
+            }
+
+            QRGivens<Type>(ch3, sh3, b[1][1], b[2][1]);
+            c = one - two * sh3 * sh3;
+            s1 = two * ch3 * sh3;
+            outSigma[0] = b[0][0];
+            outSigma[1] = c * b[1][1] + s1 * b[2][1];
+            outSigma[2] = c * b[2][2] - s1 * b[1][2];
+
+            /// u = Q1 * Q2 * Q3 in closed form
+            const Pack four = two * two;
+            const Pack sh12 = sh1 * sh1, sh22 = sh2 * sh2, sh32 = sh3 * sh3;
+            const Pack m1 = two * sh12 - one, m2 = two * sh22 - one, m3 = two * sh32 - one;
+
+            outU[0][0] = m1 * m2;
+            outU[0][1] = four * ch2 * ch3 * m1 * sh2 * sh3 + two * ch1 * sh1 * m3;
+            outU[0][2] = four * ch1 * ch3 * sh1 * sh3 - two * ch2 * m1 * sh2 * m3;
+
+            outU[1][0] = -two * ch1 * sh1 * m2;
+            outU[1][1] = m1 * m3 - four * two * ch1 * ch2 * ch3 * sh1 * sh2 * sh3;
+            outU[1][2] = four * sh1 * (ch3 * sh1 * sh3 + ch1 * ch2 * sh2 * m3) - two * ch3 * sh3;
+
+            outU[2][0] = two * ch2 * sh2;
+            outU[2][1] = -two * ch3 * m2 * sh3;
+            outU[2][2] = m2 * m3;
+        }
+
+
+        /// Decoded element (row, col) of a Matrix3x3
+        template<typename Type>
+        inline CalcType<Type> Element(const Matrix3x3<Type>& mat, int row, int col)
+        {
+            return DecodeValue<CalcType<Type>>(mat.getRawValueUnchecked(row, col));
+        }
+
+
+        /// <summary>
+        /// Batch driver: gathers WIDTH matrices into SoA packs (the tail is padded with identities),
+        /// and runs kernel(packs, firstIndex, validLaneCount)
+        /// </summary>
+        template<typename Type, typename Kernel>
+        void ForEachGroup(std::span<const Matrix3x3<Type>> mats, Kernel kernel)
+        {
+            using Calc = CalcType<Type>;
+            constexpr int WIDTH = Simd::NATIVE_WIDTH<Calc>;
+            using Pack = Simd::Pack<Calc, WIDTH>;
+
+            for (std::size_t first = 0; first < mats.size(); first += WIDTH)
+            {
+                const int count = static_cast<int>(std::min<std::size_t>(WIDTH, mats.size() - first));
+
+                alignas(32) Calc lanes[3][3][WIDTH];
+                for (int lane = 0; lane < WIDTH; ++lane)
+                    for (int row = 0; row < 3; ++row)
+                        for (int col = 0; col < 3; ++col)
+                            lanes[row][col][lane] = lane < count ? Element(mats[first + lane], row, col) : Calc(row == col ? 1 : 0);
+
+                Pack a[3][3];
+                for (int row = 0; row < 3; ++row)
+                    for (int col = 0; col < 3; ++col)
+                        a[row][col] = Pack::Load(lanes[row][col]);
+
+                kernel(a, first, count);
+            }
+        }
+
+
+        /// Spill N packs to per-lane storage: outLanes[i][lane]
+        template<typename Calc, int WIDTH, int N>
+        inline void Spill(Calc (&outLanes)[N][WIDTH], const Simd::Pack<Calc, WIDTH>* packs)
+        {
+            for (int i = 0; i < N; ++i)
+                packs[i].store(outLanes[i]);
+        }
+
+
+        /// Write lane 'lane' of a spilled row-major matrix
+        template<typename Type, int WIDTH>
+        inline void StoreMatrix(Matrix3x3<Type>& outMat, const CalcType<Type> (&lanes)[9][WIDTH], int lane)
+        {
+            for (int row = 0; row < 3; ++row)
+                for (int col = 0; col < 3; ++col)
+                    outMat.setRawValue(row, col, EncodeValue<Type>(lanes[row * 3 + col][lane]));
+        }
+
+
+        /// Write lane 'lane' of a spilled vector
+        template<typename Type, int WIDTH>
+        inline void StoreVector(Vector3<Type>& outVec, const CalcType<Type> (&lanes)[3][WIDTH], int lane)
+        {
+            for (int i = 0; i < 3; ++i)
+                outVec.setRawValue(i, EncodeValue<Type>(lanes[i][lane]));
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions
+
+    /// <summary>
+    /// Symmetric eigen decomposition (single matrix)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outValues">Eigenvalues, decreasing</param>
+    /// <param name="outVectors">Eigenvectors (columns)</param>
+    /// <param name="mat">Symmetric matrix (lower triangle read)</param>
+    template<typename Type>
+    void EigenSymmetric(Vector3<Type>& outValues, Matrix3x3<Type>& outVectors, const Matrix3x3<Type>& mat)
+    {
+        using Calc = CalcType<Type>;
+        using Pack = Simd::Pack<Calc, 1>;
+
+        Pack a[3][3];
+        for (int row = 0; row < 3; ++row)
+            for (int col = 0; col < 3; ++col)
+                a[row][col] = Pack::Broadcast(helpers::Element(mat, row, col));
+
+        Pack values[3], vectors[3][3];
+        helpers::EigenKernel<Calc>(values, vectors, a);
+
+        Calc valueLanes[3][1], vectorLanes[9][1];
+        helpers::Spill(valueLanes, values);
+        helpers::Spill(vectorLanes, vectors[0]);
+        helpers::StoreVector(outValues, valueLanes, 0);
+        helpers::StoreMatrix(outVectors, vectorLanes, 0);
+    }
+
+
+    /// <summary>
+    /// Symmetric eigen decomposition (batch, SIMD across matrices)
+    /// </summary>
+    template<typename Type>
+    void EigenSymmetric(std::span<Vector3<Type>> outValues, std::span<Matrix3x3<Type>> outVectors, std::span<const Matrix3x3<Type>> mats)
+    {
+        ETLMATH_ASSERT(outValues.size() >= mats.size() && outVectors.size() >= mats.size(), "Output span too small in EigenSymmetric");
+
+        helpers::ForEachGroup<Type>(mats, [&](const auto& a, std::size_t first, int count)
+        {
+            using Calc = CalcType<Type>;
+            using Pack = std::remove_cvref_t<decltype(a[0][0])>;
+            constexpr int WIDTH = Simd::NATIVE_WIDTH<Calc>;
+
+            Pack values[3], vectors[3][3];
+            helpers::EigenKernel<Calc>(values, vectors, a);
+
+            alignas(32) Calc valueLanes[3][WIDTH];
+            alignas(32) Calc vectorLanes[9][WIDTH];
+            helpers::Spill(valueLanes, values);
+            helpers::Spill(vectorLanes, vectors[0]);
+            for (int lane = 0; lane < count; ++lane)
+            {
+                helpers::StoreVector(outValues[first + lane], valueLanes, lane);
+                helpers::StoreMatrix(outVectors[first + lane], vectorLanes, lane);
+            }
+        });
+    }
+
+
+    /// <summary>
+    /// Singular value decomposition (single matrix)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outU">Left rotation</param>
+    /// <param name="outSigma">Singular values, decreasing magnitude (z negative for reflections)</param>
+    /// <param name="outV">Right rotation</param>
+    /// <param name="mat"></param>
+    template<typename Type>
+    void SVD(Matrix3x3<Type>& outU, Vector3<Type>& outSigma, Matrix3x3<Type>& outV, const Matrix3x3<Type>& mat)
+    {
+        using Calc = CalcType<Type>;
+        using Pack = Simd::Pack<Calc, 1>;
+
+        Pack a[3][3];
+        for (int row = 0; row < 3; ++row)
+            for (int col = 0; col < 3; ++col)
+                a[row][col] = Pack::Broadcast(helpers::Element(mat, row, col));
+
+        Pack u[3][3], sigma[3], v[3][3];
+        helpers::SVDKernel<Calc>(u, sigma, v, a);
+
+        Calc uLanes[9][1], sigmaLanes[3][1], vLanes[9][1];
+        helpers::Spill(uLanes, u[0]);
+        helpers::Spill(sigmaLanes, sigma);
+        helpers::Spill(vLanes, v[0]);
+        helpers::StoreMatrix(outU, uLanes, 0);
+        helpers::StoreVector(outSigma, sigmaLanes, 0);
+        helpers::StoreMatrix(outV, vLanes, 0);
+    }
+
+
+    /// <summary>
+    /// Singular value decomposition (batch, SIMD across matrices)
+    /// </summary>
+    template<typename Type>
+    void SVD(std::span<Matrix3x3<Type>> outU, std::span<Vector3<Type>> outSigma, std::span<Matrix3x3<Type>> outV,
+             std::span<const Matrix3x3<Type>> mats)
+    {
+        ETLMATH_ASSERT(outU.size() >= mats.size() && outSigma.size() >= mats.size() && outV.size() >= mats.size(),
+                       "Output span too small in SVD");
+
+        helpers::ForEachGroup<Type>(mats, [&](const auto& a, std::size_t first, int count)
+        {
+            using Calc = CalcType<Type>;
+            using Pack = std::remove_cvref_t<decltype(a[0][0])>;
+            constexpr int WIDTH = Simd::NATIVE_WIDTH<Calc>;
+
+            Pack u[3][3], sigma[3], v[3][3];
+            helpers::SVDKernel<Calc>(u, sigma, v, a);
+
+            alignas(32) Calc uLanes[9][WIDTH];
+            alignas(32) Calc sigmaLanes[3][WIDTH];
+            alignas(32) Calc vLanes[9][WIDTH];
+            helpers::Spill(uLanes, u[0]);
+            helpers::Spill(sigmaLanes, sigma);
+            helpers::Spill(vLanes, v[0]);
+            for (int lane = 0; lane < count; ++lane)
+            {
+                helpers::StoreMatrix(outU[first + lane], uLanes, lane);
+                helpers::StoreVector(outSigma[first + lane], sigmaLanes, lane);
+                helpers::StoreMatrix(outV[first + lane], vLanes, lane);
+            }
+        });
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template void EigenSymmetric(Vector3<float>&  outValues, Matrix3x3<float>&  outVectors, const Matrix3x3<float>&  mat);
+    template void EigenSymmetric(Vector3<double>& outValues, Matrix3x3<double>& outVectors, const Matrix3x3<double>& mat);
+    template void EigenSymmetric(Vector3<int>&    outValues, Matrix3x3<int>&    outVectors, const Matrix3x3<int>&    mat);
+
+    template void EigenSymmetric(std::span<Vector3<float>>  outValues, std::span<Matrix3x3<float>>  outVectors, std::span<const Matrix3x3<float>>  mats);
+    template void EigenSymmetric(std::span<Vector3<double>> outValues, std::span<Matrix3x3<double>> outVectors, std::span<const Matrix3x3<double>> mats);
+    template void EigenSymmetric(std::span<Vector3<int>>    outValues, std::span<Matrix3x3<int>>    outVectors, std::span<const Matrix3x3<int>>    mats);
+
+    template void SVD(Matrix3x3<float>&  outU, Vector3<float>&  outSigma, Matrix3x3<float>&  outV, const Matrix3x3<float>&  mat);
+    template void SVD(Matrix3x3<double>& outU, Vector3<double>& outSigma, Matrix3x3<double>& outV, const Matrix3x3<double>& mat);
+    template void SVD(Matrix3x3<int>&    outU, Vector3<int>&    outSigma, Matrix3x3<int>&    outV, const Matrix3x3<int>&    mat);
+
+    template void SVD(std::span<Matrix3x3<float>>  outU, std::span<Vector3<float>>  outSigma, std::span<Matrix3x3<float>>  outV, std::span<const Matrix3x3<float>>  mats);
+    template void SVD(std::span<Matrix3x3<double>> outU, std::span<Vector3<double>> outSigma, std::span<Matrix3x3<double>> outV, std::span<const Matrix3x3<double>> mats);
+    template void SVD(std::span<Matrix3x3<int>>    outU, std::span<Vector3<int>>    outSigma, std::span<Matrix3x3<int>>    outV, std::span<const Matrix3x3<int>>    mats);
+
+} /// namespace ETL::Math
@@ -0,0 +1,533 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// LinearSolve.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/LinearAlgebra/LinearSolve.h"
+#include "MathLib/Common/Asserts.h"
+#include "MathLib/Common/FixedPointHelpers.h"
+#include "MathLib/Common/SimdPack.h"
+#include "MathLib/Common/TypeComparisons.h"
+#include <algorithm>
+#include <limits>
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+    ///
+    /// Every kernel is written against Simd::Pack (one system per lane) and returns, per lane,
+    /// the smallest pivot it divided by: the system is solved if that pivot is >= epsilon.
+    /// Lanes that fail keep computing (they may produce inf/NaN) but are never stored.
+    /// Systems are handled as row-major N x N arrays of packs: a[row][col].
+
+    namespace helpers
+    {
+        enum class SolveMethod
+        {
+            LU,
+            Cholesky,
+            LDLT
+        };
+
+
+        /// mask ? swap(x, y) : nothing
+        template<typename Pack, typename Mask>
+        inline void CondSwap(const Mask& mask, Pack& x, Pack& y)
+        {
+            const Pack z = x;
+            x = Simd::Select(mask, y, x);
+            y = Simd::Select(mask, z, y);
+        }
+
+
+        /// <summary>
+        /// Gaussian elimination with partial pivoting, then back substitution.
+        /// The pivot row is chosen per lane by conditional swaps: row k ends up holding the
+        /// largest |a[r][k]| of the remaining rows (first one on ties), as scalar partial pivoting does.
+        /// Each pivot is inverted once (N divisions instead of N(N+1)/2).
+        /// </summary>
+        template<int N, typename Pack>
+        inline Pack LUKernel(Pack (&outX)[N], Pack (&a)[N][N], Pack (&b)[N])
+        {
+            Pack minPivot = Pack::Zero();
+            Pack invPivot[N];
+
+            for (int k = 0; k < N; ++k)
+            {
+                for (int r = k + 1; r < N; ++r)
+                {
+                    const auto swap = Simd::Abs(a[r][k]) > Simd::Abs(a[k][k]);
+                    for (int c = 0; c < N; ++c) /// whole rows: constant trip count, columns < k are never read again
+                        CondSwap(swap, a[k][c], a[r][c]);
+                    CondSwap(swap, b[k], b[r]);
+                }
+
+                minPivot = k == 0 ? Simd::Abs(a[0][0]) : Simd::Min(Simd::Abs(a[k][k]), minPivot);
+                invPivot[k] = Pack::Broadcast(1) / a[k][k];
+
+                for (int r = k + 1; r < N; ++r)
+                {
+                    const Pack factor = a[r][k] * invPivot[k];
+                    for (int c = k + 1; c < N; ++c)
+                        a[r][c] = a[r][c] - factor * a[k][c];
+                    b[r] = b[r] - factor * b[k];
+                }
+            }
+
+            for (int k = N - 1; k >= 0; --k)
+            {
+                Pack sum = b[k];
+                for (int c = k + 1; c < N; ++c)
+                    sum = sum - a[k][c] * outX[c];
+                outX[k] = sum * invPivot[k];
+            }
+
+            return minPivot;
+        }
+
+
+        /// <summary>
+        /// Cholesky factorization of the lower triangle (in place, a[i][j] -> L[i][j] for i >= j),
+        /// then forward (L y = b) and backward (L^T x = y) substitution.
+        /// Non positive diagonal terms are clamped to epsilon after being recorded, so no NaNs are produced.
+        /// </summary>
+        template<int N, typename Pack>
+        inline Pack CholeskyKernel(Pack (&outX)[N], Pack (&a)[N][N], Pack (&b)[N], const Pack& epsilon)
+        {
+            Pack minDiagonal = a[0][0];
+            Pack invDiagonal[N];
+
+            for (int j = 0; j < N; ++j)
+            {
+                Pack diagonal = a[j][j];
+                for (int k = 0; k < j; ++k)
+                    diagonal = diagonal - a[j][k] * a[j][k];
+
+                minDiagonal = Simd::Min(diagonal, minDiagonal);
+                const Pack ljj = Simd::Sqrt(Simd::Max(diagonal, epsilon));
+                invDiagonal[j] = Pack::Broadcast(1) / ljj;
+
+                for (int i = j + 1; i < N; ++i)
+                {
+                    Pack sum = a[i][j];
+                    for (int k = 0; k < j; ++k)
+                        sum = sum - a[i][k] * a[j][k];
+                    a[i][j] = sum * invDiagonal[j];
+                }
+            }
+
+            Pack y[N];
+            for (int i = 0; i < N; ++i)
+            {
+                Pack sum = b[i];
+                for (int k = 0; k < i; ++k)
+                    sum = sum - a[i][k] * y[k];
+                y[i] = sum * invDiagonal[i];
+            }
+
+            for (int i = N - 1; i >= 0; --i)
+            {
+                Pack sum = y[i];
+                for (int k = i + 1; k < N; ++k)
+                    sum = sum - a[k][i] * outX[k];
+                outX[i] = sum * invDiagonal[i];
+            }
+
+            return minDiagonal;
+        }
+
+
+        /// <summary>
+        /// LDL^T factorization of the lower triangle (in place, a[i][j] -> L[i][j] for i > j, D on the diagonal),
+        /// then L y = b, z = y / D, L^T x = z.
+        /// </summary>
+        template<int N, typename Pack>
+        inline Pack LDLTKernel(Pack (&outX)[N], Pack (&a)[N][N], Pack (&b)[N])
+        {
+            Pack invD[N];
+            Pack minPivot = Simd::Abs(a[0][0]);
+
+            for (int j = 0; j < N; ++j)
+            {
+                /// a[j][k] * d[k] for k < j, reused by the whole column
+                Pack ld[N]{};
+                Pack diagonal = a[j][j];
+                for (int k = 0; k < j; ++k)
+                {
+                    ld[k] = a[j][k] * a[k][k];
+                    diagonal = diagonal - ld[k] * a[j][k];
+                }
+
+                a[j][j] = diagonal;
+                invD[j] = Pack::Broadcast(1) / diagonal;
+                minPivot = Simd::Min(Simd::Abs(diagonal), minPivot);
+
+                for (int i = j + 1; i < N; ++i)
+                {
+                    Pack sum = a[i][j];
+                    for (int k = 0; k < j; ++k)
+                        sum = sum - a[i][k] * ld[k];
+                    a[i][j] = sum * invD[j];
+                }
+            }
+
+            Pack y[N];
+            for (int i = 0; i < N; ++i)
+            {
+                Pack sum = b[i];
+                for (int k = 0; k < i; ++k)
+                    sum = sum - a[i][k] * y[k];
+                y[i] = sum;
+            }
+
+            for (int i = N - 1; i >= 0; --i)
+            {
+                Pack sum = y[i] * invD[i];
+                for (int k = i + 1; k < N; ++k)
+                    sum = sum - a[k][i] * outX[k];
+                outX[i] = sum;
+            }
+
+            return minPivot;
+        }
+
+
+        /// Run 'Method' on packed systems, returns the per-lane success mask
+        template<SolveMethod Method, int N, typename Pack>
+        inline auto SolveKernel(Pack (&outX)[N], Pack (&a)[N][N], Pack (&b)[N], const Pack& epsilon)
+        {
+            if constexpr (Method == SolveMethod::LU)
+                return LUKernel<N>(outX, a, b) >= epsilon;
+            else if constexpr (Method == SolveMethod::Cholesky)
+                return CholeskyKernel<N>(outX, a, b, epsilon) >= epsilon;
+            else
+                return LDLTKernel<N>(outX, a, b) >= epsilon;
+        }
+
+
+        /// <summary>
+        /// Single system: the kernel on one-lane packs
+        /// </summary>
+        template<SolveMethod Method, typename Vec, typename Mat>
+        bool SolveSingle(Vec& outX, const Mat& mat, const Vec& vec)
+        {
+            using Type = typename MatrixShape<Mat>::ValueType;
+            using Calc = CalcType<Type>;
+            using Pack = Simd::Pack<Calc, 1>;
+            constexpr int N = MatrixShape<Mat>::ROWS;
+
+            Pack a[N][N], b[N], x[N];
+            for (int row = 0; row < N; ++row)
+            {
+                for (int col = 0; col < N; ++col)
+                    a[row][col] = Pack::Broadcast(DecodeValue<Calc>(mat.getRawValue(row, col)));
+                b[row] = Pack::Broadcast(DecodeValue<Calc>(vec.getRawValue(row)));
+            }
+
+            const Pack epsilon = Pack::Broadcast(static_cast<Calc>(Epsilon<Type>::value));
+            if (Simd::MoveMask(SolveKernel<Method, N>(x, a, b, epsilon)) == 0)
+                return false;
+
+            for (int row = 0; row < N; ++row)
+            {
+                Calc value[1];
+                x[row].store(value);
+                outX.setRawValue(row, EncodeValue<Type>(value[0]));
+            }
+            return true;
+        }
+
+
+        /// <summary>
+        /// Batch driver: gathers WIDTH systems into SoA packs (the tail is padded with identities)
+        /// </summary>
+        template<SolveMethod Method, typename Vec, typename Mat>
+        bool SolveBatch(std::span<Vec> outX, std::span<const Mat> mats, std::span<const Vec> vecs, std::span<bool> ok)
+        {
+            using Type = typename MatrixShape<Mat>::ValueType;
+            using Calc = CalcType<Type>;
+            constexpr int WIDTH = Simd::NATIVE_WIDTH<Calc>;
+            using Pack = Simd::Pack<Calc, WIDTH>;
+            constexpr int N = MatrixShape<Mat>::ROWS;
+
+            ETLMATH_ASSERT(outX.size() >= mats.size() && vecs.size() >= mats.size() && ok.size() >= mats.size(),
+                           "Span size mismatch in Solve");
+
+            const Pack epsilon = Pack::Broadcast(static_cast<Calc>(Epsilon<Type>::value));
+            bool bAllSolved = true;
+
+            for (std::size_t first = 0; first < mats.size(); first += WIDTH)
+            {
+                const int count = static_cast<int>(std::min<std::size_t>(WIDTH, mats.size() - first));
+
+                alignas(32) Calc lanes[N * N + N][WIDTH];
+                for (int lane = 0; lane < WIDTH; ++lane)
+                {
+                    for (int row = 0; row < N; ++row)
+                    {
+                        for (int col = 0; col < N; ++col)
+                            lanes[row * N + col][lane] = lane < count ? DecodeValue<Calc>(mats[first + lane].getRawValue(row, col)) : Calc(row == col ? 1 : 0);
+                        lanes[N * N + row][lane] = lane < count ? DecodeValue<Calc>(vecs[first + lane].getRawValue(row)) : Calc(0);
+                    }
+                }
+
+                Pack a[N][N], b[N], x[N];
+                for (int row = 0; row < N; ++row)
+                {
+                    for (int col = 0; col < N; ++col)
+                        a[row][col] = Pack::Load(lanes[row * N + col]);
+                    b[row] = Pack::Load(lanes[N * N + row]);
+                }
+
+                const int solved = Simd::MoveMask(SolveKernel<Method, N>(x, a, b, epsilon));
+
+                for (int row = 0; row < N; ++row)
+                    x[row].store(lanes[row]);
+
+                for (int lane = 0; lane < count; ++lane)
+                {
+                    const bool bSolved = (solved >> lane) & 1;
+                    ok[first + lane] = bSolved;
+                    bAllSolved = bAllSolved && bSolved;
+
+                    if (bSolved)
+                    {
+                        for (int row = 0; row < N; ++row)
+                            outX[first + lane].setRawValue(row, EncodeValue<Type>(lanes[row][lane]));
+                    }
+                }
+            }
+
+            return bAllSolved;
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Free functions
+
+    /// <summary>
+    /// mat * outX = b, partial pivoting LU
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outX">Solution (untouched if singular)</param>
+    /// <param name="mat"></param>
+    /// <param name="b"></param>
+    /// <returns>False if mat is singular</returns>
+    template<typename Type>
+    bool Solve(Vector3<Type>& outX, const Matrix3x3<Type>& mat, const Vector3<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::LU>(outX, mat, b);
+    }
+
+    template<typename Type>
+    bool Solve(Vector4<Type>& outX, const Matrix4x4<Type>& mat, const Vector4<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::LU>(outX, mat, b);
+    }
+
+    template<typename Type>
+    bool Solve(Vector6<Type>& outX, const Matrix6x6<Type>& mat, const Vector6<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::LU>(outX, mat, b);
+    }
+
+
+    /// <summary>
+    /// Batched partial pivoting LU (SIMD across systems)
+    /// </summary>
+    template<typename Type>
+    bool Solve(std::span<Vector3<Type>> outX, std::span<const Matrix3x3<Type>> mats, std::span<const Vector3<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::LU>(outX, mats, b, ok);
+    }
+
+    template<typename Type>
+    bool Solve(std::span<Vector4<Type>> outX, std::span<const Matrix4x4<Type>> mats, std::span<const Vector4<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::LU>(outX, mats, b, ok);
+    }
+
+    template<typename Type>
+    bool Solve(std::span<Vector6<Type>> outX, std::span<const Matrix6x6<Type>> mats, std::span<const Vector6<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::LU>(outX, mats, b, ok);
+    }
+
+
+    /// <summary>
+    /// mat * outX = b, Cholesky (symmetric positive definite, lower triangle read)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outX">Solution (untouched on failure)</param>
+    /// <param name="mat"></param>
+    /// <param name="b"></param>
+    /// <returns>False if mat is not positive definite</returns>
+    template<typename Type>
+    bool SolveCholesky(Vector3<Type>& outX, const Matrix3x3<Type>& mat, const Vector3<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::Cholesky>(outX, mat, b);
+    }
+
+    template<typename Type>
+    bool SolveCholesky(Vector4<Type>& outX, const Matrix4x4<Type>& mat, const Vector4<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::Cholesky>(outX, mat, b);
+    }
+
+    template<typename Type>
+    bool SolveCholesky(Vector6<Type>& outX, const Matrix6x6<Type>& mat, const Vector6<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::Cholesky>(outX, mat, b);
+    }
+
+
+    /// <summary>
+    /// Batched Cholesky (SIMD across systems)
+    /// </summary>
+    template<typename Type>
+    bool SolveCholesky(std::span<Vector3<Type>> outX, std::span<const Matrix3x3<Type>> mats, std::span<const Vector3<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::Cholesky>(outX, mats, b, ok);
+    }
+
+    template<typename Type>
+    bool SolveCholesky(std::span<Vector4<Type>> outX, std::span<const Matrix4x4<Type>> mats, std::span<const Vector4<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::Cholesky>(outX, mats, b, ok);
+    }
+
+    template<typename Type>
+    bool SolveCholesky(std::span<Vector6<Type>> outX, std::span<const Matrix6x6<Type>> mats, std::span<const Vector6<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::Cholesky>(outX, mats, b, ok);
+    }
+
+
+    /// <summary>
+    /// mat * outX = b, LDL^T without pivoting (symmetric, lower triangle read)
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outX">Solution (untouched on failure)</param>
+    /// <param name="mat"></param>
+    /// <param name="b"></param>
+    /// <returns>False if a pivot of D vanishes</returns>
+    template<typename Type>
+    bool SolveLDLT(Vector3<Type>& outX, const Matrix3x3<Type>& mat, const Vector3<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::LDLT>(outX, mat, b);
+    }
+
+    template<typename Type>
+    bool SolveLDLT(Vector4<Type>& outX, const Matrix4x4<Type>& mat, const Vector4<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::LDLT>(outX, mat, b);
+    }
+
+    template<typename Type>
+    bool SolveLDLT(Vector6<Type>& outX, const Matrix6x6<Type>& mat, const Vector6<Type>& b)
+    {
+        return helpers::SolveSingle<helpers::SolveMethod::LDLT>(outX, mat, b);
+    }
+
+
+    /// <summary>
+    /// Batched LDL^T (SIMD across systems)
+    /// </summary>
+    template<typename Type>
+    bool SolveLDLT(std::span<Vector3<Type>> outX, std::span<const Matrix3x3<Type>> mats, std::span<const Vector3<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::LDLT>(outX, mats, b, ok);
+    }
+
+    template<typename Type>
+    bool SolveLDLT(std::span<Vector4<Type>> outX, std::span<const Matrix4x4<Type>> mats, std::span<const Vector4<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::LDLT>(outX, mats, b, ok);
+    }
+
+    template<typename Type>
+    bool SolveLDLT(std::span<Vector6<Type>> outX, std::span<const Matrix6x6<Type>> mats, std::span<const Vector6<Type>> b, std::span<bool> ok)
+    {
+        return helpers::SolveBatch<helpers::SolveMethod::LDLT>(outX, mats, b, ok);
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template bool Solve(Vector3<float>&  outX, const Matrix3x3<float>&  mat, const Vector3<float>&  b);
+    template bool Solve(Vector3<double>& outX, const Matrix3x3<double>& mat, const Vector3<double>& b);
+    template bool Solve(Vector3<int>&    outX, const Matrix3x3<int>&    mat, const Vector3<int>&    b);
+
+    template bool Solve(Vector4<float>&  outX, const Matrix4x4<float>&  mat, const Vector4<float>&  b);
+    template bool Solve(Vector4<double>& outX, const Matrix4x4<double>& mat, const Vector4<double>& b);
+    template bool Solve(Vector4<int>&    outX, const Matrix4x4<int>&    mat, const Vector4<int>&    b);
+
+    template bool Solve(Vector6<float>&  outX, const Matrix6x6<float>&  mat, const Vector6<float>&  b);
+    template bool Solve(Vector6<double>& outX, const Matrix6x6<double>& mat, const Vector6<double>& b);
+    template bool Solve(Vector6<int>&    outX, const Matrix6x6<int>&    mat, const Vector6<int>&    b);
+
+    template bool Solve(std::span<Vector3<float>>  outX, std::span<const Matrix3x3<float>>  mats, std::span<const Vector3<float>>  b, std::span<bool> ok);
+    template bool Solve(std::span<Vector3<double>> outX, std::span<const Matrix3x3<double>> mats, std::span<const Vector3<double>> b, std::span<bool> ok);
+    template bool Solve(std::span<Vector3<int>>    outX, std::span<const Matrix3x3<int>>    mats, std::span<const Vector3<int>>    b, std::span<bool> ok);
+
+    template bool Solve(std::span<Vector4<float>>  outX, std::span<const Matrix4x4<float>>  mats, std::span<const Vector4<float>>  b, std::span<bool> ok);
+    template bool Solve(std::span<Vector4<double>> outX, std::span<const Matrix4x4<double>> mats, std::span<const Vector4<double>> b, std::span<bool> ok);
+    template bool Solve(std::span<Vector4<int>>    outX, std::span<const Matrix4x4<int>>    mats, std::span<const Vector4<int>>    b, std::span<bool> ok);
+
+    template bool Solve(std::span<Vector6<float>>  outX, std::span<const Matrix6x6<float>>  mats, std::span<const Vector6<float>>  b, std::span<bool> ok);
+    template bool Solve(std::span<Vector6<double>> outX, std::span<const Matrix6x6<double>> mats, std::span<const Vector6<double>> b, std::span<bool> ok);
+    template bool Solve(std::span<Vector6<int>>    outX, std::span<const Matrix6x6<int>>    mats, std::span<const Vector6<int>>    b, std::span<bool> ok);
+
+    template bool SolveCholesky(Vector3<float>&  outX, const Matrix3x3<float>&  mat, const Vector3<float>&  b);
+    template bool SolveCholesky(Vector3<double>& outX, const Matrix3x3<double>& mat, const Vector3<double>& b);
+    template bool SolveCholesky(Vector3<int>&    outX, const Matrix3x3<int>&    mat, const Vector3<int>&    b);
+
+    template bool SolveCholesky(Vector4<float>&  outX, const Matrix4x4<float>&  mat, const Vector4<float>&  b);
+    template bool SolveCholesky(Vector4<double>& outX, const Matrix4x4<double>& mat, const Vector4<double>& b);
+    template bool SolveCholesky(Vector4<int>&    outX, const Matrix4x4<int>&    mat, const Vector4<int>&    b);
+
+    template bool SolveCholesky(Vector6<float>&  outX, const Matrix6x6<float>&  mat, const Vector6<float>&  b);
+    template bool SolveCholesky(Vector6<double>& outX, const Matrix6x6<double>& mat, const Vector6<double>& b);
+    template bool SolveCholesky(Vector6<int>&    outX, const Matrix6x6<int>&    mat, const Vector6<int>&    b);
+
+    template bool SolveCholesky(std::span<Vector3<float>>  outX, std::span<const Matrix3x3<float>>  mats, std::span<const Vector3<float>>  b, std::span<bool> ok);
+    template bool SolveCholesky(std::span<Vector3<double>> outX, std::span<const Matrix3x3<double>> mats, std::span<const Vector3<double>> b, std::span<bool> ok);
+    template bool SolveCholesky(std::span<Vector3<int>>    outX, std::span<const Matrix3x3<int>>    mats, std::span<const Vector3<int>>    b, std::span<bool> ok);
+
+    template bool SolveCholesky(std::span<Vector4<float>>  outX, std::span<const Matrix4x4<float>>  mats, std::span<const Vector4<float>>  b, std::span<bool> ok);
+    template bool SolveCholesky(std::span<Vector4<double>> outX, std::span<const Matrix4x4<double>> mats, std::span<const Vector4<double>> b, std::span<bool> ok);
+    template bool SolveCholesky(std::span<Vector4<int>>    outX, std::span<const Matrix4x4<int>>    mats, std::span<const Vector4<int>>    b, std::span<bool> ok);
+
+    template bool SolveCholesky(std::span<Vector6<float>>  outX, std::span<const Matrix6x6<float>>  mats, std::span<const Vector6<float>>  b, std::span<bool> ok);
+    template bool SolveCholesky(std::span<Vector6<double>> outX, std::span<const Matrix6x6<double>> mats, std::span<const Vector6<double>> b, std::span<bool> ok);
+    template bool SolveCholesky(std::span<Vector6<int>>    outX, std::span<const Matrix6x6<int>>    mats, std::span<const Vector6<int>>    b, std::span<bool> ok);
+
+    template bool SolveLDLT(Vector3<float>&  outX, const Matrix3x3<float>&  mat, const Vector3<float>&  b);
+    template bool SolveLDLT(Vector3<double>& outX, const Matrix3x3<double>& mat, const Vector3<double>& b);
+    template bool SolveLDLT(Vector3<int>&    outX, const Matrix3x3<int>&    mat, const Vector3<int>&    b);
+
+    template bool SolveLDLT(Vector4<float>&  outX, const Matrix4x4<float>&  mat, const Vector4<float>&  b);
+    template bool SolveLDLT(Vector4<double>& outX, const Matrix4x4<double>& mat, const Vector4<double>& b);
+    template bool SolveLDLT(Vector4<int>&    outX, const Matrix4x4<int>&    mat, const Vector4<int>&    b);
+
+    template bool SolveLDLT(Vector6<float>&  outX, const Matrix6x6<float>&  mat, const Vector6<float>&  b);
+    template bool SolveLDLT(Vector6<double>& outX, const Matrix6x6<double>& mat, const Vector6<double>& b);
+    template bool SolveLDLT(Vector6<int>&    outX, const Matrix6x6<int>&    mat, const Vector6<int>&    b);
+
+    template bool SolveLDLT(std::span<Vector3<float>>  outX, std::span<const Matrix3x3<float>>  mats, std::span<const Vector3<float>>  b, std::span<bool> ok);
+    template bool SolveLDLT(std::span<Vector3<double>> outX, std::span<const Matrix3x3<double>> mats, std::span<const Vector3<double>> b, std::span<bool> ok);
+    template bool SolveLDLT(std::span<Vector3<int>>    outX, std::span<const Matrix3x3<int>>    mats, std::span<const Vector3<int>>    b, std::span<bool> ok);
+
+    template bool SolveLDLT(std::span<Vector4<float>>  outX, std::span<const Matrix4x4<float>>  mats, std::span<const Vector4<float>>  b, std::span<bool> ok);
+    template bool SolveLDLT(std::span<Vector4<double>> outX, std::span<const Matrix4x4<double>> mats, std::span<const Vector4<double>> b, std::span<bool> ok);
+    template bool SolveLDLT(std::span<Vector4<int>>    outX, std::span<const Matrix4x4<int>>    mats, std::span<const Vector4<int>>    b, std::span<bool> ok);
+
+    template bool SolveLDLT(std::span<Vector6<float>>  outX, std::span<const Matrix6x6<float>>  mats, std::span<const Vector6<float>>  b, std::span<bool> ok);
+    template bool SolveLDLT(std::span<Vector6<double>> outX, std::span<const Matrix6x6<double>> mats, std::span<const Vector6<double>> b, std::span<bool> ok);
+    template bool SolveLDLT(std::span<Vector6<int>>    outX, std::span<const Matrix6x6<int>>    mats, std::span<const Vector6<int>>    b, std::span<bool> ok);
+
+
+} /// namespace ETL::Math
@@ -0,0 +1,448 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// TransformArchive.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Serialization/TransformArchive.h"
+#include "MathLib/Common/Asserts.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// On-disk structures (fixed size, no implicit padding)
+        struct ArchiveHeader
+        {
+            char          magic[8];
+            std::uint32_t endianTag;
+            std::uint16_t version;
+            std::uint16_t reserved0;
+            std::uint32_t sectionCount;
+            std::uint32_t reserved1;
+            std::uint64_t fileSize;
+        };
+
+        struct ArchiveSectionEntry
+        {
+            char          name[ARCHIVE_MAX_NAME_LENGTH + 1];
+            std::uint32_t element;
+            std::uint32_t scalar;
+            std::uint64_t count;
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        static_assert(sizeof(ArchiveHeader) == 32 && sizeof(ArchiveSectionEntry) == 80, "Archive structures must match the documented layout");
+
+        constexpr char          ARCHIVE_MAGIC[8] = { 'E', 'T', 'L', 'M', 'A', 'R', 'C', 'H' };
+        constexpr std::uint32_t ARCHIVE_ENDIAN_TAG = 0x01020304u;
+
+        /// Byte swapping pass size when writing for the other byte order
+        constexpr std::size_t ARCHIVE_SWAP_CHUNK = 64 * 1024;
+
+
+        constexpr std::size_t AlignArchiveOffset(std::size_t offset)
+        {
+            return (offset + ARCHIVE_ALIGNMENT - 1) & ~(ARCHIVE_ALIGNMENT - 1);
+        }
+
+        constexpr std::size_t ScalarSize(ArchiveScalar scalar)
+        {
+            return scalar == ArchiveScalar::Float64 ? 8 : 4;
+        }
+
+        constexpr std::size_t ScalarsPerElement(ArchiveElement element)
+        {
+            return element == ArchiveElement::Matrix4x4 ? 16 : 3;
+        }
+
+        constexpr bool IsKnownElement(std::uint32_t element)
+        {
+            return element == std::uint32_t(ArchiveElement::Matrix4x4) || element == std::uint32_t(ArchiveElement::Vector3);
+        }
+
+        constexpr bool IsKnownScalar(std::uint32_t scalar)
+        {
+            return scalar >= std::uint32_t(ArchiveScalar::Float32) && scalar <= std::uint32_t(ArchiveScalar::Fixed16_16);
+        }
+
+
+        /// Reverse the byte order of the 'scalarSize' (4 or 8) byte scalars in [data, data + byteCount)
+        inline void SwapScalars(std::byte* data, std::size_t byteCount, std::size_t scalarSize)
+        {
+            if (scalarSize == 8)
+            {
+                for (std::size_t i = 0; i + 8 <= byteCount; i += 8)
+                {
+                    std::uint64_t value;
+                    std::memcpy(&value, data + i, 8);
+                    value = std::byteswap(value);
+                    std::memcpy(data + i, &value, 8);
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i + 4 <= byteCount; i += 4)
+                {
+                    std::uint32_t value;
+                    std::memcpy(&value, data + i, 4);
+                    value = std::byteswap(value);
+                    std::memcpy(data + i, &value, 4);
+                }
+            }
+        }
+
+        template<typename Int>
+        constexpr Int SwapIf(bool bSwap, Int value)
+        {
+            return bSwap ? std::byteswap(value) : value;
+        }
+
+
+        /// Read-only mapping of a whole file, false if it cannot be opened or mapped (or is empty)
+        inline bool MapFile(const std::filesystem::path& path, const std::byte*& outData, std::size_t& outSize)
+        {
+#if defined(_WIN32)
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                return false;
+
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0)
+            {
+                CloseHandle(file);
+                return false;
+            }
+
+            /// The view keeps the mapping alive, both handles can be released right away
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (mapping)
+                CloseHandle(mapping);
+            CloseHandle(file);
+            if (!view)
+                return false;
+
+            outData = static_cast<const std::byte*>(view);
+            outSize = static_cast<std::size_t>(size.QuadPart);
+            return true;
+#else
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                return false;
+
+            struct stat status;
+            if (::fstat(fd, &status) != 0 || status.st_size <= 0)
+            {
+                ::close(fd);
+                return false;
+            }
+
+            /// The mapping keeps the file referenced, the descriptor can be closed right away
+            void* view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (view == MAP_FAILED)
+                return false;
+
+            outData = static_cast<const std::byte*>(view);
+            outSize = static_cast<std::size_t>(status.st_size);
+            return true;
+#endif
+        }
+
+        inline void UnmapFile(const std::byte* data, std::size_t size)
+        {
+#if defined(_WIN32)
+            (void)size;
+            UnmapViewOfFile(data);
+#else
+            ::munmap(const_cast<std::byte*>(data), size);
+#endif
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Writer
+
+    void TransformArchiveWriter::addSection(std::string_view name, ArchiveElement element, ArchiveScalar scalar, std::size_t count, const void* data)
+    {
+        ETLMATH_ASSERT(!name.empty() && name.size() <= ARCHIVE_MAX_NAME_LENGTH, "Archive section name must be 1 to ARCHIVE_MAX_NAME_LENGTH characters");
+        ETLMATH_ASSERT(data != nullptr || count == 0, "Archive section has no data");
+        ETLMATH_ASSERT(std::none_of(mSections.begin(), mSections.end(), [name](const PendingSection& section) { return section.name == name; }),
+                       "Archive section names must be unique");
+
+        mSections.push_back({ std::string(name.substr(0, ARCHIVE_MAX_NAME_LENGTH)), element, scalar, count, static_cast<const std::byte*>(data) });
+    }
+
+
+    /// <summary>
+    /// Write header, section table and 64-byte aligned payloads. Payloads are streamed from the
+    /// caller's spans, through a small swapping buffer when writing for the other byte order.
+    /// </summary>
+    ArchiveStatus TransformArchiveWriter::write(const std::filesystem::path& path, std::endian byteOrder) const
+    {
+        using namespace helpers;
+        const bool bSwap = byteOrder != std::endian::native;
+
+        /// Layout
+        std::vector<ArchiveSectionEntry> entries(mSections.size());
+        std::size_t offset = AlignArchiveOffset(sizeof(ArchiveHeader) + entries.size() * sizeof(ArchiveSectionEntry));
+        std::size_t fileSize = offset;
+        for (std::size_t i = 0; i < mSections.size(); ++i)
+        {
+            const PendingSection& section = mSections[i];
+            const std::size_t size = section.count * ScalarsPerElement(section.element) * ScalarSize(section.scalar);
+
+            ArchiveSectionEntry& entry = entries[i];
+            std::memset(&entry, 0, sizeof(entry));
+            std::memcpy(entry.name, section.name.data(), section.name.size());
+            entry.element = SwapIf(bSwap, static_cast<std::uint32_t>(section.element));
+            entry.scalar = SwapIf(bSwap, static_cast<std::uint32_t>(section.scalar));
+            entry.count = SwapIf(bSwap, static_cast<std::uint64_t>(section.count));
+            entry.offset = SwapIf(bSwap, static_cast<std::uint64_t>(offset));
+            entry.size = SwapIf(bSwap, static_cast<std::uint64_t>(size));
+
+            fileSize = offset + size;
+            offset = AlignArchiveOffset(fileSize);
+        }
+
+        ArchiveHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, ARCHIVE_MAGIC, sizeof(header.magic));
+        header.endianTag = SwapIf(bSwap, ARCHIVE_ENDIAN_TAG);
+        header.version = SwapIf(bSwap, ARCHIVE_VERSION);
+        header.sectionCount = SwapIf(bSwap, static_cast<std::uint32_t>(entries.size()));
+        header.fileSize = SwapIf(bSwap, static_cast<std::uint64_t>(fileSize));
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return ArchiveStatus::FileError;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(ArchiveSectionEntry)));
+
+        /// Payloads
+        const std::array<char, ARCHIVE_ALIGNMENT> padding{};
+        std::vector<std::byte> swapBuffer(bSwap ? ARCHIVE_SWAP_CHUNK : 0);
+        std::size_t position = sizeof(ArchiveHeader) + entries.size() * sizeof(ArchiveSectionEntry);
+        for (std::size_t i = 0; i < mSections.size(); ++i)
+        {
+            const PendingSection& section = mSections[i];
+            const std::size_t sectionOffset = static_cast<std::size_t>(SwapIf(bSwap, entries[i].offset));
+            const std::size_t size = static_cast<std::size_t>(SwapIf(bSwap, entries[i].size));
+
+            file.write(padding.data(), static_cast<std::streamsize>(sectionOffset - position));
+            if (!bSwap)
+            {
+                file.write(reinterpret_cast<const char*>(section.data), static_cast<std::streamsize>(size));
+            }
+            else
+            {
+                for (std::size_t done = 0; done < size; done += ARCHIVE_SWAP_CHUNK)
+                {
+                    const std::size_t chunk = std::min(ARCHIVE_SWAP_CHUNK, size - done);
+                    std::memcpy(swapBuffer.data(), section.data + done, chunk);
+                    SwapScalars(swapBuffer.data(), chunk, ScalarSize(section.scalar));
+                    file.write(reinterpret_cast<const char*>(swapBuffer.data()), static_cast<std::streamsize>(chunk));
+                }
+            }
+            position = sectionOffset + size;
+        }
+
+        file.flush();
+        return file ? ArchiveStatus::Ok : ArchiveStatus::FileError;
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Reader - Constructors
+
+    TransformArchive::TransformArchive(TransformArchive&& other) noexcept
+        : mData(std::exchange(other.mData, nullptr))
+        , mMappedSize(std::exchange(other.mMappedSize, 0))
+        , mSwapped(std::move(other.mSwapped))
+        , mSections(std::move(other.mSections))
+    {
+    }
+
+    TransformArchive& TransformArchive::operator=(TransformArchive&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            mData = std::exchange(other.mData, nullptr);
+            mMappedSize = std::exchange(other.mMappedSize, 0);
+            mSwapped = std::move(other.mSwapped);
+            mSections = std::move(other.mSections);
+        }
+        return *this;
+    }
+
+    TransformArchive::~TransformArchive()
+    {
+        close();
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Reader - Open & close
+
+    /// <summary>
+    /// Map the file and validate header and section table (payload bytes are not touched unless
+    /// the archive was written with the other byte order).
+    /// </summary>
+    ArchiveStatus TransformArchive::open(const std::filesystem::path& path)
+    {
+        using namespace helpers;
+        close();
+
+        const std::byte* data = nullptr;
+        std::size_t size = 0;
+        if (!MapFile(path, data, size))
+            return ArchiveStatus::FileError;
+
+        auto fail = [&](ArchiveStatus status)
+        {
+            UnmapFile(data, size);
+            mSections.clear();
+            return status;
+        };
+
+        /// Header
+        if (size < sizeof(ArchiveHeader))
+            return fail(ArchiveStatus::Corrupted);
+
+        ArchiveHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, ARCHIVE_MAGIC, sizeof(header.magic)) != 0)
+            return fail(ArchiveStatus::InvalidFormat);
+
+        const bool bSwap = header.endianTag == std::byteswap(ARCHIVE_ENDIAN_TAG);
+        if (!bSwap && header.endianTag != ARCHIVE_ENDIAN_TAG)
+            return fail(ArchiveStatus::InvalidFormat);
+
+        const std::uint16_t version = SwapIf(bSwap, header.version);
+        if (version == 0 || version > ARCHIVE_VERSION)
+            return fail(ArchiveStatus::UnsupportedVersion);
+
+        const std::uint64_t fileSize = SwapIf(bSwap, header.fileSize);
+        const std::uint64_t sectionCount = SwapIf(bSwap, header.sectionCount);
+        const std::uint64_t tableEnd = sizeof(ArchiveHeader) + sectionCount * sizeof(ArchiveSectionEntry);
+        if (fileSize > size || tableEnd > fileSize)
+            return fail(ArchiveStatus::Corrupted);
+
+        /// Section table
+        mSections.resize(static_cast<std::size_t>(sectionCount));
+        for (std::size_t i = 0; i < mSections.size(); ++i)
+        {
+            ArchiveSectionEntry entry;
+            std::memcpy(&entry, data + sizeof(ArchiveHeader) + i * sizeof(ArchiveSectionEntry), sizeof(entry));
+
+            const std::uint32_t element = SwapIf(bSwap, entry.element);
+            const std::uint32_t scalar = SwapIf(bSwap, entry.scalar);
+            const std::uint64_t count = SwapIf(bSwap, entry.count);
+            const std::uint64_t offset = SwapIf(bSwap, entry.offset);
+            const std::uint64_t byteSize = SwapIf(bSwap, entry.size);
+
+            if (std::find(std::begin(entry.name), std::end(entry.name), '\0') == std::end(entry.name)
+                || !IsKnownElement(element) || !IsKnownScalar(scalar))
+                return fail(ArchiveStatus::Corrupted);
+
+            const std::uint64_t elementSize = ScalarsPerElement(ArchiveElement(element)) * ScalarSize(ArchiveScalar(scalar));
+            if (count > fileSize / elementSize || byteSize != count * elementSize
+                || offset % ARCHIVE_ALIGNMENT != 0 || offset < tableEnd || offset > fileSize || byteSize > fileSize - offset)
+                return fail(ArchiveStatus::Corrupted);
+
+            mSections[i] = { std::string(entry.name), ArchiveElement(element), ArchiveScalar(scalar),
+                             static_cast<std::size_t>(count), static_cast<std::size_t>(offset) };
+        }
+
+        if (!bSwap)
+        {
+            mData = data;
+            mMappedSize = size;
+            return ArchiveStatus::Ok;
+        }
+
+        /// Other byte order: one copy, swapped in place (the header and table copies are left as is)
+        mSwapped.assign(data, data + fileSize);
+        UnmapFile(data, size);
+        for (const ArchiveSection& section : mSections)
+        {
+            const std::size_t scalarSize = ScalarSize(section.scalar);
+            SwapScalars(mSwapped.data() + section.offset, section.count * ScalarsPerElement(section.element) * scalarSize, scalarSize);
+        }
+        mData = mSwapped.data();
+        return ArchiveStatus::Ok;
+    }
+
+
+    void TransformArchive::close()
+    {
+        if (mMappedSize != 0)
+            helpers::UnmapFile(mData, mMappedSize);
+
+        mData = nullptr;
+        mMappedSize = 0;
+        mSwapped = {};
+        mSections.clear();
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Reader - Access methods
+
+    const ArchiveSection& TransformArchive::getSection(int index) const
+    {
+        ETLMATH_ASSERT(index >= 0 && index < getSectionCount(), "Archive section index out of range");
+        return mSections[index];
+    }
+
+
+    int TransformArchive::findSection(std::string_view name) const
+    {
+        for (std::size_t i = 0; i < mSections.size(); ++i)
+        {
+            if (mSections[i].name == name)
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+
+    const std::byte* TransformArchive::findPayload(std::string_view name, ArchiveElement element, ArchiveScalar scalar, std::size_t& outCount) const
+    {
+        outCount = 0;
+        const int index = findSection(name);
+        if (index < 0 || mSections[index].element != element || mSections[index].scalar != scalar)
+            return nullptr;
+
+        outCount = mSections[index].count;
+        return mData + mSections[index].offset;
+    }
+
+} /// namespace ETL::Math
@@ -0,0 +1,50 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// DualQuaternion.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Types/DualQuaternion.h"
+
+namespace ETL::Math
+{
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template class DualQuaternion<float>;
+    template class DualQuaternion<double>;
+    template class DualQuaternion<int>;
+
+    template void Multiply(DualQuaternion<float>&  outResult, const DualQuaternion<float>&  dq1, const DualQuaternion<float>&  dq2);
+    template void Multiply(DualQuaternion<double>& outResult, const DualQuaternion<double>& dq1, const DualQuaternion<double>& dq2);
+    template void Multiply(DualQuaternion<int>&    outResult, const DualQuaternion<int>&    dq1, const DualQuaternion<int>&    dq2);
+
+    template bool Normalize(DualQuaternion<float>&  outResult, const DualQuaternion<float>&  dq);
+    template bool Normalize(DualQuaternion<double>& outResult, const DualQuaternion<double>& dq);
+    template bool Normalize(DualQuaternion<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    template bool Inverse(DualQuaternion<float>&  outResult, const DualQuaternion<float>&  dq);
+    template bool Inverse(DualQuaternion<double>& outResult, const DualQuaternion<double>& dq);
+    template bool Inverse(DualQuaternion<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    template void GetTranslation(Vector3<float>&  outResult, const DualQuaternion<float>&  dq);
+    template void GetTranslation(Vector3<double>& outResult, const DualQuaternion<double>& dq);
+    template void GetTranslation(Vector3<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    template void TransformPoint(Vector3<float>&  outResult, const DualQuaternion<float>&  dq, const Vector3<float>&  point);
+    template void TransformPoint(Vector3<double>& outResult, const DualQuaternion<double>& dq, const Vector3<double>& point);
+    template void TransformPoint(Vector3<int>&    outResult, const DualQuaternion<int>&    dq, const Vector3<int>&    point);
+
+    template void TransformDirection(Vector3<float>&  outResult, const DualQuaternion<float>&  dq, const Vector3<float>&  direction);
+    template void TransformDirection(Vector3<double>& outResult, const DualQuaternion<double>& dq, const Vector3<double>& direction);
+    template void TransformDirection(Vector3<int>&    outResult, const DualQuaternion<int>&    dq, const Vector3<int>&    direction);
+
+    template void ToMatrix(Matrix4x4<float>&  outResult, const DualQuaternion<float>&  dq);
+    template void ToMatrix(Matrix4x4<double>& outResult, const DualQuaternion<double>& dq);
+    template void ToMatrix(Matrix4x4<int>&    outResult, const DualQuaternion<int>&    dq);
+
+    template void FromMatrix(DualQuaternion<float>&  outResult, const Matrix4x4<float>&  mat);
+    template void FromMatrix(DualQuaternion<double>& outResult, const Matrix4x4<double>& mat);
+    template void FromMatrix(DualQuaternion<int>&    outResult, const Matrix4x4<int>&    mat);
+
+} /// namespace ETL::Math
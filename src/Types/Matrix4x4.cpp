@@ -5,415 +5,478 @@
 
 #include "MathLib/Types/Matrix4x4.h"
 #include "MathLib/Types/Matrix3x3.h"
+#include "MathLib/Common/Parallel.h"
+#include "MathLib/Common/SimdPack.h"
+#include <algorithm>
 
 namespace ETL::Math
 {
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// <summary>
+        /// Column-broadcast product out = A * b with A's columns already in registers:
+        /// out.col[j] = A.col[0] * b(0,j) + A.col[1] * b(1,j) + A.col[2] * b(2,j) + A.col[3] * b(3,j).
+        /// The whole result is computed before the store, so 'out' may alias 'b' (or the matrix 'aCols' came from).
+        /// </summary>
+        template<typename Type>
+        inline void MultiplyColumns(Matrix4x4<Type>& out, const Simd::Pack<Type, 4> (&aCols)[4], const Matrix4x4<Type>& b)
+        {
+            using Pack = Simd::Pack<Type, 4>;
+
+            Pack result[4];
+            for (int col = 0; col < 4; ++col)
+            {
+                const Type* bCol = b.getRawCol(col);
+                result[col] = aCols[0] * Pack::Broadcast(bCol[0]) + aCols[1] * Pack::Broadcast(bCol[1])
+                            + aCols[2] * Pack::Broadcast(bCol[2]) + aCols[3] * Pack::Broadcast(bCol[3]);
+            }
+
+            for (int col = 0; col < 4; ++col)
+                result[col].store(out.getRawCol(col));
+        }
+
+
+        /// Padding for the lanes of a partial InverseN block
+        template<typename Type>
+        constexpr Type IDENTITY_ELEMENTS[16] = { Type(1), Type(0), Type(0), Type(0), Type(0), Type(1), Type(0), Type(0),
+                                                 Type(0), Type(0), Type(1), Type(0), Type(0), Type(0), Type(0), Type(1) };
+
+
+        /// Matrix columns into registers (contiguous in column-major storage)
+        template<typename Type>
+        inline void LoadColumns(Simd::Pack<Type, 4> (&outCols)[4], const Matrix4x4<Type>& mat)
+        {
+            for (int col = 0; col < 4; ++col)
+                outCols[col] = Simd::Pack<Type, 4>::Load(mat.getRawCol(col));
+        }
+    }
+
 
     ///------------------------------------------------------------------------------------------
     /// Free functions and common helpers
 
     /// <summary>
-    /// Matrix * Vector
+    /// Inverse of a projection matrix. Perspective and orthographic matrices (as built by the
+    /// Create* factories, off-center frusta included) only have a handful of non-zero terms,
+    /// so their inverse is computed directly from them. Any other matrix falls back to Inverse().
     /// </summary>
     /// <typeparam name="Type"></typeparam>
     /// <param name="outResult"></param>
-    /// <param name="mat"></param>
-    /// <param name="vec"></param>
+    /// <param name="proj"></param>
+    /// <returns></returns>
     template<typename Type>
-    void Multiply(Vector4<Type>& outResult, const Matrix4x4<Type>& mat, const Vector4<Type>& vec)
+    bool InverseProjection(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& proj)
     {
-        /// --- SAFETY CHECK FOR ALIASING ---
-        /// If outResult is the same object as vec, we must use a temporary buffer.
-        if (&outResult == &vec)
-        {
-            Vector4<Type> temp;
-            Multiply(temp, mat, vec);
+        ETLMATH_INSTRUMENT(Matrix4x4InverseProjection);
 
-            outResult = temp;
-            return;
+        const auto isNull = [&proj](int row, int col) { return proj.getRawValue(row, col) == Type(0); };
+        const auto value = [&proj](int row, int col) { return DecodeValue<double>(proj.getRawValue(row, col)); };
+
+        /// Shared sparsity: x/y rows independent, z/w rows ignore x/y
+        const bool bSparse = isNull(0, 1) && isNull(1, 0) && isNull(2, 0) && isNull(2, 1) && isNull(3, 0) && isNull(3, 1)
+                          && !isNull(0, 0) && !isNull(1, 1);
+
+        double inv[4][4] = {};
+
+        /// Perspective: | a 0 c 0 |  clip.w = e * z
+        ///              | 0 b d 0 |
+        ///              | 0 0 A B |
+        ///              | 0 0 e 0 |
+        if (bSparse && isNull(0, 3) && isNull(1, 3) && isNull(3, 3) && !isNull(3, 2) && !isNull(2, 3))
+        {
+            const double a = value(0, 0), b = value(1, 1), c = value(0, 2), d = value(1, 2);
+            const double A = value(2, 2), B = value(2, 3), e = value(3, 2);
+
+            inv[0][0] = 1.0 / a;
+            inv[0][3] = -c / (a * e);
+            inv[1][1] = 1.0 / b;
+            inv[1][3] = -d / (b * e);
+            inv[2][3] = 1.0 / e;
+            inv[3][2] = 1.0 / B;
+            inv[3][3] = -A / (B * e);
+        }
+        /// Orthographic: | a 0 0 tx |
+        ///               | 0 b 0 ty |
+        ///               | 0 0 C D  |
+        ///               | 0 0 0 w  |
+        else if (bSparse && isNull(0, 2) && isNull(1, 2) && isNull(3, 2) && !isNull(2, 2) && !isNull(3, 3))
+        {
+            const double a = value(0, 0), b = value(1, 1), C = value(2, 2), w = value(3, 3);
+            const double tx = value(0, 3), ty = value(1, 3), D = value(2, 3);
+
+            inv[0][0] = 1.0 / a;
+            inv[0][3] = -tx / (a * w);
+            inv[1][1] = 1.0 / b;
+            inv[1][3] = -ty / (b * w);
+            inv[2][2] = 1.0 / C;
+            inv[2][3] = -D / (C * w);
+            inv[3][3] = 1.0 / w;
         }
+        else
+        {
+            return Inverse(outResult, proj);
+        }
+
+        for (int row = 0; row < Matrix4x4<Type>::COL_SIZE; ++row)
+            for (int col = 0; col < Matrix4x4<Type>::COL_SIZE; ++col)
+                outResult.setRawValue(row, col, EncodeValue<Type>(inv[row][col]));
+
+        return true;
+    }
+
+
+    /// <summary>
+    /// Batched point transform to clip space (w = 1 implied on input).
+    /// Floating point types use a column-broadcast kernel: clip = c0 * x + c1 * y + c2 * z + c3,
+    /// one SIMD register per matrix column kept live across the whole batch.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outClip"></param>
+    /// <param name="mat"></param>
+    /// <param name="points"></param>
+    template<typename Type>
+    void TransformPoints(std::span<Vector4<Type>> outClip, const Matrix4x4<Type>& mat, std::span<const Vector3<Type>> points)
+    {
+        ETLMATH_ASSERT(outClip.size() >= points.size(), "Output span too small in TransformPoints");
 
         if constexpr (std::integral<Type>)
         {
-            /// Use 64-bit to prevent overflow
-            /// vector getters return normal values, mXX is fixed-point ->
-            /// Product is fixed-point -> sum (x, y, z) are fixed-point
-            const int64_t x = static_cast<int64_t>(mat.getRawValue(0,0)) * vec.getRawValue(0)
-                            + static_cast<int64_t>(mat.getRawValue(0,1)) * vec.getRawValue(1)
-                            + static_cast<int64_t>(mat.getRawValue(0,2)) * vec.getRawValue(2)
-                            + static_cast<int64_t>(mat.getRawValue(0,3)) * vec.getRawValue(3);
-            const int64_t y = static_cast<int64_t>(mat.getRawValue(1,0)) * vec.getRawValue(0)
-                            + static_cast<int64_t>(mat.getRawValue(1,1)) * vec.getRawValue(1)
-                            + static_cast<int64_t>(mat.getRawValue(1,2)) * vec.getRawValue(2)
-                            + static_cast<int64_t>(mat.getRawValue(1,3)) * vec.getRawValue(3);
-            const int64_t z = static_cast<int64_t>(mat.getRawValue(2,0)) * vec.getRawValue(0)
-                            + static_cast<int64_t>(mat.getRawValue(2,1)) * vec.getRawValue(1)
-                            + static_cast<int64_t>(mat.getRawValue(2,2)) * vec.getRawValue(2)
-                            + static_cast<int64_t>(mat.getRawValue(2,3)) * vec.getRawValue(3);
-            const int64_t w = static_cast<int64_t>(mat.getRawValue(3,0)) * vec.getRawValue(0)
-                            + static_cast<int64_t>(mat.getRawValue(3,1)) * vec.getRawValue(1)
-                            + static_cast<int64_t>(mat.getRawValue(3,2)) * vec.getRawValue(2)
-                            + static_cast<int64_t>(mat.getRawValue(3,3)) * vec.getRawValue(3);
-
-            outResult.setRawValue(0, x >> FIXED_SHIFT);
-            outResult.setRawValue(1, y >> FIXED_SHIFT);
-            outResult.setRawValue(2, z >> FIXED_SHIFT);
-            outResult.setRawValue(3, w >> FIXED_SHIFT);
+            for (std::size_t i = 0; i < points.size(); ++i)
+                Multiply(outClip[i], mat, Vector4<Type>{ points[i], Type(1) });
         }
         else
         {
-            outResult.setRawValue(0, mat(0,0) * vec[0] + mat(0,1) * vec[1] + mat(0,2) * vec[2] + mat(0,3) * vec[3]);
-            outResult.setRawValue(1, mat(1,0) * vec[0] + mat(1,1) * vec[1] + mat(1,2) * vec[2] + mat(1,3) * vec[3]);
-            outResult.setRawValue(2, mat(2,0) * vec[0] + mat(2,1) * vec[1] + mat(2,2) * vec[2] + mat(2,3) * vec[3]);
-            outResult.setRawValue(3, mat(3,0) * vec[0] + mat(3,1) * vec[1] + mat(3,2) * vec[2] + mat(3,3) * vec[3]);
+            using Pack = Simd::Pack<Type, 4>;
+
+            Type cols[4][4];
+            for (int col = 0; col < Matrix4x4<Type>::COL_SIZE; ++col)
+                for (int row = 0; row < Matrix4x4<Type>::COL_SIZE; ++row)
+                    cols[col][row] = mat.getRawValue(row, col);
+
+            const Pack c0 = Pack::Load(cols[0]);
+            const Pack c1 = Pack::Load(cols[1]);
+            const Pack c2 = Pack::Load(cols[2]);
+            const Pack c3 = Pack::Load(cols[3]);
+
+            Type clip[4];
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                const Vector3<Type>& point = points[i];
+                const Pack result = c0 * Pack::Broadcast(point.getRawValue(0))
+                                  + c1 * Pack::Broadcast(point.getRawValue(1))
+                                  + c2 * Pack::Broadcast(point.getRawValue(2))
+                                  + c3;
+                result.store(clip);
+
+                Vector4<Type>& out = outClip[i];
+                out.setRawValue(0, clip[0]);
+                out.setRawValue(1, clip[1]);
+                out.setRawValue(2, clip[2]);
+                out.setRawValue(3, clip[3]);
+            }
         }
     }
 
 
     /// <summary>
-    /// Matrix * Matrix
+    /// Batched point projection (clip-space transform + perspective divide).
+    /// Points are processed in small chunks through TransformPoints so the clip-space
+    /// intermediates stay in L1.
     /// </summary>
     /// <typeparam name="Type"></typeparam>
-    /// <param name="outResult"></param>
-    /// <param name="mA"></param>
-    /// <param name="mB"></param>
+    /// <param name="outNdc"></param>
+    /// <param name="viewProj"></param>
+    /// <param name="points"></param>
     template<typename Type>
-    void Multiply(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mA, const Matrix4x4<Type>& mB)
+    void ProjectPoints(std::span<Vector3<Type>> outNdc, const Matrix4x4<Type>& viewProj, std::span<const Vector3<Type>> points)
     {
-        /// --- SAFETY CHECK FOR ALIASING ---
-        /// If outResult is the same object as mA OR mB, we must use a temporary buffer.
-        if (&outResult == &mA || &outResult == &mB)
+        ETLMATH_ASSERT(outNdc.size() >= points.size(), "Output span too small in ProjectPoints");
+
+        constexpr std::size_t CHUNK_SIZE = 64;
+        Vector4<Type> clip[CHUNK_SIZE];
+
+        for (std::size_t first = 0; first < points.size(); first += CHUNK_SIZE)
         {
-            Matrix4x4<Type> temp;
-            Multiply(temp, mA, mB);
+            const std::size_t count = std::min(CHUNK_SIZE, points.size() - first);
+            TransformPoints(std::span<Vector4<Type>>{ clip, count }, viewProj, points.subspan(first, count));
 
-            outResult = temp;
-            return;
+            for (std::size_t i = 0; i < count; ++i)
+                outNdc[first + i] = clip[i].perspectiveDivide();
         }
+    }
+
+
+    /// <summary>
+    /// Batched rotation factory. Angles are gathered in chunks so one FastTrig::SinCos call
+    /// evaluates all sines and cosines of the chunk with SIMD, then matrices are assembled
+    /// exactly as CreateRotation does (R = Rx * Ry * Rz).
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="rotations"></param>
+    template<typename Type>
+    void CreateRotations(std::span<Matrix4x4<Type>> outResult, std::span<const Vector3<double>> rotations)
+    {
+        ETLMATH_ASSERT(outResult.size() >= rotations.size(), "Output span too small in CreateRotations");
 
-        for (int col = 0; col < Matrix4x4<Type>::COL_SIZE; ++col)
+        constexpr std::size_t CHUNK_SIZE = 64;
+        double angles[CHUNK_SIZE * 3], sines[CHUNK_SIZE * 3], cosines[CHUNK_SIZE * 3];
+
+        for (std::size_t first = 0; first < rotations.size(); first += CHUNK_SIZE)
         {
-            for (int row = 0; row < Matrix4x4<Type>::COL_SIZE; ++row)
+            const std::size_t count = std::min(CHUNK_SIZE, rotations.size() - first);
+            for (std::size_t i = 0; i < count; ++i)
             {
-                if constexpr (std::integral<Type>)
-                {
-                    const int64_t sum = static_cast<int64_t>(mA.getRawValue(row, 0)) * mB.getRawValue(0, col)
-                                      + static_cast<int64_t>(mA.getRawValue(row, 1)) * mB.getRawValue(1, col)
-                                      + static_cast<int64_t>(mA.getRawValue(row, 2)) * mB.getRawValue(2, col)
-                                      + static_cast<int64_t>(mA.getRawValue(row, 3)) * mB.getRawValue(3, col);
+                angles[i * 3 + 0] = rotations[first + i].getRawValue(0);
+                angles[i * 3 + 1] = rotations[first + i].getRawValue(1);
+                angles[i * 3 + 2] = rotations[first + i].getRawValue(2);
+            }
 
-                    /// Bitshift result back to Fixed Point
-                    outResult.setRawValue(row, col, static_cast<Type>(sum >> FIXED_SHIFT));
-                }
-                else
-                {
-                    outResult.setRawValue(row, col, mA(row,0) * mB(0,col) + mA(row,1) * mB(1,col) + mA(row,2) * mB(2,col) + mA(row, 3) * mB(3, col));
-                }
+            FastTrig::SinCos(std::span<double>{ sines, count * 3 }, std::span<double>{ cosines, count * 3 },
+                             std::span<const double>{ angles, count * 3 });
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const double sinX = sines[i * 3 + 0], cosX = cosines[i * 3 + 0];
+                const double sinY = sines[i * 3 + 1], cosY = cosines[i * 3 + 1];
+                const double sinZ = sines[i * 3 + 2], cosZ = cosines[i * 3 + 2];
+
+                outResult[first + i] = Matrix4x4<Type>{
+                    cosY * cosZ,                         -cosY * sinZ,                         sinY,          0.0,
+                    sinX * sinY * cosZ + cosX * sinZ,    -sinX * sinY * sinZ + cosX * cosZ,    -sinX * cosY,  0.0,
+                    -cosX * sinY * cosZ + sinX * sinZ,   cosX * sinY * sinZ + sinX * cosZ,     cosX * cosY,   0.0,
+                    0.0,                                 0.0,                                  0.0,           1.0 };
             }
         }
     }
 
 
     /// <summary>
-    /// Compute Determinant
+    /// Pairwise batched product outResult[i] = a[i] * b[i].
+    /// Floating point types use the column-broadcast SIMD kernel, fixed point the scalar one.
     /// </summary>
     /// <typeparam name="Type"></typeparam>
     /// <param name="outResult"></param>
-    /// <param name="mat"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
     template<typename Type>
-    void Determinant(Type& outResult, const Matrix4x4<Type>& mat, bool bFixedPoint /*= false*/)
+    void Multiply(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, std::span<const Matrix4x4<Type>> b)
     {
+        ETLMATH_INSTRUMENT(Matrix4x4MultiplyBatch);
+        ETLMATH_ASSERT(a.size() == b.size(), "Input spans size mismatch in Multiply");
+        ETLMATH_ASSERT(outResult.size() >= a.size(), "Output span too small in Multiply");
 
-        const Matrix3x3<Type> adj00{ Raw, mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                          mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                          mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3) };
-
-        const Matrix3x3<Type> adj01{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                          mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                          mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3) };
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            if constexpr (std::integral<Type>)
+            {
+                Multiply(outResult[i], a[i], b[i]);
+            }
+            else
+            {
+                Simd::Pack<Type, 4> aCols[4];
+                helpers::LoadColumns(aCols, a[i]);
+                helpers::MultiplyColumns(outResult[i], aCols, b[i]);
+            }
+        }
+    }
 
-        const Matrix3x3<Type> adj02{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
-                                          mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3),
-                                          mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3) };
 
-        const Matrix3x3<Type> adj03{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
-                                          mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2),
-                                          mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2) };
+    /// <summary>
+    /// Left broadcast batched product outResult[i] = a * b[i].
+    /// Floating point types keep a's four columns in registers for the whole batch.
+    /// </summary>
+    /// <typeparam name="Type"></typeparam>
+    /// <param name="outResult"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
+    template<typename Type>
+    void Multiply(std::span<Matrix4x4<Type>> outResult, const Matrix4x4<Type>& a, std::span<const Matrix4x4<Type>> b)
+    {
+        ETLMATH_INSTRUMENT(Matrix4x4MultiplyBatch);
+        ETLMATH_ASSERT(outResult.size() >= b.size(), "Output span too small in Multiply");
 
         if constexpr (std::integral<Type>)
         {
-            int64_t fixedPointDet = ((static_cast<int64_t>(mat.getRawValue(0, 0)) * adj00.determinant(true)) >> FIXED_SHIFT)
-                                  - ((static_cast<int64_t>(mat.getRawValue(0, 1)) * adj01.determinant(true)) >> FIXED_SHIFT)
-                                  + ((static_cast<int64_t>(mat.getRawValue(0, 2)) * adj02.determinant(true)) >> FIXED_SHIFT)
-                                  - ((static_cast<int64_t>(mat.getRawValue(0, 3)) * adj03.determinant(true)) >> FIXED_SHIFT);
-
-            outResult = static_cast<Type>(bFixedPoint ? fixedPointDet : fixedPointDet >> FIXED_SHIFT);
+            const Matrix4x4<Type> left = a; /// 'a' may live inside the output span
+            for (std::size_t i = 0; i < b.size(); ++i)
+                Multiply(outResult[i], left, b[i]);
         }
         else
         {
-            outResult = mat.getRawValue(0, 0) * adj00.determinant()
-                      - mat.getRawValue(0, 1) * adj01.determinant()
-                      + mat.getRawValue(0, 2) * adj02.determinant()
-                      - mat.getRawValue(0, 3) * adj03.determinant();
+            Simd::Pack<Type, 4> aCols[4];
+            helpers::LoadColumns(aCols, a);
+
+            for (std::size_t i = 0; i < b.size(); ++i)
+                helpers::MultiplyColumns(outResult[i], aCols, b[i]);
         }
     }
 
 
     /// <summary>
-    /// Compute Inverse
+    /// Right broadcast batched product outResult[i] = a[i] * b.
+    /// Floating point types use the column-broadcast SIMD kernel, fixed point the scalar one.
     /// </summary>
     /// <typeparam name="Type"></typeparam>
     /// <param name="outResult"></param>
-    /// <param name="mat"></param>
+    /// <param name="a"></param>
+    /// <param name="b"></param>
     template<typename Type>
-    bool Inverse(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat)
+    void Multiply(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, const Matrix4x4<Type>& b)
     {
-        Type det;
-        Determinant(det, mat, true);
-        if (isZero(det))
-            return false;
-
-        /// --- SAFETY CHECK FOR ALIASING ---
-        /// If outResult is the same object as mat, we must use a temporary buffer.
-        if (&outResult == &mat)
-        {
-            Matrix4x4<Type> temp;
-            bool result = Inverse(temp, mat);
+        ETLMATH_INSTRUMENT(Matrix4x4MultiplyBatch);
+        ETLMATH_ASSERT(outResult.size() >= a.size(), "Output span too small in Multiply");
 
-            if (result)
-                outResult = temp;
+        const Matrix4x4<Type> right = b; /// 'b' may live inside the output span
 
-            return result;
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            if constexpr (std::integral<Type>)
+            {
+                Multiply(outResult[i], a[i], right);
+            }
+            else
+            {
+                Simd::Pack<Type, 4> aCols[4];
+                helpers::LoadColumns(aCols, a[i]);
+                helpers::MultiplyColumns(outResult[i], aCols, right);
+            }
         }
+    }
 
-        if constexpr (std::integral<Type>)
+
+    /// <summary>
+    /// Multi-threaded pairwise product
+    /// </summary>
+    template<typename Type>
+    void MultiplyParallel(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, std::span<const Matrix4x4<Type>> b,
+                          int numThreads)
+    {
+        ETLMATH_ASSERT(a.size() == b.size(), "Input spans size mismatch in MultiplyParallel");
+        ETLMATH_ASSERT(outResult.size() >= a.size(), "Output span too small in MultiplyParallel");
+
+        ParallelFor(a.size(), MULTIPLY_PARALLEL_THRESHOLD, numThreads, [&](std::size_t begin, std::size_t end)
         {
+            Multiply(outResult.subspan(begin, end - begin), a.subspan(begin, end - begin), b.subspan(begin, end - begin));
+        });
+    }
 
-            /// Compute all 16 cofactors using Matrix3x3
-            /// Row 0 cofactors (signs: +, -, +, -)
-            const int64_t cof00 = +Matrix3x3<Type>{ Raw, mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                         mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                         mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof01 = -Matrix3x3<Type>{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof02 = +Matrix3x3<Type>{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof03 = -Matrix3x3<Type>{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2)}.determinant(true);
-
-            /// Row 1 cofactors (signs: -, +, -, +)
-            const int64_t cof10 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,1), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                         mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                         mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof11 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof12 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,3),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof13 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,2),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2)}.determinant(true);
-
-            /// Row 2 cofactors (signs: +, -, +, -)
-            const int64_t cof20 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,1), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                         mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                         mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof21 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                         mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof22 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,3),
-                                                         mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3)}.determinant(true);
-
-            const int64_t cof23 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,2),
-                                                         mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
-                                                         mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2)}.determinant(true);
-
-            /// Row 3 cofactors (signs: -, +, -, +)
-            const int64_t cof30 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,1), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                         mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                         mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3)}.determinant(true);
-
-            const int64_t cof31 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                         mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3)}.determinant(true);
-
-            const int64_t cof32 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,3),
-                                                         mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3)}.determinant(true);
-
-            const int64_t cof33 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,2),
-                                                         mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
-                                                         mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2)}.determinant(true);
-
-            /// Transpose cofactors and divide by determinant
-            outResult.setRawValue(0, 0, static_cast<Type>((cof00 << FIXED_SHIFT) / det));
-            outResult.setRawValue(0, 1, static_cast<Type>((cof10 << FIXED_SHIFT) / det));
-            outResult.setRawValue(0, 2, static_cast<Type>((cof20 << FIXED_SHIFT) / det));
-            outResult.setRawValue(0, 3, static_cast<Type>((cof30 << FIXED_SHIFT) / det));
-            outResult.setRawValue(1, 0, static_cast<Type>((cof01 << FIXED_SHIFT) / det));
-            outResult.setRawValue(1, 1, static_cast<Type>((cof11 << FIXED_SHIFT) / det));
-            outResult.setRawValue(1, 2, static_cast<Type>((cof21 << FIXED_SHIFT) / det));
-            outResult.setRawValue(1, 3, static_cast<Type>((cof31 << FIXED_SHIFT) / det));
-            outResult.setRawValue(2, 0, static_cast<Type>((cof02 << FIXED_SHIFT) / det));
-            outResult.setRawValue(2, 1, static_cast<Type>((cof12 << FIXED_SHIFT) / det));
-            outResult.setRawValue(2, 2, static_cast<Type>((cof22 << FIXED_SHIFT) / det));
-            outResult.setRawValue(2, 3, static_cast<Type>((cof32 << FIXED_SHIFT) / det));
-            outResult.setRawValue(3, 0, static_cast<Type>((cof03 << FIXED_SHIFT) / det));
-            outResult.setRawValue(3, 1, static_cast<Type>((cof13 << FIXED_SHIFT) / det));
-            outResult.setRawValue(3, 2, static_cast<Type>((cof23 << FIXED_SHIFT) / det));
-            outResult.setRawValue(3, 3, static_cast<Type>((cof33 << FIXED_SHIFT) / det));
-        }
-        else
+
+    /// <summary>
+    /// Multi-threaded left broadcast product
+    /// </summary>
+    template<typename Type>
+    void MultiplyParallel(std::span<Matrix4x4<Type>> outResult, const Matrix4x4<Type>& a, std::span<const Matrix4x4<Type>> b,
+                          int numThreads)
+    {
+        ETLMATH_ASSERT(outResult.size() >= b.size(), "Output span too small in MultiplyParallel");
+
+        const Matrix4x4<Type> left = a; /// Shared by all workers, 'a' may live inside the output span
+        ParallelFor(b.size(), MULTIPLY_PARALLEL_THRESHOLD, numThreads, [&](std::size_t begin, std::size_t end)
         {
-            /// Compute all 16 cofactors using Matrix3x3
-            /// Row 0 cofactors (signs: +, -, +, -)
-            const Type cof00 = +Matrix3x3<Type>{ Raw, mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                      mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                      mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof01 = -Matrix3x3<Type>{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof02 = +Matrix3x3<Type>{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof03 = -Matrix3x3<Type>{ Raw, mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2)}.determinant();
-
-            /// Row 1 cofactors (signs: -, +, -, +)
-            const Type cof10 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,1), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                      mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                      mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof11 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof12 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,3),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof13 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,2),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2)}.determinant();
-
-            /// Row 2 cofactors (signs: +, -, +, -)
-            const Type cof20 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,1), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                      mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                      mat.getRawValue(3,1), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof21 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                      mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,2), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof22 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,3),
-                                                      mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,3)}.determinant();
-
-            const Type cof23 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,2),
-                                                      mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
-                                                      mat.getRawValue(3,0), mat.getRawValue(3,1), mat.getRawValue(3,2)}.determinant();
-
-            /// Row 3 cofactors (signs: -, +, -, +)
-            const Type cof30 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,1), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                      mat.getRawValue(1,1), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                      mat.getRawValue(2,1), mat.getRawValue(2,2), mat.getRawValue(2,3)}.determinant();
-
-            const Type cof31 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,2), mat.getRawValue(0,3),
-                                                      mat.getRawValue(1,0), mat.getRawValue(1,2), mat.getRawValue(1,3),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,2), mat.getRawValue(2,3)}.determinant();
-
-            const Type cof32 = -Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,3),
-                                                      mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,3),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,3)}.determinant();
-
-            const Type cof33 = +Matrix3x3<Type>{ Raw, mat.getRawValue(0,0), mat.getRawValue(0,1), mat.getRawValue(0,2),
-                                                      mat.getRawValue(1,0), mat.getRawValue(1,1), mat.getRawValue(1,2),
-                                                      mat.getRawValue(2,0), mat.getRawValue(2,1), mat.getRawValue(2,2)}.determinant();
-
-            const Type invDet = Type(1) / det;
-
-            /// Transpose cofactors and multiply by invDet
-            outResult.setRawValue(0, 0, cof00 * invDet);
-            outResult.setRawValue(0, 1, cof10 * invDet);
-            outResult.setRawValue(0, 2, cof20 * invDet);
-            outResult.setRawValue(0, 3, cof30 * invDet);
-            outResult.setRawValue(1, 0, cof01 * invDet);
-            outResult.setRawValue(1, 1, cof11 * invDet);
-            outResult.setRawValue(1, 2, cof21 * invDet);
-            outResult.setRawValue(1, 3, cof31 * invDet);
-            outResult.setRawValue(2, 0, cof02 * invDet);
-            outResult.setRawValue(2, 1, cof12 * invDet);
-            outResult.setRawValue(2, 2, cof22 * invDet);
-            outResult.setRawValue(2, 3, cof32 * invDet);
-            outResult.setRawValue(3, 0, cof03 * invDet);
-            outResult.setRawValue(3, 1, cof13 * invDet);
-            outResult.setRawValue(3, 2, cof23 * invDet);
-            outResult.setRawValue(3, 3, cof33 * invDet);
-        }
+            Multiply(outResult.subspan(begin, end - begin), left, b.subspan(begin, end - begin));
+        });
+    }
 
-        return true;
+
+    /// <summary>
+    /// Multi-threaded right broadcast product
+    /// </summary>
+    template<typename Type>
+    void MultiplyParallel(std::span<Matrix4x4<Type>> outResult, std::span<const Matrix4x4<Type>> a, const Matrix4x4<Type>& b,
+                          int numThreads)
+    {
+        ETLMATH_ASSERT(outResult.size() >= a.size(), "Output span too small in MultiplyParallel");
+
+        const Matrix4x4<Type> right = b; /// Shared by all workers, 'b' may live inside the output span
+        ParallelFor(a.size(), MULTIPLY_PARALLEL_THRESHOLD, numThreads, [&](std::size_t begin, std::size_t end)
+        {
+            Multiply(outResult.subspan(begin, end - begin), a.subspan(begin, end - begin), right);
+        });
     }
 
 
     /// <summary>
-    /// Compute Transpose
+    /// Batched inverse. Floating point matrices are transposed into SoA groups of Simd::NATIVE_WIDTH
+    /// (one matrix per SIMD lane, element e of every lane in one register) and run through the
+    /// shared-minor kernel used by Inverse; the tail group is padded with identities.
+    /// Fixed point matrices go through the scalar kernel one at a time.
     /// </summary>
     /// <typeparam name="Type"></typeparam>
+    /// <param name="mats"></param>
     /// <param name="outResult"></param>
-    /// <param name="mat"></param>
+    /// <param name="ok"></param>
+    /// <returns>True when every matrix was invertible</returns>
     template<typename Type>
-    void Transpose(Matrix4x4<Type>& outResult, const Matrix4x4<Type>& mat)
+    bool InverseN(std::span<const Matrix4x4<Type>> mats, std::span<Matrix4x4<Type>> outResult, std::span<bool> ok)
     {
-        const Type elem01 = mat.getRawValue(0, 1);
-        const Type elem02 = mat.getRawValue(0, 2);
-        const Type elem03 = mat.getRawValue(0, 3);
-        const Type elem10 = mat.getRawValue(1, 0);
-        const Type elem12 = mat.getRawValue(1, 2);
-        const Type elem13 = mat.getRawValue(1, 3);
-        const Type elem20 = mat.getRawValue(2, 0);
-        const Type elem21 = mat.getRawValue(2, 1);
-        const Type elem23 = mat.getRawValue(2, 3);
-        const Type elem30 = mat.getRawValue(3, 0);
-        const Type elem31 = mat.getRawValue(3, 1);
-        const Type elem32 = mat.getRawValue(3, 2);
-
-        outResult.setRawValue(0, 1, elem10);
-        outResult.setRawValue(0, 2, elem20);
-        outResult.setRawValue(0, 3, elem30);
-        outResult.setRawValue(1, 0, elem01);
-        outResult.setRawValue(1, 2, elem21);
-        outResult.setRawValue(1, 3, elem31);
-        outResult.setRawValue(2, 0, elem02);
-        outResult.setRawValue(2, 1, elem12);
-        outResult.setRawValue(2, 3, elem32);
-        outResult.setRawValue(3, 0, elem03);
-        outResult.setRawValue(3, 1, elem13);
-        outResult.setRawValue(3, 2, elem23);
-
-        if (&outResult != &mat)
+        ETLMATH_INSTRUMENT(Matrix4x4InverseBatch);
+        ETLMATH_ASSERT(outResult.size() >= mats.size(), "Output span too small in InverseN");
+        ETLMATH_ASSERT(ok.size() >= mats.size(), "Status span too small in InverseN");
+
+        bool bAllInverted = true;
+
+        if constexpr (std::integral<Type>)
         {
-            outResult.setRawValue(0, 0, mat.getRawValue(0, 0));
-            outResult.setRawValue(1, 1, mat.getRawValue(1, 1));
-            outResult.setRawValue(2, 2, mat.getRawValue(2, 2));
-            outResult.setRawValue(3, 3, mat.getRawValue(3, 3));
+            for (std::size_t i = 0; i < mats.size(); ++i)
+            {
+                const bool bInverted = Inverse(outResult[i], mats[i]);
+                ok[i] = bInverted;
+                bAllInverted = bAllInverted && bInverted;
+            }
+        }
+        else
+        {
+            constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+            constexpr int NUM_ELEM = Matrix4x4<Type>::NUM_ELEM;
+            using Pack = Simd::Pack<Type, WIDTH>;
+
+            const Pack epsilon = Pack::Broadcast(static_cast<Type>(Epsilon<Type>::value));
+            const Pack one = Pack::Broadcast(Type(1));
+
+            for (std::size_t first = 0; first < mats.size(); first += WIDTH)
+            {
+                const int count = static_cast<int>(std::min<std::size_t>(WIDTH, mats.size() - first));
+
+                /// AoS -> SoA: each WIDTH x WIDTH block of (matrix, element) is transposed in registers,
+                /// so m[e] holds element e of every matrix of the group
+                Pack m[NUM_ELEM], adj[NUM_ELEM];
+                for (int block = 0; block < NUM_ELEM; block += WIDTH)
+                {
+                    for (int lane = 0; lane < WIDTH; ++lane)
+                        m[block + lane] = Pack::Load((lane < count ? mats[first + lane].getRawCol(0) : helpers::IDENTITY_ELEMENTS<Type>) + block);
+                    Simd::Transpose(m + block);
+                }
+
+                const Pack det = helpers::InverseCofactors(adj, m, [](const Pack& value) { return value; });
+                const int invertible = Simd::MoveMask(Simd::Abs(det) >= epsilon);
+                const Pack invDet = one / det;
+
+                for (int e = 0; e < NUM_ELEM; ++e)
+                    adj[e] = adj[e] * invDet;
+
+                for (int lane = 0; lane < count; ++lane)
+                {
+                    const bool bInvertible = (invertible >> lane) & 1;
+                    ok[first + lane] = bInvertible;
+                    bAllInverted = bAllInverted && bInvertible;
+                }
+
+                /// SoA -> AoS, only the invertible matrices are written
+                for (int block = 0; block < NUM_ELEM; block += WIDTH)
+                {
+                    Simd::Transpose(adj + block);
+                    for (int lane = 0; lane < count; ++lane)
+                        if ((invertible >> lane) & 1)
+                            adj[block + lane].store(outResult[first + lane].getRawCol(0) + block);
+                }
+            }
         }
+
+        return bAllInverted;
     }
 
 
@@ -472,9 +535,9 @@ namespace ETL::Math
     template void Rotate(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat, const Vector3<double>& rotation);
     template void Rotate(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat, const Vector3<double>& rotation);
 
-    template void SetRotation(Matrix4x4<float>&  outResult, const Matrix4x4<float>&  mat, const Vector3<double>& rotation);
-    template void SetRotation(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat, const Vector3<double>& rotation);
-    template void SetRotation(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat, const Vector3<double>& rotation);
+    template void SetRotation(Matrix4x4<float>&  outResult, const Matrix4x4<float>&  mat, const Vector3<double>& rotation, TrigPrecision precision);
+    template void SetRotation(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat, const Vector3<double>& rotation, TrigPrecision precision);
+    template void SetRotation(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat, const Vector3<double>& rotation, TrigPrecision precision);
 
     template void GetRotation(Vector3<double>& outResult, const Matrix4x4<float>&  mat);
     template void GetRotation(Vector3<double>& outResult, const Matrix4x4<double>& mat);
@@ -504,6 +567,50 @@ namespace ETL::Math
     template void Transpose(Matrix4x4<double>& outResult, const Matrix4x4<double>& mat);
     template void Transpose(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    mat);
 
+    template bool InverseProjection(Matrix4x4<float>&  outResult, const Matrix4x4<float>&  proj);
+    template bool InverseProjection(Matrix4x4<double>& outResult, const Matrix4x4<double>& proj);
+    template bool InverseProjection(Matrix4x4<int>&    outResult, const Matrix4x4<int>&    proj);
+
+    template void TransformPoints(std::span<Vector4<float>>  outClip, const Matrix4x4<float>&  mat, std::span<const Vector3<float>>  points);
+    template void TransformPoints(std::span<Vector4<double>> outClip, const Matrix4x4<double>& mat, std::span<const Vector3<double>> points);
+    template void TransformPoints(std::span<Vector4<int>>    outClip, const Matrix4x4<int>&    mat, std::span<const Vector3<int>>    points);
+
+    template void ProjectPoints(std::span<Vector3<float>>  outNdc, const Matrix4x4<float>&  viewProj, std::span<const Vector3<float>>  points);
+    template void ProjectPoints(std::span<Vector3<double>> outNdc, const Matrix4x4<double>& viewProj, std::span<const Vector3<double>> points);
+    template void ProjectPoints(std::span<Vector3<int>>    outNdc, const Matrix4x4<int>&    viewProj, std::span<const Vector3<int>>    points);
+
+    template void CreateRotations(std::span<Matrix4x4<float>>  outResult, std::span<const Vector3<double>> rotations);
+    template void CreateRotations(std::span<Matrix4x4<double>> outResult, std::span<const Vector3<double>> rotations);
+    template void CreateRotations(std::span<Matrix4x4<int>>    outResult, std::span<const Vector3<double>> rotations);
+
+    template void Multiply(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, std::span<const Matrix4x4<float>>  b);
+    template void Multiply(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, std::span<const Matrix4x4<double>> b);
+    template void Multiply(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, std::span<const Matrix4x4<int>>    b);
+
+    template void Multiply(std::span<Matrix4x4<float>>  outResult, const Matrix4x4<float>&  a, std::span<const Matrix4x4<float>>  b);
+    template void Multiply(std::span<Matrix4x4<double>> outResult, const Matrix4x4<double>& a, std::span<const Matrix4x4<double>> b);
+    template void Multiply(std::span<Matrix4x4<int>>    outResult, const Matrix4x4<int>&    a, std::span<const Matrix4x4<int>>    b);
+
+    template void Multiply(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, const Matrix4x4<float>&  b);
+    template void Multiply(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, const Matrix4x4<double>& b);
+    template void Multiply(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, const Matrix4x4<int>&    b);
+
+    template void MultiplyParallel(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, std::span<const Matrix4x4<float>>  b, int numThreads);
+    template void MultiplyParallel(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, std::span<const Matrix4x4<double>> b, int numThreads);
+    template void MultiplyParallel(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, std::span<const Matrix4x4<int>>    b, int numThreads);
+
+    template void MultiplyParallel(std::span<Matrix4x4<float>>  outResult, const Matrix4x4<float>&  a, std::span<const Matrix4x4<float>>  b, int numThreads);
+    template void MultiplyParallel(std::span<Matrix4x4<double>> outResult, const Matrix4x4<double>& a, std::span<const Matrix4x4<double>> b, int numThreads);
+    template void MultiplyParallel(std::span<Matrix4x4<int>>    outResult, const Matrix4x4<int>&    a, std::span<const Matrix4x4<int>>    b, int numThreads);
+
+    template void MultiplyParallel(std::span<Matrix4x4<float>>  outResult, std::span<const Matrix4x4<float>>  a, const Matrix4x4<float>&  b, int numThreads);
+    template void MultiplyParallel(std::span<Matrix4x4<double>> outResult, std::span<const Matrix4x4<double>> a, const Matrix4x4<double>& b, int numThreads);
+    template void MultiplyParallel(std::span<Matrix4x4<int>>    outResult, std::span<const Matrix4x4<int>>    a, const Matrix4x4<int>&    b, int numThreads);
+
+    template bool InverseN(std::span<const Matrix4x4<float>>  mats, std::span<Matrix4x4<float>>  outResult, std::span<bool> ok);
+    template bool InverseN(std::span<const Matrix4x4<double>> mats, std::span<Matrix4x4<double>> outResult, std::span<bool> ok);
+    template bool InverseN(std::span<const Matrix4x4<int>>    mats, std::span<Matrix4x4<int>>    outResult, std::span<bool> ok);
+
     template Matrix4x4<float>  operator*(float  scalar, const Matrix4x4<float>&  matrix);
     template Matrix4x4<double> operator*(double scalar, const Matrix4x4<double>& matrix);
     template Matrix4x4<int>    operator*(int    scalar, const Matrix4x4<int>&    matrix);
@@ -0,0 +1,88 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// MatrixCore.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Types/MatrixCore.h"
+#include "MathLib/Common/SimdPack.h"
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Internal helper
+
+    namespace helpers
+    {
+        /// <summary>
+        /// Rows [row, row + Width) of one result column: a.col[0] * b[0] + a.col[1] * b[1] + ...
+        /// accumulated left to right, as the scalar path does (MulAdd is never fused).
+        /// </summary>
+        template<typename Type, int Width, int Rows, int Inner>
+        inline void ProductRows(Type* out, const Type* a, const Type* b, int row)
+        {
+            using Pack = Simd::Pack<Type, Width>;
+
+            Pack sum = Pack::Load(a + row) * Pack::Broadcast(b[0]);
+            for (int k = 1; k < Inner; ++k)
+                sum = Simd::MulAdd(Pack::Load(a + k * Rows + row), Pack::Broadcast(b[k]), sum);
+
+            sum.store(out + row);
+        }
+    }
+
+
+    /// <summary>
+    /// out(Rows x Cols) = a(Rows x Inner) * b(Inner x Cols), all column-major. Each result column is
+    /// a linear combination of a's columns: full registers first, then one half register, then scalars.
+    /// </summary>
+    template<typename Type, int Rows, int Inner, int Cols>
+    void helpers::MultiplyColumnsSimd(Type* out, const Type* a, const Type* b)
+    {
+        constexpr int WIDTH = Simd::NATIVE_WIDTH<Type>;
+        constexpr int HALF_WIDTH = WIDTH / 2;
+
+        for (int col = 0; col < Cols; ++col, out += Rows, b += Inner)
+        {
+            int row = 0;
+            if constexpr (WIDTH <= Rows)
+            {
+                for (; row + WIDTH <= Rows; row += WIDTH)
+                    ProductRows<Type, WIDTH, Rows, Inner>(out, a, b, row);
+            }
+            if constexpr (HALF_WIDTH >= 2 && HALF_WIDTH <= Rows)
+            {
+                if (row + HALF_WIDTH <= Rows)
+                {
+                    ProductRows<Type, HALF_WIDTH, Rows, Inner>(out, a, b, row);
+                    row += HALF_WIDTH;
+                }
+            }
+            for (; row < Rows; ++row)
+            {
+                Type sum = a[row] * b[0];
+                for (int k = 1; k < Inner; ++k)
+                    sum += a[k * Rows + row] * b[k];
+                out[row] = sum;
+            }
+        }
+    }
+
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template void helpers::MultiplyColumnsSimd<float, 2, 2, 2>(float* out, const float* a, const float* b);
+    template void helpers::MultiplyColumnsSimd<float, 2, 2, 1>(float* out, const float* a, const float* b);
+    template void helpers::MultiplyColumnsSimd<float, 3, 4, 4>(float* out, const float* a, const float* b);
+    template void helpers::MultiplyColumnsSimd<float, 3, 4, 1>(float* out, const float* a, const float* b);
+    template void helpers::MultiplyColumnsSimd<float, 6, 6, 6>(float* out, const float* a, const float* b);
+    template void helpers::MultiplyColumnsSimd<float, 6, 6, 1>(float* out, const float* a, const float* b);
+
+    template void helpers::MultiplyColumnsSimd<double, 2, 2, 2>(double* out, const double* a, const double* b);
+    template void helpers::MultiplyColumnsSimd<double, 2, 2, 1>(double* out, const double* a, const double* b);
+    template void helpers::MultiplyColumnsSimd<double, 3, 4, 4>(double* out, const double* a, const double* b);
+    template void helpers::MultiplyColumnsSimd<double, 3, 4, 1>(double* out, const double* a, const double* b);
+    template void helpers::MultiplyColumnsSimd<double, 6, 6, 6>(double* out, const double* a, const double* b);
+    template void helpers::MultiplyColumnsSimd<double, 6, 6, 1>(double* out, const double* a, const double* b);
+
+} /// namespace ETL::Math
@@ -0,0 +1,25 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// MatrixN.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Types/MatrixN.h"
+
+namespace ETL::Math
+{
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template class MatrixN<float, 2, 2>;
+    template class MatrixN<double, 2, 2>;
+    template class MatrixN<int, 2, 2>;
+
+    template class MatrixN<float, 3, 4>;
+    template class MatrixN<double, 3, 4>;
+    template class MatrixN<int, 3, 4>;
+
+    template class MatrixN<float, 6, 6>;
+    template class MatrixN<double, 6, 6>;
+    template class MatrixN<int, 6, 6>;
+
+} /// namespace ETL::Math
@@ -0,0 +1,62 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// Quaternion.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Types/Quaternion.h"
+
+namespace ETL::Math
+{
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template class Quaternion<float>;
+    template class Quaternion<double>;
+    template class Quaternion<int>;
+
+    template void Multiply(Quaternion<float>&  outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2);
+    template void Multiply(Quaternion<double>& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2);
+    template void Multiply(Quaternion<int>&    outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2);
+
+    template void Dot(double& outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2);
+    template void Dot(double& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2);
+    template void Dot(double& outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2);
+
+    template void Length(double& outResult, const Quaternion<float>&  quat);
+    template void Length(double& outResult, const Quaternion<double>& quat);
+    template void Length(double& outResult, const Quaternion<int>&    quat);
+
+    template bool Normalize(Quaternion<float>&  outResult, const Quaternion<float>&  quat);
+    template bool Normalize(Quaternion<double>& outResult, const Quaternion<double>& quat);
+    template bool Normalize(Quaternion<int>&    outResult, const Quaternion<int>&    quat);
+
+    template void Conjugate(Quaternion<float>&  outResult, const Quaternion<float>&  quat);
+    template void Conjugate(Quaternion<double>& outResult, const Quaternion<double>& quat);
+    template void Conjugate(Quaternion<int>&    outResult, const Quaternion<int>&    quat);
+
+    template bool Inverse(Quaternion<float>&  outResult, const Quaternion<float>&  quat);
+    template bool Inverse(Quaternion<double>& outResult, const Quaternion<double>& quat);
+    template bool Inverse(Quaternion<int>&    outResult, const Quaternion<int>&    quat);
+
+    template void Rotate(Vector3<float>&  outResult, const Quaternion<float>&  quat, const Vector3<float>&  vector);
+    template void Rotate(Vector3<double>& outResult, const Quaternion<double>& quat, const Vector3<double>& vector);
+    template void Rotate(Vector3<int>&    outResult, const Quaternion<int>&    quat, const Vector3<int>&    vector);
+
+    template void ToMatrix(Matrix4x4<float>&  outResult, const Quaternion<float>&  quat);
+    template void ToMatrix(Matrix4x4<double>& outResult, const Quaternion<double>& quat);
+    template void ToMatrix(Matrix4x4<int>&    outResult, const Quaternion<int>&    quat);
+
+    template void FromMatrix(Quaternion<float>&  outResult, const Matrix4x4<float>&  mat);
+    template void FromMatrix(Quaternion<double>& outResult, const Matrix4x4<double>& mat);
+    template void FromMatrix(Quaternion<int>&    outResult, const Matrix4x4<int>&    mat);
+
+    template void Nlerp(Quaternion<float>&  outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2, double t);
+    template void Nlerp(Quaternion<double>& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2, double t);
+    template void Nlerp(Quaternion<int>&    outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2, double t);
+
+    template void Slerp(Quaternion<float>&  outResult, const Quaternion<float>&  q1, const Quaternion<float>&  q2, double t);
+    template void Slerp(Quaternion<double>& outResult, const Quaternion<double>& q1, const Quaternion<double>& q2, double t);
+    template void Slerp(Quaternion<int>&    outResult, const Quaternion<int>&    q1, const Quaternion<int>&    q2, double t);
+
+} /// namespace ETL::Math
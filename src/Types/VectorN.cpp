@@ -0,0 +1,22 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib
+/// VectorN.cpp
+///----------------------------------------------------------------------------
+
+#include "MathLib/Types/VectorN.h"
+
+namespace ETL::Math
+{
+
+    ///------------------------------------------------------------------------------------------
+    /// Explicit template instantiations (precompiled declaration)
+
+    template class VectorN<float, 6>;
+    template class VectorN<double, 6>;
+    template class VectorN<int, 6>;
+
+    template bool Normalize(VectorN<float, 6>&  outResult, const VectorN<float, 6>&  vec);
+    template bool Normalize(VectorN<double, 6>& outResult, const VectorN<double, 6>& vec);
+    template bool Normalize(VectorN<int, 6>&    outResult, const VectorN<int, 6>&    vec);
+
+} /// namespace ETL::Math
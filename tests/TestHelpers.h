@@ -0,0 +1,35 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// TestHelpers.h
+///----------------------------------------------------------------------------
+#pragma once
+
+#include <MathLib/Types/Matrix3x3.h>
+#include <cmath>
+#include <cstddef>
+
+/// Fixtures shared by several test files
+namespace TestHelpers
+{
+    /// Element count of batch tests: not a multiple of any SIMD width, so the scalar tail runs too
+    constexpr std::size_t BATCH_COUNT = 37;
+
+
+    /// Deterministic value in [-1, 1]: element 'k' of the test input 'seed' (all seeded factories draw from it)
+    inline double SeedValue(int seed, int k)
+    {
+        return std::sin(1.3 * seed + 0.7 * k + 0.2 * k * k);
+    }
+
+
+    /// Rotation about x, then about y (row-major values)
+    template<typename Type>
+    ETL::Math::Matrix3x3<Type> MakeRotation(double angleX, double angleY)
+    {
+        const double cx = std::cos(angleX), sx = std::sin(angleX);
+        const double cy = std::cos(angleY), sy = std::sin(angleY);
+        return ETL::Math::Matrix3x3<Type>{ cy,  sy * sx,  sy * cx,
+                                           0.0, cx,      -sx,
+                                          -sy,  cy * sx,  cy * cx };
+    }
+}
@@ -0,0 +1,218 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_AffineDecomposition.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include "TestHelpers.h"
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Common/FixedPointHelpers.h>
+#include <MathLib/LinearAlgebra/AffineDecomposition.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#define AFFINE_DECOMPOSITION_TYPES int, float, double
+
+namespace
+{
+    using TestHelpers::BATCH_COUNT;
+
+    /// T * R * shear * diag(scale) from decomposed parts
+    template<typename Type>
+    ETL::Math::Matrix4x4<Type> Recompose(const ETL::Math::Vector3<Type>& translation, const ETL::Math::Quaternion<Type>& rotation,
+                                         const ETL::Math::Vector3<Type>& scale, const ETL::Math::Matrix3x3<Type>& shear)
+    {
+        using ETL::Math::DecodeValue;
+
+        const ETL::Math::Matrix4x4<Type> r = rotation.toMatrix();
+        ETL::Math::Matrix4x4<Type> result = ETL::Math::Matrix4x4<Type>::Identity();
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 3; ++col)
+            {
+                double sum = 0.0;
+                for (int k = 0; k < 3; ++k)
+                    sum += DecodeValue<double>(r.getRawValue(row, k)) * DecodeValue<double>(shear.getRawValue(k, col));
+                result.setRawValue(row, col, ETL::Math::EncodeValue<Type>(sum * DecodeValue<double>(scale.getRawValue(col))));
+            }
+            result.setRawValue(row, 3, translation.getRawValue(row));
+        }
+        return result;
+    }
+
+    /// Upper 3x3 of a rotation quaternion's matrix
+    template<typename Type>
+    bool SameRotation(const ETL::Math::Quaternion<Type>& rotation, const ETL::Math::Matrix4x4<Type>& expected, double eps)
+    {
+        return ETL::Math::isEqual(rotation.toMatrix(), expected, eps);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("AffineDecomposition Decompose", "[AffineDecomposition]", AFFINE_DECOMPOSITION_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+    using Matrix3 = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using Quat = ETL::Math::Quaternion<TestType>;
+
+    constexpr double eps = 0.001;
+
+    SECTION("Translation, rotation and scale without shear")
+    {
+        const double angles[][3] = { { 0.0, 0.0, 0.0 }, { 0.3, -1.2, 2.5 }, { 1.5, 0.2, -0.7 }, { -2.9, 3.0, 0.1 } };
+        const double scales[][3] = { { 1.0, 1.0, 1.0 }, { 2.0, 0.5, 3.0 }, { 0.25, 4.0, 1.5 }, { 1.0, 1.0, 7.0 } };
+
+        for (int i = 0; i < 4; ++i)
+        {
+            const Matrix rotation = Matrix::CreateRotation(angles[i][0], angles[i][1], angles[i][2]);
+            const Matrix m = Matrix::CreateTranslation(TestType(i), TestType(-2), TestType(3)) * rotation
+                           * Matrix::CreateScale(scales[i][0], scales[i][1], scales[i][2]);
+
+            Vec3 t, s;
+            Quat r;
+            Matrix3 shear;
+            REQUIRE(ETL::Math::Decompose(m, t, r, s, &shear));
+
+            REQUIRE(ETL::Math::isEqual(t, Vec3{ double(i), -2.0, 3.0 }, eps));
+            REQUIRE(ETL::Math::isEqual(s, Vec3{ scales[i][0], scales[i][1], scales[i][2] }, eps));
+            REQUIRE(ETL::Math::isEqual(shear, Matrix3::Identity(), eps));
+            REQUIRE(SameRotation(r, rotation, eps));
+        }
+    }
+
+    SECTION("Sheared matrix reconstructs exactly")
+    {
+        Matrix shearing = Matrix::Identity();
+        shearing.setRawValue(0, 1, ETL::Math::EncodeValue<TestType>(0.4));
+        shearing.setRawValue(1, 2, ETL::Math::EncodeValue<TestType>(-0.3));
+        shearing.setRawValue(2, 0, ETL::Math::EncodeValue<TestType>(0.2));
+
+        const Matrix m = Matrix::CreateTranslation(TestType(1), TestType(2), TestType(3)) * Matrix::CreateRotation(0.4, 0.9, -0.2)
+                       * shearing * Matrix::CreateScale(1.5, 0.75, 2.0);
+
+        Vec3 t, s;
+        Quat r;
+        Matrix3 shear;
+        REQUIRE(ETL::Math::Decompose(m, t, r, s, &shear));
+
+        REQUIRE(ETL::Math::isEqual(Recompose(t, r, s, shear), m, eps));
+        for (int i = 0; i < 3; ++i)
+            REQUIRE(ETL::Math::isEqual(shear.getRawValue(i, i), ETL::Math::EncodeValue<TestType>(1.0), eps));
+
+        /// Without shear output the other parts are unchanged
+        Vec3 t2, s2;
+        Quat r2;
+        REQUIRE(ETL::Math::Decompose(m, t2, r2, s2));
+        REQUIRE(t2 == t);
+        REQUIRE(s2 == s);
+        REQUIRE(ETL::Math::isEqual(r2, r, eps));
+    }
+
+    SECTION("Mirror goes to a single negative scale")
+    {
+        Vec3 t, s;
+        Quat r;
+        Matrix3 shear;
+        REQUIRE(ETL::Math::Decompose(Matrix::CreateScale(-1.0, 2.0, 3.0), t, r, s, &shear));
+        REQUIRE(ETL::Math::isEqual(s, Vec3{ -1.0, 2.0, 3.0 }, eps));
+        REQUIRE(SameRotation(r, Matrix::Identity(), eps));
+
+        const Matrix m = Matrix::CreateRotation(0.3, -0.5, 1.1) * Matrix::CreateScale(2.0, 1.0, -0.5);
+        REQUIRE(ETL::Math::Decompose(m, t, r, s, &shear));
+        REQUIRE(ETL::Math::isEqual(Recompose(t, r, s, shear), m, eps));
+
+        int negatives = 0;
+        for (int i = 0; i < 3; ++i)
+            negatives += s.getRawValue(i) < TestType(0) ? 1 : 0;
+        REQUIRE(negatives == 1);
+    }
+
+    SECTION("Singular matrix is rejected")
+    {
+        const Vec3 t0{ 9.0, 9.0, 9.0 };
+        Vec3 t = t0, s = t0;
+        Quat r = Quat::Identity();
+
+        REQUIRE_FALSE(ETL::Math::Decompose(Matrix::CreateScale(1.0, 0.0, 2.0), t, r, s));
+        REQUIRE(t == t0);
+        REQUIRE(s == t0);
+    }
+
+    SECTION("Batch matches single")
+    {
+        std::vector<Matrix> mats(BATCH_COUNT);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            Matrix shearing = Matrix::Identity();
+            shearing.setRawValue(0, 2, ETL::Math::EncodeValue<TestType>(0.05 * double(i % 7)));
+            mats[i] = Matrix::CreateTranslation(TestType(int(i % 5)), TestType(1), TestType(-1)) * Matrix::CreateRotation(0.1 * double(i), 0.7, -0.05 * double(i))
+                    * shearing * Matrix::CreateScale(1.0 + 0.1 * double(i), i % 3 == 0 ? -1.0 : 1.0, 0.5);
+        }
+        mats[5] = Matrix::CreateScale(0.0, 1.0, 1.0);
+
+        std::vector<Vec3> translations(BATCH_COUNT), scales(BATCH_COUNT);
+        std::vector<Quat> rotations(BATCH_COUNT);
+        std::vector<Matrix3> shears(BATCH_COUNT);
+        const std::unique_ptr<bool[]> ok = std::make_unique<bool[]>(BATCH_COUNT);
+
+        REQUIRE_FALSE(ETL::Math::Decompose(std::span<const Matrix>{ mats }, std::span<Vec3>{ translations }, std::span<Quat>{ rotations },
+                                           std::span<Vec3>{ scales }, std::span<Matrix3>{ shears }, std::span<bool>{ ok.get(), BATCH_COUNT }));
+
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            Vec3 t, s;
+            Quat r;
+            Matrix3 shear;
+            const bool bSingle = ETL::Math::Decompose(mats[i], t, r, s, &shear);
+
+            REQUIRE(ok[i] == bSingle);
+            if (!bSingle)
+                continue;
+
+            REQUIRE(ETL::Math::isEqual(translations[i], t, eps));
+            REQUIRE(ETL::Math::isEqual(rotations[i], r, eps));
+            REQUIRE(ETL::Math::isEqual(scales[i], s, eps));
+            REQUIRE(ETL::Math::isEqual(shears[i], shear, eps));
+            REQUIRE(ETL::Math::isEqual(Recompose(t, r, s, shear), mats[i], eps));
+        }
+        REQUIRE_FALSE(ok[5]);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("AffineDecomposition anisotropic scale", "[AffineDecomposition]", float, double)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+    using Matrix3 = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using Quat = ETL::Math::Quaternion<TestType>;
+
+    /// Well-conditioned frames whose scales spread over 4 to 6 decades are not singular
+    const double scales[][3] = { { 100.0, 1.0, 0.01 }, { 1.0, 1.0, 5e-4 }, { 100.0, 1.0, 1e-4 }, { 1e-3, 10.0, 1000.0 } };
+    const Matrix frames[] = { Matrix::Identity(), Matrix::CreateRotation(0.3, -1.1, 0.6) };
+
+    for (const auto& scale : scales)
+    {
+        for (const Matrix& frame : frames)
+        {
+            const Matrix m = frame * Matrix::CreateScale(scale[0], scale[1], scale[2]);
+
+            Vec3 t, s;
+            Quat r;
+            REQUIRE(ETL::Math::Decompose(m, t, r, s));
+            REQUIRE(SameRotation(r, frame, 1e-3));
+            for (int i = 0; i < 3; ++i)
+                REQUIRE(std::abs(double(s.getRawValue(i)) / scale[i] - 1.0) < 1e-3);
+
+            Vec3 batchT, batchS;
+            Quat batchR;
+            bool ok = false;
+            REQUIRE(ETL::Math::Decompose(std::span<const Matrix>{ &m, 1 }, std::span<Vec3>{ &batchT, 1 }, std::span<Quat>{ &batchR, 1 },
+                                         std::span<Vec3>{ &batchS, 1 }, std::span<Matrix3>{}, std::span<bool>{ &ok, 1 }));
+            REQUIRE(ok);
+            for (int i = 0; i < 3; ++i)
+                REQUIRE(std::abs(double(batchS.getRawValue(i)) / scale[i] - 1.0) < 1e-3);
+        }
+    }
+}
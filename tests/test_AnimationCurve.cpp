@@ -0,0 +1,204 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_AnimationCurve.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Common/FixedPointHelpers.h>
+#include <MathLib/Animation/AnimationCurve.h>
+#include <MathLib/Animation/Interpolation.h>
+#include <vector>
+
+#define ANIMATION_CURVE_TYPES int, float, double
+
+namespace
+{
+    /// 11 channels: exercises the SIMD body and the scalar tail
+    constexpr int CHANNEL_COUNT = 11;
+
+    /// Key-major values: key * 10 + channel, odd channels negated
+    template<typename Type>
+    std::vector<Type> MakeKeyValues(int keyCount)
+    {
+        std::vector<Type> values;
+        for (int key = 0; key < keyCount; ++key)
+            for (int c = 0; c < CHANNEL_COUNT; ++c)
+                values.push_back(ETL::Math::EncodeValue<Type>((c % 2 ? -1.0 : 1.0) * (key * 10 + c)));
+        return values;
+    }
+
+    template<typename Type>
+    double Value(Type raw)
+    {
+        return ETL::Math::DecodeValue<double>(raw);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("AnimationCurve Step & Linear", "[AnimationCurve][core]", ANIMATION_CURVE_TYPES)
+{
+    using Curve = ETL::Math::AnimationCurve<TestType>;
+
+    const std::vector<double> times{ 0.0, 1.0, 3.0 };
+    const std::vector<TestType> values = MakeKeyValues<TestType>(3);
+    std::vector<TestType> out(CHANNEL_COUNT);
+
+    SECTION("Step holds the previous key")
+    {
+        const Curve curve(times, values, CHANNEL_COUNT, ETL::Math::CurveInterpolation::Step);
+        curve.sample(out, 2.5);
+        for (int c = 0; c < CHANNEL_COUNT; ++c)
+            REQUIRE(out[c] == values[CHANNEL_COUNT + c]);
+    }
+
+    SECTION("Linear blends the segment")
+    {
+        const Curve curve(times, values, CHANNEL_COUNT);
+        REQUIRE(curve.getKeyCount() == 3);
+        REQUIRE(curve.getChannelCount() == CHANNEL_COUNT);
+        REQUIRE(curve.getEndTime() == 3.0);
+
+        curve.sample(out, 1.5);
+        for (int c = 0; c < CHANNEL_COUNT; ++c)
+            REQUIRE(ETL::Math::isEqual(Value(out[c]), (c % 2 ? -1.0 : 1.0) * (12.5 + c), 0.001));
+    }
+
+    SECTION("Clamped ends")
+    {
+        const Curve curve(times, values, CHANNEL_COUNT);
+        curve.sample(out, -4.0);
+        for (int c = 0; c < CHANNEL_COUNT; ++c)
+            REQUIRE(out[c] == values[c]);
+
+        curve.sample(out, 7.0);
+        for (int c = 0; c < CHANNEL_COUNT; ++c)
+            REQUIRE(out[c] == values[2 * CHANNEL_COUNT + c]);
+    }
+
+    SECTION("Single key")
+    {
+        const std::vector<double> singleTime{ 2.0 };
+        const std::vector<TestType> singleValues(values.begin(), values.begin() + CHANNEL_COUNT);
+        const Curve curve(singleTime, singleValues, CHANNEL_COUNT, ETL::Math::CurveInterpolation::Cubic);
+
+        curve.sample(out, 5.0);
+        for (int c = 0; c < CHANNEL_COUNT; ++c)
+            REQUIRE(out[c] == values[c]);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("AnimationCurve Cubic", "[AnimationCurve][cubic]", ANIMATION_CURVE_TYPES)
+{
+    using Curve = ETL::Math::AnimationCurve<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    SECTION("Linear data stays linear with uneven keys")
+    {
+        const std::vector<double> times{ 0.0, 0.5, 2.0, 2.25 };
+        std::vector<TestType> values;
+        for (const double time : times)
+            for (int c = 0; c < CHANNEL_COUNT; ++c)
+                values.push_back(ETL::Math::EncodeValue<TestType>(time * (c - 5)));
+
+        const Curve curve(times, values, CHANNEL_COUNT, ETL::Math::CurveInterpolation::Cubic);
+        std::vector<TestType> out(CHANNEL_COUNT);
+        for (const double time : { 0.2, 0.5, 1.3, 2.1 })
+        {
+            curve.sample(out, time);
+            for (int c = 0; c < CHANNEL_COUNT; ++c)
+                REQUIRE(ETL::Math::isEqual(Value(out[c]), time * (c - 5), 0.001));
+        }
+    }
+
+    SECTION("Matches Hermite with Catmull-Rom tangents")
+    {
+        const std::vector<double> times{ 0.0, 1.0, 3.0, 4.0 };
+        const Vec3 keys[4]{ Vec3{ 0.0, 1.0, -2.0 }, Vec3{ 2.0, 3.0, 0.0 }, Vec3{ 1.0, -1.0, 4.0 }, Vec3{ 5.0, 0.0, 1.0 } };
+
+        std::vector<TestType> values;
+        for (const Vec3& key : keys)
+            for (int c = 0; c < 3; ++c)
+                values.push_back(key.getRawValue(c));
+
+        const Curve curve(times, values, 3, ETL::Math::CurveInterpolation::Cubic);
+
+        /// Segment [1, 3]: tangents per segment = (next - prev) / (tNext - tPrev) * duration
+        const double duration = 2.0;
+        const Vec3 m1{ 1.0 / 3.0 * duration, -2.0 / 3.0 * duration, 6.0 / 3.0 * duration };
+        const Vec3 m2{ 3.0 / 3.0 * duration, -3.0 / 3.0 * duration, 1.0 / 3.0 * duration };
+
+        Vec3 expected;
+        ETL::Math::Hermite(expected, keys[1], m1, keys[2], m2, 0.3);
+
+        std::vector<TestType> out(3);
+        curve.sample(out, 1.6);
+        REQUIRE(ETL::Math::isEqual(Vec3{ Value(out[0]), Value(out[1]), Value(out[2]) }, expected, 0.002));
+
+        /// Keys are interpolated exactly
+        curve.sample(out, 3.0);
+        REQUIRE(ETL::Math::isEqual(Vec3{ Value(out[0]), Value(out[1]), Value(out[2]) }, keys[2], 0.001));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("AnimationCurve Cursor", "[AnimationCurve][cursor]", ANIMATION_CURVE_TYPES)
+{
+    using Curve = ETL::Math::AnimationCurve<TestType>;
+
+    std::vector<double> times;
+    for (int key = 0; key < 40; ++key)
+        times.push_back(key * 0.25 + (key % 3) * 0.05);
+    const std::vector<TestType> values = MakeKeyValues<TestType>(40);
+    const Curve curve(times, values, CHANNEL_COUNT, ETL::Math::CurveInterpolation::Cubic);
+
+    SECTION("Cursor lookup matches binary search")
+    {
+        ETL::Math::CurveCursor cursor;
+        const double steps[]{ 0.01, 0.1, 0.3, 2.0, -1.5, 0.0, 0.7, -20.0, 40.0, 0.05 };
+        double time = -0.5;
+        for (int i = 0; i < 200; ++i)
+        {
+            time += steps[i % 10];
+            REQUIRE(curve.findSegment(time, cursor) == curve.findSegment(time));
+        }
+    }
+
+    SECTION("Cursor sampling matches plain sampling")
+    {
+        ETL::Math::CurveCursor cursor;
+        std::vector<TestType> withCursor(CHANNEL_COUNT);
+        std::vector<TestType> plain(CHANNEL_COUNT);
+        for (double time = -0.2; time < 11.0; time += 0.0625)
+        {
+            curve.sample(withCursor, time, cursor);
+            curve.sample(plain, time);
+            REQUIRE(withCursor == plain);
+        }
+    }
+
+    SECTION("Empty curve")
+    {
+        const Curve empty;
+        ETL::Math::CurveCursor cursor{ 3 };
+        REQUIRE(empty.findSegment(1.0, cursor) == empty.findSegment(1.0));
+        REQUIRE(cursor.segment == 0);
+    }
+
+    SECTION("Multi-instance sampling")
+    {
+        constexpr int INSTANCE_COUNT = 5;
+        const std::vector<double> instanceTimes{ 0.3, 9.0, 4.4, -1.0, 6.125 };
+        std::vector<ETL::Math::CurveCursor> cursors(INSTANCE_COUNT);
+        std::vector<TestType> out(INSTANCE_COUNT * CHANNEL_COUNT);
+        std::vector<TestType> single(CHANNEL_COUNT);
+
+        curve.sample(out, instanceTimes, cursors);
+        for (int i = 0; i < INSTANCE_COUNT; ++i)
+        {
+            curve.sample(single, instanceTimes[i]);
+            REQUIRE(std::equal(single.begin(), single.end(), out.begin() + i * CHANNEL_COUNT));
+            REQUIRE(cursors[i].segment == curve.findSegment(instanceTimes[i]));
+        }
+    }
+}
@@ -0,0 +1,224 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Decomposition3x3.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include "TestHelpers.h"
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Common/FixedPointHelpers.h>
+#include <MathLib/LinearAlgebra/Decomposition3x3.h>
+#include <cmath>
+#include <vector>
+
+#define DECOMPOSITION_TYPES int, float, double
+
+namespace
+{
+    using TestHelpers::BATCH_COUNT;
+
+    /// Deterministic dense matrix with entries in [-2, 2]
+    template<typename Type>
+    ETL::Math::Matrix3x3<Type> MakeMatrix(int seed)
+    {
+        double v[9];
+        for (int k = 0; k < 9; ++k)
+            v[k] = 2.0 * TestHelpers::SeedValue(seed, k);
+
+        return ETL::Math::Matrix3x3<Type>{ v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8] };
+    }
+
+    /// Deterministic symmetric matrix with entries in [-2, 2]
+    template<typename Type>
+    ETL::Math::Matrix3x3<Type> MakeSymmetric(int seed)
+    {
+        double v[6];
+        for (int k = 0; k < 6; ++k)
+            v[k] = 2.0 * TestHelpers::SeedValue(seed, k);
+
+        return ETL::Math::Matrix3x3<Type>{ v[0], v[1], v[3], v[1], v[2], v[4], v[3], v[4], v[5] };
+    }
+
+    /// m^T * m == identity and det(m) == +1
+    template<typename Type>
+    bool IsRotation(const ETL::Math::Matrix3x3<Type>& m, double eps)
+    {
+        ETL::Math::Matrix3x3<Type> t;
+        ETL::Math::Transpose(t, m);
+
+        Type det{};
+        ETL::Math::Determinant(det, m, std::is_same_v<Type, int>);
+
+        return ETL::Math::isEqual(t * m, ETL::Math::Matrix3x3<Type>::Identity(), eps)
+            && ETL::Math::isEqual(ETL::Math::DecodeValue<double>(det), 1.0, eps);
+    }
+
+    /// left * diag(values) * right^T
+    template<typename Type>
+    ETL::Math::Matrix3x3<Type> Recompose(const ETL::Math::Matrix3x3<Type>& left, const ETL::Math::Vector3<Type>& values,
+                                         const ETL::Math::Matrix3x3<Type>& right)
+    {
+        ETL::Math::Matrix3x3<Type> t;
+        ETL::Math::Transpose(t, right);
+        const ETL::Math::Matrix3x3<Type> diagonal{ ETL::Math::RawTag{}, values.getRawValue(0), Type(0), Type(0),
+                                                   Type(0), values.getRawValue(1), Type(0),
+                                                   Type(0), Type(0), values.getRawValue(2) };
+        return left * diagonal * t;
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Decomposition3x3 Symmetric Eigen", "[Decomposition3x3][eigen]", DECOMPOSITION_TYPES)
+{
+    using Matrix = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    constexpr double eps = 0.001;
+
+    SECTION("Known eigenvalues")
+    {
+        Vec3 values;
+        Matrix vectors;
+
+        ETL::Math::EigenSymmetric(values, vectors, Matrix{ 1.0, 0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, 2.0 });
+        REQUIRE(ETL::Math::isEqual(values, Vec3{ 3.0, 2.0, 1.0 }, eps));
+        REQUIRE(IsRotation(vectors, eps));
+
+        /// [2 1; 1 2] block has eigenvalues 3 and 1 along (1, 1) and (1, -1)
+        ETL::Math::EigenSymmetric(values, vectors, Matrix{ 2.0, 1.0, 0.0, 1.0, 2.0, 0.0, 0.0, 0.0, 5.0 });
+        REQUIRE(ETL::Math::isEqual(values, Vec3{ 5.0, 3.0, 1.0 }, eps));
+        REQUIRE(ETL::Math::isEqual(std::abs(ETL::Math::DecodeValue<double>(vectors.getRawValue(2, 0))), 1.0, eps));
+        REQUIRE(ETL::Math::isEqual(std::abs(ETL::Math::DecodeValue<double>(vectors.getRawValue(0, 1))), std::sqrt(0.5), eps));
+        REQUIRE(ETL::Math::isEqual(std::abs(ETL::Math::DecodeValue<double>(vectors.getRawValue(1, 1))), std::sqrt(0.5), eps));
+    }
+
+    SECTION("Reconstructs random symmetric matrices")
+    {
+        for (int seed = 0; seed < 64; ++seed)
+        {
+            const Matrix m = MakeSymmetric<TestType>(seed);
+
+            Vec3 values;
+            Matrix vectors;
+            ETL::Math::EigenSymmetric(values, vectors, m);
+
+            REQUIRE(ETL::Math::isEqual(Recompose(vectors, values, vectors), m, eps));
+            REQUIRE(IsRotation(vectors, eps));
+            REQUIRE(values.getRawValue(0) >= values.getRawValue(1));
+            REQUIRE(values.getRawValue(1) >= values.getRawValue(2));
+        }
+    }
+
+    SECTION("Only the lower triangle is read")
+    {
+        const Matrix m = MakeSymmetric<TestType>(5);
+        Matrix upperGarbage = m;
+        upperGarbage.setRawValue(0, 1, ETL::Math::EncodeValue<TestType>(7.0));
+        upperGarbage.setRawValue(0, 2, ETL::Math::EncodeValue<TestType>(-3.0));
+        upperGarbage.setRawValue(1, 2, ETL::Math::EncodeValue<TestType>(1.5));
+
+        Vec3 values, valuesGarbage;
+        Matrix vectors, vectorsGarbage;
+        ETL::Math::EigenSymmetric(values, vectors, m);
+        ETL::Math::EigenSymmetric(valuesGarbage, vectorsGarbage, upperGarbage);
+
+        REQUIRE(values == valuesGarbage);
+        REQUIRE(vectors == vectorsGarbage);
+    }
+
+    SECTION("Batch matches single")
+    {
+        std::vector<Matrix> mats(BATCH_COUNT), vectors(BATCH_COUNT);
+        std::vector<Vec3> values(BATCH_COUNT);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            mats[i] = MakeSymmetric<TestType>(static_cast<int>(i));
+
+        ETL::Math::EigenSymmetric(std::span<Vec3>{ values }, std::span<Matrix>{ vectors }, std::span<const Matrix>{ mats });
+
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            Vec3 single;
+            Matrix singleVectors;
+            ETL::Math::EigenSymmetric(single, singleVectors, mats[i]);
+
+            REQUIRE(ETL::Math::isEqual(values[i], single, eps));
+            REQUIRE(ETL::Math::isEqual(vectors[i], singleVectors, eps));
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Decomposition3x3 SVD", "[Decomposition3x3][svd]", DECOMPOSITION_TYPES)
+{
+    using Matrix = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    constexpr double eps = 0.001;
+
+    SECTION("Reconstructs random matrices")
+    {
+        for (int seed = 0; seed < 64; ++seed)
+        {
+            const Matrix m = MakeMatrix<TestType>(seed);
+
+            Matrix u, v;
+            Vec3 sigma;
+            ETL::Math::SVD(u, sigma, v, m);
+
+            REQUIRE(ETL::Math::isEqual(Recompose(u, sigma, v), m, eps));
+            REQUIRE(IsRotation(u, eps));
+            REQUIRE(IsRotation(v, eps));
+            REQUIRE(sigma.getRawValue(0) >= sigma.getRawValue(1));
+            REQUIRE(sigma.getRawValue(1) >= ETL::Math::helpers::abs(sigma.getRawValue(2)));
+        }
+    }
+
+    SECTION("Reflection puts the sign on the smallest singular value")
+    {
+        /// Rotation-like matrix with singular values (2, 1, 0.5), mirrored along Z: det < 0
+        const Matrix m{ 0.0, 2.0, 0.0, -1.0, 0.0, 0.0, 0.0, 0.0, 0.5 };
+        const Matrix reflection = m * Matrix{ 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, -1.0 };
+
+        Matrix u, v;
+        Vec3 sigma;
+        ETL::Math::SVD(u, sigma, v, reflection);
+
+        REQUIRE(ETL::Math::isEqual(sigma, Vec3{ 2.0, 1.0, -0.5 }, eps));
+        REQUIRE(ETL::Math::isEqual(Recompose(u, sigma, v), reflection, eps));
+        REQUIRE(IsRotation(u, eps));
+        REQUIRE(IsRotation(v, eps));
+    }
+
+    SECTION("Rank deficient matrix")
+    {
+        const Matrix m{ 1.0, 2.0, 3.0, 2.0, 4.0, 6.0, -1.0, 0.0, 1.0 };
+
+        Matrix u, v;
+        Vec3 sigma;
+        ETL::Math::SVD(u, sigma, v, m);
+
+        REQUIRE(ETL::Math::isZero(sigma.getRawValue(2), eps));
+        REQUIRE(ETL::Math::isEqual(Recompose(u, sigma, v), m, eps));
+        REQUIRE(IsRotation(u, eps));
+    }
+
+    SECTION("Batch matches single")
+    {
+        std::vector<Matrix> mats(BATCH_COUNT), us(BATCH_COUNT), vs(BATCH_COUNT);
+        std::vector<Vec3> sigmas(BATCH_COUNT);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            mats[i] = MakeMatrix<TestType>(static_cast<int>(i));
+
+        ETL::Math::SVD(std::span<Matrix>{ us }, std::span<Vec3>{ sigmas }, std::span<Matrix>{ vs }, std::span<const Matrix>{ mats });
+
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            Matrix u, v;
+            Vec3 sigma;
+            ETL::Math::SVD(u, sigma, v, mats[i]);
+
+            REQUIRE(ETL::Math::isEqual(sigmas[i], sigma, eps));
+            REQUIRE(ETL::Math::isEqual(us[i], u, eps));
+            REQUIRE(ETL::Math::isEqual(vs[i], v, eps));
+        }
+    }
+}
@@ -0,0 +1,80 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_DualQuaternion.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Types/DualQuaternion.h>
+
+#define DUALQUATERNION_TYPES int, float, double
+
+TEMPLATE_TEST_CASE("DualQuaternion Rigid Transforms", "[DualQuaternion][core]", DUALQUATERNION_TYPES)
+{
+    using DualQuat = ETL::Math::DualQuaternion<TestType>;
+    using Quat = ETL::Math::Quaternion<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+
+    constexpr double eps = 0.001;
+
+    const Quat rotation = Quat::CreateFromEuler(0.4, -0.2, 0.9);
+    const Vec3 translation{ TestType(1), TestType(-2), TestType(3) };
+    const DualQuat dq = DualQuat::CreateFromRotationTranslation(rotation, translation);
+
+    SECTION("Identity")
+    {
+        const Vec3 p{ TestType(1), TestType(2), TestType(3) };
+        REQUIRE(DualQuat::Identity().transformPoint(p) == p);
+        REQUIRE(DualQuat::Identity().getTranslation() == Vec3::Zero());
+    }
+
+    SECTION("Rotation and translation round trip")
+    {
+        REQUIRE(ETL::Math::isEqual(dq.getRotation(), rotation, eps));
+        REQUIRE(ETL::Math::isEqual(dq.getTranslation(), translation, eps));
+    }
+
+    SECTION("Transform point and direction")
+    {
+        const Vec3 p{ TestType(2), TestType(0), TestType(-1) };
+        REQUIRE(ETL::Math::isEqual(dq.transformPoint(p), rotation.rotate(p) + translation, eps));
+        REQUIRE(ETL::Math::isEqual(dq.transformDirection(p), rotation.rotate(p), eps));
+    }
+
+    SECTION("Matches the equivalent matrix")
+    {
+        const Matrix m = Matrix::CreateTranslation(translation.x(), translation.y(), translation.z()) * Matrix::CreateRotation(0.4, -0.2, 0.9);
+        REQUIRE(ETL::Math::isEqual(dq.toMatrix(), m, eps));
+
+        const DualQuat fromMatrix = DualQuat::CreateFromMatrix(m);
+        const Vec3 p{ TestType(1), TestType(1), TestType(-2) };
+        REQUIRE(ETL::Math::isEqual(fromMatrix.transformPoint(p), m.transformPoint(p), eps));
+    }
+
+    SECTION("Composition applies the right operand first")
+    {
+        const DualQuat other = DualQuat::CreateFromRotationTranslation(
+            Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 0.0, 1.0, 0.0 }, 1.2), Vec3{ TestType(0), TestType(4), TestType(0) });
+        const Vec3 p{ TestType(1), TestType(0), TestType(2) };
+
+        REQUIRE(ETL::Math::isEqual((dq * other).transformPoint(p), dq.transformPoint(other.transformPoint(p)), eps));
+        REQUIRE(ETL::Math::isEqual((dq * other).toMatrix(), dq.toMatrix() * other.toMatrix(), eps));
+    }
+
+    SECTION("Inverse undoes transform")
+    {
+        const Vec3 p{ TestType(3), TestType(-1), TestType(2) };
+        REQUIRE(ETL::Math::isEqual(dq.inverse().transformPoint(dq.transformPoint(p)), p, eps));
+    }
+
+    SECTION("Normalize restores a unit rigid transform")
+    {
+        const DualQuat scaled{ dq.getReal() * TestType(2), dq.getDual() * TestType(2) + dq.getReal() * TestType(1) };
+        const DualQuat unit = scaled.normalize();
+
+        REQUIRE(ETL::Math::isEqual(unit.getReal().length(), 1.0, eps));
+        REQUIRE(ETL::Math::isZero(unit.getReal().dot(unit.getDual()), eps));
+        REQUIRE(ETL::Math::isEqual(unit.getRotation(), rotation, eps));
+        REQUIRE(ETL::Math::isEqual(unit.getTranslation(), translation, eps));
+    }
+}
@@ -0,0 +1,87 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_FastTrig.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/FastTrig.h>
+#include <cmath>
+#include <vector>
+
+#define FASTTRIG_TYPES float, double
+
+/// Scalar functions are usable in constant expressions
+static_assert(ETL::Math::FastTrig::Sin(0.0) == 0.0);
+static_assert(ETL::Math::FastTrig::Cos(0.0) == 1.0);
+static_assert(ETL::Math::FastTrig::Sin(1.0) > 0.8414709848078 && ETL::Math::FastTrig::Sin(1.0) < 0.8414709848079);
+
+template<typename Type>
+constexpr double MaxError()
+{
+    if constexpr (std::is_same_v<Type, float>)
+        return ETL::Math::FastTrig::MAX_ERROR_FLOAT;
+    else
+        return ETL::Math::FastTrig::MAX_ERROR_DOUBLE;
+}
+
+TEMPLATE_TEST_CASE("FastTrig Scalar", "[FastTrig]", FASTTRIG_TYPES)
+{
+    SECTION("Error bound against the standard library")
+    {
+        /// The documented range [-8192, 8192], 200001 samples
+        double maxError = 0.0;
+        for (int i = -100000; i <= 100000; ++i)
+        {
+            const TestType angle = TestType(i * (8192.0 / 100000.0));
+            TestType s{}, c{};
+            ETL::Math::FastTrig::SinCos(s, c, angle);
+
+            maxError = std::max(maxError, std::abs(double(s) - std::sin(double(angle))));
+            maxError = std::max(maxError, std::abs(double(c) - std::cos(double(angle))));
+        }
+        REQUIRE(maxError <= MaxError<TestType>());
+    }
+
+    SECTION("Quadrant boundaries")
+    {
+        constexpr double PI = 3.14159265358979323846;
+        for (int quadrant = -8; quadrant <= 8; ++quadrant)
+        {
+            const TestType angle = TestType(quadrant * PI / 2.0);
+            REQUIRE(std::abs(double(ETL::Math::FastTrig::Sin(angle)) - std::sin(double(angle))) <= MaxError<TestType>());
+            REQUIRE(std::abs(double(ETL::Math::FastTrig::Cos(angle)) - std::cos(double(angle))) <= MaxError<TestType>());
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("FastTrig Batch", "[FastTrig]", FASTTRIG_TYPES)
+{
+    SECTION("Batch agrees with scalar (full packs and tail)")
+    {
+        constexpr std::size_t COUNT = 1003;
+        std::vector<TestType> angles(COUNT), sines(COUNT), cosines(COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+            angles[i] = TestType(-50.0 + 0.1 * double(i));
+
+        ETL::Math::FastTrig::SinCos(std::span<TestType>{ sines }, std::span<TestType>{ cosines }, std::span<const TestType>{ angles });
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            TestType s{}, c{};
+            ETL::Math::FastTrig::SinCos(s, c, angles[i]);
+            REQUIRE(std::abs(double(sines[i]) - double(s)) <= MaxError<TestType>());
+            REQUIRE(std::abs(double(cosines[i]) - double(c)) <= MaxError<TestType>());
+        }
+    }
+
+    SECTION("Outputs may alias the input")
+    {
+        std::vector<TestType> values{ TestType(0.5), TestType(-2.0), TestType(7.0) }, cosines(3);
+        const std::vector<TestType> angles = values;
+
+        ETL::Math::FastTrig::SinCos(std::span<TestType>{ values }, std::span<TestType>{ cosines }, std::span<const TestType>{ values });
+
+        for (std::size_t i = 0; i < 3; ++i)
+            REQUIRE(std::abs(double(values[i]) - std::sin(double(angles[i]))) <= MaxError<TestType>());
+    }
+}
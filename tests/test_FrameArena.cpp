@@ -0,0 +1,196 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_FrameArena.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/FrameArena.h>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Animation/Skinning.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#define FRAMEARENA_TYPES int, float, double
+
+TEST_CASE("FrameArena bump allocation", "[FrameArena]")
+{
+    using ETL::Math::FrameArena;
+
+    FrameArena arena(1024);
+    REQUIRE(arena.getBlockCount() == 1);
+    REQUIRE(arena.getCapacity() == 1024);
+
+    SECTION("Alignment")
+    {
+        for (std::size_t alignment : { 1, 2, 4, 8, 16, 32, 64, 128 })
+        {
+            arena.allocateBytes(3, 1); /// misalign the cursor
+            void* data = arena.allocateBytes(24, alignment);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(data) % alignment == 0);
+        }
+    }
+
+    SECTION("Allocations do not overlap")
+    {
+        std::span<int> a = arena.allocate<int>(10);
+        std::span<int> b = arena.allocate<int>(10);
+        REQUIRE(b.data() >= a.data() + a.size());
+        REQUIRE(arena.getUsedBytes() >= 20 * sizeof(int));
+    }
+
+    SECTION("Scope rewinds, nested scopes too")
+    {
+        arena.allocateBytes(100);
+        const std::size_t used = arena.getUsedBytes();
+        void* first = nullptr;
+        {
+            FrameArena::Scope outer(arena);
+            first = arena.allocateBytes(200);
+            {
+                FrameArena::Scope inner(arena);
+                arena.allocateBytes(300);
+            }
+            REQUIRE(arena.allocateBytes(8, 1) == static_cast<std::byte*>(first) + 200);
+        }
+        REQUIRE(arena.getUsedBytes() == used);
+        REQUIRE(arena.allocateBytes(200) == first);
+    }
+
+    SECTION("Grows, then merges its blocks on reset")
+    {
+        for (int i = 0; i < 10; ++i)
+            arena.allocateBytes(500);
+        REQUIRE(arena.getBlockCount() > 1);
+        REQUIRE(arena.getPeakBytes() >= 5000);
+
+        const std::size_t capacity = arena.getCapacity();
+        arena.reset();
+        REQUIRE(arena.getBlockCount() == 1);
+        REQUIRE(arena.getCapacity() == capacity);
+        REQUIRE(arena.getUsedBytes() == 0);
+
+        /// Steady state: the same frame fits without a new block
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            for (int i = 0; i < 10; ++i)
+                arena.allocateBytes(500);
+            arena.reset();
+            REQUIRE(arena.getBlockCount() == 1);
+            REQUIRE(arena.getCapacity() == capacity);
+        }
+    }
+
+    SECTION("Blocks kept across a rewind are reused")
+    {
+        const FrameArena::Marker start = arena.getMarker();
+        arena.allocateBytes(1000);
+        void* spilled = arena.allocateBytes(1000);
+        const std::size_t blocks = arena.getBlockCount();
+
+        arena.rewind(start);
+        arena.allocateBytes(1000);
+        REQUIRE(arena.allocateBytes(1000) == spilled);
+        REQUIRE(arena.getBlockCount() == blocks);
+    }
+
+    SECTION("Oversized and over-aligned requests")
+    {
+        void* big = arena.allocateBytes(10000, 256);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(big) % 256 == 0);
+        REQUIRE(arena.getCapacity() >= 10000 + 1024);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("FrameArena typed and pmr allocation", "[FrameArena]", FRAMEARENA_TYPES)
+{
+    using namespace ETL::Math;
+    using Matrix = Matrix4x4<TestType>;
+    using Vec3 = Vector3<TestType>;
+
+    FrameArena arena;
+
+    SECTION("Typed spans")
+    {
+        std::span<Matrix> mats = arena.allocate<Matrix>(37, FrameArena::BLOCK_ALIGNMENT);
+        std::span<Vec3> points = arena.allocate<Vec3>(37);
+        REQUIRE(mats.size() == 37);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(mats.data()) % FrameArena::BLOCK_ALIGNMENT == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(points.data()) % alignof(Vec3) == 0);
+
+        for (std::size_t i = 0; i < mats.size(); ++i)
+        {
+            mats[i] = Matrix::CreateTranslation(TestType(double(i)), TestType(0), TestType(0));
+            points[i] = mats[i].getTranslation();
+        }
+        for (std::size_t i = 0; i < mats.size(); ++i)
+            REQUIRE(points[i] == Vec3{ TestType(double(i)), TestType(0), TestType(0) });
+    }
+
+    SECTION("ScratchVector lives in the arena")
+    {
+        ScratchVector<Vec3> points(&arena);
+        for (int i = 0; i < 37; ++i)
+            points.push_back(Vec3{ TestType(i), TestType(1), TestType(2) });
+
+        REQUIRE(arena.getUsedBytes() >= points.size() * sizeof(Vec3));
+        REQUIRE(points[36] == Vec3{ TestType(36), TestType(1), TestType(2) });
+
+        const std::size_t used = arena.getUsedBytes();
+        points.clear();
+        points.shrink_to_fit();
+        REQUIRE(arena.getUsedBytes() == used); /// freed with the arena only
+    }
+
+    SECTION("Scratch of each thread is its own")
+    {
+        FrameArena* mainScratch = &GetMathScratch();
+        FrameArena* otherScratch = nullptr;
+        std::thread([&otherScratch]() { otherScratch = &GetMathScratch(); }).join();
+        REQUIRE(mainScratch == &GetMathScratch());
+        REQUIRE(otherScratch != mainScratch);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("FrameArena skinning scratch", "[FrameArena]", FRAMEARENA_TYPES)
+{
+    using namespace ETL::Math;
+    using Matrix = Matrix4x4<TestType>;
+    using Vec3 = Vector3<TestType>;
+
+    constexpr std::size_t COUNT = 37;
+
+    std::vector<Matrix> palette(8);
+    for (std::size_t i = 0; i < palette.size(); ++i)
+        palette[i] = Matrix::CreateTranslation(TestType(double(i)), TestType(1), TestType(0)) * Matrix::CreateRotation(0.1 * double(i), 0.0, 0.2);
+
+    std::vector<Vec3> positions(COUNT);
+    std::vector<BoneWeights> weights(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        positions[i] = Vec3{ 0.5 * double(i), 1.0, -0.25 * double(i) };
+        weights[i] = { { std::uint16_t(i % 8), std::uint16_t((i + 3) % 8), 0, 0 }, { 0.75f, 0.25f, 0.0f, 0.0f } };
+    }
+
+    std::vector<Vec3> expected(COUNT), skinned(COUNT);
+    SkinVertices<TestType>(SkinningOutput<TestType>{ expected }, palette, SkinningInput<TestType>{ positions, weights });
+
+    FrameArena arena(256); /// too small for the flattened palette: forces one growth
+    arena.allocateBytes(16);
+    const std::size_t used = arena.getUsedBytes();
+
+    SkinVertices<TestType>(SkinningOutput<TestType>{ skinned }, palette, SkinningInput<TestType>{ positions, weights }, arena);
+    REQUIRE(arena.getUsedBytes() == used);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        REQUIRE(skinned[i] == expected[i]);
+
+    /// Steady state: the palette now fits, no new block
+    arena.reset();
+    const std::size_t blocks = arena.getBlockCount();
+    SkinVerticesParallel<TestType>(SkinningOutput<TestType>{ skinned }, palette, SkinningInput<TestType>{ positions, weights }, 2, arena);
+    REQUIRE(arena.getBlockCount() == blocks);
+    REQUIRE(arena.getUsedBytes() == 0);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        REQUIRE(skinned[i] == expected[i]);
+}
@@ -0,0 +1,337 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Gjk.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include "TestHelpers.h"
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Geometry/Gjk.h>
+#include <MathLib/Geometry/Overlap.h>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#define GJK_TYPES int, float, double
+
+namespace
+{
+    template<typename Type>
+    ETL::Math::Obb<Type> MakeBox(double x, double y, double z, double halfExtent)
+    {
+        return ETL::Math::Obb<Type>{ ETL::Math::Vector3<Type>{ x, y, z }, ETL::Math::Matrix3x3<Type>::Identity(),
+                                     ETL::Math::Vector3<Type>{ halfExtent, halfExtent, halfExtent } };
+    }
+
+    template<typename Type>
+    double Component(const ETL::Math::Vector3<Type>& vector, int index)
+    {
+        return ETL::Math::DecodeValue<double>(vector.getRawValue(index));
+    }
+
+    template<typename Type>
+    bool IsNear(const ETL::Math::Vector3<Type>& vector, double x, double y, double z, double margin)
+    {
+        return std::abs(Component(vector, 0) - x) <= margin && std::abs(Component(vector, 1) - y) <= margin && std::abs(Component(vector, 2) - z) <= margin;
+    }
+
+    /// Position tolerance: fixed point quantization and float rounding
+    template<typename Type>
+    constexpr double MARGIN = std::is_same_v<Type, double> ? 1e-6 : 1e-3;
+
+    /// Closest points of curved shapes given by a callable: GJK converges the distance much faster than the points
+    template<typename Type>
+    constexpr double CURVED_MARGIN = std::is_same_v<Type, double> ? 1e-5 : 1e-2;
+}
+
+
+TEMPLATE_TEST_CASE("Gjk Support", "[Gjk]", GJK_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+    using Direction = Vector3<CalcType<TestType>>;
+    constexpr double margin = MARGIN<TestType>;
+
+    Vector result;
+
+    SECTION("Sphere")
+    {
+        const Sphere<TestType> sphere{ Vector{ 1.0, 2.0, 3.0 }, 2.0 };
+        Support(result, sphere, Direction{ 0.0, 0.0, -5.0 });
+        REQUIRE(IsNear(result, 1.0, 2.0, 1.0, margin));
+
+        Support(result, sphere, Direction{ 0.0, 0.0, 0.0 });
+        REQUIRE(IsNear(result, 3.0, 2.0, 3.0, margin));
+    }
+
+    SECTION("Capsule")
+    {
+        const Capsule<TestType> capsule{ Vector{ 0.0, 0.0, 0.0 }, Vector{ 0.0, 4.0, 0.0 }, 0.5 };
+        Support(result, capsule, Direction{ 1.0, 1.0, 0.0 });
+        REQUIRE(IsNear(result, 0.5 / std::sqrt(2.0), 4.0 + 0.5 / std::sqrt(2.0), 0.0, margin));
+
+        Support(result, capsule, Direction{ 0.0, -1.0, 0.0 });
+        REQUIRE(IsNear(result, 0.0, -0.5, 0.0, margin));
+    }
+
+    SECTION("Box")
+    {
+        const Obb<TestType> box{ Vector{ 1.0, 0.0, 0.0 }, TestHelpers::MakeRotation<TestType>(0.0, 0.5), Vector{ 1.0, 2.0, 3.0 } };
+        Support(result, box, Direction{ 0.3, -1.0, 0.2 });
+
+        /// The support is the corner with the largest projection
+        double best = -1e9;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            double point[3] = { 1.0, 0.0, 0.0 };
+            for (int k = 0; k < 3; ++k)
+            {
+                const double sign = (corner >> k) & 1 ? 1.0 : -1.0;
+                for (int i = 0; i < 3; ++i)
+                    point[i] += sign * Component(box.getAxis(k), i) * Component(box.getHalfExtents(), k);
+            }
+            best = std::max(best, 0.3 * point[0] - point[1] + 0.2 * point[2]);
+        }
+        REQUIRE(0.3 * Component(result, 0) - Component(result, 1) + 0.2 * Component(result, 2) == Catch::Approx(best).margin(margin));
+    }
+
+    SECTION("Convex hull")
+    {
+        const std::vector<Vector> points{ Vector{ 0.0, 0.0, 0.0 }, Vector{ 2.0, 0.0, 0.0 }, Vector{ 0.0, 2.0, 0.0 }, Vector{ 2.0, 2.0, 1.0 } };
+        Support(result, std::span<const Vector>{ points }, Direction{ 1.0, 1.0, 0.0 });
+        REQUIRE(result == points[3]);
+
+        Support(result, std::span<const Vector>{ points }, Direction{ 0.0, 1.0, 0.0 });
+        REQUIRE(result == points[2]);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Gjk Distance", "[Gjk]", GJK_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+    constexpr double margin = MARGIN<TestType>;
+
+    GjkCache<TestType> cache;
+    GjkResult<TestType> result;
+
+    SECTION("Sphere-sphere")
+    {
+        const Sphere<TestType> a{ Vector{ 0.0, 0.0, 0.0 }, 1.0 };
+        const Sphere<TestType> b{ Vector{ 3.0, 4.0, 0.0 }, 1.5 };
+        REQUIRE(GjkDistance(result, a, b, cache));
+        REQUIRE(result.distance == Catch::Approx(2.5).margin(margin));
+        REQUIRE(IsNear(result.pointA, 0.6, 0.8, 0.0, margin));
+        REQUIRE(IsNear(result.pointB, 2.1, 2.8, 0.0, margin));
+        REQUIRE(IsNear(result.normal, 0.6, 0.8, 0.0, margin));
+        REQUIRE_FALSE(result.intersecting);
+    }
+
+    SECTION("Box-box, face to edge")
+    {
+        const Obb<TestType> a = MakeBox<TestType>(0.0, 0.0, 0.0, 1.0);
+        const Obb<TestType> b{ Vector{ 3.5, 0.25, 0.0 }, TestHelpers::MakeRotation<TestType>(0.0, 0.7853981633974483), Vector{ 1.0, 1.0, 1.0 } };
+
+        /// B is turned 45 degrees about y: its closest edge is at x = 3.5 - sqrt(2)
+        REQUIRE(GjkDistance(result, a, b, cache));
+        REQUIRE(result.distance == Catch::Approx(2.5 - std::sqrt(2.0)).margin(margin));
+        REQUIRE(Component(result.pointA, 0) == Catch::Approx(1.0).margin(margin));
+        REQUIRE(Component(result.pointB, 0) == Catch::Approx(3.5 - std::sqrt(2.0)).margin(margin));
+        REQUIRE(IsNear(result.normal, 1.0, 0.0, 0.0, margin));
+    }
+
+    SECTION("Capsule-capsule and capsule-box")
+    {
+        const Capsule<TestType> a{ Vector{ 0.0, 0.0, 0.0 }, Vector{ 0.0, 2.0, 0.0 }, 0.5 };
+        const Capsule<TestType> b{ Vector{ 2.0, 1.0, 0.0 }, Vector{ 2.0, 3.0, 0.0 }, 0.25 };
+        REQUIRE(GjkDistance(result, a, b, cache));
+        REQUIRE(result.distance == Catch::Approx(1.25).margin(margin));
+
+        GjkCache<TestType> boxCache;
+        REQUIRE(GjkDistance(result, a, MakeBox<TestType>(0.0, 5.0, 0.0, 1.0), boxCache));
+        REQUIRE(result.distance == Catch::Approx(1.5).margin(margin));
+        REQUIRE(IsNear(result.normal, 0.0, 1.0, 0.0, margin));
+    }
+
+    SECTION("Convex hull and a support callable")
+    {
+        const std::vector<Vector> points{ Vector{ 0.0, 0.0, 0.0 }, Vector{ 1.0, 0.0, 0.0 }, Vector{ 0.0, 1.0, 0.0 }, Vector{ 0.0, 0.0, 1.0 } };
+        const std::span<const Vector> hull{ points };
+
+        /// Unit sphere around (2, 2, 2), as a lambda: the plane x + y + z = 1 is sqrt(3) * 5 / 3 from its center
+        auto sphere = [](Vector& outPoint, const Vector3<CalcType<TestType>>& direction)
+        {
+            Support(outPoint, Sphere<TestType>{ Vector{ 2.0, 2.0, 2.0 }, 1.0 }, direction);
+        };
+
+        REQUIRE(GjkDistance(result, hull, sphere, cache));
+        REQUIRE(result.distance == Catch::Approx(5.0 / std::sqrt(3.0) - 1.0).margin(margin));
+        REQUIRE(IsNear(result.pointA, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0, CURVED_MARGIN<TestType>));
+    }
+
+    SECTION("Intersecting: no distance, a common point")
+    {
+        const Obb<TestType> a = MakeBox<TestType>(0.0, 0.0, 0.0, 1.0);
+        const Sphere<TestType> b{ Vector{ 1.5, 0.5, 0.0 }, 1.0 };
+        REQUIRE_FALSE(GjkDistance(result, a, b, cache));
+        REQUIRE(result.intersecting);
+        REQUIRE(result.distance == 0.0);
+        REQUIRE(IsNear(result.pointA, Component(result.pointB, 0), Component(result.pointB, 1), Component(result.pointB, 2), margin));
+        REQUIRE(std::abs(Component(result.pointA, 0)) <= 1.0 + margin);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Gjk Intersect", "[Gjk]", GJK_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+
+    /// Rotated boxes, capsules and spheres on a lattice of offsets: same answer as the dedicated overlap tests
+    int tested = 0;
+    for (int i = 0; i < 216; ++i)
+    {
+        const Vector offset{ 0.45 * (i % 6) - 1.1, 0.45 * ((i / 6) % 6) - 1.2, 0.45 * (i / 36) - 1.05 };
+        const Obb<TestType> boxA{ Vector{ 0.0, 0.0, 0.0 }, TestHelpers::MakeRotation<TestType>(0.3, 0.2), Vector{ 0.6, 0.3, 0.4 } };
+        const Obb<TestType> boxB{ offset, TestHelpers::MakeRotation<TestType>(-0.4, 0.9), Vector{ 0.2, 0.5, 0.3 } };
+        const Capsule<TestType> capsuleA{ Vector{ -0.5, 0.0, 0.0 }, Vector{ 0.5, 0.2, 0.0 }, 0.3 };
+        const Capsule<TestType> capsuleB{ offset, offset + Vector{ 0.0, 0.3, 0.6 }, 0.2 };
+        const Sphere<TestType> sphere{ offset, 0.35 };
+
+        /// Skip the touching configurations, where either answer is right
+        Vector onA, onB;
+        ClosestPointsSegmentSegment(onA, onB, capsuleA.getStart(), capsuleA.getEnd(), capsuleB.getStart(), capsuleB.getEnd());
+        double gap = 0.0;
+        for (int k = 0; k < 3; ++k)
+            gap += (Component(onA, k) - Component(onB, k)) * (Component(onA, k) - Component(onB, k));
+        if (std::abs(std::sqrt(gap) - 0.5) < 1e-3)
+            continue;
+        ++tested;
+
+        GjkCache<TestType> boxCache, capsuleCache, sphereCache;
+        REQUIRE(GjkIntersect(boxA, boxB, boxCache) == OverlapObbObb(boxA, boxB));
+        REQUIRE(GjkIntersect(capsuleA, capsuleB, capsuleCache) == OverlapCapsuleCapsule(capsuleA, capsuleB));
+        REQUIRE(GjkIntersect(sphere, capsuleA, sphereCache) == OverlapSphereCapsule(sphere, capsuleA));
+    }
+    REQUIRE(tested > 200);
+}
+
+
+TEMPLATE_TEST_CASE("Gjk Epa Penetration", "[Gjk]", GJK_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+    constexpr double margin = MARGIN<TestType>;
+
+    GjkCache<TestType> cache;
+    GjkResult<TestType> result;
+
+    SECTION("Box-box")
+    {
+        const Obb<TestType> a = MakeBox<TestType>(0.0, 0.0, 0.0, 1.0);
+        const Obb<TestType> b = MakeBox<TestType>(1.5, 0.2, 0.1, 1.0);
+        REQUIRE(EpaPenetration(result, a, b, cache));
+        REQUIRE(result.intersecting);
+        REQUIRE(result.depth == Catch::Approx(0.5).margin(margin));
+        REQUIRE(IsNear(result.normal, 1.0, 0.0, 0.0, margin));
+        REQUIRE(Component(result.pointA, 0) == Catch::Approx(1.0).margin(margin));
+        REQUIRE(Component(result.pointB, 0) == Catch::Approx(0.5).margin(margin));
+    }
+
+    SECTION("Sphere-sphere")
+    {
+        const Sphere<TestType> a{ Vector{ 0.0, 0.0, 0.0 }, 1.0 };
+        const Sphere<TestType> b{ Vector{ 0.3, 1.2, -0.4 }, 0.8 };
+        const double centerDistance = std::sqrt(0.09 + 1.44 + 0.16);
+
+        /// Centers apart: the depth is along the center axis, exact
+        REQUIRE(EpaPenetration(result, a, b, cache));
+        REQUIRE(result.depth == Catch::Approx(1.8 - centerDistance).margin(margin));
+        REQUIRE(IsNear(result.normal, 0.3 / centerDistance, 1.2 / centerDistance, -0.4 / centerDistance, margin));
+        REQUIRE(IsNear(result.pointA, 0.3 / centerDistance, 1.2 / centerDistance, -0.4 / centerDistance, margin));
+    }
+
+    SECTION("Capsule through a box, deep")
+    {
+        const Obb<TestType> box = MakeBox<TestType>(0.0, 0.0, 0.0, 1.0);
+        const Capsule<TestType> capsule{ Vector{ -3.0, 0.0, 0.7 }, Vector{ 3.0, 0.0, 0.7 }, 0.5 };
+
+        /// Segment inside the box: EPA on a polytope around the rounded capsule, looser than the exact cases.
+        /// Cheapest way out: up the z axis, 1 - (0.7 - 0.5)
+        REQUIRE(EpaPenetration(result, box, capsule, cache));
+        REQUIRE(result.depth == Catch::Approx(0.8).margin(1e-2));
+        REQUIRE(IsNear(result.normal, 0.0, 0.0, 1.0, 1e-2));
+    }
+
+    SECTION("Pushing B out by depth along the normal separates the shapes")
+    {
+        const Obb<TestType> box{ Vector{ 0.0, 0.0, 0.0 }, TestHelpers::MakeRotation<TestType>(0.3, 0.2), Vector{ 0.6, 0.3, 0.4 } };
+        for (int i = 0; i < 64; ++i)
+        {
+            const Vector offset{ 0.3 * (i % 4) - 0.45, 0.2 * ((i / 4) % 4) - 0.3, 0.25 * (i / 16) - 0.375 };
+            const Obb<TestType> other{ offset, TestHelpers::MakeRotation<TestType>(-0.4, 0.9), Vector{ 0.2, 0.5, 0.3 } };
+            GjkCache<TestType> pairCache;
+            REQUIRE(EpaPenetration(result, box, other, pairCache));
+            REQUIRE(result.depth > 0.0);
+
+            /// Penetration depth is the shortest way out: a bit less still intersects
+            for (const double push : { result.depth + 0.02, result.depth - 0.02 })
+            {
+                const Vector moved = offset + Vector{ push * Component(result.normal, 0), push * Component(result.normal, 1), push * Component(result.normal, 2) };
+                GjkCache<TestType> movedCache;
+                REQUIRE(GjkIntersect(box, Obb<TestType>{ moved, other.getRotation(), other.getHalfExtents() }, movedCache) == (push < result.depth));
+            }
+        }
+    }
+
+    SECTION("Separated: distance only")
+    {
+        const Obb<TestType> a = MakeBox<TestType>(0.0, 0.0, 0.0, 1.0);
+        const Obb<TestType> b = MakeBox<TestType>(0.0, 0.0, 3.0, 1.0);
+        REQUIRE_FALSE(EpaPenetration(result, a, b, cache));
+        REQUIRE(result.depth == 0.0);
+        REQUIRE(result.distance == Catch::Approx(1.0).margin(margin));
+        REQUIRE(IsNear(result.normal, 0.0, 0.0, 1.0, margin));
+    }
+
+    SECTION("Touching faces")
+    {
+        const Obb<TestType> a = MakeBox<TestType>(0.0, 0.0, 0.0, 1.0);
+        const Obb<TestType> b = MakeBox<TestType>(2.0, 0.5, 0.0, 1.0);
+        REQUIRE(EpaPenetration(result, a, b, cache));
+        REQUIRE(result.depth == Catch::Approx(0.0).margin(margin));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Gjk Warm Start", "[Gjk]", GJK_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+    constexpr double margin = MARGIN<TestType>;
+
+    /// A capsule sweeping past a turning box in small steps, separated then intersecting
+    GjkCache<TestType> warm;
+    int coldIterations = 0, warmIterations = 0;
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        const double t = frame / 60.0;
+        const Obb<TestType> box{ Vector{ 0.0, 0.0, 0.0 }, TestHelpers::MakeRotation<TestType>(0.2 + 0.3 * t, 0.5 * t), Vector{ 1.0, 0.5, 0.75 } };
+        const Capsule<TestType> capsule{ Vector{ 3.0 - 2.5 * t, 1.0, -0.5 }, Vector{ 3.5 - 2.5 * t, 1.5, 0.5 }, 0.3 };
+
+        GjkCache<TestType> cold;
+        GjkResult<TestType> coldResult, warmResult;
+        const bool coldSeparated = GjkDistance(coldResult, box, capsule, cold);
+        const bool warmSeparated = GjkDistance(warmResult, box, capsule, warm);
+        coldIterations += coldResult.iterations;
+        warmIterations += warmResult.iterations;
+
+        REQUIRE(coldSeparated == warmSeparated);
+        REQUIRE(warmResult.distance == Catch::Approx(coldResult.distance).margin(margin));
+
+        GjkCache<TestType> intersectCache = warm;
+        REQUIRE(GjkIntersect(box, capsule, intersectCache) == !warmSeparated);
+    }
+
+    REQUIRE(warmIterations < coldIterations);
+}
@@ -0,0 +1,173 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_GpuExport.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include "TestHelpers.h"
+#include <MathLib/Common/FixedPointHelpers.h>
+#include <MathLib/Graphics/GpuExport.h>
+#include <cmath>
+#include <vector>
+
+#define GPU_EXPORT_TYPES int, float, double
+
+namespace
+{
+    using TestHelpers::BATCH_COUNT;
+
+    /// Sentinel written past the expected output to catch overruns
+    constexpr float GUARD = -12345.0f;
+
+    template<typename Type>
+    std::vector<ETL::Math::Matrix4x4<Type>> MakeMatrices4x4(std::size_t count)
+    {
+        std::vector<ETL::Math::Matrix4x4<Type>> mats(count);
+        for (std::size_t i = 0; i < count; ++i)
+            for (int e = 0; e < 16; ++e)
+                mats[i][e] = std::sin(0.37 * (16 * i + e)) * 4.0;
+        return mats;
+    }
+
+    template<typename Type>
+    std::vector<ETL::Math::Matrix3x3<Type>> MakeMatrices3x3(std::size_t count)
+    {
+        std::vector<ETL::Math::Matrix3x3<Type>> mats(count);
+        for (std::size_t i = 0; i < count; ++i)
+            for (int e = 0; e < 9; ++e)
+                mats[i][e] = std::cos(0.41 * (9 * i + e)) * 4.0;
+        return mats;
+    }
+
+    template<typename Type>
+    float ToFloat(Type raw)
+    {
+        return ETL::Math::DecodeValue<float>(raw);
+    }
+
+    /// Output buffer of 'size' floats followed by a guard value
+    std::vector<float> MakeBuffer(std::size_t size)
+    {
+        std::vector<float> buffer(size + 1, std::nanf(""));
+        buffer[size] = GUARD;
+        return buffer;
+    }
+}
+
+
+TEMPLATE_TEST_CASE("GpuExport Matrix4x4", "[GpuExport]", GPU_EXPORT_TYPES)
+{
+    using namespace ETL::Math;
+    const auto mats = MakeMatrices4x4<TestType>(BATCH_COUNT);
+
+    const GpuLayout layouts[] = { GpuLayout::Std140, GpuLayout::Std430, GpuLayout::Scalar };
+    const GpuMatrixOrder orders[] = { GpuMatrixOrder::ColumnMajor, GpuMatrixOrder::RowMajor };
+
+    for (GpuLayout layout : layouts)
+        for (GpuMatrixOrder order : orders)
+            for (bool bDropLastRow : { false, true })
+            {
+                const std::size_t stride = GetGpuFloatCount4x4(layout, order, bDropLastRow);
+                std::vector<float> buffer = MakeBuffer(BATCH_COUNT * stride);
+                CHECK(ExportToGpu<TestType>(buffer, mats, layout, order, bDropLastRow) == BATCH_COUNT * stride);
+                CHECK(buffer[BATCH_COUNT * stride] == GUARD);
+
+                /// Reference: vectors (columns or rows) of 'length' values, padded to 'vectorStride'
+                const bool bRowMajor = order == GpuMatrixOrder::RowMajor;
+                const int vectorCount = bRowMajor && bDropLastRow ? 3 : 4;
+                const int length = !bRowMajor && bDropLastRow ? 3 : 4;
+                const int vectorStride = (length == 3 && layout == GpuLayout::Scalar) ? 3 : 4;
+
+                bool bMatch = true;
+                for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+                {
+                    const float* out = buffer.data() + i * stride;
+                    for (int v = 0; v < vectorCount; ++v)
+                        for (int k = 0; k < vectorStride; ++k)
+                        {
+                            const int row = bRowMajor ? v : k;
+                            const int col = bRowMajor ? k : v;
+                            const float expected = k < length ? ToFloat(mats[i].getRawValue(row, col)) : 0.0f;
+                            bMatch = bMatch && out[v * vectorStride + k] == expected;
+                        }
+                }
+                INFO("layout " << int(layout) << " order " << int(order) << " drop " << bDropLastRow);
+                CHECK(bMatch);
+            }
+}
+
+
+TEMPLATE_TEST_CASE("GpuExport Matrix3x3", "[GpuExport]", GPU_EXPORT_TYPES)
+{
+    using namespace ETL::Math;
+    const auto mats = MakeMatrices3x3<TestType>(BATCH_COUNT);
+
+    for (GpuLayout layout : { GpuLayout::Std140, GpuLayout::Std430, GpuLayout::Scalar })
+        for (GpuMatrixOrder order : { GpuMatrixOrder::ColumnMajor, GpuMatrixOrder::RowMajor })
+        {
+            const std::size_t stride = GetGpuFloatCount3x3(layout);
+            std::vector<float> buffer = MakeBuffer(BATCH_COUNT * stride);
+            CHECK(ExportToGpu<TestType>(buffer, mats, layout, order) == BATCH_COUNT * stride);
+            CHECK(buffer[BATCH_COUNT * stride] == GUARD);
+
+            const bool bRowMajor = order == GpuMatrixOrder::RowMajor;
+            const int vectorStride = layout == GpuLayout::Scalar ? 3 : 4;
+
+            bool bMatch = true;
+            for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            {
+                const float* out = buffer.data() + i * stride;
+                for (int v = 0; v < 3; ++v)
+                    for (int k = 0; k < vectorStride; ++k)
+                    {
+                        const float expected = k < 3 ? ToFloat(mats[i].getRawValue(bRowMajor ? v : k, bRowMajor ? k : v)) : 0.0f;
+                        bMatch = bMatch && out[v * vectorStride + k] == expected;
+                    }
+            }
+            INFO("layout " << int(layout) << " order " << int(order));
+            CHECK(bMatch);
+        }
+}
+
+
+TEMPLATE_TEST_CASE("GpuExport Vector3", "[GpuExport]", GPU_EXPORT_TYPES)
+{
+    using namespace ETL::Math;
+
+    std::vector<Vector3<TestType>> vectors(BATCH_COUNT);
+    for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        vectors[i] = Vector3<TestType>{ 0.5 * i, -1.25 * i, std::sin(double(i)) };
+
+    SECTION("std140 / std430 pad to vec4")
+    {
+        for (GpuLayout layout : { GpuLayout::Std140, GpuLayout::Std430 })
+        {
+            std::vector<float> buffer = MakeBuffer(BATCH_COUNT * 4);
+            CHECK(ExportToGpu<TestType>(buffer, vectors, layout) == BATCH_COUNT * 4);
+            CHECK(buffer[BATCH_COUNT * 4] == GUARD);
+            for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            {
+                CHECK(buffer[4 * i + 0] == ToFloat(vectors[i].getRawValue(0)));
+                CHECK(buffer[4 * i + 1] == ToFloat(vectors[i].getRawValue(1)));
+                CHECK(buffer[4 * i + 2] == ToFloat(vectors[i].getRawValue(2)));
+                CHECK(buffer[4 * i + 3] == 0.0f);
+            }
+        }
+    }
+
+    SECTION("Scalar layout is tightly packed")
+    {
+        std::vector<float> buffer = MakeBuffer(BATCH_COUNT * 3);
+        CHECK(ExportToGpu<TestType>(buffer, vectors, GpuLayout::Scalar) == BATCH_COUNT * 3);
+        CHECK(buffer[BATCH_COUNT * 3] == GUARD);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            for (int k = 0; k < 3; ++k)
+                CHECK(buffer[3 * i + k] == ToFloat(vectors[i].getRawValue(k)));
+    }
+
+    SECTION("Empty input writes nothing")
+    {
+        std::vector<float> buffer = MakeBuffer(0);
+        CHECK(ExportToGpu<TestType>(buffer, std::span<const Vector3<TestType>>{}, GpuLayout::Std140) == 0);
+        CHECK(buffer[0] == GUARD);
+    }
+}
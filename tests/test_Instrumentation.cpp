@@ -0,0 +1,153 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Instrumentation.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/Instrumentation.h>
+#include <MathLib/Types/Matrix3x3.h>
+#include <MathLib/Types/Matrix4x4.h>
+#include <MathLib/Types/Quaternion.h>
+#include <MathLib/Types/Vector3.h>
+#include <thread>
+#include <vector>
+
+#define INSTRUMENT_TYPES int, float, double
+
+namespace
+{
+    constexpr std::uint64_t COUNT = 37;
+
+    /// Expected count: COUNT when the hooks are compiled in, 0 otherwise
+    constexpr std::uint64_t Expected(std::uint64_t calls)
+    {
+        return ETL::Math::IsInstrumentEnabled() ? calls : 0;
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Instrumentation counts calls", "[Instrumentation]", INSTRUMENT_TYPES)
+{
+    using namespace ETL::Math;
+    ResetInstrumentCounters();
+
+    const Matrix4x4<TestType> rot = Matrix4x4<TestType>::CreateRotation(0.1, 0.2, 0.3);
+    Matrix4x4<TestType> mat4 = Matrix4x4<TestType>::Identity();
+    Matrix3x3<TestType> mat3 = Matrix3x3<TestType>::Identity();
+    Vector3<TestType> vec{ 1.0, 2.0, 3.0 };
+    Quaternion<TestType> quat{ 0.1, 0.2, 0.3, 0.9 };
+
+    for (std::uint64_t i = 0; i < COUNT; ++i)
+    {
+        Multiply(mat4, mat4, rot); /// aliased: counted once
+        Multiply(mat3, mat3, Matrix3x3<TestType>::Identity());
+        Normalize(vec, vec);
+        Normalize(quat, quat);
+    }
+    Matrix4x4<TestType> inverse;
+    CHECK(Inverse(inverse, rot));
+
+    const InstrumentSnapshot snapshot = TakeInstrumentSnapshot();
+    CHECK(snapshot.getTotal(InstrumentOp::Matrix4x4Multiply).calls == Expected(COUNT));
+    CHECK(snapshot.getTotal(InstrumentOp::Matrix3x3Multiply).calls == Expected(COUNT));
+    CHECK(snapshot.getTotal(InstrumentOp::Vector3Normalize).calls == Expected(COUNT));
+    CHECK(snapshot.getTotal(InstrumentOp::QuaternionNormalize).calls == Expected(COUNT));
+    CHECK(snapshot.getTotal(InstrumentOp::Matrix4x4CreateRotation).calls == Expected(1));
+    CHECK(snapshot.getTotal(InstrumentOp::Matrix4x4Inverse).calls == Expected(1));
+    CHECK(snapshot.getTotal(InstrumentOp::QuaternionInverse).calls == 0);
+
+    /// The first call of every op is sampled, then one out of INSTRUMENT_SAMPLE_PERIOD
+    const InstrumentStats& stats = snapshot.getTotal(InstrumentOp::Matrix4x4Multiply);
+    CHECK(stats.sampledCalls == Expected((COUNT + INSTRUMENT_SAMPLE_PERIOD - 1) / INSTRUMENT_SAMPLE_PERIOD));
+    CHECK(stats.sampledCalls <= stats.calls);
+
+    ResetInstrumentCounters();
+    CHECK(TakeInstrumentSnapshot().getTotal(InstrumentOp::Matrix4x4Multiply).calls == 0);
+}
+
+
+TEST_CASE("Instrumentation constant evaluation is not counted", "[Instrumentation]")
+{
+    using namespace ETL::Math;
+    ResetInstrumentCounters();
+
+    constexpr Matrix3x3<double> rot = Matrix3x3<double>::CreateRotation(0.5);
+    CHECK(rot(0, 0) > 0.0);
+    CHECK(TakeInstrumentSnapshot().getTotal(InstrumentOp::Matrix3x3CreateRotation).calls == 0);
+}
+
+
+TEST_CASE("Instrumentation scopes", "[Instrumentation]")
+{
+    using namespace ETL::Math;
+    ResetInstrumentCounters();
+
+    const int physics = RegisterInstrumentScope("Physics");
+    CHECK(physics > 0);
+    CHECK(RegisterInstrumentScope("Physics") == physics);
+
+    Vector3<float> vec{ 1.0f, 2.0f, 3.0f };
+    Normalize(vec, vec);
+    {
+        InstrumentScope scope("Physics");
+        Normalize(vec, vec);
+        Normalize(vec, vec);
+        {
+            InstrumentScope nested("Animation");
+            Normalize(vec, vec);
+        }
+        Normalize(vec, vec);
+    }
+    Normalize(vec, vec);
+
+    const InstrumentSnapshot snapshot = TakeInstrumentSnapshot();
+    const int animation = RegisterInstrumentScope("Animation");
+    REQUIRE(snapshot.scopeNames.size() > std::size_t(animation));
+    CHECK(snapshot.scopeNames[0] == "Default");
+    CHECK(snapshot.scopeNames[physics] == "Physics");
+    CHECK(snapshot.get(0, InstrumentOp::Vector3Normalize).calls == Expected(2));
+    CHECK(snapshot.get(physics, InstrumentOp::Vector3Normalize).calls == Expected(3));
+    CHECK(snapshot.get(animation, InstrumentOp::Vector3Normalize).calls == Expected(1));
+    CHECK(snapshot.getTotal(InstrumentOp::Vector3Normalize).calls == Expected(6));
+}
+
+
+TEST_CASE("Instrumentation threads", "[Instrumentation]")
+{
+    using namespace ETL::Math;
+    ResetInstrumentCounters();
+
+    constexpr int NUM_THREADS = 4;
+
+    /// Live threads are read while running, finished ones are kept after exit
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t)
+    {
+        threads.emplace_back([]()
+        {
+            Quaternion<double> q1{ 0.1, 0.2, 0.3, 0.9 }, q2{ 0.0, 0.0, 0.0, 1.0 };
+            for (std::uint64_t i = 0; i < COUNT; ++i)
+                Multiply(q1, q1, q2);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    CHECK(TakeInstrumentSnapshot().getTotal(InstrumentOp::QuaternionMultiply).calls == Expected(NUM_THREADS * COUNT));
+}
+
+
+TEST_CASE("Instrumentation JSON export", "[Instrumentation]")
+{
+    using namespace ETL::Math;
+    ResetInstrumentCounters();
+
+    Quaternion<float> quat{ 0.1f, 0.2f, 0.3f, 0.9f };
+    Inverse(quat, quat);
+
+    const std::string json = TakeInstrumentSnapshot().toJson();
+    CHECK(json.starts_with("{\"samplePeriod\":64,\"scopes\":[{\"name\":\"Default\",\"ops\":{"));
+    CHECK(json.ends_with("]}"));
+    CHECK((json.find("\"QuaternionInverse\":{\"calls\":1,") != std::string::npos) == IsInstrumentEnabled());
+    CHECK(json.find("QuaternionMultiply") == std::string::npos);
+    CHECK(GetInstrumentOpName(InstrumentOp::Matrix4x4InverseBatch) == "Matrix4x4InverseBatch");
+}
@@ -0,0 +1,146 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Interpolation.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Animation/Interpolation.h>
+
+#define INTERPOLATION_TYPES int, float, double
+
+namespace
+{
+    /// Compile-time evaluation check
+    constexpr float ConstexprLerpY()
+    {
+        ETL::Math::Vector2<float> result;
+        ETL::Math::Lerp(result, ETL::Math::Vector2<float>{ 0.0f, 2.0f }, ETL::Math::Vector2<float>{ 4.0f, 6.0f }, 0.25);
+        return result.getRawValue(1);
+    }
+}
+
+
+TEST_CASE("Interpolation Scalar Smoothstep", "[Interpolation][core]")
+{
+    STATIC_REQUIRE(ETL::Math::Smoothstep(0.0, 1.0, 0.5) == 0.5);
+    STATIC_REQUIRE(ETL::Math::Smoothstep(0.0, 1.0, -1.0) == 0.0);
+    STATIC_REQUIRE(ETL::Math::Smoothstep(0.0, 1.0, 2.0) == 1.0);
+    STATIC_REQUIRE(ConstexprLerpY() == 3.0f);
+
+    REQUIRE(ETL::Math::isEqual(ETL::Math::Smoothstep(2.0, 4.0, 2.5), 0.15625));
+}
+
+
+TEMPLATE_TEST_CASE("Interpolation Lerp & Smoothstep", "[Interpolation][core]", INTERPOLATION_TYPES)
+{
+    using Vec2 = ETL::Math::Vector2<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using Vec4 = ETL::Math::Vector4<TestType>;
+
+    SECTION("Lerp endpoints and midpoint")
+    {
+        const Vec3 a{ 1.0, -2.0, 3.0 };
+        const Vec3 b{ 5.0, 2.0, -1.0 };
+        Vec3 result;
+
+        ETL::Math::Lerp(result, a, b, 0.0);
+        REQUIRE(ETL::Math::isEqual(result, a, 0.001));
+        ETL::Math::Lerp(result, a, b, 1.0);
+        REQUIRE(ETL::Math::isEqual(result, b, 0.001));
+        ETL::Math::Lerp(result, a, b, 0.5);
+        REQUIRE(ETL::Math::isEqual(result, Vec3{ 3.0, 0.0, 1.0 }, 0.001));
+    }
+
+    SECTION("Lerp Vector2 and Vector4")
+    {
+        Vec2 result2;
+        ETL::Math::Lerp(result2, Vec2{ 0.0, 4.0 }, Vec2{ 2.0, 8.0 }, 0.25);
+        REQUIRE(ETL::Math::isEqual(result2, Vec2{ 0.5, 5.0 }, 0.001));
+
+        Vec4 result4;
+        ETL::Math::Lerp(result4, Vec4{ 0.0, 1.0, 2.0, 3.0 }, Vec4{ 4.0, 5.0, 6.0, 7.0 }, 0.75);
+        REQUIRE(ETL::Math::isEqual(result4, Vec4{ 3.0, 4.0, 5.0, 6.0 }, 0.001));
+    }
+
+    SECTION("Smoothstep eases and clamps")
+    {
+        const Vec2 a{ 0.0, 0.0 };
+        const Vec2 b{ 8.0, -8.0 };
+        Vec2 result;
+
+        ETL::Math::Smoothstep(result, a, b, 0.25);
+        REQUIRE(ETL::Math::isEqual(result, Vec2{ 1.25, -1.25 }, 0.001));
+        ETL::Math::Smoothstep(result, a, b, 1.5);
+        REQUIRE(ETL::Math::isEqual(result, b, 0.001));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Interpolation Cubic Curves", "[Interpolation][cubic]", INTERPOLATION_TYPES)
+{
+    using Vec2 = ETL::Math::Vector2<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    SECTION("Hermite endpoints and tangents")
+    {
+        const Vec3 p0{ 0.0, 1.0, 2.0 };
+        const Vec3 p1{ 4.0, -1.0, 6.0 };
+        const Vec3 m0{ 1.0, 0.0, 0.0 };
+        const Vec3 m1{ 0.0, 2.0, 0.0 };
+        Vec3 result;
+
+        ETL::Math::Hermite(result, p0, m0, p1, m1, 0.0);
+        REQUIRE(ETL::Math::isEqual(result, p0, 0.001));
+        ETL::Math::Hermite(result, p0, m0, p1, m1, 1.0);
+        REQUIRE(ETL::Math::isEqual(result, p1, 0.001));
+
+        /// h00 = h01 = 0.5, h10 = 0.125, h11 = -0.125
+        ETL::Math::Hermite(result, p0, m0, p1, m1, 0.5);
+        REQUIRE(ETL::Math::isEqual(result, Vec3{ 2.125, -0.25, 4.0 }, 0.001));
+    }
+
+    SECTION("Hermite with chord tangents is linear")
+    {
+        const Vec2 p0{ 1.0, 2.0 };
+        const Vec2 p1{ 3.0, -2.0 };
+        const Vec2 chord{ 2.0, -4.0 };
+        Vec2 result;
+
+        ETL::Math::Hermite(result, p0, chord, p1, chord, 0.25);
+        REQUIRE(ETL::Math::isEqual(result, Vec2{ 1.5, 1.0 }, 0.001));
+    }
+
+    SECTION("Catmull-Rom passes through inner points")
+    {
+        const Vec3 p0{ -1.0, 3.0, 0.0 };
+        const Vec3 p1{ 0.0, 0.0, 1.0 };
+        const Vec3 p2{ 2.0, 1.0, 1.0 };
+        const Vec3 p3{ 3.0, -2.0, 0.0 };
+        Vec3 result;
+
+        ETL::Math::CatmullRom(result, p0, p1, p2, p3, 0.0);
+        REQUIRE(ETL::Math::isEqual(result, p1, 0.001));
+        ETL::Math::CatmullRom(result, p0, p1, p2, p3, 1.0);
+        REQUIRE(ETL::Math::isEqual(result, p2, 0.001));
+
+        /// Evenly spaced collinear points give a straight line
+        ETL::Math::CatmullRom(result, Vec3{ 0.0, 0.0, 0.0 }, Vec3{ 1.0, 2.0, 3.0 }, Vec3{ 2.0, 4.0, 6.0 }, Vec3{ 3.0, 6.0, 9.0 }, 0.5);
+        REQUIRE(ETL::Math::isEqual(result, Vec3{ 1.5, 3.0, 4.5 }, 0.001));
+    }
+
+    SECTION("Bezier endpoints and midpoint")
+    {
+        const Vec2 p0{ 0.0, 0.0 };
+        const Vec2 p1{ 0.0, 1.0 };
+        const Vec2 p2{ 1.0, 1.0 };
+        const Vec2 p3{ 1.0, 0.0 };
+        Vec2 result;
+
+        ETL::Math::Bezier(result, p0, p1, p2, p3, 0.0);
+        REQUIRE(ETL::Math::isEqual(result, p0, 0.001));
+        ETL::Math::Bezier(result, p0, p1, p2, p3, 1.0);
+        REQUIRE(ETL::Math::isEqual(result, p3, 0.001));
+        ETL::Math::Bezier(result, p0, p1, p2, p3, 0.5);
+        REQUIRE(ETL::Math::isEqual(result, Vec2{ 0.5, 0.75 }, 0.001));
+    }
+}
@@ -0,0 +1,174 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Intersection.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Geometry/Intersection.h>
+
+#define INTERSECTION_TYPES int, float, double
+
+TEMPLATE_TEST_CASE("Intersection Ray-Triangle", "[Intersection][triangle]", INTERSECTION_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Ray = ETL::Math::Ray<TestType>;
+
+    /// Triangle in the z = 0 plane
+    const Vector v0{ TestType(0), TestType(0), TestType(0) };
+    const Vector v1{ TestType(4), TestType(0), TestType(0) };
+    const Vector v2{ TestType(0), TestType(4), TestType(0) };
+
+    SECTION("Hit from front and back")
+    {
+        double t, u, v;
+        Ray front{ Vector{ TestType(1), TestType(2), TestType(5) }, Vector{ TestType(0), TestType(0), TestType(-1) } };
+        REQUIRE(ETL::Math::IntersectRayTriangle(t, u, v, front, v0, v1, v2));
+        REQUIRE(ETL::Math::isEqual(t, 5.0));
+        REQUIRE(ETL::Math::isEqual(u, 0.25));
+        REQUIRE(ETL::Math::isEqual(v, 0.5));
+
+        Ray back{ Vector{ TestType(1), TestType(2), TestType(-2) }, Vector{ TestType(0), TestType(0), TestType(1) } };
+        REQUIRE(ETL::Math::IntersectRayTriangle(t, back, v0, v1, v2));
+        REQUIRE(ETL::Math::isEqual(t, 2.0));
+    }
+
+    SECTION("Miss outside the triangle")
+    {
+        double t;
+        Ray ray{ Vector{ TestType(3), TestType(3), TestType(5) }, Vector{ TestType(0), TestType(0), TestType(-1) } };
+        REQUIRE_FALSE(ETL::Math::IntersectRayTriangle(t, ray, v0, v1, v2));
+    }
+
+    SECTION("Miss behind the origin and beyond tMax")
+    {
+        double t;
+        Ray ray{ Vector{ TestType(1), TestType(1), TestType(5) }, Vector{ TestType(0), TestType(0), TestType(1) } };
+        REQUIRE_FALSE(ETL::Math::IntersectRayTriangle(t, ray, v0, v1, v2));
+
+        Ray far{ Vector{ TestType(1), TestType(1), TestType(5) }, Vector{ TestType(0), TestType(0), TestType(-1) } };
+        REQUIRE_FALSE(ETL::Math::IntersectRayTriangle(t, far, v0, v1, v2, 4.0));
+        REQUIRE(ETL::Math::IntersectRayTriangle(t, far, v0, v1, v2, 5.0));
+    }
+
+    SECTION("Parallel ray")
+    {
+        double t;
+        Ray ray{ Vector{ TestType(1), TestType(1), TestType(1) }, Vector::UnitX() };
+        REQUIRE_FALSE(ETL::Math::IntersectRayTriangle(t, ray, v0, v1, v2));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Intersection Ray-AABB", "[Intersection][aabb]", INTERSECTION_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Ray = ETL::Math::Ray<TestType>;
+
+    const Vector boxMin{ TestType(-1), TestType(-1), TestType(-1) };
+    const Vector boxMax{ TestType(1), TestType(1), TestType(1) };
+
+    SECTION("Hit from outside")
+    {
+        double t;
+        Ray ray{ Vector{ TestType(-5), TestType(0), TestType(0) }, Vector::UnitX() };
+        REQUIRE(ETL::Math::IntersectRayAabb(t, ray, boxMin, boxMax));
+        REQUIRE(ETL::Math::isEqual(t, 4.0));
+    }
+
+    SECTION("Origin inside")
+    {
+        double t;
+        Ray ray{ Vector::Zero(), Vector::UnitY() };
+        REQUIRE(ETL::Math::IntersectRayAabb(t, ray, boxMin, boxMax));
+        REQUIRE(t == 0.0);
+    }
+
+    SECTION("Miss, pointing away and beyond tMax")
+    {
+        double t;
+        Ray miss{ Vector{ TestType(-5), TestType(2), TestType(0) }, Vector::UnitX() };
+        REQUIRE_FALSE(ETL::Math::IntersectRayAabb(t, miss, boxMin, boxMax));
+
+        Ray away{ Vector{ TestType(-5), TestType(0), TestType(0) }, Vector::Left() };
+        REQUIRE_FALSE(ETL::Math::IntersectRayAabb(t, away, boxMin, boxMax));
+
+        Ray ray{ Vector{ TestType(-5), TestType(0), TestType(0) }, Vector::UnitX() };
+        REQUIRE_FALSE(ETL::Math::IntersectRayAabb(t, ray, boxMin, boxMax, 3.0));
+    }
+
+    SECTION("Ray on a slab plane")
+    {
+        double t;
+        Ray ray{ Vector{ TestType(-5), TestType(1), TestType(0) }, Vector::UnitX() };
+        REQUIRE(ETL::Math::IntersectRayAabb(t, ray, boxMin, boxMax));
+        REQUIRE(ETL::Math::isEqual(t, 4.0));
+    }
+}
+
+
+TEMPLATE_TEST_CASE_SIG("Intersection Packet matches single ray", "[Intersection][packet]",
+                       ((typename Type, int Width), Type, Width), (float, 4), (float, 8), (double, 4))
+{
+    using Vector = ETL::Math::Vector3<Type>;
+    using Ray = ETL::Math::Ray<Type>;
+
+    const Vector v0{ Type(0), Type(0), Type(0) };
+    const Vector v1{ Type(4), Type(0), Type(0) };
+    const Vector v2{ Type(0), Type(4), Type(0) };
+    const Vector boxMin{ Type(-1), Type(-1), Type(-1) };
+    const Vector boxMax{ Type(1), Type(1), Type(1) };
+
+    /// Fan of rays, some hitting, some missing, one parallel, one inside the box
+    Ray rays[8] = {
+        Ray{ Vector{ Type(1), Type(1), Type(5) },   Vector{ Type(0), Type(0), Type(-1) } },
+        Ray{ Vector{ Type(3), Type(3), Type(5) },   Vector{ Type(0), Type(0), Type(-1) } },
+        Ray{ Vector{ Type(0.5), Type(0.5), Type(-3) }, Vector{ Type(0), Type(0), Type(2) } },
+        Ray{ Vector{ Type(1), Type(1), Type(1) },   Vector::UnitX() },
+        Ray{ Vector{ Type(-5), Type(0), Type(0) },  Vector::UnitX() },
+        Ray{ Vector::Zero(),                        Vector{ Type(0.3), Type(0.2), Type(-1) } },
+        Ray{ Vector{ Type(-5), Type(1), Type(0) },  Vector::UnitX() },
+        Ray{ Vector{ Type(1), Type(1), Type(5) },   Vector{ Type(0), Type(0), Type(1) } },
+    };
+
+    ETL::Math::RayPacket<Type, Width> packet{};
+    for (int lane = 0; lane < Width; ++lane)
+        packet.setRay(lane, rays[lane], 100.0);
+
+    SECTION("Triangle")
+    {
+        ETL::Math::RayPacketHit<Type, Width> hit{};
+        const int mask = ETL::Math::IntersectRayTriangle(hit, packet, v0, v1, v2);
+
+        for (int lane = 0; lane < Width; ++lane)
+        {
+            double t, u, v;
+            const bool bHit = ETL::Math::IntersectRayTriangle(t, u, v, rays[lane], v0, v1, v2, 100.0);
+            REQUIRE(bHit == ((mask >> lane) & 1));
+            if (bHit)
+            {
+                REQUIRE(ETL::Math::isEqual(double(hit.t[lane]), t, 1e-5));
+                REQUIRE(ETL::Math::isEqual(double(hit.u[lane]), u, 1e-5));
+                REQUIRE(ETL::Math::isEqual(double(hit.v[lane]), v, 1e-5));
+            }
+            else
+            {
+                REQUIRE(hit.t[lane] == Type(0));
+            }
+        }
+    }
+
+    SECTION("AABB")
+    {
+        Type tNear[Width] = {};
+        const int mask = ETL::Math::IntersectRayAabb(tNear, packet, boxMin, boxMax);
+
+        for (int lane = 0; lane < Width; ++lane)
+        {
+            double t;
+            const bool bHit = ETL::Math::IntersectRayAabb(t, rays[lane], boxMin, boxMax, 100.0);
+            REQUIRE(bHit == ((mask >> lane) & 1));
+            if (bHit)
+                REQUIRE(ETL::Math::isEqual(double(tNear[lane]), t, 1e-5));
+        }
+    }
+}
@@ -0,0 +1,321 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_LinearSolve.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include "TestHelpers.h"
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/LinearAlgebra/LinearSolve.h>
+#include <cmath>
+#include <vector>
+
+#define LINEARSOLVE_TYPES int, float, double
+
+namespace
+{
+    using ETL::Math::DecodeValue;
+    using ETL::Math::EncodeValue;
+
+    template<typename Mat>
+    using ValueOf = typename ETL::Math::helpers::MatrixShape<Mat>::ValueType;
+
+    template<typename Mat>
+    constexpr int SizeOf = ETL::Math::helpers::MatrixShape<Mat>::ROWS;
+
+    /// Diagonally dominant general matrix (well conditioned, needs no pivoting to be solvable)
+    template<typename Mat>
+    Mat MakeGeneral(int seed)
+    {
+        Mat result;
+        for (int row = 0; row < SizeOf<Mat>; ++row)
+            for (int col = 0; col < SizeOf<Mat>; ++col)
+                result.setRawValue(row, col, EncodeValue<ValueOf<Mat>>(TestHelpers::SeedValue(seed, row * SizeOf<Mat> + col) + (row == col ? 4.0 : 0.0)));
+        return result;
+    }
+
+    /// Symmetric positive definite: M^T * M + I
+    template<typename Mat>
+    Mat MakeSPD(int seed)
+    {
+        const Mat m = MakeGeneral<Mat>(seed);
+
+        Mat result;
+        for (int row = 0; row < SizeOf<Mat>; ++row)
+        {
+            for (int col = 0; col < SizeOf<Mat>; ++col)
+            {
+                double sum = row == col ? 1.0 : 0.0;
+                for (int k = 0; k < SizeOf<Mat>; ++k)
+                    sum += DecodeValue<double>(m.getRawValue(k, row)) * DecodeValue<double>(m.getRawValue(k, col));
+                result.setRawValue(row, col, EncodeValue<ValueOf<Mat>>(sum / 16.0));
+            }
+        }
+        return result;
+    }
+
+    /// Continues the sequence of MakeGeneral with the same seed
+    template<typename Vec>
+    Vec MakeVector(int seed)
+    {
+        using Type = typename ETL::Math::helpers::VectorShape<Vec>::ValueType;
+        constexpr int SIZE = ETL::Math::helpers::VectorShape<Vec>::SIZE;
+
+        Vec result;
+        for (int i = 0; i < SIZE; ++i)
+            result.setRawValue(i, EncodeValue<Type>(TestHelpers::SeedValue(seed, SIZE * SIZE + i)));
+        return result;
+    }
+
+    /// max |mat * x - b| (decoded)
+    template<typename Mat, typename Vec>
+    double Residual(const Mat& mat, const Vec& x, const Vec& b)
+    {
+        double worst = 0.0;
+        for (int row = 0; row < SizeOf<Mat>; ++row)
+        {
+            double sum = -DecodeValue<double>(b.getRawValue(row));
+            for (int col = 0; col < SizeOf<Mat>; ++col)
+                sum += DecodeValue<double>(mat.getRawValue(row, col)) * DecodeValue<double>(x.getRawValue(col));
+            worst = std::max(worst, std::abs(sum));
+        }
+        return worst;
+    }
+
+    template<typename Type>
+    constexpr double TOLERANCE = std::is_same_v<Type, double> ? 1e-12 : (std::is_same_v<Type, float> ? 1e-5 : 1e-3);
+
+    /// Single and batched paths run the same kernel; only FMA contraction of the one lane path can differ
+    template<typename Vec>
+    bool SameResult(const Vec& batched, const Vec& single)
+    {
+#if defined(MATHLIB_DETERMINISTIC)
+        return batched == single;
+#else
+        using Type = typename ETL::Math::helpers::VectorShape<Vec>::ValueType;
+        return isEqual(batched, single, std::is_integral_v<Type> ? 0.001 : 1e-5);
+#endif
+    }
+}
+
+
+TEMPLATE_TEST_CASE("LinearSolve LU", "[LinearSolve]", LINEARSOLVE_TYPES)
+{
+    using namespace ETL::Math;
+
+    SECTION("Residuals (3x3, 4x4, 6x6)")
+    {
+        for (int seed = 0; seed < 37; ++seed)
+        {
+            const Matrix3x3<TestType> m3 = MakeGeneral<Matrix3x3<TestType>>(seed);
+            const Vector3<TestType> b3 = MakeVector<Vector3<TestType>>(seed);
+            Vector3<TestType> x3;
+            REQUIRE(Solve(x3, m3, b3));
+            REQUIRE(Residual(m3, x3, b3) < TOLERANCE<TestType>);
+
+            const Matrix4x4<TestType> m4 = MakeGeneral<Matrix4x4<TestType>>(seed);
+            const Vector4<TestType> b4 = MakeVector<Vector4<TestType>>(seed);
+            Vector4<TestType> x4;
+            REQUIRE(Solve(x4, m4, b4));
+            REQUIRE(Residual(m4, x4, b4) < TOLERANCE<TestType>);
+
+            const Matrix6x6<TestType> m6 = MakeGeneral<Matrix6x6<TestType>>(seed);
+            const Vector6<TestType> b6 = MakeVector<Vector6<TestType>>(seed);
+            Vector6<TestType> x6;
+            REQUIRE(Solve(x6, m6, b6));
+            REQUIRE(Residual(m6, x6, b6) < 2.0 * TOLERANCE<TestType>);
+        }
+    }
+
+    SECTION("Zero leading element needs pivoting")
+    {
+        const Matrix3x3<TestType> m{ TestType(0), TestType(1), TestType(2),
+                                     TestType(1), TestType(0), TestType(3),
+                                     TestType(4), TestType(-3), TestType(8) };
+        const Vector3<TestType> b{ TestType(1), TestType(2), TestType(3) };
+
+        Vector3<TestType> x;
+        REQUIRE(Solve(x, m, b));
+        REQUIRE(Residual(m, x, b) < TOLERANCE<TestType>);
+    }
+
+    SECTION("Singular system leaves the output untouched")
+    {
+        const Matrix3x3<TestType> m{ TestType(1), TestType(2), TestType(3),
+                                     TestType(2), TestType(4), TestType(6),
+                                     TestType(0), TestType(1), TestType(1) };
+        const Vector3<TestType> b{ TestType(1), TestType(2), TestType(3) };
+
+        Vector3<TestType> x{ TestType(7), TestType(8), TestType(9) };
+        REQUIRE_FALSE(Solve(x, m, b));
+        REQUIRE(x == Vector3<TestType>{ TestType(7), TestType(8), TestType(9) });
+    }
+
+    SECTION("Matches Inverse + Multiply")
+    {
+        const Matrix4x4<TestType> m = MakeGeneral<Matrix4x4<TestType>>(3);
+        const Vector4<TestType> b = MakeVector<Vector4<TestType>>(3);
+
+        Matrix4x4<TestType> inverse;
+        REQUIRE(Inverse(inverse, m));
+        Vector4<TestType> expected, x;
+        Multiply(expected, inverse, b);
+        REQUIRE(Solve(x, m, b));
+        REQUIRE(isEqual(x, expected, std::is_integral_v<TestType> ? 0.001 : Epsilon<TestType>::value));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("LinearSolve Cholesky and LDLT", "[LinearSolve]", LINEARSOLVE_TYPES)
+{
+    using namespace ETL::Math;
+
+    SECTION("SPD residuals (3x3, 4x4, 6x6)")
+    {
+        for (int seed = 0; seed < 37; ++seed)
+        {
+            const Matrix3x3<TestType> m3 = MakeSPD<Matrix3x3<TestType>>(seed);
+            const Vector3<TestType> b3 = MakeVector<Vector3<TestType>>(seed);
+            Vector3<TestType> x3, y3;
+            REQUIRE(SolveCholesky(x3, m3, b3));
+            REQUIRE(SolveLDLT(y3, m3, b3));
+            REQUIRE(Residual(m3, x3, b3) < 4.0 * TOLERANCE<TestType>);
+            REQUIRE(Residual(m3, y3, b3) < 4.0 * TOLERANCE<TestType>);
+
+            const Matrix4x4<TestType> m4 = MakeSPD<Matrix4x4<TestType>>(seed);
+            const Vector4<TestType> b4 = MakeVector<Vector4<TestType>>(seed);
+            Vector4<TestType> x4, y4;
+            REQUIRE(SolveCholesky(x4, m4, b4));
+            REQUIRE(SolveLDLT(y4, m4, b4));
+            REQUIRE(Residual(m4, x4, b4) < 4.0 * TOLERANCE<TestType>);
+            REQUIRE(Residual(m4, y4, b4) < 4.0 * TOLERANCE<TestType>);
+
+            const Matrix6x6<TestType> m6 = MakeSPD<Matrix6x6<TestType>>(seed);
+            const Vector6<TestType> b6 = MakeVector<Vector6<TestType>>(seed);
+            Vector6<TestType> x6, y6;
+            REQUIRE(SolveCholesky(x6, m6, b6));
+            REQUIRE(SolveLDLT(y6, m6, b6));
+            REQUIRE(Residual(m6, x6, b6) < 4.0 * TOLERANCE<TestType>);
+            REQUIRE(Residual(m6, y6, b6) < 4.0 * TOLERANCE<TestType>);
+        }
+    }
+
+    SECTION("Only the lower triangle is read")
+    {
+        const Matrix3x3<TestType> spd = MakeSPD<Matrix3x3<TestType>>(5);
+        Matrix3x3<TestType> lower = spd;
+        lower.setRawValue(0, 1, EncodeValue<TestType>(100.0));
+        lower.setRawValue(0, 2, EncodeValue<TestType>(-100.0));
+        lower.setRawValue(1, 2, EncodeValue<TestType>(50.0));
+
+        const Vector3<TestType> b = MakeVector<Vector3<TestType>>(5);
+        Vector3<TestType> expected, x;
+        REQUIRE(SolveCholesky(expected, spd, b));
+        REQUIRE(SolveCholesky(x, lower, b));
+        REQUIRE(x == expected);
+        REQUIRE(SolveLDLT(expected, spd, b));
+        REQUIRE(SolveLDLT(x, lower, b));
+        REQUIRE(x == expected);
+    }
+
+    SECTION("Symmetric indefinite (KKT) system: LDLT only")
+    {
+        /// [ 2 0 | 1 ]
+        /// [ 0 2 | 1 ]
+        /// [ 1 1 | 0 ]
+        const Matrix3x3<TestType> kkt{ TestType(2), TestType(0), TestType(1),
+                                       TestType(0), TestType(2), TestType(1),
+                                       TestType(1), TestType(1), TestType(0) };
+        const Vector3<TestType> b{ TestType(1), TestType(3), TestType(1) };
+
+        Vector3<TestType> x{ TestType(7), TestType(8), TestType(9) };
+        REQUIRE_FALSE(SolveCholesky(x, kkt, b));
+        REQUIRE(x == Vector3<TestType>{ TestType(7), TestType(8), TestType(9) });
+
+        REQUIRE(SolveLDLT(x, kkt, b));
+        REQUIRE(Residual(kkt, x, b) < TOLERANCE<TestType>);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("LinearSolve Batch matches single", "[LinearSolve]", LINEARSOLVE_TYPES)
+{
+    using namespace ETL::Math;
+    using Matrix = Matrix6x6<TestType>;
+    using Vec = Vector6<TestType>;
+
+    constexpr int COUNT = 37;
+
+    std::vector<Matrix> general(COUNT), spd(COUNT);
+    std::vector<Vec> b(COUNT), x(COUNT, Vec::Zero());
+    bool ok[COUNT];
+    for (int i = 0; i < COUNT; ++i)
+    {
+        general[i] = MakeGeneral<Matrix>(i);
+        spd[i] = MakeSPD<Matrix>(i);
+        b[i] = MakeVector<Vec>(i);
+    }
+    general[5] = Matrix::Zero(); /// singular system in the middle of a pack
+
+    SECTION("LU")
+    {
+        REQUIRE_FALSE(Solve(std::span<Vec>{ x }, std::span<const Matrix>{ general }, std::span<const Vec>{ b }, std::span<bool>{ ok }));
+        for (int i = 0; i < COUNT; ++i)
+        {
+            Vec single = Vec::Zero();
+            REQUIRE(ok[i] == (i != 5));
+            REQUIRE(Solve(single, general[i], b[i]) == ok[i]);
+            REQUIRE(SameResult(x[i], single));
+        }
+    }
+
+    SECTION("Cholesky")
+    {
+        REQUIRE(SolveCholesky(std::span<Vec>{ x }, std::span<const Matrix>{ spd }, std::span<const Vec>{ b }, std::span<bool>{ ok }));
+        for (int i = 0; i < COUNT; ++i)
+        {
+            Vec single;
+            REQUIRE(ok[i]);
+            REQUIRE(SolveCholesky(single, spd[i], b[i]));
+            REQUIRE(SameResult(x[i], single));
+        }
+    }
+
+    SECTION("LDLT")
+    {
+        REQUIRE(SolveLDLT(std::span<Vec>{ x }, std::span<const Matrix>{ spd }, std::span<const Vec>{ b }, std::span<bool>{ ok }));
+        for (int i = 0; i < COUNT; ++i)
+        {
+            Vec single;
+            REQUIRE(ok[i]);
+            REQUIRE(SolveLDLT(single, spd[i], b[i]));
+            REQUIRE(SameResult(x[i], single));
+        }
+    }
+
+    SECTION("3x3 and 4x4")
+    {
+        std::vector<Matrix3x3<TestType>> m3(COUNT);
+        std::vector<Vector3<TestType>> b3(COUNT), x3(COUNT);
+        std::vector<Matrix4x4<TestType>> m4(COUNT);
+        std::vector<Vector4<TestType>> b4(COUNT), x4(COUNT);
+        for (int i = 0; i < COUNT; ++i)
+        {
+            m3[i] = MakeGeneral<Matrix3x3<TestType>>(i);
+            b3[i] = MakeVector<Vector3<TestType>>(i);
+            m4[i] = MakeSPD<Matrix4x4<TestType>>(i);
+            b4[i] = MakeVector<Vector4<TestType>>(i);
+        }
+
+        REQUIRE(Solve(std::span<Vector3<TestType>>{ x3 }, std::span<const Matrix3x3<TestType>>{ m3 }, std::span<const Vector3<TestType>>{ b3 }, std::span<bool>{ ok }));
+        REQUIRE(SolveCholesky(std::span<Vector4<TestType>>{ x4 }, std::span<const Matrix4x4<TestType>>{ m4 }, std::span<const Vector4<TestType>>{ b4 }, std::span<bool>{ ok }));
+        for (int i = 0; i < COUNT; ++i)
+        {
+            Vector3<TestType> single3;
+            Vector4<TestType> single4;
+            REQUIRE(Solve(single3, m3[i], b3[i]));
+            REQUIRE(SolveCholesky(single4, m4[i], b4[i]));
+            REQUIRE(SameResult(x3[i], single3));
+            REQUIRE(SameResult(x4[i], single4));
+        }
+    }
+}
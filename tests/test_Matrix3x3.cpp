@@ -6,6 +6,7 @@
 #include <MathLib/Common/TypeComparisons.h>
 #include <MathLib/Common/FixedPointHelpers.h>
 #include <MathLib/Types/Matrix3x3.h>
+#include <utility>
 
 #define MATRIX3x3_TYPES int, float, double
 
@@ -616,6 +617,16 @@ TEMPLATE_TEST_CASE("Matrix3x3 2D Transformations Factories", "[Matrix3x3][transf
         REQUIRE(ETL::Math::isEqual(mRot, mExpected));
     }
 
+    SECTION("Rotation static factory - fast trigonometry")
+    {
+        constexpr double eps = 1e-4; /// a few 16.16 steps
+        const Matrix mPrecise = Matrix::CreateRotation(2.4);
+        const Matrix mFast = Matrix::CreateRotation(2.4, ETL::Math::TrigPrecision::Fast);
+
+        REQUIRE(ETL::Math::isEqual(mFast, mPrecise, eps));
+        REQUIRE(ETL::Math::isEqual(Matrix::Identity().setRotation(2.4, ETL::Math::TrigPrecision::Fast), mPrecise, eps));
+    }
+
     SECTION("Translation static factory")
     {
         const Matrix mTrans = Matrix::CreateTranslation(TestType(10), TestType(20));
@@ -925,3 +936,65 @@ TEMPLATE_TEST_CASE("Matrix3x3 Transform Decomposition", "[Matrix3x3][transform]"
         REQUIRE(ETL::Math::isEqual(vTranslation, vExpectedTrans));
     }
 }
+
+
+TEMPLATE_TEST_CASE("Matrix3x3 Constant Evaluation", "[Matrix3x3][constexpr]", MATRIX3x3_TYPES)
+{
+    using Matrix = ETL::Math::Matrix3x3<TestType>;
+    using Vec2 = ETL::Math::Vector2<TestType>;
+
+    constexpr double eps = 0.001;
+    constexpr double PI_HALF = 1.57079632679489661923;
+
+    SECTION("Factories, transform and inverse")
+    {
+        constexpr Matrix transform = Matrix::CreateTranslation(TestType(1), TestType(2))
+                                   * Matrix::CreateRotation(PI_HALF)
+                                   * Matrix::CreateScale(2.0, 2.0);
+
+        /// (1,0) -> (2,0) -> (0,2) -> (1,4)
+        STATIC_REQUIRE(ETL::Math::isEqual(transform.transformPoint(Vec2{ TestType(1), TestType(0) }), Vec2{ TestType(1), TestType(4) }, eps));
+        STATIC_REQUIRE(ETL::Math::isEqual(transform * transform.inverse(), Matrix::Identity(), eps));
+        STATIC_REQUIRE(ETL::Math::isEqual(transform.transpose().transpose(), transform, eps));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Matrix3x3 Unchecked Raw Access", "[Matrix3x3][core]", MATRIX3x3_TYPES)
+{
+    using Matrix = ETL::Math::Matrix3x3<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    Matrix m{ TestType(1), TestType(2), TestType(3),
+              TestType(4), TestType(5), TestType(6),
+              TestType(7), TestType(8), TestType(9) };
+
+    SECTION("Columns are contiguous storage values")
+    {
+        const TestType* col1 = std::as_const(m).getRawCol(1);
+        for (int row = 0; row < 3; ++row)
+        {
+            REQUIRE(col1[row] == m.getRawValue(row, 1));
+            REQUIRE(m.getRawValueUnchecked(row, 1) == m.getRawValue(row, 1));
+        }
+
+        m.getRawCol(2)[0] = ETL::Math::EncodeValue<TestType>(10);
+        REQUIRE(m(0, 2) == TestType(10));
+    }
+
+    SECTION("Rows are gathered")
+    {
+        TestType row[3];
+        m.getRawRowTo(row, 1);
+        for (int col = 0; col < 3; ++col)
+            REQUIRE(row[col] == m.getRawValue(1, col));
+    }
+
+    SECTION("Multiply keeps fractional fixed point inputs")
+    {
+        const Matrix scale = Matrix::CreateScale(0.5, 0.25);
+        Vec3 result;
+        ETL::Math::Multiply(result, scale, Vec3{ 1.5, 3.0, 1.0 });
+        REQUIRE(ETL::Math::isEqual(result, Vec3{ 0.75, 0.75, 1.0 }));
+    }
+}
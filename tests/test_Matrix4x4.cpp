@@ -5,6 +5,7 @@
 #include <catch_amalgamated.hpp>
 #include <MathLib/Common/TypeComparisons.h>
 #include <MathLib/Types/Matrix4x4.h>
+#include <vector>
 
 #define MATRIX4x4_TYPES int, float, double
 constexpr double PI = 3.14159265358979323846;
@@ -847,6 +848,7 @@ TEMPLATE_TEST_CASE("Matrix4x4 3D Transformations Factories", "[Matrix4x4][transf
     using Matrix = ETL::Math::Matrix4x4<TestType>;
     using Vec4 = ETL::Math::Vector4<TestType>;
     constexpr double PI_HALF = PI / 2.0;
+    constexpr double eps = 1e-4; /// a few 16.16 steps
 
     SECTION("Scale static factory")
     {
@@ -888,6 +890,33 @@ TEMPLATE_TEST_CASE("Matrix4x4 3D Transformations Factories", "[Matrix4x4][transf
         REQUIRE(ETL::Math::isEqual(vResult, vExpected));
     }
 
+    SECTION("Rotation static factory - fast trigonometry")
+    {
+        const double angles[3] = { 0.35, -1.2, 2.9 };
+        const Matrix mPrecise = Matrix::CreateRotation(angles[0], angles[1], angles[2]);
+        const Matrix mFast = Matrix::CreateRotation(angles[0], angles[1], angles[2], ETL::Math::TrigPrecision::Fast);
+
+        REQUIRE(ETL::Math::isEqual(mFast, mPrecise, eps));
+
+        Matrix mSet = Matrix::Identity();
+        mSet.setRotation(angles[0], angles[1], angles[2], ETL::Math::TrigPrecision::Fast);
+        REQUIRE(ETL::Math::isEqual(mSet, mPrecise, eps));
+    }
+
+    SECTION("Batched rotation factory")
+    {
+        constexpr std::size_t COUNT = 70; /// more than one internal chunk
+        std::vector<ETL::Math::Vector3<double>> rotations(COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+            rotations[i] = ETL::Math::Vector3<double>{ 0.1 * double(i), -0.05 * double(i), 3.0 - 0.07 * double(i) };
+
+        std::vector<Matrix> matrices(COUNT);
+        ETL::Math::CreateRotations(std::span<Matrix>{ matrices }, std::span<const ETL::Math::Vector3<double>>{ rotations });
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+            REQUIRE(ETL::Math::isEqual(matrices[i], Matrix::CreateRotation(rotations[i].x(), rotations[i].y(), rotations[i].z()), eps));
+    }
+
     SECTION("Translation static factory")
     {
         const Matrix mTrans = Matrix::CreateTranslation(TestType(10), TestType(20), TestType(30));
@@ -1449,4 +1478,332 @@ TEMPLATE_TEST_CASE("Matrix4x4 Free Functions", "[Matrix4x4][free]", MATRIX4x4_TY
         REQUIRE(ETL::Math::isEqual(translation, Vec3{ TestType(5), TestType(10), TestType(15) }));
         REQUIRE(ETL::Math::isEqual(scale, ETL::Math::Vector3<double>{ 2.0, 3.0, 4.0 }, 0.001));
     }
-}
\ No newline at end of file
+}
+
+
+TEMPLATE_TEST_CASE("Matrix4x4 Projection Factories", "[Matrix4x4][projection]", MATRIX4x4_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using ETL::Math::DepthRange;
+
+    constexpr double eps = 0.001;
+
+    /// Real value of a component (the int accessors would truncate fixed point)
+    const auto value = [](const Vec3& v, int index) { return ETL::Math::DecodeValue<double>(v.getRawValue(index)); };
+
+    /// Points on the view axis at the near and far planes, plus an off-axis point at z = -2
+    const Vec3 points[3] = { Vec3{ TestType(0), TestType(0), TestType(-1) },
+                             Vec3{ TestType(0), TestType(0), TestType(-10) },
+                             Vec3{ TestType(2), TestType(1), TestType(-2) } };
+    Vec3 ndc[3];
+
+    SECTION("Perspective depth ranges")
+    {
+        const struct { DepthRange depth; double nearZ; double farZ; } cases[] = {
+            { DepthRange::NegativeOneToOne, -1.0, 1.0 },
+            { DepthRange::ZeroToOne,         0.0, 1.0 },
+            { DepthRange::ReversedZ,         1.0, 0.0 },
+        };
+
+        for (const auto& c : cases)
+        {
+            const Matrix proj = Matrix::CreatePerspective(PI / 2.0, 2.0, 1.0, 10.0, c.depth);
+            ETL::Math::ProjectPoints(std::span<Vec3>{ ndc }, proj, std::span<const Vec3>{ points });
+
+            REQUIRE(ETL::Math::isEqual(value(ndc[0], 2), c.nearZ, eps));
+            REQUIRE(ETL::Math::isEqual(value(ndc[1], 2), c.farZ, eps));
+            REQUIRE(ETL::Math::isEqual(value(ndc[2], 0), 0.5, eps));
+            REQUIRE(ETL::Math::isEqual(value(ndc[2], 1), 0.5, eps));
+        }
+    }
+
+    SECTION("Infinite far plane")
+    {
+        const Vec3 farPoints[2] = { Vec3{ TestType(0), TestType(0), TestType(-1) },
+                                    Vec3{ TestType(0), TestType(0), TestType(-10000) } };
+
+        const Matrix projGL = Matrix::CreatePerspectiveInfinite(PI / 2.0, 1.0, 1.0);
+        ETL::Math::ProjectPoints(std::span<Vec3>{ ndc, 2 }, projGL, std::span<const Vec3>{ farPoints });
+        REQUIRE(ETL::Math::isEqual(value(ndc[0], 2), -1.0, eps));
+        REQUIRE(ETL::Math::isEqual(value(ndc[1], 2), 1.0, eps));
+
+        const Matrix projReversed = Matrix::CreatePerspective(PI / 2.0, 1.0, 1.0, std::numeric_limits<double>::infinity(), DepthRange::ReversedZ);
+        ETL::Math::ProjectPoints(std::span<Vec3>{ ndc, 2 }, projReversed, std::span<const Vec3>{ farPoints });
+        REQUIRE(ETL::Math::isEqual(value(ndc[0], 2), 1.0, eps));
+        REQUIRE(ETL::Math::isEqual(value(ndc[1], 2), 0.0, eps));
+        REQUIRE(projReversed(2, 2) == TestType(0));
+    }
+
+    SECTION("Orthographic depth ranges")
+    {
+        const Vec3 corners[2] = { Vec3{ TestType(2), TestType(1), TestType(-1) },
+                                  Vec3{ TestType(-2), TestType(-1), TestType(-5) } };
+
+        const Matrix projGL = Matrix::CreateOrthographic(-2.0, 2.0, -1.0, 1.0, 1.0, 5.0);
+        ETL::Math::ProjectPoints(std::span<Vec3>{ ndc, 2 }, projGL, std::span<const Vec3>{ corners });
+        REQUIRE(ETL::Math::isEqual(ndc[0], Vec3{ TestType(1), TestType(1), TestType(-1) }, eps));
+        REQUIRE(ETL::Math::isEqual(ndc[1], Vec3{ TestType(-1), TestType(-1), TestType(1) }, eps));
+
+        const Matrix projReversed = Matrix::CreateOrthographic(-2.0, 2.0, -1.0, 1.0, 1.0, 5.0, DepthRange::ReversedZ);
+        ETL::Math::ProjectPoints(std::span<Vec3>{ ndc, 2 }, projReversed, std::span<const Vec3>{ corners });
+        REQUIRE(ETL::Math::isEqual(value(ndc[0], 2), 1.0, eps));
+        REQUIRE(ETL::Math::isEqual(value(ndc[1], 2), 0.0, eps));
+    }
+
+    SECTION("LookAt")
+    {
+        const Matrix view = Matrix::CreateLookAt(Vec3{ TestType(3), TestType(0), TestType(0) }, Vec3::Zero(), Vec3::Up());
+
+        REQUIRE(ETL::Math::isEqual(view.transformPoint(Vec3{ TestType(3), TestType(0), TestType(0) }), Vec3::Zero(), eps));
+        REQUIRE(ETL::Math::isEqual(view.transformPoint(Vec3::Zero()), Vec3{ TestType(0), TestType(0), TestType(-3) }, eps));
+        REQUIRE(ETL::Math::isEqual(view.transformPoint(Vec3{ TestType(3), TestType(1), TestType(0) }), Vec3::Up(), eps));
+        REQUIRE(ETL::Math::isEqual(view.transformPoint(Vec3{ TestType(3), TestType(0), TestType(-1) }), Vec3::Right(), eps));
+    }
+
+    SECTION("Inverse projection")
+    {
+        const Matrix projections[] = {
+            Matrix::CreatePerspective(PI / 3.0, 1.5, 1.0, 10.0),
+            Matrix::CreatePerspective(PI / 3.0, 1.5, 1.0, 10.0, DepthRange::ZeroToOne),
+            Matrix::CreatePerspectiveInfinite(PI / 3.0, 1.5, 1.0, DepthRange::ReversedZ),
+            Matrix::CreateOrthographic(-4.0, 2.0, -1.0, 3.0, 1.0, 9.0),
+            Matrix::CreateOrthographic(-4.0, 2.0, -1.0, 3.0, 1.0, 9.0, DepthRange::ReversedZ),
+        };
+
+        for (const Matrix& proj : projections)
+        {
+            Matrix inv;
+            REQUIRE(ETL::Math::InverseProjection(inv, proj));
+            REQUIRE(ETL::Math::isEqual(proj * inv, Matrix::Identity(), eps));
+
+            /// The general 16.16 inverse is too coarse to compare against
+            if constexpr (!std::integral<TestType>)
+            {
+                Matrix invGeneral{};
+                REQUIRE(ETL::Math::Inverse(invGeneral, proj));
+                REQUIRE(ETL::Math::isEqual(inv, invGeneral, eps));
+            }
+        }
+
+        /// Non projection matrix falls back to the general inverse
+        const Matrix m{ TestType(1), TestType(0), TestType(2), TestType(-1),
+                        TestType(3), TestType(0), TestType(0), TestType(5),
+                        TestType(2), TestType(1), TestType(4), TestType(-3),
+                        TestType(1), TestType(0), TestType(5), TestType(0) };
+        Matrix inv;
+        REQUIRE(ETL::Math::InverseProjection(inv, m));
+        REQUIRE(ETL::Math::isEqual(m * inv, Matrix::Identity(), eps));
+    }
+
+    SECTION("Batched clip transform matches Multiply")
+    {
+        const Matrix viewProj = Matrix::CreatePerspective(PI / 2.0, 2.0, 1.0, 10.0)
+                              * Matrix::CreateLookAt(Vec3{ TestType(1), TestType(2), TestType(3) }, Vec3::Zero(), Vec3::Up());
+
+        ETL::Math::Vector4<TestType> clip[3];
+        ETL::Math::TransformPoints(std::span<ETL::Math::Vector4<TestType>>{ clip }, viewProj, std::span<const Vec3>{ points });
+
+        for (int i = 0; i < 3; ++i)
+        {
+            ETL::Math::Vector4<TestType> expected;
+            ETL::Math::Multiply(expected, viewProj, ETL::Math::Vector4<TestType>{ points[i], TestType(1) });
+            REQUIRE(ETL::Math::isEqual(clip[i], expected, eps));
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Matrix4x4 Constant Evaluation", "[Matrix4x4][constexpr]", MATRIX4x4_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    constexpr double eps = 0.001;
+    constexpr double PI_HALF = 1.57079632679489661923;
+
+    SECTION("Factories and composition")
+    {
+        constexpr Matrix transform = Matrix::CreateTranslation(TestType(1), TestType(2), TestType(3))
+                                   * Matrix::CreateRotation(0.0, 0.0, PI_HALF)
+                                   * Matrix::CreateScale(2.0, 2.0, 2.0);
+
+        /// Scale x2, rotate 90 degrees around Z, then translate: (1,0,0) -> (0,2,0) -> (1,4,3)
+        constexpr Vec3 point = transform.transformPoint(Vec3::UnitX());
+        STATIC_REQUIRE(ETL::Math::isEqual(point, Vec3{ TestType(1), TestType(4), TestType(3) }, eps));
+
+        constexpr Vec3 direction = transform.transformDirection(Vec3::UnitY());
+        STATIC_REQUIRE(ETL::Math::isEqual(direction, Vec3{ TestType(-2), TestType(0), TestType(0) }, eps));
+    }
+
+    SECTION("Inverse, transpose and determinant")
+    {
+        constexpr Matrix m = Matrix::CreateTranslation(TestType(-1), TestType(5), TestType(2)) * Matrix::CreateScale(2.0, 4.0, 0.5);
+        constexpr Matrix inv = m.inverse();
+
+        STATIC_REQUIRE(ETL::Math::isEqual(m * inv, Matrix::Identity(), eps));
+        STATIC_REQUIRE(ETL::Math::isEqual(m.transpose().transpose(), m, eps));
+        STATIC_REQUIRE(ETL::Math::isEqual(m.determinant(true), ETL::Math::EncodeValue<TestType>(4.0), eps));
+    }
+
+    SECTION("Free functions and arithmetic")
+    {
+        constexpr auto product = []()
+        {
+            Matrix result;
+            ETL::Math::Multiply(result, Matrix::CreateScale(2.0, 2.0, 2.0), Matrix::Identity() + Matrix::Identity());
+            return result - Matrix::Identity();
+        }();
+
+        STATIC_REQUIRE(ETL::Math::isEqual(product, Matrix{ TestType(3), TestType(3), TestType(3), TestType(1) }, eps));
+        STATIC_REQUIRE(product * TestType(2) == TestType(2) * product);
+    }
+
+    SECTION("Compile time and run time agree")
+    {
+        constexpr Matrix rotation = Matrix::CreateRotation(0.3, -1.2, 2.5);
+        const Matrix runtime = Matrix::CreateRotation(0.3, -1.2, 2.5, ETL::Math::TrigPrecision::Fast);
+
+        REQUIRE(rotation == runtime);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Matrix4x4 Unchecked Raw Access", "[Matrix4x4][core]", MATRIX4x4_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+
+    const Matrix m = Matrix::CreateTranslation(TestType(1), TestType(2), TestType(3)) * Matrix::CreateScale(2.0, 3.0, 4.0);
+
+    SECTION("Columns and rows")
+    {
+        const TestType* translation = m.getRawCol(3);
+        TestType row[4];
+        m.getRawRowTo(row, 0);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            REQUIRE(translation[i] == m.getRawValue(i, 3));
+            REQUIRE(row[i] == m.getRawValue(0, i));
+            REQUIRE(m.getRawValueUnchecked(i, i) == m.getRawValue(i, i));
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Matrix4x4 Batched Multiply", "[Matrix4x4][batch]", MATRIX4x4_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+
+    constexpr double eps = 0.001;
+    constexpr std::size_t COUNT = 37; /// Not a multiple of any SIMD group: exercises the tail
+
+    std::vector<Matrix> a(COUNT), b(COUNT), result(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        a[i] = Matrix::CreateTranslation(TestType(double(i % 5)), TestType(-1), TestType(0.5)) * Matrix::CreateRotation(0.1 * double(i), 0.0, 0.3);
+        b[i] = Matrix::CreateScale(1.0 + 0.01 * double(i), 2.0, 0.5) * Matrix::CreateRotation(0.0, -0.05 * double(i), 0.0);
+    }
+    const Matrix parent = Matrix::CreateTranslation(TestType(2), TestType(3), TestType(-4)) * Matrix::CreateRotation(0.4, 0.2, -0.7);
+
+    SECTION("Pairwise matches single Multiply")
+    {
+        ETL::Math::Multiply(std::span<Matrix>{ result }, std::span<const Matrix>{ a }, std::span<const Matrix>{ b });
+        for (std::size_t i = 0; i < COUNT; ++i)
+            REQUIRE(ETL::Math::isEqual(result[i], a[i] * b[i], eps));
+    }
+
+    SECTION("Left and right broadcast")
+    {
+        ETL::Math::Multiply(std::span<Matrix>{ result }, parent, std::span<const Matrix>{ b });
+        for (std::size_t i = 0; i < COUNT; ++i)
+            REQUIRE(ETL::Math::isEqual(result[i], parent * b[i], eps));
+
+        ETL::Math::Multiply(std::span<Matrix>{ result }, std::span<const Matrix>{ a }, parent);
+        for (std::size_t i = 0; i < COUNT; ++i)
+            REQUIRE(ETL::Math::isEqual(result[i], a[i] * parent, eps));
+    }
+
+    SECTION("In-place updates")
+    {
+        std::vector<Matrix> world = b;
+        ETL::Math::Multiply(std::span<Matrix>{ world }, parent, std::span<const Matrix>{ world });
+        for (std::size_t i = 0; i < COUNT; ++i)
+            REQUIRE(ETL::Math::isEqual(world[i], parent * b[i], eps));
+
+        world = a;
+        ETL::Math::Multiply(std::span<Matrix>{ world }, std::span<const Matrix>{ world }, std::span<const Matrix>{ b });
+        for (std::size_t i = 0; i < COUNT; ++i)
+            REQUIRE(ETL::Math::isEqual(world[i], a[i] * b[i], eps));
+    }
+
+    SECTION("Parallel matches serial")
+    {
+        constexpr std::size_t LARGE = ETL::Math::MULTIPLY_PARALLEL_THRESHOLD * 3 + 5;
+        std::vector<Matrix> local(LARGE), serial(LARGE), parallel(LARGE);
+        for (std::size_t i = 0; i < LARGE; ++i)
+            local[i] = a[i % COUNT];
+
+        ETL::Math::Multiply(std::span<Matrix>{ serial }, parent, std::span<const Matrix>{ local });
+        ETL::Math::MultiplyParallel(std::span<Matrix>{ parallel }, parent, std::span<const Matrix>{ local }, 4);
+        REQUIRE(serial == parallel);
+
+        ETL::Math::Multiply(std::span<Matrix>{ serial }, std::span<const Matrix>{ local }, std::span<const Matrix>{ local });
+        ETL::Math::MultiplyParallel(std::span<Matrix>{ parallel }, std::span<const Matrix>{ local }, std::span<const Matrix>{ local }, 4);
+        REQUIRE(serial == parallel);
+
+        ETL::Math::Multiply(std::span<Matrix>{ serial }, std::span<const Matrix>{ local }, parent);
+        ETL::Math::MultiplyParallel(std::span<Matrix>{ parallel }, std::span<const Matrix>{ local }, parent, 4);
+        REQUIRE(serial == parallel);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Matrix4x4 Batched Inverse", "[Matrix4x4][batch]", MATRIX4x4_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+
+    constexpr double eps = 0.001;
+    constexpr std::size_t COUNT = 37; /// Not a multiple of any SIMD group: exercises the tail
+
+    std::vector<Matrix> mats(COUNT), result(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        mats[i] = Matrix::CreateTranslation(TestType(double(i % 5)), TestType(-1), TestType(0.5)) * Matrix::CreateRotation(0.1 * double(i), 0.0, 0.3)
+                * Matrix::CreateScale(1.0 + 0.02 * double(i), 2.0, 0.5);
+
+    bool ok[COUNT] = {};
+
+    SECTION("Matches single Inverse")
+    {
+        REQUIRE(ETL::Math::InverseN(std::span<const Matrix>{ mats }, std::span<Matrix>{ result }, std::span<bool>{ ok }));
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            REQUIRE(ok[i]);
+            REQUIRE(ETL::Math::isEqual(result[i], mats[i].inverse(), eps));
+            REQUIRE(ETL::Math::isEqual(mats[i] * result[i], Matrix::Identity(), eps));
+        }
+    }
+
+    SECTION("Singular matrices are reported and left untouched")
+    {
+        mats[3] = Matrix::CreateScale(1.0, 0.0, 1.0);
+        mats[COUNT - 1] = Matrix::Zero();
+        result[3] = result[COUNT - 1] = Matrix::Identity();
+
+        REQUIRE_FALSE(ETL::Math::InverseN(std::span<const Matrix>{ mats }, std::span<Matrix>{ result }, std::span<bool>{ ok }));
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            const bool bSingular = i == 3 || i == COUNT - 1;
+            REQUIRE(ok[i] == !bSingular);
+            REQUIRE(ETL::Math::isEqual(result[i], bSingular ? Matrix::Identity() : mats[i].inverse(), eps));
+        }
+    }
+
+    SECTION("In-place inverse")
+    {
+        std::vector<Matrix> inverted = mats;
+        ETL::Math::InverseN(std::span<const Matrix>{ inverted }, std::span<Matrix>{ inverted }, std::span<bool>{ ok });
+        for (std::size_t i = 0; i < COUNT; ++i)
+            REQUIRE(ETL::Math::isEqual(inverted[i], mats[i].inverse(), eps));
+    }
+}
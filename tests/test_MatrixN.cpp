@@ -0,0 +1,305 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_MatrixN.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Types/MatrixN.h>
+#include <type_traits>
+
+#define MATRIXN_TYPES int, float, double
+
+/// Aliases resolve to the hand-tuned classes where they exist
+static_assert(std::is_same_v<ETL::Math::Vector<float, 3>, ETL::Math::Vector3<float>>);
+static_assert(std::is_same_v<ETL::Math::Vector<float, 6>, ETL::Math::Vec6>);
+static_assert(std::is_same_v<ETL::Math::Matrix<double, 4, 4>, ETL::Math::Matrix4x4<double>>);
+static_assert(std::is_same_v<ETL::Math::Matrix<double, 3, 3>, ETL::Math::Matrix3x3<double>>);
+static_assert(std::is_same_v<ETL::Math::Matrix<int, 3, 4>, ETL::Math::Mat3x4i>);
+static_assert(std::is_same_v<decltype(ETL::Math::Mat3x4{}.transpose()), ETL::Math::MatrixN<float, 4, 3>>);
+static_assert(std::is_same_v<decltype(ETL::Math::Mat3x4{} * ETL::Math::MatrixN<float, 4, 3>{}), ETL::Math::Mat3>);
+
+/// Constant evaluation takes the scalar path
+static_assert([]()
+{
+    using namespace ETL::Math;
+    constexpr Mat2d a{ 1.0, 2.0,
+                       3.0, 4.0 };
+    const Mat2d product = a * a;
+    return product(0, 0) == 7.0 && product(0, 1) == 10.0 && product(1, 0) == 15.0 && product(1, 1) == 22.0
+        && a.determinant() == -2.0;
+}());
+
+
+namespace
+{
+    /// Deterministic test values in [-2, 2), exact in 16.16 fixed point
+    template<ETL::Math::MatrixType Mat>
+    Mat MakeMatrix(int seed)
+    {
+        using Type = typename ETL::Math::helpers::MatrixShape<Mat>::ValueType;
+
+        Mat result;
+        for (int row = 0; row < ETL::Math::helpers::MatrixShape<Mat>::ROWS; ++row)
+            for (int col = 0; col < ETL::Math::helpers::MatrixShape<Mat>::COLS; ++col)
+                result(row, col) = Type(double((seed * 7 + row * 5 + col * 3) % 16) / 4.0 - 2.0);
+        return result;
+    }
+
+    /// Reference product in double
+    template<typename Out, typename A, typename B>
+    bool MatchesNaiveProduct(const Out& product, const A& a, const B& b, double epsilon)
+    {
+        for (int row = 0; row < ETL::Math::helpers::MatrixShape<A>::ROWS; ++row)
+        {
+            for (int col = 0; col < ETL::Math::helpers::MatrixShape<B>::COLS; ++col)
+            {
+                double sum = 0.0;
+                for (int k = 0; k < ETL::Math::helpers::MatrixShape<A>::COLS; ++k)
+                    sum += double(a(row, k)) * double(b(k, col));
+                if (std::abs(double(product(row, col)) - sum) > epsilon)
+                    return false;
+            }
+        }
+        return true;
+    }
+}
+
+
+TEMPLATE_TEST_CASE("MatrixN Construction & Access", "[MatrixN]", MATRIXN_TYPES)
+{
+    using namespace ETL::Math;
+    using Matrix = Matrix3x4<TestType>;
+
+    SECTION("Row-major constructor, column-major storage")
+    {
+        const Matrix m{ 0, 1, 2, 3,
+                        4, 5, 6, 7,
+                        8, 9, 10, 11 };
+
+        REQUIRE(m(1, 2) == TestType(6));
+        REQUIRE(m[0] == TestType(0));
+        REQUIRE(m[1] == TestType(4));
+        REQUIRE(m[3] == TestType(1));
+        REQUIRE(m.getRow(2) == Vector4<TestType>{ TestType(8), TestType(9), TestType(10), TestType(11) });
+        REQUIRE(m.getCol(3) == Vector3<TestType>{ TestType(3), TestType(7), TestType(11) });
+    }
+
+    SECTION("Diagonal, Zero & Identity")
+    {
+        const Matrix identity = Matrix::Identity();
+        for (int row = 0; row < 3; ++row)
+            for (int col = 0; col < 4; ++col)
+                REQUIRE(identity(row, col) == TestType(row == col ? 1 : 0));
+
+        REQUIRE(isZero(Matrix::Zero()));
+    }
+
+    SECTION("Setters and proxies")
+    {
+        Matrix m = Matrix::Zero();
+        m.setRow(1, Vector4<TestType>{ TestType(1), TestType(2), TestType(3), TestType(4) });
+        m.setCol(0, Vector3<TestType>{ TestType(5), TestType(6), TestType(7) });
+        m(2, 3) = TestType(9);
+
+        REQUIRE(m(0, 0) == TestType(5));
+        REQUIRE(m(1, 0) == TestType(6));
+        REQUIRE(m(1, 3) == TestType(4));
+        REQUIRE(m(2, 3) == TestType(9));
+    }
+
+    SECTION("Arithmetic")
+    {
+        const Matrix a = MakeMatrix<Matrix>(1);
+        const Matrix b = MakeMatrix<Matrix>(2);
+
+        REQUIRE((a + b - b) == a);
+        REQUIRE((a * TestType(2))(1, 1) == TestType(2) * a(1, 1));
+        REQUIRE(isEqual((TestType(2) * a) / TestType(2), a));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("MatrixN Products", "[MatrixN]", MATRIXN_TYPES)
+{
+    using namespace ETL::Math;
+
+    const double epsilon = std::is_integral_v<TestType> ? 1e-3 : 1e-4;
+
+    SECTION("6x6 * 6x6")
+    {
+        const Matrix6x6<TestType> a = MakeMatrix<Matrix6x6<TestType>>(3);
+        const Matrix6x6<TestType> b = MakeMatrix<Matrix6x6<TestType>>(5);
+
+        REQUIRE(MatchesNaiveProduct(a * b, a, b, epsilon));
+
+        /// Aliasing
+        Matrix6x6<TestType> c = a;
+        Multiply(c, c, b);
+        REQUIRE(c == a * b);
+    }
+
+    SECTION("3x4 * Matrix4x4 is the top of the Matrix4x4 product")
+    {
+        const Matrix4x4<TestType> transform = Matrix4x4<TestType>::CreateTranslation(TestType(1), TestType(2), TestType(3))
+                                            * Matrix4x4<TestType>::CreateRotation(0.25, 0.5, 0.75);
+        const Matrix4x4<TestType> other = Matrix4x4<TestType>::CreateRotation(-0.5, 0.125, 0.25);
+
+        Matrix3x4<TestType> top;
+        GetBlock<0, 0>(top, transform);
+
+        const Matrix3x4<TestType> product = top * other;
+        const Matrix4x4<TestType> full = transform * other;
+        for (int row = 0; row < 3; ++row)
+            for (int col = 0; col < 4; ++col)
+                REQUIRE(isEqual(product.getRawValue(row, col), full.getRawValue(row, col)));
+    }
+
+    SECTION("2x2 and rectangular products")
+    {
+        const Matrix2x2<TestType> a = MakeMatrix<Matrix2x2<TestType>>(1);
+        const Matrix2x2<TestType> b = MakeMatrix<Matrix2x2<TestType>>(4);
+        REQUIRE(MatchesNaiveProduct(a * b, a, b, epsilon));
+
+        const MatrixN<TestType, 4, 3> tall = MakeMatrix<MatrixN<TestType, 4, 3>>(2);
+        const Matrix3x4<TestType> wide = MakeMatrix<Matrix3x4<TestType>>(6);
+        const Matrix3x3<TestType> square = wide * tall;
+        REQUIRE(MatchesNaiveProduct(square, wide, tall, epsilon));
+    }
+
+    SECTION("Matrix * vector")
+    {
+        const Matrix6x6<TestType> m = MakeMatrix<Matrix6x6<TestType>>(7);
+        const Vector6<TestType> v{ 1.0, -0.5, 0.25, 2.0, -1.5, 0.75 };
+
+        const Vector6<TestType> result = m * v;
+        for (int row = 0; row < 6; ++row)
+        {
+            double sum = 0.0;
+            for (int k = 0; k < 6; ++k)
+                sum += DecodeValue<double>(m.getRawValue(row, k)) * DecodeValue<double>(v.getRawValue(k));
+            REQUIRE(std::abs(DecodeValue<double>(result.getRawValue(row)) - sum) < epsilon);
+        }
+
+        const Matrix3x4<TestType> affine = MakeMatrix<Matrix3x4<TestType>>(1);
+        const Vector3<TestType> point = affine * Vector4<TestType>{ 1.0, 2.0, 3.0, 1.0 };
+        REQUIRE(isEqual(point, Vector3<TestType>{ double(affine.getRow(0) * Vector4<TestType>{ 1.0, 2.0, 3.0, 1.0 }),
+                                                  double(affine.getRow(1) * Vector4<TestType>{ 1.0, 2.0, 3.0, 1.0 }),
+                                                  double(affine.getRow(2) * Vector4<TestType>{ 1.0, 2.0, 3.0, 1.0 }) }));
+    }
+
+    SECTION("Runtime (SIMD) matches constant evaluation (scalar)")
+    {
+        constexpr Matrix6x6<TestType> a{ 1, 2, 0, -1, 3, 1,
+                                         0, 1, 4, 2, -2, 0,
+                                         2, 0, 1, 1, 0, -3,
+                                         -1, 3, 0, 2, 1, 1,
+                                         0, 1, -2, 0, 1, 2,
+                                         3, 0, 1, -1, 2, 1 };
+        constexpr Matrix6x6<TestType> squared = a * a;
+
+        const Matrix6x6<TestType> runtime = a;
+        REQUIRE(runtime * runtime == squared);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("MatrixN Methods", "[MatrixN]", MATRIXN_TYPES)
+{
+    using namespace ETL::Math;
+
+    SECTION("Transpose")
+    {
+        const Matrix3x4<TestType> m = MakeMatrix<Matrix3x4<TestType>>(2);
+        const MatrixN<TestType, 4, 3> t = m.transpose();
+        for (int row = 0; row < 3; ++row)
+            for (int col = 0; col < 4; ++col)
+                REQUIRE(t(col, row) == m(row, col));
+        REQUIRE(t.transpose() == m);
+    }
+
+    SECTION("2x2 determinant and inverse")
+    {
+        const Matrix2x2<TestType> m{ 4.0, 7.0,
+                                     2.0, 6.0 };
+        REQUIRE(m.determinant() == Catch::Approx(10.0));
+
+        const Matrix2x2<TestType> inverse = m.inverse();
+        REQUIRE(isEqual(inverse * m, Matrix2x2<TestType>::Identity(), 0.001));
+
+        Matrix2x2<TestType> singular{ 1.0, 2.0,
+                                      2.0, 4.0 };
+        REQUIRE_FALSE(Inverse(singular, singular));
+        REQUIRE(singular(1, 1) == TestType(4));
+    }
+
+    SECTION("6x6 determinant and inverse")
+    {
+        Matrix6x6<TestType> m = Matrix6x6<TestType>::Identity() * TestType(4);
+        SetBlock<0, 3>(m, Matrix3x3<TestType>::Identity());
+        SetBlock<3, 0>(m, Matrix3x3<TestType>{ TestType(1), TestType(2), TestType(3) });
+
+        /// Block determinant: det(16 I - diag(1, 2, 3)) = 15 * 14 * 13
+        REQUIRE(m.determinant() == Catch::Approx(15.0 * 14.0 * 13.0));
+
+        Matrix6x6<TestType> inverse;
+        REQUIRE(Inverse(inverse, m));
+        REQUIRE(isEqual(inverse * m, Matrix6x6<TestType>::Identity(), 0.001));
+    }
+
+    SECTION("Blocks")
+    {
+        const Matrix6x6<TestType> m = MakeMatrix<Matrix6x6<TestType>>(1);
+
+        Matrix3x3<TestType> block;
+        GetBlock<3, 3>(block, m);
+        REQUIRE(block(0, 0) == m(3, 3));
+        REQUIRE(block(2, 1) == m(5, 4));
+
+        Matrix6x6<TestType> copy = Matrix6x6<TestType>::Zero();
+        SetBlock<3, 3>(copy, block);
+        REQUIRE(copy(5, 4) == m(5, 4));
+        REQUIRE(copy(0, 0) == TestType(0));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("VectorN", "[MatrixN]", MATRIXN_TYPES)
+{
+    using namespace ETL::Math;
+    using Vec = Vector6<TestType>;
+
+    const Vec a{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+    const Vec b{ 0.5, -1.0, 0.0, 2.0, 1.0, -0.5 };
+
+    SECTION("Arithmetic")
+    {
+        REQUIRE((a + b)[1] == TestType(1));
+        REQUIRE((a - b)[3] == TestType(2));
+        REQUIRE((-a)[5] == TestType(-6));
+        REQUIRE((a * TestType(2))[2] == TestType(6));
+        REQUIRE((TestType(2) * a) / TestType(2) == a);
+        REQUIRE(a.dot(b) == Catch::Approx(0.5 - 2.0 + 8.0 + 5.0 - 3.0));
+        REQUIRE(a * b == a.dot(b));
+        REQUIRE(Vec::Unit(4)[4] == TestType(1));
+        REQUIRE(Vec::Unit(4).lengthSquared() == 1.0);
+    }
+
+    SECTION("Normalize")
+    {
+        REQUIRE(a.normalize().length() == Catch::Approx(1.0).epsilon(0.001));
+
+        Vec zero = Vec::Zero();
+        REQUIRE_FALSE(Normalize(zero, zero));
+    }
+
+    SECTION("Segments")
+    {
+        REQUIRE(a.template getSegment<0, 3>() == Vector3<TestType>{ TestType(1), TestType(2), TestType(3) });
+        REQUIRE(a.template getSegment<3, 3>() == Vector3<TestType>{ TestType(4), TestType(5), TestType(6) });
+
+        Vec spatial = Vec::Zero();
+        spatial.template setSegment<3>(Vector3<TestType>{ TestType(7), TestType(8), TestType(9) });
+        REQUIRE(spatial[2] == TestType(0));
+        REQUIRE(spatial[4] == TestType(8));
+    }
+}
@@ -0,0 +1,277 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Overlap.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include "TestHelpers.h"
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Geometry/Overlap.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#define OVERLAP_TYPES int, float, double
+#define OVERLAP_BATCH_TYPES float, double
+
+
+TEMPLATE_TEST_CASE("Overlap Closest Points", "[Overlap]", OVERLAP_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+
+    SECTION("Point on segment")
+    {
+        const Vector start{ TestType(0), TestType(0), TestType(0) };
+        const Vector end{ TestType(4), TestType(0), TestType(0) };
+        Vector result;
+
+        ClosestPointOnSegment(result, start, end, Vector{ TestType(1), TestType(3), TestType(0) });
+        REQUIRE(isEqual(result, Vector{ TestType(1), TestType(0), TestType(0) }));
+
+        ClosestPointOnSegment(result, start, end, Vector{ TestType(-2), TestType(1), TestType(1) });
+        REQUIRE(result == start);
+
+        ClosestPointOnSegment(result, start, end, Vector{ TestType(7), TestType(0), TestType(-1) });
+        REQUIRE(result == end);
+
+        ClosestPointOnSegment(result, start, start, Vector{ TestType(7), TestType(0), TestType(-1) });
+        REQUIRE(result == start);
+    }
+
+    SECTION("Segment-segment")
+    {
+        Vector onFirst, onSecond;
+
+        /// Skew segments crossing above each other
+        ClosestPointsSegmentSegment(onFirst, onSecond,
+                                    Vector{ TestType(-2), TestType(0), TestType(0) }, Vector{ TestType(2), TestType(0), TestType(0) },
+                                    Vector{ TestType(1), TestType(-2), TestType(1) }, Vector{ TestType(1), TestType(2), TestType(1) });
+        REQUIRE(isEqual(onFirst, Vector{ TestType(1), TestType(0), TestType(0) }));
+        REQUIRE(isEqual(onSecond, Vector{ TestType(1), TestType(0), TestType(1) }));
+
+        /// Closest points at the segment ends
+        ClosestPointsSegmentSegment(onFirst, onSecond,
+                                    Vector{ TestType(0), TestType(0), TestType(0) }, Vector{ TestType(1), TestType(0), TestType(0) },
+                                    Vector{ TestType(3), TestType(1), TestType(0) }, Vector{ TestType(3), TestType(4), TestType(0) });
+        REQUIRE(isEqual(onFirst, Vector{ TestType(1), TestType(0), TestType(0) }));
+        REQUIRE(isEqual(onSecond, Vector{ TestType(3), TestType(1), TestType(0) }));
+
+        /// Parallel segments: any pair at the right distance
+        ClosestPointsSegmentSegment(onFirst, onSecond,
+                                    Vector{ TestType(0), TestType(0), TestType(0) }, Vector{ TestType(4), TestType(0), TestType(0) },
+                                    Vector{ TestType(2), TestType(3), TestType(0) }, Vector{ TestType(6), TestType(3), TestType(0) });
+        REQUIRE(isEqual((onSecond - onFirst).length(), 3.0));
+        REQUIRE(onFirst.x() >= TestType(2));
+
+        /// Degenerate first segment
+        ClosestPointsSegmentSegment(onFirst, onSecond,
+                                    Vector{ TestType(1), TestType(1), TestType(0) }, Vector{ TestType(1), TestType(1), TestType(0) },
+                                    Vector{ TestType(0), TestType(0), TestType(0) }, Vector{ TestType(4), TestType(0), TestType(0) });
+        REQUIRE(onFirst == Vector{ TestType(1), TestType(1), TestType(0) });
+        REQUIRE(isEqual(onSecond, Vector{ TestType(1), TestType(0), TestType(0) }));
+    }
+
+    SECTION("Volumes")
+    {
+        Vector result;
+
+        const Sphere<TestType> sphere{ Vector{ TestType(1), TestType(0), TestType(0) }, 2.0 };
+        ClosestPoint(result, sphere, Vector{ TestType(5), TestType(0), TestType(0) });
+        REQUIRE(isEqual(result, Vector{ TestType(3), TestType(0), TestType(0) }));
+        ClosestPoint(result, sphere, Vector{ TestType(2), TestType(1), TestType(0) });
+        REQUIRE(result == Vector{ TestType(2), TestType(1), TestType(0) });
+
+        const Capsule<TestType> capsule{ Vector::Zero(), Vector{ TestType(0), TestType(4), TestType(0) }, 1.0 };
+        ClosestPoint(result, capsule, Vector{ TestType(3), TestType(2), TestType(0) });
+        REQUIRE(isEqual(result, Vector{ TestType(1), TestType(2), TestType(0) }));
+        ClosestPoint(result, capsule, Vector{ TestType(0), TestType(8), TestType(0) });
+        REQUIRE(isEqual(result, Vector{ TestType(0), TestType(5), TestType(0) }));
+        ClosestPoint(result, capsule, Vector{ TestType(0), TestType(-1), TestType(0) });
+        REQUIRE(result == Vector{ TestType(0), TestType(-1), TestType(0) });
+
+        /// Box rotated a quarter turn around z: local x (half extent 1) along world y
+        const Matrix3x3<TestType> rotation{ TestType(0), TestType(-1), TestType(0),
+                                            TestType(1), TestType(0),  TestType(0),
+                                            TestType(0), TestType(0),  TestType(1) };
+        const Obb<TestType> box{ Vector::Zero(), rotation, Vector{ TestType(1), TestType(2), TestType(3) } };
+        ClosestPoint(result, box, Vector{ TestType(5), TestType(5), TestType(1) });
+        REQUIRE(isEqual(result, Vector{ TestType(2), TestType(1), TestType(1) }));
+        ClosestPoint(result, box, Vector{ TestType(-1), TestType(0), TestType(-2) });
+        REQUIRE(isEqual(result, Vector{ TestType(-1), TestType(0), TestType(-2) }));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Overlap Tests", "[Overlap]", OVERLAP_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+
+    SECTION("Sphere-sphere")
+    {
+        const Sphere<TestType> a{ Vector::Zero(), 1.0 };
+        REQUIRE(OverlapSphereSphere(a, Sphere<TestType>{ Vector{ TestType(1), TestType(1), TestType(0) }, 0.5 }));
+        REQUIRE(OverlapSphereSphere(a, Sphere<TestType>{ Vector{ TestType(3), TestType(0), TestType(0) }, 2.0 })); /// touching
+        REQUIRE_FALSE(OverlapSphereSphere(a, Sphere<TestType>{ Vector{ TestType(2), TestType(2), TestType(0) }, 1.5 }));
+    }
+
+    SECTION("Sphere-capsule")
+    {
+        const Capsule<TestType> capsule{ Vector::Zero(), Vector{ TestType(0), TestType(4), TestType(0) }, 0.5 };
+        REQUIRE(OverlapSphereCapsule(Sphere<TestType>{ Vector{ TestType(1), TestType(2), TestType(0) }, 0.75 }, capsule));
+        REQUIRE_FALSE(OverlapSphereCapsule(Sphere<TestType>{ Vector{ TestType(1), TestType(2), TestType(0) }, 0.25 }, capsule));
+
+        /// Beyond the end cap: the distance is to the segment end, not to the infinite line
+        REQUIRE(OverlapSphereCapsule(Sphere<TestType>{ Vector{ TestType(0), TestType(5), TestType(0) }, 0.75 }, capsule));
+        REQUIRE_FALSE(OverlapSphereCapsule(Sphere<TestType>{ Vector{ TestType(0), TestType(6), TestType(0) }, 0.75 }, capsule));
+    }
+
+    SECTION("Capsule-capsule")
+    {
+        const Capsule<TestType> a{ Vector{ TestType(-2), TestType(0), TestType(0) }, Vector{ TestType(2), TestType(0), TestType(0) }, 0.5 };
+
+        /// Skew, 1 apart
+        REQUIRE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(1), TestType(-2), TestType(1) }, Vector{ TestType(1), TestType(2), TestType(1) }, 0.75 }));
+        REQUIRE_FALSE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(1), TestType(-2), TestType(1) }, Vector{ TestType(1), TestType(2), TestType(1) }, 0.25 }));
+
+        /// Parallel, 2 apart
+        REQUIRE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(0), TestType(2), TestType(0) }, Vector{ TestType(5), TestType(2), TestType(0) }, 1.5 }));
+        REQUIRE_FALSE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(0), TestType(2), TestType(0) }, Vector{ TestType(5), TestType(2), TestType(0) }, 1.0 }));
+
+        /// Collinear, end to end
+        REQUIRE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(3), TestType(0), TestType(0) }, Vector{ TestType(6), TestType(0), TestType(0) }, 0.5 }));
+        REQUIRE_FALSE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(4), TestType(0), TestType(0) }, Vector{ TestType(6), TestType(0), TestType(0) }, 0.5 }));
+
+        /// Degenerate capsules are spheres
+        REQUIRE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(0), TestType(1), TestType(0) }, Vector{ TestType(0), TestType(1), TestType(0) }, 0.5 }));
+        REQUIRE_FALSE(OverlapCapsuleCapsule(a, Capsule<TestType>{ Vector{ TestType(0), TestType(2), TestType(0) }, Vector{ TestType(0), TestType(2), TestType(0) }, 0.5 }));
+    }
+
+    SECTION("Obb-Obb")
+    {
+        const Vector one = Vector::One();
+        const Obb<TestType> a{ Vector::Zero(), Matrix3x3<TestType>::Identity(), one };
+
+        /// Face axes
+        REQUIRE(OverlapObbObb(a, Obb<TestType>{ Vector{ TestType(1), TestType(1), TestType(1) }, Matrix3x3<TestType>::Identity(), one }));
+        REQUIRE_FALSE(OverlapObbObb(a, Obb<TestType>{ Vector{ TestType(0), TestType(3), TestType(0) }, Matrix3x3<TestType>::Identity(), one }));
+
+        /// B turned 45 degrees around z reaches sqrt(2) along x
+        const Matrix3x3<TestType> turned{ std::sqrt(0.5), -std::sqrt(0.5), 0.0,
+                                          std::sqrt(0.5),  std::sqrt(0.5), 0.0,
+                                          0.0,             0.0,            1.0 };
+        REQUIRE(OverlapObbObb(a, Obb<TestType>{ Vector{ 2.3, 0.0, 0.0 }, turned, one }));
+        REQUIRE_FALSE(OverlapObbObb(a, Obb<TestType>{ Vector{ 2.5, 0.0, 0.0 }, turned, one }));
+
+        /// Edge against edge: only a cross product axis separates (contact at z = 2 * sqrt(2))
+        const Obb<TestType> edgeA{ Vector::Zero(), TestHelpers::MakeRotation<TestType>(0.25 * 3.14159265358979, 0.0), one };
+        const Matrix3x3<TestType> edgeRotation = TestHelpers::MakeRotation<TestType>(0.0, 0.25 * 3.14159265358979);
+        REQUIRE(OverlapObbObb(edgeA, Obb<TestType>{ Vector{ 0.0, 0.0, 2.7 }, edgeRotation, one }));
+        REQUIRE_FALSE(OverlapObbObb(edgeA, Obb<TestType>{ Vector{ 0.0, 0.0, 2.95 }, edgeRotation, one }));
+
+        /// Parallel boxes (degenerate cross axes)
+        REQUIRE(OverlapObbObb(a, Obb<TestType>{ Vector{ 1.5, 0.5, 0.0 }, Matrix3x3<TestType>::Identity(), one }));
+        REQUIRE_FALSE(OverlapObbObb(a, Obb<TestType>{ Vector{ 2.5, 0.5, 0.0 }, Matrix3x3<TestType>::Identity(), one }));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Overlap Batch matches single", "[Overlap]", OVERLAP_BATCH_TYPES)
+{
+    using namespace ETL::Math;
+    using Vector = Vector3<TestType>;
+
+    constexpr int COUNT = 203; /// not a multiple of any pack width
+
+    auto value = [](int i, int k, double scale) { return scale * std::sin(0.37 * i + 1.71 * k + 0.1 * i * k); };
+
+    /// Shapes (AoS, for the single queries) and their SoA components
+    std::vector<Sphere<TestType>> spheres;
+    std::vector<Capsule<TestType>> capsules;
+    std::vector<Obb<TestType>> boxes;
+    std::vector<TestType> components[1 + 3 + 3 + 9 + 3];
+    for (int i = 0; i < 2 * COUNT; ++i)
+    {
+        const Vector center{ value(i, 0, 3.0), value(i, 1, 3.0), value(i, 2, 3.0) };
+        const Vector end = center + Vector{ value(i, 3, 2.0), value(i, 4, 2.0), value(i, 5, 2.0) };
+        const double radius = 0.5 + 0.4 * value(i, 6, 1.0);
+        const Vector halfExtents{ 0.8 + 0.5 * value(i, 7, 1.0), 0.8 + 0.5 * value(i, 8, 1.0), 0.8 + 0.5 * value(i, 9, 1.0) };
+        const Matrix3x3<TestType> rotation = TestHelpers::MakeRotation<TestType>(value(i, 10, 3.0), value(i, 11, 3.0));
+
+        spheres.emplace_back(center, radius);
+        capsules.emplace_back(center, end, radius);
+        boxes.emplace_back(center, rotation, halfExtents);
+
+        components[0].push_back(TestType(radius));
+        for (int c = 0; c < 3; ++c)
+        {
+            components[1 + c].push_back(center.getRawValue(c));
+            components[4 + c].push_back(end.getRawValue(c));
+            components[16 + c].push_back(halfExtents.getRawValue(c));
+            for (int axis = 0; axis < 3; ++axis)
+                components[7 + axis * 3 + c].push_back(rotation.getRawValue(c, axis));
+        }
+    }
+
+    /// View over shapes [first, first + COUNT)
+    auto span = [&](int component, int first) { return std::span<const TestType>{ components[component].data() + first, COUNT }; };
+    auto sphereView = [&](int first) { return SphereSoA<TestType>{ { span(1, first), span(2, first), span(3, first) }, span(0, first) }; };
+    auto capsuleView = [&](int first)
+    {
+        return CapsuleSoA<TestType>{ { span(1, first), span(2, first), span(3, first) }, { span(4, first), span(5, first), span(6, first) }, span(0, first) };
+    };
+    auto boxView = [&](int first)
+    {
+        ObbSoA<TestType> view;
+        for (int c = 0; c < 3; ++c)
+        {
+            view.center[c] = span(1 + c, first);
+            view.halfExtents[c] = span(16 + c, first);
+            for (int axis = 0; axis < 3; ++axis)
+                view.axes[axis][c] = span(7 + axis * 3 + c, first);
+        }
+        return view;
+    };
+
+    std::unique_ptr<bool[]> overlap = std::make_unique<bool[]>(COUNT);
+    const std::span<bool> out{ overlap.get(), COUNT };
+
+    /// Pair i: shape i against shape COUNT + i. Both outcomes must be covered.
+    auto check = [&](std::size_t count, auto&& single)
+    {
+        std::size_t expected = 0;
+        for (int i = 0; i < COUNT; ++i)
+        {
+            const bool bOverlap = single(i, COUNT + i);
+            REQUIRE(out[i] == bOverlap);
+            expected += bOverlap ? 1 : 0;
+        }
+        REQUIRE(count == expected);
+        REQUIRE(expected > 0);
+        REQUIRE(expected < COUNT);
+    };
+
+    SECTION("Sphere-sphere")
+    {
+        check(OverlapSphereSphere(out, sphereView(0), sphereView(COUNT)),
+              [&](int i, int j) { return OverlapSphereSphere(spheres[i], spheres[j]); });
+    }
+
+    SECTION("Sphere-capsule")
+    {
+        check(OverlapSphereCapsule(out, sphereView(0), capsuleView(COUNT)),
+              [&](int i, int j) { return OverlapSphereCapsule(spheres[i], capsules[j]); });
+    }
+
+    SECTION("Capsule-capsule")
+    {
+        check(OverlapCapsuleCapsule(out, capsuleView(0), capsuleView(COUNT)),
+              [&](int i, int j) { return OverlapCapsuleCapsule(capsules[i], capsules[j]); });
+    }
+
+    SECTION("Obb-Obb")
+    {
+        check(OverlapObbObb(out, boxView(0), boxView(COUNT)),
+              [&](int i, int j) { return OverlapObbObb(boxes[i], boxes[j]); });
+    }
+}
@@ -0,0 +1,403 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_PackedTypes.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include "TestHelpers.h"
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Common/FixedPointHelpers.h>
+#include <MathLib/Compression/PackedTypes.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#define PACKED_TYPES int, float, double
+
+namespace
+{
+    using TestHelpers::BATCH_COUNT;
+
+    /// Deterministic vector with components in [-scale, scale]
+    template<typename Type>
+    ETL::Math::Vector3<Type> MakeVector(int seed, double scale)
+    {
+        return ETL::Math::Vector3<Type>{ scale * TestHelpers::SeedValue(seed, 0), scale * TestHelpers::SeedValue(seed, 1), scale * TestHelpers::SeedValue(seed, 2) };
+    }
+
+    /// Deterministic unit quaternion
+    template<typename Type>
+    ETL::Math::Quaternion<Type> MakeRotation(int seed)
+    {
+        double q[4], length = 0.0;
+        for (int k = 0; k < 4; ++k)
+        {
+            q[k] = TestHelpers::SeedValue(seed, k);
+            length += q[k] * q[k];
+        }
+        length = std::sqrt(length);
+        return ETL::Math::Quaternion<Type>{ q[0] / length, q[1] / length, q[2] / length, q[3] / length };
+    }
+
+    template<typename Packed>
+    bool SameBits(const Packed& a, const Packed& b)
+    {
+        return std::memcmp(&a, &b, sizeof(Packed)) == 0;
+    }
+
+    template<typename Type>
+    double Component(const ETL::Math::Vector3<Type>& v, int index)
+    {
+        return ETL::Math::DecodeValue<double>(v.getRawValue(index));
+    }
+
+    /// Angle between two non-zero vectors
+    template<typename Type>
+    double Angle(const ETL::Math::Vector3<Type>& a, const ETL::Math::Vector3<Type>& b)
+    {
+        double cross[3], dot = 0.0;
+        for (int i = 0; i < 3; ++i)
+        {
+            const int j = (i + 1) % 3, k = (i + 2) % 3;
+            cross[i] = Component(a, j) * Component(b, k) - Component(a, k) * Component(b, j);
+            dot += Component(a, i) * Component(b, i);
+        }
+        return std::atan2(std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]), dot);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("PackedTypes Half Vector", "[PackedTypes][half]", PACKED_TYPES)
+{
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    SECTION("Exact values round trip")
+    {
+        const Vec3 vec{ 1.0, -2.5, 0.125 };
+        ETL::Math::PackedVector3Half packed;
+        ETL::Math::Encode(packed, vec);
+        REQUIRE(packed.x == 0x3C00);
+        REQUIRE(packed.y == 0xC100);
+        REQUIRE(packed.z == 0x3000);
+
+        Vec3 decoded;
+        ETL::Math::Decode(decoded, packed);
+        REQUIRE(decoded == vec);
+    }
+
+    SECTION("Relative error bound")
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            const Vec3 vec = MakeVector<TestType>(i, 1000.0);
+            ETL::Math::PackedVector3Half packed;
+            Vec3 decoded;
+            ETL::Math::Encode(packed, vec);
+            ETL::Math::Decode(decoded, packed);
+
+            for (int c = 0; c < 3; ++c)
+                REQUIRE(std::fabs(Component(decoded, c) - Component(vec, c)) <= std::fabs(Component(vec, c)) / 2048.0 + 1.0 / 65536.0);
+        }
+    }
+
+    SECTION("Saturation")
+    {
+        if constexpr (!std::is_same_v<TestType, int>)
+        {
+            ETL::Math::PackedVector3Half packed;
+            Vec3 decoded;
+            ETL::Math::Encode(packed, Vec3{ 1.0e6, -1.0e6, 65519.0 });
+            ETL::Math::Decode(decoded, packed);
+            REQUIRE(decoded == Vec3{ 65504.0, -65504.0, 65504.0 });
+        }
+    }
+
+    SECTION("Batch matches single")
+    {
+        std::vector<Vec3> vecs(BATCH_COUNT), decoded(BATCH_COUNT);
+        std::vector<ETL::Math::PackedVector3Half> packed(BATCH_COUNT);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            vecs[i] = MakeVector<TestType>(int(i), i % 2 ? 100.0 : 0.001);
+
+        ETL::Math::Encode(std::span<ETL::Math::PackedVector3Half>{ packed }, std::span<const Vec3>{ vecs });
+        ETL::Math::Decode(std::span<Vec3>{ decoded }, std::span<const ETL::Math::PackedVector3Half>{ packed });
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            ETL::Math::PackedVector3Half single;
+            Vec3 singleDecoded;
+            ETL::Math::Encode(single, vecs[i]);
+            ETL::Math::Decode(singleDecoded, single);
+            REQUIRE(SameBits(packed[i], single));
+            REQUIRE(decoded[i] == singleDecoded);
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("PackedTypes Octahedral Unit Vector", "[PackedTypes][oct]", PACKED_TYPES)
+{
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    SECTION("Axes round trip")
+    {
+        const Vec3 axes[6]{ Vec3{ 1.0, 0.0, 0.0 }, Vec3{ -1.0, 0.0, 0.0 }, Vec3{ 0.0, 1.0, 0.0 },
+                            Vec3{ 0.0, -1.0, 0.0 }, Vec3{ 0.0, 0.0, 1.0 }, Vec3{ 0.0, 0.0, -1.0 } };
+        for (const Vec3& axis : axes)
+        {
+            ETL::Math::PackedUnitVectorOct packed;
+            Vec3 decoded;
+            ETL::Math::Encode(packed, axis);
+            ETL::Math::Decode(decoded, packed);
+            REQUIRE(ETL::Math::isEqual(decoded, axis, 0.0001));
+        }
+    }
+
+    SECTION("Angular error bound, any length")
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            const Vec3 vec = MakeVector<TestType>(i, i % 3 ? 1.0 : 20.0);
+            ETL::Math::PackedUnitVectorOct packed;
+            Vec3 decoded;
+            ETL::Math::Encode(packed, vec);
+            ETL::Math::Decode(decoded, packed);
+
+            REQUIRE(ETL::Math::isEqual(decoded.length(), 1.0, 0.0001));
+            REQUIRE(Angle(decoded, vec) < (std::is_same_v<TestType, int> ? 1.0e-4 : 6.5e-5));
+        }
+    }
+
+    SECTION("Batch matches single")
+    {
+        std::vector<Vec3> vecs(BATCH_COUNT), decoded(BATCH_COUNT);
+        std::vector<ETL::Math::PackedUnitVectorOct> packed(BATCH_COUNT);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            vecs[i] = MakeVector<TestType>(int(i), 1.0);
+
+        ETL::Math::Encode(std::span<ETL::Math::PackedUnitVectorOct>{ packed }, std::span<const Vec3>{ vecs });
+        ETL::Math::Decode(std::span<Vec3>{ decoded }, std::span<const ETL::Math::PackedUnitVectorOct>{ packed });
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            ETL::Math::PackedUnitVectorOct single;
+            Vec3 singleDecoded;
+            ETL::Math::Encode(single, vecs[i]);
+            ETL::Math::Decode(singleDecoded, single);
+            REQUIRE(SameBits(packed[i], single));
+            REQUIRE(ETL::Math::isEqual(decoded[i], singleDecoded, 0.0001)); /// Scalar path may contract to FMA
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("PackedTypes Smallest Three Quaternion", "[PackedTypes][quaternion]", PACKED_TYPES)
+{
+    using Quat = ETL::Math::Quaternion<TestType>;
+
+    SECTION("Identity and sign of the dropped component")
+    {
+        ETL::Math::PackedQuatSmallest3 packed;
+        Quat decoded;
+        ETL::Math::Encode(packed, Quat::Identity());
+        ETL::Math::Decode(decoded, packed);
+        REQUIRE(ETL::Math::isEqual(decoded, Quat::Identity(), 0.0001));
+
+        /// Largest component negative: the same rotation comes back negated
+        const Quat negative{ 0.1, -0.2, 0.3, -0.927362 };
+        ETL::Math::Encode(packed, negative);
+        ETL::Math::Decode(decoded, packed);
+        REQUIRE(ETL::Math::isEqual(decoded, Quat{ -0.1, 0.2, -0.3, 0.927362 }, 0.0001));
+    }
+
+    SECTION("Component error bound")
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            const Quat rotation = MakeRotation<TestType>(i);
+            ETL::Math::PackedQuatSmallest3 packed;
+            Quat decoded;
+            ETL::Math::Encode(packed, rotation);
+            ETL::Math::Decode(decoded, packed);
+
+            double dot = 0.0;
+            for (int k = 0; k < 4; ++k)
+                dot += ETL::Math::DecodeValue<double>(rotation.getRawValue(k)) * ETL::Math::DecodeValue<double>(decoded.getRawValue(k));
+            const double sign = dot < 0.0 ? -1.0 : 1.0;
+
+            for (int k = 0; k < 4; ++k)
+            {
+                const double error = ETL::Math::DecodeValue<double>(rotation.getRawValue(k)) - sign * ETL::Math::DecodeValue<double>(decoded.getRawValue(k));
+                REQUIRE(std::fabs(error) < (std::is_same_v<TestType, int> ? 1.0e-4 : 6.0e-5));
+            }
+        }
+    }
+
+    SECTION("Batch matches single")
+    {
+        std::vector<Quat> rotations(BATCH_COUNT), decoded(BATCH_COUNT);
+        std::vector<ETL::Math::PackedQuatSmallest3> packed(BATCH_COUNT);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+            rotations[i] = MakeRotation<TestType>(int(i));
+
+        ETL::Math::Encode(std::span<ETL::Math::PackedQuatSmallest3>{ packed }, std::span<const Quat>{ rotations });
+        ETL::Math::Decode(std::span<Quat>{ decoded }, std::span<const ETL::Math::PackedQuatSmallest3>{ packed });
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            ETL::Math::PackedQuatSmallest3 single;
+            Quat singleDecoded;
+            ETL::Math::Encode(single, rotations[i]);
+            ETL::Math::Decode(singleDecoded, single);
+            REQUIRE(SameBits(packed[i], single));
+            REQUIRE(ETL::Math::isEqual(decoded[i], singleDecoded, 0.0001)); /// Scalar path may contract to FMA
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("PackedTypes Quantized Position", "[PackedTypes][position]", PACKED_TYPES)
+{
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    std::vector<Vec3> positions(BATCH_COUNT);
+    for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        positions[i] = MakeVector<TestType>(int(i), 100.0);
+    const ETL::Math::QuantizationRange<TestType> range = ETL::Math::ComputeQuantizationRange(std::span<const Vec3>{ positions });
+
+    SECTION("Range covers the positions")
+    {
+        for (const Vec3& position : positions)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                REQUIRE(range.min.getRawValue(c) <= position.getRawValue(c));
+                REQUIRE(range.max.getRawValue(c) >= position.getRawValue(c));
+            }
+        }
+    }
+
+    SECTION("Error bound and clamping")
+    {
+        for (const Vec3& position : positions)
+        {
+            ETL::Math::PackedPosition16 packed;
+            Vec3 decoded;
+            ETL::Math::Encode(packed, position, range);
+            ETL::Math::Decode(decoded, packed, range);
+
+            for (int c = 0; c < 3; ++c)
+            {
+                const double bound = (Component(range.max, c) - Component(range.min, c)) / 131070.0;
+                REQUIRE(std::fabs(Component(decoded, c) - Component(position, c)) <= bound + 2.0e-5);
+            }
+        }
+
+        ETL::Math::PackedPosition16 packed;
+        Vec3 decoded;
+        ETL::Math::Encode(packed, Vec3{ 1000.0, -1000.0, 0.0 }, range);
+        ETL::Math::Decode(decoded, packed, range);
+        REQUIRE(packed.x == 65535);
+        REQUIRE(packed.y == 0);
+        REQUIRE(ETL::Math::isEqual(Component(decoded, 0), Component(range.max, 0), 0.001));
+        REQUIRE(ETL::Math::isEqual(Component(decoded, 1), Component(range.min, 1), 0.001));
+    }
+
+    SECTION("Batch matches single")
+    {
+        std::vector<Vec3> decoded(BATCH_COUNT);
+        std::vector<ETL::Math::PackedPosition16> packed(BATCH_COUNT);
+        ETL::Math::Encode(std::span<ETL::Math::PackedPosition16>{ packed }, std::span<const Vec3>{ positions }, range);
+        ETL::Math::Decode(std::span<Vec3>{ decoded }, std::span<const ETL::Math::PackedPosition16>{ packed }, range);
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            ETL::Math::PackedPosition16 single;
+            Vec3 singleDecoded;
+            ETL::Math::Encode(single, positions[i], range);
+            ETL::Math::Decode(singleDecoded, single, range);
+            REQUIRE(SameBits(packed[i], single));
+            REQUIRE(ETL::Math::isEqual(decoded[i], singleDecoded, 0.0001)); /// Scalar path may contract to FMA
+        }
+    }
+}
+
+
+TEMPLATE_TEST_CASE("PackedTypes Transform", "[PackedTypes][transform]", PACKED_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    const ETL::Math::QuantizationRange<TestType> range{ Vec3{ -10.0, -10.0, -10.0 }, Vec3{ 10.0, 10.0, 10.0 } };
+
+    std::vector<Matrix> mats(BATCH_COUNT);
+    for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        mats[i] = Matrix::CreateTranslation(TestType(int(i % 9) - 4), TestType(1), TestType(-2)) * Matrix::CreateRotation(0.1 * double(i), 0.7, -0.05 * double(i))
+                * Matrix::CreateScale(1.0 + 0.05 * double(i), i % 3 == 0 ? -1.0 : 1.0, 0.5);
+
+    SECTION("Round trip within the documented bound")
+    {
+        for (const Matrix& mat : mats)
+        {
+            ETL::Math::PackedTransform packed;
+            Matrix decoded;
+            REQUIRE(ETL::Math::Encode(packed, mat, range));
+            ETL::Math::Decode(decoded, packed, range);
+            REQUIRE(ETL::Math::isEqual(decoded, mat, 0.002));
+        }
+    }
+
+    SECTION("Non-uniform scale keeps every axis")
+    {
+        const double scales[][3] = { { 100.0, 1.0, 0.01 }, { 0.02, 30.0, 2.0 } };
+        for (const auto& scale : scales)
+        {
+            const Matrix mat = Matrix::CreateTranslation(TestType(1), TestType(-2), TestType(3)) * Matrix::CreateRotation(0.4, -0.9, 1.3)
+                             * Matrix::CreateScale(scale[0], scale[1], scale[2]);
+
+            ETL::Math::PackedTransform packed;
+            Matrix decoded;
+            REQUIRE(ETL::Math::Encode(packed, mat, range));
+            ETL::Math::Decode(decoded, packed, range);
+
+            /// Relative to each column's scale: half floats and the quaternion keep ~3 digits
+            for (int col = 0; col < 3; ++col)
+                for (int row = 0; row < 3; ++row)
+                    REQUIRE(std::abs(ETL::Math::DecodeValue<double>(decoded.getRawValue(row, col)) - ETL::Math::DecodeValue<double>(mat.getRawValue(row, col)))
+                            < 0.005 * scale[col]);
+        }
+    }
+
+    SECTION("Singular matrix keeps a best-effort frame")
+    {
+        ETL::Math::PackedTransform packed;
+        Matrix decoded;
+        REQUIRE_FALSE(ETL::Math::Encode(packed, Matrix::CreateScale(0.0, 1.0, 1.0), range));
+        ETL::Math::Decode(decoded, packed, range);
+        REQUIRE(ETL::Math::isEqual(decoded, Matrix::CreateScale(0.0, 1.0, 1.0), 0.001));
+
+        /// Rank 2 without shear reconstructs
+        const Matrix flat = Matrix::CreateRotation(0.3, 1.1, -0.4) * Matrix::CreateScale(2.0, 0.0, 0.5);
+        REQUIRE_FALSE(ETL::Math::Encode(packed, flat, range));
+        ETL::Math::Decode(decoded, packed, range);
+        REQUIRE(ETL::Math::isEqual(decoded, flat, 0.005));
+
+        REQUIRE_FALSE(ETL::Math::Encode(packed, Matrix::CreateScale(0.0, 0.0, 0.0), range));
+        ETL::Math::Decode(decoded, packed, range);
+        REQUIRE(ETL::Math::isEqual(decoded, Matrix::CreateScale(0.0, 0.0, 0.0), 0.001));
+    }
+
+    SECTION("Batch matches single")
+    {
+        mats[5] = Matrix::CreateScale(0.0, 1.0, 1.0);
+
+        std::vector<ETL::Math::PackedTransform> packed(BATCH_COUNT);
+        std::vector<Matrix> decoded(BATCH_COUNT);
+        REQUIRE_FALSE(ETL::Math::Encode(std::span<ETL::Math::PackedTransform>{ packed }, std::span<const Matrix>{ mats }, range));
+        ETL::Math::Decode(std::span<Matrix>{ decoded }, std::span<const ETL::Math::PackedTransform>{ packed }, range);
+
+        for (std::size_t i = 0; i < BATCH_COUNT; ++i)
+        {
+            ETL::Math::PackedTransform single;
+            Matrix singleDecoded;
+            REQUIRE(ETL::Math::Encode(single, mats[i], range) == (i != 5));
+            ETL::Math::Decode(singleDecoded, single, range);
+            REQUIRE(ETL::Math::isEqual(decoded[i], singleDecoded, 0.001));
+        }
+    }
+}
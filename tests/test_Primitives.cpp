@@ -0,0 +1,71 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Primitives.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Geometry/Primitives.h>
+
+#define PRIMITIVES_TYPES int, float, double
+
+TEMPLATE_TEST_CASE("Primitives Construction & Access", "[Primitives]", PRIMITIVES_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Matrix = ETL::Math::Matrix3x3<TestType>;
+
+    SECTION("Sphere")
+    {
+        ETL::Math::Sphere<TestType> sphere{ Vector{ TestType(1), TestType(2), TestType(3) }, 0.5 };
+        REQUIRE(sphere.getCenter() == Vector{ TestType(1), TestType(2), TestType(3) });
+        REQUIRE(sphere.getRadius() == 0.5);
+
+        sphere.setCenter(Vector::UnitY());
+        sphere.setRadius(2.0);
+        REQUIRE(sphere.getCenter() == Vector::UnitY());
+        REQUIRE(sphere.getRadius() == 2.0);
+
+        REQUIRE(sphere == ETL::Math::Sphere<TestType>{ Vector::UnitY(), 2.0 });
+        REQUIRE(sphere != ETL::Math::Sphere<TestType>{ Vector::UnitY(), 1.0 });
+    }
+
+    SECTION("Capsule")
+    {
+        ETL::Math::Capsule<TestType> capsule{ Vector::Zero(), Vector::UnitY(), 0.25 };
+        REQUIRE(capsule.getStart() == Vector::Zero());
+        REQUIRE(capsule.getEnd() == Vector::UnitY());
+        REQUIRE(capsule.getRadius() == 0.25);
+
+        capsule.setStart(Vector::UnitX());
+        capsule.setEnd(Vector::UnitZ());
+        capsule.setRadius(1.5);
+        REQUIRE(capsule.getStart() == Vector::UnitX());
+        REQUIRE(capsule.getEnd() == Vector::UnitZ());
+        REQUIRE(capsule.getRadius() == 1.5);
+
+        REQUIRE(capsule == ETL::Math::Capsule<TestType>{ Vector::UnitX(), Vector::UnitZ(), 1.5 });
+        REQUIRE(capsule != ETL::Math::Capsule<TestType>{ Vector::UnitZ(), Vector::UnitX(), 1.5 });
+    }
+
+    SECTION("Obb")
+    {
+        ETL::Math::Obb<TestType> box;
+        REQUIRE(box.getRotation() == Matrix::Identity());
+
+        /// Quarter turn around z: local x -> world y, local y -> world -x
+        const Matrix rotation{ TestType(0), TestType(-1), TestType(0),
+                               TestType(1), TestType(0),  TestType(0),
+                               TestType(0), TestType(0),  TestType(1) };
+        box.setCenter(Vector{ TestType(1), TestType(2), TestType(3) });
+        box.setRotation(rotation);
+        box.setHalfExtents(Vector{ TestType(1), TestType(2), TestType(3) });
+        REQUIRE(box.getCenter() == Vector{ TestType(1), TestType(2), TestType(3) });
+        REQUIRE(box.getRotation() == rotation);
+        REQUIRE(box.getHalfExtents() == Vector{ TestType(1), TestType(2), TestType(3) });
+        REQUIRE(box.getAxis(0) == Vector::UnitY());
+        REQUIRE(box.getAxis(1) == -Vector::UnitX());
+        REQUIRE(box.getAxis(2) == Vector::UnitZ());
+
+        REQUIRE(box == ETL::Math::Obb<TestType>{ Vector{ TestType(1), TestType(2), TestType(3) }, rotation, Vector{ TestType(1), TestType(2), TestType(3) } });
+        REQUIRE(box != ETL::Math::Obb<TestType>{ Vector{ TestType(1), TestType(2), TestType(3) }, Matrix::Identity(), Vector{ TestType(1), TestType(2), TestType(3) } });
+    }
+}
@@ -0,0 +1,140 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Quaternion.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Types/Quaternion.h>
+
+#define QUATERNION_TYPES int, float, double
+
+TEMPLATE_TEST_CASE("Quaternion Construction & Access", "[Quaternion][core]", QUATERNION_TYPES)
+{
+    using Quat = ETL::Math::Quaternion<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    SECTION("Identity")
+    {
+        const Quat q = Quat::Identity();
+        REQUIRE(q.x() == TestType(0));
+        REQUIRE(q.y() == TestType(0));
+        REQUIRE(q.z() == TestType(0));
+        REQUIRE(q.w() == TestType(1));
+    }
+
+    SECTION("Explicit and vector constructors")
+    {
+        const Quat a{ TestType(1), TestType(2), TestType(3), TestType(4) };
+        const Quat b{ Vec3{ TestType(1), TestType(2), TestType(3) }, TestType(4) };
+        REQUIRE(a == b);
+        REQUIRE(a[0] == TestType(1));
+        REQUIRE(a[3] == TestType(4));
+        REQUIRE(a.getVector() == Vec3{ TestType(1), TestType(2), TestType(3) });
+    }
+
+    SECTION("Accessors and Mutators")
+    {
+        Quat q;
+        q.x(TestType(5));
+        q.y(TestType(6));
+        q.z(TestType(7));
+        q.w(TestType(8));
+        q[0] = TestType(1);
+        REQUIRE(q == Quat{ TestType(1), TestType(6), TestType(7), TestType(8) });
+    }
+
+    SECTION("Length, normalize and conjugate")
+    {
+        const Quat q{ TestType(0), TestType(3), TestType(0), TestType(4) };
+        REQUIRE(ETL::Math::isEqual(q.length(), 5.0));
+        REQUIRE(ETL::Math::isEqual(q.normalize(), Quat{ 0.0, 0.6, 0.0, 0.8 }, 0.001));
+        REQUIRE(q.conjugate() == Quat{ TestType(0), TestType(-3), TestType(0), TestType(4) });
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Quaternion Rotations", "[Quaternion][rotation]", QUATERNION_TYPES)
+{
+    using Quat = ETL::Math::Quaternion<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+
+    constexpr double eps = 0.001;
+    const double halfPi = ETL::Math::PI / 2.0;
+
+    SECTION("Axis angle rotates vectors")
+    {
+        const Quat q = Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 0.0, 0.0, 2.0 }, halfPi);
+        REQUIRE(ETL::Math::isEqual(q * Vec3::UnitX(), Vec3::UnitY(), eps));
+        REQUIRE(ETL::Math::isEqual(q.rotate(Vec3::UnitY()), Vec3::Left(), eps));
+        REQUIRE(ETL::Math::isEqual(q.rotate(Vec3::UnitZ()), Vec3::UnitZ(), eps));
+    }
+
+    SECTION("Composition applies the right operand first")
+    {
+        const Quat qZ = Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 0.0, 0.0, 1.0 }, halfPi);
+        const Quat qX = Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 1.0, 0.0, 0.0 }, halfPi);
+
+        /// X -> (Z rotation) Y -> (X rotation) Z
+        REQUIRE(ETL::Math::isEqual((qX * qZ).rotate(Vec3::UnitX()), Vec3::UnitZ(), eps));
+        REQUIRE(ETL::Math::isEqual(qX.rotate(qZ.rotate(Vec3::UnitX())), Vec3::UnitZ(), eps));
+    }
+
+    SECTION("Inverse undoes rotation")
+    {
+        const Quat q = Quat::CreateFromEuler(0.3, -0.7, 1.1);
+        const Vec3 v{ TestType(1), TestType(2), TestType(3) };
+        REQUIRE(ETL::Math::isEqual(q.inverse().rotate(q.rotate(v)), v, eps));
+        REQUIRE(ETL::Math::isEqual(q * q.inverse(), Quat::Identity(), eps));
+    }
+
+    SECTION("Euler matches Matrix4x4::CreateRotation")
+    {
+        const Quat q = Quat::CreateFromEuler(0.3, -0.7, 1.1);
+        const Matrix m = Matrix::CreateRotation(0.3, -0.7, 1.1);
+        REQUIRE(ETL::Math::isEqual(q.toMatrix(), m, eps));
+
+        const Vec3 v{ TestType(1), TestType(-2), TestType(3) };
+        REQUIRE(ETL::Math::isEqual(q.rotate(v), m.transformDirection(v), eps));
+    }
+
+    SECTION("Matrix round trip (all Shepperd branches)")
+    {
+        const Quat rotations[4] = {
+            Quat::CreateFromEuler(0.1, 0.2, 0.3),
+            Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 1.0, 0.0, 0.0 }, 3.0),
+            Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 0.0, 1.0, 0.0 }, 3.0),
+            Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 0.0, 0.0, 1.0 }, 3.0),
+        };
+
+        for (const Quat& q : rotations)
+        {
+            Quat back = Quat::CreateFromMatrix(q.toMatrix());
+            if (back.dot(q) < 0.0)
+                back = -back;
+            REQUIRE(ETL::Math::isEqual(back, q, eps));
+        }
+    }
+
+    SECTION("Slerp and Nlerp")
+    {
+        const Quat a = Quat::Identity();
+        const Quat b = Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 0.0, 1.0, 0.0 }, halfPi);
+        const Quat half = Quat::CreateFromAxisAngle(ETL::Math::Vector3<double>{ 0.0, 1.0, 0.0 }, halfPi / 2.0);
+
+        Quat result;
+        ETL::Math::Slerp(result, a, b, 0.0);
+        REQUIRE(ETL::Math::isEqual(result, a, eps));
+        ETL::Math::Slerp(result, a, b, 1.0);
+        REQUIRE(ETL::Math::isEqual(result, b, eps));
+        ETL::Math::Slerp(result, a, b, 0.5);
+        REQUIRE(ETL::Math::isEqual(result, half, eps));
+
+        /// Shortest path: -b is the same rotation
+        ETL::Math::Slerp(result, a, -b, 0.5);
+        REQUIRE(ETL::Math::isEqual(result, half, eps));
+
+        ETL::Math::Nlerp(result, a, b, 0.5);
+        REQUIRE(ETL::Math::isEqual(result, half, eps));
+    }
+}
@@ -0,0 +1,113 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Ray.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Geometry/Ray.h>
+
+#define RAY_TYPES int, float, double
+
+TEMPLATE_TEST_CASE("Ray Construction & Access", "[Ray][core]", RAY_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Ray = ETL::Math::Ray<TestType>;
+
+    SECTION("Default constructor")
+    {
+        Ray ray;
+        REQUIRE(ray.getOrigin() == Vector::Zero());
+        REQUIRE(ray.getDirection() == Vector::Zero());
+    }
+
+    SECTION("Origin/direction constructor")
+    {
+        Ray ray{ Vector{ TestType(1), TestType(2), TestType(3) }, Vector::UnitX() };
+        REQUIRE(ray.getOrigin() == Vector{ TestType(1), TestType(2), TestType(3) });
+        REQUIRE(ray.getDirection() == Vector::UnitX());
+    }
+
+    SECTION("Accessors and Mutators")
+    {
+        Ray ray;
+        ray.setOrigin(Vector{ TestType(4), TestType(5), TestType(6) });
+        ray.setDirection(Vector::UnitZ());
+        REQUIRE(ray.getOrigin() == Vector{ TestType(4), TestType(5), TestType(6) });
+        REQUIRE(ray.getDirection() == Vector::UnitZ());
+    }
+
+    SECTION("Equality and inequality operators")
+    {
+        Ray rA{ Vector::One(), Vector::UnitY() };
+        Ray rB{ Vector::One(), Vector::UnitY() };
+        Ray rC{ Vector::One(), Vector::UnitX() };
+        REQUIRE(rA == rB);
+        REQUIRE(rA != rC);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Ray Point Evaluation", "[Ray][point]", RAY_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Ray = ETL::Math::Ray<TestType>;
+
+    Ray ray{ Vector{ TestType(1), TestType(2), TestType(3) }, Vector{ TestType(0), TestType(2), TestType(0) } };
+
+    SECTION("Origin at t = 0")
+    {
+        REQUIRE(ETL::Math::isEqual(ray.getPoint(0.0), ray.getOrigin()));
+    }
+
+    SECTION("Point at t")
+    {
+        REQUIRE(ETL::Math::isEqual(ray.getPoint(2.5), Vector{ TestType(1), TestType(7), TestType(3) }));
+    }
+
+    SECTION("Free function and To variant")
+    {
+        Vector p1, p2;
+        ETL::Math::GetPoint(p1, ray, 1.0);
+        ray.getPointTo(p2, 1.0);
+        REQUIRE(ETL::Math::isEqual(p1, Vector{ TestType(1), TestType(4), TestType(3) }));
+        REQUIRE(p1 == p2);
+    }
+}
+
+
+TEST_CASE("RayPacket Lane Access", "[Ray][packet]")
+{
+    using Vector = ETL::Math::Vector3<float>;
+
+    ETL::Math::RayPacket4 packet{};
+    const ETL::Math::Ray3 ray{ Vector{ 1.0f, 2.0f, 3.0f }, Vector{ 0.0f, -2.0f, 4.0f } };
+    packet.setRay(2, ray, 10.0);
+
+    SECTION("SoA storage")
+    {
+        REQUIRE(packet.originX[2] == 1.0f);
+        REQUIRE(packet.originY[2] == 2.0f);
+        REQUIRE(packet.originZ[2] == 3.0f);
+        REQUIRE(packet.dirY[2] == -2.0f);
+        REQUIRE(packet.tMax[2] == 10.0f);
+        REQUIRE(packet.invDirY[2] == -0.5f);
+        REQUIRE(packet.invDirZ[2] == 0.25f);
+        REQUIRE(std::isfinite(packet.invDirX[2]));
+    }
+
+    SECTION("Round trip")
+    {
+        ETL::Math::Ray3 back;
+        packet.getRay(2, back);
+        REQUIRE(back == ray);
+    }
+
+    SECTION("Fixed point source ray")
+    {
+        const ETL::Math::Ray3i rayi{ ETL::Math::Vec3i{ 1.5, 0.0, -2.0 }, ETL::Math::Vec3i::UnitX() };
+        packet.setRay(0, rayi);
+        REQUIRE(packet.originX[0] == 1.5f);
+        REQUIRE(packet.originZ[0] == -2.0f);
+        REQUIRE(packet.dirX[0] == 1.0f);
+    }
+}
@@ -0,0 +1,189 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_Skinning.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/TypeComparisons.h>
+#include <MathLib/Animation/Skinning.h>
+#include <vector>
+
+#define SKINNING_TYPES int, float, double
+
+TEMPLATE_TEST_CASE("Skinning Linear Blend", "[Skinning][lbs]", SKINNING_TYPES)
+{
+    using Matrix = ETL::Math::Matrix4x4<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using ETL::Math::BoneWeights;
+
+    constexpr double eps = 0.001;
+
+    const Matrix palette[3] = {
+        Matrix::Identity(),
+        Matrix::CreateTranslation(TestType(2), TestType(0), TestType(0)),
+        Matrix::CreateTranslation(TestType(0), TestType(1), TestType(0)) * Matrix::CreateRotation(0.0, 0.0, ETL::Math::PI / 2.0),
+    };
+
+    SECTION("Single influence matches transformPoint")
+    {
+        const Vec3 positions[3] = { Vec3{ TestType(1), TestType(2), TestType(3) }, Vec3::UnitX(), Vec3{ TestType(-1), TestType(0), TestType(2) } };
+        const BoneWeights weights[3] = { { { 0, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } },
+                                         { { 1, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } },
+                                         { { 2, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } } };
+        Vec3 skinned[3];
+
+        ETL::Math::SkinVertices(std::span<Vec3>{ skinned }, std::span<const Matrix>{ palette },
+                                std::span<const Vec3>{ positions }, std::span<const BoneWeights>{ weights });
+
+        for (int i = 0; i < 3; ++i)
+            REQUIRE(ETL::Math::isEqual(skinned[i], palette[weights[i].indices[0]].transformPoint(positions[i]), eps));
+    }
+
+    SECTION("Blended influences match the weighted sum of transformed points")
+    {
+        const Vec3 positions[1] = { Vec3{ TestType(1), TestType(1), TestType(0) } };
+        const BoneWeights weights[1] = { { { 0, 1, 2, 0 }, { 0.25f, 0.25f, 0.5f, 0.0f } } };
+        Vec3 skinned[1];
+
+        ETL::Math::SkinVertices(std::span<Vec3>{ skinned }, std::span<const Matrix>{ palette },
+                                std::span<const Vec3>{ positions }, std::span<const BoneWeights>{ weights });
+
+        /// Identity: (1,1,0), translate x: (3,1,0), rotate 90 + translate y: (-1,2,0)
+        /// 0.25 * (1,1,0) + 0.25 * (3,1,0) + 0.5 * (-1,2,0) = (0.5, 1.5, 0)
+        REQUIRE(ETL::Math::isEqual(skinned[0], Vec3{ 0.5, 1.5, 0.0 }, eps));
+    }
+
+    SECTION("Normal and tangent streams")
+    {
+        const Vec3 positions[2] = { Vec3::Zero(), Vec3::One() };
+        const Vec3 normals[2] = { Vec3::UnitX(), Vec3::UnitY() };
+        const Vec3 tangents[2] = { Vec3::UnitY(), Vec3::UnitZ() };
+        const BoneWeights weights[2] = { { { 2, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } },
+                                         { { 1, 2, 0, 0 }, { 0.5f, 0.5f, 0.0f, 0.0f } } };
+        Vec3 outPositions[2], outNormals[2], outTangents[2];
+
+        ETL::Math::SkinningInput<TestType> in{ positions, weights, normals, tangents };
+        ETL::Math::SkinningOutput<TestType> out{ outPositions, outNormals, outTangents };
+        ETL::Math::SkinVertices(out, std::span<const Matrix>{ palette }, in);
+
+        /// Rotation of 90 degrees around Z: X -> Y, Y -> -X
+        REQUIRE(ETL::Math::isEqual(outNormals[0], Vec3::UnitY(), eps));
+        REQUIRE(ETL::Math::isEqual(outTangents[0], Vec3::Left(), eps));
+
+        /// Half identity-rotation, half 90 degrees: blended direction is re-normalized
+        const double invSqrt2 = 1.0 / std::sqrt(2.0);
+        REQUIRE(ETL::Math::isEqual(outNormals[1], Vec3{ -invSqrt2, invSqrt2, 0.0 }, eps));
+        REQUIRE(ETL::Math::isEqual(outTangents[1], Vec3::UnitZ(), eps));
+    }
+
+    SECTION("Parallel matches serial")
+    {
+        constexpr std::size_t COUNT = 5000;
+        std::vector<Vec3> positions(COUNT), normals(COUNT);
+        std::vector<BoneWeights> weights(COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            positions[i] = Vec3{ double(i % 17) * 0.25, double(i % 5), -double(i % 11) * 0.5 };
+            normals[i] = Vec3::UnitZ();
+            weights[i] = BoneWeights{ { std::uint16_t(i % 3), std::uint16_t((i + 1) % 3), 0, 0 }, { 0.75f, 0.25f, 0.0f, 0.0f } };
+        }
+
+        std::vector<Vec3> serialPositions(COUNT), serialNormals(COUNT), parallelPositions(COUNT), parallelNormals(COUNT);
+        const ETL::Math::SkinningInput<TestType> in{ positions, weights, normals };
+
+        ETL::Math::SkinVertices(ETL::Math::SkinningOutput<TestType>{ serialPositions, serialNormals }, std::span<const Matrix>{ palette }, in);
+        ETL::Math::SkinVerticesParallel(ETL::Math::SkinningOutput<TestType>{ parallelPositions, parallelNormals }, std::span<const Matrix>{ palette }, in, 4);
+
+        REQUIRE(serialPositions == parallelPositions);
+        REQUIRE(serialNormals == parallelNormals);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Skinning Dual Quaternion", "[Skinning][dqs]", SKINNING_TYPES)
+{
+    using DualQuat = ETL::Math::DualQuaternion<TestType>;
+    using Quat = ETL::Math::Quaternion<TestType>;
+    using Vec3 = ETL::Math::Vector3<TestType>;
+    using ETL::Math::BoneWeights;
+
+    constexpr double eps = 0.001;
+    const ETL::Math::Vector3<double> axisZ{ 0.0, 0.0, 1.0 };
+
+    const DualQuat palette[3] = {
+        DualQuat::Identity(),
+        DualQuat::CreateTranslation(Vec3{ TestType(2), TestType(0), TestType(0) }),
+        DualQuat::CreateFromRotationTranslation(Quat::CreateFromAxisAngle(axisZ, ETL::Math::PI / 2.0), Vec3{ TestType(0), TestType(1), TestType(0) }),
+    };
+
+    SECTION("Single influence matches transformPoint")
+    {
+        const Vec3 positions[3] = { Vec3{ TestType(1), TestType(2), TestType(3) }, Vec3::UnitX(), Vec3{ TestType(-1), TestType(0), TestType(2) } };
+        const BoneWeights weights[3] = { { { 0, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } },
+                                         { { 1, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } },
+                                         { { 2, 0, 0, 0 }, { 1.0f, 0.0f, 0.0f, 0.0f } } };
+        Vec3 skinned[3];
+
+        ETL::Math::SkinVertices(std::span<Vec3>{ skinned }, std::span<const DualQuat>{ palette },
+                                std::span<const Vec3>{ positions }, std::span<const BoneWeights>{ weights });
+
+        for (int i = 0; i < 3; ++i)
+            REQUIRE(ETL::Math::isEqual(skinned[i], palette[weights[i].indices[0]].transformPoint(positions[i]), eps));
+    }
+
+    SECTION("Blended rotations keep volume")
+    {
+        const DualQuat twist[2] = {
+            DualQuat::Identity(),
+            DualQuat::CreateFromRotationTranslation(Quat::CreateFromAxisAngle(axisZ, ETL::Math::PI / 2.0), Vec3::Zero()),
+        };
+        const Vec3 positions[1] = { Vec3::UnitX() };
+        const Vec3 normals[1] = { Vec3::UnitY() };
+        const BoneWeights weights[1] = { { { 0, 1, 0, 0 }, { 0.5f, 0.5f, 0.0f, 0.0f } } };
+        Vec3 outPositions[1], outNormals[1];
+
+        ETL::Math::SkinVertices(ETL::Math::SkinningOutput<TestType>{ outPositions, outNormals }, std::span<const DualQuat>{ twist },
+                                ETL::Math::SkinningInput<TestType>{ positions, weights, normals });
+
+        /// Halfway rotation (45 degrees) at unit distance: linear blending would give (0.5, 0.5, 0)
+        const double invSqrt2 = 1.0 / std::sqrt(2.0);
+        REQUIRE(ETL::Math::isEqual(outPositions[0], Vec3{ invSqrt2, invSqrt2, 0.0 }, eps));
+        REQUIRE(ETL::Math::isEqual(outNormals[0], Vec3{ -invSqrt2, invSqrt2, 0.0 }, eps));
+    }
+
+    SECTION("Antipodal bones blend along the shortest path")
+    {
+        const DualQuat flipped[3] = { palette[0], palette[1], DualQuat{ -palette[2].getReal(), -palette[2].getDual() } };
+        const Vec3 positions[1] = { Vec3{ TestType(1), TestType(1), TestType(0) } };
+        const BoneWeights weights[1] = { { { 0, 1, 2, 0 }, { 0.25f, 0.25f, 0.5f, 0.0f } } };
+        Vec3 expected[1], skinned[1];
+
+        ETL::Math::SkinVertices(std::span<Vec3>{ expected }, std::span<const DualQuat>{ palette },
+                                std::span<const Vec3>{ positions }, std::span<const BoneWeights>{ weights });
+        ETL::Math::SkinVertices(std::span<Vec3>{ skinned }, std::span<const DualQuat>{ flipped },
+                                std::span<const Vec3>{ positions }, std::span<const BoneWeights>{ weights });
+
+        REQUIRE(ETL::Math::isEqual(skinned[0], expected[0], eps));
+    }
+
+    SECTION("Parallel matches serial")
+    {
+        constexpr std::size_t COUNT = 5000;
+        std::vector<Vec3> positions(COUNT), normals(COUNT);
+        std::vector<BoneWeights> weights(COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            positions[i] = Vec3{ double(i % 17) * 0.25, double(i % 5), -double(i % 11) * 0.5 };
+            normals[i] = Vec3::UnitZ();
+            weights[i] = BoneWeights{ { std::uint16_t(i % 3), std::uint16_t((i + 1) % 3), 0, 0 }, { 0.75f, 0.25f, 0.0f, 0.0f } };
+        }
+
+        std::vector<Vec3> serialPositions(COUNT), serialNormals(COUNT), parallelPositions(COUNT), parallelNormals(COUNT);
+        const ETL::Math::SkinningInput<TestType> in{ positions, weights, normals };
+
+        ETL::Math::SkinVertices(ETL::Math::SkinningOutput<TestType>{ serialPositions, serialNormals }, std::span<const DualQuat>{ palette }, in);
+        ETL::Math::SkinVerticesParallel(ETL::Math::SkinningOutput<TestType>{ parallelPositions, parallelNormals }, std::span<const DualQuat>{ palette }, in, 4);
+
+        REQUIRE(serialPositions == parallelPositions);
+        REQUIRE(serialNormals == parallelNormals);
+    }
+}
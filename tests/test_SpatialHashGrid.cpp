@@ -0,0 +1,296 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_SpatialHashGrid.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Common/FixedPointHelpers.h>
+#include <MathLib/Geometry/SpatialHashGrid.h>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#define SPATIAL_HASH_GRID_TYPES int, float, double
+
+namespace
+{
+    /// Deterministic points in [-extent, extent]^3 (LCG, no platform dependent distribution)
+    template<typename Type>
+    std::vector<ETL::Math::Vector3<Type>> MakePoints(int count, double extent, std::uint32_t seed = 12345u)
+    {
+        auto next = [&seed]()
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return (seed >> 8) / double(1 << 24);
+        };
+
+        std::vector<ETL::Math::Vector3<Type>> points;
+        for (int i = 0; i < count; ++i)
+        {
+            const double x = (2.0 * next() - 1.0) * extent;
+            const double y = (2.0 * next() - 1.0) * extent;
+            const double z = (2.0 * next() - 1.0) * extent;
+            points.emplace_back(x, y, z);
+        }
+        return points;
+    }
+
+    template<typename Type>
+    double DistanceSquared(const ETL::Math::Vector3<Type>& a, const ETL::Math::Vector3<Type>& b)
+    {
+        double result = 0.0;
+        for (int i = 0; i < 3; ++i)
+        {
+            const double d = ETL::Math::DecodeValue<double>(a.getRawValue(i)) - ETL::Math::DecodeValue<double>(b.getRawValue(i));
+            result += d * d;
+        }
+        return result;
+    }
+
+    /// Brute force radius query, sorted indices
+    template<typename Type>
+    std::vector<std::uint32_t> RadiusReference(const std::vector<ETL::Math::Vector3<Type>>& points, const ETL::Math::Vector3<Type>& center, double radius)
+    {
+        std::vector<std::uint32_t> result;
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            if (DistanceSquared(points[i], center) <= radius * radius)
+                result.push_back(static_cast<std::uint32_t>(i));
+        }
+        return result;
+    }
+
+    /// Brute force k nearest, by (distance, index)
+    template<typename Type>
+    std::vector<std::uint32_t> NearestReference(const std::vector<ETL::Math::Vector3<Type>>& points, const ETL::Math::Vector3<Type>& center,
+                                                std::size_t k, double maxRadius)
+    {
+        std::vector<std::pair<double, std::uint32_t>> candidates;
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const double distance = DistanceSquared(points[i], center);
+            if (distance <= maxRadius * maxRadius)
+                candidates.emplace_back(distance, static_cast<std::uint32_t>(i));
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        std::vector<std::uint32_t> result;
+        for (std::size_t i = 0; i < std::min(k, candidates.size()); ++i)
+            result.push_back(candidates[i].second);
+        return result;
+    }
+
+    template<typename Type>
+    std::vector<std::uint32_t> QueryRadiusSorted(const ETL::Math::SpatialHashGrid<Type>& grid, const ETL::Math::Vector3<Type>& center, double radius)
+    {
+        std::vector<std::uint32_t> buffer(grid.size() + 1);
+        const std::span<std::uint32_t> found = grid.queryRadius(buffer, center, radius);
+        std::vector<std::uint32_t> result(found.begin(), found.end());
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}
+
+
+TEMPLATE_TEST_CASE("SpatialHashGrid Build", "[SpatialHashGrid]", SPATIAL_HASH_GRID_TYPES)
+{
+    using Grid = ETL::Math::SpatialHashGrid<TestType>;
+
+    const auto points = MakePoints<TestType>(2000, 20.0);
+    Grid grid(2.0);
+    grid.build(points, 1);
+
+    REQUIRE(grid.size() == points.size());
+    REQUIRE(grid.getTableSize() == 4096);
+
+    SECTION("Every point is in the bucket of its position, in increasing order")
+    {
+        std::vector<std::uint32_t> sorted(grid.getSortedIndices().begin(), grid.getSortedIndices().end());
+        std::sort(sorted.begin(), sorted.end());
+        for (std::size_t i = 0; i < sorted.size(); ++i)
+            REQUIRE(sorted[i] == i);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const std::span<const std::uint32_t> bucket = grid.getBucket(points[i]);
+            REQUIRE(std::is_sorted(bucket.begin(), bucket.end()));
+            REQUIRE(std::find(bucket.begin(), bucket.end(), std::uint32_t(i)) != bucket.end());
+        }
+    }
+
+    SECTION("Multi-threaded build gives the same grid")
+    {
+        const auto many = MakePoints<TestType>(40000, 30.0);
+        Grid serial(1.5), threaded(1.5);
+        serial.build(many, 1);
+        threaded.build(many, 4);
+
+        REQUIRE(std::ranges::equal(serial.getSortedIndices(), threaded.getSortedIndices()));
+        REQUIRE(QueryRadiusSorted(serial, many[7], 2.0) == QueryRadiusSorted(threaded, many[7], 2.0));
+    }
+
+    SECTION("setCellSize empties the grid")
+    {
+        grid.setCellSize(3.0);
+        REQUIRE(grid.getCellSize() == 3.0);
+        REQUIRE(grid.empty());
+        REQUIRE(grid.getBucket(points[0]).empty());
+    }
+}
+
+
+TEMPLATE_TEST_CASE("SpatialHashGrid Radius Query", "[SpatialHashGrid]", SPATIAL_HASH_GRID_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+
+    const auto points = MakePoints<TestType>(2000, 20.0);
+    ETL::Math::SpatialHashGrid<TestType> grid(2.0);
+    grid.build(points);
+
+    SECTION("Matches brute force")
+    {
+        /// Within one cell, a few cells (visited bucket by bucket), many cells (cell checked), more cells than points (linear scan)
+        for (const double radius : { 0.0, 0.7, 2.0, 3.5, 9.0, 100.0 })
+        {
+            for (const Vector& center : { points[0], points[1234], Vector{ 0.0, 0.0, 0.0 }, Vector{ -19.5, 18.25, 0.75 } })
+                REQUIRE(QueryRadiusSorted(grid, center, radius) == RadiusReference(points, center, radius));
+        }
+    }
+
+    SECTION("Far from every point")
+    {
+        REQUIRE(QueryRadiusSorted(grid, Vector{ 1000.0, -1000.0, 500.0 }, 5.0).empty());
+    }
+
+    SECTION("Stops when the output is full")
+    {
+        std::uint32_t buffer[5];
+        const std::span<std::uint32_t> found = grid.queryRadius(buffer, Vector{ 0.0, 0.0, 0.0 }, 10.0);
+        REQUIRE(found.size() == 5);
+        for (const std::uint32_t index : found)
+            REQUIRE(DistanceSquared(points[index], Vector{ 0.0, 0.0, 0.0 }) <= 100.0);
+    }
+
+    SECTION("Empty grid and negative radius")
+    {
+        std::uint32_t buffer[5];
+        REQUIRE(grid.queryRadius(buffer, points[0], -1.0).empty());
+        REQUIRE(ETL::Math::SpatialHashGrid<TestType>(1.0).queryRadius(buffer, points[0], 1.0).empty());
+    }
+}
+
+
+TEMPLATE_TEST_CASE("SpatialHashGrid Nearest Query", "[SpatialHashGrid]", SPATIAL_HASH_GRID_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Calc = ETL::Math::CalcType<TestType>;
+
+    const auto points = MakePoints<TestType>(2000, 20.0);
+    ETL::Math::SpatialHashGrid<TestType> grid(2.0);
+    grid.build(points);
+
+    SECTION("Matches brute force, closest first")
+    {
+        for (const std::size_t k : { std::size_t(1), std::size_t(8), std::size_t(40) })
+        {
+            for (const double maxRadius : { 1.5, 6.0, 1.0e9 })
+            {
+                for (const Vector& center : { points[3], Vector{ 0.5, -0.5, 0.25 }, Vector{ 30.0, 30.0, 30.0 } })
+                {
+                    std::vector<std::uint32_t> indices(k);
+                    std::vector<Calc> distances(k);
+                    const std::span<std::uint32_t> found = grid.queryNearest(indices, distances, center, maxRadius);
+
+                    REQUIRE(std::vector<std::uint32_t>(found.begin(), found.end()) == NearestReference(points, center, k, maxRadius));
+                    for (std::size_t i = 0; i < found.size(); ++i)
+                        REQUIRE(distances[i] == Catch::Approx(DistanceSquared(points[found[i]], center)).epsilon(1e-4));
+                }
+            }
+        }
+    }
+
+    SECTION("More neighbors asked than points")
+    {
+        const auto few = MakePoints<TestType>(10, 3.0);
+        ETL::Math::SpatialHashGrid<TestType> small(1.0);
+        small.build(few);
+
+        std::uint32_t buffer[16];
+        const std::span<std::uint32_t> found = small.queryNearest(buffer, Vector{ 0.0, 0.0, 0.0 }, 1.0e9);
+        REQUIRE(std::vector<std::uint32_t>(found.begin(), found.end()) == NearestReference(few, Vector{ 0.0, 0.0, 0.0 }, 16, 1.0e9));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("SpatialHashGrid Update", "[SpatialHashGrid]", SPATIAL_HASH_GRID_TYPES)
+{
+    using Vector = ETL::Math::Vector3<TestType>;
+    using Grid = ETL::Math::SpatialHashGrid<TestType>;
+
+    auto points = MakePoints<TestType>(3000, 20.0);
+    Grid grid(2.0);
+    grid.build(points);
+
+    SECTION("Few changed points: incremental, same grid as a rebuild")
+    {
+        /// Every round: small steps (mostly the same bucket) and a few long jumps, in both directions
+        const auto steps = MakePoints<TestType>(3000, 0.6, 777u);
+        for (int round = 0; round < 6; ++round)
+        {
+            std::vector<std::uint32_t> changed;
+            for (std::uint32_t i = round; i < points.size(); i += 23)
+            {
+                points[i] = (i % 5 == 0) ? Vector{ 0.0, 0.0, 0.0 } - points[i] : points[i] + steps[i];
+                changed.push_back(i);
+            }
+
+            REQUIRE(grid.update(points, changed));
+
+            Grid rebuilt(2.0);
+            rebuilt.build(points);
+            REQUIRE(std::ranges::equal(grid.getSortedIndices(), rebuilt.getSortedIndices()));
+            for (const Vector& center : { points[round], points[1500], Vector{ 0.0, 0.0, 0.0 } })
+                REQUIRE(QueryRadiusSorted(grid, center, 2.5) == RadiusReference(points, center, 2.5));
+        }
+    }
+
+    SECTION("Indices listed more than once")
+    {
+        std::vector<std::uint32_t> changed;
+        for (std::uint32_t i = 0; i < points.size(); i += 37)
+        {
+            points[i] = Vector{ 0.0, 0.0, 0.0 } - points[i];
+            changed.insert(changed.end(), { i, i });
+        }
+        changed.push_back(0);
+
+        REQUIRE(grid.update(points, changed));
+
+        Grid rebuilt(2.0);
+        rebuilt.build(points);
+        REQUIRE(std::ranges::equal(grid.getSortedIndices(), rebuilt.getSortedIndices()));
+        REQUIRE(QueryRadiusSorted(grid, points[37], 3.0) == RadiusReference(points, points[37], 3.0));
+    }
+
+    SECTION("Nothing changed")
+    {
+        REQUIRE(grid.update(points, {}));
+        REQUIRE(QueryRadiusSorted(grid, points[10], 3.0) == RadiusReference(points, points[10], 3.0));
+    }
+
+    SECTION("Many changed points or a new point count: full rebuild")
+    {
+        std::vector<std::uint32_t> changed;
+        for (std::uint32_t i = 0; i < points.size(); ++i)
+        {
+            points[i] = -points[i];
+            changed.push_back(i);
+        }
+        REQUIRE_FALSE(grid.update(points, changed));
+        REQUIRE(QueryRadiusSorted(grid, points[10], 3.0) == RadiusReference(points, points[10], 3.0));
+
+        points.resize(100);
+        REQUIRE_FALSE(grid.update(points, {}));
+        REQUIRE(grid.size() == 100);
+    }
+}
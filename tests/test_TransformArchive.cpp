@@ -0,0 +1,221 @@
+///----------------------------------------------------------------------------
+/// ETL - MathLib Unit Test
+/// test_TransformArchive.cpp
+///----------------------------------------------------------------------------
+#include <catch_amalgamated.hpp>
+#include <MathLib/Serialization/TransformArchive.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#define ARCHIVE_TYPES int, float, double
+
+namespace
+{
+    constexpr std::size_t COUNT = 37;
+
+    /// Temporary file removed at scope exit
+    struct TempFile
+    {
+        explicit TempFile(const std::string& name) : path(std::filesystem::temp_directory_path() / ("etl_mathlib_" + name + ".bin")) {}
+        ~TempFile() { std::error_code error; std::filesystem::remove(path, error); }
+        std::filesystem::path path;
+    };
+
+    template<typename Type>
+    std::string TypeTag()
+    {
+        return std::to_string(sizeof(Type)) + (std::is_floating_point_v<Type> ? "f" : "i");
+    }
+
+    template<typename Type>
+    std::vector<ETL::Math::Matrix4x4<Type>> MakeMatrices(std::size_t count)
+    {
+        std::vector<ETL::Math::Matrix4x4<Type>> matrices(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            matrices[i] = ETL::Math::Matrix4x4<Type>::CreateRotation(0.1 * i, 0.2 * i, 0.3 * i);
+            matrices[i].setTranslation(Type(i), Type(2 * i), Type(-1));
+        }
+        return matrices;
+    }
+
+    template<typename Type>
+    std::vector<ETL::Math::Vector3<Type>> MakeVectors(std::size_t count)
+    {
+        std::vector<ETL::Math::Vector3<Type>> vectors(count);
+        for (std::size_t i = 0; i < count; ++i)
+            vectors[i] = ETL::Math::Vector3<Type>{ std::sin(0.5 * i), 1.5 * i, -0.25 * i };
+        return vectors;
+    }
+
+    template<typename Element>
+    bool SameBytes(std::span<const Element> a, const std::vector<Element>& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), b.size() * sizeof(Element)) == 0;
+    }
+
+    std::vector<char> ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    void WriteFile(const std::filesystem::path& path, const std::vector<char>& bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("TransformArchive round trip", "[TransformArchive]", ARCHIVE_TYPES)
+{
+    using namespace ETL::Math;
+
+    const auto matrices = MakeMatrices<TestType>(COUNT);
+    const auto vectors = MakeVectors<TestType>(COUNT);
+    const TempFile file("archive_" + TypeTag<TestType>());
+
+    TransformArchiveWriter writer;
+    writer.addMatrices<TestType>("instances", matrices);
+    writer.addVectors<TestType>("pivots", vectors);
+    writer.addMatrices<TestType>("empty", {});
+    REQUIRE(writer.getSectionCount() == 3);
+
+    SECTION("Native byte order is mapped in place")
+    {
+        REQUIRE(writer.write(file.path) == ArchiveStatus::Ok);
+
+        TransformArchive archive;
+        REQUIRE(archive.open(file.path) == ArchiveStatus::Ok);
+        CHECK(archive.isOpen());
+        CHECK(archive.isMapped());
+        REQUIRE(archive.getSectionCount() == 3);
+
+        const ArchiveSection& section = archive.getSection(archive.findSection("pivots"));
+        CHECK(section.name == "pivots");
+        CHECK(section.element == ArchiveElement::Vector3);
+        CHECK(section.count == COUNT);
+        CHECK(section.offset % ARCHIVE_ALIGNMENT == 0);
+
+        const auto loadedMatrices = archive.getMatrices<TestType>("instances");
+        const auto loadedVectors = archive.getVectors<TestType>("pivots");
+        CHECK(SameBytes(loadedMatrices, matrices));
+        CHECK(SameBytes(loadedVectors, vectors));
+        CHECK(reinterpret_cast<std::uintptr_t>(loadedMatrices.data()) % ARCHIVE_ALIGNMENT == 0);
+        CHECK(loadedMatrices[5] == matrices[5]);
+        CHECK(archive.getMatrices<TestType>("empty").empty());
+    }
+
+    SECTION("Other byte order is swapped at open")
+    {
+        const std::endian other = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+        REQUIRE(writer.write(file.path, other) == ArchiveStatus::Ok);
+
+        /// The payload on disk really is swapped
+        const std::vector<char> bytes = ReadFile(file.path);
+        TransformArchive archive;
+        REQUIRE(archive.open(file.path) == ArchiveStatus::Ok);
+        CHECK_FALSE(archive.isMapped());
+        const std::size_t offset = archive.getSection(archive.findSection("instances")).offset;
+        CHECK(std::memcmp(bytes.data() + offset, matrices.data(), sizeof(TestType)) != 0);
+
+        CHECK(SameBytes(archive.getMatrices<TestType>("instances"), matrices));
+        CHECK(SameBytes(archive.getVectors<TestType>("pivots"), vectors));
+    }
+
+    SECTION("Lookups with the wrong name or kind are empty")
+    {
+        REQUIRE(writer.write(file.path) == ArchiveStatus::Ok);
+
+        TransformArchive archive;
+        REQUIRE(archive.open(file.path) == ArchiveStatus::Ok);
+        CHECK(archive.findSection("missing") == -1);
+        CHECK(archive.getMatrices<TestType>("missing").empty());
+        CHECK(archive.getVectors<TestType>("instances").empty());
+        if constexpr (std::is_same_v<TestType, double>)
+            CHECK(archive.getMatrices<float>("instances").empty());
+        else
+            CHECK(archive.getMatrices<double>("instances").empty());
+    }
+
+    SECTION("Moved archives keep their spans")
+    {
+        REQUIRE(writer.write(file.path) == ArchiveStatus::Ok);
+
+        TransformArchive archive;
+        REQUIRE(archive.open(file.path) == ArchiveStatus::Ok);
+        const auto before = archive.getMatrices<TestType>("instances");
+
+        TransformArchive moved(std::move(archive));
+        CHECK_FALSE(archive.isOpen());
+        CHECK(moved.getMatrices<TestType>("instances").data() == before.data());
+        CHECK(SameBytes(before, matrices));
+
+        moved.close();
+        CHECK_FALSE(moved.isOpen());
+        CHECK(moved.getSectionCount() == 0);
+    }
+}
+
+
+TEST_CASE("TransformArchive rejects invalid files", "[TransformArchive]")
+{
+    using namespace ETL::Math;
+
+    const auto matrices = MakeMatrices<float>(COUNT);
+    const TempFile file("archive_invalid");
+
+    TransformArchiveWriter writer;
+    writer.addMatrices<float>("instances", matrices);
+    REQUIRE(writer.write(file.path) == ArchiveStatus::Ok);
+    const std::vector<char> bytes = ReadFile(file.path);
+
+    TransformArchive archive;
+
+    SECTION("Missing file")
+    {
+        CHECK(archive.open(file.path.string() + ".missing") == ArchiveStatus::FileError);
+        CHECK_FALSE(archive.isOpen());
+    }
+
+    SECTION("Bad magic")
+    {
+        std::vector<char> broken = bytes;
+        broken[0] = 'X';
+        WriteFile(file.path, broken);
+        CHECK(archive.open(file.path) == ArchiveStatus::InvalidFormat);
+    }
+
+    SECTION("Newer version")
+    {
+        std::vector<char> broken = bytes;
+        const std::uint16_t version = ARCHIVE_VERSION + 1;
+        std::memcpy(broken.data() + 12, &version, sizeof(version));
+        WriteFile(file.path, broken);
+        CHECK(archive.open(file.path) == ArchiveStatus::UnsupportedVersion);
+    }
+
+    SECTION("Truncated payload")
+    {
+        WriteFile(file.path, std::vector<char>(bytes.begin(), bytes.end() - 4));
+        CHECK(archive.open(file.path) == ArchiveStatus::Corrupted);
+        CHECK_FALSE(archive.isOpen());
+    }
+
+    SECTION("Reopen replaces the previous archive")
+    {
+        REQUIRE(archive.open(file.path) == ArchiveStatus::Ok);
+        std::vector<char> broken = bytes;
+        broken[0] = 'X';
+        const TempFile other("archive_other");
+        WriteFile(other.path, broken);
+        CHECK(archive.open(other.path) == ArchiveStatus::InvalidFormat);
+        CHECK_FALSE(archive.isOpen());
+    }
+}
@@ -375,3 +375,17 @@ TEMPLATE_TEST_CASE("Vector3 2D Transform", "[Vector3][utils]", VECTOR3_TYPES)
         REQUIRE(res.y() == TestType(4));
     }
 }
+
+
+TEMPLATE_TEST_CASE("Vector3 Constant Evaluation", "[Vector3][constexpr]", VECTOR3_TYPES)
+{
+    using Vec3 = ETL::Math::Vector3<TestType>;
+
+    constexpr Vec3 a{ TestType(1), TestType(2), TestType(3) };
+    constexpr Vec3 b = Vec3::UnitX() ^ Vec3::UnitY();
+
+    STATIC_REQUIRE(b == Vec3::UnitZ());
+    STATIC_REQUIRE(ETL::Math::isEqual(a * TestType(2) - a, a));
+    STATIC_REQUIRE(ETL::Math::isEqual(a.dot(Vec3::One()), 6.0));
+    STATIC_REQUIRE(ETL::Math::isEqual(a.lengthSquared(), 14.0));
+}
@@ -0,0 +1,8 @@
+#!/bin/sh
+# --- Execution Script for project_root/tools/scripts/perf_check.py ---
+
+# 1. The directory containing the 'scripts' package goes on PYTHONPATH.
+# 2. Execute the script as a module, passing ALL arguments through.
+PYTHONPATH="$(cd "$(dirname "$0")" && pwd)" exec python3 -m scripts.perf_check "$@"
+
+# --- End of script ---
@@ -0,0 +1,235 @@
+import os
+import sys
+import json
+import math
+import shutil
+import argparse
+import platform
+import subprocess
+from .utils.color_print import print_bright_red, print_bright_green, print_bright_yellow
+
+
+def mann_whitney_greater(current: list, baseline: list) -> float:
+    """
+    One-sided Mann-Whitney U test: p-value of 'current' being stochastically greater (slower)
+    than 'baseline'. Normal approximation with tie and continuity correction, which is
+    accurate enough from ~8 samples per side.
+
+    Args:
+        current: Samples of the run under test.
+        baseline: Samples of the stored baseline.
+
+    Returns:
+        The p-value (small means 'current' is very likely slower).
+    """
+
+    n1, n2 = len(current), len(baseline)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    # Rank the pooled samples, ties get their average rank
+    pooled = sorted([(value, 0) for value in current] + [(value, 1) for value in baseline])
+    ranks = [0.0] * len(pooled)
+    tie_term = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        tied = j - i + 1
+        tie_term += tied ** 3 - tied
+        i = j + 1
+
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, pooled) if group == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+
+    n = n1 + n2
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0.0:
+        return 1.0
+
+    z = (u - mean - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def median(values: list) -> float:
+    ordered = sorted(values)
+    mid = len(ordered) // 2
+    return ordered[mid] if len(ordered) % 2 else 0.5 * (ordered[mid - 1] + ordered[mid])
+
+
+def find_harness(project_root: str) -> str:
+    """Looks for MathLib_PerfHarness in the usual output folders (lib/, lib/Release/)."""
+    executable = "MathLib_PerfHarness.exe" if platform.system() == "Windows" else "MathLib_PerfHarness"
+    for folder in [os.path.join(project_root, "lib"), os.path.join(project_root, "lib", "Release")]:
+        candidate = os.path.join(folder, executable)
+        if os.path.exists(candidate):
+            return candidate
+    return ""
+
+
+def run_harness(harness: str, output_json: str, repetitions: int, filter_text: str) -> dict:
+    command = [harness, "--json", output_json, "--repetitions", str(repetitions), "--no-counters"]
+    if filter_text:
+        command += ["--filter", filter_text]
+
+    result = subprocess.run(command)
+    if result.returncode != 0:
+        raise RuntimeError(f"{os.path.basename(harness)} exited with code {result.returncode}")
+
+    with open(output_json, "r") as file:
+        return json.load(file)
+
+
+def compare(current: dict, baseline: dict, threshold: float, alpha: float) -> list:
+    """
+    Compares every benchmark present in both reports.
+
+    A benchmark regresses when its median ns/element grew by more than 'threshold' AND the
+    Mann-Whitney test says the slowdown is significant at 'alpha'; noise on its own cannot
+    fail the check, and neither can a tiny but consistent slowdown.
+
+    Returns:
+        List of (key, baseline median, current median, ratio, p-value, regressed) tuples.
+    """
+
+    baseline_by_key = {(b["name"], b["type"]): b for b in baseline.get("benchmarks", [])}
+    rows = []
+    for bench in current.get("benchmarks", []):
+        key = (bench["name"], bench["type"])
+        reference = baseline_by_key.get(key)
+        if reference is None:
+            rows.append((key, None, median(bench["nsPerElement"]["samples"]), None, None, False))
+            continue
+
+        current_samples = bench["nsPerElement"]["samples"]
+        baseline_samples = reference["nsPerElement"]["samples"]
+        baseline_median = median(baseline_samples)
+        current_median = median(current_samples)
+        ratio = current_median / baseline_median if baseline_median > 0.0 else 1.0
+        p_value = mann_whitney_greater(current_samples, baseline_samples)
+        rows.append((key, baseline_median, current_median, ratio, p_value, ratio > 1.0 + threshold and p_value < alpha))
+    return rows
+
+
+def main():
+
+    # Parse args
+    parser = argparse.ArgumentParser(
+        description="Run the MathLib perf harness and fail on regressions against a stored baseline.",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  python -m scripts.perf_check --update-baseline          # Record the baseline (e.g. on the release branch)
+  python -m scripts.perf_check                            # Compare, exit 1 on regression or missing baseline
+  python -m scripts.perf_check --filter Inverse           # Only the Inverse benchmarks
+  python -m scripts.perf_check --threshold 0.1            # Fail from a 10% slowdown
+        """
+    )
+
+    parser.add_argument("--harness", default="", help="Path to MathLib_PerfHarness (default: searched in lib/)")
+    parser.add_argument("--baseline", default="", help="Baseline JSON recorded on this machine (default: tools/perf_baseline.json)")
+    parser.add_argument("--output", default="", help="Where to keep the JSON of this run, confirmation reruns go next to it as <name>_confirm<N>.json (default: next to the baseline)")
+    parser.add_argument("--threshold", type=float, default=0.20, help="Relative slowdown of the median that fails (default: 0.20)")
+    parser.add_argument("--alpha", type=float, default=0.01, help="Significance level of the Mann-Whitney test (default: 0.01)")
+    parser.add_argument("--repetitions", type=int, default=15, help="Samples per benchmark (default: 15)")
+    parser.add_argument("--filter", default="", help="Only run benchmarks whose 'name type' contains this text")
+    parser.add_argument("--update-baseline", action="store_true", help="Store this run as the new baseline and exit")
+    args = parser.parse_args()
+
+    # Paths
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    project_root = os.path.abspath(os.path.join(script_dir, "..", ".."))
+    harness = args.harness or find_harness(project_root)
+    baseline_path = args.baseline or os.path.join(project_root, "tools", "perf_baseline.json")
+    output_path = args.output or os.path.splitext(baseline_path)[0] + "_current.json"
+
+    print("=" * 70 + "\n")
+    print("MathLib Performance Check")
+    print("\n" + "=" * 70 + "\n")
+
+    if not harness or not os.path.exists(harness):
+        print_bright_red(f"❌ Perf harness not found: {harness or 'lib/MathLib_PerfHarness'}")
+        print_bright_red("   Build it first (Release), e.g. cmake --build <build> --target MathLib_PerfHarness")
+        print("\n" + "=" * 70)
+        sys.exit(1)
+
+    print(f"Harness:   {harness}")
+    print(f"Baseline:  {baseline_path}")
+    print(f"Threshold: +{args.threshold * 100:.0f}% median, p < {args.alpha}\n")
+
+    # Timings only compare against a baseline recorded on the same machine: a missing one is an
+    # error, never silently replaced by this run (which would make the check always pass)
+    if not args.update_baseline and not os.path.exists(baseline_path):
+        print_bright_red(f"❌ Baseline not found: {baseline_path}")
+        print_bright_red("   Record one on this machine first: perf_check --update-baseline (or the perf_baseline target)")
+        print("\n" + "=" * 70)
+        sys.exit(1)
+
+    current = run_harness(harness, output_path, args.repetitions, args.filter)
+
+    if args.update_baseline:
+        shutil.copyfile(output_path, baseline_path)
+        print_bright_yellow("\n" + "=" * 70 + "\n")
+        print_bright_yellow(f"⚠️  Baseline updated: {baseline_path}")
+        print_bright_yellow("\n" + "=" * 70)
+        return
+
+    with open(baseline_path, "r") as file:
+        baseline = json.load(file)
+
+    rows = compare(current, baseline, args.threshold, args.alpha)
+
+    # A shared machine can slow one benchmark down for a while: re-run every flagged benchmark
+    # and only keep the regressions that show up again. Each rerun gets its own JSON next to the
+    # first run's, so both can be inspected when the regression is confirmed.
+    rerun_paths = []
+    for index, row in enumerate(rows):
+        if not row[5]:
+            continue
+        name, type_name = row[0]
+        rerun_path = f"{os.path.splitext(output_path)[0]}_confirm{len(rerun_paths)}.json"
+        rerun_paths.append(rerun_path)
+        print_bright_yellow(f"\nConfirming {name} {type_name}... ({rerun_path})")
+        rerun = run_harness(harness, rerun_path, args.repetitions, f"{name} {type_name}")
+        rerun["benchmarks"] = [b for b in rerun["benchmarks"] if (b["name"], b["type"]) == row[0]]
+        confirmed = compare(rerun, baseline, args.threshold, args.alpha)
+        if confirmed and not confirmed[0][5]:
+            rows[index] = confirmed[0]
+
+    print("\n" + f"{'Benchmark':<44}{'Baseline':>11}{'Current':>11}{'Change':>9}{'p':>9}")
+    for (name, type_name), baseline_median, current_median, ratio, p_value, regressed in rows:
+        label = f"{name} {type_name}"
+        if baseline_median is None:
+            print(f"{label:<44}{'-':>11}{current_median:>9.3f}ns{'new':>9}")
+            continue
+        line = f"{label:<44}{baseline_median:>9.3f}ns{current_median:>9.3f}ns{(ratio - 1.0) * 100.0:>+8.1f}%{p_value:>9.4f}"
+        if regressed:
+            print_bright_red(line + "  REGRESSION")
+        else:
+            print(line)
+
+    regressions = [row for row in rows if row[5]]
+    if regressions:
+        print_bright_red("\n" + "=" * 70 + "\n")
+        print_bright_red(f"❌ {len(regressions)} benchmark(s) regressed by more than {args.threshold * 100:.0f}%.")
+        print_bright_red(f"   Runs: {', '.join([output_path] + rerun_paths)}")
+        print_bright_red("\n" + "=" * 70)
+        sys.exit(1)
+
+    print_bright_green("\n" + "=" * 70 + "\n")
+    print_bright_green("✅ No performance regression.")
+    print_bright_green("\n" + "=" * 70)
+
+if __name__ == "__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        print("\n\n⚠️  Perf check interrupted by user")
+        sys.exit(1)
+    except Exception as e:
+        print(f"\n❌ Unexpected error: {e}")
+        sys.exit(1)